@@ -0,0 +1,19 @@
+TEMPLATE = app
+TARGET = bench-circular-buffer
+CONFIG += console c++1z link_pkgconfig release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# only the headers, for the types in stable.hpp
+PKGCONFIG += sfml-graphics
+INCLUDEPATH += ../networking-ts-impl/include
+LIBS += -lpthread
+
+
+SOURCES += \
+        ../src/bench_circular_buffer.cpp
+
+HEADERS += \
+    ../src/circular_buffer.h \
+    ../src/stable_win32.hpp \
+    ../src/stable.hpp
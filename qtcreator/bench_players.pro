@@ -0,0 +1,44 @@
+TEMPLATE = app
+TARGET = bench-players
+CONFIG += console c++1z link_pkgconfig release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# no window, players are made of sfml types
+PKGCONFIG += sfml-graphics
+INCLUDEPATH += ../networking-ts-impl/include
+LIBS += -lpthread
+QMAKE_CXXFLAGS += -fcoroutines-ts
+
+
+SOURCES += \
+        ../src/bench_players.cpp \
+    ../src/compress.cpp \
+    ../src/headless.cpp \
+    ../src/ui_state.cpp \
+    ../src/snake.cpp \
+    ../src/snake_network.cpp \
+    ../src/network.cpp \
+    ../src/allocs.cpp \
+    ../src/profile.cpp \
+    ../src/input_latency.cpp \
+    ../src/network_udp.cpp \
+    ../src/metrics.cpp
+
+HEADERS += \
+    ../src/allocs.h \
+    ../src/compress.h \
+    ../src/arena.h \
+    ../src/slot_map.h \
+    ../src/snake.h \
+    ../src/network.h \
+    ../src/timing_wheel.h \
+    ../src/profile.h \
+    ../src/input_latency.h \
+    ../src/circular_buffer.h \
+    ../src/coro.h \
+    ../src/metrics.h \
+    ../src/stable_win32.hpp \
+    ../src/ui_state.h \
+    ../src/engine.h \
+    ../src/stable.hpp
@@ -0,0 +1,17 @@
+TEMPLATE = app
+TARGET = snek-embed-fonts
+CONFIG += console c++1z link_pkgconfig release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# writes src/font_data.cpp, nothing is linked but the headers include sfml
+PKGCONFIG += sfml-graphics
+INCLUDEPATH += ../networking-ts-impl/include
+
+
+SOURCES += \
+        ../src/embed_fonts.cpp
+
+HEADERS += \
+    ../src/stable_win32.hpp \
+    ../src/stable.hpp
@@ -11,17 +11,46 @@ LIBS += -lpthread -lclang
 # QMAKE_LINK += -fxray-instrument -fxray-instruction-threshold=1
 # QMAKE_CXXFLAGS += -fxray-instrument -fxray-instruction-threshold=1
 QMAKE_CXXFLAGS += -fcoroutines-ts
+# counts allocations per frame, see allocs.h
+# DEFINES += SNEK_TRACK_ALLOCS
+# zones, F4 overlay and F5 trace, see profile.h
+# DEFINES += SNEK_PROFILE
 
+# font_data.cpp is generated by embed_fonts.pro, which also checks it
 
 SOURCES += \
         ../src/main.cpp \
     ../src/snake.cpp \
-    ../src/network.cpp
+    ../src/snake_network.cpp \
+    ../src/network.cpp \
+    ../src/allocs.cpp \
+    ../src/profile.cpp \
+    ../src/input_latency.cpp \
+    ../src/network_udp.cpp \
+    ../src/metrics.cpp \
+    ../src/compress.cpp \
+    ../src/fonts.cpp \
+    ../src/font_data.cpp \
+    ../src/pack.cpp \
+    ../src/ui_state.cpp
 
 HEADERS += \
+    ../src/allocs.h \
     ../src/snake.h \
     ../src/network.h \
+    ../src/timing_wheel.h \
+    ../src/profile.h \
+    ../src/input_latency.h \
+    ../src/circular_buffer.h \
+    ../src/coro.h \
+    ../src/arena.h \
+    ../src/slot_map.h \
+    ../src/metrics.h \
+    ../src/compress.h \
+    ../src/fonts.h \
+    ../src/pack.h \
     ../src/stable_win32.hpp \
+    ../src/ui_state.h \
     ../src/engine.h \
     ../src/stable.hpp
 
@@ -0,0 +1,44 @@
+TEMPLATE = app
+TARGET = snek-loadtest
+CONFIG += console c++1z link_pkgconfig
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# no window, the protocol still uses sfml types
+PKGCONFIG += sfml-graphics
+INCLUDEPATH += ../networking-ts-impl/include
+LIBS += -lpthread
+QMAKE_CXXFLAGS += -fcoroutines-ts
+
+
+SOURCES += \
+        ../src/loadtest.cpp \
+    ../src/headless.cpp \
+    ../src/ui_state.cpp \
+    ../src/snake.cpp \
+    ../src/snake_network.cpp \
+    ../src/network.cpp \
+    ../src/allocs.cpp \
+    ../src/profile.cpp \
+    ../src/input_latency.cpp \
+    ../src/network_udp.cpp \
+    ../src/metrics.cpp \
+    ../src/compress.cpp
+
+HEADERS += \
+    ../src/allocs.h \
+    ../src/snake.h \
+    ../src/network.h \
+    ../src/timing_wheel.h \
+    ../src/profile.h \
+    ../src/input_latency.h \
+    ../src/circular_buffer.h \
+    ../src/coro.h \
+    ../src/arena.h \
+    ../src/slot_map.h \
+    ../src/metrics.h \
+    ../src/compress.h \
+    ../src/stable_win32.hpp \
+    ../src/ui_state.h \
+    ../src/engine.h \
+    ../src/stable.hpp
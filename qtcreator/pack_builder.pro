@@ -0,0 +1,27 @@
+TEMPLATE = app
+TARGET = snek-pack
+CONFIG += console c++1z link_pkgconfig release
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# no window, headless.cpp still uses sfml types
+PKGCONFIG += sfml-graphics
+INCLUDEPATH += ../networking-ts-impl/include
+# std::filesystem before gcc 9
+LIBS += -lpthread -lstdc++fs
+
+
+SOURCES += \
+        ../src/pack_builder.cpp \
+    ../src/pack.cpp \
+    ../src/compress.cpp \
+    ../src/headless.cpp \
+    ../src/ui_state.cpp
+
+HEADERS += \
+    ../src/pack.h \
+    ../src/compress.h \
+    ../src/stable_win32.hpp \
+    ../src/ui_state.h \
+    ../src/engine.h \
+    ../src/stable.hpp
@@ -0,0 +1,191 @@
+#include "allocs.h"
+#include "stable_win32.hpp"
+
+#ifdef SNEK_TRACK_ALLOCS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Allocs {
+
+namespace {
+
+constexpr size_t TAGS = static_cast<size_t>(Tag::Count);
+constexpr const char *TAG_NAMES[TAGS] = {"other", "input",  "tick",
+                                         "net",   "render", "ui"};
+// steady state frames reported one by one, the rest only counted
+constexpr u64 MAX_REPORTED = 20;
+
+// Touched from operator new, so nothing here may allocate.
+thread_local Tag current = Tag::Other;
+
+struct Live {
+    std::atomic<u64> allocs{0};
+    std::atomic<u64> bytes{0};
+};
+std::array<Live, TAGS> live;
+std::atomic<u64> frees{0};
+
+void count(size_t size) {
+    auto &l = live[static_cast<size_t>(current)];
+    l.allocs.fetch_add(1, std::memory_order_relaxed);
+    l.bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+// The frame loop's side, one thread.
+struct Counts {
+    u64 allocs = 0;
+    u64 bytes = 0;
+};
+
+struct Totals {
+    Counts sum;
+    Counts max;
+};
+
+std::array<Counts, TAGS> last;
+std::array<Totals, TAGS> totals;
+u64 frames = 0;
+u64 allocating_frames = 0;
+u64 steady_frames = 0;
+u64 flagged_frames = 0;
+u32 settled = 0;
+
+void *allocate(size_t size) {
+    count(size);
+    if (size == 0)
+        size = 1;
+    for (;;) {
+        if (auto p = std::malloc(size))
+            return p;
+        auto handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void *allocate(size_t size, const std::nothrow_t &) noexcept {
+    try {
+        return allocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void release(void *p) {
+    if (p) {
+        frees.fetch_add(1, std::memory_order_relaxed);
+        std::free(p);
+    }
+}
+
+} // namespace
+
+Scope::Scope(Tag tag) : outer(current) { current = tag; }
+Scope::~Scope() { current = outer; }
+
+void end_frame() {
+    frames++;
+    std::array<Counts, TAGS> frame;
+    Counts all;
+    for (size_t i = 0; i < TAGS; ++i) {
+        const Counts now{live[i].allocs.load(std::memory_order_relaxed),
+                         live[i].bytes.load(std::memory_order_relaxed)};
+        frame[i] = {now.allocs - last[i].allocs, now.bytes - last[i].bytes};
+        last[i] = now;
+
+        auto &t = totals[i];
+        t.sum.allocs += frame[i].allocs;
+        t.sum.bytes += frame[i].bytes;
+        t.max.allocs = std::max(t.max.allocs, frame[i].allocs);
+        t.max.bytes = std::max(t.max.bytes, frame[i].bytes);
+        all.allocs += frame[i].allocs;
+        all.bytes += frame[i].bytes;
+    }
+    if (all.allocs) {
+        allocating_frames++;
+    }
+
+    if (settled < WARMUP_FRAMES) {
+        settled++;
+        return;
+    }
+    steady_frames++;
+    if (!all.allocs)
+        return;
+    if (flagged_frames++ >= MAX_REPORTED)
+        return;
+
+    // on the stack, a string would show up in the next frame
+    char line[256];
+    int n = snprintf(line, sizeof(line),
+                     "frame %llu allocated %llu times, %llu B:",
+                     static_cast<unsigned long long>(frames),
+                     static_cast<unsigned long long>(all.allocs),
+                     static_cast<unsigned long long>(all.bytes));
+    for (size_t i = 0; i < TAGS && n > 0 && n < int(sizeof(line)); ++i) {
+        if (frame[i].allocs) {
+            n += snprintf(line + n, sizeof(line) - n, " %s %llu (%llu B)",
+                          TAG_NAMES[i],
+                          static_cast<unsigned long long>(frame[i].allocs),
+                          static_cast<unsigned long long>(frame[i].bytes));
+        }
+    }
+    fprintf(stderr, "%s%s\n", line,
+            flagged_frames == MAX_REPORTED ? ", not reporting any more"
+                                           : "");
+}
+
+void settle() { settled = 0; }
+
+std::string report() {
+    std::ostringstream out;
+    out << "allocations over " << frames << " frames, " << allocating_frames
+        << " allocating\n";
+    out << "steady state frames " << steady_frames << ", allocating "
+        << flagged_frames << "\n";
+    char line[128];
+    snprintf(line, sizeof(line), "  %-8s %12s %12s %10s %10s %12s\n", "tag",
+             "allocs", "bytes", "per frame", "max", "max bytes");
+    out << line;
+    for (size_t i = 0; i < TAGS; ++i) {
+        auto &t = totals[i];
+        snprintf(line, sizeof(line),
+                 "  %-8s %12llu %12llu %10.2f %10llu %12llu\n", TAG_NAMES[i],
+                 static_cast<unsigned long long>(t.sum.allocs),
+                 static_cast<unsigned long long>(t.sum.bytes),
+                 frames ? double(t.sum.allocs) / frames : 0.0,
+                 static_cast<unsigned long long>(t.max.allocs),
+                 static_cast<unsigned long long>(t.max.bytes));
+        out << line;
+    }
+    out << "frees " << frees.load(std::memory_order_relaxed) << "\n";
+    return out.str();
+}
+
+} // namespace Allocs
+
+// Over-aligned allocations keep the library's operators and go uncounted.
+void *operator new(size_t size) { return Allocs::allocate(size); }
+void *operator new[](size_t size) { return Allocs::allocate(size); }
+void *operator new(size_t size, const std::nothrow_t &tag) noexcept {
+    return Allocs::allocate(size, tag);
+}
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+    return Allocs::allocate(size, tag);
+}
+
+void operator delete(void *p) noexcept { Allocs::release(p); }
+void operator delete[](void *p) noexcept { Allocs::release(p); }
+void operator delete(void *p, size_t) noexcept { Allocs::release(p); }
+void operator delete[](void *p, size_t) noexcept { Allocs::release(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+    Allocs::release(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+    Allocs::release(p);
+}
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+#include "stable_win32.hpp"
+
+// Allocation tracking, compiled in with SNEK_TRACK_ALLOCS defined and to
+// nothing without. Global operator new and delete are replaced to count
+// every allocation against the tag of the innermost Scope of the
+// allocating thread. The frame loop calls end_frame, and once a game state
+// has run for WARMUP_FRAMES a frame that still allocates is reported on
+// stderr: in the steady state the hot loop should not allocate at all.
+namespace Allocs {
+
+enum class Tag : u8 { Other, Input, Tick, Net, Render, Ui, Count };
+
+constexpr u32 WARMUP_FRAMES = 120;
+
+#ifdef SNEK_TRACK_ALLOCS
+
+// Tags what this thread allocates until the end of the scope.
+class Scope {
+public:
+    explicit Scope(Tag tag);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    void operator=(const Scope &) = delete;
+
+private:
+    Tag outer;
+};
+
+// what was allocated since the last call, from any thread
+void end_frame();
+// starts the warm up over, after a change of game state
+void settle();
+// per tag counts and bytes over all frames so far
+std::string report();
+
+#else
+
+class Scope {
+public:
+    explicit Scope(Tag) {}
+};
+
+inline void end_frame() {}
+inline void settle() {}
+inline std::string report() { return {}; }
+
+#endif
+
+} // namespace Allocs
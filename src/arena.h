@@ -0,0 +1,127 @@
+#pragma once
+#include "stable_win32.hpp"
+
+#include <cstring>
+
+// Memory for data that lives one frame: allocation bumps a pointer, nothing
+// is freed one by one and reset takes everything back at once. Blocks are
+// kept across resets, and once a frame has needed more than one they are
+// merged, so the steady state is one block and no malloc at all. Debug
+// builds fill what reset takes back with 0xdd so data used after it shows.
+class Arena {
+public:
+    static constexpr size_t DEFAULT_BLOCK = 64 * 1024;
+    static constexpr u8 POISON = 0xdd;
+
+    explicit Arena(size_t block_size = DEFAULT_BLOCK)
+        : block_size(block_size) {}
+
+    Arena(const Arena &) = delete;
+    void operator=(const Arena &) = delete;
+
+    void *allocate(size_t size, size_t align) {
+        for (;;) {
+            if (current < blocks.size()) {
+                auto &block = blocks[current];
+                const size_t start = (used + align - 1) & ~(align - 1);
+                if (start + size <= block.size) {
+                    used = start + size;
+                    high_water = std::max(high_water, in_use());
+                    return block.data.get() + start;
+                }
+                current++;
+                used = 0;
+                continue;
+            }
+            add_block(std::max(block_size, size + align));
+        }
+    }
+
+    void reset() {
+#ifndef NDEBUG
+        for (size_t i = 0; i < blocks.size() && i <= current; ++i) {
+            const size_t n = i < current ? blocks[i].size : used;
+            std::memset(blocks[i].data.get(), POISON, n);
+        }
+#endif
+        if (blocks.size() > 1) {
+            // next frame's worth in one block
+            size_t total = 0;
+            for (auto &block : blocks)
+                total += block.size;
+            blocks.clear();
+            add_block(total);
+        }
+        current = 0;
+        used = 0;
+    }
+
+    // bytes handed out since the last reset
+    size_t in_use() const {
+        size_t n = used;
+        for (size_t i = 0; i < current && i < blocks.size(); ++i)
+            n += blocks[i].size;
+        return n;
+    }
+    size_t capacity() const {
+        size_t n = 0;
+        for (auto &block : blocks)
+            n += block.size;
+        return n;
+    }
+    // the most any frame has used
+    size_t peak() const { return high_water; }
+
+private:
+    struct Block {
+        std::unique_ptr<u8[]> data;
+        size_t size;
+    };
+
+    void add_block(size_t size) {
+        blocks.push_back({std::make_unique<u8[]>(size), size});
+    }
+
+    std::vector<Block> blocks;
+    size_t block_size;
+    // the block allocated from and how much of it is taken
+    size_t current = 0;
+    size_t used = 0;
+    size_t high_water = 0;
+};
+
+// Lets standard containers allocate from an Arena. Deallocation does
+// nothing, the memory comes back on reset, so a container using it must be
+// gone or emptied of its storage by then. Without an arena it is the
+// plain heap.
+template <typename T> class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() = default;
+    ArenaAllocator(Arena &arena) : arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+    T *allocate(size_t n) {
+        if (!arena)
+            return std::allocator<T>().allocate(n);
+        return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *p, size_t n) {
+        if (!arena)
+            std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U> bool operator==(const ArenaAllocator<U> &o) const {
+        return arena == o.arena;
+    }
+    template <typename U> bool operator!=(const ArenaAllocator<U> &o) const {
+        return arena != o.arena;
+    }
+
+private:
+    template <typename U> friend class ArenaAllocator;
+    Arena *arena = nullptr;
+};
@@ -0,0 +1,155 @@
+#include "circular_buffer.h"
+#include "stable_win32.hpp"
+
+// Contention benchmark for the queues in circular_buffer.h against the
+// mutex based CircularBuffer they replaced: moves a number of integers from
+// producer threads to consumer threads and prints the throughput. Every
+// queue must hand over exactly what was pushed, checked with a sum.
+
+namespace {
+
+constexpr size_t CAPACITY = 1024;
+
+// The previous CircularBuffer, with its overwriting push swapped for push
+// and pop that give up like the lock-free ones so nothing gets lost.
+template <typename T, size_t N> class MutexCircularBuffer {
+public:
+    size_t push(const T *items, size_t count) {
+        std::lock_guard guard(mutex);
+        count = std::min(count, N - size_);
+        for (size_t i = 0; i < count; ++i) {
+            data_[push_index_++] = items[i];
+            if (push_index_ >= N)
+                push_index_ = 0;
+        }
+        size_ += count;
+        return count;
+    }
+
+    size_t pop(T *out, size_t max) {
+        std::lock_guard guard(mutex);
+        const size_t count = std::min<size_t>(max, size_);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = data_[pop_index_++];
+            if (pop_index_ >= N)
+                pop_index_ = 0;
+        }
+        size_ -= count;
+        return count;
+    }
+
+private:
+    size_t push_index_ = 0;
+    size_t pop_index_ = 0;
+    std::atomic<size_t> size_ = 0;
+    std::array<T, N> data_;
+    std::mutex mutex;
+};
+
+struct Result {
+    double seconds = 0.0;
+    bool ok = false;
+};
+
+template <typename Queue>
+Result run(u32 producers, u32 consumers, u64 items, size_t batch) {
+    auto queue = std::make_unique<Queue>();
+    const u64 per_producer = items / producers;
+    const u64 total = per_producer * producers;
+
+    std::atomic_bool go = false;
+    std::atomic<u64> consumed = 0;
+    std::atomic<u64> sum = 0;
+    std::vector<std::thread> threads;
+
+    for (u32 p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            std::vector<u64> values(batch);
+            u64 next = p * per_producer;
+            const u64 end = next + per_producer;
+            while (!go)
+                ;
+            while (next < end) {
+                const size_t n = std::min<u64>(batch, end - next);
+                for (size_t i = 0; i < n; ++i) {
+                    values[i] = next + i;
+                }
+                size_t pushed = 0;
+                while (pushed < n) {
+                    const size_t k =
+                        queue->push(values.data() + pushed, n - pushed);
+                    if (k == 0)
+                        std::this_thread::yield();
+                    pushed += k;
+                }
+                next += n;
+            }
+        });
+    }
+
+    for (u32 c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+            std::vector<u64> values(batch);
+            u64 local_sum = 0;
+            while (!go)
+                ;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                const size_t n = queue->pop(values.data(), batch);
+                if (n == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    local_sum += values[i];
+                }
+                consumed.fetch_add(n, std::memory_order_relaxed);
+            }
+            sum += local_sum;
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    Result result;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.ok = sum == total * (total - 1) / 2;
+    return result;
+}
+
+template <typename Queue>
+void report(const char *name, u32 producers, u32 consumers, u64 items,
+            size_t batch) {
+    const auto r = run<Queue>(producers, consumers, items, batch);
+    printf("%-8s %up%uc  batch %3zu  %8.2f Mitems/s  %s\n", name, producers,
+           consumers, batch, items / r.seconds / 1e6, r.ok ? "ok" : "LOST");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const u64 items =
+        argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+
+    using Mutex = MutexCircularBuffer<u64, CAPACITY>;
+    using Spsc = CircularBuffer<u64, CAPACITY, QueueMode::Spsc>;
+    using Mpmc = CircularBuffer<u64, CAPACITY, QueueMode::Mpmc>;
+
+    for (size_t batch : {1, 32}) {
+        report<Mutex>("mutex", 1, 1, items, batch);
+        report<Spsc>("spsc", 1, 1, items, batch);
+        report<Mpmc>("mpmc", 1, 1, items, batch);
+    }
+
+    const u32 threads = std::max(2u, std::thread::hardware_concurrency() / 2);
+    for (u32 n : {2u, threads}) {
+        report<Mutex>("mutex", n, n, items, 1);
+        report<Mpmc>("mpmc", n, n, items, 1);
+    }
+
+    return 0;
+}
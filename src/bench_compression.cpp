@@ -0,0 +1,241 @@
+#include "compress.h"
+#include "network.h"
+#include "snake.h"
+#include "stable_win32.hpp"
+
+#include <fstream>
+
+// Compression ratio and throughput of compress.h on frames as the host
+// sends them. Takes recordings made with SNEK_RECORD_FRAMES, without any it
+// makes up a game: a lobby of 16 players joining, then snakes wandering a
+// 30x30 map with tick updates every tick and snapshots every
+// SNAPSHOT_INTERVAL ticks.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Frame = std::vector<u8>;
+using namespace SnakeNetwork;
+
+std::vector<Frame> load(const char *path) {
+    std::vector<Frame> frames;
+    std::ifstream file(path, std::ios::binary);
+    u32 size;
+    while (file.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+        Frame frame(size);
+        if (!file.read(reinterpret_cast<char *>(frame.data()), size))
+            break;
+        frames.push_back(std::move(frame));
+    }
+    return frames;
+}
+
+std::vector<Frame> synthetic_game(u32 players, u32 ticks) {
+    constexpr int SIZE = 30;
+    std::mt19937 rng(42);
+    std::vector<Frame> frames;
+    Network::Buffer b;
+    Message msg;
+
+    for (u32 id = 1; id <= players; ++id) {
+        msg.body = NewPlayer{id, true};
+        encode(b, msg);
+    }
+    for (u32 id = 1; id <= players; ++id) {
+        msg.body = SetPlayerInfo{id,
+                                 true,
+                                 static_cast<u32>(rng() % SIZE),
+                                 static_cast<u32>(rng() % SIZE),
+                                 SnakeGame::Direction::Up,
+                                 sf::Color(rng() % 256, rng() % 256, 255)};
+        encode(b, msg);
+    }
+    msg.body = StartGame{};
+    encode(b, msg);
+    frames.push_back(std::move(b.bytes));
+    b.reset();
+
+    SnakeGame::WorldState world;
+    for (u32 id = 1; id <= players; ++id) {
+        auto &snake = world.players.emplace_back();
+        snake.id = id;
+        snake.dir = SnakeGame::Direction::Up;
+        const sf::Vector2i head(rng() % SIZE, rng() % SIZE);
+        const size_t length = 3 + rng() % 30;
+        for (size_t i = 0; i < length; ++i) {
+            snake.body.push_back({head.x, (head.y + static_cast<int>(i)) %
+                                              SIZE});
+        }
+    }
+
+    std::deque<SnakeGame::WorldState> sent;
+    for (u32 tick = 1; tick <= ticks; ++tick) {
+        world.tick = tick;
+
+        SnakeGame::TickChanges changes;
+        for (u32 slot = 0; slot < world.players.size(); ++slot) {
+            auto &snake = world.players[slot];
+            // mostly straight on, like a snake under a human
+            if (rng() % 8 == 0) {
+                const auto turn = rng() % 2 ? SnakeGame::next_left
+                                            : SnakeGame::next_right;
+                snake.dir = turn[static_cast<int>(snake.dir)];
+            }
+            static constexpr int dx[] = {0, 1, 0, -1};
+            static constexpr int dy[] = {-1, 0, 1, 0};
+            const int d = static_cast<int>(snake.dir);
+            auto head = snake.body.front();
+            head.x = (head.x + dx[d] + SIZE) % SIZE;
+            head.y = (head.y + dy[d] + SIZE) % SIZE;
+            snake.body.insert(snake.body.begin(), head);
+            if (rng() % 10 == 0) {
+                changes.grown.push_back(slot);
+            } else {
+                snake.body.pop_back();
+            }
+            changes.moves.push_back({slot, snake.dir});
+        }
+        if (rng() % 4 == 0) {
+            const sf::Vector2i food(rng() % SIZE, rng() % SIZE);
+            if (std::find(world.food.begin(), world.food.end(), food) ==
+                world.food.end()) {
+                world.food.push_back(food);
+                changes.food_added.push_back(food);
+                std::sort(world.food.begin(), world.food.end(),
+                          SnakeGame::cell_less);
+            }
+        }
+
+        msg.body = HeartBeat{tick * 16, tick * 16 - 40};
+        encode(b, msg);
+        msg.body = TickUpdate{tick, players, std::move(changes)};
+        encode(b, msg);
+        msg.body = InputAck{tick / 3, tick / 2};
+        encode(b, msg);
+        frames.push_back(std::move(b.bytes));
+        b.reset();
+
+        if (tick % SnakeGame::SNAPSHOT_INTERVAL == 0) {
+            // the guest acked the previous snapshot
+            msg.body = make_snapshot(sent.empty() ? nullptr : &sent.back(),
+                                     world);
+            encode(b, msg);
+            frames.push_back(std::move(b.bytes));
+            b.reset();
+            sent.push_back(world);
+        }
+    }
+    return frames;
+}
+
+struct Totals {
+    u64 frames = 0;
+    u64 raw = 0;
+    u64 wire = 0;
+    u64 eligible = 0;
+    u64 eligible_raw = 0;
+    u64 eligible_packed = 0;
+};
+
+void add(Totals &t, const Frame &frame, const Frame &packed) {
+    t.frames++;
+    t.raw += frame.size();
+    if (frame.size() < Network::MIN_COMPRESSED_SIZE) {
+        t.wire += frame.size();
+        return;
+    }
+    t.eligible++;
+    t.eligible_raw += frame.size();
+    t.eligible_packed += packed.size();
+    t.wire += std::min(frame.size(), packed.size());
+}
+
+void print_totals(const char *name, const Totals &t) {
+    printf("  %-16s %7llu frames  %9llu B  wire %5.1f%%  compressed "
+           "frames %5.1f%% (%llu)\n",
+           name, static_cast<unsigned long long>(t.frames),
+           static_cast<unsigned long long>(t.raw),
+           t.raw ? 100.0 * t.wire / t.raw : 100.0,
+           t.eligible_raw ? 100.0 * t.eligible_packed / t.eligible_raw : 100.0,
+           static_cast<unsigned long long>(t.eligible));
+}
+
+// Runs f over and over for at least half a second, returns MB/s of bytes.
+template <typename F> double throughput(u64 bytes, F f) {
+    u64 rounds = 0;
+    const auto start = Clock::now();
+    auto now = start;
+    do {
+        f();
+        rounds++;
+        now = Clock::now();
+    } while (now - start < 500ms);
+    const double seconds = std::chrono::duration<double>(now - start).count();
+    return bytes * rounds / seconds / (1 << 20);
+}
+
+void bench(const char *name, const std::vector<Frame> &frames) {
+    printf("%s\n", name);
+
+    std::vector<Frame> packed(frames.size());
+    Totals all;
+    std::map<std::string, Totals> by_type;
+    bool ok = true;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        auto &frame = frames[i];
+        Compression::compress(frame.data(), frame.size(), packed[i]);
+        Frame unpacked;
+        ok &= Compression::decompress(packed[i].data(), packed[i].size(),
+                                      unpacked, Network::MAX_FRAME_SIZE) &&
+              unpacked == frame;
+
+        add(all, frame, packed[i]);
+        // frames are classed by their first message
+        add(by_type[frame.empty() ? "empty" : message_name(frame[0])], frame,
+            packed[i]);
+    }
+
+    print_totals("all", all);
+    for (auto &[type, totals] : by_type) {
+        print_totals(type.c_str(), totals);
+    }
+
+    u64 eligible_bytes = 0;
+    for (auto &frame : frames) {
+        if (frame.size() >= Network::MIN_COMPRESSED_SIZE)
+            eligible_bytes += frame.size();
+    }
+    Frame out;
+    const double encode = throughput(eligible_bytes, [&]() {
+        for (auto &frame : frames) {
+            if (frame.size() < Network::MIN_COMPRESSED_SIZE)
+                continue;
+            out.clear();
+            Compression::compress(frame.data(), frame.size(), out);
+        }
+    });
+    const double decode = throughput(eligible_bytes, [&]() {
+        for (size_t i = 0; i < frames.size(); ++i) {
+            if (frames[i].size() < Network::MIN_COMPRESSED_SIZE)
+                continue;
+            out.clear();
+            Compression::decompress(packed[i].data(), packed[i].size(), out,
+                                    Network::MAX_FRAME_SIZE);
+        }
+    });
+    printf("  encode %.1f MB/s  decode %.1f MB/s  round trip %s\n\n", encode,
+           decode, ok ? "ok" : "FAILED");
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        bench("synthetic, 16 players", synthetic_game(16, 3000));
+        bench("synthetic, 64 players", synthetic_game(64, 3000));
+    }
+    for (int i = 1; i < argc; ++i) {
+        bench(argv[i], load(argv[i]));
+    }
+    return 0;
+}
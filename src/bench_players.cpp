@@ -0,0 +1,236 @@
+#include "snake.h"
+#include "stable_win32.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Iteration and lookup over SnakeGame::PlayerList, through the players and
+// through the hot arrays the tick loops use, against the unordered_map of
+// whole records players lived in before. The lobbies are built the way a
+// long running room fills up: players join and leave, so ids spread out
+// and the map's nodes end up all over the heap. Then whole host ticks of a
+// 10k player game, timed and with the cache misses counted where the
+// kernel lets us.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Player = SnakeGame::Player;
+using List = SnakeGame::PlayerList;
+
+// A player as it was before the split, the hot state inline with the rest.
+struct Record {
+    Player cold;
+    SnakeGame::Motion motion;
+    std::vector<sf::Vector2i> body;
+};
+using Map = std::unordered_map<Network::ClientID, Record>;
+
+Player &cold(Player &player) { return player; }
+Player &cold(Record &record) { return record.cold; }
+std::vector<sf::Vector2i> &body(Player &player) { return player.body(); }
+std::vector<sf::Vector2i> &body(Record &record) { return record.body; }
+int &move_counter(Player &player) { return player.moveCounter(); }
+int &move_counter(Record &record) { return record.motion.moveCounter; }
+Network::ClientID nth_id(List &players, size_t n) { return players[n].first; }
+Network::ClientID nth_id(Map &players, size_t n) {
+    return std::next(players.begin(), n)->first;
+}
+
+template <typename Players, typename Value>
+void fill(Players &players, u32 count, std::mt19937 &rng,
+          std::vector<Network::ClientID> &ids) {
+    Network::ClientID next_id = 1;
+    // some churn first, one leave for every two joins
+    while (players.size() < count) {
+        auto &player = players.emplace(next_id, Value{}).first->second;
+        cold(player).id = next_id++;
+        body(player).resize(3 + rng() % 30);
+        if (rng() % 3 == 0) {
+            players.erase(nth_id(players, rng() % players.size()));
+        }
+    }
+    ids.clear();
+    for (auto &[id, player] : players) {
+        ids.push_back(id);
+    }
+}
+
+// Runs f for at least 200ms, returns nanoseconds per call.
+template <typename F> double time_ns(F f) {
+    u64 rounds = 0;
+    const auto start = Clock::now();
+    auto now = start;
+    do {
+        f();
+        rounds++;
+        now = Clock::now();
+    } while (now - start < 200ms);
+    return std::chrono::duration<double, std::nano>(now - start).count() /
+           rounds;
+}
+
+// volatile so the loops are not thrown away
+volatile u64 sink;
+
+// hot is null for the map, which has no arrays to go through
+template <typename Players, typename Value>
+void bench(const char *name, u32 count,
+           double (*hot)(Players &players) = nullptr) {
+    std::mt19937 rng(7);
+    Players players;
+    std::vector<Network::ClientID> ids;
+    fill<Players, Value>(players, count, rng, ids);
+
+    // what a tick does to every player
+    const double iterate = time_ns([&]() {
+        u64 sum = 0;
+        for (auto &[id, player] : players) {
+            move_counter(player)++;
+            sum += body(player).size() + id;
+        }
+        sink = sum;
+    });
+
+    // messages name players in no particular order
+    std::vector<Network::ClientID> lookups(4096);
+    for (auto &id : lookups) {
+        id = ids[rng() % ids.size()];
+    }
+    const double lookup = time_ns([&]() {
+        u64 sum = 0;
+        for (auto id : lookups) {
+            sum += body(players.at(id)).size();
+        }
+        sink = sum;
+    });
+
+    printf("%-13s %5u players  iterate %5.2f ns  ", name, count,
+           iterate / count);
+    if (hot) {
+        printf("hot arrays %5.2f ns  ", hot(players) / count);
+    } else {
+        printf("%21s", "");
+    }
+    printf("lookup %5.2f ns\n", lookup / lookups.size());
+}
+
+double hot_arrays(List &players) {
+    return time_ns([&]() {
+        u64 sum = 0;
+        for (size_t i = 0; i < players.size(); ++i) {
+            players.motion(i).moveCounter++;
+            sum += players.body(i).size();
+        }
+        sink = sum;
+    });
+}
+
+// Hardware cache misses of this thread, while it is open.
+class CacheMisses {
+public:
+    CacheMisses() {
+#ifdef __linux__
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(
+            syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    ~CacheMisses() {
+#ifdef __linux__
+        if (fd >= 0)
+            close(fd);
+#endif
+    }
+
+    bool available() const { return fd >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    u64 stop() {
+        u64 count = 0;
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &count, sizeof(count)) != sizeof(count))
+                count = 0;
+        }
+#endif
+        return count;
+    }
+
+private:
+    int fd = -1;
+};
+
+// A host with count players, none of them connected, ticking on a map wide
+// enough that every snake gets its own column.
+void bench_tick(u32 count, u32 ticks) {
+    net::io_context ctx;
+    SnakeGame game;
+    game.gridCols = count * 2;
+    game.gridRows = 100;
+    auto &lobby = game.state.emplace<SnakeGame::HostLobby>(game, ctx, 0);
+    for (Network::ClientID id = 1; id <= count; ++id) {
+        lobby.add_player(id)->ready = true;
+    }
+    lobby.start_game();
+
+    CacheMisses misses;
+    Input input;
+    double total = 0.0;
+    double worst = 0.0;
+    u64 missed = 0;
+    for (u32 i = 0; i < ticks; ++i) {
+        lobby.begin_frame();
+        misses.start();
+        const auto start = Clock::now();
+        lobby.game_tick(input, 1.0f / 60.0f);
+        const double ms =
+            std::chrono::duration<double, std::milli>(Clock::now() - start)
+                .count();
+        missed += misses.stop();
+        game.frame_arena.reset();
+        total += ms;
+        worst = std::max(worst, ms);
+    }
+
+    printf("tick          %5u players  %7.3f ms avg  %7.3f ms worst  ", count,
+           total / ticks, worst);
+    if (misses.available()) {
+        printf("%llu cache misses per tick\n",
+               static_cast<unsigned long long>(missed / ticks));
+    } else {
+        printf("cache misses n/a\n");
+    }
+    lobby.end_game();
+}
+
+} // namespace
+
+int main() {
+    for (u32 count : {16u, 256u, 1024u, 10000u}) {
+        bench<Map, Record>("unordered_map", count);
+        bench<List, Player>("PlayerList", count, hot_arrays);
+    }
+    bench_tick(1000, 200);
+    bench_tick(10000, 50);
+    return 0;
+}
@@ -0,0 +1,413 @@
+#include "circular_buffer.h"
+#include "engine.h"
+#include "snake.h"
+#include "ui_state.h"
+#include "stable_win32.hpp"
+
+#include <fstream>
+#include <numeric>
+
+// Micro benchmarks of what sits on the hot paths. Each one is warmed up,
+// calibrated so a sample takes SAMPLE_TIME, then sampled SAMPLES times. The
+// table goes to stderr, the results as JSON to bench-primitives.json or the
+// path after --json. With --baseline the median ns per operation is checked
+// against a stored run, and the exit code is 1 when any benchmark got slower
+// by more than --threshold percent (10 by default). Other arguments keep
+// only the benchmarks whose name contains one of them.
+//
+// No baseline is kept in the tree, timings only compare on the machine they
+// were taken on. A run's JSON is a baseline as is: on the machine that
+// checks, run a release build of the reference commit with --json
+// base.json, then the build to check with --baseline base.json.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using namespace SnakeNetwork;
+
+constexpr auto WARMUP_TIME = 50ms;
+constexpr auto SAMPLE_TIME = 10ms;
+constexpr size_t SAMPLES = 15;
+
+// volatile so the work is not thrown away
+volatile u64 sink;
+
+struct Result {
+    std::string name;
+    u64 iterations = 0; // per sample
+    double median = 0.0;
+    double mean = 0.0;
+    double stddev = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+};
+
+std::vector<Result> results;
+std::vector<std::string> filters;
+
+bool selected(const std::string &name) {
+    if (filters.empty())
+        return true;
+    return std::any_of(filters.begin(), filters.end(), [&](auto &f) {
+        return name.find(f) != std::string::npos;
+    });
+}
+
+// f(n) runs the operation n times.
+template <typename F> void bench(const std::string &name, F f) {
+    if (!selected(name))
+        return;
+
+    u64 n = 1;
+    const auto warmup_end = Clock::now() + WARMUP_TIME;
+    while (Clock::now() < warmup_end) {
+        f(n);
+    }
+    // enough iterations for a sample to take SAMPLE_TIME
+    const double target =
+        std::chrono::duration<double, std::nano>(SAMPLE_TIME).count();
+    for (;;) {
+        const auto start = Clock::now();
+        f(n);
+        const double took =
+            std::chrono::duration<double, std::nano>(Clock::now() - start)
+                .count();
+        if (took >= target / 2) {
+            n = std::max<u64>(1, n * target / took);
+            break;
+        }
+        n *= 2;
+    }
+
+    std::vector<double> ns(SAMPLES);
+    for (auto &sample : ns) {
+        const auto start = Clock::now();
+        f(n);
+        sample = std::chrono::duration<double, std::nano>(Clock::now() - start)
+                     .count() /
+                 n;
+    }
+    std::sort(ns.begin(), ns.end());
+
+    Result r;
+    r.name = name;
+    r.iterations = n;
+    r.median = ns[SAMPLES / 2];
+    r.min = ns.front();
+    r.max = ns.back();
+    for (double v : ns)
+        r.mean += v / SAMPLES;
+    for (double v : ns)
+        r.stddev += (v - r.mean) * (v - r.mean) / SAMPLES;
+    r.stddev = std::sqrt(r.stddev);
+    fprintf(stderr, "%-36s %10.2f ns  (min %.2f  max %.2f  sd %.1f%%)\n",
+            name.c_str(), r.median, r.min, r.max,
+            r.mean > 0 ? 100.0 * r.stddev / r.mean : 0.0);
+    results.push_back(std::move(r));
+}
+
+void array2d() {
+    constexpr int W = 256;
+    constexpr int H = 256;
+    Array2D<u32> grid(W, H);
+    for (int y = 0; y < H; ++y)
+        for (int x = 0; x < W; ++x)
+            grid(x, y) = x ^ y;
+
+    // per cell
+    bench("array2d/row_major", [&](u64 n) {
+        u64 sum = 0;
+        for (u64 i = 0; i < n; ++i) {
+            sum += grid(i % W, (i / W) % H);
+        }
+        sink = sum;
+    });
+    bench("array2d/column_major", [&](u64 n) {
+        u64 sum = 0;
+        for (u64 i = 0; i < n; ++i) {
+            sum += grid((i / H) % W, i % H);
+        }
+        sink = sum;
+    });
+
+    std::mt19937 rng(1);
+    std::vector<sf::Vector2i> cells(4096);
+    for (auto &c : cells)
+        c = {static_cast<int>(rng() % W), static_cast<int>(rng() % H)};
+    bench("array2d/random", [&](u64 n) {
+        u64 sum = 0;
+        for (u64 i = 0; i < n; ++i) {
+            auto &c = cells[i % cells.size()];
+            sum += grid(c.x, c.y);
+        }
+        sink = sum;
+    });
+}
+
+void on_player() {
+    SnakeGame game;
+    SnakeGame::PlayerList players;
+    for (Network::ClientID id = 1; id <= 2; ++id) {
+        auto &p = players.emplace(id, SnakeGame::Player{}).first->second;
+        p.id = id;
+        for (int i = 0; i < 30; ++i)
+            p.body().push_back({static_cast<int>(id) * 10, i});
+    }
+    auto &a = players.at(1);
+    auto &b = players.at(2);
+
+    // a miss walks the whole body, the common case
+    bench("on_player/miss_30", [&](u64 n) {
+        u64 hits = 0;
+        for (u64 i = 0; i < n; ++i)
+            hits += game.on_player(a, b);
+        sink = hits;
+    });
+    bench("on_player/self_30", [&](u64 n) {
+        u64 hits = 0;
+        for (u64 i = 0; i < n; ++i)
+            hits += game.on_player(a, a);
+        sink = hits;
+    });
+}
+
+// Something like what a 16 player game sends of each message.
+template <typename T> T sample() { return T{}; }
+
+template <> JoinResponse sample() { return JoinResponse(7, true); }
+
+template <> TickUpdate sample() {
+    TickUpdate m;
+    m.tick = 1234;
+    m.slot_count = 16;
+    for (u32 slot = 0; slot < 16; ++slot)
+        m.changes.moves.push_back({slot, SnakeGame::Direction::Left});
+    m.changes.grown = {3};
+    m.changes.food_added = {{4, 5}};
+    m.changes.food_removed = {{7, 8}};
+    return m;
+}
+
+template <> WorldSnapshot sample() {
+    SnakeGame::WorldState world;
+    world.tick = 60;
+    for (u32 id = 1; id <= 16; ++id) {
+        auto &s = world.players.emplace_back();
+        s.id = id;
+        s.dir = SnakeGame::Direction::Up;
+        for (int i = 0; i < 12; ++i)
+            s.body.push_back({static_cast<int>(id), 5 + i});
+    }
+    world.food = {{1, 1}, {2, 9}, {20, 3}};
+    return make_snapshot(nullptr, world);
+}
+
+using Body = decltype(Message::body);
+
+template <size_t... I> void round_trips(std::index_sequence<I...>) {
+    (
+        [] {
+            using T = std::variant_alternative_t<I, Body>;
+            Message msg;
+            msg.body.emplace<I>(sample<T>());
+            Network::Buffer b;
+            Message out;
+            bench(std::string("message/") + message_name(I), [&](u64 n) {
+                u64 ok = 0;
+                for (u64 i = 0; i < n; ++i) {
+                    b.reset();
+                    encode(b, msg);
+                    ok += decode(b, out);
+                }
+                sink = ok;
+            });
+        }(),
+        ...);
+}
+
+void messages() {
+    round_trips(std::make_index_sequence<std::variant_size_v<Body>>());
+}
+
+template <typename Queue> void queue(const char *name) {
+    auto q = std::make_unique<Queue>();
+    // a push and a pop
+    bench(std::string("queue/") + name, [&](u64 n) {
+        u64 sum = 0;
+        u64 v = 0;
+        for (u64 i = 0; i < n; ++i) {
+            q->try_push(i);
+            if (q->try_pop(v))
+                sum += v;
+        }
+        sink = sum;
+    });
+    bench(std::string("queue/") + name + "_batch_32", [&](u64 n) {
+        u64 in[32];
+        u64 out[32];
+        std::iota(in, in + 32, 0);
+        u64 sum = 0;
+        for (u64 i = 0; i < n; i += 32) {
+            q->try_push(in, 32);
+            sum += q->try_pop(out, 32);
+        }
+        sink = sum;
+    });
+}
+
+void queues() {
+    queue<SpscRing<u64, 1024>>("spsc");
+    queue<MpmcRing<u64, 1024>>("mpmc");
+
+    CircularBuffer<u64, 1024, QueueMode::Mpmc, FullPolicy::Overwrite> ring;
+    bench("queue/circular_buffer_overwrite", [&](u64 n) {
+        u64 sum = 0;
+        for (u64 i = 0; i < n; ++i) {
+            ring.push(i);
+            if (auto v = ring.pop())
+                sum += *v;
+        }
+        sink = sum;
+    });
+}
+
+// The game's add_message from ui_state.cpp: the formatting, the write, to
+// the null device, and the log it keeps for drawing.
+void messages_log() {
+#ifdef _WIN32
+    std::freopen("NUL", "w", stdout);
+#else
+    std::freopen("/dev/null", "w", stdout);
+#endif
+    bench("add_message", [](u64 n) {
+        for (u64 i = 0; i < n; ++i)
+            add_message("player %u joined", static_cast<u32>(i));
+    });
+}
+
+// What ui::push_button does before drawing: its label, a literal at every
+// call site, becomes a std::string and the button is looked up by it.
+void ui_lookup() {
+    const char *labels[] = {"MainMenu##Single Player", "MainMenu##Host",
+                            "MainMenu##Connect",       "MainMenu##Quit",
+                            "HostLobby##Start",        "HostLobby##Quit",
+                            "GuestLobby##Quit"};
+    bool made;
+    for (auto label : labels)
+        ui::push_button_state(label, made);
+
+    bench("ui/push_button_lookup", [&](u64 n) {
+        u64 found = 0;
+        for (u64 i = 0; i < n; ++i) {
+            auto &button = ui::push_button_state(
+                labels[i % std::size(labels)], made);
+            found += !made && !button.hover;
+        }
+        sink = found;
+    });
+}
+
+void write_json(const char *path) {
+    std::ofstream out(path);
+    out << "{\n  \"unit\": \"ns\",\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto &r = results[i];
+        out << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name
+            << "\", \"median\": " << r.median << ", \"mean\": " << r.mean
+            << ", \"stddev\": " << r.stddev << ", \"min\": " << r.min
+            << ", \"max\": " << r.max << ", \"samples\": " << SAMPLES
+            << ", \"iterations\": " << r.iterations << "}";
+    }
+    out << "\n  ]\n}\n";
+    fprintf(stderr, "%zu results written to %s\n", results.size(), path);
+}
+
+// Reads back the medians of a file write_json wrote, one benchmark a line.
+bool read_medians(const char *path, std::map<std::string, double> &medians) {
+    std::ifstream in(path);
+    if (!in)
+        return false;
+    const std::string name_key = "\"name\": \"";
+    const std::string median_key = "\"median\": ";
+    std::string line;
+    while (std::getline(in, line)) {
+        const auto name = line.find(name_key);
+        const auto median = line.find(median_key);
+        if (name == std::string::npos || median == std::string::npos)
+            continue;
+        const auto start = name + name_key.size();
+        medians[line.substr(start, line.find('"', start) - start)] =
+            std::atof(line.c_str() + median + median_key.size());
+    }
+    return true;
+}
+
+// Returns the number of regressions.
+int compare(const char *baseline, double threshold) {
+    std::map<std::string, double> base;
+    if (!read_medians(baseline, base)) {
+        fprintf(stderr, "cannot read baseline %s\n", baseline);
+        return 1;
+    }
+
+    int regressions = 0;
+    fprintf(stderr, "\nagainst %s, threshold %.1f%%\n", baseline, threshold);
+    for (auto &r : results) {
+        auto it = base.find(r.name);
+        if (it == base.end()) {
+            fprintf(stderr, "%-36s %10.2f ns  new\n", r.name.c_str(),
+                    r.median);
+            continue;
+        }
+        const double change =
+            it->second > 0 ? 100.0 * (r.median - it->second) / it->second
+                           : 0.0;
+        const bool regressed = change > threshold;
+        regressions += regressed;
+        fprintf(stderr, "%-36s %10.2f ns  was %10.2f  %+6.1f%%%s\n",
+                r.name.c_str(), r.median, it->second, change,
+                regressed ? "  REGRESSED" : "");
+        base.erase(it);
+    }
+    for (auto &[name, median] : base) {
+        if (selected(name))
+            fprintf(stderr, "%-36s missing, was %.2f ns\n", name.c_str(),
+                    median);
+    }
+    if (regressions)
+        fprintf(stderr, "%d regressed\n", regressions);
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const char *json = "bench-primitives.json";
+    const char *baseline = nullptr;
+    double threshold = 10.0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            json = argv[++i];
+        } else if (arg == "--baseline" && i + 1 < argc) {
+            baseline = argv[++i];
+        } else if (arg == "--threshold" && i + 1 < argc) {
+            threshold = std::atof(argv[++i]);
+        } else {
+            filters.push_back(argv[i]);
+        }
+    }
+
+    array2d();
+    on_player();
+    messages();
+    queues();
+    ui_lookup();
+    // last, it takes stdout away
+    messages_log();
+
+    write_json(json);
+    if (baseline && compare(baseline, threshold))
+        return 1;
+    return 0;
+}
@@ -0,0 +1,230 @@
+#pragma once
+#include "stable_win32.hpp"
+
+// Lock-free bounded queues. Capacities are powers of two so a position
+// maps to its slot with a mask, and positions only ever grow: full and
+// empty are told apart by their difference, not by wrapping indices.
+
+constexpr size_t CACHE_LINE = 64;
+
+// One producer thread and one consumer thread. Each side owns the index it
+// writes and keeps a copy of the other side's, refreshed only when the copy
+// says the queue is full (or empty), so the shared lines are rarely read.
+template <typename T, size_t N> class SpscRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0,
+                  "capacity must be a power of two");
+
+public:
+    bool try_push(const T &t) { return try_push(&t, 1) == 1; }
+    bool try_pop(T &t) { return try_pop(&t, 1) == 1; }
+
+    // Push as many of items as fit, returns how many.
+    size_t try_push(const T *items, size_t count) {
+        auto &p = producer;
+        const size_t tail = p.index.load(std::memory_order_relaxed);
+        if (N - (tail - p.cached) < count) {
+            p.cached = consumer.index.load(std::memory_order_acquire);
+        }
+        count = std::min(count, N - (tail - p.cached));
+        for (size_t i = 0; i < count; ++i) {
+            data[(tail + i) & MASK] = items[i];
+        }
+        if (count > 0)
+            p.index.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Pop up to max items into out, returns how many.
+    size_t try_pop(T *out, size_t max) {
+        auto &c = consumer;
+        const size_t head = c.index.load(std::memory_order_relaxed);
+        if (c.cached - head < max) {
+            c.cached = producer.index.load(std::memory_order_acquire);
+        }
+        const size_t count = std::min(max, c.cached - head);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::move(data[(head + i) & MASK]);
+        }
+        if (count > 0)
+            c.index.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    // exact only while neither side is running
+    size_t size() const {
+        const size_t head = consumer.index.load(std::memory_order_acquire);
+        const size_t tail = producer.index.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+private:
+    static constexpr size_t MASK = N - 1;
+
+    struct alignas(CACHE_LINE) Side {
+        std::atomic<size_t> index = 0;
+        size_t cached = 0;
+    };
+
+    Side producer; // index is the tail, cached the last head seen
+    Side consumer; // index is the head, cached the last tail seen
+    alignas(CACHE_LINE) std::array<T, N> data;
+};
+
+// Any number of producers and consumers (Vyukov's bounded queue). Every
+// slot carries a sequence number telling whose turn it is: position p may
+// be written when it equals p, and read when it equals p + 1. Claiming a
+// position is one compare and swap on the shared index.
+template <typename T, size_t N> class MpmcRing {
+    static_assert(N > 0 && (N & (N - 1)) == 0,
+                  "capacity must be a power of two");
+
+public:
+    MpmcRing() {
+        for (size_t i = 0; i < N; ++i) {
+            slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool try_push(const T &t) {
+        size_t pos = enqueue.load(std::memory_order_relaxed);
+        for (;;) {
+            auto &slot = slots[pos & MASK];
+            const size_t seq = slot.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueue.compare_exchange_weak(pos, pos + 1,
+                                                  std::memory_order_relaxed)) {
+                    slot.value = t;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(T &t) {
+        size_t pos = dequeue.load(std::memory_order_relaxed);
+        for (;;) {
+            auto &slot = slots[pos & MASK];
+            const size_t seq = slot.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (dequeue.compare_exchange_weak(pos, pos + 1,
+                                                  std::memory_order_relaxed)) {
+                    t = std::move(slot.value);
+                    slot.seq.store(pos + N, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Items of a batch are claimed one by one, other threads' items may
+    // end up between them.
+    size_t try_push(const T *items, size_t count) {
+        size_t i = 0;
+        while (i < count && try_push(items[i]))
+            ++i;
+        return i;
+    }
+
+    size_t try_pop(T *out, size_t max) {
+        size_t i = 0;
+        while (i < max && try_pop(out[i]))
+            ++i;
+        return i;
+    }
+
+    // a snapshot, possibly stale by the time it returns
+    size_t size() const {
+        const size_t head = dequeue.load(std::memory_order_acquire);
+        const size_t tail = enqueue.load(std::memory_order_acquire);
+        return tail > head ? std::min(tail - head, N) : 0;
+    }
+
+private:
+    static constexpr size_t MASK = N - 1;
+
+    struct Slot {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueue = 0;
+    alignas(CACHE_LINE) std::atomic<size_t> dequeue = 0;
+    alignas(CACHE_LINE) std::array<Slot, N> slots;
+};
+
+enum class QueueMode { Spsc, Mpmc };
+
+// What push does when the queue is full: give up and return false, make
+// room by popping the oldest item, or wait for a consumer.
+enum class FullPolicy { Drop, Overwrite, Block };
+
+template <typename T, size_t N, QueueMode mode = QueueMode::Spsc,
+          FullPolicy policy = FullPolicy::Drop>
+class CircularBuffer {
+    static_assert(policy != FullPolicy::Overwrite || mode == QueueMode::Mpmc,
+                  "overwriting pops on the producer side, which takes Mpmc");
+
+public:
+    static constexpr size_t capacity = N;
+
+    // false when t was dropped
+    bool push(const T &t) { return push(&t, 1) == 1; }
+
+    // Returns how many of items went in, all of them unless dropped.
+    size_t push(const T *items, size_t count) {
+        size_t pushed = ring.try_push(items, count);
+        if constexpr (policy == FullPolicy::Drop) {
+            return pushed;
+        }
+
+        for (u32 spins = 0; pushed < count;) {
+            if constexpr (policy == FullPolicy::Overwrite) {
+                T oldest;
+                if (ring.try_pop(oldest))
+                    overwritten.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                backoff(spins);
+            }
+            pushed += ring.try_push(items + pushed, count - pushed);
+        }
+        return pushed;
+    }
+
+    std::optional<T> pop() {
+        T t;
+        if (ring.try_pop(t))
+            return t;
+        return {};
+    }
+
+    // Pops up to max items into out, returns how many.
+    size_t pop(T *out, size_t max) { return ring.try_pop(out, max); }
+
+    size_t size() const { return ring.size(); }
+    bool empty() const { return size() == 0; }
+
+    // items popped to make room, with FullPolicy::Overwrite
+    std::atomic<u64> overwritten = 0;
+
+private:
+    static void backoff(u32 &spins) {
+        if (++spins < 64)
+            return;
+        std::this_thread::yield();
+    }
+
+    std::conditional_t<mode == QueueMode::Spsc, SpscRing<T, N>,
+                       MpmcRing<T, N>>
+        ring;
+};
@@ -0,0 +1,139 @@
+#include "compress.h"
+#include "stable_win32.hpp"
+
+namespace Compression {
+
+namespace {
+
+constexpr u32 HASH_BITS = 12;
+constexpr size_t MAX_OFFSET = 1 << 16;
+
+u32 hash3(const u8 *p) {
+    const u32 v = p[0] | p[1] << 8 | p[2] << 16;
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void write_varint(std::vector<u8> &out, size_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<u8>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<u8>(v));
+}
+
+bool read_varint(const u8 *&p, const u8 *end, size_t &v) {
+    v = 0;
+    for (u32 shift = 0; shift < 35 && p < end; shift += 7) {
+        const u8 b = *p++;
+        v |= static_cast<size_t>(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// match_length 0 for the last sequence
+void write_sequence(std::vector<u8> &out, const u8 *literals,
+                    size_t literal_count, size_t offset, size_t match_length) {
+    const size_t literal_code = std::min<size_t>(literal_count, 15);
+    const size_t match_code =
+        match_length ? std::min<size_t>(match_length - MIN_MATCH, 15) : 0;
+    out.push_back(static_cast<u8>(literal_code << 4 | match_code));
+    if (literal_code == 15)
+        write_varint(out, literal_count - 15);
+    out.insert(out.end(), literals, literals + literal_count);
+
+    if (match_length) {
+        write_varint(out, offset);
+        if (match_code == 15)
+            write_varint(out, match_length - MIN_MATCH - 15);
+    }
+}
+
+} // namespace
+
+// Greedy: one candidate per hash bucket, taken whenever it matches.
+void compress(const u8 *data, size_t size, std::vector<u8> &out) {
+    write_varint(out, size);
+
+    // positions plus one, 0 is empty
+    std::array<u32, 1 << HASH_BITS> table{};
+    size_t anchor = 0;
+    size_t i = 0;
+    while (i + MIN_MATCH <= size) {
+        const u32 h = hash3(data + i);
+        const size_t candidate = table[h];
+        table[h] = i + 1;
+
+        if (candidate == 0 || i - (candidate - 1) > MAX_OFFSET ||
+            memcmp(data + candidate - 1, data + i, MIN_MATCH) != 0) {
+            ++i;
+            continue;
+        }
+
+        const size_t from = candidate - 1;
+        size_t length = MIN_MATCH;
+        while (i + length < size && data[from + length] == data[i + length])
+            ++length;
+
+        write_sequence(out, data + anchor, i - anchor, i - from, length);
+        for (size_t k = i + 1; k < i + length && k + MIN_MATCH <= size; ++k) {
+            table[hash3(data + k)] = k + 1;
+        }
+        i += length;
+        anchor = i;
+    }
+    write_sequence(out, data + anchor, size - anchor, 0, 0);
+}
+
+bool decompress(const u8 *data, size_t size, std::vector<u8> &out,
+                size_t max_size) {
+    const u8 *p = data;
+    const u8 *end = data + size;
+    size_t raw_size;
+    if (!read_varint(p, end, raw_size) || raw_size > max_size)
+        return false;
+
+    const size_t start = out.size();
+    out.reserve(start + raw_size);
+    while (p < end) {
+        const u8 token = *p++;
+        size_t extra;
+
+        size_t literals = token >> 4;
+        if (literals == 15) {
+            if (!read_varint(p, end, extra))
+                return false;
+            literals += extra;
+        }
+        if (literals > static_cast<size_t>(end - p) ||
+            out.size() - start + literals > raw_size)
+            return false;
+        out.insert(out.end(), p, p + literals);
+        p += literals;
+        if (p == end)
+            break;
+
+        size_t offset;
+        if (!read_varint(p, end, offset))
+            return false;
+        size_t length = (token & 15) + MIN_MATCH;
+        if ((token & 15) == 15) {
+            if (!read_varint(p, end, extra))
+                return false;
+            length += extra;
+        }
+        const size_t produced = out.size() - start;
+        if (offset == 0 || offset > produced || produced + length > raw_size)
+            return false;
+
+        // byte by byte, a match may overlap what it copies
+        const size_t from = out.size() - offset;
+        for (size_t k = 0; k < length; ++k) {
+            out.push_back(out[from + k]);
+        }
+    }
+    return out.size() - start == raw_size;
+}
+
+} // namespace Compression
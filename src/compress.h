@@ -0,0 +1,26 @@
+#pragma once
+#include "stable_win32.hpp"
+
+// A small LZ77 coder for network frames. What repeats in our frames is
+// short and near: varint ids and coordinates, colours, runs of the same
+// direction. So matches start at 3 bytes and offsets are varints.
+//
+// A block is the raw size as a varint followed by sequences: a token with
+// the literal count in the high nibble and the match length minus
+// MIN_MATCH in the low one, a varint with the rest of the literal count if
+// its nibble is 15, the literals, then the match offset as a varint and the
+// rest of the match length if its nibble is 15. The last sequence stops
+// after its literals.
+namespace Compression {
+
+constexpr size_t MIN_MATCH = 3;
+
+// Appends the compressed form of data to out.
+void compress(const u8 *data, size_t size, std::vector<u8> &out);
+
+// Appends the decompressed form of data to out, false when data is
+// malformed or would decompress to more than max_size bytes.
+bool decompress(const u8 *data, size_t size, std::vector<u8> &out,
+                size_t max_size);
+
+} // namespace Compression
@@ -0,0 +1,145 @@
+#pragma once
+#include "stable_win32.hpp"
+
+#include <experimental/coroutine>
+#include <utility>
+namespace net = std::experimental::net;
+
+// Awaitable wrappers over the networking TS, so a connection can be written
+// as one straight-line coroutine instead of a chain of handlers. A
+// coroutine suspends on co_await and is resumed by the completion handler,
+// on whichever io thread runs it.
+namespace coro {
+
+using std::experimental::coroutine_handle;
+using std::experimental::suspend_never;
+
+// The return type of a coroutine nobody waits for: it starts right away,
+// runs until its first co_await and frees itself when it returns.
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() { return {}; }
+        suspend_never initial_suspend() noexcept { return {}; }
+        suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        // errors come back as error codes, an exception is a bug
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// The completion handler. Its copies share one pending resume, and when the
+// last of them is destroyed without being called, because the io_context
+// went away first, it takes the coroutine with it.
+template <typename Result> class Resume {
+public:
+    Resume(coroutine_handle<> h, std::optional<Result> &result)
+        : pending(std::make_shared<Pending>(h, &result)) {}
+
+    template <typename... Args> void operator()(Args &&...args) {
+        pending->result->emplace(std::forward<Args>(args)...);
+        std::exchange(pending->h, nullptr).resume();
+    }
+
+private:
+    struct Pending {
+        coroutine_handle<> h;
+        std::optional<Result> *result;
+
+        Pending(coroutine_handle<> h, std::optional<Result> *result)
+            : h(h), result(result) {}
+        ~Pending() {
+            if (h)
+                h.destroy();
+        }
+    };
+    std::shared_ptr<Pending> pending;
+};
+
+using Lock = std::unique_lock<std::mutex>;
+
+// Suspends until the operation started by initiate completes and returns
+// what its handler got. With a lock the operation is started under it, and
+// the lock is let go while suspended and held again on resume.
+template <typename Result, typename Initiate> class Operation {
+public:
+    Operation(Initiate initiate, Lock *lock)
+        : initiate(std::move(initiate)), lock(lock),
+          mutex(lock ? lock->mutex() : nullptr) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    // The handler may resume the coroutine on another thread before
+    // initiate returns, the frame is not touched after that.
+    void await_suspend(coroutine_handle<> h) {
+        std::mutex *held = lock ? lock->release() : nullptr;
+        initiate(Resume<Result>(h, result));
+        if (held)
+            held->unlock();
+    }
+
+    Result await_resume() {
+        if (lock)
+            *lock = Lock(*mutex);
+        return std::move(*result);
+    }
+
+private:
+    Initiate initiate;
+    Lock *lock;
+    std::mutex *mutex;
+    std::optional<Result> result;
+};
+
+template <typename Result, typename Initiate>
+Operation<Result, Initiate> operation(Initiate initiate, Lock *lock) {
+    return {std::move(initiate), lock};
+}
+
+inline auto async_accept(net::ip::tcp::acceptor &acceptor,
+                         Lock *lock = nullptr) {
+    using Result = std::pair<std::error_code, net::ip::tcp::socket>;
+    return operation<Result>(
+        [&acceptor](auto resume) { acceptor.async_accept(std::move(resume)); },
+        lock);
+}
+
+template <typename Endpoints>
+auto async_connect(net::ip::tcp::socket &socket, Endpoints endpoints,
+                   Lock *lock = nullptr) {
+    using Result = std::pair<std::error_code, net::ip::tcp::endpoint>;
+    return operation<Result>(
+        [&socket, endpoints](auto resume) {
+            net::async_connect(socket, endpoints, std::move(resume));
+        },
+        lock);
+}
+
+// Reads until buffers are full.
+template <typename Buffers>
+auto async_read(net::ip::tcp::socket &socket, const Buffers &buffers,
+                Lock *lock = nullptr) {
+    using Result = std::pair<std::error_code, size_t>;
+    return operation<Result>(
+        [&socket, buffers](auto resume) {
+            net::async_read(socket, buffers, std::move(resume));
+        },
+        lock);
+}
+
+template <typename Buffers>
+auto async_write(net::ip::tcp::socket &socket, const Buffers &buffers,
+                 Lock *lock = nullptr) {
+    using Result = std::pair<std::error_code, size_t>;
+    return operation<Result>(
+        [&socket, buffers](auto resume) {
+            net::async_write(socket, buffers, std::move(resume));
+        },
+        lock);
+}
+
+inline auto async_wait(net::steady_timer &timer, Lock *lock = nullptr) {
+    return operation<std::error_code>(
+        [&timer](auto resume) { timer.async_wait(std::move(resume)); }, lock);
+}
+
+} // namespace coro
@@ -0,0 +1,129 @@
+#include "stable_win32.hpp"
+
+#include <cstring>
+#include <fstream>
+
+// Writes font_data.cpp, the fonts of resources/fonts as byte arrays. Run
+// from the repository root after changing a font:
+//
+//     snek-embed-fonts src/font_data.cpp
+//
+// With --check it writes nothing and exits with 1 when the file is not
+// what it would write, so a font changed without regenerating is caught.
+
+namespace {
+
+struct Font {
+    const char *path;
+    // the name fonts.h declares it under
+    const char *asset;
+};
+
+constexpr Font FONTS[] = {
+    {"resources/fonts/Inconsolata-Regular.ttf", "inconsolata"},
+    {"resources/fonts/act.ttf", "act"},
+};
+
+constexpr size_t BYTES_PER_LINE = 12;
+constexpr size_t COLUMNS = 80;
+
+// as xxd -i names it
+std::string array_name(const char *path) {
+    std::string name = path;
+    for (auto &c : name) {
+        if (!std::isalnum(static_cast<unsigned char>(c)))
+            c = '_';
+    }
+    return name;
+}
+
+bool read_file(const char *path, std::vector<u8> &data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    data.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool generate(std::string &out) {
+    out = "// Generated from resources/fonts by embed_fonts.cpp, do not edit. "
+          "After\n"
+          "// changing a font run\n"
+          "//     snek-embed-fonts src/font_data.cpp\n"
+          "// from the repository root, with --check to see whether this "
+          "file is\n"
+          "// current.\n"
+          "#include \"fonts.h\"\n"
+          "#include \"stable_win32.hpp\"\n"
+          "\n"
+          "namespace {\n";
+
+    char hex[8];
+    for (auto &font : FONTS) {
+        std::vector<u8> data;
+        if (!read_file(font.path, data)) {
+            fprintf(stderr, "cannot read %s\n", font.path);
+            return false;
+        }
+        out += "\nconstexpr u8 " + array_name(font.path) + "[] = {\n";
+        for (size_t i = 0; i < data.size(); i += BYTES_PER_LINE) {
+            out += "   ";
+            const size_t end = std::min(data.size(), i + BYTES_PER_LINE);
+            for (size_t k = i; k < end; ++k) {
+                snprintf(hex, sizeof(hex), " 0x%02x,", data[k]);
+                out += hex;
+            }
+            out += "\n";
+        }
+        out += "};\n";
+    }
+
+    out += "\n} // namespace\n\nnamespace Fonts {\n\n";
+    for (auto &font : FONTS) {
+        const auto name = array_name(font.path);
+        const std::string head =
+            std::string("const Asset ") + font.asset + "{";
+        std::string line = head + name + ", sizeof(" + name + ")};\n";
+        if (line.size() - 1 > COLUMNS) {
+            line = head + name + ",\n" + std::string(head.size(), ' ') +
+                   "sizeof(" + name + ")};\n";
+        }
+        out += line;
+    }
+    out += "\n} // namespace Fonts\n";
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    const bool check = argc == 3 && std::strcmp(argv[1], "--check") == 0;
+    if (argc != 2 && !check) {
+        fprintf(stderr, "usage: %s [--check] src/font_data.cpp\n", argv[0]);
+        return 1;
+    }
+    const char *path = argv[argc - 1];
+
+    std::string data;
+    if (!generate(data))
+        return 1;
+
+    if (check) {
+        std::ifstream file(path, std::ios::binary);
+        const std::string current(std::istreambuf_iterator<char>(file), {});
+        if (current != data) {
+            fprintf(stderr, "%s is out of date, run %s %s\n", path, argv[0],
+                    path);
+            return 1;
+        }
+        return 0;
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out.write(data.data(), data.size())) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    return 0;
+}
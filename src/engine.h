@@ -1,26 +1,39 @@
 #pragma once
+#include "arena.h"
+#include "slot_map.h"
 #include "stable_win32.hpp"
 extern sf::RenderWindow *window;
 
 struct Input {
+    using Clock = std::chrono::steady_clock;
 
+    // time is when pollEvent handed the event over, not when the key went
+    // down: what it waited in the OS queue before that is not in it
     struct KeyPressed {
         sf::Keyboard::Key key;
+        Clock::time_point time;
     };
 
     struct KeyReleased {
         sf::Keyboard::Key key;
+        Clock::time_point time;
     };
 
     struct LostFocus {};
 
     using Event = std::variant<KeyPressed, KeyReleased, LostFocus>;
 
-    std::vector<Event> events;
+    // from the frame arena in the game loop, the heap without one
+    using Events = std::vector<Event, ArenaAllocator<Event>>;
+    Events events;
+
+    Input() = default;
+    explicit Input(Arena &arena) : events(arena) {}
 
     template <typename T> void push(const T &value) { events.push_back(value); }
 
-    void clear() { events.clear(); }
+    // Lets go of the storage too, it may be reset right after.
+    void clear() { events = Events(events.get_allocator()); }
 };
 
 template <typename T> class LinearInterpolator {
@@ -61,23 +74,14 @@ private:
     float timeout_ = 0.0f;
 };
 
-struct Entity;
-struct EntityID {
-    using Index = size_t;
-    using UID = size_t;
-
-    Index index;
-    UID uid;
-
-    Entity *operator->();
-    operator bool();
-};
-
 struct Entity {
     EntityID id;
     int hp;
 };
 
+// What EntityID points into, main.cpp.
+extern SlotMap<Entity> entities;
+
 template <typename T> class Array2D {
 public:
     Array2D(int w = 0, int h = 0) : w_(w), h_(h), data(w * h) {}
@@ -123,6 +127,8 @@ struct ToggleButton {
 
 void label(int x, int y, std::string fmt, ...);
 void labelc(int x, int y, const sf::Color &color, std::string fmt, ...);
+// unformatted and of any length, lines split on '\n'
+void text(int x, int y, const std::string &text, u32 size = 30);
 bool push_button(int x, int y, const std::string &label,
                  ui::Align h_align = ui::Align::Left);
 bool toggle_button(int x, int y, const std::string &label, bool *var = nullptr);
@@ -0,0 +1,10360 @@
+// Generated from resources/fonts by embed_fonts.cpp, do not edit. After
+// changing a font run
+//     snek-embed-fonts src/font_data.cpp
+// from the repository root, with --check to see whether this file is
+// current.
+#include "fonts.h"
+#include "stable_win32.hpp"
+
+namespace {
+
+constexpr u8 resources_fonts_Inconsolata_Regular_ttf[] = {
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20,
+    0x44, 0x53, 0x49, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x76, 0xd0,
+    0x00, 0x00, 0x00, 0x08, 0x47, 0x44, 0x45, 0x46, 0x4b, 0x96, 0x4d, 0x54,
+    0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x01, 0x28, 0x47, 0x50, 0x4f, 0x53,
+    0xd3, 0xdf, 0x65, 0x39, 0x00, 0x00, 0x02, 0x54, 0x00, 0x00, 0x22, 0xfa,
+    0x47, 0x53, 0x55, 0x42, 0x79, 0x83, 0x73, 0x62, 0x00, 0x00, 0x25, 0x50,
+    0x00, 0x00, 0x0f, 0xea, 0x4f, 0x53, 0x2f, 0x32, 0x63, 0xfd, 0x95, 0x58,
+    0x00, 0x00, 0x35, 0x3c, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
+    0xc8, 0x8b, 0x58, 0x6a, 0x00, 0x00, 0x35, 0x9c, 0x00, 0x00, 0x0b, 0x20,
+    0x63, 0x76, 0x74, 0x20, 0x35, 0x5f, 0x03, 0x32, 0x00, 0x01, 0x68, 0x7c,
+    0x00, 0x00, 0x00, 0x98, 0x66, 0x70, 0x67, 0x6d, 0x76, 0x64, 0x7f, 0x7a,
+    0x00, 0x01, 0x69, 0x14, 0x00, 0x00, 0x0d, 0x16, 0x67, 0x61, 0x73, 0x70,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x68, 0x74, 0x00, 0x00, 0x00, 0x08,
+    0x67, 0x6c, 0x79, 0x66, 0x5b, 0xde, 0x69, 0x54, 0x00, 0x00, 0x40, 0xbc,
+    0x00, 0x00, 0xf4, 0xb2, 0x68, 0x65, 0x61, 0x64, 0x09, 0x46, 0x2c, 0x4c,
+    0x00, 0x01, 0x35, 0x70, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x03, 0xdf, 0x04, 0x1c, 0x00, 0x01, 0x35, 0xa8, 0x00, 0x00, 0x00, 0x24,
+    0x68, 0x6d, 0x74, 0x78, 0xb5, 0x23, 0x6a, 0xbb, 0x00, 0x01, 0x35, 0xcc,
+    0x00, 0x00, 0x0c, 0x7c, 0x6c, 0x6f, 0x63, 0x61, 0x9e, 0x67, 0xda, 0x75,
+    0x00, 0x01, 0x42, 0x48, 0x00, 0x00, 0x06, 0x40, 0x6d, 0x61, 0x78, 0x70,
+    0x04, 0x65, 0x0e, 0x0a, 0x00, 0x01, 0x48, 0x88, 0x00, 0x00, 0x00, 0x20,
+    0x6e, 0x61, 0x6d, 0x65, 0x22, 0xfc, 0x6a, 0x99, 0x00, 0x01, 0x48, 0xa8,
+    0x00, 0x00, 0x06, 0x6f, 0x70, 0x6f, 0x73, 0x74, 0x44, 0x82, 0x34, 0x17,
+    0x00, 0x01, 0x4f, 0x18, 0x00, 0x00, 0x19, 0x5c, 0x70, 0x72, 0x65, 0x70,
+    0x39, 0x36, 0x4e, 0x6f, 0x00, 0x01, 0x76, 0x2c, 0x00, 0x00, 0x00, 0xa3,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8,
+    0x00, 0x02, 0x00, 0x24, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x1e,
+    0x00, 0x27, 0x00, 0x01, 0x00, 0x29, 0x00, 0x29, 0x00, 0x01, 0x00, 0x2b,
+    0x00, 0x43, 0x00, 0x01, 0x00, 0x45, 0x00, 0x62, 0x00, 0x01, 0x00, 0x64,
+    0x00, 0x64, 0x00, 0x01, 0x00, 0x66, 0x00, 0x66, 0x00, 0x01, 0x00, 0x68,
+    0x00, 0x6c, 0x00, 0x01, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x70,
+    0x00, 0x9c, 0x00, 0x01, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x01, 0x00, 0xa0,
+    0x00, 0xb3, 0x00, 0x01, 0x00, 0xb5, 0x01, 0x03, 0x00, 0x01, 0x01, 0x05,
+    0x01, 0x0f, 0x00, 0x01, 0x01, 0x12, 0x01, 0x2a, 0x00, 0x01, 0x01, 0x2c,
+    0x01, 0x2d, 0x00, 0x01, 0x01, 0x30, 0x01, 0x55, 0x00, 0x01, 0x01, 0x57,
+    0x01, 0x57, 0x00, 0x01, 0x01, 0x59, 0x01, 0x59, 0x00, 0x01, 0x01, 0x5b,
+    0x01, 0x62, 0x00, 0x01, 0x01, 0x64, 0x01, 0x81, 0x00, 0x01, 0x01, 0x83,
+    0x01, 0x87, 0x00, 0x01, 0x01, 0x89, 0x01, 0x89, 0x00, 0x01, 0x01, 0x8c,
+    0x01, 0x91, 0x00, 0x01, 0x01, 0x93, 0x01, 0x95, 0x00, 0x01, 0x01, 0x97,
+    0x01, 0xa0, 0x00, 0x01, 0x01, 0xa2, 0x01, 0xd7, 0x00, 0x01, 0x01, 0xdd,
+    0x01, 0xdd, 0x00, 0x01, 0x02, 0x53, 0x02, 0x55, 0x00, 0x01, 0x02, 0x58,
+    0x02, 0x58, 0x00, 0x01, 0x02, 0x5b, 0x02, 0x5b, 0x00, 0x01, 0x02, 0x61,
+    0x02, 0x61, 0x00, 0x01, 0x02, 0x63, 0x02, 0x64, 0x00, 0x01, 0x02, 0x67,
+    0x02, 0x67, 0x00, 0x01, 0x02, 0xcb, 0x02, 0xf0, 0x00, 0x03, 0x03, 0x12,
+    0x03, 0x1d, 0x00, 0x03, 0x00, 0x02, 0x00, 0x0a, 0x02, 0xcb, 0x02, 0xcf,
+    0x00, 0x02, 0x02, 0xd0, 0x02, 0xd0, 0x00, 0x03, 0x02, 0xd1, 0x02, 0xda,
+    0x00, 0x02, 0x02, 0xdb, 0x02, 0xdb, 0x00, 0x03, 0x02, 0xdc, 0x02, 0xdf,
+    0x00, 0x01, 0x02, 0xe1, 0x02, 0xe2, 0x00, 0x01, 0x02, 0xe5, 0x02, 0xee,
+    0x00, 0x02, 0x02, 0xef, 0x02, 0xef, 0x00, 0x03, 0x02, 0xf0, 0x02, 0xf0,
+    0x00, 0x02, 0x03, 0x12, 0x03, 0x1d, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0xb4, 0x01, 0xf6, 0x00, 0x02, 0x44, 0x46, 0x4c, 0x54,
+    0x00, 0x0e, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x34,
+    0x00, 0x08, 0x41, 0x5a, 0x45, 0x20, 0x00, 0x3e, 0x43, 0x41, 0x54, 0x20,
+    0x00, 0x48, 0x43, 0x52, 0x54, 0x20, 0x00, 0x52, 0x4b, 0x41, 0x5a, 0x20,
+    0x00, 0x5c, 0x4d, 0x4f, 0x4c, 0x20, 0x00, 0x66, 0x52, 0x4f, 0x4d, 0x20,
+    0x00, 0x70, 0x54, 0x41, 0x54, 0x20, 0x00, 0x7a, 0x54, 0x52, 0x4b, 0x20,
+    0x00, 0x84, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0b,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x02, 0x00, 0x0c, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x02, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x02, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02,
+    0x00, 0x05, 0x00, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x06,
+    0x00, 0x10, 0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x07, 0x00, 0x11,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x02, 0x00, 0x08, 0x00, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x02, 0x00, 0x09, 0x00, 0x13, 0x00, 0x14, 0x6d, 0x61,
+    0x72, 0x6b, 0x00, 0x7a, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x82, 0x6d, 0x61,
+    0x72, 0x6b, 0x00, 0x8a, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x92, 0x6d, 0x61,
+    0x72, 0x6b, 0x00, 0x9a, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0xa2, 0x6d, 0x61,
+    0x72, 0x6b, 0x00, 0xaa, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0xb2, 0x6d, 0x61,
+    0x72, 0x6b, 0x00, 0xba, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0xc2, 0x6d, 0x6b,
+    0x6d, 0x6b, 0x00, 0xca, 0x6d, 0x6b, 0x6d, 0x6b, 0x00, 0xd6, 0x6d, 0x6b,
+    0x6d, 0x6b, 0x00, 0xe2, 0x6d, 0x6b, 0x6d, 0x6b, 0x00, 0xee, 0x6d, 0x6b,
+    0x6d, 0x6b, 0x00, 0xfa, 0x6d, 0x6b, 0x6d, 0x6b, 0x01, 0x06, 0x6d, 0x6b,
+    0x6d, 0x6b, 0x01, 0x12, 0x6d, 0x6b, 0x6d, 0x6b, 0x01, 0x1e, 0x6d, 0x6b,
+    0x6d, 0x6b, 0x01, 0x2a, 0x6d, 0x6b, 0x6d, 0x6b, 0x01, 0x36, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x16,
+    0x00, 0x1e, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x30, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x58,
+    0x00, 0x06, 0x01, 0x00, 0x00, 0x01, 0x1b, 0x3c, 0x00, 0x06, 0x02, 0x00,
+    0x00, 0x01, 0x1b, 0xaa, 0x00, 0x06, 0x03, 0x00, 0x00, 0x01, 0x1d, 0xba,
+    0x00, 0x06, 0x02, 0x00, 0x00, 0x01, 0x1d, 0xe4, 0x00, 0x01, 0x1f, 0x56,
+    0x1f, 0x6c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0xd2, 0x00, 0x31, 0x00, 0x01,
+    0x01, 0x2e, 0x00, 0x01, 0x01, 0x34, 0x00, 0x01, 0x01, 0x3a, 0x00, 0x01,
+    0x01, 0x3a, 0x00, 0x01, 0x01, 0x40, 0x00, 0x03, 0x01, 0xac, 0x00, 0x01,
+    0x01, 0x46, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x01, 0x01, 0x52, 0x00, 0x01,
+    0x01, 0x58, 0x00, 0x01, 0x01, 0x5e, 0x00, 0x01, 0x01, 0x46, 0x00, 0x01,
+    0x01, 0x64, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x01, 0x01, 0x52, 0x00, 0x01,
+    0x01, 0x70, 0x00, 0x03, 0x01, 0xb2, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x01, 0x16, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x01, 0x22, 0x00, 0x00,
+    0x01, 0x28, 0x00, 0x00, 0x01, 0x28, 0x00, 0x02, 0x01, 0xa6, 0x00, 0x02,
+    0x01, 0xa6, 0x00, 0x01, 0x01, 0x76, 0x00, 0x01, 0x01, 0x7c, 0x00, 0x01,
+    0x01, 0x82, 0x00, 0x01, 0x01, 0x88, 0x00, 0x01, 0x01, 0x8e, 0x00, 0x01,
+    0x01, 0x94, 0x00, 0x01, 0x01, 0x94, 0x00, 0x01, 0x01, 0x94, 0x00, 0x01,
+    0x01, 0x76, 0x00, 0x01, 0x01, 0x76, 0x00, 0x03, 0x01, 0xb8, 0x00, 0x01,
+    0x01, 0x5e, 0x00, 0x01, 0x01, 0x52, 0x00, 0x01, 0x01, 0x52, 0x00, 0x01,
+    0x01, 0x52, 0x00, 0x01, 0x01, 0x9a, 0x00, 0x01, 0x01, 0x4c, 0x00, 0x01,
+    0x01, 0x4c, 0x00, 0x01, 0x01, 0x2e, 0x00, 0x01, 0x01, 0x52, 0x00, 0x01,
+    0x01, 0x76, 0x00, 0x01, 0x01, 0x94, 0x00, 0x01, 0x01, 0xa0, 0x00, 0x01,
+    0x01, 0x94, 0x00, 0x09, 0x00, 0xf8, 0x00, 0xfe, 0x01, 0x58, 0x01, 0x58,
+    0x01, 0x04, 0x01, 0x0a, 0x01, 0x58, 0x01, 0x58, 0x00, 0xf8, 0x00, 0xfe,
+    0x01, 0x58, 0x01, 0x58, 0x01, 0x10, 0x01, 0x1c, 0x01, 0x16, 0x01, 0x22,
+    0x01, 0x28, 0x01, 0x2e, 0x01, 0x58, 0x01, 0x58, 0x01, 0x34, 0x01, 0x3a,
+    0x01, 0x58, 0x01, 0x58, 0x01, 0x40, 0x01, 0x2e, 0x01, 0x58, 0x01, 0x58,
+    0x01, 0x46, 0x01, 0x4c, 0x01, 0x58, 0x01, 0x58, 0x01, 0x28, 0x01, 0x52,
+    0x01, 0x58, 0x01, 0x58, 0x00, 0x01, 0xfe, 0xfb, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0x08, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0x1b, 0x00, 0x00, 0x00, 0x01, 0xff, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0x07, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0b, 0x01, 0xc9, 0x00, 0x01,
+    0xff, 0x11, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xfb, 0x01, 0xc9, 0x00, 0x01,
+    0xff, 0x06, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0c, 0x01, 0xc9, 0x00, 0x01,
+    0xff, 0x0e, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0d, 0x01, 0xc9, 0x00, 0x01,
+    0xff, 0x10, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf7, 0x01, 0xc9, 0x00, 0x01,
+    0xff, 0x1b, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf8, 0x01, 0xd3, 0x00, 0x01,
+    0xff, 0x07, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x39, 0x02, 0x6f, 0x00, 0x01,
+    0xff, 0x46, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x19, 0x02, 0x6f, 0x00, 0x01,
+    0xff, 0x2e, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x06, 0x02, 0x6f, 0x00, 0x01,
+    0xff, 0x12, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0a, 0x02, 0x6f, 0x00, 0x01,
+    0xff, 0x07, 0x01, 0x3b, 0x00, 0x01, 0xfe, 0xd2, 0x01, 0xc9, 0x00, 0x01,
+    0xff, 0x98, 0x01, 0xc9, 0x00, 0x01, 0xff, 0xa4, 0x02, 0x6f, 0x00, 0x01,
+    0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0e, 0x02, 0x6f, 0x00, 0x01,
+    0x01, 0x1e, 0x00, 0x2b, 0x00, 0x01, 0x01, 0x1e, 0x01, 0xf4, 0x00, 0x01,
+    0x00, 0xe5, 0x00, 0x6b, 0x00, 0x01, 0x01, 0x3d, 0x02, 0x22, 0x00, 0x01,
+    0x00, 0xe5, 0x01, 0xd9, 0x00, 0x01, 0x01, 0x95, 0x01, 0xd9, 0x00, 0x01,
+    0x00, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0xfa, 0x02, 0x6f, 0x00, 0x01,
+    0x00, 0xf9, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf9, 0x02, 0x6f, 0x00, 0x01,
+    0x00, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x67, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x04, 0x02, 0x6f, 0x00, 0x01, 0x00, 0xff, 0x02, 0x6f, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x52, 0x1d, 0x62, 0x00, 0x05,
+    0x00, 0x0c, 0x00, 0xd6, 0x00, 0x32, 0x00, 0x02, 0x12, 0x20, 0x00, 0x02,
+    0x12, 0x26, 0x00, 0x02, 0x12, 0x2c, 0x00, 0x02, 0x12, 0x2c, 0x00, 0x02,
+    0x12, 0x32, 0x00, 0x04, 0x12, 0x9e, 0x00, 0x02, 0x12, 0x38, 0x00, 0x02,
+    0x12, 0x3e, 0x00, 0x02, 0x12, 0x44, 0x00, 0x02, 0x12, 0x4a, 0x00, 0x02,
+    0x12, 0x50, 0x00, 0x02, 0x12, 0x38, 0x00, 0x02, 0x12, 0x56, 0x00, 0x02,
+    0x12, 0x5c, 0x00, 0x02, 0x12, 0x44, 0x00, 0x02, 0x12, 0x62, 0x00, 0x04,
+    0x12, 0xa4, 0x00, 0x00, 0x11, 0xfc, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00,
+    0x12, 0x08, 0x00, 0x00, 0x12, 0x0e, 0x00, 0x01, 0x12, 0x1a, 0x00, 0x00,
+    0x12, 0x14, 0x00, 0x00, 0x12, 0x14, 0x00, 0x03, 0x12, 0x98, 0x00, 0x03,
+    0x12, 0x98, 0x00, 0x02, 0x12, 0x68, 0x00, 0x02, 0x12, 0x6e, 0x00, 0x02,
+    0x12, 0x74, 0x00, 0x02, 0x12, 0x7a, 0x00, 0x02, 0x12, 0x80, 0x00, 0x02,
+    0x12, 0x86, 0x00, 0x02, 0x12, 0x86, 0x00, 0x02, 0x12, 0x86, 0x00, 0x02,
+    0x12, 0x68, 0x00, 0x02, 0x12, 0x68, 0x00, 0x04, 0x12, 0xaa, 0x00, 0x02,
+    0x12, 0x50, 0x00, 0x02, 0x12, 0x44, 0x00, 0x02, 0x12, 0x44, 0x00, 0x02,
+    0x12, 0x44, 0x00, 0x02, 0x12, 0x8c, 0x00, 0x02, 0x12, 0x3e, 0x00, 0x02,
+    0x12, 0x3e, 0x00, 0x02, 0x12, 0x20, 0x00, 0x02, 0x12, 0x44, 0x00, 0x02,
+    0x12, 0x68, 0x00, 0x02, 0x12, 0x86, 0x00, 0x02, 0x12, 0x92, 0x00, 0x02,
+    0x12, 0x86, 0x01, 0xb8, 0x11, 0xe6, 0x11, 0xec, 0x11, 0xf2, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x11, 0xf8, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x11, 0xec, 0x11, 0xfe, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x11, 0xec, 0x12, 0x04, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x11, 0xec,
+    0x11, 0xfe, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x10,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x16, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x1c, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x11, 0xec, 0x12, 0x22, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x11, 0xec, 0x12, 0x28, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x11, 0xec,
+    0x12, 0x22, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x2e,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x34, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x3a, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x11, 0xec, 0x12, 0x40, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x11, 0xec, 0x12, 0x46, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x11, 0xec,
+    0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x4c,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x52, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x58, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x11, 0xec, 0x12, 0x5e, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x11, 0xec, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec,
+    0x12, 0x64, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x6a,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x11, 0xec, 0x12, 0x70, 0x18, 0x10,
+    0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x12, 0x76, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c,
+    0x18, 0x10, 0x12, 0x82, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x18, 0x10,
+    0x12, 0x88, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x18, 0x10, 0x12, 0x8e,
+    0x18, 0x10, 0x18, 0x10, 0x12, 0x94, 0x18, 0x10, 0x12, 0x82, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x94, 0x18, 0x10, 0x12, 0x88, 0x18, 0x10, 0x18, 0x10,
+    0x12, 0x7c, 0x18, 0x10, 0x12, 0x9a, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c,
+    0x18, 0x10, 0x12, 0xa0, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x12, 0xac, 0x12, 0xa6, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x12, 0xb2,
+    0x12, 0xa6, 0x18, 0x10, 0x12, 0x0a, 0x18, 0x10, 0x12, 0xac, 0x12, 0xa6,
+    0x18, 0x10, 0x12, 0xb8, 0x18, 0x10, 0x12, 0xac, 0x12, 0xa6, 0x18, 0x10,
+    0x11, 0xe6, 0x12, 0xbe, 0x12, 0x82, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x12, 0xbe, 0x12, 0x88, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe,
+    0x12, 0xc4, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0x8e,
+    0x18, 0x10, 0x18, 0x10, 0x12, 0xca, 0x12, 0xbe, 0x12, 0xc4, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0x9a, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x12, 0xbe, 0x12, 0xd0, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a,
+    0x12, 0xbe, 0x12, 0x9a, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe,
+    0x12, 0xd6, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0x8e,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0xdc, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0x64, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x12, 0xbe, 0x12, 0xe2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x12, 0xbe, 0x12, 0xa0, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x12, 0xbe,
+    0x12, 0x82, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0xe8,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0xee, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0xf4, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x12, 0xbe, 0x12, 0xfa, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x12, 0xbe, 0x13, 0x00, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe,
+    0x13, 0x06, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x12, 0x82,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x12, 0xbe, 0x13, 0x0c, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10,
+    0x13, 0x12, 0x18, 0x10, 0x13, 0x18, 0x18, 0x10, 0x18, 0x10, 0x13, 0x12,
+    0x18, 0x10, 0x13, 0x1e, 0x18, 0x10, 0x18, 0x10, 0x13, 0x12, 0x18, 0x10,
+    0x13, 0x24, 0x18, 0x10, 0x18, 0x10, 0x13, 0x12, 0x18, 0x10, 0x13, 0x2a,
+    0x18, 0x10, 0x18, 0x10, 0x13, 0x30, 0x18, 0x10, 0x13, 0x18, 0x18, 0x10,
+    0x18, 0x10, 0x13, 0x12, 0x18, 0x10, 0x13, 0x36, 0x18, 0x10, 0x18, 0x10,
+    0x13, 0x12, 0x18, 0x10, 0x13, 0x3c, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x18, 0x10, 0x11, 0xf2, 0x12, 0xa6, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x11, 0xf2, 0x12, 0xa6, 0x18, 0x10, 0x13, 0x42, 0x18, 0x10, 0x11, 0xf2,
+    0x12, 0xa6, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x12, 0x22, 0x12, 0xa6,
+    0x18, 0x10, 0x12, 0x0a, 0x18, 0x10, 0x11, 0xf2, 0x12, 0xa6, 0x18, 0x10,
+    0x11, 0xe6, 0x13, 0x48, 0x13, 0x4e, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x13, 0x48, 0x13, 0x54, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0x48,
+    0x13, 0x5a, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0x48, 0x13, 0x60,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0x48, 0x13, 0x66, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x13, 0x48, 0x13, 0x6c, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x13, 0x48, 0x13, 0x72, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x13, 0x48, 0x13, 0x78, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x13, 0x48,
+    0x13, 0x4e, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0x48, 0x12, 0xb2,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0x48, 0x13, 0x7e, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x13, 0x48, 0x13, 0x84, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x13, 0x48, 0x13, 0x8a, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x13, 0x48, 0x13, 0x4e, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0x48,
+    0x13, 0x90, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x13, 0x96,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x13, 0x9c, 0x18, 0x10,
+    0x18, 0x10, 0x13, 0xa2, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x13, 0xae, 0x13, 0xa8, 0x13, 0xb4, 0x11, 0xe6,
+    0x18, 0x10, 0x13, 0xba, 0x13, 0xa8, 0x13, 0xb4, 0x11, 0xe6, 0x18, 0x10,
+    0x13, 0xae, 0x13, 0xa8, 0x13, 0xb4, 0x13, 0xc0, 0x18, 0x10, 0x13, 0xae,
+    0x13, 0xa8, 0x13, 0xb4, 0x11, 0xe6, 0x18, 0x10, 0x13, 0xae, 0x13, 0xa8,
+    0x13, 0xb4, 0x12, 0x0a, 0x18, 0x10, 0x13, 0xae, 0x13, 0xa8, 0x13, 0xb4,
+    0x12, 0xb8, 0x18, 0x10, 0x13, 0xae, 0x13, 0xa8, 0x13, 0xb4, 0x11, 0xe6,
+    0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x18, 0x10,
+    0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x11, 0xf8, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x12, 0x34, 0x18, 0x10, 0x18, 0x10,
+    0x13, 0xc0, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x18, 0x10, 0x13, 0xc6, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x18, 0x10,
+    0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2,
+    0x18, 0x10, 0x18, 0x10, 0x12, 0xb8, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x12, 0x70, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x13, 0xcc, 0x11, 0xf2, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6,
+    0x13, 0xcc, 0x11, 0xf8, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc,
+    0x11, 0xfe, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x22,
+    0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x28, 0x12, 0xa6,
+    0x13, 0xd2, 0x12, 0x0a, 0x13, 0xcc, 0x12, 0x22, 0x12, 0xa6, 0x13, 0xd2,
+    0x11, 0xe6, 0x13, 0xcc, 0x12, 0x2e, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6,
+    0x13, 0xcc, 0x12, 0x34, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc,
+    0x12, 0x3a, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x40,
+    0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x46, 0x12, 0xa6,
+    0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x13, 0xd8, 0x12, 0xa6, 0x13, 0xd2,
+    0x11, 0xe6, 0x13, 0xcc, 0x13, 0xde, 0x12, 0xa6, 0x13, 0xd2, 0x12, 0x0a,
+    0x13, 0xcc, 0x11, 0xf2, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc,
+    0x12, 0x4c, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x52,
+    0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x11, 0xf2, 0x12, 0xa6,
+    0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x11, 0xf8, 0x12, 0xa6, 0x13, 0xd2,
+    0x12, 0x0a, 0x13, 0xcc, 0x11, 0xf2, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6,
+    0x13, 0xcc, 0x12, 0x4c, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc,
+    0x12, 0x52, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x70,
+    0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x58, 0x12, 0xa6,
+    0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x12, 0x58, 0x12, 0xa6, 0x13, 0xd2,
+    0x11, 0xe6, 0x13, 0xcc, 0x12, 0x5e, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6,
+    0x13, 0xcc, 0x13, 0xe4, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc,
+    0x13, 0xea, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x11, 0xf2,
+    0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x11, 0xf2, 0x12, 0xa6,
+    0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x11, 0xf8, 0x12, 0xa6, 0x13, 0xd2,
+    0x11, 0xe6, 0x13, 0xcc, 0x12, 0x70, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6,
+    0x13, 0xcc, 0x13, 0xf0, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc,
+    0x13, 0xf6, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x13, 0xcc, 0x13, 0xfc,
+    0x12, 0xa6, 0x13, 0xd2, 0x14, 0x02, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x18, 0x10, 0x11, 0xf8, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x12, 0x34, 0x18, 0x10, 0x18, 0x10, 0x13, 0xc0, 0x18, 0x10, 0x11, 0xf2,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x12, 0x40, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x0a, 0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x12, 0x58, 0x18, 0x10, 0x18, 0x10, 0x12, 0xb8,
+    0x18, 0x10, 0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x14, 0x08, 0x18, 0x10,
+    0x14, 0x0e, 0x18, 0x10, 0x18, 0x10, 0x14, 0x08, 0x18, 0x10, 0x14, 0x14,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0x08, 0x18, 0x10, 0x14, 0x1a, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0x08, 0x18, 0x10, 0x14, 0x20, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0x08, 0x18, 0x10, 0x14, 0x26, 0x18, 0x10, 0x18, 0x10, 0x14, 0x2c,
+    0x18, 0x10, 0x14, 0x0e, 0x18, 0x10, 0x18, 0x10, 0x14, 0x08, 0x18, 0x10,
+    0x14, 0x32, 0x18, 0x10, 0x18, 0x10, 0x14, 0x38, 0x18, 0x10, 0x14, 0x0e,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0x08, 0x18, 0x10, 0x14, 0x3e, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0x44, 0x18, 0x10, 0x14, 0x0e, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0x44, 0x18, 0x10, 0x14, 0x3e, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x13, 0xcc, 0x11, 0xf2, 0x12, 0xa6, 0x13, 0xd2, 0x11, 0xe6, 0x18, 0x10,
+    0x11, 0xf2, 0x14, 0x4a, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x11, 0xf2,
+    0x14, 0x4a, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x12, 0x34, 0x14, 0x4a,
+    0x18, 0x10, 0x12, 0xca, 0x18, 0x10, 0x11, 0xf2, 0x14, 0x4a, 0x18, 0x10,
+    0x13, 0xc0, 0x18, 0x10, 0x11, 0xf2, 0x14, 0x4a, 0x18, 0x10, 0x12, 0x0a,
+    0x18, 0x10, 0x11, 0xf2, 0x14, 0x4a, 0x18, 0x10, 0x12, 0xb8, 0x18, 0x10,
+    0x11, 0xf2, 0x14, 0x4a, 0x18, 0x10, 0x11, 0xe6, 0x14, 0x50, 0x11, 0xf2,
+    0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x11, 0xf8, 0x18, 0x10,
+    0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x11, 0xfe, 0x18, 0x10, 0x14, 0x56,
+    0x11, 0xe6, 0x14, 0x50, 0x12, 0x22, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6,
+    0x14, 0x50, 0x12, 0x40, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x14, 0x50,
+    0x12, 0x46, 0x18, 0x10, 0x14, 0x56, 0x12, 0x0a, 0x14, 0x50, 0x11, 0xf2,
+    0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x12, 0x4c, 0x18, 0x10,
+    0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x12, 0x52, 0x18, 0x10, 0x14, 0x56,
+    0x14, 0x5c, 0x12, 0xbe, 0x14, 0x62, 0x18, 0x10, 0x14, 0x68, 0x14, 0x5c,
+    0x12, 0xbe, 0x14, 0x6e, 0x18, 0x10, 0x14, 0x68, 0x14, 0x74, 0x12, 0xbe,
+    0x14, 0x62, 0x18, 0x10, 0x14, 0x68, 0x14, 0x5c, 0x12, 0xbe, 0x14, 0x7a,
+    0x18, 0x10, 0x14, 0x68, 0x14, 0x5c, 0x12, 0xbe, 0x14, 0x80, 0x18, 0x10,
+    0x14, 0x68, 0x14, 0x5c, 0x12, 0xbe, 0x14, 0x86, 0x18, 0x10, 0x14, 0x68,
+    0x11, 0xe6, 0x14, 0x50, 0x12, 0x58, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6,
+    0x14, 0x50, 0x12, 0x58, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x14, 0x50,
+    0x12, 0x5e, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x13, 0xd8,
+    0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x11, 0xf2, 0x18, 0x10,
+    0x14, 0x56, 0x11, 0xe6, 0x14, 0x50, 0x12, 0x64, 0x18, 0x10, 0x14, 0x56,
+    0x11, 0xe6, 0x14, 0x50, 0x12, 0x70, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6,
+    0x14, 0x50, 0x13, 0xf0, 0x18, 0x10, 0x14, 0x56, 0x11, 0xe6, 0x18, 0x10,
+    0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x14, 0x8c, 0x18, 0x10, 0x14, 0x92,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0x8c, 0x18, 0x10, 0x14, 0x98, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0x8c, 0x18, 0x10, 0x14, 0x9e, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0x8c, 0x18, 0x10, 0x14, 0xa4, 0x18, 0x10, 0x18, 0x10, 0x14, 0x8c,
+    0x18, 0x10, 0x14, 0xaa, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x14, 0xb0, 0x18, 0x10, 0x11, 0xf2,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0xb0, 0x18, 0x10, 0x11, 0xf8, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0xb0, 0x18, 0x10, 0x12, 0x22, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0xb0, 0x18, 0x10, 0x12, 0x46, 0x18, 0x10, 0x18, 0x10, 0x14, 0xb0,
+    0x18, 0x10, 0x13, 0xc6, 0x18, 0x10, 0x18, 0x10, 0x14, 0xb6, 0x18, 0x10,
+    0x11, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x14, 0xb0, 0x18, 0x10, 0x12, 0x4c,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0xb0, 0x18, 0x10, 0x12, 0x52, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0xb0, 0x18, 0x10, 0x12, 0x5e, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0xb0, 0x18, 0x10, 0x12, 0x70, 0x18, 0x10, 0x18, 0x10, 0x14, 0xbc,
+    0x18, 0x10, 0x14, 0x92, 0x18, 0x10, 0x18, 0x10, 0x14, 0xbc, 0x18, 0x10,
+    0x14, 0x98, 0x18, 0x10, 0x18, 0x10, 0x14, 0xbc, 0x18, 0x10, 0x14, 0xc2,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0xbc, 0x18, 0x10, 0x14, 0xc8, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0xce, 0x18, 0x10, 0x14, 0x92, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x12, 0xbe, 0x11, 0xf2, 0x18, 0x10, 0x14, 0x68, 0x11, 0xe6,
+    0x14, 0xd4, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4,
+    0x14, 0xe0, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x14, 0xe6,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x14, 0xec, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x0a, 0x14, 0xd4, 0x14, 0xe6, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x14, 0xd4, 0x14, 0xec, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x14, 0xd4, 0x14, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4,
+    0x14, 0xf8, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x14, 0xfe,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x15, 0x04, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x0a, 0x14, 0xd4, 0x14, 0xfe, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x14, 0xd4, 0x15, 0x0a, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x14, 0xd4, 0x15, 0x10, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4,
+    0x15, 0x16, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x15, 0x1c,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x15, 0x22, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x0a, 0x14, 0xd4, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x14, 0xd4, 0x15, 0x28, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x14, 0xd4, 0x15, 0x2e, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4,
+    0x15, 0x34, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x15, 0x3a,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x14, 0xda, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x14, 0xd4, 0x15, 0x40, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x14, 0xd4, 0x15, 0x46, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x14, 0xd4, 0x15, 0x4c, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x15, 0x52, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x14, 0xda,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x13, 0xcc, 0x15, 0x58, 0x12, 0xa6,
+    0x13, 0xd2, 0x15, 0x5e, 0x18, 0x10, 0x15, 0x64, 0x18, 0x10, 0x18, 0x10,
+    0x15, 0x5e, 0x18, 0x10, 0x15, 0x6a, 0x18, 0x10, 0x18, 0x10, 0x15, 0x5e,
+    0x18, 0x10, 0x15, 0x70, 0x18, 0x10, 0x18, 0x10, 0x15, 0x76, 0x18, 0x10,
+    0x15, 0x64, 0x18, 0x10, 0x18, 0x10, 0x15, 0x76, 0x18, 0x10, 0x15, 0x6a,
+    0x18, 0x10, 0x18, 0x10, 0x15, 0x5e, 0x18, 0x10, 0x15, 0x7c, 0x18, 0x10,
+    0x18, 0x10, 0x15, 0x5e, 0x18, 0x10, 0x15, 0x82, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x14, 0xda, 0x15, 0x88, 0x15, 0x8e, 0x11, 0xe6,
+    0x18, 0x10, 0x14, 0xda, 0x15, 0x88, 0x15, 0x8e, 0x12, 0x0a, 0x18, 0x10,
+    0x14, 0xda, 0x15, 0x88, 0x15, 0x8e, 0x12, 0xb8, 0x18, 0x10, 0x14, 0xda,
+    0x15, 0x88, 0x15, 0x8e, 0x12, 0x7c, 0x15, 0x94, 0x15, 0x9a, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xa0, 0x18, 0x10, 0x18, 0x10,
+    0x12, 0x7c, 0x15, 0x94, 0x15, 0xa6, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c,
+    0x15, 0x94, 0x15, 0xac, 0x18, 0x10, 0x18, 0x10, 0x12, 0x94, 0x15, 0x94,
+    0x15, 0xa6, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xb2,
+    0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xb8, 0x18, 0x10,
+    0x18, 0x10, 0x15, 0xbe, 0x15, 0x94, 0x15, 0xb2, 0x18, 0x10, 0x18, 0x10,
+    0x12, 0x7c, 0x15, 0x94, 0x15, 0xc4, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c,
+    0x15, 0x94, 0x15, 0xca, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94,
+    0x15, 0xd0, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xd6,
+    0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xdc, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xe2, 0x18, 0x10, 0x18, 0x10,
+    0x15, 0xbe, 0x15, 0x94, 0x15, 0x9a, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c,
+    0x15, 0x94, 0x15, 0xe8, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94,
+    0x15, 0xee, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xf4,
+    0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x15, 0xfa, 0x18, 0x10,
+    0x18, 0x10, 0x12, 0x7c, 0x15, 0x94, 0x16, 0x00, 0x18, 0x10, 0x18, 0x10,
+    0x12, 0x7c, 0x15, 0x94, 0x16, 0x06, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c,
+    0x15, 0x94, 0x15, 0x9a, 0x18, 0x10, 0x18, 0x10, 0x12, 0x7c, 0x15, 0x94,
+    0x16, 0x0c, 0x18, 0x10, 0x18, 0x10, 0x16, 0x12, 0x16, 0x18, 0x16, 0x1e,
+    0x18, 0x10, 0x18, 0x10, 0x16, 0x24, 0x18, 0x10, 0x16, 0x2a, 0x18, 0x10,
+    0x18, 0x10, 0x16, 0x24, 0x18, 0x10, 0x16, 0x2a, 0x18, 0x10, 0x18, 0x10,
+    0x16, 0x24, 0x18, 0x10, 0x16, 0x30, 0x18, 0x10, 0x18, 0x10, 0x16, 0x24,
+    0x18, 0x10, 0x16, 0x36, 0x18, 0x10, 0x18, 0x10, 0x16, 0x24, 0x18, 0x10,
+    0x16, 0x3c, 0x18, 0x10, 0x18, 0x10, 0x16, 0x24, 0x18, 0x10, 0x16, 0x42,
+    0x18, 0x10, 0x18, 0x10, 0x16, 0x24, 0x18, 0x10, 0x16, 0x48, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x16, 0x54, 0x16, 0x4e, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x16, 0x54, 0x16, 0x4e, 0x18, 0x10, 0x13, 0x42,
+    0x18, 0x10, 0x16, 0x54, 0x16, 0x4e, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x16, 0x5a, 0x16, 0x4e, 0x18, 0x10, 0x12, 0x0a, 0x18, 0x10, 0x16, 0x54,
+    0x16, 0x4e, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x16, 0x66, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x16, 0x60, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x16, 0x60, 0x14, 0xe6, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60,
+    0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x15, 0x1c,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x14, 0xda, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x16, 0x6c, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x16, 0x60, 0x16, 0x66, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a,
+    0x16, 0x60, 0x16, 0x66, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60,
+    0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x15, 0x2e,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x15, 0x34, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x16, 0x60, 0x15, 0x3a, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x16, 0x60, 0x16, 0x66, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x16, 0x60, 0x16, 0x72, 0x18, 0x10, 0x18, 0x10, 0x16, 0x78, 0x18, 0x10,
+    0x16, 0x7e, 0x18, 0x10, 0x18, 0x10, 0x16, 0x78, 0x18, 0x10, 0x16, 0x84,
+    0x18, 0x10, 0x18, 0x10, 0x16, 0x78, 0x18, 0x10, 0x16, 0x8a, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x16, 0x90, 0x18, 0x10, 0x18, 0x10,
+    0x13, 0xc0, 0x18, 0x10, 0x16, 0x90, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x18, 0x10, 0x16, 0x96, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x16, 0xa2, 0x16, 0x9c, 0x16, 0xa8, 0x11, 0xe6, 0x18, 0x10, 0x16, 0xae,
+    0x16, 0x9c, 0x16, 0xa8, 0x11, 0xe6, 0x18, 0x10, 0x16, 0xa2, 0x16, 0x9c,
+    0x16, 0xa8, 0x13, 0xc0, 0x18, 0x10, 0x16, 0xa2, 0x16, 0x9c, 0x16, 0xa8,
+    0x12, 0x0a, 0x18, 0x10, 0x16, 0xa2, 0x16, 0x9c, 0x16, 0xa8, 0x12, 0xb8,
+    0x18, 0x10, 0x16, 0xa2, 0x16, 0x9c, 0x16, 0xa8, 0x11, 0xe6, 0x18, 0x10,
+    0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x18, 0x10, 0x14, 0xda,
+    0x18, 0x10, 0x18, 0x10, 0x16, 0xb4, 0x18, 0x10, 0x16, 0xba, 0x18, 0x10,
+    0x18, 0x10, 0x16, 0xb4, 0x18, 0x10, 0x16, 0xc0, 0x18, 0x10, 0x18, 0x10,
+    0x16, 0xb4, 0x18, 0x10, 0x16, 0xc6, 0x18, 0x10, 0x18, 0x10, 0x16, 0xcc,
+    0x18, 0x10, 0x16, 0xba, 0x18, 0x10, 0x18, 0x10, 0x16, 0xb4, 0x18, 0x10,
+    0x16, 0xd2, 0x18, 0x10, 0x18, 0x10, 0x16, 0xd8, 0x18, 0x10, 0x16, 0xba,
+    0x18, 0x10, 0x18, 0x10, 0x16, 0xde, 0x18, 0x10, 0x16, 0xba, 0x18, 0x10,
+    0x18, 0x10, 0x16, 0xb4, 0x18, 0x10, 0x16, 0xe4, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x16, 0xea, 0x14, 0xda, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6,
+    0x16, 0xea, 0x14, 0xe0, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea,
+    0x14, 0xe6, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x14, 0xfe,
+    0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x04, 0x16, 0x9c,
+    0x16, 0xf0, 0x12, 0x0a, 0x16, 0xea, 0x14, 0xfe, 0x16, 0x9c, 0x16, 0xf0,
+    0x11, 0xe6, 0x16, 0xea, 0x15, 0x0a, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6,
+    0x16, 0xea, 0x15, 0x10, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea,
+    0x15, 0x16, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x1c,
+    0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x22, 0x16, 0x9c,
+    0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x16, 0xf6, 0x16, 0x9c, 0x16, 0xf0,
+    0x11, 0xe6, 0x16, 0xea, 0x16, 0xfc, 0x16, 0x9c, 0x16, 0xf0, 0x12, 0x0a,
+    0x16, 0xea, 0x14, 0xda, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea,
+    0x15, 0x28, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x2e,
+    0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x14, 0xda, 0x16, 0x9c,
+    0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x14, 0xe0, 0x16, 0x9c, 0x16, 0xf0,
+    0x12, 0x0a, 0x16, 0xea, 0x14, 0xda, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6,
+    0x16, 0xea, 0x15, 0x28, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea,
+    0x15, 0x2e, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x4c,
+    0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x17, 0x02, 0x16, 0x9c,
+    0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x34, 0x16, 0x9c, 0x16, 0xf0,
+    0x11, 0xe6, 0x16, 0xea, 0x15, 0x3a, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6,
+    0x16, 0xea, 0x17, 0x08, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea,
+    0x17, 0x0e, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea, 0x14, 0xda,
+    0x16, 0x9c, 0x16, 0xf0, 0x18, 0x10, 0x18, 0x10, 0x15, 0x52, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x16, 0xea, 0x15, 0x4c, 0x16, 0x9c, 0x16, 0xf0,
+    0x11, 0xe6, 0x16, 0xea, 0x17, 0x14, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6,
+    0x16, 0xea, 0x17, 0x1a, 0x16, 0x9c, 0x16, 0xf0, 0x11, 0xe6, 0x16, 0xea,
+    0x17, 0x20, 0x16, 0x9c, 0x16, 0xf0, 0x14, 0xbc, 0x18, 0x10, 0x17, 0x26,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0xbc, 0x18, 0x10, 0x14, 0xda, 0x18, 0x10,
+    0x18, 0x10, 0x14, 0xbc, 0x18, 0x10, 0x14, 0xe0, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0xbc, 0x18, 0x10, 0x16, 0x72, 0x18, 0x10, 0x18, 0x10, 0x17, 0x2c,
+    0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x14, 0xbc, 0x18, 0x10,
+    0x15, 0x1c, 0x18, 0x10, 0x18, 0x10, 0x14, 0xce, 0x18, 0x10, 0x14, 0xda,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0xbc, 0x18, 0x10, 0x15, 0x34, 0x18, 0x10,
+    0x18, 0x10, 0x17, 0x32, 0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10,
+    0x14, 0xbc, 0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x18, 0x10, 0x15, 0x52, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x17, 0x38, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x17, 0x3e,
+    0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x17, 0x44, 0x18, 0x10,
+    0x18, 0x10, 0x17, 0x4a, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x18, 0x10, 0x18, 0x10, 0x14, 0xfe, 0x18, 0x10, 0x18, 0x10, 0x13, 0xa2,
+    0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10, 0x18, 0x10,
+    0x17, 0x50, 0x18, 0x10, 0x18, 0x10, 0x17, 0x56, 0x18, 0x10, 0x18, 0x10,
+    0x18, 0x10, 0x18, 0x10, 0x17, 0x56, 0x18, 0x10, 0x17, 0x50, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x17, 0x62, 0x17, 0x5c, 0x17, 0x68,
+    0x11, 0xe6, 0x18, 0x10, 0x17, 0x62, 0x17, 0x5c, 0x17, 0x68, 0x11, 0xe6,
+    0x18, 0x10, 0x17, 0x62, 0x17, 0x5c, 0x17, 0x68, 0x12, 0xca, 0x18, 0x10,
+    0x17, 0x62, 0x17, 0x5c, 0x17, 0x68, 0x13, 0xc0, 0x18, 0x10, 0x17, 0x62,
+    0x17, 0x5c, 0x17, 0x68, 0x11, 0xe6, 0x18, 0x10, 0x17, 0x6e, 0x17, 0x5c,
+    0x17, 0x68, 0x12, 0x0a, 0x18, 0x10, 0x17, 0x62, 0x17, 0x5c, 0x17, 0x68,
+    0x12, 0xb8, 0x18, 0x10, 0x17, 0x62, 0x17, 0x5c, 0x17, 0x68, 0x17, 0x74,
+    0x17, 0x7a, 0x14, 0xda, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a,
+    0x14, 0xe0, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x14, 0xe6,
+    0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x14, 0xfe, 0x18, 0x10,
+    0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x15, 0x1c, 0x18, 0x10, 0x17, 0x80,
+    0x17, 0x74, 0x17, 0x7a, 0x15, 0x22, 0x18, 0x10, 0x17, 0x80, 0x17, 0x86,
+    0x17, 0x7a, 0x14, 0xda, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a,
+    0x15, 0x28, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x15, 0x2e,
+    0x18, 0x10, 0x17, 0x80, 0x17, 0x8c, 0x17, 0x92, 0x17, 0x98, 0x18, 0x10,
+    0x17, 0x9e, 0x17, 0x8c, 0x17, 0x92, 0x17, 0xa4, 0x18, 0x10, 0x17, 0x9e,
+    0x17, 0xaa, 0x17, 0x92, 0x17, 0x98, 0x18, 0x10, 0x17, 0x9e, 0x17, 0x8c,
+    0x17, 0x92, 0x17, 0xb0, 0x18, 0x10, 0x17, 0x9e, 0x17, 0x8c, 0x17, 0x92,
+    0x17, 0xb6, 0x18, 0x10, 0x17, 0x9e, 0x17, 0x8c, 0x17, 0x92, 0x17, 0xbc,
+    0x18, 0x10, 0x17, 0x9e, 0x17, 0x74, 0x17, 0x7a, 0x17, 0x02, 0x18, 0x10,
+    0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x15, 0x34, 0x18, 0x10, 0x17, 0x80,
+    0x17, 0x74, 0x17, 0x7a, 0x15, 0x3a, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74,
+    0x17, 0x7a, 0x16, 0xf6, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a,
+    0x14, 0xda, 0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x15, 0x40,
+    0x18, 0x10, 0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x15, 0x4c, 0x18, 0x10,
+    0x17, 0x80, 0x17, 0x74, 0x17, 0x7a, 0x17, 0x14, 0x18, 0x10, 0x17, 0x80,
+    0x11, 0xe6, 0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x14, 0xe0, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x14, 0xfe,
+    0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x15, 0x22, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x15, 0x28, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x17, 0xc2,
+    0x18, 0x10, 0x17, 0xc8, 0x18, 0x10, 0x18, 0x10, 0x17, 0xc2, 0x18, 0x10,
+    0x17, 0xce, 0x18, 0x10, 0x18, 0x10, 0x17, 0xc2, 0x18, 0x10, 0x17, 0xd4,
+    0x18, 0x10, 0x18, 0x10, 0x17, 0xc2, 0x18, 0x10, 0x17, 0xda, 0x18, 0x10,
+    0x18, 0x10, 0x17, 0xc2, 0x18, 0x10, 0x17, 0xe0, 0x18, 0x10, 0x18, 0x10,
+    0x17, 0xe6, 0x18, 0x10, 0x17, 0xc8, 0x18, 0x10, 0x18, 0x10, 0x17, 0xc2,
+    0x18, 0x10, 0x17, 0xec, 0x18, 0x10, 0x18, 0x10, 0x17, 0xc2, 0x18, 0x10,
+    0x17, 0xf2, 0x18, 0x10, 0x18, 0x10, 0x17, 0xc2, 0x18, 0x10, 0x17, 0xf8,
+    0x18, 0x10, 0x18, 0x10, 0x17, 0xc2, 0x18, 0x10, 0x17, 0xfe, 0x18, 0x10,
+    0x18, 0x10, 0x11, 0xe6, 0x18, 0x10, 0x14, 0xda, 0x18, 0x10, 0x18, 0x10,
+    0x11, 0xe6, 0x18, 0x10, 0x14, 0xe0, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6,
+    0x18, 0x10, 0x16, 0x72, 0x18, 0x10, 0x18, 0x10, 0x11, 0xe6, 0x18, 0x10,
+    0x14, 0xda, 0x18, 0x10, 0x18, 0x10, 0x12, 0x0a, 0x18, 0x10, 0x14, 0xda,
+    0x18, 0x10, 0x18, 0x10, 0x18, 0x04, 0x17, 0x92, 0x18, 0x0a, 0x18, 0x10,
+    0x17, 0x9e, 0x16, 0xb4, 0x18, 0x10, 0x16, 0xba, 0x18, 0x10, 0x18, 0x10,
+    0x00, 0x01, 0xfe, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xff, 0x08, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0x1b, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0x04, 0x00, 0x00, 0x00, 0x01, 0xff, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0x07, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0b, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x11, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xfb, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x06, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0c, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x0e, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0d, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x10, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf7, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x1b, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf8, 0x01, 0xd3,
+    0x00, 0x01, 0xff, 0x07, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x39, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x46, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x19, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x2e, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x06, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x12, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0a, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x07, 0x01, 0x3b, 0x00, 0x01, 0xfe, 0xd2, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x98, 0x01, 0xc9, 0x00, 0x01, 0xff, 0xa4, 0x02, 0x6f,
+    0x00, 0x01, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x01, 0x9e, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0x6f, 0x00, 0x01, 0x00, 0xfa, 0x02, 0xe5,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0x13, 0x00, 0x01, 0x01, 0x18, 0x03, 0x54,
+    0x00, 0x01, 0x00, 0xfa, 0xff, 0x55, 0x00, 0x01, 0x00, 0xe7, 0x03, 0xbb,
+    0x00, 0x01, 0x00, 0xf6, 0x03, 0x96, 0x00, 0x01, 0x00, 0xf5, 0x03, 0x53,
+    0x00, 0x01, 0x01, 0x92, 0x02, 0xda, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x1e,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0xa1, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x17,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0x97, 0x00, 0x01, 0x00, 0xe6, 0x03, 0x1b,
+    0x00, 0x01, 0x00, 0xf8, 0x02, 0xfd, 0x00, 0x01, 0x00, 0xe7, 0x03, 0x17,
+    0x00, 0x01, 0x01, 0x00, 0x03, 0x45, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x2a,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0x09, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x1b,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0x91, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x0a,
+    0x00, 0x01, 0x01, 0x0d, 0x02, 0xe5, 0x00, 0x01, 0x01, 0x18, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x0e, 0x02, 0x6f, 0x00, 0x01, 0x01, 0x0e, 0x02, 0xe5,
+    0x00, 0x01, 0x01, 0x0e, 0x03, 0x17, 0x00, 0x01, 0x01, 0x18, 0xff, 0x4f,
+    0x00, 0x01, 0x01, 0xa6, 0x02, 0xda, 0x00, 0x01, 0x01, 0x0c, 0x02, 0xdf,
+    0x00, 0x01, 0x00, 0xfa, 0x01, 0x38, 0x00, 0x01, 0x00, 0xdc, 0x02, 0x6f,
+    0x00, 0x01, 0x00, 0xdc, 0x03, 0x17, 0x00, 0x01, 0x00, 0xfa, 0xff, 0x5a,
+    0x00, 0x01, 0x01, 0xc2, 0x00, 0x0a, 0x00, 0x01, 0x01, 0x0e, 0x03, 0x13,
+    0x00, 0x01, 0x00, 0xfa, 0xff, 0x4f, 0x00, 0x01, 0x01, 0x0e, 0x03, 0x1e,
+    0x00, 0x01, 0x01, 0x0e, 0x03, 0xa1, 0x00, 0x01, 0x01, 0x0e, 0x03, 0x97,
+    0x00, 0x01, 0x01, 0x0c, 0x02, 0xfd, 0x00, 0x01, 0x00, 0xfb, 0x03, 0x17,
+    0x00, 0x01, 0x01, 0x14, 0x03, 0x45, 0x00, 0x01, 0x01, 0x0e, 0x03, 0x2a,
+    0x00, 0x01, 0x01, 0x0e, 0x03, 0x09, 0x00, 0x01, 0x01, 0x0e, 0x03, 0x7f,
+    0x00, 0x01, 0x00, 0xfb, 0x03, 0xb1, 0x00, 0x01, 0x01, 0x0e, 0x03, 0x0a,
+    0x00, 0x01, 0x01, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x01, 0x12, 0x02, 0x6f,
+    0x00, 0x01, 0x01, 0x12, 0x03, 0x13, 0x00, 0x01, 0x01, 0x12, 0x03, 0x17,
+    0x00, 0x01, 0x01, 0xaa, 0x02, 0xda, 0x00, 0x01, 0x01, 0x0a, 0xfe, 0xf3,
+    0x00, 0x01, 0x01, 0x10, 0x02, 0xdf, 0x00, 0x01, 0x01, 0x12, 0x03, 0x09,
+    0x00, 0x01, 0x00, 0xfa, 0xff, 0x44, 0x00, 0x01, 0x01, 0x61, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xef, 0x02, 0x6f, 0x00, 0x01, 0x00, 0xef, 0x02, 0xe5,
+    0x00, 0x01, 0x00, 0xef, 0x03, 0x13, 0x00, 0x01, 0x01, 0x87, 0x02, 0xda,
+    0x00, 0x01, 0x00, 0xdb, 0x03, 0x1b, 0x00, 0x01, 0x00, 0xed, 0x02, 0xfd,
+    0x00, 0x01, 0x00, 0xed, 0x03, 0x73, 0x00, 0x01, 0x00, 0xed, 0x02, 0xdf,
+    0x00, 0x01, 0x00, 0xf5, 0x03, 0x45, 0x00, 0x01, 0x00, 0xef, 0x03, 0x2a,
+    0x00, 0x01, 0x00, 0xef, 0x03, 0x09, 0x00, 0x01, 0x00, 0xef, 0x03, 0x22,
+    0x00, 0x01, 0x01, 0x4a, 0x02, 0x6f, 0x00, 0x01, 0x01, 0xe2, 0x02, 0xda,
+    0x00, 0x01, 0x00, 0xec, 0xfe, 0xf3, 0x00, 0x01, 0x00, 0x6b, 0x01, 0x38,
+    0x00, 0x01, 0x00, 0xc8, 0x02, 0x6f, 0x00, 0x01, 0x00, 0xb4, 0x01, 0xc9,
+    0x00, 0x01, 0x00, 0xc8, 0x02, 0xe5, 0x00, 0x01, 0x00, 0xfa, 0xfe, 0xf3,
+    0x00, 0x01, 0x00, 0xf8, 0x02, 0xdf, 0x00, 0x01, 0x01, 0x1f, 0x00, 0x0a,
+    0x00, 0x01, 0x01, 0x7b, 0x02, 0x48, 0x00, 0x01, 0x00, 0xf8, 0x03, 0x97,
+    0x00, 0x01, 0x00, 0xf8, 0x03, 0x79, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x7f,
+    0x00, 0x01, 0x00, 0xe7, 0x03, 0xb1, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x80,
+    0x00, 0x01, 0x00, 0xf8, 0x03, 0x98, 0x00, 0x01, 0x00, 0xf5, 0x03, 0x9c,
+    0x00, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf7, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x05, 0x02, 0x6f, 0x00, 0x01, 0x01, 0x05, 0x02, 0xe5,
+    0x00, 0x01, 0x01, 0x03, 0x03, 0x55, 0x00, 0x01, 0x01, 0x05, 0x03, 0x17,
+    0x00, 0x01, 0x01, 0x03, 0x03, 0x87, 0x00, 0x01, 0x00, 0xf7, 0xff, 0x4f,
+    0x00, 0x01, 0x01, 0x9d, 0x02, 0xda, 0x00, 0x01, 0x00, 0xf7, 0xfe, 0xf3,
+    0x00, 0x01, 0x01, 0x03, 0x02, 0xdf, 0x00, 0x01, 0x00, 0xf7, 0xff, 0x55,
+    0x00, 0x01, 0x00, 0xf4, 0x01, 0x38, 0x00, 0x01, 0x01, 0x2e, 0x00, 0x0a,
+    0x00, 0x01, 0x01, 0xc6, 0x02, 0x6f, 0x00, 0x01, 0x00, 0xde, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xdf, 0x02, 0x6f, 0x00, 0x01, 0x01, 0x98, 0x02, 0x6f,
+    0x00, 0x01, 0x00, 0xdf, 0x02, 0xe5, 0x00, 0x01, 0x00, 0xde, 0xff, 0x55,
+    0x00, 0x01, 0x00, 0xcc, 0x03, 0x17, 0x00, 0x01, 0x00, 0xe5, 0x03, 0x45,
+    0x00, 0x01, 0x00, 0xdf, 0x03, 0x0a, 0x00, 0x01, 0x00, 0xfe, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x04, 0x02, 0x6f, 0x00, 0x01, 0x01, 0x04, 0x02, 0xe5,
+    0x00, 0x01, 0x01, 0x9c, 0x02, 0xda, 0x00, 0x01, 0x01, 0x02, 0x02, 0xfd,
+    0x00, 0x01, 0x00, 0xf1, 0x03, 0x17, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0xff, 0x55, 0x00, 0x01, 0x01, 0x0e, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x04, 0x03, 0x17, 0x00, 0x01, 0x01, 0x02, 0x02, 0xdf,
+    0x00, 0x01, 0x01, 0x0e, 0xff, 0x55, 0x00, 0x01, 0x01, 0x81, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xfa, 0x01, 0xc9, 0x00, 0x01, 0x01, 0x0d, 0x02, 0x61,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0x8e, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x20,
+    0x00, 0x01, 0x00, 0xf7, 0x03, 0x5a, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x01,
+    0x00, 0x01, 0x01, 0x8b, 0x02, 0x38, 0x00, 0x01, 0x00, 0xfa, 0x02, 0xaf,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0xce, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x25,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0x02, 0x00, 0x01, 0x00, 0xe6, 0x02, 0x75,
+    0x00, 0x01, 0x00, 0xfb, 0x02, 0x5d, 0x00, 0x01, 0x00, 0xd4, 0x02, 0x9f,
+    0x00, 0x01, 0x01, 0x00, 0x02, 0x9f, 0x00, 0x01, 0x00, 0xfa, 0x02, 0x84,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0x63, 0x00, 0x01, 0x00, 0xfa, 0x02, 0xb5,
+    0x00, 0x01, 0x01, 0x0d, 0x03, 0x4d, 0x00, 0x01, 0x00, 0xfa, 0x02, 0x7c,
+    0x00, 0x01, 0x01, 0x18, 0x02, 0x61, 0x00, 0x01, 0x00, 0xfd, 0x01, 0x39,
+    0x00, 0x01, 0x01, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1e, 0x01, 0xc9,
+    0x00, 0x01, 0x01, 0x31, 0x02, 0x61, 0x00, 0x01, 0x01, 0x1e, 0x02, 0x5c,
+    0x00, 0x01, 0x01, 0x1e, 0xff, 0x4f, 0x00, 0x01, 0x01, 0xaf, 0x02, 0x38,
+    0x00, 0x01, 0x01, 0x1e, 0x02, 0x5d, 0x00, 0x01, 0x01, 0x68, 0x02, 0x25,
+    0x00, 0x01, 0x01, 0xd6, 0x01, 0xc9, 0x00, 0x01, 0x01, 0x3e, 0x00, 0x0a,
+    0x00, 0x01, 0x01, 0x04, 0x01, 0xc9, 0x00, 0x01, 0x01, 0x17, 0x02, 0x61,
+    0x00, 0x01, 0x01, 0x04, 0x02, 0x8e, 0x00, 0x01, 0x01, 0x04, 0x02, 0x5c,
+    0x00, 0x01, 0x01, 0x95, 0x02, 0x38, 0x00, 0x01, 0x01, 0x04, 0x02, 0xaf,
+    0x00, 0x01, 0x01, 0x18, 0xff, 0x55, 0x00, 0x01, 0x01, 0x04, 0x02, 0xce,
+    0x00, 0x01, 0x01, 0x04, 0x03, 0x25, 0x00, 0x01, 0x01, 0x04, 0x03, 0x02,
+    0x00, 0x01, 0x00, 0xf0, 0x02, 0x75, 0x00, 0x01, 0x01, 0x05, 0x02, 0x5d,
+    0x00, 0x01, 0x01, 0x04, 0x02, 0x5d, 0x00, 0x01, 0x00, 0xde, 0x02, 0x9f,
+    0x00, 0x01, 0x01, 0x0a, 0x02, 0x9f, 0x00, 0x01, 0x01, 0x04, 0x02, 0x84,
+    0x00, 0x01, 0x01, 0x04, 0x02, 0x63, 0x00, 0x01, 0x01, 0x17, 0x02, 0xfb,
+    0x00, 0x01, 0x00, 0xde, 0x03, 0x39, 0x00, 0x01, 0x01, 0x04, 0x02, 0x7c,
+    0x00, 0x01, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb6, 0x01, 0xbf,
+    0x00, 0x01, 0x00, 0xdc, 0x01, 0xc9, 0x00, 0x01, 0x00, 0xf0, 0xff, 0x5e,
+    0x00, 0x01, 0x00, 0xe2, 0x01, 0xc9, 0x00, 0x01, 0x00, 0xe2, 0x02, 0x5c,
+    0x00, 0x01, 0x01, 0x73, 0x02, 0x38, 0x00, 0x01, 0x00, 0xe2, 0x03, 0x28,
+    0x00, 0x01, 0x00, 0xe2, 0x02, 0x5d, 0x00, 0x01, 0x00, 0xe2, 0x02, 0x63,
+    0x00, 0x01, 0x00, 0x82, 0x02, 0x25, 0x00, 0x01, 0x00, 0x76, 0x02, 0x99,
+    0x00, 0x01, 0x01, 0x0e, 0x03, 0x04, 0x00, 0x01, 0x01, 0x5a, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0x5d, 0x00, 0x01, 0x01, 0x0e, 0x02, 0xf5,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0x5c, 0x00, 0x01, 0x00, 0xfa, 0xff, 0x42,
+    0x00, 0x01, 0x01, 0x48, 0x02, 0x5d, 0x00, 0x01, 0x01, 0x48, 0x01, 0xc9,
+    0x00, 0x01, 0x01, 0xd9, 0x02, 0x38, 0x00, 0x01, 0x00, 0x68, 0x02, 0x99,
+    0x00, 0x01, 0x00, 0x68, 0x01, 0xc9, 0x00, 0x01, 0x00, 0xfa, 0x00, 0xe5,
+    0x00, 0x01, 0x00, 0xfa, 0x02, 0x99, 0x00, 0x01, 0x01, 0xe0, 0x01, 0xc9,
+    0x00, 0x01, 0x00, 0xfa, 0x03, 0x0f, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x09, 0x01, 0xc9, 0x00, 0x01, 0x01, 0x1c, 0x02, 0x61,
+    0x00, 0x01, 0x01, 0x09, 0x02, 0x5c, 0x00, 0x01, 0x01, 0x04, 0xfe, 0xf3,
+    0x00, 0x01, 0x01, 0x09, 0x02, 0x5d, 0x00, 0x01, 0x01, 0x04, 0xff, 0x55,
+    0x00, 0x01, 0x01, 0x04, 0xff, 0x5a, 0x00, 0x01, 0x01, 0x09, 0x02, 0x7c,
+    0x00, 0x01, 0x01, 0x1e, 0x00, 0x0a, 0x00, 0x01, 0x01, 0x67, 0x01, 0xb4,
+    0x00, 0x01, 0x00, 0xfb, 0x02, 0xf7, 0x00, 0x01, 0x00, 0xfa, 0x02, 0xf7,
+    0x00, 0x01, 0x01, 0x22, 0x02, 0xbb, 0x00, 0x01, 0x01, 0x0d, 0x02, 0xfb,
+    0x00, 0x01, 0x00, 0xd4, 0x03, 0x39, 0x00, 0x01, 0x01, 0x0d, 0x03, 0x14,
+    0x00, 0x01, 0x00, 0xfb, 0x03, 0x10, 0x00, 0x01, 0x00, 0xfa, 0x03, 0x16,
+    0x00, 0x01, 0x01, 0x0e, 0x01, 0xc9, 0x00, 0x01, 0x01, 0x0e, 0xfe, 0xf3,
+    0x00, 0x01, 0x01, 0x0e, 0xff, 0x5a, 0x00, 0x01, 0x01, 0x18, 0x02, 0xf5,
+    0x00, 0x01, 0x01, 0x00, 0x02, 0x5c, 0x00, 0x01, 0x01, 0x00, 0x02, 0xf0,
+    0x00, 0x01, 0x01, 0x0f, 0xff, 0x4f, 0x00, 0x01, 0x00, 0xff, 0x02, 0x5d,
+    0x00, 0x01, 0x00, 0xef, 0xff, 0x55, 0x00, 0x01, 0x00, 0xd5, 0x01, 0x38,
+    0x00, 0x01, 0x00, 0xf1, 0x02, 0x4b, 0x00, 0x01, 0x01, 0x36, 0x01, 0xc9,
+    0x00, 0x01, 0x00, 0xf2, 0x02, 0xdf, 0x00, 0x01, 0x00, 0xe7, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x88, 0x00, 0x00, 0x00, 0x01, 0x01, 0xb0, 0x01, 0xc9,
+    0x00, 0x01, 0x00, 0xe7, 0xff, 0x55, 0x00, 0x01, 0x00, 0xdc, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xe6, 0x01, 0xc9,
+    0x00, 0x01, 0x01, 0x88, 0x01, 0xc9, 0x00, 0x01, 0x00, 0xf9, 0x02, 0x61,
+    0x00, 0x01, 0x00, 0xdc, 0xff, 0x55, 0x00, 0x01, 0x00, 0xc0, 0x02, 0x9f,
+    0x00, 0x01, 0x00, 0xec, 0x02, 0x9f, 0x00, 0x01, 0x00, 0xe6, 0x02, 0x5c,
+    0x00, 0x01, 0x01, 0x72, 0x00, 0x00, 0x00, 0x01, 0x00, 0xfd, 0x01, 0xc9,
+    0x00, 0x01, 0x01, 0x10, 0x02, 0x61, 0x00, 0x01, 0x01, 0x8e, 0x02, 0x38,
+    0x00, 0x01, 0x00, 0xfe, 0x02, 0x5d, 0x00, 0x01, 0x00, 0xfd, 0x02, 0x5d,
+    0x00, 0x01, 0x01, 0x72, 0xff, 0x55, 0x00, 0x01, 0x00, 0xd7, 0x02, 0x9f,
+    0x00, 0x01, 0x01, 0x03, 0x02, 0x9f, 0x00, 0x01, 0x00, 0xfd, 0x02, 0x63,
+    0x00, 0x01, 0x00, 0xfd, 0x02, 0x7c, 0x00, 0x01, 0x00, 0xce, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xd4, 0x01, 0xc9, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x05, 0x22, 0x05, 0x22, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x26,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00,
+    0x00, 0x34, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x06, 0x00, 0x2c, 0x00, 0x32, 0x00, 0x38, 0x00, 0x3e,
+    0x00, 0x44, 0x00, 0x4a, 0x00, 0x01, 0xfe, 0xfb, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0x08, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0x1b, 0x00, 0x00, 0x00, 0x01, 0xff, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0xfe, 0xfb, 0xff, 0x55, 0x00, 0x01, 0xff, 0x08, 0xff, 0x5a, 0x00, 0x01,
+    0xfe, 0xf8, 0xfe, 0xf3, 0x00, 0x01, 0xff, 0x1b, 0xff, 0x4f, 0x00, 0x01,
+    0xff, 0x04, 0xff, 0x44, 0x00, 0x01, 0xff, 0x04, 0xff, 0x5a, 0x00, 0x01,
+    0x04, 0xbc, 0x04, 0xde, 0x00, 0x01, 0x00, 0x0c, 0x00, 0xa6, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe6,
+    0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xf2,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x04,
+    0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x01, 0x16, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x1c,
+    0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x01, 0x2e,
+    0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x01, 0x3a, 0x00, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x22,
+    0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x46,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xda,
+    0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x01, 0x22, 0x00, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x01, 0x4c, 0x00, 0x00, 0x01, 0x40, 0x00, 0x1f, 0x00, 0xb8,
+    0x00, 0xbe, 0x00, 0xc4, 0x00, 0xca, 0x00, 0xd0, 0x00, 0xd6, 0x00, 0xdc,
+    0x00, 0xe2, 0x00, 0xe8, 0x00, 0xee, 0x00, 0xf4, 0x00, 0xfa, 0x01, 0x00,
+    0x01, 0x06, 0x01, 0x0c, 0x01, 0x12, 0x01, 0x18, 0x01, 0x1e, 0x01, 0x24,
+    0x01, 0x2a, 0x01, 0x30, 0x01, 0x36, 0x01, 0x3c, 0x01, 0x42, 0x01, 0x48,
+    0x01, 0x4e, 0x01, 0x54, 0x01, 0x5a, 0x01, 0x60, 0x01, 0x66, 0x01, 0x6c,
+    0x00, 0x01, 0xff, 0x07, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0b, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x11, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xfb, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x06, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0c, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x0e, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0d, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x10, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf7, 0x01, 0xc9,
+    0x00, 0x01, 0xff, 0x1b, 0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf8, 0x01, 0xd3,
+    0x00, 0x01, 0xff, 0x07, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x39, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x46, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x19, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x2e, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x06, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x12, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0a, 0x02, 0x6f,
+    0x00, 0x01, 0xff, 0x08, 0x02, 0x5d, 0x00, 0x01, 0xff, 0x0b, 0x02, 0x5d,
+    0x00, 0x01, 0xfe, 0xeb, 0x02, 0x9f, 0x00, 0x01, 0xff, 0x24, 0x02, 0x61,
+    0x00, 0x01, 0xff, 0x23, 0x02, 0xbb, 0x00, 0x01, 0xff, 0x97, 0x02, 0x38,
+    0x00, 0x01, 0xff, 0x0c, 0x02, 0x5c, 0x00, 0x01, 0xff, 0x0e, 0x02, 0x8e,
+    0x00, 0x01, 0xff, 0x0d, 0x02, 0xb5, 0x00, 0x01, 0xff, 0x10, 0x02, 0x7c,
+    0x00, 0x01, 0xff, 0x06, 0x02, 0x63, 0x00, 0x01, 0xfe, 0xfd, 0x02, 0x9f,
+    0x00, 0x01, 0xff, 0x07, 0x02, 0x75, 0x00, 0x01, 0xff, 0x0e, 0x02, 0x84,
+    0x00, 0x01, 0xfe, 0xf8, 0x03, 0x32, 0x00, 0x01, 0xff, 0x05, 0x02, 0xfd,
+    0x00, 0x01, 0xff, 0x37, 0x02, 0xdf, 0x00, 0x01, 0xff, 0x33, 0x03, 0x17,
+    0x00, 0x01, 0xff, 0x19, 0x02, 0xe5, 0x00, 0x01, 0xff, 0x2e, 0x03, 0x2a,
+    0x00, 0x01, 0xff, 0x9e, 0x02, 0xda, 0x00, 0x01, 0xff, 0x06, 0x03, 0x17,
+    0x00, 0x01, 0xff, 0x06, 0x03, 0x13, 0x00, 0x01, 0xff, 0x07, 0x03, 0x1b,
+    0x00, 0x01, 0xff, 0x07, 0x03, 0x0a, 0x00, 0x01, 0xff, 0x10, 0x02, 0x5c,
+    0x00, 0x01, 0x00, 0xf5, 0x02, 0x75, 0x00, 0x01, 0x00, 0xe5, 0x02, 0x61,
+    0x00, 0x01, 0x01, 0x04, 0x02, 0x7c, 0x00, 0x01, 0x00, 0xfe, 0x03, 0x09,
+    0x00, 0x01, 0x01, 0x04, 0x02, 0xfe, 0x00, 0x01, 0x03, 0x00, 0x03, 0x0a,
+    0x00, 0x01, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x0c,
+    0x00, 0x12, 0x00, 0x01, 0xfe, 0xd2, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x98,
+    0x01, 0xc9, 0x00, 0x01, 0xff, 0xa4, 0x02, 0x6f, 0x00, 0x01, 0x02, 0x72,
+    0x02, 0xe0, 0x00, 0x01, 0x00, 0x0c, 0x00, 0xa6, 0x00, 0x26, 0x00, 0x00,
+    0x00, 0xb4, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00,
+    0x00, 0xc0, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00,
+    0x00, 0xd2, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00,
+    0x00, 0xe4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00,
+    0x00, 0xf0, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00,
+    0x01, 0x0e, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x00,
+    0x01, 0x1a, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00,
+    0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00,
+    0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00,
+    0x00, 0xd8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x00,
+    0x01, 0x26, 0x00, 0x00, 0x01, 0x1a, 0x00, 0x0c, 0x00, 0x92, 0x00, 0x92,
+    0x00, 0x98, 0x00, 0x9e, 0x00, 0xa4, 0x00, 0xaa, 0x00, 0xb0, 0x00, 0xb6,
+    0x00, 0xbc, 0x00, 0xc2, 0x00, 0xc8, 0x00, 0xce, 0x00, 0x01, 0xff, 0x07,
+    0x01, 0xc9, 0x00, 0x01, 0xff, 0x0b, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x11,
+    0x01, 0xc9, 0x00, 0x01, 0xfe, 0xfb, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x06,
+    0x01, 0xc9, 0x00, 0x01, 0xff, 0x0c, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x0e,
+    0x01, 0xc9, 0x00, 0x01, 0xff, 0x0d, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x10,
+    0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf7, 0x01, 0xc9, 0x00, 0x01, 0xff, 0x1b,
+    0x01, 0xc9, 0x00, 0x01, 0xfe, 0xf8, 0x01, 0xd3, 0x00, 0x01, 0xff, 0x07,
+    0x02, 0x6f, 0x00, 0x01, 0xff, 0x39, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x46,
+    0x02, 0x6f, 0x00, 0x01, 0xff, 0x19, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x2e,
+    0x02, 0x6f, 0x00, 0x01, 0xff, 0x06, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x12,
+    0x01, 0xc9, 0x00, 0x01, 0xff, 0x0a, 0x02, 0x6f, 0x00, 0x01, 0xff, 0x0e,
+    0x03, 0x20, 0x00, 0x01, 0xff, 0x0b, 0x03, 0x5a, 0x00, 0x01, 0xff, 0x12,
+    0x03, 0x01, 0x00, 0x01, 0xff, 0x0c, 0x02, 0xaf, 0x00, 0x01, 0xff, 0x0c,
+    0x02, 0xce, 0x00, 0x01, 0xff, 0x07, 0x03, 0x25, 0x00, 0x01, 0xff, 0x0e,
+    0x03, 0x02, 0x00, 0x01, 0xff, 0x07, 0x03, 0x1e, 0x00, 0x01, 0xff, 0x06,
+    0x03, 0xa1, 0x00, 0x01, 0xff, 0x0a, 0x03, 0x17, 0x00, 0x01, 0xff, 0x06,
+    0x03, 0x97, 0x00, 0x02, 0x00, 0x03, 0x02, 0xcb, 0x02, 0xdf, 0x00, 0x00,
+    0x02, 0xe1, 0x02, 0xf0, 0x00, 0x15, 0x03, 0x12, 0x03, 0x1d, 0x00, 0x25,
+    0x00, 0x01, 0x00, 0x09, 0x02, 0x53, 0x02, 0x54, 0x02, 0x55, 0x02, 0x58,
+    0x02, 0x5b, 0x02, 0x61, 0x02, 0x63, 0x02, 0x64, 0x02, 0x67, 0x00, 0x02,
+    0x00, 0x02, 0x02, 0xcb, 0x02, 0xf0, 0x00, 0x00, 0x03, 0x12, 0x03, 0x1d,
+    0x00, 0x26, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00,
+    0x00, 0x1e, 0x00, 0x27, 0x00, 0x19, 0x00, 0x29, 0x00, 0x29, 0x00, 0x23,
+    0x00, 0x2b, 0x00, 0x43, 0x00, 0x24, 0x00, 0x45, 0x00, 0x62, 0x00, 0x3d,
+    0x00, 0x64, 0x00, 0x64, 0x00, 0x5b, 0x00, 0x66, 0x00, 0x66, 0x00, 0x5c,
+    0x00, 0x68, 0x00, 0x6c, 0x00, 0x5d, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x62,
+    0x00, 0x70, 0x00, 0x9c, 0x00, 0x63, 0x00, 0x9e, 0x00, 0x9e, 0x00, 0x90,
+    0x00, 0xa0, 0x00, 0xb3, 0x00, 0x91, 0x00, 0xb5, 0x01, 0x03, 0x00, 0xa5,
+    0x01, 0x05, 0x01, 0x0f, 0x00, 0xf4, 0x01, 0x12, 0x01, 0x2a, 0x00, 0xff,
+    0x01, 0x2c, 0x01, 0x2d, 0x01, 0x18, 0x01, 0x30, 0x01, 0x55, 0x01, 0x1a,
+    0x01, 0x57, 0x01, 0x57, 0x01, 0x40, 0x01, 0x59, 0x01, 0x59, 0x01, 0x41,
+    0x01, 0x5b, 0x01, 0x62, 0x01, 0x42, 0x01, 0x64, 0x01, 0x81, 0x01, 0x4a,
+    0x01, 0x83, 0x01, 0x87, 0x01, 0x68, 0x01, 0x89, 0x01, 0x89, 0x01, 0x6d,
+    0x01, 0x8c, 0x01, 0x91, 0x01, 0x6e, 0x01, 0x93, 0x01, 0x95, 0x01, 0x74,
+    0x01, 0x97, 0x01, 0xa0, 0x01, 0x77, 0x01, 0xa2, 0x01, 0xd7, 0x01, 0x81,
+    0x01, 0xdd, 0x01, 0xdd, 0x01, 0xb7, 0x00, 0x02, 0x00, 0x02, 0x02, 0xdc,
+    0x02, 0xdf, 0x00, 0x00, 0x02, 0xe1, 0x02, 0xe2, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x05, 0x02, 0xcb, 0x02, 0xcf, 0x00, 0x00, 0x02, 0xd1, 0x02, 0xda,
+    0x00, 0x05, 0x02, 0xe5, 0x02, 0xee, 0x00, 0x0f, 0x02, 0xf0, 0x02, 0xf0,
+    0x00, 0x19, 0x03, 0x12, 0x03, 0x1d, 0x00, 0x1a, 0x00, 0x02, 0x00, 0x09,
+    0x02, 0xcb, 0x02, 0xcf, 0x00, 0x00, 0x02, 0xd1, 0x02, 0xda, 0x00, 0x05,
+    0x02, 0xe5, 0x02, 0xee, 0x00, 0x0f, 0x02, 0xf0, 0x02, 0xf0, 0x00, 0x19,
+    0x02, 0xf2, 0x02, 0xf2, 0x00, 0x1a, 0x03, 0x03, 0x03, 0x03, 0x00, 0x1b,
+    0x03, 0x08, 0x03, 0x08, 0x00, 0x1c, 0x03, 0x0a, 0x03, 0x0a, 0x00, 0x1d,
+    0x03, 0x11, 0x03, 0x11, 0x00, 0x1e, 0x00, 0x01, 0x00, 0x03, 0x02, 0xd0,
+    0x02, 0xdb, 0x02, 0xef, 0x00, 0x01, 0x00, 0x02, 0x02, 0xdb, 0x02, 0xef,
+    0x00, 0x02, 0x00, 0x01, 0x03, 0x12, 0x03, 0x1d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x01, 0xb4, 0x09, 0x0c, 0x00, 0x02,
+    0x44, 0x46, 0x4c, 0x54, 0x00, 0x0e, 0x6c, 0x61, 0x74, 0x6e, 0x00, 0x34,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0e, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x28, 0x00, 0x3a, 0x00, 0x44,
+    0x00, 0x4e, 0x00, 0x58, 0x00, 0x62, 0x00, 0x6c, 0x00, 0x76, 0x00, 0x80,
+    0x00, 0x8a, 0x00, 0x34, 0x00, 0x08, 0x41, 0x5a, 0x45, 0x20, 0x00, 0x56,
+    0x43, 0x41, 0x54, 0x20, 0x00, 0x7a, 0x43, 0x52, 0x54, 0x20, 0x00, 0x9e,
+    0x4b, 0x41, 0x5a, 0x20, 0x00, 0xc2, 0x4d, 0x4f, 0x4c, 0x20, 0x00, 0xe6,
+    0x52, 0x4f, 0x4d, 0x20, 0x01, 0x0a, 0x54, 0x41, 0x54, 0x20, 0x01, 0x2e,
+    0x54, 0x52, 0x4b, 0x20, 0x01, 0x52, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0e,
+    0x00, 0x01, 0x00, 0x0b, 0x00, 0x15, 0x00, 0x1f, 0x00, 0x29, 0x00, 0x3b,
+    0x00, 0x45, 0x00, 0x4f, 0x00, 0x59, 0x00, 0x63, 0x00, 0x6d, 0x00, 0x77,
+    0x00, 0x81, 0x00, 0x8b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x02,
+    0x00, 0x0c, 0x00, 0x16, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x32, 0x00, 0x3c,
+    0x00, 0x46, 0x00, 0x50, 0x00, 0x5a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x78,
+    0x00, 0x82, 0x00, 0x8c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x03,
+    0x00, 0x0d, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2b, 0x00, 0x33, 0x00, 0x3d,
+    0x00, 0x47, 0x00, 0x51, 0x00, 0x5b, 0x00, 0x65, 0x00, 0x6f, 0x00, 0x79,
+    0x00, 0x83, 0x00, 0x8d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x04,
+    0x00, 0x0e, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2c, 0x00, 0x34, 0x00, 0x3e,
+    0x00, 0x48, 0x00, 0x52, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x70, 0x00, 0x7a,
+    0x00, 0x84, 0x00, 0x8e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x05,
+    0x00, 0x0f, 0x00, 0x19, 0x00, 0x23, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3f,
+    0x00, 0x49, 0x00, 0x53, 0x00, 0x5d, 0x00, 0x67, 0x00, 0x71, 0x00, 0x7b,
+    0x00, 0x85, 0x00, 0x8f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x06,
+    0x00, 0x10, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x40,
+    0x00, 0x4a, 0x00, 0x54, 0x00, 0x5e, 0x00, 0x68, 0x00, 0x72, 0x00, 0x7c,
+    0x00, 0x86, 0x00, 0x90, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x07,
+    0x00, 0x11, 0x00, 0x1b, 0x00, 0x25, 0x00, 0x2f, 0x00, 0x37, 0x00, 0x41,
+    0x00, 0x4b, 0x00, 0x55, 0x00, 0x5f, 0x00, 0x69, 0x00, 0x73, 0x00, 0x7d,
+    0x00, 0x87, 0x00, 0x91, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x08,
+    0x00, 0x12, 0x00, 0x1c, 0x00, 0x26, 0x00, 0x30, 0x00, 0x38, 0x00, 0x42,
+    0x00, 0x4c, 0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7e,
+    0x00, 0x88, 0x00, 0x92, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x09,
+    0x00, 0x13, 0x00, 0x1d, 0x00, 0x27, 0x00, 0x31, 0x00, 0x39, 0x00, 0x43,
+    0x00, 0x4d, 0x00, 0x57, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x75, 0x00, 0x7f,
+    0x00, 0x89, 0x00, 0x93, 0x00, 0x94, 0x61, 0x61, 0x6c, 0x74, 0x03, 0x7a,
+    0x61, 0x61, 0x6c, 0x74, 0x03, 0x82, 0x61, 0x61, 0x6c, 0x74, 0x03, 0x8a,
+    0x61, 0x61, 0x6c, 0x74, 0x03, 0x92, 0x61, 0x61, 0x6c, 0x74, 0x03, 0x9a,
+    0x61, 0x61, 0x6c, 0x74, 0x03, 0xa2, 0x61, 0x61, 0x6c, 0x74, 0x03, 0xaa,
+    0x61, 0x61, 0x6c, 0x74, 0x03, 0xb2, 0x61, 0x61, 0x6c, 0x74, 0x03, 0xba,
+    0x61, 0x61, 0x6c, 0x74, 0x03, 0xc2, 0x63, 0x61, 0x73, 0x65, 0x03, 0xca,
+    0x63, 0x61, 0x73, 0x65, 0x03, 0xd0, 0x63, 0x61, 0x73, 0x65, 0x03, 0xd6,
+    0x63, 0x61, 0x73, 0x65, 0x03, 0xdc, 0x63, 0x61, 0x73, 0x65, 0x03, 0xe2,
+    0x63, 0x61, 0x73, 0x65, 0x03, 0xe8, 0x63, 0x61, 0x73, 0x65, 0x03, 0xee,
+    0x63, 0x61, 0x73, 0x65, 0x03, 0xf4, 0x63, 0x61, 0x73, 0x65, 0x03, 0xfa,
+    0x63, 0x61, 0x73, 0x65, 0x04, 0x00, 0x63, 0x63, 0x6d, 0x70, 0x04, 0x06,
+    0x63, 0x63, 0x6d, 0x70, 0x04, 0x0e, 0x63, 0x63, 0x6d, 0x70, 0x04, 0x18,
+    0x63, 0x63, 0x6d, 0x70, 0x04, 0x20, 0x63, 0x63, 0x6d, 0x70, 0x04, 0x28,
+    0x63, 0x63, 0x6d, 0x70, 0x04, 0x30, 0x63, 0x63, 0x6d, 0x70, 0x04, 0x38,
+    0x63, 0x63, 0x6d, 0x70, 0x04, 0x40, 0x63, 0x63, 0x6d, 0x70, 0x04, 0x48,
+    0x63, 0x63, 0x6d, 0x70, 0x04, 0x50, 0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x58,
+    0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x5e, 0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x64,
+    0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x6a, 0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x70,
+    0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x76, 0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x7c,
+    0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x82, 0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x88,
+    0x64, 0x6e, 0x6f, 0x6d, 0x04, 0x8e, 0x66, 0x72, 0x61, 0x63, 0x04, 0x94,
+    0x66, 0x72, 0x61, 0x63, 0x04, 0x9e, 0x66, 0x72, 0x61, 0x63, 0x04, 0xa8,
+    0x66, 0x72, 0x61, 0x63, 0x04, 0xb2, 0x66, 0x72, 0x61, 0x63, 0x04, 0xbc,
+    0x66, 0x72, 0x61, 0x63, 0x04, 0xc6, 0x66, 0x72, 0x61, 0x63, 0x04, 0xd0,
+    0x66, 0x72, 0x61, 0x63, 0x04, 0xda, 0x66, 0x72, 0x61, 0x63, 0x04, 0xe4,
+    0x66, 0x72, 0x61, 0x63, 0x04, 0xee, 0x6c, 0x6f, 0x63, 0x6c, 0x04, 0xf8,
+    0x6c, 0x6f, 0x63, 0x6c, 0x04, 0xfe, 0x6c, 0x6f, 0x63, 0x6c, 0x05, 0x04,
+    0x6c, 0x6f, 0x63, 0x6c, 0x05, 0x0a, 0x6c, 0x6f, 0x63, 0x6c, 0x05, 0x10,
+    0x6c, 0x6f, 0x63, 0x6c, 0x05, 0x16, 0x6c, 0x6f, 0x63, 0x6c, 0x05, 0x1c,
+    0x6c, 0x6f, 0x63, 0x6c, 0x05, 0x22, 0x6e, 0x75, 0x6d, 0x72, 0x05, 0x28,
+    0x6e, 0x75, 0x6d, 0x72, 0x05, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x05, 0x34,
+    0x6e, 0x75, 0x6d, 0x72, 0x05, 0x3a, 0x6e, 0x75, 0x6d, 0x72, 0x05, 0x40,
+    0x6e, 0x75, 0x6d, 0x72, 0x05, 0x46, 0x6e, 0x75, 0x6d, 0x72, 0x05, 0x4c,
+    0x6e, 0x75, 0x6d, 0x72, 0x05, 0x52, 0x6e, 0x75, 0x6d, 0x72, 0x05, 0x58,
+    0x6e, 0x75, 0x6d, 0x72, 0x05, 0x5e, 0x6f, 0x72, 0x64, 0x6e, 0x05, 0x64,
+    0x6f, 0x72, 0x64, 0x6e, 0x05, 0x6c, 0x6f, 0x72, 0x64, 0x6e, 0x05, 0x74,
+    0x6f, 0x72, 0x64, 0x6e, 0x05, 0x7c, 0x6f, 0x72, 0x64, 0x6e, 0x05, 0x84,
+    0x6f, 0x72, 0x64, 0x6e, 0x05, 0x8c, 0x6f, 0x72, 0x64, 0x6e, 0x05, 0x94,
+    0x6f, 0x72, 0x64, 0x6e, 0x05, 0x9c, 0x6f, 0x72, 0x64, 0x6e, 0x05, 0xa4,
+    0x6f, 0x72, 0x64, 0x6e, 0x05, 0xac, 0x73, 0x61, 0x6c, 0x74, 0x05, 0xb4,
+    0x73, 0x61, 0x6c, 0x74, 0x05, 0xba, 0x73, 0x61, 0x6c, 0x74, 0x05, 0xc0,
+    0x73, 0x61, 0x6c, 0x74, 0x05, 0xc6, 0x73, 0x61, 0x6c, 0x74, 0x05, 0xcc,
+    0x73, 0x61, 0x6c, 0x74, 0x05, 0xd2, 0x73, 0x61, 0x6c, 0x74, 0x05, 0xd8,
+    0x73, 0x61, 0x6c, 0x74, 0x05, 0xde, 0x73, 0x61, 0x6c, 0x74, 0x05, 0xe4,
+    0x73, 0x61, 0x6c, 0x74, 0x05, 0xea, 0x73, 0x73, 0x30, 0x31, 0x05, 0xf0,
+    0x73, 0x73, 0x30, 0x31, 0x05, 0xf6, 0x73, 0x73, 0x30, 0x31, 0x05, 0xfc,
+    0x73, 0x73, 0x30, 0x31, 0x06, 0x02, 0x73, 0x73, 0x30, 0x31, 0x06, 0x08,
+    0x73, 0x73, 0x30, 0x31, 0x06, 0x0e, 0x73, 0x73, 0x30, 0x31, 0x06, 0x14,
+    0x73, 0x73, 0x30, 0x31, 0x06, 0x1a, 0x73, 0x73, 0x30, 0x31, 0x06, 0x20,
+    0x73, 0x73, 0x30, 0x31, 0x06, 0x26, 0x73, 0x73, 0x30, 0x32, 0x06, 0x2c,
+    0x73, 0x73, 0x30, 0x32, 0x06, 0x32, 0x73, 0x73, 0x30, 0x32, 0x06, 0x38,
+    0x73, 0x73, 0x30, 0x32, 0x06, 0x3e, 0x73, 0x73, 0x30, 0x32, 0x06, 0x44,
+    0x73, 0x73, 0x30, 0x32, 0x06, 0x4a, 0x73, 0x73, 0x30, 0x32, 0x06, 0x50,
+    0x73, 0x73, 0x30, 0x32, 0x06, 0x56, 0x73, 0x73, 0x30, 0x32, 0x06, 0x5c,
+    0x73, 0x73, 0x30, 0x32, 0x06, 0x62, 0x73, 0x73, 0x30, 0x33, 0x06, 0x68,
+    0x73, 0x73, 0x30, 0x33, 0x06, 0x6e, 0x73, 0x73, 0x30, 0x33, 0x06, 0x74,
+    0x73, 0x73, 0x30, 0x33, 0x06, 0x7a, 0x73, 0x73, 0x30, 0x33, 0x06, 0x80,
+    0x73, 0x73, 0x30, 0x33, 0x06, 0x86, 0x73, 0x73, 0x30, 0x33, 0x06, 0x8c,
+    0x73, 0x73, 0x30, 0x33, 0x06, 0x92, 0x73, 0x73, 0x30, 0x33, 0x06, 0x98,
+    0x73, 0x73, 0x30, 0x33, 0x06, 0x9e, 0x73, 0x75, 0x62, 0x73, 0x06, 0xa4,
+    0x73, 0x75, 0x62, 0x73, 0x06, 0xaa, 0x73, 0x75, 0x62, 0x73, 0x06, 0xb0,
+    0x73, 0x75, 0x62, 0x73, 0x06, 0xb6, 0x73, 0x75, 0x62, 0x73, 0x06, 0xbc,
+    0x73, 0x75, 0x62, 0x73, 0x06, 0xc2, 0x73, 0x75, 0x62, 0x73, 0x06, 0xc8,
+    0x73, 0x75, 0x62, 0x73, 0x06, 0xce, 0x73, 0x75, 0x62, 0x73, 0x06, 0xd4,
+    0x73, 0x75, 0x62, 0x73, 0x06, 0xda, 0x73, 0x75, 0x70, 0x73, 0x06, 0xe0,
+    0x73, 0x75, 0x70, 0x73, 0x06, 0xe6, 0x73, 0x75, 0x70, 0x73, 0x06, 0xec,
+    0x73, 0x75, 0x70, 0x73, 0x06, 0xf2, 0x73, 0x75, 0x70, 0x73, 0x06, 0xf8,
+    0x73, 0x75, 0x70, 0x73, 0x06, 0xfe, 0x73, 0x75, 0x70, 0x73, 0x07, 0x04,
+    0x73, 0x75, 0x70, 0x73, 0x07, 0x0a, 0x73, 0x75, 0x70, 0x73, 0x07, 0x10,
+    0x73, 0x75, 0x70, 0x73, 0x07, 0x16, 0x7a, 0x65, 0x72, 0x6f, 0x07, 0x1c,
+    0x7a, 0x65, 0x72, 0x6f, 0x07, 0x22, 0x7a, 0x65, 0x72, 0x6f, 0x07, 0x28,
+    0x7a, 0x65, 0x72, 0x6f, 0x07, 0x2e, 0x7a, 0x65, 0x72, 0x6f, 0x07, 0x34,
+    0x7a, 0x65, 0x72, 0x6f, 0x07, 0x3a, 0x7a, 0x65, 0x72, 0x6f, 0x07, 0x40,
+    0x7a, 0x65, 0x72, 0x6f, 0x07, 0x46, 0x7a, 0x65, 0x72, 0x6f, 0x07, 0x4c,
+    0x7a, 0x65, 0x72, 0x6f, 0x07, 0x52, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11,
+    0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11,
+    0x00, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1a,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0x00, 0x1d, 0x00, 0x3c, 0x00, 0x44, 0x00, 0x4c, 0x00, 0x5a, 0x00, 0x64,
+    0x00, 0x6c, 0x00, 0x76, 0x00, 0x7e, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x96,
+    0x00, 0x9e, 0x00, 0xa6, 0x00, 0xae, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc6,
+    0x00, 0xce, 0x00, 0xd6, 0x00, 0xde, 0x00, 0xe8, 0x00, 0xf2, 0x00, 0xfa,
+    0x01, 0x02, 0x01, 0x0a, 0x01, 0x12, 0x01, 0x1a, 0x01, 0x22, 0x01, 0x2a,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x3a, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x9c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe6,
+    0x00, 0xf8, 0x01, 0x0c, 0x01, 0x1e, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02,
+    0x01, 0x22, 0x01, 0x34, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3c,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x01, 0x9e, 0x01, 0xb2, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xbc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xc2, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xc8, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xc6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xc4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xc2, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xc0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xbe, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xbc, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xd0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xce, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xcc, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xca, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02,
+    0x01, 0xc8, 0x01, 0xda, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x01, 0xe2,
+    0x01, 0xf4, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0xfc, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x3e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x42, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x46, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x4e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x62, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x03, 0xb2, 0x00, 0x01, 0x03, 0xba, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x03, 0xa0, 0x00, 0x02, 0x03, 0xb8,
+    0x03, 0xa8, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01,
+    0x03, 0xb4, 0x00, 0x01, 0x03, 0xb4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x03, 0xd0, 0x00, 0x01, 0x03, 0xa2,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x90, 0x00, 0x01, 0x03, 0xce, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x03, 0xbc, 0x00, 0x01, 0x03, 0x7e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x03, 0xc0,
+    0x00, 0x03, 0x00, 0x0c, 0x00, 0x2e, 0x00, 0x50, 0x00, 0x04, 0x00, 0x0a,
+    0x00, 0x10, 0x00, 0x16, 0x00, 0x1c, 0x03, 0x17, 0x00, 0x02, 0x02, 0xcd,
+    0x03, 0x16, 0x00, 0x02, 0x02, 0xce, 0x03, 0x19, 0x00, 0x02, 0x02, 0xd5,
+    0x03, 0x18, 0x00, 0x02, 0x02, 0xd7, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x10,
+    0x00, 0x16, 0x00, 0x1c, 0x03, 0x13, 0x00, 0x02, 0x02, 0xcd, 0x03, 0x12,
+    0x00, 0x02, 0x02, 0xce, 0x03, 0x15, 0x00, 0x02, 0x02, 0xd5, 0x03, 0x14,
+    0x00, 0x02, 0x02, 0xd7, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x14,
+    0x03, 0x1b, 0x00, 0x02, 0x02, 0xe7, 0x03, 0x1a, 0x00, 0x02, 0x02, 0xe8,
+    0x03, 0x1d, 0x00, 0x02, 0x02, 0xee, 0x00, 0x03, 0x00, 0x01, 0x03, 0x60,
+    0x00, 0x01, 0x03, 0x66, 0x00, 0x01, 0x03, 0x60, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x03, 0x58, 0x00, 0x01, 0x03, 0x52,
+    0x00, 0x01, 0x03, 0x58, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x02,
+    0x03, 0x4a, 0x00, 0x04, 0x00, 0xb0, 0x00, 0xba, 0x01, 0x9d, 0x01, 0xa6,
+    0x00, 0x02, 0x03, 0x3c, 0x00, 0x04, 0x00, 0xb0, 0x00, 0xba, 0x01, 0x9d,
+    0x01, 0xa6, 0x00, 0x01, 0x03, 0x3a, 0x00, 0x08, 0x00, 0x01, 0x03, 0x34,
+    0x00, 0x08, 0x00, 0x01, 0x03, 0x2e, 0x00, 0x08, 0x00, 0x01, 0x03, 0x28,
+    0x00, 0x08, 0x00, 0x01, 0x03, 0x22, 0x00, 0x08, 0x00, 0x01, 0x03, 0x22,
+    0x00, 0x0c, 0x00, 0x02, 0x03, 0x26, 0x00, 0x0b, 0x02, 0x09, 0x02, 0x0a,
+    0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e, 0x02, 0x0f, 0x02, 0x10,
+    0x02, 0x11, 0x02, 0x12, 0x02, 0x6d, 0x00, 0x01, 0x03, 0x00, 0x00, 0x20,
+    0x00, 0x01, 0x02, 0xfa, 0x00, 0x16, 0x00, 0x01, 0x03, 0x0e, 0xff, 0xe3,
+    0x00, 0x01, 0x02, 0xee, 0x00, 0x20, 0x00, 0x03, 0x00, 0x01, 0x03, 0x08,
+    0x00, 0x01, 0x03, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x03, 0x00, 0x01, 0x03, 0x06, 0x00, 0x01, 0x02, 0xfc, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x02, 0xc4,
+    0x00, 0x01, 0x02, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x03, 0x00, 0x01, 0x02, 0xb2, 0x00, 0x01, 0x02, 0xf4, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x02, 0xea, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x04, 0x02, 0xba, 0x00, 0x03, 0x01, 0x66,
+    0x02, 0x2a, 0x00, 0x02, 0x02, 0x0a, 0x00, 0x18, 0x02, 0xe5, 0x02, 0xe6,
+    0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xea, 0x02, 0xeb, 0x02, 0xec,
+    0x02, 0xed, 0x02, 0xee, 0x02, 0xef, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b,
+    0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x00, 0x02, 0x02, 0xa6,
+    0x00, 0x05, 0x01, 0xea, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e,
+    0x00, 0x02, 0x02, 0xa4, 0x00, 0x03, 0x02, 0x33, 0x02, 0x89, 0x02, 0xc9,
+    0x00, 0x02, 0x02, 0x98, 0x00, 0x03, 0x02, 0x33, 0x02, 0x89, 0x02, 0xc9,
+    0x00, 0x02, 0x02, 0x7e, 0x00, 0x05, 0x01, 0xe9, 0x02, 0x17, 0x02, 0x18,
+    0x02, 0x19, 0x02, 0x1a, 0x00, 0x01, 0x02, 0x86, 0x00, 0x07, 0x00, 0x02,
+    0x02, 0x88, 0x00, 0x32, 0x01, 0xdb, 0x01, 0xdc, 0x00, 0xb0, 0x00, 0xba,
+    0x01, 0xdb, 0x01, 0x4d, 0x01, 0xdc, 0x01, 0x9d, 0x01, 0xa6, 0x01, 0xf6,
+    0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xfc,
+    0x01, 0xfd, 0x01, 0xfe, 0x02, 0x33, 0x02, 0x32, 0x02, 0x34, 0x02, 0x35,
+    0x02, 0x13, 0x02, 0x6d, 0x02, 0x89, 0x02, 0xc9, 0x02, 0xe5, 0x02, 0xe6,
+    0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9, 0x02, 0xea, 0x02, 0xeb, 0x02, 0xec,
+    0x02, 0xed, 0x02, 0xee, 0x02, 0xef, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b,
+    0x03, 0x0c, 0x03, 0x0d, 0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x00, 0x01, 0x02, 0x86,
+    0x00, 0x0f, 0x00, 0x24, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x42, 0x00, 0x4c,
+    0x00, 0x56, 0x00, 0x60, 0x00, 0x6a, 0x00, 0x74, 0x00, 0x7e, 0x00, 0x88,
+    0x00, 0x92, 0x00, 0x98, 0x00, 0x9e, 0x00, 0xa6, 0x00, 0x02, 0x01, 0x44,
+    0x01, 0x3d, 0x00, 0x06, 0x01, 0xeb, 0x02, 0x09, 0x01, 0xff, 0x01, 0xf5,
+    0x01, 0xea, 0x01, 0xe9, 0x00, 0x04, 0x01, 0xec, 0x02, 0x0a, 0x02, 0x00,
+    0x01, 0xf6, 0x00, 0x04, 0x01, 0xed, 0x02, 0x0b, 0x02, 0x01, 0x01, 0xf7,
+    0x00, 0x04, 0x01, 0xee, 0x02, 0x0c, 0x02, 0x02, 0x01, 0xf8, 0x00, 0x04,
+    0x01, 0xef, 0x02, 0x0d, 0x02, 0x03, 0x01, 0xf9, 0x00, 0x04, 0x01, 0xf0,
+    0x02, 0x0e, 0x02, 0x04, 0x01, 0xfa, 0x00, 0x04, 0x01, 0xf1, 0x02, 0x0f,
+    0x02, 0x05, 0x01, 0xfb, 0x00, 0x04, 0x01, 0xf2, 0x02, 0x10, 0x02, 0x06,
+    0x01, 0xfc, 0x00, 0x04, 0x01, 0xf3, 0x02, 0x11, 0x02, 0x07, 0x01, 0xfd,
+    0x00, 0x04, 0x01, 0xf4, 0x02, 0x12, 0x02, 0x08, 0x01, 0xfe, 0x00, 0x02,
+    0x02, 0x1b, 0x02, 0x17, 0x00, 0x02, 0x02, 0x1c, 0x02, 0x18, 0x00, 0x03,
+    0x01, 0xf5, 0x02, 0x1d, 0x02, 0x19, 0x00, 0x02, 0x02, 0x1e, 0x02, 0x1a,
+    0x00, 0x02, 0x01, 0xfc, 0x00, 0x29, 0x01, 0xdb, 0x01, 0xdc, 0x01, 0xdb,
+    0x01, 0x3d, 0x01, 0x4d, 0x01, 0xdc, 0x01, 0xf5, 0x01, 0xf6, 0x01, 0xf7,
+    0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xfc, 0x01, 0xfd,
+    0x01, 0xfe, 0x02, 0x32, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe8,
+    0x02, 0xe9, 0x02, 0xea, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xed, 0x02, 0xee,
+    0x02, 0xef, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x03, 0x0d,
+    0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11, 0x03, 0x1a, 0x03, 0x1b,
+    0x03, 0x1c, 0x03, 0x1d, 0x00, 0x01, 0x00, 0x02, 0x01, 0x3c, 0x01, 0x4c,
+    0x00, 0x02, 0x00, 0x02, 0x02, 0xcb, 0x02, 0xcf, 0x00, 0x00, 0x02, 0xd1,
+    0x02, 0xda, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x02, 0xdb, 0x02, 0xdd,
+    0x00, 0x00, 0x02, 0xdf, 0x02, 0xe4, 0x00, 0x03, 0x00, 0x02, 0x00, 0x07,
+    0x02, 0xcb, 0x02, 0xcf, 0x00, 0x00, 0x02, 0xd1, 0x02, 0xd5, 0x00, 0x05,
+    0x02, 0xdb, 0x02, 0xdb, 0x00, 0x0a, 0x02, 0xfc, 0x02, 0xfe, 0x00, 0x0b,
+    0x03, 0x01, 0x03, 0x04, 0x00, 0x0e, 0x03, 0x07, 0x03, 0x08, 0x00, 0x12,
+    0x03, 0x16, 0x03, 0x19, 0x00, 0x14, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0xea, 0x00, 0x00, 0x01, 0xde, 0x01, 0xde, 0x00, 0xe7, 0x00, 0x02,
+    0x00, 0x03, 0x02, 0xe5, 0x02, 0xef, 0x00, 0x00, 0x03, 0x09, 0x03, 0x11,
+    0x00, 0x0b, 0x03, 0x1a, 0x03, 0x1d, 0x00, 0x14, 0x00, 0x01, 0x00, 0x03,
+    0x02, 0xd1, 0x02, 0xd3, 0x02, 0xea, 0x00, 0x01, 0x00, 0x01, 0x01, 0x52,
+    0x00, 0x01, 0x00, 0x01, 0x02, 0x21, 0x00, 0x01, 0x00, 0x01, 0x00, 0x66,
+    0x00, 0x01, 0x00, 0x04, 0x00, 0xae, 0x00, 0xb9, 0x01, 0x9b, 0x01, 0xa5,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x3c, 0x00, 0x02, 0x00, 0x01, 0x01, 0xdf,
+    0x01, 0xe8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x01, 0xdf, 0x01, 0xe8,
+    0x00, 0x00, 0x02, 0x6f, 0x02, 0x6f, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x01,
+    0x02, 0x30, 0x00, 0x01, 0x00, 0x01, 0x02, 0x13, 0x00, 0x02, 0x00, 0x01,
+    0x01, 0xff, 0x02, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0xf5,
+    0x01, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0xeb,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x7b, 0x01, 0x66, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x72, 0x00, 0x01, 0x00, 0x05, 0x01, 0xdf, 0x01, 0xeb, 0x01, 0xf5,
+    0x01, 0xff, 0x02, 0x09, 0x00, 0x01, 0x00, 0x03, 0x02, 0x1f, 0x02, 0x7a,
+    0x02, 0xbc, 0x00, 0x01, 0x00, 0x02, 0x02, 0x2d, 0x02, 0x2e, 0x00, 0x01,
+    0x00, 0x32, 0x00, 0x04, 0x00, 0x7b, 0x00, 0xae, 0x00, 0xb9, 0x00, 0xeb,
+    0x01, 0x4c, 0x01, 0x66, 0x01, 0x9b, 0x01, 0xa5, 0x02, 0x00, 0x02, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07,
+    0x02, 0x08, 0x02, 0x1f, 0x02, 0x21, 0x02, 0x2d, 0x02, 0x2e, 0x02, 0x30,
+    0x02, 0x6f, 0x02, 0x7a, 0x02, 0xbc, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcd,
+    0x02, 0xce, 0x02, 0xcf, 0x02, 0xd1, 0x02, 0xd2, 0x02, 0xd3, 0x02, 0xd4,
+    0x02, 0xd5, 0x02, 0xdb, 0x02, 0xfc, 0x02, 0xfd, 0x02, 0xfe, 0x03, 0x01,
+    0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x07, 0x03, 0x08, 0x03, 0x16,
+    0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x00, 0x01, 0x00, 0x0f, 0x01, 0x3c,
+    0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe4,
+    0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01, 0xeb, 0x01, 0xf5,
+    0x01, 0xff, 0x02, 0x09, 0x00, 0x01, 0x00, 0x29, 0x00, 0x04, 0x00, 0x7b,
+    0x00, 0xeb, 0x01, 0x3c, 0x01, 0x4c, 0x01, 0x66, 0x01, 0xff, 0x02, 0x00,
+    0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+    0x02, 0x07, 0x02, 0x08, 0x02, 0x21, 0x02, 0xcb, 0x02, 0xcc, 0x02, 0xcd,
+    0x02, 0xce, 0x02, 0xcf, 0x02, 0xd1, 0x02, 0xd2, 0x02, 0xd3, 0x02, 0xd4,
+    0x02, 0xd5, 0x02, 0xdb, 0x02, 0xfc, 0x02, 0xfd, 0x02, 0xfe, 0x03, 0x01,
+    0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x07, 0x03, 0x08, 0x03, 0x16,
+    0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x00, 0x00, 0x00, 0x04, 0x01, 0xf4,
+    0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00,
+    0x00, 0x4b, 0x02, 0x8a, 0x02, 0x58, 0x00, 0x00, 0x01, 0x5e, 0x00, 0x32,
+    0x01, 0x12, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x59, 0x52, 0x45, 0x00, 0xc0,
+    0x00, 0x00, 0xff, 0xfd, 0x03, 0x5b, 0xff, 0x42, 0x00, 0x00, 0x03, 0xec,
+    0x01, 0x32, 0x20, 0x00, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc9,
+    0x02, 0x6f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x14, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x14,
+    0x00, 0x06, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x09, 0x00, 0xf7, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x26,
+    0x02, 0x2d, 0x02, 0x29, 0x02, 0x57, 0x02, 0x86, 0x02, 0xae, 0x02, 0x2e,
+    0x02, 0x3a, 0x02, 0x3b, 0x02, 0x1f, 0x02, 0x6e, 0x02, 0x24, 0x02, 0x40,
+    0x02, 0x2a, 0x02, 0x30, 0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2,
+    0x01, 0xe3, 0x01, 0xe4, 0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8,
+    0x02, 0x23, 0x02, 0x2f, 0x02, 0x75, 0x02, 0x72, 0x02, 0x74, 0x02, 0x2b,
+    0x02, 0xad, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x27, 0x00, 0x2d,
+    0x00, 0x45, 0x00, 0x46, 0x00, 0x4d, 0x00, 0x52, 0x00, 0x61, 0x00, 0x63,
+    0x00, 0x66, 0x00, 0x70, 0x00, 0x72, 0x00, 0x7b, 0x00, 0x9e, 0x00, 0xa0,
+    0x00, 0xa1, 0x00, 0xa9, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0xd4, 0x00, 0xd5,
+    0x00, 0xda, 0x00, 0xdb, 0x00, 0xe5, 0x02, 0x38, 0x02, 0x20, 0x02, 0x39,
+    0x02, 0xbc, 0x02, 0x31, 0x03, 0x03, 0x00, 0xeb, 0x01, 0x06, 0x01, 0x08,
+    0x01, 0x0f, 0x01, 0x15, 0x01, 0x2f, 0x01, 0x30, 0x01, 0x37, 0x01, 0x3c,
+    0x01, 0x4c, 0x01, 0x4f, 0x01, 0x52, 0x01, 0x5b, 0x01, 0x5d, 0x01, 0x66,
+    0x01, 0x89, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xaa,
+    0x01, 0xc1, 0x01, 0xc2, 0x01, 0xc7, 0x01, 0xc8, 0x01, 0xd2, 0x02, 0x36,
+    0x02, 0xb5, 0x02, 0x37, 0x02, 0x7a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x1a,
+    0x00, 0x23, 0x00, 0x2e, 0x00, 0x7a, 0x00, 0x85, 0x00, 0xc2, 0x00, 0xec,
+    0x00, 0xfc, 0x00, 0xf3, 0x00, 0xfa, 0x01, 0x03, 0x01, 0x01, 0x01, 0x0b,
+    0x01, 0x16, 0x01, 0x24, 0x01, 0x1a, 0x01, 0x21, 0x01, 0x3e, 0x01, 0x46,
+    0x01, 0x40, 0x01, 0x42, 0x01, 0x65, 0x01, 0x67, 0x01, 0x74, 0x01, 0x69,
+    0x01, 0x70, 0x01, 0x84, 0x01, 0xab, 0x01, 0xb1, 0x01, 0xad, 0x01, 0xaf,
+    0x02, 0xb7, 0x02, 0xb4, 0x02, 0x54, 0x02, 0x66, 0x02, 0xb0, 0x02, 0x22,
+    0x02, 0xaf, 0x01, 0xa1, 0x02, 0xb2, 0x02, 0xb1, 0x02, 0xb3, 0x02, 0xfc,
+    0x03, 0x01, 0x02, 0x73, 0x00, 0x1d, 0x00, 0x97, 0x02, 0x7c, 0x02, 0x78,
+    0x02, 0x77, 0x02, 0x76, 0x02, 0x68, 0x02, 0x84, 0x02, 0x85, 0x02, 0x82,
+    0x02, 0x81, 0x00, 0x00, 0x02, 0x7e, 0x01, 0xdb, 0x01, 0xdc, 0x00, 0x00,
+    0x01, 0x04, 0x01, 0x82, 0x02, 0x2c, 0x02, 0x27, 0x02, 0x7b, 0x02, 0x83,
+    0x02, 0x5a, 0x02, 0x79, 0x02, 0x80, 0x02, 0x43, 0x02, 0x44, 0x02, 0x25,
+    0x02, 0x50, 0x00, 0x15, 0x00, 0x1c, 0x00, 0x99, 0x00, 0x9d, 0x01, 0x88,
+    0x02, 0x3d, 0x02, 0x3c, 0x02, 0x48, 0x02, 0x49, 0x02, 0x4a, 0x02, 0x4b,
+    0x02, 0x71, 0x02, 0xa0, 0x01, 0xcb, 0x00, 0xde, 0x02, 0x13, 0x02, 0x59,
+    0x02, 0x45, 0x02, 0x46, 0x01, 0xd9, 0x01, 0xda, 0x02, 0xb9, 0x02, 0x21,
+    0x02, 0x4c, 0x02, 0x47, 0x02, 0x87, 0x00, 0x0c, 0x00, 0x32, 0x00, 0x05,
+    0x00, 0x39, 0x00, 0x3c, 0x00, 0x53, 0x00, 0x55, 0x00, 0x57, 0x00, 0x5b,
+    0x00, 0x7c, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x89, 0x00, 0xbe, 0x00, 0xc0,
+    0x00, 0xc4, 0x01, 0x3d, 0x03, 0x00, 0x03, 0x08, 0x03, 0x05, 0x02, 0xfd,
+    0x03, 0x02, 0x03, 0x07, 0x02, 0xff, 0x03, 0x04, 0x03, 0x06, 0x02, 0xfe,
+    0x00, 0x04, 0x09, 0x0c, 0x00, 0x00, 0x01, 0x08, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x2f, 0x00, 0x7e, 0x01, 0x31,
+    0x01, 0x48, 0x01, 0x7e, 0x01, 0x8f, 0x01, 0x92, 0x01, 0x98, 0x01, 0xa1,
+    0x01, 0xb0, 0x01, 0xb9, 0x01, 0xc9, 0x01, 0xe7, 0x01, 0xeb, 0x02, 0x1b,
+    0x02, 0x2d, 0x02, 0x33, 0x02, 0x37, 0x02, 0x4d, 0x02, 0x59, 0x02, 0x7b,
+    0x02, 0x98, 0x02, 0x9a, 0x02, 0xbc, 0x02, 0xbf, 0x02, 0xcc, 0x02, 0xdd,
+    0x03, 0x04, 0x03, 0x0c, 0x03, 0x0f, 0x03, 0x12, 0x03, 0x1b, 0x03, 0x24,
+    0x03, 0x28, 0x03, 0x2e, 0x03, 0x31, 0x03, 0x36, 0x03, 0x75, 0x1e, 0x09,
+    0x1e, 0x0f, 0x1e, 0x17, 0x1e, 0x1d, 0x1e, 0x21, 0x1e, 0x25, 0x1e, 0x2b,
+    0x1e, 0x2f, 0x1e, 0x37, 0x1e, 0x3b, 0x1e, 0x49, 0x1e, 0x53, 0x1e, 0x5b,
+    0x1e, 0x69, 0x1e, 0x6f, 0x1e, 0x7b, 0x1e, 0x85, 0x1e, 0x8f, 0x1e, 0x93,
+    0x1e, 0x97, 0x1e, 0x9e, 0x1e, 0xf9, 0x20, 0x0b, 0x20, 0x10, 0x20, 0x15,
+    0x20, 0x1a, 0x20, 0x1e, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30, 0x20, 0x33,
+    0x20, 0x3a, 0x20, 0x44, 0x20, 0x70, 0x20, 0x79, 0x20, 0x7b, 0x20, 0x7f,
+    0x20, 0x89, 0x20, 0xa1, 0x20, 0xa4, 0x20, 0xa7, 0x20, 0xa9, 0x20, 0xad,
+    0x20, 0xb2, 0x20, 0xb5, 0x20, 0xba, 0x20, 0xbd, 0x21, 0x13, 0x21, 0x16,
+    0x21, 0x22, 0x21, 0x24, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x99, 0x21, 0xe6,
+    0x21, 0xea, 0x22, 0x02, 0x22, 0x06, 0x22, 0x08, 0x22, 0x0f, 0x22, 0x12,
+    0x22, 0x15, 0x22, 0x17, 0x22, 0x1a, 0x22, 0x1e, 0x22, 0x2b, 0x22, 0x48,
+    0x22, 0x60, 0x22, 0x65, 0x22, 0x95, 0x23, 0x02, 0x23, 0x18, 0x23, 0x27,
+    0x23, 0x2b, 0x23, 0x8b, 0x23, 0xce, 0x24, 0x23, 0x25, 0xc7, 0x25, 0xcb,
+    0x25, 0xcf, 0x26, 0x3b, 0x26, 0x60, 0x26, 0x63, 0x26, 0x66, 0x27, 0x15,
+    0x27, 0x18, 0x2b, 0x07, 0x2b, 0x95, 0x2e, 0x12, 0xfb, 0x02, 0xff, 0xfd,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x20, 0x00, 0x30,
+    0x00, 0xa0, 0x01, 0x34, 0x01, 0x4a, 0x01, 0x8f, 0x01, 0x92, 0x01, 0x98,
+    0x01, 0xa0, 0x01, 0xaf, 0x01, 0xb8, 0x01, 0xc7, 0x01, 0xe6, 0x01, 0xea,
+    0x01, 0xfa, 0x02, 0x2a, 0x02, 0x30, 0x02, 0x37, 0x02, 0x4d, 0x02, 0x59,
+    0x02, 0x7b, 0x02, 0x98, 0x02, 0x9a, 0x02, 0xb9, 0x02, 0xbe, 0x02, 0xc6,
+    0x02, 0xd8, 0x03, 0x00, 0x03, 0x06, 0x03, 0x0f, 0x03, 0x11, 0x03, 0x1b,
+    0x03, 0x23, 0x03, 0x26, 0x03, 0x2e, 0x03, 0x31, 0x03, 0x35, 0x03, 0x75,
+    0x1e, 0x08, 0x1e, 0x0c, 0x1e, 0x14, 0x1e, 0x1c, 0x1e, 0x20, 0x1e, 0x24,
+    0x1e, 0x2a, 0x1e, 0x2e, 0x1e, 0x36, 0x1e, 0x3a, 0x1e, 0x42, 0x1e, 0x4c,
+    0x1e, 0x5a, 0x1e, 0x5e, 0x1e, 0x6c, 0x1e, 0x78, 0x1e, 0x80, 0x1e, 0x8e,
+    0x1e, 0x92, 0x1e, 0x97, 0x1e, 0x9e, 0x1e, 0xa0, 0x20, 0x07, 0x20, 0x10,
+    0x20, 0x12, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x20, 0x20, 0x26, 0x20, 0x30,
+    0x20, 0x32, 0x20, 0x39, 0x20, 0x44, 0x20, 0x70, 0x20, 0x74, 0x20, 0x7b,
+    0x20, 0x7f, 0x20, 0x80, 0x20, 0xa1, 0x20, 0xa3, 0x20, 0xa6, 0x20, 0xa9,
+    0x20, 0xab, 0x20, 0xb1, 0x20, 0xb5, 0x20, 0xb9, 0x20, 0xbc, 0x21, 0x13,
+    0x21, 0x16, 0x21, 0x22, 0x21, 0x24, 0x21, 0x26, 0x21, 0x2e, 0x21, 0x90,
+    0x21, 0xe6, 0x21, 0xe7, 0x22, 0x02, 0x22, 0x05, 0x22, 0x08, 0x22, 0x0f,
+    0x22, 0x11, 0x22, 0x15, 0x22, 0x17, 0x22, 0x19, 0x22, 0x1e, 0x22, 0x2b,
+    0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x22, 0x95, 0x23, 0x02, 0x23, 0x18,
+    0x23, 0x25, 0x23, 0x2b, 0x23, 0x8b, 0x23, 0xce, 0x24, 0x23, 0x25, 0xc6,
+    0x25, 0xca, 0x25, 0xcf, 0x26, 0x39, 0x26, 0x60, 0x26, 0x63, 0x26, 0x65,
+    0x27, 0x13, 0x27, 0x17, 0x2b, 0x05, 0x2b, 0x95, 0x2e, 0x12, 0xfb, 0x01,
+    0xff, 0xfd, 0xff, 0xff, 0x00, 0x01, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x26, 0x00, 0xc8, 0xfe, 0xcd,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0xff, 0x48, 0xfe, 0xd4,
+    0xff, 0x17, 0xfe, 0x6f, 0xfe, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0xff, 0xc8, 0xff, 0xc0,
+    0xff, 0xb9, 0xff, 0xb8, 0xff, 0xb3, 0xff, 0xb1, 0xff, 0xae, 0xff, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xe3, 0x10, 0xe2, 0x16, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x31,
+    0x00, 0x00, 0xe2, 0x32, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xff, 0xe2, 0x57,
+    0xe2, 0x95, 0xe2, 0x0c, 0xe1, 0xcf, 0xe1, 0x99, 0xe1, 0x99, 0xe1, 0xf2,
+    0xe1, 0x5e, 0xe1, 0x6b, 0xe1, 0xb4, 0x00, 0x00, 0xe1, 0xbb, 0xe1, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0xe1, 0x9e, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5,
+    0xe1, 0xa4, 0xe1, 0x91, 0xe0, 0xba, 0xe1, 0x59, 0xe1, 0x8d, 0x00, 0x00,
+    0xe0, 0xb1, 0x00, 0x00, 0xe0, 0x83, 0x00, 0x00, 0xe0, 0x64, 0xe0, 0x72,
+    0x00, 0x00, 0xe0, 0x56, 0xe0, 0x52, 0x00, 0x00, 0xe0, 0x5e, 0xe0, 0x53,
+    0xe0, 0x31, 0xe0, 0x13, 0x00, 0x00, 0xdf, 0xf3, 0xdf, 0xbd, 0xdf, 0xad,
+    0x00, 0x00, 0xdf, 0x97, 0xdf, 0x33, 0xde, 0xf8, 0xde, 0x9a, 0xdc, 0xd8,
+    0x00, 0x00, 0xdc, 0xcd, 0xdc, 0x68, 0xdc, 0x44, 0xdc, 0x42, 0xdc, 0x41,
+    0xdb, 0x95, 0xdb, 0x94, 0x00, 0x00, 0xd7, 0x04, 0xd4, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 0x22,
+    0x01, 0xbe, 0x02, 0xe0, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x6a, 0x03, 0x6c, 0x03, 0x6e, 0x03, 0x70, 0x03, 0x74, 0x03, 0x76,
+    0x03, 0x78, 0x03, 0xba, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xba, 0x03, 0xc0, 0x03, 0xc2,
+    0x03, 0xce, 0x03, 0xd8, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xda, 0x03, 0xdc, 0x03, 0xe2, 0x03, 0xe8, 0x03, 0xea, 0x03, 0xec,
+    0x03, 0xee, 0x03, 0xf0, 0x03, 0xf2, 0x03, 0xf4, 0x03, 0xf6, 0x04, 0x04,
+    0x04, 0x12, 0x04, 0x14, 0x04, 0x2a, 0x04, 0x30, 0x04, 0x36, 0x04, 0x40,
+    0x04, 0x42, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x04, 0xf2, 0x00, 0x00,
+    0x04, 0xf8, 0x00, 0x00, 0x04, 0xfc, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xee, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xec, 0x04, 0xf0, 0x00, 0x00, 0x04, 0xf0, 0x04, 0xf2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe8,
+    0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x04, 0xdc,
+    0x04, 0xde, 0x00, 0x00, 0x00, 0x03, 0x02, 0x26, 0x02, 0x2d, 0x02, 0x29,
+    0x02, 0x57, 0x02, 0x86, 0x02, 0xae, 0x02, 0x2e, 0x02, 0x3a, 0x02, 0x3b,
+    0x02, 0x1f, 0x02, 0x6e, 0x02, 0x24, 0x02, 0x40, 0x02, 0x2a, 0x02, 0x30,
+    0x01, 0xdf, 0x01, 0xe0, 0x01, 0xe1, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe4,
+    0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x02, 0x23, 0x02, 0x2f,
+    0x02, 0x75, 0x02, 0x72, 0x02, 0x74, 0x02, 0x2b, 0x02, 0xad, 0x00, 0x04,
+    0x00, 0x1f, 0x00, 0x20, 0x00, 0x27, 0x00, 0x2d, 0x00, 0x45, 0x00, 0x46,
+    0x00, 0x4d, 0x00, 0x52, 0x00, 0x61, 0x00, 0x63, 0x00, 0x66, 0x00, 0x70,
+    0x00, 0x72, 0x00, 0x7b, 0x00, 0x9e, 0x00, 0xa0, 0x00, 0xa1, 0x00, 0xa9,
+    0x00, 0xb6, 0x00, 0xbd, 0x00, 0xd4, 0x00, 0xd5, 0x00, 0xda, 0x00, 0xdb,
+    0x00, 0xe5, 0x02, 0x38, 0x02, 0x20, 0x02, 0x39, 0x02, 0xbc, 0x02, 0x31,
+    0x03, 0x03, 0x00, 0xeb, 0x01, 0x06, 0x01, 0x08, 0x01, 0x0f, 0x01, 0x15,
+    0x01, 0x2f, 0x01, 0x30, 0x01, 0x37, 0x01, 0x3c, 0x01, 0x4c, 0x01, 0x4f,
+    0x01, 0x52, 0x01, 0x5b, 0x01, 0x5d, 0x01, 0x66, 0x01, 0x89, 0x01, 0x8b,
+    0x01, 0x8c, 0x01, 0x96, 0x01, 0xa2, 0x01, 0xaa, 0x01, 0xc1, 0x01, 0xc2,
+    0x01, 0xc7, 0x01, 0xc8, 0x01, 0xd2, 0x02, 0x36, 0x02, 0xb5, 0x02, 0x37,
+    0x02, 0x7a, 0x02, 0x50, 0x02, 0x27, 0x02, 0x54, 0x02, 0x66, 0x02, 0x56,
+    0x02, 0x68, 0x02, 0xb6, 0x02, 0xb0, 0x03, 0x01, 0x02, 0xb1, 0x01, 0xdb,
+    0x02, 0x43, 0x02, 0x7b, 0x02, 0x42, 0x02, 0xb2, 0x03, 0x05, 0x02, 0xb4,
+    0x02, 0x78, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0xfc, 0x02, 0x84, 0x02, 0xaf,
+    0x02, 0x21, 0x02, 0xff, 0x02, 0x0a, 0x01, 0xdc, 0x02, 0x44, 0x02, 0x15,
+    0x02, 0x14, 0x02, 0x16, 0x02, 0x2c, 0x00, 0x15, 0x00, 0x05, 0x00, 0x0c,
+    0x00, 0x1c, 0x00, 0x13, 0x00, 0x1a, 0x00, 0x1d, 0x00, 0x23, 0x00, 0x3c,
+    0x00, 0x2e, 0x00, 0x32, 0x00, 0x39, 0x00, 0x5b, 0x00, 0x53, 0x00, 0x55,
+    0x00, 0x57, 0x00, 0x28, 0x00, 0x7a, 0x00, 0x89, 0x00, 0x7c, 0x00, 0x7e,
+    0x00, 0x99, 0x00, 0x85, 0x02, 0x70, 0x00, 0x97, 0x00, 0xc4, 0x00, 0xbe,
+    0x00, 0xc0, 0x00, 0xc2, 0x00, 0xdc, 0x00, 0x9f, 0x01, 0xa1, 0x00, 0xfc,
+    0x00, 0xec, 0x00, 0xf3, 0x01, 0x03, 0x00, 0xfa, 0x01, 0x01, 0x01, 0x04,
+    0x01, 0x0b, 0x01, 0x24, 0x01, 0x16, 0x01, 0x1a, 0x01, 0x21, 0x01, 0x46,
+    0x01, 0x3e, 0x01, 0x40, 0x01, 0x42, 0x01, 0x10, 0x01, 0x65, 0x01, 0x74,
+    0x01, 0x67, 0x01, 0x69, 0x01, 0x84, 0x01, 0x70, 0x02, 0x71, 0x01, 0x82,
+    0x01, 0xb1, 0x01, 0xab, 0x01, 0xad, 0x01, 0xaf, 0x01, 0xc9, 0x01, 0x8a,
+    0x01, 0xcb, 0x00, 0x18, 0x00, 0xff, 0x00, 0x06, 0x00, 0xed, 0x00, 0x19,
+    0x01, 0x00, 0x00, 0x21, 0x01, 0x09, 0x00, 0x25, 0x01, 0x0d, 0x00, 0x26,
+    0x01, 0x0e, 0x00, 0x22, 0x01, 0x0a, 0x00, 0x29, 0x01, 0x11, 0x00, 0x2a,
+    0x01, 0x12, 0x00, 0x3f, 0x01, 0x27, 0x00, 0x2f, 0x01, 0x17, 0x00, 0x3a,
+    0x01, 0x22, 0x00, 0x42, 0x01, 0x2a, 0x00, 0x30, 0x01, 0x18, 0x00, 0x49,
+    0x01, 0x33, 0x00, 0x47, 0x01, 0x31, 0x00, 0x4b, 0x01, 0x35, 0x00, 0x4a,
+    0x01, 0x34, 0x00, 0x50, 0x01, 0x3a, 0x00, 0x4e, 0x01, 0x38, 0x00, 0x60,
+    0x01, 0x4b, 0x00, 0x5e, 0x01, 0x49, 0x00, 0x54, 0x01, 0x3f, 0x00, 0x5f,
+    0x01, 0x4a, 0x00, 0x59, 0x01, 0x3d, 0x00, 0x62, 0x01, 0x4e, 0x00, 0x64,
+    0x01, 0x50, 0x01, 0x51, 0x00, 0x68, 0x01, 0x53, 0x00, 0x6a, 0x01, 0x55,
+    0x00, 0x69, 0x01, 0x54, 0x00, 0x6b, 0x01, 0x56, 0x00, 0x6f, 0x01, 0x5a,
+    0x00, 0x73, 0x01, 0x5e, 0x00, 0x75, 0x01, 0x60, 0x00, 0x74, 0x01, 0x5f,
+    0x00, 0x78, 0x01, 0x63, 0x00, 0x93, 0x01, 0x7e, 0x00, 0x7d, 0x01, 0x68,
+    0x00, 0x91, 0x01, 0x7c, 0x00, 0x9d, 0x01, 0x88, 0x00, 0xa2, 0x01, 0x8d,
+    0x00, 0xa4, 0x01, 0x8f, 0x00, 0xa3, 0x01, 0x8e, 0x00, 0xaa, 0x01, 0x97,
+    0x00, 0xaf, 0x01, 0x9c, 0x00, 0xae, 0x01, 0x9b, 0x00, 0xac, 0x01, 0x99,
+    0x00, 0xb9, 0x01, 0xa5, 0x00, 0xb8, 0x01, 0xa4, 0x00, 0xb7, 0x01, 0xa3,
+    0x00, 0xd2, 0x01, 0xbf, 0x00, 0xce, 0x01, 0xbb, 0x00, 0xbf, 0x01, 0xac,
+    0x00, 0xd1, 0x01, 0xbe, 0x00, 0xcc, 0x01, 0xb9, 0x00, 0xd0, 0x01, 0xbd,
+    0x00, 0xd7, 0x01, 0xc4, 0x00, 0xdd, 0x01, 0xca, 0x00, 0xde, 0x00, 0xe6,
+    0x01, 0xd3, 0x00, 0xe8, 0x01, 0xd5, 0x00, 0xe7, 0x01, 0xd4, 0x00, 0x8b,
+    0x01, 0x76, 0x00, 0xc6, 0x01, 0xb3, 0x00, 0x44, 0x01, 0x2e, 0x00, 0x67,
+    0x00, 0x6d, 0x01, 0x58, 0x00, 0x48, 0x01, 0x32, 0x00, 0x96, 0x01, 0x81,
+    0x00, 0x1b, 0x01, 0x02, 0x00, 0x1e, 0x01, 0x05, 0x00, 0x98, 0x01, 0x83,
+    0x00, 0x12, 0x00, 0xf9, 0x00, 0x17, 0x00, 0xfe, 0x00, 0x38, 0x01, 0x20,
+    0x00, 0x3e, 0x01, 0x26, 0x00, 0x56, 0x01, 0x41, 0x00, 0x5d, 0x01, 0x48,
+    0x00, 0x84, 0x01, 0x6f, 0x00, 0x92, 0x01, 0x7d, 0x00, 0xa5, 0x01, 0x90,
+    0x00, 0xa7, 0x01, 0x93, 0x00, 0xc1, 0x01, 0xae, 0x00, 0xcd, 0x01, 0xba,
+    0x00, 0xb0, 0x01, 0x9d, 0x00, 0xba, 0x01, 0xa6, 0x00, 0x86, 0x01, 0x71,
+    0x00, 0x9c, 0x01, 0x87, 0x00, 0x87, 0x01, 0x72, 0x00, 0xe3, 0x01, 0xd0,
+    0x02, 0xf6, 0x02, 0xf3, 0x02, 0xf2, 0x02, 0xf1, 0x02, 0xf8, 0x02, 0xf7,
+    0x03, 0x00, 0x02, 0xfe, 0x02, 0xfb, 0x02, 0xf4, 0x02, 0xf9, 0x02, 0xf5,
+    0x02, 0xfa, 0x02, 0xfd, 0x03, 0x02, 0x03, 0x07, 0x03, 0x06, 0x03, 0x08,
+    0x03, 0x04, 0x02, 0xcd, 0x02, 0xce, 0x02, 0xd1, 0x02, 0xd5, 0x02, 0xd6,
+    0x02, 0xd3, 0x02, 0xcc, 0x02, 0xcb, 0x02, 0xd7, 0x02, 0xd4, 0x02, 0xcf,
+    0x02, 0xd2, 0x00, 0x24, 0x01, 0x0c, 0x00, 0x2b, 0x01, 0x13, 0x00, 0x2c,
+    0x01, 0x14, 0x00, 0x41, 0x01, 0x29, 0x00, 0x40, 0x01, 0x28, 0x00, 0x31,
+    0x01, 0x19, 0x00, 0x4c, 0x01, 0x36, 0x00, 0x51, 0x01, 0x3b, 0x00, 0x4f,
+    0x01, 0x39, 0x00, 0x58, 0x01, 0x43, 0x00, 0x6c, 0x01, 0x57, 0x00, 0x6e,
+    0x01, 0x59, 0x00, 0x71, 0x01, 0x5c, 0x00, 0x76, 0x01, 0x61, 0x00, 0x77,
+    0x01, 0x62, 0x00, 0x79, 0x01, 0x64, 0x00, 0x9a, 0x01, 0x85, 0x00, 0x9b,
+    0x01, 0x86, 0x00, 0x95, 0x01, 0x80, 0x00, 0x94, 0x01, 0x7f, 0x00, 0xa6,
+    0x01, 0x91, 0x00, 0xa8, 0x01, 0x94, 0x00, 0xb1, 0x01, 0x9e, 0x00, 0xb2,
+    0x01, 0x9f, 0x00, 0xab, 0x01, 0x98, 0x00, 0xad, 0x01, 0x9a, 0x00, 0xb3,
+    0x01, 0xa0, 0x00, 0xbb, 0x01, 0xa8, 0x00, 0xbc, 0x01, 0xa9, 0x00, 0xd3,
+    0x01, 0xc0, 0x00, 0xcf, 0x01, 0xbc, 0x00, 0xd9, 0x01, 0xc6, 0x00, 0xd6,
+    0x01, 0xc3, 0x00, 0xd8, 0x01, 0xc5, 0x00, 0xdf, 0x01, 0xcc, 0x00, 0xe9,
+    0x01, 0xd6, 0x00, 0x14, 0x00, 0xfb, 0x00, 0x16, 0x00, 0xfd, 0x00, 0x0d,
+    0x00, 0xf4, 0x00, 0x0f, 0x00, 0xf6, 0x00, 0x10, 0x00, 0xf7, 0x00, 0x11,
+    0x00, 0xf8, 0x00, 0x0e, 0x00, 0xf5, 0x00, 0x07, 0x00, 0xee, 0x00, 0x09,
+    0x00, 0xf0, 0x00, 0x0a, 0x00, 0xf1, 0x00, 0x0b, 0x00, 0xf2, 0x00, 0x08,
+    0x00, 0xef, 0x00, 0x3b, 0x01, 0x23, 0x00, 0x3d, 0x01, 0x25, 0x00, 0x43,
+    0x01, 0x2c, 0x00, 0x33, 0x01, 0x1b, 0x00, 0x35, 0x01, 0x1d, 0x00, 0x36,
+    0x01, 0x1e, 0x00, 0x37, 0x01, 0x1f, 0x00, 0x34, 0x01, 0x1c, 0x00, 0x5c,
+    0x01, 0x47, 0x00, 0x5a, 0x01, 0x45, 0x00, 0x88, 0x01, 0x73, 0x00, 0x8a,
+    0x01, 0x75, 0x00, 0x7f, 0x01, 0x6a, 0x00, 0x81, 0x01, 0x6c, 0x00, 0x82,
+    0x01, 0x6d, 0x00, 0x83, 0x01, 0x6e, 0x00, 0x80, 0x01, 0x6b, 0x00, 0x8c,
+    0x01, 0x77, 0x00, 0x8e, 0x01, 0x79, 0x00, 0x8f, 0x01, 0x7a, 0x00, 0x90,
+    0x01, 0x7b, 0x00, 0x8d, 0x01, 0x78, 0x00, 0xc3, 0x01, 0xb0, 0x00, 0xc5,
+    0x01, 0xb2, 0x00, 0xc7, 0x01, 0xb4, 0x00, 0xc9, 0x01, 0xb6, 0x00, 0xca,
+    0x01, 0xb7, 0x00, 0xcb, 0x01, 0xb8, 0x00, 0xc8, 0x01, 0xb5, 0x00, 0xe1,
+    0x01, 0xce, 0x00, 0xe0, 0x01, 0xcd, 0x00, 0xe2, 0x01, 0xcf, 0x00, 0xe4,
+    0x01, 0xd1, 0x02, 0x4d, 0x02, 0x4f, 0x02, 0x51, 0x02, 0x4e, 0x02, 0x52,
+    0x02, 0x3e, 0x02, 0x3d, 0x02, 0x3c, 0x02, 0x3f, 0x02, 0x48, 0x02, 0x49,
+    0x02, 0x47, 0x02, 0xb7, 0x02, 0xb9, 0x02, 0x22, 0x02, 0x5b, 0x02, 0x5e,
+    0x02, 0x58, 0x02, 0x59, 0x02, 0x5d, 0x02, 0x63, 0x02, 0x5c, 0x02, 0x65,
+    0x02, 0x5f, 0x02, 0x60, 0x02, 0x64, 0x02, 0x90, 0x02, 0x8a, 0x02, 0x8c,
+    0x02, 0x8e, 0x02, 0x92, 0x02, 0x93, 0x02, 0x91, 0x02, 0x8b, 0x02, 0x8d,
+    0x02, 0x8f, 0x02, 0x94, 0x02, 0x95, 0x02, 0x96, 0x02, 0xc0, 0x02, 0x7d,
+    0x02, 0x80, 0x02, 0x82, 0x02, 0x6f, 0x02, 0x6a, 0x02, 0x83, 0x02, 0x77,
+    0x02, 0x76, 0x02, 0xc4, 0x02, 0xc3, 0x02, 0xc1, 0x02, 0xa0, 0x02, 0x9d,
+    0x02, 0x9b, 0x02, 0x98, 0x02, 0x9a, 0x01, 0xd9, 0x01, 0xda, 0x03, 0x1e,
+    0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x02, 0x7a, 0x00, 0x07,
+    0x00, 0x0a, 0x00, 0x24, 0x40, 0x21, 0x09, 0x04, 0x02, 0x03, 0x48, 0x04,
+    0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x65, 0x02, 0x01, 0x01, 0x01,
+    0x15, 0x01, 0x4c, 0x08, 0x08, 0x08, 0x0a, 0x08, 0x0a, 0x13, 0x11, 0x10,
+    0x05, 0x07, 0x17, 0x2b, 0x25, 0x23, 0x07, 0x23, 0x13, 0x33, 0x13, 0x23,
+    0x27, 0x27, 0x07, 0x01, 0x5d, 0xc9, 0x3f, 0x45, 0xe6, 0x08, 0xe6, 0x48,
+    0x51, 0x52, 0x52, 0xb6, 0xb6, 0x02, 0x7a, 0xfd, 0x86, 0xec, 0xee, 0xee,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x86, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xec, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xe8, 0x01, 0xff, 0x00, 0x6f, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x6f, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0xff, 0x60, 0x01, 0xe4, 0x03, 0x13, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4,
+    0x03, 0xbb, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xec,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe7, 0x01, 0xb4, 0x00, 0xa4,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0xa4, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0xb7, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xec, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xd7, 0x01, 0xf9, 0x00, 0xf7, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0xf7, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0x00, 0x00, 0x01, 0xe4, 0x03, 0x94, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xec, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xf0,
+    0x01, 0xe5, 0x00, 0xf7, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0xf7, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x02, 0x1a,
+    0x03, 0x81, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea,
+    0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8, 0x02, 0xa1, 0x00, 0x6a,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x6a, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0xff, 0x60, 0x01, 0xe4, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xea, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0x00, 0x00, 0x01, 0xe4, 0x03, 0xa1, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xea, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe7,
+    0x01, 0xf4, 0x00, 0x8a, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x8a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4,
+    0x03, 0xa2, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea,
+    0x01, 0xf0, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x76, 0x00, 0xe2,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x97, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xf0, 0x01, 0xea, 0x00, 0xfa, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0xfa, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0x00, 0x00, 0x01, 0xe4, 0x03, 0x50, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x27, 0x02, 0xcd, 0x01, 0xa4, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xcd,
+    0x02, 0x44, 0x00, 0xa6, 0x00, 0x10, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x15, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe5, 0x01, 0xf3, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0xff, 0x60, 0x01, 0xe4, 0x02, 0x7a, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7, 0x01, 0xb4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x66, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x03, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x2a, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd9, 0x01, 0xec, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x04, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x10, 0xff, 0x1d, 0x01, 0xe4, 0x02, 0x7a, 0x00, 0x14,
+    0x00, 0x17, 0x00, 0x2f, 0x40, 0x2c, 0x0c, 0x01, 0x01, 0x00, 0x01, 0x4a,
+    0x16, 0x11, 0x02, 0x03, 0x48, 0x06, 0x05, 0x02, 0x01, 0x47, 0x04, 0x01,
+    0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x65, 0x02, 0x01, 0x01, 0x01, 0x15,
+    0x01, 0x4c, 0x15, 0x15, 0x15, 0x17, 0x15, 0x17, 0x13, 0x11, 0x1d, 0x05,
+    0x07, 0x17, 0x2b, 0x04, 0x06, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x37, 0x27, 0x23, 0x07, 0x23, 0x13, 0x33, 0x13, 0x23,
+    0x27, 0x27, 0x07, 0x01, 0xaa, 0x2c, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x31,
+    0x2f, 0x3f, 0xc9, 0x3f, 0x45, 0xe6, 0x08, 0xe6, 0x14, 0x85, 0x52, 0x52,
+    0x1e, 0x42, 0x1b, 0x16, 0x1e, 0x04, 0x30, 0x07, 0x2e, 0x25, 0x23, 0x47,
+    0x20, 0xb5, 0xb6, 0x02, 0x7a, 0xfd, 0x86, 0xec, 0xee, 0xee, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4, 0x03, 0x1b, 0x00, 0x12,
+    0x00, 0x1e, 0x00, 0x21, 0x00, 0x37, 0x40, 0x34, 0x20, 0x10, 0x04, 0x03,
+    0x06, 0x04, 0x01, 0x4a, 0x00, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x67,
+    0x07, 0x01, 0x06, 0x00, 0x00, 0x01, 0x06, 0x00, 0x66, 0x00, 0x04, 0x04,
+    0x16, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x1f, 0x1f, 0x1f,
+    0x21, 0x1f, 0x21, 0x24, 0x22, 0x16, 0x26, 0x11, 0x10, 0x08, 0x07, 0x1a,
+    0x2b, 0x25, 0x23, 0x07, 0x23, 0x13, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x13, 0x23, 0x02, 0x16, 0x33, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x13, 0x27, 0x07, 0x01,
+    0x5d, 0xc9, 0x3f, 0x45, 0xe1, 0x23, 0x30, 0x37, 0x25, 0x25, 0x36, 0x2f,
+    0x23, 0xe1, 0x48, 0xcb, 0x19, 0x11, 0x11, 0x18, 0x18, 0x11, 0x12, 0x18,
+    0x7a, 0x52, 0x52, 0xb6, 0xb6, 0x02, 0x6b, 0x04, 0x32, 0x22, 0x24, 0x34,
+    0x34, 0x25, 0x21, 0x32, 0x04, 0xfd, 0x95, 0x02, 0xb0, 0x1a, 0x1a, 0x13,
+    0x14, 0x1a, 0x1a, 0x14, 0xfe, 0x29, 0xee, 0xee, 0x00, 0x04, 0x00, 0x10,
+    0x00, 0x00, 0x01, 0xe4, 0x03, 0xc3, 0x00, 0x03, 0x00, 0x16, 0x00, 0x22,
+    0x00, 0x25, 0x00, 0x3d, 0x40, 0x3a, 0x24, 0x14, 0x08, 0x03, 0x06, 0x04,
+    0x01, 0x4a, 0x03, 0x02, 0x01, 0x03, 0x02, 0x48, 0x00, 0x02, 0x00, 0x05,
+    0x04, 0x02, 0x05, 0x67, 0x07, 0x01, 0x06, 0x00, 0x00, 0x01, 0x06, 0x00,
+    0x66, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x15, 0x01,
+    0x4c, 0x23, 0x23, 0x23, 0x25, 0x23, 0x25, 0x24, 0x22, 0x16, 0x26, 0x11,
+    0x14, 0x08, 0x07, 0x1a, 0x2b, 0x13, 0x27, 0x37, 0x17, 0x13, 0x23, 0x07,
+    0x23, 0x13, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x13, 0x23, 0x02, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x13, 0x27, 0x07, 0xb1, 0x17, 0x98, 0x28, 0x03,
+    0xc9, 0x3f, 0x45, 0xe1, 0x23, 0x30, 0x37, 0x25, 0x25, 0x36, 0x2f, 0x23,
+    0xe1, 0x48, 0xcb, 0x19, 0x11, 0x11, 0x18, 0x18, 0x11, 0x12, 0x18, 0x7a,
+    0x52, 0x52, 0x03, 0x40, 0x2a, 0x59, 0x46, 0xfd, 0x39, 0xb6, 0x02, 0x6b,
+    0x04, 0x32, 0x22, 0x24, 0x34, 0x34, 0x25, 0x21, 0x32, 0x04, 0xfd, 0x95,
+    0x02, 0xb0, 0x1a, 0x1a, 0x13, 0x14, 0x1a, 0x1a, 0x14, 0xfe, 0x29, 0xee,
+    0xee, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10, 0x00, 0x00, 0x01, 0xe4,
+    0x03, 0x1d, 0x00, 0x22, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xee,
+    0x01, 0xf3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x01, 0xef,
+    0x02, 0x70, 0x00, 0x0f, 0x00, 0x13, 0x00, 0x3d, 0x40, 0x3a, 0x00, 0x02,
+    0x00, 0x03, 0x09, 0x02, 0x03, 0x65, 0x0a, 0x01, 0x09, 0x00, 0x06, 0x04,
+    0x09, 0x06, 0x65, 0x08, 0x01, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x14, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5d, 0x07, 0x01, 0x05, 0x05, 0x15,
+    0x05, 0x4c, 0x10, 0x10, 0x10, 0x13, 0x10, 0x13, 0x12, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x0b, 0x07, 0x1d, 0x2b, 0x13, 0x21, 0x15,
+    0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x35, 0x23, 0x07,
+    0x23, 0x37, 0x11, 0x23, 0x03, 0xd3, 0x01, 0x1c, 0xab, 0x91, 0x91, 0xa9,
+    0xe6, 0x82, 0x36, 0x40, 0xf8, 0x0b, 0x69, 0x02, 0x70, 0x3e, 0xcd, 0x40,
+    0xe7, 0x3e, 0xa9, 0xa9, 0xe3, 0x01, 0x4f, 0xfe, 0xb1, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x01, 0xef, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xf4, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x01, 0xc9, 0x02, 0x6f, 0x00, 0x0e,
+    0x00, 0x16, 0x00, 0x1d, 0x00, 0x3d, 0x40, 0x3a, 0x07, 0x01, 0x05, 0x02,
+    0x01, 0x4a, 0x06, 0x01, 0x02, 0x00, 0x05, 0x04, 0x02, 0x05, 0x65, 0x00,
+    0x03, 0x03, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x4b, 0x07, 0x01, 0x04,
+    0x04, 0x01, 0x5d, 0x00, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x18, 0x17, 0x10,
+    0x0f, 0x1c, 0x1a, 0x17, 0x1d, 0x18, 0x1d, 0x15, 0x13, 0x0f, 0x16, 0x10,
+    0x16, 0x2a, 0x20, 0x08, 0x07, 0x16, 0x2b, 0x13, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x13, 0x32,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x15, 0x13, 0x32, 0x35, 0x34, 0x23, 0x23,
+    0x15, 0x30, 0xb1, 0x68, 0x67, 0x31, 0x2b, 0x34, 0x41, 0x74, 0x75, 0xb0,
+    0xa7, 0x93, 0x42, 0x46, 0x6d, 0x77, 0x93, 0xa4, 0x66, 0x02, 0x6f, 0x51,
+    0x46, 0x2e, 0x4d, 0x0f, 0x12, 0x59, 0x34, 0x52, 0x5d, 0x01, 0x6d, 0x63,
+    0x2d, 0x37, 0xc7, 0xfe, 0xd0, 0x76, 0x7f, 0xf5, 0x00, 0x01, 0x00, 0x29,
+    0xff, 0xf6, 0x01, 0xd5, 0x02, 0x74, 0x00, 0x21, 0x00, 0x30, 0x40, 0x2d,
+    0x1e, 0x1d, 0x0e, 0x0d, 0x0c, 0x0a, 0x06, 0x02, 0x01, 0x01, 0x4a, 0x00,
+    0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00, 0x02, 0x02,
+    0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x00, 0x00, 0x00,
+    0x21, 0x00, 0x20, 0x25, 0x2a, 0x26, 0x05, 0x07, 0x17, 0x2b, 0x16, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07, 0x27,
+    0x37, 0x34, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0xd7, 0x6d, 0x41, 0x46,
+    0x6c, 0x3e, 0x42, 0x61, 0x19, 0x3c, 0x09, 0x03, 0x02, 0x0e, 0x17, 0x34,
+    0x1f, 0x4f, 0x5b, 0x2e, 0x4f, 0x30, 0x25, 0x44, 0x15, 0x34, 0x1f, 0x54,
+    0x3c, 0x0a, 0x45, 0x8e, 0x6b, 0x73, 0x8f, 0x3e, 0x42, 0x39, 0x1c, 0x04,
+    0x07, 0x08, 0x0a, 0x12, 0x1f, 0x19, 0x89, 0x7a, 0x4d, 0x78, 0x42, 0x29,
+    0x23, 0x22, 0x33, 0x33, 0xff, 0xff, 0x00, 0x29, 0xff, 0xf6, 0x01, 0xd5,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xf5, 0x00, 0x00, 0xff, 0xff, 0x00, 0x29, 0xff, 0xf6, 0x01, 0xd5,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x02, 0xeb,
+    0x02, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0xff, 0x3b, 0x01, 0xd5,
+    0x02, 0x74, 0x00, 0x33, 0x00, 0xb3, 0x40, 0x17, 0x27, 0x26, 0x25, 0x23,
+    0x03, 0x02, 0x06, 0x06, 0x05, 0x07, 0x01, 0x02, 0x03, 0x10, 0x01, 0x01,
+    0x02, 0x0f, 0x01, 0x00, 0x01, 0x04, 0x4a, 0x4b, 0xb0, 0x10, 0x50, 0x58,
+    0x40, 0x27, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x70, 0x00, 0x05, 0x05,
+    0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03,
+    0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+    0x28, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00, 0x05, 0x05,
+    0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03,
+    0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x40, 0x25, 0x00, 0x02, 0x03, 0x01,
+    0x03, 0x02, 0x01, 0x7e, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00,
+    0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c, 0x4b, 0x07, 0x01, 0x06,
+    0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x59, 0x59, 0x40,
+    0x0f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x32, 0x2a, 0x25, 0x11, 0x23, 0x23,
+    0x2c, 0x08, 0x07, 0x1a, 0x2b, 0x24, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07,
+    0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37, 0x16, 0x33,
+    0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x26, 0x26, 0x27, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07, 0x27, 0x37, 0x34, 0x27, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x01, 0x3f, 0x44,
+    0x15, 0x34, 0x1b, 0x47, 0x31, 0x05, 0x2a, 0x2b, 0x3c, 0x38, 0x35, 0x2e,
+    0x19, 0x26, 0x31, 0x32, 0x1b, 0x18, 0x1e, 0x0a, 0x66, 0x7d, 0x01, 0x46,
+    0x6c, 0x3e, 0x42, 0x61, 0x19, 0x3c, 0x09, 0x03, 0x02, 0x0e, 0x17, 0x34,
+    0x1f, 0x4f, 0x5b, 0x2e, 0x4f, 0x30, 0x32, 0x29, 0x23, 0x22, 0x2d, 0x32,
+    0x06, 0x26, 0x04, 0x25, 0x18, 0x24, 0x31, 0x1f, 0x2a, 0x1e, 0x24, 0x10,
+    0x11, 0x4b, 0x06, 0xa0, 0x98, 0x73, 0x8f, 0x3e, 0x42, 0x39, 0x1c, 0x04,
+    0x07, 0x08, 0x0a, 0x12, 0x1f, 0x19, 0x89, 0x7a, 0x4d, 0x78, 0x42, 0x00,
+    0x00, 0x02, 0x00, 0x29, 0xff, 0x3b, 0x01, 0xd5, 0x03, 0x17, 0x00, 0x03,
+    0x00, 0x37, 0x00, 0xbf, 0x40, 0x1d, 0x2b, 0x2a, 0x29, 0x27, 0x07, 0x06,
+    0x06, 0x06, 0x05, 0x0b, 0x01, 0x02, 0x03, 0x14, 0x01, 0x01, 0x02, 0x13,
+    0x01, 0x00, 0x01, 0x04, 0x4a, 0x03, 0x02, 0x01, 0x03, 0x04, 0x48, 0x4b,
+    0xb0, 0x10, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02,
+    0x70, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c, 0x4b, 0x07,
+    0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x01,
+    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x4b, 0xb0,
+    0x17, 0x50, 0x58, 0x40, 0x28, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01,
+    0x7e, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c, 0x4b, 0x07,
+    0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x01,
+    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x40, 0x25,
+    0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x63, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c,
+    0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x03,
+    0x4c, 0x59, 0x59, 0x40, 0x15, 0x04, 0x04, 0x04, 0x37, 0x04, 0x36, 0x31,
+    0x2f, 0x25, 0x23, 0x1e, 0x1d, 0x1c, 0x1a, 0x17, 0x15, 0x12, 0x10, 0x08,
+    0x07, 0x14, 0x2b, 0x13, 0x27, 0x37, 0x17, 0x02, 0x36, 0x37, 0x17, 0x06,
+    0x06, 0x07, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37,
+    0x16, 0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x26, 0x26, 0x27,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07, 0x27, 0x37, 0x34,
+    0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0xc5,
+    0x17, 0x98, 0x28, 0x2f, 0x44, 0x15, 0x34, 0x1b, 0x47, 0x31, 0x05, 0x2a,
+    0x2b, 0x3c, 0x38, 0x35, 0x2e, 0x19, 0x26, 0x31, 0x32, 0x1b, 0x18, 0x1e,
+    0x0a, 0x66, 0x7d, 0x01, 0x46, 0x6c, 0x3e, 0x42, 0x61, 0x19, 0x3c, 0x09,
+    0x03, 0x02, 0x0e, 0x17, 0x34, 0x1f, 0x4f, 0x5b, 0x2e, 0x4f, 0x30, 0x02,
+    0x94, 0x2a, 0x59, 0x46, 0xfd, 0x61, 0x29, 0x23, 0x22, 0x2d, 0x32, 0x06,
+    0x26, 0x04, 0x25, 0x18, 0x24, 0x31, 0x1f, 0x2a, 0x1e, 0x24, 0x10, 0x11,
+    0x4b, 0x06, 0xa0, 0x98, 0x73, 0x8f, 0x3e, 0x42, 0x39, 0x1c, 0x04, 0x07,
+    0x08, 0x0a, 0x12, 0x1f, 0x19, 0x89, 0x7a, 0x4d, 0x78, 0x42, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x29, 0xff, 0xf6, 0x01, 0xd5, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea, 0x02, 0x08, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x29, 0xff, 0xf6, 0x01, 0xd5, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6, 0x01, 0xd5, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x36, 0xff, 0xfe, 0x01, 0xcc, 0x02, 0x6f, 0x00, 0x0a,
+    0x00, 0x12, 0x00, 0x26, 0x40, 0x23, 0x00, 0x03, 0x03, 0x00, 0x5d, 0x00,
+    0x00, 0x00, 0x14, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x01, 0x5d, 0x00, 0x01,
+    0x01, 0x15, 0x01, 0x4c, 0x0c, 0x0b, 0x11, 0x0f, 0x0b, 0x12, 0x0c, 0x12,
+    0x26, 0x20, 0x05, 0x07, 0x16, 0x2b, 0x13, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x15, 0x06, 0x06, 0x27, 0x23, 0x37, 0x32, 0x35, 0x26, 0x26, 0x23, 0x23,
+    0x11, 0x36, 0x91, 0x4d, 0x5a, 0x21, 0x3d, 0x06, 0x80, 0x8b, 0x85, 0x82,
+    0xce, 0x01, 0x5c, 0x66, 0x4b, 0x02, 0x6f, 0x29, 0x2c, 0x52, 0x94, 0x97,
+    0x9f, 0x01, 0x37, 0xfa, 0x7f, 0x85, 0xfe, 0x02, 0x00, 0x02, 0x00, 0x1e,
+    0xff, 0xff, 0x01, 0xd2, 0x02, 0x6f, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x36,
+    0x40, 0x33, 0x06, 0x01, 0x01, 0x07, 0x01, 0x00, 0x04, 0x01, 0x00, 0x65,
+    0x00, 0x05, 0x05, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x14, 0x4b, 0x08, 0x01,
+    0x04, 0x04, 0x03, 0x5d, 0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x10, 0x0f,
+    0x1a, 0x19, 0x18, 0x17, 0x16, 0x14, 0x0f, 0x1b, 0x10, 0x1b, 0x26, 0x21,
+    0x11, 0x10, 0x09, 0x07, 0x18, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x11, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x23, 0x23, 0x37, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x4f, 0x31,
+    0x31, 0x8b, 0x80, 0x78, 0x4f, 0x44, 0x26, 0x4b, 0x7f, 0x7c, 0x5f, 0x65,
+    0x5b, 0x5e, 0x47, 0x69, 0x69, 0x01, 0x2d, 0x3a, 0x01, 0x08, 0xa8, 0x95,
+    0x5d, 0xa4, 0x1f, 0x13, 0x3a, 0x82, 0x77, 0x7c, 0x86, 0xcd, 0x3a, 0xf4,
+    0xff, 0xff, 0x00, 0x36, 0xff, 0xff, 0x01, 0xcc, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x02, 0xeb, 0x01, 0xd6, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1e, 0xff, 0xff, 0x01, 0xd2, 0x02, 0x6f, 0x00, 0x02,
+    0x00, 0x28, 0x00, 0x00, 0xff, 0xff, 0x00, 0x36, 0xff, 0x60, 0x01, 0xcc,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc,
+    0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x36, 0xff, 0x65, 0x01, 0xcc,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2,
+    0x01, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9,
+    0x02, 0x70, 0x00, 0x0b, 0x00, 0x29, 0x40, 0x26, 0x00, 0x02, 0x00, 0x03,
+    0x04, 0x02, 0x03, 0x65, 0x00, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00,
+    0x14, 0x4b, 0x00, 0x04, 0x04, 0x05, 0x5d, 0x00, 0x05, 0x05, 0x15, 0x05,
+    0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x13,
+    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x3b,
+    0x01, 0x7e, 0xfe, 0xc4, 0x01, 0x05, 0xfe, 0xfb, 0x01, 0x39, 0xfe, 0x85,
+    0x02, 0x70, 0x3e, 0xcd, 0x40, 0xe7, 0x3e, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0xb9, 0x03, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe8, 0x01, 0xf5, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0xb9, 0x03, 0x13, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xec, 0x02, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0xb9, 0x03, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xeb, 0x02, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0xff, 0x3b, 0x01, 0xb9, 0x03, 0x13, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xdf, 0x01, 0xdf, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec,
+    0x02, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x02, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x02, 0x2e,
+    0x03, 0x81, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea,
+    0x02, 0x07, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8, 0x02, 0xb5, 0x00, 0x6a,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x6a, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0xff, 0x60, 0x01, 0xb9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xea, 0x02, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0xb9, 0x03, 0xa1, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xea, 0x02, 0x08, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe7,
+    0x02, 0x08, 0x00, 0x8a, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x8a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xd6,
+    0x03, 0xa2, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea,
+    0x02, 0x04, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x8a, 0x00, 0xe2,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x97, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea, 0x02, 0x08, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xf0, 0x01, 0xfe, 0x00, 0xfa, 0x00, 0x08, 0xb1, 0x02,
+    0x01, 0xb0, 0xfa, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0xb9, 0x03, 0x50, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x27, 0x02, 0xcd, 0x01, 0xb8, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xcd,
+    0x02, 0x58, 0x00, 0xa6, 0x00, 0x10, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x15, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe5, 0x02, 0x07, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6, 0x01, 0xd5, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0xff, 0x60, 0x01, 0xb9, 0x02, 0x70, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7, 0x01, 0xc8, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x66, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x17, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x2a, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd9, 0x02, 0x00, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x02, 0x08, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9, 0x03, 0xb1, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x27, 0x02, 0xd6, 0x02, 0x08, 0x00, 0xa6,
+    0x01, 0x07, 0x02, 0xe8, 0x01, 0xf5, 0x00, 0x9a, 0x00, 0x10, 0xb1, 0x01,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x01, 0xb0, 0x9a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xb9,
+    0x03, 0xb1, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x27, 0x02, 0xd6,
+    0x02, 0x08, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xe7, 0x01, 0xc8, 0x00, 0x9a,
+    0x00, 0x10, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x02,
+    0x01, 0xb0, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0xff, 0x50, 0x01, 0xb9, 0x02, 0x70, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3b,
+    0x00, 0x00, 0x01, 0xbd, 0x03, 0x1d, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xee, 0x02, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47,
+    0xff, 0xf5, 0x01, 0xad, 0x02, 0x6f, 0x00, 0x1f, 0x00, 0x39, 0x40, 0x36,
+    0x10, 0x01, 0x01, 0x03, 0x1e, 0x1d, 0x02, 0x05, 0x04, 0x02, 0x4a, 0x0b,
+    0x01, 0x03, 0x01, 0x49, 0x00, 0x01, 0x00, 0x04, 0x05, 0x01, 0x04, 0x67,
+    0x00, 0x03, 0x03, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x14, 0x4b, 0x00, 0x05,
+    0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x24, 0x12, 0x11,
+    0x12, 0x16, 0x21, 0x06, 0x07, 0x1a, 0x2b, 0x25, 0x06, 0x23, 0x22, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x27, 0x35, 0x21, 0x15, 0x23, 0x17,
+    0x15, 0x26, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x36,
+    0x27, 0x37, 0x17, 0x01, 0xad, 0x41, 0x60, 0x3f, 0x59, 0x2d, 0x31, 0x58,
+    0x38, 0xb0, 0x01, 0x31, 0xe3, 0xac, 0x5c, 0x67, 0x46, 0x3e, 0x1c, 0x27,
+    0x10, 0x0b, 0x07, 0x01, 0x05, 0x07, 0x3c, 0x47, 0x32, 0x53, 0x32, 0x35,
+    0x5a, 0x37, 0x02, 0xbc, 0x3f, 0x3f, 0xbc, 0x34, 0x05, 0x46, 0x4e, 0x3a,
+    0x46, 0x10, 0x10, 0x0b, 0x0e, 0x09, 0x06, 0x07, 0x00, 0x01, 0x00, 0x4e,
+    0x00, 0x00, 0x01, 0xb5, 0x02, 0x70, 0x00, 0x09, 0x00, 0x23, 0x40, 0x20,
+    0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x65, 0x00, 0x01, 0x01, 0x00,
+    0x5d, 0x00, 0x00, 0x00, 0x14, 0x4b, 0x00, 0x04, 0x04, 0x15, 0x04, 0x4c,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x13, 0x21, 0x15,
+    0x21, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x4e, 0x01, 0x67, 0xfe, 0xdf,
+    0xe9, 0xe9, 0x46, 0x02, 0x70, 0x3d, 0xc4, 0x3d, 0xfe, 0xce, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x23, 0xff, 0xf6, 0x01, 0xcc, 0x02, 0x76, 0x00, 0x23,
+    0x00, 0x3c, 0x40, 0x39, 0x0d, 0x0c, 0x0a, 0x03, 0x04, 0x01, 0x21, 0x1c,
+    0x02, 0x02, 0x03, 0x02, 0x4a, 0x00, 0x04, 0x00, 0x03, 0x02, 0x04, 0x03,
+    0x65, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00,
+    0x02, 0x02, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x1d, 0x05, 0x4c, 0x00,
+    0x00, 0x00, 0x23, 0x00, 0x22, 0x11, 0x13, 0x24, 0x2a, 0x26, 0x07, 0x07,
+    0x19, 0x2b, 0x16, 0x26, 0x26, 0x35, 0x26, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x17, 0x07, 0x07, 0x27, 0x36, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x35, 0x23, 0x35, 0x33, 0x15,
+    0x06, 0x23, 0xcb, 0x6d, 0x3a, 0x01, 0x4a, 0x6c, 0x37, 0x38, 0x68, 0x1a,
+    0x31, 0x08, 0x04, 0x01, 0x07, 0x0b, 0x18, 0x31, 0x22, 0x4b, 0x5d, 0x5b,
+    0x51, 0x1e, 0x42, 0x16, 0x71, 0xb2, 0x59, 0x5e, 0x0a, 0x4e, 0x8e, 0x5e,
+    0x7c, 0x91, 0x39, 0x3a, 0x2f, 0x27, 0x07, 0x06, 0x08, 0x0e, 0x0c, 0x1a,
+    0x17, 0x74, 0x85, 0x80, 0x8b, 0x13, 0x13, 0x94, 0x3d, 0xf4, 0x41, 0x00,
+    0xff, 0xff, 0x00, 0x24, 0xff, 0xf6, 0x01, 0xcc, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec, 0x02, 0x0c, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x24, 0xff, 0xf6, 0x01, 0xcc, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x03, 0x02, 0xeb, 0x02, 0x0c, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x24, 0xff, 0xf6, 0x01, 0xcc, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea, 0x02, 0x0c, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x24, 0xfe, 0xed, 0x01, 0xcc, 0x02, 0x76, 0x00, 0x22,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde, 0x02, 0x12, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x24, 0xff, 0xf6, 0x01, 0xcc, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6, 0x01, 0xd9, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x24, 0xff, 0xf6, 0x01, 0xcc, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x46, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x02, 0x0c, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc1, 0x02, 0x6f, 0x00, 0x13,
+    0x00, 0x21, 0x40, 0x1e, 0x00, 0x01, 0x00, 0x04, 0x03, 0x01, 0x04, 0x66,
+    0x02, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x15, 0x03,
+    0x4c, 0x11, 0x11, 0x15, 0x11, 0x15, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x13,
+    0x33, 0x15, 0x06, 0x06, 0x15, 0x15, 0x33, 0x11, 0x33, 0x15, 0x06, 0x06,
+    0x15, 0x11, 0x23, 0x11, 0x23, 0x11, 0x23, 0x32, 0x52, 0x06, 0x03, 0xf4,
+    0x52, 0x06, 0x03, 0x4a, 0xf3, 0x49, 0x02, 0x6f, 0x07, 0x06, 0x0e, 0x11,
+    0xde, 0x01, 0x0a, 0x07, 0x06, 0x0e, 0x11, 0xfd, 0xbd, 0x01, 0x29, 0xfe,
+    0xd7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc1,
+    0x02, 0x6f, 0x00, 0x13, 0x00, 0x21, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x01,
+    0x00, 0x04, 0x01, 0x66, 0x05, 0x01, 0x03, 0x03, 0x14, 0x4b, 0x02, 0x01,
+    0x00, 0x00, 0x15, 0x00, 0x4c, 0x11, 0x15, 0x11, 0x11, 0x11, 0x14, 0x06,
+    0x07, 0x1a, 0x2b, 0x01, 0x06, 0x06, 0x15, 0x11, 0x23, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15, 0x33, 0x11, 0x33, 0x01,
+    0xc1, 0x06, 0x03, 0x4a, 0xf3, 0x49, 0x52, 0x06, 0x03, 0xf4, 0x52, 0x02,
+    0x68, 0x06, 0x0e, 0x11, 0xfd, 0xbd, 0x01, 0x16, 0xfe, 0xea, 0x02, 0x6f,
+    0x07, 0x06, 0x0e, 0x11, 0xde, 0x01, 0x0a, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0x51, 0x01, 0xc1, 0x02, 0x6f, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe1, 0x01, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xc1, 0x03, 0x17, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xea, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0x60, 0x01, 0xc1, 0x02, 0x6f, 0x00, 0x22, 0x00, 0x4d, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x51,
+    0x00, 0x00, 0x01, 0x93, 0x02, 0x6f, 0x00, 0x0b, 0x00, 0x23, 0x40, 0x20,
+    0x03, 0x01, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x14, 0x4b, 0x04,
+    0x01, 0x00, 0x00, 0x05, 0x5d, 0x00, 0x05, 0x05, 0x15, 0x05, 0x4c, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x37, 0x33, 0x11,
+    0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21, 0x51, 0x7b, 0x74,
+    0x01, 0x35, 0x7b, 0x81, 0xfe, 0xbe, 0x3b, 0x01, 0xf9, 0x3b, 0x3b, 0xfe,
+    0x06, 0x3a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xd6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x13, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec,
+    0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x50, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x27, 0x02, 0xcd,
+    0x01, 0x99, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xcd, 0x02, 0x39, 0x00, 0xa6,
+    0x00, 0x10, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x02,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51,
+    0x00, 0x00, 0x01, 0x93, 0x03, 0x15, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe5, 0x01, 0xe8, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51,
+    0x00, 0x00, 0x01, 0x93, 0x03, 0xa5, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xe5, 0x01, 0xe8, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8,
+    0x01, 0xd4, 0x00, 0x8e, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x8e, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6,
+    0x01, 0xb6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0xff, 0x60, 0x01, 0x93,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc,
+    0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7,
+    0x01, 0xa9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x66, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7,
+    0x01, 0xf8, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x2a, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd9,
+    0x01, 0xe1, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x51, 0x00, 0x00, 0x01, 0x93,
+    0x03, 0x13, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6,
+    0x01, 0xe9, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x51, 0xff, 0x1d, 0x01, 0x93,
+    0x02, 0x6f, 0x00, 0x18, 0x00, 0x29, 0x40, 0x26, 0x18, 0x06, 0x05, 0x03,
+    0x00, 0x47, 0x04, 0x01, 0x02, 0x02, 0x03, 0x5d, 0x00, 0x03, 0x03, 0x14,
+    0x4b, 0x05, 0x01, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x15, 0x00,
+    0x4c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0x06, 0x07, 0x1a, 0x2b, 0x04,
+    0x06, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37,
+    0x21, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15,
+    0x01, 0x6d, 0x2c, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x30, 0x2e, 0xfe, 0xf4,
+    0x7b, 0x74, 0x01, 0x35, 0x7b, 0x81, 0x1e, 0x42, 0x1b, 0x16, 0x1e, 0x04,
+    0x30, 0x07, 0x2e, 0x25, 0x23, 0x46, 0x20, 0x3b, 0x01, 0xf9, 0x3b, 0x3b,
+    0xfe, 0x06, 0x3a, 0x00, 0xff, 0xff, 0x00, 0x50, 0x00, 0x00, 0x01, 0x9a,
+    0x03, 0x51, 0x00, 0x22, 0x00, 0x52, 0x00, 0x00, 0x01, 0x06, 0x03, 0x11,
+    0xeb, 0x24, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x24, 0xb0, 0x33, 0x2b,
+    0x00, 0x01, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xc9, 0x02, 0x6f, 0x00, 0x17,
+    0x00, 0x2e, 0x40, 0x2b, 0x03, 0x01, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x03,
+    0x01, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x14, 0x4b, 0x00, 0x00,
+    0x00, 0x04, 0x5f, 0x05, 0x01, 0x04, 0x04, 0x1d, 0x04, 0x4c, 0x00, 0x00,
+    0x00, 0x17, 0x00, 0x16, 0x11, 0x11, 0x13, 0x28, 0x06, 0x07, 0x18, 0x2b,
+    0x16, 0x27, 0x37, 0x37, 0x17, 0x16, 0x16, 0x17, 0x16, 0x33, 0x32, 0x36,
+    0x35, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x16, 0x06, 0x06, 0x23,
+    0x6a, 0x39, 0x28, 0x07, 0x05, 0x01, 0x08, 0x0c, 0x23, 0x27, 0x33, 0x2d,
+    0x78, 0x01, 0x1d, 0x60, 0x02, 0x2c, 0x4b, 0x2e, 0x0b, 0x45, 0x32, 0x08,
+    0x04, 0x0a, 0x0e, 0x0a, 0x1b, 0x47, 0x56, 0x01, 0x64, 0x3b, 0x3b, 0xfe,
+    0x9d, 0x4c, 0x62, 0x2e, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xe8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x61, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x02, 0x44, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2a, 0xff, 0xfc, 0x01, 0xd7,
+    0x02, 0x74, 0x00, 0x11, 0x00, 0x1f, 0x40, 0x1c, 0x0f, 0x0a, 0x01, 0x03,
+    0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x14, 0x4b, 0x03, 0x01,
+    0x00, 0x00, 0x15, 0x00, 0x4c, 0x12, 0x27, 0x11, 0x12, 0x04, 0x07, 0x18,
+    0x2b, 0x13, 0x07, 0x11, 0x23, 0x11, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15,
+    0x01, 0x16, 0x33, 0x33, 0x03, 0x13, 0x07, 0xa6, 0x31, 0x4b, 0x54, 0x06,
+    0x03, 0x01, 0x04, 0x19, 0x1b, 0x1a, 0xec, 0xfc, 0x5a, 0x01, 0x38, 0x36,
+    0xfe, 0xfe, 0x02, 0x6f, 0x07, 0x06, 0x0e, 0x11, 0xf3, 0x01, 0x24, 0x05,
+    0xfe, 0xf3, 0xfe, 0x9e, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x2a,
+    0xfe, 0xed, 0x01, 0xd7, 0x02, 0x74, 0x00, 0x22, 0x00, 0x63, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xde, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2a,
+    0xff, 0xfc, 0x01, 0xd7, 0x02, 0x73, 0x00, 0x1b, 0x00, 0x31, 0x40, 0x2e,
+    0x1a, 0x12, 0x0b, 0x02, 0x01, 0x05, 0x00, 0x03, 0x01, 0x4a, 0x10, 0x01,
+    0x01, 0x48, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x14,
+    0x4b, 0x05, 0x04, 0x02, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x00, 0x00, 0x00,
+    0x1b, 0x00, 0x1b, 0x36, 0x27, 0x11, 0x13, 0x06, 0x07, 0x18, 0x2b, 0x05,
+    0x03, 0x07, 0x15, 0x23, 0x11, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15, 0x36,
+    0x36, 0x33, 0x32, 0x17, 0x07, 0x15, 0x23, 0x26, 0x26, 0x23, 0x23, 0x22,
+    0x06, 0x07, 0x01, 0x01, 0x7d, 0xd7, 0x31, 0x4b, 0x54, 0x06, 0x03, 0x5c,
+    0x9a, 0x44, 0x14, 0x0f, 0x01, 0x07, 0x08, 0x0e, 0x0e, 0x04, 0x1e, 0x5f,
+    0x55, 0x01, 0x07, 0x04, 0x01, 0x3b, 0x49, 0xee, 0x02, 0x6f, 0x07, 0x06,
+    0x0e, 0x11, 0xfd, 0xa1, 0x8c, 0x04, 0x48, 0x0a, 0x08, 0x07, 0x48, 0x72,
+    0xfe, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x01, 0xb7,
+    0x02, 0x6f, 0x00, 0x09, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x4b, 0x00, 0x01, 0x01, 0x02, 0x5e, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c,
+    0x11, 0x15, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x13, 0x33, 0x15, 0x06, 0x06,
+    0x15, 0x11, 0x21, 0x15, 0x21, 0x42, 0x52, 0x06, 0x03, 0x01, 0x2c, 0xfe,
+    0x8b, 0x02, 0x6f, 0x07, 0x06, 0x0e, 0x11, 0xfd, 0xf9, 0x3c, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x42, 0xff, 0x69, 0x01, 0xc6, 0x02, 0x6f, 0x00, 0x08,
+    0x00, 0x1c, 0x00, 0x64, 0xb6, 0x0b, 0x0a, 0x02, 0x03, 0x02, 0x01, 0x4a,
+    0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x21, 0x00, 0x04, 0x04, 0x00, 0x5d,
+    0x05, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5e, 0x00,
+    0x02, 0x02, 0x15, 0x4b, 0x00, 0x03, 0x03, 0x06, 0x5f, 0x07, 0x01, 0x06,
+    0x06, 0x19, 0x06, 0x4c, 0x1b, 0x40, 0x1e, 0x00, 0x03, 0x07, 0x01, 0x06,
+    0x03, 0x06, 0x63, 0x00, 0x04, 0x04, 0x00, 0x5d, 0x05, 0x01, 0x00, 0x00,
+    0x14, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5e, 0x00, 0x02, 0x02, 0x15, 0x02,
+    0x4c, 0x59, 0x40, 0x0f, 0x09, 0x09, 0x09, 0x1c, 0x09, 0x1b, 0x11, 0x13,
+    0x28, 0x11, 0x14, 0x10, 0x08, 0x07, 0x1a, 0x2b, 0x13, 0x33, 0x14, 0x06,
+    0x15, 0x11, 0x33, 0x15, 0x23, 0x16, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x23, 0x35, 0x33, 0x11, 0x16, 0x06,
+    0x23, 0x42, 0x52, 0x09, 0xaa, 0xf3, 0x84, 0x3b, 0x2f, 0x06, 0x07, 0x06,
+    0x09, 0x2c, 0x1b, 0x31, 0x30, 0x82, 0xc7, 0x03, 0x5f, 0x49, 0x02, 0x6f,
+    0x07, 0x15, 0x06, 0xfd, 0xf0, 0x3d, 0x97, 0x45, 0x39, 0x05, 0x15, 0x06,
+    0x0c, 0x14, 0x49, 0x54, 0x01, 0xf0, 0x3b, 0xfd, 0xd6, 0x70, 0x6c, 0x00,
+    0xff, 0xff, 0x00, 0x42, 0x00, 0x00, 0x01, 0xb7, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xaf, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x42, 0x00, 0x00, 0x01, 0xb7, 0x02, 0x74, 0x00, 0x0f,
+    0x00, 0x19, 0x00, 0x4f, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0xb5, 0x0f, 0x01,
+    0x02, 0x00, 0x01, 0x4a, 0x1b, 0xb5, 0x0f, 0x01, 0x02, 0x01, 0x01, 0x4a,
+    0x59, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x11, 0x01, 0x01, 0x00, 0x00,
+    0x1c, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5e, 0x00, 0x03, 0x03, 0x15, 0x03,
+    0x4c, 0x1b, 0x40, 0x15, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00, 0x01, 0x01,
+    0x14, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5e, 0x00, 0x03, 0x03, 0x15, 0x03,
+    0x4c, 0x59, 0xb6, 0x11, 0x15, 0x15, 0x29, 0x04, 0x07, 0x18, 0x2b, 0x01,
+    0x36, 0x36, 0x35, 0x34, 0x27, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x07, 0x25, 0x33, 0x15, 0x06, 0x06, 0x15, 0x11, 0x21, 0x15,
+    0x21, 0x01, 0x37, 0x17, 0x1d, 0x13, 0x16, 0x1b, 0x15, 0x16, 0x20, 0x55,
+    0xfe, 0xef, 0x52, 0x06, 0x03, 0x01, 0x2c, 0xfe, 0x8b, 0x01, 0xb3, 0x14,
+    0x31, 0x0f, 0x0b, 0x11, 0x12, 0x10, 0x14, 0x1b, 0x26, 0x1c, 0x42, 0x55,
+    0xd4, 0x07, 0x06, 0x0e, 0x11, 0xfd, 0xf9, 0x3c, 0xff, 0xff, 0x00, 0x42,
+    0xfe, 0xed, 0x01, 0xb7, 0x02, 0x6f, 0x00, 0x22, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xde, 0x02, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x42,
+    0x00, 0x00, 0x01, 0xb7, 0x02, 0x6f, 0x00, 0x22, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x02, 0x02, 0x21, 0x3c, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x42,
+    0xff, 0x60, 0x01, 0xb7, 0x02, 0x6f, 0x00, 0x22, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x42,
+    0xff, 0x52, 0x01, 0xb3, 0x02, 0x8f, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x28,
+    0x00, 0x56, 0x40, 0x53, 0x17, 0x16, 0x02, 0x05, 0x04, 0x01, 0x4a, 0x00,
+    0x02, 0x02, 0x14, 0x4b, 0x09, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+    0x00, 0x16, 0x4b, 0x00, 0x06, 0x06, 0x07, 0x5d, 0x00, 0x07, 0x07, 0x17,
+    0x4b, 0x00, 0x03, 0x03, 0x04, 0x5e, 0x00, 0x04, 0x04, 0x15, 0x4b, 0x00,
+    0x05, 0x05, 0x08, 0x5f, 0x0a, 0x01, 0x08, 0x08, 0x21, 0x08, 0x4c, 0x15,
+    0x15, 0x00, 0x00, 0x15, 0x28, 0x15, 0x27, 0x24, 0x23, 0x22, 0x21, 0x1e,
+    0x1c, 0x14, 0x13, 0x12, 0x11, 0x0d, 0x0c, 0x00, 0x0b, 0x00, 0x0a, 0x24,
+    0x0b, 0x07, 0x15, 0x2b, 0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x25, 0x33, 0x14, 0x06, 0x15, 0x11, 0x33, 0x15,
+    0x23, 0x16, 0x27, 0x37, 0x1e, 0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x11, 0x23, 0x35, 0x33, 0x11, 0x14, 0x06, 0x07, 0x01, 0x6a, 0x1e, 0x1d,
+    0x16, 0x15, 0x1f, 0x1f, 0x15, 0xfe, 0xc3, 0x52, 0x09, 0xa0, 0xe9, 0x5e,
+    0x34, 0x2f, 0x04, 0x08, 0x11, 0x16, 0x18, 0x17, 0x2f, 0x38, 0x8c, 0xd5,
+    0x63, 0x52, 0x02, 0x28, 0x1e, 0x15, 0x16, 0x1e, 0x1f, 0x15, 0x15, 0x1e,
+    0x47, 0x07, 0x15, 0x06, 0xfd, 0xf0, 0x3d, 0xae, 0x40, 0x3e, 0x04, 0x16,
+    0x11, 0x0a, 0x0b, 0x40, 0x42, 0x01, 0x7c, 0x3b, 0xfe, 0x4d, 0x62, 0x5e,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x42, 0xff, 0x65, 0x01, 0xb7,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2,
+    0x01, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0xff, 0xff, 0x01, 0xbe,
+    0x02, 0x6f, 0x00, 0x14, 0x00, 0x26, 0x40, 0x23, 0x10, 0x0f, 0x0b, 0x0a,
+    0x03, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x00,
+    0x14, 0x4b, 0x00, 0x01, 0x01, 0x02, 0x5e, 0x00, 0x02, 0x02, 0x15, 0x02,
+    0x4c, 0x11, 0x1c, 0x14, 0x03, 0x07, 0x17, 0x2b, 0x37, 0x07, 0x35, 0x37,
+    0x11, 0x33, 0x32, 0x15, 0x14, 0x06, 0x07, 0x11, 0x37, 0x36, 0x37, 0x15,
+    0x07, 0x15, 0x21, 0x15, 0x21, 0x49, 0x35, 0x35, 0x51, 0x02, 0x08, 0x02,
+    0xa6, 0x15, 0x04, 0xbf, 0x01, 0x2c, 0xfe, 0x8b, 0xf3, 0x11, 0x3d, 0x12,
+    0x01, 0x3e, 0x02, 0x02, 0x16, 0x08, 0xfe, 0xfb, 0x36, 0x08, 0x02, 0x40,
+    0x3d, 0xcf, 0x3d, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x00, 0x01, 0xcc,
+    0x02, 0x70, 0x00, 0x0c, 0x00, 0x28, 0x40, 0x25, 0x0a, 0x07, 0x02, 0x03,
+    0x03, 0x00, 0x01, 0x4a, 0x00, 0x03, 0x00, 0x02, 0x00, 0x03, 0x02, 0x7e,
+    0x01, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x15, 0x02,
+    0x4c, 0x12, 0x12, 0x11, 0x12, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x13, 0x33,
+    0x13, 0x13, 0x33, 0x11, 0x23, 0x11, 0x07, 0x23, 0x27, 0x11, 0x23, 0x29,
+    0x37, 0x9a, 0x9d, 0x35, 0x42, 0x87, 0x1b, 0x7e, 0x41, 0x02, 0x6f, 0xfe,
+    0xcf, 0x01, 0x32, 0xfd, 0x90, 0x01, 0xd6, 0xfb, 0xf8, 0xfe, 0x2d, 0x00,
+    0xff, 0xff, 0x00, 0x29, 0xff, 0x60, 0x01, 0xcc, 0x02, 0x70, 0x00, 0x22,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc8, 0x02, 0x6f, 0x00, 0x0d,
+    0x00, 0x1e, 0x40, 0x1b, 0x0b, 0x02, 0x02, 0x02, 0x00, 0x01, 0x4a, 0x01,
+    0x01, 0x00, 0x00, 0x14, 0x4b, 0x03, 0x01, 0x02, 0x02, 0x15, 0x02, 0x4c,
+    0x12, 0x15, 0x12, 0x10, 0x04, 0x07, 0x18, 0x2b, 0x13, 0x33, 0x01, 0x11,
+    0x33, 0x15, 0x06, 0x06, 0x15, 0x11, 0x23, 0x01, 0x11, 0x23, 0x32, 0x44,
+    0x01, 0x06, 0x4c, 0x06, 0x03, 0x37, 0xfe, 0xed, 0x43, 0x02, 0x6f, 0xfe,
+    0x32, 0x01, 0xce, 0x07, 0x06, 0x0e, 0x11, 0xfd, 0xbd, 0x01, 0xea, 0xfe,
+    0x16, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xe1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xeb,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xfe, 0xed, 0x01, 0xc8,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde,
+    0x02, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6,
+    0x01, 0xc1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0x60, 0x01, 0xc8,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc,
+    0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0xff, 0x47, 0x01, 0xc6,
+    0x02, 0x6f, 0x00, 0x18, 0x00, 0x58, 0x40, 0x10, 0x17, 0x12, 0x11, 0x03,
+    0x02, 0x03, 0x0a, 0x01, 0x01, 0x02, 0x09, 0x01, 0x00, 0x01, 0x03, 0x4a,
+    0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40, 0x17, 0x05, 0x04, 0x02, 0x03, 0x03,
+    0x14, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x40, 0x14, 0x00, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x63, 0x05, 0x04, 0x02, 0x03, 0x03, 0x14, 0x4b, 0x00,
+    0x02, 0x02, 0x15, 0x02, 0x4c, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x18, 0x11, 0x14, 0x25, 0x26, 0x06, 0x07, 0x18, 0x2b, 0x01, 0x14,
+    0x06, 0x15, 0x11, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37, 0x1e, 0x02, 0x33,
+    0x32, 0x36, 0x37, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x01, 0xc6,
+    0x07, 0x51, 0x47, 0x2f, 0x28, 0x23, 0x06, 0x0e, 0x10, 0x13, 0x2d, 0x23,
+    0x02, 0xfe, 0xf9, 0x43, 0x44, 0x01, 0x06, 0x02, 0x6f, 0x03, 0x10, 0x08,
+    0xfd, 0xac, 0x5b, 0x5e, 0x19, 0x3e, 0x02, 0x0e, 0x08, 0x43, 0x4d, 0x01,
+    0xd4, 0xfe, 0x16, 0x02, 0x6f, 0xfe, 0x32, 0x01, 0xce, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x32, 0xff, 0x65, 0x01, 0xc8, 0x02, 0x6f, 0x00, 0x22,
+    0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2, 0x01, 0xf6, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc8, 0x03, 0x1d, 0x00, 0x22,
+    0x00, 0x72, 0x00, 0x00, 0x00, 0x03, 0x02, 0xee, 0x01, 0xf3, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x02, 0x73, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x14, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01,
+    0x01, 0x01, 0x1d, 0x01, 0x4c, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c,
+    0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b,
+    0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0x8f, 0x74, 0x75, 0x6a, 0x6a, 0x75, 0x74, 0x6b, 0x48, 0x4f, 0x50, 0x47,
+    0x47, 0x50, 0x4f, 0x48, 0x0b, 0xa6, 0x99, 0x95, 0xaa, 0xaa, 0x95, 0x99,
+    0xa6, 0x3d, 0x86, 0x7c, 0x77, 0x8b, 0x8b, 0x77, 0x7c, 0x86, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x02, 0x1a, 0x03, 0x81, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea, 0x01, 0xf3, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xe8, 0x02, 0xa1, 0x00, 0x6a, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x6a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0x60, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9,
+    0x03, 0xa1, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe7, 0x01, 0xf4, 0x00, 0x8a,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x8a, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0xa2, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x23, 0x02, 0xea, 0x01, 0xf0, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xd7, 0x02, 0x76, 0x00, 0xe2, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0xe2, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x03, 0x97, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xea, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xf0,
+    0x01, 0xea, 0x00, 0xfa, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0xfa, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9,
+    0x03, 0x50, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x27, 0x02, 0xcd,
+    0x01, 0xa4, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xcd, 0x02, 0x44, 0x00, 0xa6,
+    0x00, 0x10, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x03,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x03, 0x15, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe5, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x03, 0xa1, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xe5, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6,
+    0x01, 0xf2, 0x01, 0x34, 0x00, 0x09, 0xb1, 0x04, 0x01, 0xb8, 0x01, 0x34,
+    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9,
+    0x03, 0x83, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x23, 0x02, 0xe6,
+    0x01, 0xc1, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x01, 0xf2, 0x01, 0x16,
+    0x00, 0x09, 0xb1, 0x03, 0x01, 0xb8, 0x01, 0x16, 0xb0, 0x33, 0x2b, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0x60, 0x01, 0xd9, 0x02, 0x73, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7, 0x01, 0xb4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x66, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x03, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x02, 0xa6, 0x00, 0x14,
+    0x00, 0x20, 0x00, 0x5d, 0x40, 0x0a, 0x0c, 0x01, 0x03, 0x01, 0x14, 0x01,
+    0x04, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x1b, 0x00,
+    0x02, 0x02, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01,
+    0x14, 0x4b, 0x05, 0x01, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d,
+    0x00, 0x4c, 0x1b, 0x40, 0x1b, 0x00, 0x02, 0x01, 0x02, 0x83, 0x00, 0x03,
+    0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x05, 0x01, 0x04, 0x04,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x59, 0x40, 0x0d, 0x15,
+    0x15, 0x15, 0x20, 0x15, 0x1f, 0x28, 0x15, 0x24, 0x23, 0x06, 0x07, 0x18,
+    0x2b, 0x00, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x17, 0x3e, 0x02, 0x35, 0x33, 0x14, 0x06, 0x07, 0x02, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x01, 0xd9, 0x74,
+    0x6b, 0x6b, 0x74, 0x75, 0x6a, 0x4a, 0x34, 0x10, 0x0e, 0x04, 0x3a, 0x14,
+    0x1f, 0x5f, 0x4f, 0x50, 0x47, 0x47, 0x50, 0x4f, 0x48, 0x01, 0xc8, 0x94,
+    0x99, 0xa6, 0xa6, 0x99, 0x95, 0xaa, 0x2b, 0x02, 0x10, 0x24, 0x28, 0x45,
+    0x3d, 0x09, 0xfe, 0x17, 0x86, 0x7c, 0x77, 0x8b, 0x8b, 0x77, 0x7c, 0x86,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0x60, 0x01, 0xd9, 0x02, 0xa6, 0x00, 0x22,
+    0x00, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7, 0x01, 0xb4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x66, 0x00, 0x22,
+    0x00, 0x8b, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x03, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x1d, 0x00, 0x22,
+    0x00, 0x8b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xee, 0x01, 0xf3, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x2a, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe9, 0x01, 0xcc, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x2a, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd9, 0x01, 0xec, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0xb1, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x27, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0xa6,
+    0x01, 0x07, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x9a, 0x00, 0x10, 0xb1, 0x02,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb0, 0x9a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9,
+    0x03, 0xb1, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x27, 0x02, 0xd6,
+    0x01, 0xf4, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xe7, 0x01, 0xb4, 0x00, 0x9a,
+    0x00, 0x10, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x03,
+    0x01, 0xb0, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1b,
+    0xff, 0x27, 0x01, 0xd9, 0x02, 0x73, 0x00, 0x18, 0x00, 0x24, 0x00, 0x24,
+    0x40, 0x21, 0x06, 0x05, 0x02, 0x00, 0x47, 0x00, 0x03, 0x03, 0x01, 0x5f,
+    0x00, 0x01, 0x01, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00,
+    0x00, 0x1d, 0x00, 0x4c, 0x24, 0x27, 0x24, 0x2b, 0x04, 0x07, 0x18, 0x2b,
+    0x04, 0x06, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26, 0x35, 0x34, 0x37,
+    0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x07, 0x26, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x01, 0x26, 0x27, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x43, 0x06, 0x6b,
+    0x74, 0x75, 0x6a, 0x6a, 0x75, 0x4a, 0x47, 0xe5, 0x4f, 0x48, 0x48, 0x4f,
+    0x50, 0x47, 0x47, 0x50, 0x1a, 0x3d, 0x1a, 0x16, 0x1e, 0x04, 0x30, 0x07,
+    0x2e, 0x25, 0x3c, 0x38, 0xa6, 0x99, 0x95, 0xaa, 0xaa, 0x95, 0x7a, 0x9d,
+    0x1b, 0xb6, 0x86, 0x86, 0x7c, 0x77, 0x8b, 0x8b, 0x77, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x1b, 0xff, 0xd6, 0x01, 0xd9, 0x02, 0xaa, 0x00, 0x14,
+    0x00, 0x1c, 0x00, 0x24, 0x00, 0x42, 0x40, 0x3f, 0x11, 0x01, 0x02, 0x01,
+    0x22, 0x21, 0x17, 0x16, 0x14, 0x0a, 0x06, 0x03, 0x02, 0x07, 0x01, 0x00,
+    0x03, 0x03, 0x4a, 0x13, 0x12, 0x02, 0x01, 0x48, 0x09, 0x08, 0x02, 0x00,
+    0x47, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x04,
+    0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x1d,
+    0x1d, 0x1d, 0x24, 0x1d, 0x23, 0x28, 0x28, 0x24, 0x05, 0x07, 0x17, 0x2b,
+    0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x07, 0x27, 0x37, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x17, 0x37, 0x17, 0x07, 0x00, 0x17, 0x13,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x12, 0x36, 0x35, 0x34, 0x27, 0x03, 0x16,
+    0x33, 0x01, 0xb5, 0x24, 0x74, 0x6b, 0x4b, 0x34, 0x26, 0x2c, 0x2f, 0x3d,
+    0x75, 0x6a, 0x42, 0x34, 0x30, 0x2a, 0x37, 0xfe, 0xd0, 0x1c, 0xd0, 0x24,
+    0x31, 0x47, 0x50, 0xdf, 0x4f, 0x23, 0xd2, 0x26, 0x38, 0x02, 0x04, 0x7f,
+    0x51, 0x99, 0xa6, 0x29, 0x48, 0x14, 0x59, 0x52, 0x9f, 0x95, 0xaa, 0x24,
+    0x5b, 0x16, 0x67, 0xfe, 0xa0, 0x41, 0x01, 0x86, 0x24, 0x8b, 0x77, 0xfe,
+    0xfe, 0x86, 0x7c, 0x70, 0x43, 0xfe, 0x75, 0x2a, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xd6, 0x01, 0xd9, 0x03, 0x17, 0x00, 0x22, 0x00, 0x97, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x03, 0x1d, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xee, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x03, 0xb2, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xee, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8,
+    0x01, 0xe1, 0x00, 0x9b, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x9b, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9,
+    0x03, 0xb0, 0x00, 0x22, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x23, 0x02, 0xee,
+    0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe5, 0x01, 0xf3, 0x00, 0x9b,
+    0x00, 0x08, 0xb1, 0x03, 0x02, 0xb0, 0x9b, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x1b, 0xff, 0xf5, 0x01, 0xd9, 0x03, 0xa6, 0x00, 0x22,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x27, 0x02, 0xf0, 0x01, 0xea, 0x00, 0xa6,
+    0x01, 0x07, 0x02, 0xd6, 0x01, 0xef, 0x01, 0x39, 0x00, 0x11, 0xb1, 0x02,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x03, 0x01, 0xb8, 0x01, 0x39,
+    0xb0, 0x33, 0x2b, 0x00, 0x00, 0x02, 0x00, 0x09, 0xff, 0xf9, 0x01, 0xe4,
+    0x02, 0x78, 0x00, 0x16, 0x00, 0x22, 0x01, 0x3b, 0x4b, 0xb0, 0x09, 0x50,
+    0x58, 0x40, 0x12, 0x07, 0x01, 0x02, 0x00, 0x1a, 0x01, 0x03, 0x02, 0x19,
+    0x01, 0x05, 0x04, 0x14, 0x01, 0x06, 0x05, 0x04, 0x4a, 0x1b, 0x4b, 0xb0,
+    0x1d, 0x50, 0x58, 0x40, 0x12, 0x07, 0x01, 0x08, 0x00, 0x1a, 0x01, 0x03,
+    0x02, 0x19, 0x01, 0x05, 0x04, 0x14, 0x01, 0x06, 0x05, 0x04, 0x4a, 0x1b,
+    0x40, 0x12, 0x07, 0x01, 0x08, 0x01, 0x1a, 0x01, 0x03, 0x02, 0x19, 0x01,
+    0x05, 0x04, 0x14, 0x01, 0x06, 0x09, 0x04, 0x4a, 0x59, 0x59, 0x4b, 0xb0,
+    0x09, 0x50, 0x58, 0x40, 0x23, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04,
+    0x65, 0x08, 0x01, 0x02, 0x02, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x1c,
+    0x4b, 0x0b, 0x09, 0x02, 0x05, 0x05, 0x06, 0x5f, 0x0a, 0x07, 0x02, 0x06,
+    0x06, 0x15, 0x06, 0x4c, 0x1b, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x2d,
+    0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x65, 0x00, 0x08, 0x08, 0x00,
+    0x5f, 0x01, 0x01, 0x00, 0x00, 0x1c, 0x4b, 0x00, 0x02, 0x02, 0x00, 0x5f,
+    0x01, 0x01, 0x00, 0x00, 0x1c, 0x4b, 0x0b, 0x09, 0x02, 0x05, 0x05, 0x06,
+    0x5f, 0x0a, 0x07, 0x02, 0x06, 0x06, 0x15, 0x06, 0x4c, 0x1b, 0x4b, 0xb0,
+    0x21, 0x50, 0x58, 0x40, 0x36, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04,
+    0x65, 0x00, 0x08, 0x08, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00,
+    0x02, 0x02, 0x01, 0x5d, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x00, 0x05, 0x05,
+    0x06, 0x5f, 0x0a, 0x07, 0x02, 0x06, 0x06, 0x15, 0x4b, 0x0b, 0x01, 0x09,
+    0x09, 0x06, 0x5f, 0x0a, 0x07, 0x02, 0x06, 0x06, 0x15, 0x06, 0x4c, 0x1b,
+    0x40, 0x33, 0x00, 0x03, 0x00, 0x04, 0x05, 0x03, 0x04, 0x65, 0x00, 0x08,
+    0x08, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00, 0x02, 0x02, 0x01,
+    0x5d, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x00, 0x05, 0x05, 0x06, 0x5d, 0x00,
+    0x06, 0x06, 0x15, 0x4b, 0x0b, 0x01, 0x09, 0x09, 0x07, 0x5f, 0x0a, 0x01,
+    0x07, 0x07, 0x1d, 0x07, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x18, 0x17, 0x17,
+    0x00, 0x00, 0x17, 0x22, 0x17, 0x21, 0x1d, 0x1b, 0x00, 0x16, 0x00, 0x15,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x24, 0x0c, 0x07, 0x1b, 0x2b, 0x16,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x17, 0x35, 0x33, 0x15, 0x23, 0x15,
+    0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x35, 0x06, 0x23, 0x36, 0x36,
+    0x37, 0x11, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x5f, 0x56,
+    0x55, 0x4f, 0x2f, 0x21, 0xe7, 0xa9, 0x8f, 0x8f, 0xa7, 0xe6, 0x20, 0x30,
+    0x21, 0x28, 0x07, 0x20, 0x31, 0x2c, 0x36, 0x37, 0x33, 0x07, 0x9f, 0xa0,
+    0x9d, 0xa3, 0x25, 0x1d, 0x3e, 0xcd, 0x40, 0xe7, 0x3e, 0x1f, 0x26, 0x3d,
+    0x2a, 0x21, 0x01, 0x64, 0x59, 0x78, 0x8d, 0x7b, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xc8, 0x02, 0x6f, 0x00, 0x0a,
+    0x00, 0x13, 0x00, 0x2a, 0x40, 0x27, 0x05, 0x01, 0x03, 0x00, 0x01, 0x02,
+    0x03, 0x01, 0x65, 0x00, 0x04, 0x04, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x14,
+    0x4b, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x0c, 0x0b, 0x12, 0x10, 0x0b,
+    0x13, 0x0c, 0x13, 0x11, 0x24, 0x20, 0x06, 0x07, 0x17, 0x2b, 0x13, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x11, 0x23, 0x13, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x15, 0x3b, 0xc8, 0x63, 0x62, 0x60, 0x60,
+    0x85, 0x48, 0xc5, 0x42, 0x3e, 0x40, 0x3f, 0x7e, 0x02, 0x6f, 0x62, 0x4e,
+    0x4d, 0x5f, 0xfe, 0xed, 0x01, 0x51, 0x39, 0x33, 0x31, 0x3f, 0xdc, 0x00,
+    0x00, 0x02, 0x00, 0x3b, 0x00, 0x00, 0x01, 0xc8, 0x02, 0x6f, 0x00, 0x11,
+    0x00, 0x19, 0x00, 0x38, 0x40, 0x35, 0x06, 0x01, 0x01, 0x00, 0x14, 0x01,
+    0x04, 0x05, 0x02, 0x4a, 0x00, 0x01, 0x00, 0x05, 0x04, 0x01, 0x05, 0x66,
+    0x06, 0x01, 0x04, 0x00, 0x02, 0x03, 0x04, 0x02, 0x65, 0x00, 0x00, 0x00,
+    0x14, 0x4b, 0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x13, 0x12, 0x18, 0x16,
+    0x12, 0x19, 0x13, 0x19, 0x11, 0x24, 0x26, 0x10, 0x07, 0x07, 0x18, 0x2b,
+    0x13, 0x33, 0x16, 0x15, 0x14, 0x06, 0x07, 0x15, 0x33, 0x32, 0x16, 0x17,
+    0x06, 0x06, 0x23, 0x23, 0x15, 0x23, 0x37, 0x32, 0x37, 0x26, 0x26, 0x23,
+    0x23, 0x15, 0x3b, 0x4e, 0x02, 0x08, 0x02, 0x82, 0x62, 0x5f, 0x04, 0x04,
+    0x5c, 0x60, 0x87, 0x46, 0xcd, 0x6f, 0x09, 0x04, 0x3d, 0x3e, 0x80, 0x02,
+    0x6f, 0x02, 0x01, 0x02, 0x10, 0x07, 0x59, 0x61, 0x4f, 0x4e, 0x5e, 0x9e,
+    0xdb, 0x6d, 0x32, 0x3e, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1d,
+    0xff, 0x6b, 0x01, 0xd9, 0x02, 0x76, 0x00, 0x17, 0x00, 0x25, 0x00, 0x64,
+    0xb6, 0x11, 0x02, 0x02, 0x01, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50,
+    0x58, 0x40, 0x1f, 0x06, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x7e,
+    0x00, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00, 0x01,
+    0x01, 0x02, 0x5f, 0x05, 0x01, 0x02, 0x02, 0x19, 0x02, 0x4c, 0x1b, 0x40,
+    0x1c, 0x06, 0x01, 0x04, 0x03, 0x01, 0x03, 0x04, 0x01, 0x7e, 0x00, 0x01,
+    0x05, 0x01, 0x02, 0x01, 0x02, 0x63, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x1c, 0x03, 0x4c, 0x59, 0x40, 0x13, 0x18, 0x18, 0x00, 0x00,
+    0x18, 0x25, 0x18, 0x24, 0x20, 0x1e, 0x00, 0x17, 0x00, 0x16, 0x28, 0x29,
+    0x07, 0x07, 0x16, 0x2b, 0x04, 0x26, 0x35, 0x2e, 0x02, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x14, 0x06, 0x07, 0x16, 0x16, 0x33,
+    0x37, 0x07, 0x23, 0x26, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x01, 0x30, 0x4e, 0x34, 0x5a, 0x37, 0x44,
+    0x65, 0x35, 0x3c, 0x66, 0x3c, 0x02, 0x5d, 0x5b, 0x02, 0x21, 0x27, 0x51,
+    0x02, 0x27, 0x6c, 0x43, 0x2c, 0x2f, 0x45, 0x25, 0x4a, 0x50, 0x55, 0x4a,
+    0x95, 0x3f, 0x4f, 0x07, 0x4b, 0x89, 0x60, 0x74, 0x90, 0x3e, 0x44, 0x90,
+    0x6b, 0x8a, 0xa0, 0x14, 0x25, 0x26, 0x05, 0x44, 0xc8, 0x31, 0x6b, 0x53,
+    0x68, 0x7a, 0x31, 0x8f, 0x67, 0x78, 0x94, 0x00, 0x00, 0x02, 0x00, 0x38,
+    0x00, 0x00, 0x01, 0xd0, 0x02, 0x6f, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x32,
+    0x40, 0x2f, 0x07, 0x01, 0x02, 0x04, 0x01, 0x4a, 0x06, 0x01, 0x04, 0x00,
+    0x02, 0x01, 0x04, 0x02, 0x65, 0x00, 0x05, 0x05, 0x00, 0x5d, 0x00, 0x00,
+    0x00, 0x14, 0x4b, 0x03, 0x01, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x0f, 0x0e,
+    0x15, 0x13, 0x0e, 0x16, 0x0f, 0x16, 0x11, 0x11, 0x16, 0x20, 0x07, 0x07,
+    0x18, 0x2b, 0x13, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x13, 0x23,
+    0x03, 0x23, 0x11, 0x23, 0x13, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23,
+    0x15, 0x38, 0xb8, 0x6a, 0x65, 0x47, 0x38, 0x90, 0x4e, 0x8a, 0x79, 0x47,
+    0xc0, 0x41, 0x3e, 0x3f, 0x40, 0x79, 0x02, 0x6f, 0x5e, 0x54, 0x37, 0x62,
+    0x0e, 0xfe, 0xea, 0x01, 0x13, 0xfe, 0xed, 0x01, 0x51, 0x39, 0x33, 0x32,
+    0x3e, 0xdc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38, 0x00, 0x00, 0x01, 0xd0,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xe1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38, 0x00, 0x00, 0x01, 0xd0,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x02, 0xeb,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38, 0xfe, 0xed, 0x01, 0xd0,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde,
+    0x02, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38, 0x00, 0x00, 0x01, 0xd0,
+    0x03, 0x50, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x27, 0x02, 0xcd,
+    0x01, 0xa4, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xcd, 0x02, 0x44, 0x00, 0xa6,
+    0x00, 0x10, 0xb1, 0x02, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x03,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38,
+    0xff, 0x60, 0x01, 0xd0, 0x02, 0x6f, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38,
+    0x00, 0x00, 0x01, 0xd0, 0x03, 0x2a, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xd9, 0x01, 0xec, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x02,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38,
+    0xff, 0x65, 0x01, 0xd0, 0x02, 0x6f, 0x00, 0x22, 0x00, 0xa1, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe2, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34,
+    0xff, 0xf6, 0x01, 0xc7, 0x02, 0x77, 0x00, 0x31, 0x00, 0x2e, 0x40, 0x2b,
+    0x1b, 0x1a, 0x03, 0x01, 0x04, 0x00, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02,
+    0x01, 0x5f, 0x00, 0x01, 0x01, 0x1c, 0x4b, 0x00, 0x00, 0x00, 0x03, 0x5f,
+    0x04, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x31, 0x00,
+    0x30, 0x2a, 0x2b, 0x29, 0x05, 0x07, 0x17, 0x2b, 0x16, 0x27, 0x37, 0x37,
+    0x17, 0x1e, 0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x27,
+    0x34, 0x26, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x7e, 0x4a, 0x24,
+    0x04, 0x07, 0x01, 0x03, 0x07, 0x08, 0x38, 0x53, 0x37, 0x4a, 0x17, 0x3c,
+    0x3c, 0x5c, 0x4f, 0x66, 0x58, 0x33, 0x59, 0x21, 0x2d, 0x06, 0x03, 0x08,
+    0x07, 0x17, 0x36, 0x26, 0x30, 0x3b, 0x19, 0x42, 0x3f, 0x59, 0x44, 0x2d,
+    0x5e, 0x45, 0x0a, 0x4f, 0x3f, 0x09, 0x04, 0x03, 0x0e, 0x0d, 0x06, 0x30,
+    0x3e, 0x2d, 0x1d, 0x27, 0x26, 0x1a, 0x24, 0x5c, 0x39, 0x46, 0x54, 0x29,
+    0x25, 0x3c, 0x04, 0x02, 0x0e, 0x0d, 0x07, 0x16, 0x12, 0x35, 0x26, 0x1d,
+    0x2b, 0x29, 0x19, 0x25, 0x4e, 0x3b, 0x2e, 0x52, 0x34, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xff, 0xf6, 0x01, 0xc7, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xff, 0xf6, 0x01, 0xc7, 0x03, 0x8d, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x23, 0x02, 0xe8, 0x01, 0xec, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xe6, 0x01, 0xcc, 0x00, 0x76, 0x00, 0x08, 0xb1, 0x02,
+    0x01, 0xb0, 0x76, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x34,
+    0xff, 0xf6, 0x01, 0xc7, 0x03, 0x17, 0x00, 0x22, 0x00, 0xa9, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xeb, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x34,
+    0xff, 0xf6, 0x01, 0xc7, 0x03, 0xbf, 0x00, 0x22, 0x00, 0xa9, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xeb, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe6,
+    0x01, 0xcc, 0x00, 0xa8, 0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xa8, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0xff, 0x3b, 0x01, 0xc7,
+    0x02, 0x77, 0x00, 0x44, 0x00, 0xa9, 0x40, 0x15, 0x32, 0x31, 0x1a, 0x18,
+    0x04, 0x04, 0x06, 0x04, 0x01, 0x02, 0x03, 0x0d, 0x01, 0x01, 0x02, 0x0c,
+    0x01, 0x00, 0x01, 0x04, 0x4a, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x26,
+    0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x70, 0x00, 0x06, 0x06, 0x05, 0x5f,
+    0x00, 0x05, 0x05, 0x1c, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03,
+    0x03, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02,
+    0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00, 0x06, 0x06, 0x05, 0x5f, 0x00,
+    0x05, 0x05, 0x1c, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03,
+    0x1d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00,
+    0x4c, 0x1b, 0x40, 0x24, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x06, 0x06, 0x05, 0x5f,
+    0x00, 0x05, 0x05, 0x1c, 0x4b, 0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03,
+    0x03, 0x1d, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x0a, 0x2a, 0x2b, 0x29, 0x11,
+    0x23, 0x23, 0x29, 0x07, 0x07, 0x1b, 0x2b, 0x24, 0x06, 0x06, 0x07, 0x07,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37, 0x16, 0x33, 0x32,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x26, 0x27, 0x37, 0x37, 0x17, 0x1e,
+    0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x27, 0x34, 0x26,
+    0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17,
+    0x16, 0x16, 0x15, 0x01, 0xc7, 0x26, 0x4f, 0x3a, 0x05, 0x2a, 0x2b, 0x3c,
+    0x38, 0x35, 0x2e, 0x19, 0x26, 0x31, 0x32, 0x1b, 0x18, 0x1e, 0x0a, 0x72,
+    0x46, 0x24, 0x04, 0x07, 0x01, 0x03, 0x07, 0x08, 0x38, 0x53, 0x37, 0x4a,
+    0x17, 0x3c, 0x3c, 0x5c, 0x4f, 0x66, 0x58, 0x33, 0x59, 0x21, 0x2d, 0x06,
+    0x03, 0x08, 0x07, 0x17, 0x36, 0x26, 0x30, 0x3b, 0x19, 0x42, 0x3f, 0x59,
+    0x44, 0x80, 0x4c, 0x36, 0x06, 0x27, 0x04, 0x25, 0x18, 0x24, 0x31, 0x1f,
+    0x2a, 0x1e, 0x24, 0x10, 0x11, 0x4b, 0x04, 0x4b, 0x3f, 0x09, 0x04, 0x03,
+    0x0e, 0x0d, 0x06, 0x30, 0x3e, 0x2d, 0x1d, 0x27, 0x26, 0x1a, 0x24, 0x5c,
+    0x39, 0x46, 0x54, 0x29, 0x25, 0x3c, 0x04, 0x02, 0x0e, 0x0d, 0x07, 0x16,
+    0x12, 0x35, 0x26, 0x1d, 0x2b, 0x29, 0x19, 0x25, 0x4e, 0x3b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xff, 0xf6, 0x01, 0xc7, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xfe, 0xed, 0x01, 0xc7, 0x02, 0x77, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xff, 0xf6, 0x01, 0xc7, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6, 0x01, 0xcc, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xff, 0x60, 0x01, 0xc7, 0x02, 0x77, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xfc, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x34, 0xff, 0x60, 0x01, 0xc7, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0xa9, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc, 0x01, 0xfc, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe6, 0x01, 0xcc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x37,
+    0xff, 0xf6, 0x01, 0xd0, 0x02, 0x9d, 0x00, 0x24, 0x00, 0x84, 0x4b, 0xb0,
+    0x19, 0x50, 0x58, 0x40, 0x11, 0x24, 0x23, 0x14, 0x13, 0x04, 0x02, 0x03,
+    0x08, 0x01, 0x01, 0x02, 0x07, 0x01, 0x00, 0x01, 0x03, 0x4a, 0x1b, 0x40,
+    0x11, 0x24, 0x23, 0x14, 0x13, 0x04, 0x02, 0x03, 0x08, 0x01, 0x01, 0x02,
+    0x07, 0x01, 0x04, 0x01, 0x03, 0x4a, 0x59, 0x4b, 0xb0, 0x19, 0x50, 0x58,
+    0x40, 0x1e, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00, 0x03,
+    0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x01, 0x01, 0x00,
+    0x5f, 0x04, 0x01, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x1b, 0x40, 0x22, 0x00,
+    0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00, 0x03, 0x03, 0x05, 0x5f,
+    0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x15, 0x4b, 0x00, 0x01,
+    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x59, 0x40, 0x09,
+    0x23, 0x13, 0x24, 0x24, 0x24, 0x24, 0x06, 0x07, 0x1a, 0x2b, 0x00, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x37, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x07, 0x01,
+    0x73, 0x5d, 0x66, 0x4f, 0x3c, 0x2e, 0x16, 0x11, 0x29, 0x13, 0x34, 0x46,
+    0x44, 0x56, 0x1e, 0x8a, 0x33, 0x36, 0x34, 0x48, 0x44, 0x6f, 0x50, 0x54,
+    0x5a, 0x88, 0x01, 0x70, 0x63, 0x58, 0x60, 0x5f, 0x1f, 0x38, 0x0c, 0x0c,
+    0x4a, 0x3f, 0x38, 0x4d, 0x39, 0x79, 0x2f, 0x3f, 0x42, 0x46, 0xfe, 0x25,
+    0x01, 0xce, 0x6b, 0x64, 0x65, 0x4b, 0x73, 0x00, 0xff, 0xff, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x02, 0x73, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xcf, 0x02, 0x70, 0x00, 0x07,
+    0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x01,
+    0x01, 0x14, 0x4b, 0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x11, 0x11, 0x11,
+    0x10, 0x04, 0x07, 0x18, 0x2b, 0x13, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11,
+    0x23, 0xd0, 0xb1, 0x01, 0xb0, 0xb8, 0x47, 0x02, 0x31, 0x3f, 0x3f, 0xfd,
+    0xcf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xcf,
+    0x02, 0x70, 0x00, 0x0f, 0x00, 0x2f, 0x40, 0x2c, 0x04, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x02, 0x00, 0x01, 0x65, 0x08, 0x07, 0x02, 0x05, 0x05, 0x06,
+    0x5d, 0x00, 0x06, 0x06, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x09, 0x07, 0x1b, 0x2b, 0x01, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23,
+    0x11, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x21, 0x15, 0x01, 0x17, 0x85,
+    0x85, 0x47, 0x78, 0x78, 0xb1, 0x01, 0xb0, 0x02, 0x31, 0xdd, 0x39, 0xfe,
+    0xe5, 0x01, 0x1b, 0x39, 0xdd, 0x3f, 0x3f, 0x00, 0xff, 0xff, 0x00, 0x1f,
+    0x00, 0x00, 0x01, 0xcf, 0x03, 0x17, 0x00, 0x22, 0x00, 0xb6, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xeb, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f,
+    0xff, 0x3b, 0x01, 0xcf, 0x02, 0x70, 0x00, 0x22, 0x00, 0xb6, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdf, 0x01, 0xdf, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f,
+    0xfe, 0xed, 0x01, 0xcf, 0x02, 0x70, 0x00, 0x22, 0x00, 0xb6, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xde, 0x02, 0x02, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f,
+    0xff, 0x60, 0x01, 0xcf, 0x02, 0x70, 0x00, 0x22, 0x00, 0xb6, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1f,
+    0xff, 0x65, 0x01, 0xcf, 0x02, 0x70, 0x00, 0x22, 0x00, 0xb6, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe2, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32,
+    0xff, 0xf5, 0x01, 0xc6, 0x02, 0x6f, 0x00, 0x15, 0x00, 0x21, 0x40, 0x1e,
+    0x02, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x04,
+    0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14,
+    0x13, 0x27, 0x13, 0x05, 0x07, 0x17, 0x2b, 0x16, 0x26, 0x35, 0x11, 0x33,
+    0x15, 0x06, 0x06, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11,
+    0x33, 0x11, 0x14, 0x06, 0x23, 0x98, 0x66, 0x4e, 0x06, 0x03, 0x3e, 0x47,
+    0x48, 0x3f, 0x43, 0x6b, 0x60, 0x0b, 0x76, 0x6c, 0x01, 0x98, 0x07, 0x06,
+    0x0e, 0x11, 0xfe, 0x93, 0x50, 0x56, 0x56, 0x53, 0x01, 0x96, 0xfe, 0x6b,
+    0x73, 0x72, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xe1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0x13, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x03, 0x02, 0xec,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0x50, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x27, 0x02, 0xcd,
+    0x01, 0xa4, 0x00, 0xa6, 0x01, 0x07, 0x02, 0xcd, 0x02, 0x44, 0x00, 0xa6,
+    0x00, 0x10, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x02,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0xf5, 0x01, 0xc6, 0x03, 0x15, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe5, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0x60, 0x01, 0xc6, 0x02, 0x6f, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0xf5, 0x01, 0xc6, 0x03, 0x17, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe7, 0x01, 0xb4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0xf5, 0x01, 0xc6, 0x03, 0x66, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xd7, 0x02, 0x03, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x01,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2d,
+    0xff, 0xf5, 0x01, 0xf1, 0x02, 0xcd, 0x00, 0x1e, 0x00, 0x4e, 0x4b, 0xb0,
+    0x0e, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x05, 0x02, 0x02, 0x05, 0x6e, 0x00,
+    0x00, 0x00, 0x02, 0x5f, 0x04, 0x01, 0x02, 0x02, 0x14, 0x4b, 0x00, 0x03,
+    0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1d, 0x01, 0x4c, 0x1b, 0x40, 0x1b,
+    0x00, 0x05, 0x02, 0x05, 0x83, 0x00, 0x00, 0x00, 0x02, 0x5f, 0x04, 0x01,
+    0x02, 0x02, 0x14, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01,
+    0x1d, 0x01, 0x4c, 0x59, 0x40, 0x09, 0x13, 0x23, 0x27, 0x13, 0x23, 0x12,
+    0x06, 0x07, 0x1a, 0x2b, 0x00, 0x06, 0x06, 0x23, 0x11, 0x14, 0x06, 0x23,
+    0x22, 0x26, 0x35, 0x11, 0x33, 0x15, 0x06, 0x06, 0x15, 0x11, 0x14, 0x16,
+    0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x01,
+    0xf1, 0x0c, 0x25, 0x27, 0x61, 0x56, 0x59, 0x5c, 0x46, 0x05, 0x03, 0x38,
+    0x40, 0x41, 0x38, 0x32, 0x13, 0x11, 0x05, 0x3a, 0x02, 0x94, 0x3b, 0x1b,
+    0xfe, 0x9c, 0x73, 0x72, 0x75, 0x6d, 0x01, 0x98, 0x07, 0x06, 0x0e, 0x11,
+    0xfe, 0x93, 0x50, 0x56, 0x56, 0x53, 0x01, 0x96, 0x0f, 0x25, 0x2a, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0xf5, 0x01, 0xf1, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8, 0x01, 0xc6, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0x60, 0x01, 0xf1, 0x02, 0xcd, 0x00, 0x22,
+    0x00, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xe3, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0xf5, 0x01, 0xf1, 0x03, 0x17, 0x00, 0x22,
+    0x00, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7, 0x01, 0x99, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0xf5, 0x01, 0xf1, 0x03, 0x66, 0x00, 0x22,
+    0x00, 0xc6, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x01, 0xe8, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0xf5, 0x01, 0xf1, 0x03, 0x1d, 0x00, 0x22,
+    0x00, 0xc6, 0x00, 0x00, 0x00, 0x03, 0x02, 0xee, 0x01, 0xd8, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6, 0x03, 0x2a, 0x00, 0x22,
+    0x00, 0xbd, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe9, 0x01, 0xcc, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6, 0x03, 0x2a, 0x00, 0x22,
+    0x00, 0xbd, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd9, 0x01, 0xec, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6, 0x03, 0x13, 0x00, 0x22,
+    0x00, 0xbd, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0xa6,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6, 0x03, 0xaf, 0x00, 0x22,
+    0x00, 0xbd, 0x00, 0x00, 0x00, 0x27, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0xa6,
+    0x01, 0x07, 0x02, 0xe5, 0x01, 0xf3, 0x00, 0x9a, 0x00, 0x10, 0xb1, 0x01,
+    0x01, 0xb0, 0xa6, 0xb0, 0x33, 0x2b, 0xb1, 0x02, 0x02, 0xb0, 0x9a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0xff, 0x27, 0x01, 0xc6,
+    0x02, 0x6f, 0x00, 0x24, 0x00, 0x29, 0x40, 0x26, 0x0b, 0x0a, 0x02, 0x00,
+    0x47, 0x04, 0x03, 0x02, 0x01, 0x01, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x24, 0x00,
+    0x24, 0x21, 0x1f, 0x18, 0x17, 0x14, 0x11, 0x05, 0x07, 0x14, 0x2b, 0x01,
+    0x11, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x37, 0x06, 0x23, 0x22, 0x26, 0x35, 0x11, 0x33,
+    0x15, 0x06, 0x06, 0x15, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11,
+    0x01, 0xc6, 0x35, 0x31, 0x26, 0x2c, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x23,
+    0x21, 0x07, 0x0e, 0x63, 0x66, 0x4e, 0x06, 0x03, 0x3e, 0x47, 0x48, 0x3f,
+    0x02, 0x6f, 0xfe, 0x6b, 0x50, 0x68, 0x18, 0x1e, 0x42, 0x1b, 0x16, 0x1e,
+    0x04, 0x30, 0x07, 0x2e, 0x25, 0x1d, 0x3c, 0x1c, 0x01, 0x76, 0x6c, 0x01,
+    0x98, 0x07, 0x06, 0x0e, 0x11, 0xfe, 0x93, 0x50, 0x56, 0x56, 0x53, 0x01,
+    0x96, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0x1b, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x03, 0x02, 0xed,
+    0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0x1d, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x03, 0x02, 0xee,
+    0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32, 0xff, 0xf5, 0x01, 0xc6,
+    0x03, 0xb2, 0x00, 0x22, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x23, 0x02, 0xee,
+    0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x9b,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x9b, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x19, 0xff, 0xfc, 0x01, 0xde, 0x02, 0x70, 0x00, 0x06,
+    0x00, 0x1b, 0x40, 0x18, 0x02, 0x01, 0x02, 0x00, 0x01, 0x4a, 0x01, 0x01,
+    0x00, 0x00, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x11, 0x12,
+    0x10, 0x03, 0x07, 0x17, 0x2b, 0x13, 0x33, 0x13, 0x13, 0x33, 0x03, 0x23,
+    0x19, 0x49, 0xa0, 0x97, 0x45, 0xd1, 0x20, 0x02, 0x70, 0xfe, 0x21, 0x01,
+    0xde, 0xfd, 0x8d, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x01, 0xe8,
+    0x02, 0x6f, 0x00, 0x0c, 0x00, 0x28, 0x40, 0x25, 0x0a, 0x05, 0x02, 0x03,
+    0x03, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x03, 0x7e,
+    0x02, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x15, 0x03,
+    0x4c, 0x12, 0x11, 0x12, 0x12, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x13, 0x33,
+    0x13, 0x13, 0x33, 0x13, 0x13, 0x33, 0x03, 0x23, 0x03, 0x03, 0x23, 0x11,
+    0x41, 0x43, 0x64, 0x16, 0x65, 0x39, 0x3b, 0x63, 0x1b, 0x6b, 0x6d, 0x1d,
+    0x02, 0x6f, 0xfe, 0x5b, 0x01, 0x77, 0xfe, 0x87, 0x01, 0xa7, 0xfd, 0x91,
+    0x01, 0x97, 0xfe, 0x69, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x01, 0xe8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xeb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x01, 0xe8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x01, 0xe8,
+    0x03, 0x15, 0x00, 0x22, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe5,
+    0x01, 0xfd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x01, 0xe8,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7,
+    0x01, 0xbe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x00, 0x01, 0xd4,
+    0x02, 0x70, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c, 0x09, 0x06, 0x03, 0x03,
+    0x02, 0x00, 0x01, 0x4a, 0x01, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x03, 0x01,
+    0x02, 0x02, 0x15, 0x02, 0x4c, 0x12, 0x12, 0x12, 0x11, 0x04, 0x07, 0x18,
+    0x2b, 0x13, 0x03, 0x33, 0x17, 0x37, 0x33, 0x03, 0x13, 0x23, 0x27, 0x07,
+    0x23, 0xd3, 0xa7, 0x4b, 0x83, 0x81, 0x46, 0x9e, 0xb1, 0x4f, 0x8a, 0x86,
+    0x4c, 0x01, 0x3e, 0x01, 0x32, 0xed, 0xed, 0xfe, 0xcf, 0xfe, 0xc1, 0xf7,
+    0xf7, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x02, 0x6f, 0x00, 0x08, 0x00, 0x1d, 0x40, 0x1a, 0x06, 0x03, 0x00, 0x03,
+    0x02, 0x00, 0x01, 0x4a, 0x01, 0x01, 0x00, 0x00, 0x14, 0x4b, 0x00, 0x02,
+    0x02, 0x15, 0x02, 0x4c, 0x12, 0x12, 0x11, 0x03, 0x07, 0x17, 0x2b, 0x37,
+    0x03, 0x33, 0x13, 0x13, 0x33, 0x03, 0x15, 0x23, 0xdc, 0xc0, 0x50, 0x99,
+    0x8a, 0x4a, 0xb1, 0x4c, 0xf6, 0x01, 0x79, 0xfe, 0xd2, 0x01, 0x2e, 0xfe,
+    0x87, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe8,
+    0x01, 0xe1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xea,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x15, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe5,
+    0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe6,
+    0x01, 0xc1, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0xff, 0x60, 0x01, 0xd9,
+    0x02, 0x6f, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc,
+    0x02, 0x07, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x17, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe7,
+    0x01, 0xb4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x66, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7,
+    0x02, 0x03, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x13, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6,
+    0x01, 0xf4, 0x00, 0xa6, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xa6, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd9,
+    0x03, 0x1d, 0x00, 0x22, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xee,
+    0x01, 0xf3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xcf,
+    0x02, 0x6f, 0x00, 0x0d, 0x00, 0x2d, 0x40, 0x2a, 0x05, 0x01, 0x00, 0x01,
+    0x0a, 0x01, 0x02, 0x00, 0x00, 0x01, 0x03, 0x02, 0x03, 0x4a, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x03,
+    0x5d, 0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x14, 0x22, 0x11, 0x11, 0x04,
+    0x07, 0x18, 0x2b, 0x37, 0x01, 0x21, 0x35, 0x21, 0x15, 0x01, 0x21, 0x32,
+    0x36, 0x37, 0x33, 0x15, 0x21, 0x32, 0x01, 0x3a, 0xfe, 0xd2, 0x01, 0x81,
+    0xfe, 0xcb, 0x01, 0x19, 0x10, 0x0f, 0x06, 0x07, 0xfe, 0x63, 0x31, 0x01,
+    0xff, 0x3f, 0x31, 0xfe, 0x00, 0x04, 0x06, 0x48, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xcf, 0x03, 0x17, 0x00, 0x22, 0x00, 0xe5, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe8, 0x01, 0xeb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xcf, 0x03, 0x17, 0x00, 0x22, 0x00, 0xe5, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xeb, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xcf, 0x03, 0x17, 0x00, 0x22, 0x00, 0xe5, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xe6, 0x01, 0xcb, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0x60, 0x01, 0xcf, 0x02, 0x6f, 0x00, 0x22, 0x00, 0xe5, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x02, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2d,
+    0xff, 0xf5, 0x01, 0x99, 0x02, 0x6f, 0x00, 0x15, 0x00, 0x06, 0xb3, 0x03,
+    0x00, 0x01, 0x30, 0x2b, 0x16, 0x26, 0x35, 0x11, 0x33, 0x15, 0x06, 0x06,
+    0x15, 0x11, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14,
+    0x06, 0x23, 0x89, 0x5c, 0x46, 0x05, 0x03, 0x38, 0x40, 0x41, 0x38, 0x3d,
+    0x61, 0x56, 0x0b, 0x75, 0x6d, 0x01, 0x98, 0x07, 0x06, 0x0e, 0x11, 0xfe,
+    0x93, 0x50, 0x56, 0x56, 0x53, 0x01, 0x96, 0xfe, 0x6b, 0x73, 0x72, 0x00,
+    0x00, 0x02, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd, 0x01, 0xd3, 0x00, 0x19,
+    0x00, 0x23, 0x00, 0xcf, 0x40, 0x10, 0x17, 0x16, 0x02, 0x02, 0x03, 0x10,
+    0x01, 0x05, 0x02, 0x1c, 0x05, 0x02, 0x06, 0x05, 0x03, 0x4a, 0x4b, 0xb0,
+    0x0e, 0x50, 0x58, 0x40, 0x20, 0x00, 0x02, 0x00, 0x05, 0x06, 0x02, 0x05,
+    0x67, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x07, 0x01, 0x04, 0x04, 0x1f, 0x4b,
+    0x08, 0x01, 0x06, 0x06, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00,
+    0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x24, 0x00, 0x02, 0x00,
+    0x05, 0x06, 0x02, 0x05, 0x67, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x07, 0x01,
+    0x04, 0x04, 0x1f, 0x4b, 0x00, 0x00, 0x00, 0x15, 0x4b, 0x08, 0x01, 0x06,
+    0x06, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1d, 0x01, 0x4c, 0x1b, 0x4b, 0xb0,
+    0x17, 0x50, 0x58, 0x40, 0x20, 0x00, 0x02, 0x00, 0x05, 0x06, 0x02, 0x05,
+    0x67, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x07, 0x01, 0x04, 0x04, 0x1f, 0x4b,
+    0x08, 0x01, 0x06, 0x06, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00,
+    0x4c, 0x1b, 0x40, 0x24, 0x00, 0x02, 0x00, 0x05, 0x06, 0x02, 0x05, 0x67,
+    0x00, 0x03, 0x03, 0x04, 0x5f, 0x07, 0x01, 0x04, 0x04, 0x1f, 0x4b, 0x00,
+    0x00, 0x00, 0x15, 0x4b, 0x08, 0x01, 0x06, 0x06, 0x01, 0x5f, 0x00, 0x01,
+    0x01, 0x1d, 0x01, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x15, 0x1a, 0x1a, 0x00,
+    0x00, 0x1a, 0x23, 0x1a, 0x22, 0x1f, 0x1d, 0x00, 0x19, 0x00, 0x18, 0x23,
+    0x25, 0x22, 0x13, 0x09, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x15, 0x23,
+    0x35, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x33, 0x12, 0x36, 0x37,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x33, 0x01, 0x56, 0x67, 0x4e, 0x2a,
+    0x72, 0x4c, 0x56, 0x3e, 0x69, 0x3f, 0x39, 0x2e, 0x06, 0x45, 0x44, 0x22,
+    0x3f, 0x1a, 0x23, 0x40, 0x63, 0x30, 0x56, 0x04, 0x2d, 0x34, 0x4c, 0x58,
+    0x61, 0x01, 0xd3, 0x66, 0x7a, 0xf3, 0x46, 0x51, 0x45, 0x39, 0x30, 0x48,
+    0x27, 0x06, 0x4d, 0x3f, 0x1a, 0x19, 0x2e, 0x40, 0xfe, 0x59, 0x57, 0x52,
+    0x07, 0x32, 0x33, 0x4b, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd,
+    0x02, 0xaa, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce,
+    0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd,
+    0x02, 0x8e, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd3,
+    0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd,
+    0x03, 0x2d, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd3,
+    0x01, 0xec, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce, 0x01, 0xf4, 0x00, 0x83,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x83, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0x60, 0x01, 0xbd, 0x02, 0x8e, 0x00, 0x22,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd3, 0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x03, 0x2d, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd3, 0x01, 0xec, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcd,
+    0x01, 0xf4, 0x00, 0x83, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x83, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd,
+    0x03, 0x3f, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd3,
+    0x01, 0xec, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x01, 0xfd, 0x00, 0x7f,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x7f, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd, 0x03, 0x14, 0x00, 0x22,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd3, 0x01, 0xe8, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xf0, 0x01, 0xe7, 0x00, 0x77, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x77, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0xad, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xe6, 0x03, 0x26, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce,
+    0x02, 0x77, 0x00, 0x7c, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x7c, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0x60, 0x01, 0xbd,
+    0x02, 0xad, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc,
+    0x01, 0xff, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd, 0x03, 0x3b, 0x00, 0x22,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1, 0x01, 0xf6, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xcd, 0x02, 0x70, 0x00, 0x91, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x91, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xc8, 0x03, 0x24, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd1, 0x01, 0xf5, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7,
+    0x02, 0x7c, 0x00, 0x64, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x64, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd,
+    0x03, 0x2a, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1,
+    0x01, 0xf5, 0x00, 0x00, 0x01, 0x07, 0x02, 0xf0, 0x01, 0xec, 0x00, 0x8d,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x8d, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd, 0x02, 0xaa, 0x00, 0x22,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcd, 0x01, 0xa4, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x02, 0x44, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0x99, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcb, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0x60, 0x01, 0xbd, 0x01, 0xd3, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0xaa, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0xc0, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd7, 0x02, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0x84, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd9, 0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0x6d, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x31,
+    0xff, 0x50, 0x01, 0xbd, 0x01, 0xd3, 0x00, 0x29, 0x00, 0x33, 0x01, 0x51,
+    0x40, 0x18, 0x22, 0x21, 0x02, 0x04, 0x05, 0x1b, 0x01, 0x08, 0x04, 0x2c,
+    0x10, 0x02, 0x09, 0x08, 0x06, 0x01, 0x00, 0x03, 0x07, 0x01, 0x01, 0x00,
+    0x05, 0x4a, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x30, 0x00, 0x02, 0x09,
+    0x03, 0x00, 0x02, 0x70, 0x00, 0x04, 0x00, 0x08, 0x09, 0x04, 0x08, 0x67,
+    0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x1f, 0x4b, 0x0a, 0x01,
+    0x09, 0x09, 0x03, 0x5f, 0x07, 0x01, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x00,
+    0x00, 0x01, 0x60, 0x00, 0x01, 0x01, 0x21, 0x01, 0x4c, 0x1b, 0x4b, 0xb0,
+    0x0e, 0x50, 0x58, 0x40, 0x31, 0x00, 0x02, 0x09, 0x03, 0x09, 0x02, 0x03,
+    0x7e, 0x00, 0x04, 0x00, 0x08, 0x09, 0x04, 0x08, 0x67, 0x00, 0x05, 0x05,
+    0x06, 0x5f, 0x00, 0x06, 0x06, 0x1f, 0x4b, 0x0a, 0x01, 0x09, 0x09, 0x03,
+    0x5f, 0x07, 0x01, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x60,
+    0x00, 0x01, 0x01, 0x21, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58,
+    0x40, 0x35, 0x00, 0x02, 0x07, 0x03, 0x07, 0x02, 0x03, 0x7e, 0x00, 0x04,
+    0x00, 0x08, 0x09, 0x04, 0x08, 0x67, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00,
+    0x06, 0x06, 0x1f, 0x4b, 0x00, 0x07, 0x07, 0x15, 0x4b, 0x0a, 0x01, 0x09,
+    0x09, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x00, 0x00, 0x01,
+    0x60, 0x00, 0x01, 0x01, 0x21, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50,
+    0x58, 0x40, 0x31, 0x00, 0x02, 0x09, 0x03, 0x09, 0x02, 0x03, 0x7e, 0x00,
+    0x04, 0x00, 0x08, 0x09, 0x04, 0x08, 0x67, 0x00, 0x05, 0x05, 0x06, 0x5f,
+    0x00, 0x06, 0x06, 0x1f, 0x4b, 0x0a, 0x01, 0x09, 0x09, 0x03, 0x5f, 0x07,
+    0x01, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01,
+    0x01, 0x21, 0x01, 0x4c, 0x1b, 0x40, 0x35, 0x00, 0x02, 0x07, 0x03, 0x07,
+    0x02, 0x03, 0x7e, 0x00, 0x04, 0x00, 0x08, 0x09, 0x04, 0x08, 0x67, 0x00,
+    0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x1f, 0x4b, 0x00, 0x07, 0x07,
+    0x15, 0x4b, 0x0a, 0x01, 0x09, 0x09, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d,
+    0x4b, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x01, 0x01, 0x21, 0x01, 0x4c,
+    0x59, 0x59, 0x59, 0x59, 0x40, 0x12, 0x2a, 0x2a, 0x2a, 0x33, 0x2a, 0x32,
+    0x24, 0x13, 0x24, 0x23, 0x25, 0x22, 0x14, 0x23, 0x23, 0x0b, 0x07, 0x1d,
+    0x2b, 0x04, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x15, 0x06, 0x23, 0x22,
+    0x26, 0x35, 0x34, 0x37, 0x33, 0x35, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x17, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x23, 0x26, 0x36, 0x37, 0x26, 0x23,
+    0x22, 0x06, 0x15, 0x14, 0x33, 0x01, 0x52, 0x10, 0x0c, 0x1d, 0x1d, 0x1d,
+    0x26, 0x27, 0x2a, 0x50, 0x0b, 0x2a, 0x72, 0x4c, 0x56, 0x3e, 0x69, 0x3f,
+    0x39, 0x2e, 0x06, 0x45, 0x44, 0x22, 0x3f, 0x1a, 0x23, 0x40, 0x63, 0x62,
+    0x67, 0x17, 0x82, 0x56, 0x04, 0x2d, 0x34, 0x4c, 0x58, 0x61, 0x4b, 0x1b,
+    0x0c, 0x10, 0x17, 0x2e, 0x17, 0x22, 0x1b, 0x32, 0x41, 0x46, 0x51, 0x45,
+    0x39, 0x30, 0x48, 0x27, 0x06, 0x4d, 0x3f, 0x1a, 0x19, 0x2e, 0x40, 0x66,
+    0x7a, 0xf3, 0x2c, 0x57, 0x52, 0x07, 0x32, 0x33, 0x4b, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd, 0x02, 0xb5, 0x00, 0x22,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd4, 0x01, 0xed, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf5, 0x01, 0xbd, 0x03, 0x96, 0x00, 0x22,
+    0x00, 0xeb, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd4, 0x01, 0xed, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xce, 0x01, 0xe9, 0x00, 0xec, 0x00, 0x08, 0xb1, 0x04,
+    0x01, 0xb0, 0xec, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0xab, 0x00, 0x22, 0x00, 0xeb, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd5, 0x01, 0xea, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a,
+    0xff, 0xf5, 0x01, 0xee, 0x01, 0xd3, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x36,
+    0x00, 0xb2, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x14, 0x0b, 0x01, 0x01,
+    0x02, 0x10, 0x0a, 0x02, 0x00, 0x01, 0x23, 0x1d, 0x02, 0x05, 0x04, 0x1e,
+    0x01, 0x06, 0x05, 0x04, 0x4a, 0x1b, 0x40, 0x14, 0x0b, 0x01, 0x01, 0x02,
+    0x10, 0x0a, 0x02, 0x00, 0x01, 0x23, 0x1d, 0x02, 0x05, 0x0a, 0x1e, 0x01,
+    0x06, 0x05, 0x04, 0x4a, 0x59, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x26,
+    0x0d, 0x09, 0x02, 0x00, 0x0a, 0x01, 0x04, 0x05, 0x00, 0x04, 0x67, 0x08,
+    0x01, 0x01, 0x01, 0x02, 0x5f, 0x03, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x0e,
+    0x0b, 0x02, 0x05, 0x05, 0x06, 0x5f, 0x0c, 0x07, 0x02, 0x06, 0x06, 0x1d,
+    0x06, 0x4c, 0x1b, 0x40, 0x2b, 0x00, 0x04, 0x0a, 0x00, 0x04, 0x55, 0x0d,
+    0x09, 0x02, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x0a, 0x67, 0x08, 0x01, 0x01,
+    0x01, 0x02, 0x5f, 0x03, 0x01, 0x02, 0x02, 0x1f, 0x4b, 0x0e, 0x0b, 0x02,
+    0x05, 0x05, 0x06, 0x5f, 0x0c, 0x07, 0x02, 0x06, 0x06, 0x1d, 0x06, 0x4c,
+    0x59, 0x40, 0x20, 0x2e, 0x2e, 0x27, 0x27, 0x00, 0x00, 0x2e, 0x36, 0x2e,
+    0x35, 0x31, 0x30, 0x27, 0x2d, 0x27, 0x2d, 0x2b, 0x29, 0x00, 0x26, 0x00,
+    0x25, 0x23, 0x23, 0x12, 0x24, 0x23, 0x22, 0x14, 0x0f, 0x07, 0x1b, 0x2b,
+    0x16, 0x26, 0x35, 0x34, 0x36, 0x37, 0x34, 0x26, 0x23, 0x22, 0x07, 0x27,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x32, 0x15, 0x15, 0x07,
+    0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x17, 0x06, 0x23, 0x22, 0x26, 0x27,
+    0x06, 0x06, 0x23, 0x01, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x06, 0x36,
+    0x35, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x4b, 0x41, 0x6a, 0x69, 0x26,
+    0x29, 0x2d, 0x1f, 0x23, 0x2b, 0x49, 0x24, 0x3b, 0x10, 0x11, 0x39, 0x1e,
+    0x80, 0xd0, 0x38, 0x30, 0x2e, 0x1b, 0x23, 0x2c, 0x46, 0x26, 0x43, 0x14,
+    0x11, 0x3c, 0x24, 0x01, 0x22, 0x21, 0x25, 0x26, 0x2a, 0x5a, 0x1d, 0x52,
+    0x41, 0x22, 0x24, 0x0b, 0x4a, 0x3c, 0x49, 0x4f, 0x04, 0x43, 0x41, 0x2b,
+    0x2c, 0x37, 0x21, 0x1d, 0x1d, 0x21, 0xc7, 0x26, 0x07, 0x30, 0x3a, 0x46,
+    0x25, 0x2a, 0x35, 0x25, 0x20, 0x20, 0x25, 0x01, 0x27, 0x40, 0x3f, 0x45,
+    0x3f, 0xe5, 0x55, 0x54, 0x04, 0x29, 0x34, 0x28, 0x20, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x0a, 0xff, 0xf5, 0x01, 0xee, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce, 0x01, 0xf4, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x3c, 0xff, 0xf5, 0x01, 0xc9, 0x02, 0x99, 0x00, 0x15,
+    0x00, 0x20, 0x00, 0xb8, 0xb6, 0x0b, 0x02, 0x02, 0x05, 0x04, 0x01, 0x4a,
+    0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x01, 0x01, 0x16, 0x4b,
+    0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x07, 0x01,
+    0x05, 0x05, 0x00, 0x5f, 0x06, 0x03, 0x02, 0x00, 0x00, 0x15, 0x00, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x21, 0x00, 0x01, 0x01, 0x16,
+    0x4b, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1f, 0x4b, 0x00,
+    0x00, 0x00, 0x15, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01,
+    0x03, 0x03, 0x1d, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+    0x1d, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00,
+    0x02, 0x02, 0x1f, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x06, 0x03,
+    0x02, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x1b, 0x40, 0x21, 0x00, 0x01, 0x01,
+    0x16, 0x4b, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1f, 0x4b,
+    0x00, 0x00, 0x00, 0x15, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x03, 0x5f, 0x06,
+    0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x14, 0x16,
+    0x16, 0x00, 0x00, 0x16, 0x20, 0x16, 0x1f, 0x1c, 0x1a, 0x00, 0x15, 0x00,
+    0x14, 0x27, 0x11, 0x13, 0x08, 0x07, 0x17, 0x2b, 0x16, 0x26, 0x27, 0x07,
+    0x23, 0x11, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x22, 0x06, 0x15, 0x14, 0x33, 0xe1, 0x46, 0x18, 0x19, 0x2e, 0x52, 0x06,
+    0x03, 0x16, 0x4b, 0x27, 0x56, 0x66, 0x36, 0x58, 0x31, 0x2d, 0x48, 0x43,
+    0x39, 0x38, 0x46, 0x7c, 0x0b, 0x25, 0x22, 0x3c, 0x02, 0x99, 0x07, 0x06,
+    0x0e, 0x11, 0xea, 0x25, 0x2c, 0x78, 0x73, 0x4e, 0x6f, 0x37, 0x40, 0x55,
+    0x5b, 0x58, 0x59, 0x64, 0x4f, 0xae, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1b,
+    0xff, 0xf5, 0x01, 0xd9, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x23,
+    0x00, 0x3d, 0x40, 0x3a, 0x00, 0x04, 0x08, 0x01, 0x05, 0x03, 0x04, 0x05,
+    0x67, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x14, 0x4b, 0x07,
+    0x01, 0x03, 0x03, 0x01, 0x5f, 0x06, 0x01, 0x01, 0x01, 0x1d, 0x01, 0x4c,
+    0x18, 0x18, 0x0c, 0x0c, 0x00, 0x00, 0x18, 0x23, 0x18, 0x22, 0x1e, 0x1c,
+    0x0c, 0x17, 0x0c, 0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x09,
+    0x07, 0x15, 0x2b, 0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x8f, 0x74, 0x75, 0x6a, 0x6a, 0x75, 0x74, 0x6b, 0x48,
+    0x4f, 0x50, 0x47, 0x47, 0x50, 0x4f, 0x48, 0x10, 0x1a, 0x19, 0x13, 0x13,
+    0x1a, 0x1a, 0x13, 0x0b, 0xa6, 0x99, 0x95, 0xaa, 0xaa, 0x95, 0x99, 0xa6,
+    0x3d, 0x86, 0x7c, 0x77, 0x8b, 0x8b, 0x77, 0x7c, 0x86, 0xda, 0x1a, 0x12,
+    0x13, 0x1a, 0x1b, 0x12, 0x12, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38,
+    0xff, 0xf5, 0x01, 0xc9, 0x01, 0xd2, 0x00, 0x20, 0x00, 0x2f, 0x40, 0x2c,
+    0x1e, 0x1d, 0x0d, 0x0c, 0x0a, 0x05, 0x02, 0x01, 0x01, 0x4a, 0x00, 0x01,
+    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x03,
+    0x5f, 0x04, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x1f, 0x26, 0x2a, 0x26, 0x05, 0x07, 0x17, 0x2b, 0x16, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07, 0x27, 0x34,
+    0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x33, 0x32, 0x37, 0x17, 0x06, 0x23, 0xdb, 0x68, 0x3b, 0x3b, 0x68, 0x41,
+    0x37, 0x5a, 0x1c, 0x2d, 0x07, 0x05, 0x07, 0x0c, 0x15, 0x32, 0x22, 0x27,
+    0x43, 0x28, 0x29, 0x49, 0x2d, 0x45, 0x32, 0x2a, 0x43, 0x62, 0x0b, 0x3e,
+    0x6d, 0x44, 0x44, 0x6c, 0x3e, 0x2d, 0x28, 0x2c, 0x07, 0x05, 0x09, 0x0f,
+    0x0a, 0x13, 0x11, 0x2b, 0x4e, 0x33, 0x33, 0x52, 0x2e, 0x38, 0x31, 0x48,
+    0xff, 0xff, 0x00, 0x38, 0xff, 0xf5, 0x01, 0xc9, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x08, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce, 0x02, 0x0d, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x38, 0xff, 0xf5, 0x01, 0xc9, 0x02, 0xb0, 0x00, 0x22,
+    0x01, 0x08, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x02, 0x12, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x38, 0xff, 0x3b, 0x01, 0xc9, 0x01, 0xd2, 0x00, 0x33,
+    0x00, 0xb2, 0x40, 0x16, 0x25, 0x24, 0x22, 0x02, 0x01, 0x05, 0x06, 0x05,
+    0x05, 0x01, 0x02, 0x03, 0x0e, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x00, 0x01,
+    0x04, 0x4a, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x03,
+    0x01, 0x03, 0x02, 0x70, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04,
+    0x1f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d,
+    0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x28, 0x00, 0x02, 0x03, 0x01,
+    0x03, 0x02, 0x01, 0x7e, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04,
+    0x1f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d,
+    0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c,
+    0x1b, 0x40, 0x25, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00,
+    0x04, 0x04, 0x1f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03,
+    0x03, 0x1d, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x33,
+    0x00, 0x32, 0x2a, 0x26, 0x11, 0x23, 0x23, 0x2a, 0x08, 0x07, 0x1a, 0x2b,
+    0x24, 0x37, 0x17, 0x06, 0x07, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x22, 0x27, 0x37, 0x16, 0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37,
+    0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07,
+    0x27, 0x34, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x01, 0x66, 0x32, 0x2a, 0x39, 0x4a, 0x05, 0x2a, 0x2b,
+    0x3c, 0x38, 0x35, 0x2e, 0x19, 0x26, 0x31, 0x32, 0x1b, 0x18, 0x1e, 0x0a,
+    0x3f, 0x64, 0x38, 0x3b, 0x68, 0x41, 0x37, 0x5a, 0x1c, 0x2d, 0x07, 0x05,
+    0x07, 0x0c, 0x15, 0x32, 0x22, 0x27, 0x43, 0x28, 0x29, 0x49, 0x2d, 0x36,
+    0x38, 0x31, 0x3c, 0x0a, 0x26, 0x04, 0x25, 0x18, 0x24, 0x31, 0x1f, 0x2a,
+    0x1e, 0x24, 0x10, 0x11, 0x4a, 0x02, 0x40, 0x6b, 0x42, 0x44, 0x6c, 0x3e,
+    0x2d, 0x28, 0x2c, 0x07, 0x05, 0x09, 0x0f, 0x0a, 0x13, 0x11, 0x2b, 0x4e,
+    0x33, 0x33, 0x52, 0x2e, 0x00, 0x02, 0x00, 0x38, 0xff, 0x3b, 0x01, 0xc9,
+    0x02, 0xaa, 0x00, 0x03, 0x00, 0x37, 0x00, 0xb8, 0x40, 0x1c, 0x29, 0x28,
+    0x26, 0x06, 0x05, 0x05, 0x06, 0x05, 0x09, 0x01, 0x02, 0x03, 0x12, 0x01,
+    0x01, 0x02, 0x11, 0x01, 0x00, 0x01, 0x04, 0x4a, 0x03, 0x02, 0x01, 0x03,
+    0x04, 0x48, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x27, 0x00, 0x02, 0x03,
+    0x01, 0x03, 0x02, 0x70, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04,
+    0x1f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d,
+    0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x28, 0x00, 0x02, 0x03, 0x01,
+    0x03, 0x02, 0x01, 0x7e, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04,
+    0x1f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d,
+    0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c,
+    0x1b, 0x40, 0x25, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00,
+    0x04, 0x04, 0x1f, 0x4b, 0x07, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x00, 0x03,
+    0x03, 0x1d, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x0f, 0x04, 0x04, 0x04, 0x37,
+    0x04, 0x36, 0x2a, 0x26, 0x11, 0x23, 0x23, 0x2e, 0x08, 0x07, 0x1a, 0x2b,
+    0x01, 0x27, 0x37, 0x17, 0x02, 0x37, 0x17, 0x06, 0x07, 0x07, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37, 0x16, 0x33, 0x32, 0x35, 0x34,
+    0x26, 0x23, 0x23, 0x37, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x17, 0x07, 0x07, 0x27, 0x34, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x01, 0x17, 0x26, 0x54, 0x37,
+    0x16, 0x32, 0x2a, 0x39, 0x4a, 0x05, 0x2a, 0x2b, 0x3c, 0x38, 0x35, 0x2e,
+    0x19, 0x26, 0x31, 0x32, 0x1b, 0x18, 0x1e, 0x0a, 0x3f, 0x64, 0x38, 0x3b,
+    0x68, 0x41, 0x37, 0x5a, 0x1c, 0x2d, 0x07, 0x05, 0x07, 0x0c, 0x15, 0x32,
+    0x22, 0x27, 0x43, 0x28, 0x29, 0x49, 0x2d, 0x01, 0xfb, 0x1a, 0x95, 0x28,
+    0xfd, 0xb4, 0x38, 0x31, 0x3c, 0x0a, 0x26, 0x04, 0x25, 0x18, 0x24, 0x31,
+    0x1f, 0x2a, 0x1e, 0x24, 0x10, 0x11, 0x4a, 0x02, 0x40, 0x6b, 0x42, 0x44,
+    0x6c, 0x3e, 0x2d, 0x28, 0x2c, 0x07, 0x05, 0x09, 0x0f, 0x0a, 0x13, 0x11,
+    0x2b, 0x4e, 0x33, 0x33, 0x52, 0x2e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38,
+    0xff, 0xf5, 0x01, 0xc9, 0x02, 0xad, 0x00, 0x22, 0x01, 0x08, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd1, 0x02, 0x18, 0x00, 0x00, 0xff, 0xff, 0x00, 0x38,
+    0xff, 0xf5, 0x01, 0xc9, 0x02, 0x90, 0x00, 0x22, 0x01, 0x08, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcc, 0x02, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2d,
+    0xff, 0xf6, 0x01, 0xc1, 0x02, 0x99, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x68,
+    0xb6, 0x18, 0x0a, 0x02, 0x05, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50,
+    0x58, 0x40, 0x1d, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x02, 0x5f,
+    0x06, 0x03, 0x02, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x1b, 0x40, 0x21, 0x00,
+    0x01, 0x01, 0x16, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x1f, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x03,
+    0x5f, 0x06, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x59, 0x40, 0x14, 0x1c,
+    0x1c, 0x00, 0x00, 0x1c, 0x27, 0x1c, 0x26, 0x22, 0x20, 0x00, 0x1b, 0x00,
+    0x1a, 0x18, 0x13, 0x26, 0x08, 0x07, 0x17, 0x2b, 0x16, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x11, 0x33, 0x15, 0x06, 0x06,
+    0x15, 0x13, 0x14, 0x16, 0x17, 0x23, 0x26, 0x26, 0x35, 0x06, 0x06, 0x23,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0xb9, 0x56, 0x36, 0x38, 0x58, 0x31, 0x2e, 0x45, 0x12, 0x4c, 0x06, 0x03,
+    0x01, 0x03, 0x07, 0x47, 0x07, 0x03, 0x16, 0x45, 0x2b, 0x49, 0x3a, 0x3f,
+    0x3f, 0x3c, 0x40, 0x43, 0x3f, 0x0a, 0x37, 0x6e, 0x4e, 0x4f, 0x6a, 0x33,
+    0x2a, 0x25, 0x01, 0x13, 0x07, 0x06, 0x0e, 0x11, 0xfd, 0xda, 0x18, 0x1f,
+    0x10, 0x10, 0x1f, 0x18, 0x26, 0x2b, 0x3f, 0x62, 0x50, 0x51, 0x62, 0x59,
+    0x4d, 0x58, 0x67, 0x00, 0x00, 0x02, 0x00, 0x28, 0xff, 0xf4, 0x01, 0xcc,
+    0x02, 0xa0, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x3f, 0x40, 0x3c, 0x09, 0x01,
+    0x02, 0x00, 0x01, 0x4a, 0x16, 0x15, 0x14, 0x13, 0x11, 0x10, 0x0e, 0x0d,
+    0x0c, 0x0b, 0x0a, 0x00, 0x48, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00,
+    0x00, 0x1f, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01, 0x01,
+    0x01, 0x1d, 0x01, 0x4c, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x29, 0x1c, 0x28,
+    0x22, 0x20, 0x00, 0x1b, 0x00, 0x1a, 0x26, 0x06, 0x07, 0x15, 0x2b, 0x16,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x26, 0x27, 0x07,
+    0x27, 0x37, 0x26, 0x27, 0x37, 0x16, 0x17, 0x37, 0x17, 0x07, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x33, 0xc6, 0x63, 0x3b, 0x3a, 0x5d, 0x33, 0x4e,
+    0x31, 0x21, 0x35, 0x80, 0x12, 0x68, 0x30, 0x36, 0x51, 0x30, 0x27, 0x6c,
+    0x11, 0x55, 0x71, 0x6b, 0x61, 0x37, 0x4c, 0x50, 0x36, 0x22, 0x3e, 0x28,
+    0x25, 0x40, 0x26, 0x0c, 0x3d, 0x6c, 0x42, 0x41, 0x70, 0x43, 0x34, 0x4f,
+    0x3a, 0x24, 0x30, 0x1c, 0x28, 0x18, 0x10, 0x1b, 0x23, 0x1d, 0x2c, 0x19,
+    0x80, 0xbd, 0x7a, 0x8f, 0x3e, 0x5c, 0x5a, 0x59, 0x55, 0x28, 0x4f, 0x37,
+    0x35, 0x53, 0x2e, 0x00, 0x00, 0x03, 0x00, 0x19, 0xff, 0xf6, 0x01, 0xde,
+    0x02, 0x99, 0x00, 0x19, 0x00, 0x27, 0x00, 0x33, 0x00, 0x78, 0x40, 0x0c,
+    0x20, 0x1f, 0x02, 0x00, 0x01, 0x16, 0x0a, 0x02, 0x06, 0x05, 0x02, 0x4a,
+    0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1f, 0x08, 0x04, 0x02, 0x01, 0x01,
+    0x16, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1f, 0x4b,
+    0x09, 0x01, 0x06, 0x06, 0x02, 0x5f, 0x07, 0x03, 0x02, 0x02, 0x02, 0x15,
+    0x02, 0x4c, 0x1b, 0x40, 0x23, 0x08, 0x04, 0x02, 0x01, 0x01, 0x16, 0x4b,
+    0x00, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x00, 0x02,
+    0x02, 0x15, 0x4b, 0x09, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x07, 0x01, 0x03,
+    0x03, 0x1d, 0x03, 0x4c, 0x59, 0x40, 0x1a, 0x28, 0x28, 0x1a, 0x1a, 0x00,
+    0x00, 0x28, 0x33, 0x28, 0x32, 0x2e, 0x2c, 0x1a, 0x27, 0x1a, 0x26, 0x00,
+    0x19, 0x00, 0x18, 0x16, 0x13, 0x26, 0x0a, 0x07, 0x17, 0x2b, 0x16, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x11, 0x33, 0x14,
+    0x06, 0x15, 0x13, 0x14, 0x17, 0x23, 0x26, 0x35, 0x35, 0x06, 0x06, 0x23,
+    0x00, 0x16, 0x15, 0x14, 0x07, 0x07, 0x27, 0x37, 0x36, 0x35, 0x35, 0x34,
+    0x36, 0x33, 0x02, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0x8a, 0x47, 0x2a, 0x2f, 0x4a, 0x29, 0x24, 0x36, 0x0e, 0x4d,
+    0x0a, 0x01, 0x05, 0x48, 0x04, 0x11, 0x3c, 0x1e, 0x01, 0x14, 0x15, 0x05,
+    0x33, 0x2a, 0x0e, 0x06, 0x17, 0x12, 0xcd, 0x31, 0x2e, 0x29, 0x33, 0x34,
+    0x34, 0x30, 0x0a, 0x36, 0x6e, 0x4f, 0x4f, 0x6a, 0x33, 0x2a, 0x25, 0x01,
+    0x13, 0x06, 0x14, 0x07, 0xfd, 0xb3, 0x17, 0x14, 0x0b, 0x17, 0x27, 0x26,
+    0x2d, 0x02, 0xa3, 0x14, 0x10, 0x09, 0x0d, 0x7c, 0x10, 0x2c, 0x14, 0x1e,
+    0x20, 0x13, 0x15, 0xfd, 0x9c, 0x66, 0x4c, 0x51, 0x62, 0x58, 0x4e, 0x58,
+    0x67, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2d, 0xff, 0xf6, 0x01, 0xf4,
+    0x02, 0x99, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x78, 0xb6, 0x17, 0x09, 0x02,
+    0x09, 0x08, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x26, 0x07,
+    0x01, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x66, 0x00, 0x06, 0x06,
+    0x16, 0x4b, 0x00, 0x08, 0x08, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1f, 0x4b,
+    0x0a, 0x01, 0x09, 0x09, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x15, 0x01,
+    0x4c, 0x1b, 0x40, 0x2a, 0x07, 0x01, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05,
+    0x00, 0x66, 0x00, 0x06, 0x06, 0x16, 0x4b, 0x00, 0x08, 0x08, 0x03, 0x5f,
+    0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x01, 0x01, 0x15, 0x4b, 0x0a, 0x01,
+    0x09, 0x09, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1d, 0x02, 0x4c, 0x59, 0x40,
+    0x12, 0x24, 0x24, 0x24, 0x2f, 0x24, 0x2e, 0x25, 0x15, 0x11, 0x11, 0x13,
+    0x26, 0x25, 0x14, 0x10, 0x0b, 0x07, 0x1d, 0x2b, 0x01, 0x23, 0x13, 0x14,
+    0x16, 0x17, 0x23, 0x26, 0x26, 0x35, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x35, 0x23, 0x35, 0x33,
+    0x35, 0x33, 0x15, 0x06, 0x06, 0x15, 0x15, 0x33, 0x02, 0x36, 0x35, 0x34,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x01, 0xf4, 0x3e, 0x01,
+    0x03, 0x07, 0x47, 0x07, 0x03, 0x16, 0x45, 0x2b, 0x31, 0x56, 0x36, 0x38,
+    0x58, 0x31, 0x2e, 0x45, 0x12, 0x8d, 0x8d, 0x4c, 0x06, 0x03, 0x3e, 0xc1,
+    0x3a, 0x3f, 0x3f, 0x3c, 0x40, 0x43, 0x3f, 0x02, 0x08, 0xfe, 0x3f, 0x18,
+    0x1f, 0x10, 0x10, 0x1f, 0x18, 0x26, 0x2b, 0x37, 0x6e, 0x4e, 0x4f, 0x6a,
+    0x33, 0x2a, 0x25, 0x82, 0x39, 0x58, 0x07, 0x06, 0x0e, 0x11, 0x2c, 0xfd,
+    0xf4, 0x62, 0x50, 0x51, 0x62, 0x59, 0x4d, 0x58, 0x67, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0x60, 0x01, 0xc1, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x2d, 0xff, 0x65, 0x01, 0xc1, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2, 0x01, 0xf6, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x31, 0xff, 0xf6, 0x01, 0xbd, 0x01, 0xd4, 0x00, 0x14,
+    0x00, 0x1b, 0x00, 0x3d, 0x40, 0x3a, 0x12, 0x11, 0x02, 0x02, 0x01, 0x01,
+    0x4a, 0x07, 0x01, 0x05, 0x00, 0x01, 0x02, 0x05, 0x01, 0x65, 0x00, 0x04,
+    0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x03,
+    0x5f, 0x06, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x15, 0x15, 0x00, 0x00,
+    0x15, 0x1b, 0x15, 0x1b, 0x19, 0x17, 0x00, 0x14, 0x00, 0x13, 0x22, 0x14,
+    0x25, 0x08, 0x07, 0x17, 0x2b, 0x16, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x07, 0x21, 0x16, 0x16, 0x33, 0x32, 0x37, 0x17,
+    0x06, 0x23, 0x13, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0xaa, 0x79, 0x38,
+    0x5f, 0x3b, 0x53, 0x67, 0x02, 0xfe, 0xbb, 0x04, 0x56, 0x42, 0x48, 0x2e,
+    0x28, 0x3a, 0x66, 0x64, 0x41, 0x35, 0x32, 0x4a, 0x09, 0x0a, 0x7c, 0x71,
+    0x4b, 0x6d, 0x39, 0x6e, 0x6b, 0x0b, 0x16, 0x54, 0x56, 0x33, 0x27, 0x46,
+    0x01, 0x1c, 0x40, 0x4b, 0x46, 0x45, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0xaa, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xce, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0x8e, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd3, 0x01, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0xb0, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd2, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x31,
+    0xff, 0x3b, 0x01, 0xbd, 0x02, 0x8e, 0x00, 0x0d, 0x00, 0x35, 0x00, 0x3c,
+    0x00, 0xfa, 0x40, 0x1a, 0x16, 0x15, 0x02, 0x03, 0x02, 0x19, 0x01, 0x06,
+    0x07, 0x22, 0x01, 0x05, 0x06, 0x21, 0x01, 0x04, 0x05, 0x04, 0x4a, 0x0a,
+    0x09, 0x03, 0x02, 0x04, 0x00, 0x48, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40,
+    0x38, 0x00, 0x06, 0x07, 0x05, 0x07, 0x06, 0x70, 0x00, 0x00, 0x0b, 0x01,
+    0x01, 0x08, 0x00, 0x01, 0x67, 0x0c, 0x01, 0x0a, 0x00, 0x02, 0x03, 0x0a,
+    0x02, 0x65, 0x00, 0x09, 0x09, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1f, 0x4b,
+    0x00, 0x03, 0x03, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x1d, 0x4b, 0x00, 0x05,
+    0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x21, 0x04, 0x4c, 0x1b, 0x4b, 0xb0,
+    0x17, 0x50, 0x58, 0x40, 0x39, 0x00, 0x06, 0x07, 0x05, 0x07, 0x06, 0x05,
+    0x7e, 0x00, 0x00, 0x0b, 0x01, 0x01, 0x08, 0x00, 0x01, 0x67, 0x0c, 0x01,
+    0x0a, 0x00, 0x02, 0x03, 0x0a, 0x02, 0x65, 0x00, 0x09, 0x09, 0x08, 0x5f,
+    0x00, 0x08, 0x08, 0x1f, 0x4b, 0x00, 0x03, 0x03, 0x07, 0x5f, 0x00, 0x07,
+    0x07, 0x1d, 0x4b, 0x00, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x21,
+    0x04, 0x4c, 0x1b, 0x40, 0x36, 0x00, 0x06, 0x07, 0x05, 0x07, 0x06, 0x05,
+    0x7e, 0x00, 0x00, 0x0b, 0x01, 0x01, 0x08, 0x00, 0x01, 0x67, 0x0c, 0x01,
+    0x0a, 0x00, 0x02, 0x03, 0x0a, 0x02, 0x65, 0x00, 0x05, 0x00, 0x04, 0x05,
+    0x04, 0x63, 0x00, 0x09, 0x09, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1f, 0x4b,
+    0x00, 0x03, 0x03, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x1d, 0x07, 0x4c, 0x59,
+    0x59, 0x40, 0x20, 0x36, 0x36, 0x00, 0x00, 0x36, 0x3c, 0x36, 0x3c, 0x3a,
+    0x38, 0x33, 0x31, 0x2c, 0x2b, 0x2a, 0x28, 0x25, 0x23, 0x20, 0x1e, 0x14,
+    0x12, 0x10, 0x0f, 0x00, 0x0d, 0x00, 0x0c, 0x25, 0x0d, 0x07, 0x15, 0x2b,
+    0x12, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06,
+    0x06, 0x23, 0x12, 0x07, 0x21, 0x16, 0x16, 0x33, 0x32, 0x37, 0x17, 0x06,
+    0x07, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37, 0x16,
+    0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x27, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x07, 0xd6, 0x49, 0x17, 0x34, 0x10, 0x2c, 0x1e, 0x1e, 0x2c, 0x10, 0x34,
+    0x17, 0x49, 0x2e, 0xb9, 0x02, 0xfe, 0xbb, 0x04, 0x56, 0x42, 0x48, 0x2e,
+    0x28, 0x2e, 0x49, 0x05, 0x2a, 0x2b, 0x3c, 0x38, 0x35, 0x2e, 0x19, 0x26,
+    0x31, 0x32, 0x1b, 0x18, 0x1e, 0x0a, 0x65, 0x77, 0x38, 0x5f, 0x3b, 0x53,
+    0x67, 0x49, 0x41, 0x35, 0x32, 0x4a, 0x09, 0x02, 0x1a, 0x30, 0x2c, 0x18,
+    0x23, 0x21, 0x21, 0x23, 0x18, 0x2c, 0x30, 0xfe, 0xd6, 0x16, 0x54, 0x56,
+    0x33, 0x27, 0x37, 0x0c, 0x28, 0x04, 0x25, 0x18, 0x24, 0x31, 0x1f, 0x2a,
+    0x1e, 0x24, 0x10, 0x11, 0x4b, 0x01, 0x7c, 0x70, 0x4b, 0x6d, 0x39, 0x6e,
+    0x6b, 0x17, 0x40, 0x4b, 0x46, 0x45, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0xad, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd1, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xf0, 0x03, 0x26, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd1, 0x01, 0xfe, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce,
+    0x02, 0x81, 0x00, 0x7c, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x7c, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0x60, 0x01, 0xbd,
+    0x02, 0xad, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc,
+    0x02, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1, 0x01, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf6, 0x01, 0xbd, 0x03, 0x3b, 0x00, 0x22,
+    0x01, 0x15, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xcd, 0x02, 0x7a, 0x00, 0x91, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x91, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xd2, 0x03, 0x24, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd1, 0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7,
+    0x02, 0x86, 0x00, 0x64, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x64, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf6, 0x01, 0xbd,
+    0x03, 0x2a, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1,
+    0x01, 0xff, 0x00, 0x00, 0x01, 0x07, 0x02, 0xf0, 0x01, 0xf6, 0x00, 0x8d,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x8d, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0xf6, 0x01, 0xbd, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x15, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcd, 0x01, 0xae, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x02, 0x4e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0x99, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcb, 0x01, 0xfd, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0x90, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcc, 0x01, 0xf9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0x60, 0x01, 0xbd, 0x01, 0xd4, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x02, 0x1d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0xaa, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0xc0, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd7, 0x02, 0x0d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0x84, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd9, 0x01, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x02, 0x6d, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd6, 0x01, 0xfe, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31,
+    0xff, 0xf6, 0x01, 0xbd, 0x03, 0x44, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd6, 0x01, 0xfe, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce,
+    0x01, 0xf3, 0x00, 0x9a, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x9a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf6, 0x01, 0xbd,
+    0x03, 0x44, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd6,
+    0x01, 0xfe, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcd, 0x01, 0xf3, 0x00, 0x9a,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x31, 0xff, 0x50, 0x01, 0xbd, 0x01, 0xd4, 0x00, 0x22,
+    0x01, 0x15, 0x00, 0x00, 0x00, 0x02, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x37, 0xff, 0xf8, 0x01, 0xcf, 0x01, 0xd3, 0x00, 0x14,
+    0x00, 0x2b, 0x00, 0x46, 0x40, 0x43, 0x21, 0x01, 0x03, 0x02, 0x06, 0x01,
+    0x04, 0x03, 0x22, 0x01, 0x05, 0x04, 0x03, 0x4a, 0x00, 0x03, 0x00, 0x04,
+    0x05, 0x03, 0x04, 0x67, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x1f, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x01, 0x5f, 0x06, 0x01, 0x01, 0x01,
+    0x1d, 0x01, 0x4c, 0x15, 0x15, 0x00, 0x00, 0x15, 0x2b, 0x15, 0x2a, 0x26,
+    0x24, 0x20, 0x1e, 0x1b, 0x19, 0x00, 0x14, 0x00, 0x13, 0x2b, 0x08, 0x07,
+    0x15, 0x2b, 0x16, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x33, 0x32, 0x37,
+    0x15, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xc0, 0x58,
+    0x31, 0x2f, 0x29, 0x3c, 0x2d, 0x4e, 0x30, 0x3e, 0x5f, 0x34, 0x36, 0x61,
+    0x40, 0x3f, 0x4c, 0x4a, 0x3e, 0x2d, 0x2e, 0x5b, 0x10, 0x08, 0x07, 0x15,
+    0x08, 0x30, 0x3a, 0x40, 0x31, 0x08, 0x28, 0x45, 0x2a, 0x2a, 0x3a, 0x09,
+    0x22, 0x3a, 0x23, 0x38, 0x20, 0x3d, 0x6c, 0x45, 0x45, 0x6b, 0x3d, 0x3c,
+    0x5e, 0x54, 0x4f, 0x62, 0x25, 0x1f, 0x3e, 0x01, 0x43, 0x01, 0x02, 0x27,
+    0x26, 0x26, 0x2f, 0x00, 0xff, 0xff, 0x00, 0x31, 0xff, 0xf6, 0x01, 0xbd,
+    0x02, 0xab, 0x00, 0x22, 0x01, 0x15, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd5,
+    0x01, 0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x37, 0xff, 0xf5, 0x01, 0xc3,
+    0x01, 0xd3, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x3d, 0x40, 0x3a, 0x12, 0x11,
+    0x02, 0x01, 0x02, 0x01, 0x4a, 0x00, 0x01, 0x07, 0x01, 0x05, 0x04, 0x01,
+    0x05, 0x65, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x1f,
+    0x4b, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c,
+    0x15, 0x15, 0x00, 0x00, 0x15, 0x1b, 0x15, 0x1b, 0x19, 0x17, 0x00, 0x14,
+    0x00, 0x13, 0x22, 0x14, 0x25, 0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x21, 0x26, 0x26,
+    0x23, 0x22, 0x07, 0x27, 0x36, 0x33, 0x03, 0x14, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x01, 0x4a, 0x79, 0x38, 0x5f, 0x3b, 0x53, 0x67, 0x02, 0x01, 0x45,
+    0x04, 0x56, 0x42, 0x47, 0x2f, 0x28, 0x3a, 0x66, 0x64, 0x41, 0x35, 0x32,
+    0x4a, 0x09, 0x01, 0xd3, 0x7c, 0x71, 0x4b, 0x6d, 0x39, 0x6e, 0x6b, 0x0b,
+    0x16, 0x54, 0x56, 0x33, 0x27, 0x46, 0xfe, 0xe4, 0x40, 0x4b, 0x46, 0x45,
+    0xff, 0xff, 0x00, 0x5b, 0xff, 0x4f, 0x01, 0xc1, 0x01, 0xc9, 0x01, 0x07,
+    0x00, 0x44, 0x00, 0x14, 0xff, 0x5a, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8,
+    0xff, 0x5a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3f,
+    0x00, 0x00, 0x01, 0xd9, 0x02, 0x9f, 0x00, 0x1d, 0x00, 0x56, 0xb6, 0x0c,
+    0x0a, 0x02, 0x01, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40,
+    0x1c, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x05,
+    0x01, 0x00, 0x00, 0x01, 0x5d, 0x04, 0x01, 0x01, 0x01, 0x17, 0x4b, 0x00,
+    0x06, 0x06, 0x15, 0x06, 0x4c, 0x1b, 0x40, 0x1a, 0x00, 0x02, 0x00, 0x03,
+    0x01, 0x02, 0x03, 0x67, 0x05, 0x01, 0x00, 0x00, 0x01, 0x5d, 0x04, 0x01,
+    0x01, 0x01, 0x17, 0x4b, 0x00, 0x06, 0x06, 0x15, 0x06, 0x4c, 0x59, 0x40,
+    0x0a, 0x11, 0x11, 0x13, 0x2b, 0x23, 0x11, 0x10, 0x07, 0x07, 0x1b, 0x2b,
+    0x13, 0x23, 0x35, 0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07,
+    0x07, 0x27, 0x34, 0x26, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0xa2, 0x63, 0x63, 0x5b, 0x4d, 0x2c,
+    0x4b, 0x18, 0x26, 0x06, 0x06, 0x03, 0x08, 0x08, 0x0f, 0x20, 0x19, 0x2f,
+    0x36, 0x96, 0x96, 0x45, 0x01, 0x90, 0x39, 0x26, 0x58, 0x58, 0x20, 0x1f,
+    0x35, 0x08, 0x04, 0x02, 0x0d, 0x0e, 0x07, 0x0e, 0x0c, 0x38, 0x3e, 0x26,
+    0x39, 0xfe, 0x70, 0x00, 0x00, 0x03, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x01, 0xda, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x49, 0x00, 0xe2, 0x4b, 0xb0,
+    0x2e, 0x50, 0x58, 0x40, 0x14, 0x29, 0x01, 0x00, 0x04, 0x03, 0x01, 0x07,
+    0x00, 0x20, 0x0b, 0x02, 0x01, 0x07, 0x40, 0x1c, 0x02, 0x08, 0x02, 0x04,
+    0x4a, 0x1b, 0x40, 0x14, 0x29, 0x01, 0x00, 0x05, 0x03, 0x01, 0x07, 0x00,
+    0x20, 0x0b, 0x02, 0x01, 0x07, 0x40, 0x1c, 0x02, 0x08, 0x02, 0x04, 0x4a,
+    0x59, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x2a, 0x0a, 0x01, 0x07, 0x00,
+    0x01, 0x02, 0x07, 0x01, 0x67, 0x06, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x05,
+    0x01, 0x04, 0x04, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x08, 0x5f, 0x00, 0x08,
+    0x08, 0x15, 0x4b, 0x00, 0x09, 0x09, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x21,
+    0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x28, 0x0a, 0x01,
+    0x07, 0x00, 0x01, 0x02, 0x07, 0x01, 0x67, 0x00, 0x02, 0x00, 0x08, 0x09,
+    0x02, 0x08, 0x67, 0x06, 0x01, 0x00, 0x00, 0x04, 0x5f, 0x05, 0x01, 0x04,
+    0x04, 0x1f, 0x4b, 0x00, 0x09, 0x09, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x21,
+    0x03, 0x4c, 0x1b, 0x40, 0x32, 0x0a, 0x01, 0x07, 0x00, 0x01, 0x02, 0x07,
+    0x01, 0x67, 0x00, 0x02, 0x00, 0x08, 0x09, 0x02, 0x08, 0x67, 0x06, 0x01,
+    0x00, 0x00, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1f, 0x4b, 0x06, 0x01, 0x00,
+    0x00, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x1f, 0x4b, 0x00, 0x09, 0x09, 0x03,
+    0x5f, 0x00, 0x03, 0x03, 0x21, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x14, 0x2f,
+    0x2f, 0x47, 0x45, 0x3f, 0x3d, 0x2f, 0x3a, 0x2f, 0x39, 0x26, 0x23, 0x2f,
+    0x24, 0x25, 0x26, 0x20, 0x0b, 0x07, 0x1b, 0x2b, 0x00, 0x23, 0x22, 0x07,
+    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x27, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x26, 0x35, 0x34, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x17, 0x36, 0x36, 0x33, 0x17, 0x17, 0x06, 0x36, 0x35, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x16, 0x26, 0x26, 0x23, 0x22,
+    0x27, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x01, 0xd2,
+    0x11, 0x30, 0x20, 0x11, 0x27, 0x49, 0x30, 0x26, 0x21, 0x12, 0x3d, 0x4f,
+    0x61, 0x47, 0x60, 0x66, 0x62, 0x6f, 0x28, 0x1f, 0x21, 0x29, 0x19, 0x1a,
+    0x27, 0x49, 0x30, 0x49, 0x2c, 0x18, 0x33, 0x1f, 0x11, 0x09, 0xce, 0x39,
+    0x39, 0x2b, 0x2b, 0x39, 0x39, 0x2b, 0x99, 0x11, 0x32, 0x32, 0x48, 0x2b,
+    0x18, 0x13, 0x4c, 0x44, 0x42, 0x41, 0x01, 0x9b, 0x15, 0x22, 0x29, 0x2d,
+    0x49, 0x2a, 0x0e, 0x16, 0x14, 0x18, 0x15, 0x3b, 0x39, 0x3b, 0x4f, 0x3c,
+    0x3a, 0x24, 0x34, 0x0f, 0x16, 0x27, 0x28, 0x2c, 0x16, 0x3e, 0x25, 0x2c,
+    0x49, 0x2a, 0x2f, 0x16, 0x15, 0x01, 0x3b, 0xc3, 0x3a, 0x2a, 0x2a, 0x3a,
+    0x3a, 0x2a, 0x2a, 0x3a, 0xec, 0x1b, 0x0d, 0x0d, 0x10, 0x22, 0x1c, 0x22,
+    0x26, 0x27, 0x22, 0x00, 0xff, 0xff, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x02, 0x86, 0x00, 0x22, 0x01, 0x30, 0x00, 0x00, 0x00, 0x02, 0x02, 0xfd,
+    0x09, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x02, 0xb0, 0x00, 0x22, 0x01, 0x30, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd2,
+    0x01, 0xd6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x02, 0xad, 0x00, 0x22, 0x01, 0x30, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1,
+    0x01, 0xdc, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x03, 0x2b, 0x00, 0x22, 0x01, 0x30, 0x00, 0x00, 0x01, 0x07, 0x02, 0xda,
+    0x01, 0xea, 0xff, 0xf6, 0x00, 0x09, 0xb1, 0x03, 0x01, 0xb8, 0xff, 0xf6,
+    0xb0, 0x33, 0x2b, 0x00, 0xff, 0xff, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x02, 0x90, 0x00, 0x22, 0x01, 0x30, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc,
+    0x01, 0xd7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x26, 0xff, 0x54, 0x01, 0xdb,
+    0x02, 0x6d, 0x00, 0x22, 0x01, 0x30, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd6,
+    0x01, 0xdc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x49, 0x00, 0x00, 0x01, 0xb0,
+    0x02, 0x99, 0x00, 0x18, 0x00, 0x27, 0x40, 0x24, 0x06, 0x01, 0x02, 0x03,
+    0x01, 0x4a, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5f,
+    0x00, 0x01, 0x01, 0x1f, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x15, 0x02, 0x4c,
+    0x14, 0x23, 0x13, 0x27, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x13, 0x33, 0x15,
+    0x06, 0x06, 0x15, 0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x11, 0x23,
+    0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x49, 0x4f,
+    0x06, 0x03, 0x1b, 0x51, 0x2a, 0x41, 0x4a, 0x46, 0x2e, 0x26, 0x20, 0x3e,
+    0x29, 0x46, 0x02, 0x99, 0x07, 0x06, 0x0e, 0x11, 0xf5, 0x2a, 0x32, 0x5c,
+    0x63, 0xfe, 0xeb, 0x01, 0x13, 0x44, 0x3e, 0x23, 0x41, 0x2a, 0xfe, 0xf9,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0x02, 0x99, 0x00, 0x20,
+    0x00, 0x3b, 0x40, 0x38, 0x1d, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x06, 0x01,
+    0x04, 0x07, 0x01, 0x03, 0x08, 0x04, 0x03, 0x66, 0x00, 0x05, 0x05, 0x16,
+    0x4b, 0x00, 0x01, 0x01, 0x08, 0x5f, 0x09, 0x01, 0x08, 0x08, 0x1f, 0x4b,
+    0x02, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x1f, 0x11, 0x15, 0x11, 0x11, 0x11, 0x14, 0x23, 0x13, 0x0a, 0x07, 0x1c,
+    0x2b, 0x00, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x06,
+    0x06, 0x15, 0x15, 0x33, 0x15, 0x23, 0x15, 0x36, 0x36, 0x33, 0x01, 0x66,
+    0x4a, 0x46, 0x2e, 0x26, 0x20, 0x3e, 0x29, 0x46, 0x49, 0x49, 0x4f, 0x06,
+    0x03, 0x7f, 0x7f, 0x1b, 0x51, 0x2a, 0x01, 0xd4, 0x5c, 0x63, 0xfe, 0xeb,
+    0x01, 0x13, 0x44, 0x3e, 0x23, 0x41, 0x2a, 0xfe, 0xf9, 0x02, 0x08, 0x39,
+    0x58, 0x07, 0x06, 0x0e, 0x11, 0x2c, 0x39, 0x90, 0x2a, 0x32, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x49, 0xff, 0x51, 0x01, 0xb0, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x37, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe1, 0x01, 0xf6, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x01, 0xb0, 0x03, 0x41, 0x00, 0x22,
+    0x01, 0x37, 0x00, 0x00, 0x01, 0x07, 0x02, 0xea, 0x01, 0x70, 0x00, 0x2a,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x2a, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x49, 0xff, 0x60, 0x01, 0xb0, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x37, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0x90, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc, 0x01, 0xef, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x01, 0xc9, 0x00, 0x09,
+    0x00, 0x21, 0x40, 0x1e, 0x00, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02, 0x02,
+    0x17, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5d, 0x00, 0x04, 0x04, 0x15,
+    0x04, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x37,
+    0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x15, 0x21, 0x64, 0x75, 0x6f,
+    0xb7, 0x6b, 0xfe, 0xd8, 0x3a, 0x01, 0x55, 0x3a, 0xfe, 0x71, 0x3a, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0xb9, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x02, 0x02, 0xfc, 0xf8, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0x8e, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd3, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0xad, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0xec, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x8c, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcd, 0x01, 0xa4, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x02, 0x44, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64,
+    0x00, 0x00, 0x01, 0x8c, 0x02, 0x99, 0x00, 0x22, 0x01, 0x3d, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x01, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64,
+    0x00, 0x00, 0x01, 0x8c, 0x03, 0x3e, 0x00, 0x22, 0x01, 0x3d, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xcb, 0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce,
+    0x01, 0xea, 0x00, 0x94, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x94, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c,
+    0x02, 0x90, 0x00, 0x22, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc,
+    0x01, 0xef, 0x00, 0x00, 0xff, 0xff, 0x00, 0x64, 0xff, 0x60, 0x01, 0x8c,
+    0x02, 0x90, 0x00, 0x22, 0x01, 0x3d, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcc,
+    0x01, 0xef, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0xbb, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x02, 0x02, 0xf5, 0xce, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0xc0, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd7, 0x02, 0x03, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0x84, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd9, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0x6d, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x64, 0xff, 0x1d, 0x01, 0x8c, 0x02, 0x90, 0x00, 0x0b,
+    0x00, 0x22, 0x00, 0x3e, 0x40, 0x3b, 0x22, 0x12, 0x11, 0x03, 0x02, 0x47,
+    0x07, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x00,
+    0x04, 0x04, 0x05, 0x5d, 0x00, 0x05, 0x05, 0x17, 0x4b, 0x06, 0x01, 0x03,
+    0x03, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x00, 0x00, 0x21,
+    0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x00, 0x0b, 0x00,
+    0x0a, 0x24, 0x08, 0x07, 0x15, 0x2b, 0x12, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x12, 0x06, 0x15, 0x14, 0x16, 0x17,
+    0x07, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x23, 0x35, 0x33, 0x11, 0x23,
+    0x35, 0x33, 0x11, 0x33, 0x15, 0xe4, 0x1e, 0x1d, 0x16, 0x15, 0x1f, 0x1f,
+    0x15, 0x6d, 0x2c, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x30, 0x2e, 0xf2, 0x75,
+    0x6f, 0xb7, 0x6b, 0x02, 0x29, 0x1e, 0x15, 0x16, 0x1e, 0x1f, 0x15, 0x15,
+    0x1e, 0xfd, 0xb9, 0x42, 0x1b, 0x16, 0x1e, 0x04, 0x30, 0x07, 0x2e, 0x25,
+    0x23, 0x46, 0x20, 0x3a, 0x01, 0x55, 0x3a, 0xfe, 0x71, 0x3a, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x01, 0x8c, 0x02, 0x9d, 0x00, 0x22,
+    0x01, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xf0, 0x01, 0xea, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x30, 0xff, 0x52, 0x01, 0x7b, 0x02, 0x90, 0x00, 0x22,
+    0x01, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc, 0x02, 0x3d, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x30, 0xff, 0x52, 0x01, 0x71, 0x01, 0xc9, 0x00, 0x16,
+    0x00, 0x2c, 0x40, 0x29, 0x04, 0x02, 0x02, 0x00, 0x01, 0x01, 0x4a, 0x00,
+    0x01, 0x01, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x00, 0x00,
+    0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x21, 0x03, 0x4c, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x15, 0x11, 0x13, 0x2a, 0x05, 0x07, 0x17, 0x2b, 0x16, 0x26,
+    0x27, 0x37, 0x37, 0x17, 0x14, 0x16, 0x16, 0x17, 0x16, 0x33, 0x32, 0x36,
+    0x35, 0x11, 0x23, 0x35, 0x33, 0x11, 0x14, 0x06, 0x23, 0x96, 0x4c, 0x1a,
+    0x28, 0x06, 0x06, 0x03, 0x08, 0x08, 0x20, 0x2a, 0x2f, 0x38, 0xaa, 0xf3,
+    0x62, 0x4d, 0xae, 0x20, 0x20, 0x36, 0x08, 0x04, 0x02, 0x0d, 0x0e, 0x06,
+    0x19, 0x40, 0x42, 0x01, 0x7c, 0x3b, 0xfe, 0x4d, 0x63, 0x61, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x30, 0xff, 0x52, 0x01, 0xdf, 0x02, 0xad, 0x00, 0x22,
+    0x01, 0x4d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1, 0x02, 0x42, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x42, 0xff, 0xfc, 0x01, 0xdf, 0x02, 0x99, 0x00, 0x11,
+    0x00, 0x23, 0x40, 0x20, 0x0f, 0x0a, 0x01, 0x03, 0x00, 0x02, 0x01, 0x4a,
+    0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x17, 0x4b, 0x03, 0x01,
+    0x00, 0x00, 0x15, 0x00, 0x4c, 0x12, 0x27, 0x11, 0x12, 0x04, 0x07, 0x18,
+    0x2b, 0x37, 0x07, 0x15, 0x23, 0x11, 0x33, 0x15, 0x06, 0x06, 0x15, 0x11,
+    0x37, 0x16, 0x33, 0x33, 0x07, 0x13, 0x07, 0xc7, 0x3c, 0x49, 0x52, 0x06,
+    0x03, 0xe5, 0x19, 0x1c, 0x1a, 0xc0, 0xe0, 0x5d, 0xe5, 0x38, 0xad, 0x02,
+    0x99, 0x07, 0x06, 0x0e, 0x11, 0xfe, 0x8a, 0xd4, 0x05, 0xb5, 0xfe, 0xef,
+    0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x42, 0xfe, 0xed, 0x01, 0xdf,
+    0x02, 0x99, 0x00, 0x22, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x42, 0xff, 0xfc, 0x01, 0xdf,
+    0x01, 0xce, 0x00, 0x10, 0x00, 0x1f, 0x40, 0x1c, 0x0e, 0x09, 0x01, 0x03,
+    0x00, 0x01, 0x01, 0x4a, 0x02, 0x01, 0x01, 0x01, 0x17, 0x4b, 0x03, 0x01,
+    0x00, 0x00, 0x15, 0x00, 0x4c, 0x12, 0x26, 0x11, 0x12, 0x04, 0x07, 0x18,
+    0x2b, 0x37, 0x07, 0x15, 0x23, 0x11, 0x33, 0x14, 0x06, 0x15, 0x15, 0x37,
+    0x16, 0x33, 0x33, 0x07, 0x13, 0x07, 0xc7, 0x3c, 0x49, 0x52, 0x09, 0xe6,
+    0x19, 0x1c, 0x1a, 0xc1, 0xe0, 0x5d, 0xe5, 0x38, 0xad, 0x01, 0xc9, 0x04,
+    0x12, 0x04, 0xb8, 0xd7, 0x05, 0xb8, 0xfe, 0xef, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x01, 0xa5, 0x02, 0x99, 0x00, 0x09,
+    0x00, 0x21, 0x40, 0x1e, 0x00, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02, 0x02,
+    0x16, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5d, 0x00, 0x04, 0x04, 0x15,
+    0x04, 0x4c, 0x11, 0x11, 0x11, 0x11, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x37,
+    0x33, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x15, 0x21, 0x4f, 0x87, 0x81,
+    0xca, 0x86, 0xfe, 0xaa, 0x3a, 0x02, 0x25, 0x3a, 0xfd, 0xa1, 0x3a, 0x00,
+    0xff, 0xff, 0x00, 0x4f, 0x00, 0x00, 0x01, 0xa5, 0x03, 0x41, 0x00, 0x22,
+    0x01, 0x52, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8, 0x01, 0xe1, 0x00, 0x2a,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x2a, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x4f, 0x00, 0x00, 0x01, 0xc9, 0x02, 0x9f, 0x00, 0x22,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xf1, 0x00, 0xa4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x4f, 0xfe, 0xed, 0x01, 0xa5, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x45, 0x00, 0x00, 0x01, 0xc0, 0x02, 0x99, 0x00, 0x09,
+    0x00, 0x15, 0x00, 0x31, 0x40, 0x2e, 0x00, 0x05, 0x07, 0x01, 0x06, 0x00,
+    0x05, 0x06, 0x67, 0x00, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x16,
+    0x4b, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5d, 0x00, 0x04, 0x04, 0x15, 0x04,
+    0x4c, 0x0a, 0x0a, 0x0a, 0x15, 0x0a, 0x14, 0x25, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x08, 0x07, 0x1a, 0x2b, 0x37, 0x33, 0x11, 0x23, 0x35, 0x33, 0x11,
+    0x33, 0x15, 0x21, 0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x45, 0x73, 0x6d, 0xb6, 0x9a, 0xfe, 0xaa, 0x01, 0x26,
+    0x22, 0x23, 0x18, 0x17, 0x25, 0x23, 0x19, 0x3a, 0x02, 0x25, 0x3a, 0xfd,
+    0xa1, 0x3a, 0x01, 0x12, 0x21, 0x18, 0x18, 0x21, 0x22, 0x17, 0x17, 0x22,
+    0xff, 0xff, 0x00, 0x4f, 0xff, 0x60, 0x01, 0xa5, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x13, 0xff, 0x52, 0x01, 0xb2, 0x02, 0x99, 0x00, 0x09,
+    0x00, 0x15, 0x00, 0x29, 0x00, 0x9f, 0xb6, 0x18, 0x17, 0x02, 0x07, 0x04,
+    0x01, 0x4a, 0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x38, 0x00, 0x01, 0x01,
+    0x02, 0x5f, 0x05, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x0b, 0x01, 0x06, 0x06,
+    0x02, 0x5f, 0x05, 0x01, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x08, 0x08, 0x09,
+    0x5d, 0x00, 0x09, 0x09, 0x17, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5d,
+    0x00, 0x04, 0x04, 0x15, 0x4b, 0x00, 0x07, 0x07, 0x0a, 0x5f, 0x0c, 0x01,
+    0x0a, 0x0a, 0x21, 0x0a, 0x4c, 0x1b, 0x40, 0x36, 0x00, 0x01, 0x01, 0x02,
+    0x5d, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x0b, 0x01, 0x06, 0x06, 0x05, 0x5f,
+    0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x08, 0x08, 0x09, 0x5d, 0x00, 0x09,
+    0x09, 0x17, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5d, 0x00, 0x04, 0x04,
+    0x15, 0x4b, 0x00, 0x07, 0x07, 0x0a, 0x5f, 0x0c, 0x01, 0x0a, 0x0a, 0x21,
+    0x0a, 0x4c, 0x59, 0x40, 0x1b, 0x16, 0x16, 0x0a, 0x0a, 0x16, 0x29, 0x16,
+    0x28, 0x25, 0x24, 0x23, 0x22, 0x1f, 0x1d, 0x0a, 0x15, 0x0a, 0x14, 0x25,
+    0x11, 0x11, 0x11, 0x11, 0x10, 0x0d, 0x07, 0x1a, 0x2b, 0x37, 0x33, 0x11,
+    0x23, 0x35, 0x33, 0x11, 0x33, 0x15, 0x21, 0x00, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x02, 0x27, 0x37, 0x1e, 0x02,
+    0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x11, 0x23, 0x35, 0x33, 0x11, 0x14,
+    0x06, 0x07, 0x13, 0x41, 0x3b, 0x84, 0x7c, 0xfe, 0xfa, 0x01, 0x56, 0x1e,
+    0x1d, 0x16, 0x15, 0x1f, 0x1f, 0x15, 0xde, 0x34, 0x2f, 0x04, 0x08, 0x11,
+    0x16, 0x18, 0x17, 0x2f, 0x38, 0x8c, 0xd5, 0x63, 0x52, 0x3a, 0x02, 0x25,
+    0x3a, 0xfd, 0xa1, 0x3a, 0x02, 0x29, 0x1e, 0x15, 0x16, 0x1e, 0x1f, 0x15,
+    0x15, 0x1e, 0xfd, 0x29, 0x40, 0x3e, 0x04, 0x16, 0x11, 0x0a, 0x0b, 0x40,
+    0x42, 0x01, 0x7c, 0x3b, 0xfe, 0x4d, 0x62, 0x5e, 0x04, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x4f, 0xff, 0x65, 0x01, 0xa5, 0x02, 0x99, 0x00, 0x22,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2, 0x01, 0xf6, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x01, 0xa5, 0x02, 0x99, 0x00, 0x11,
+    0x00, 0x2e, 0x40, 0x2b, 0x0d, 0x0c, 0x0b, 0x0a, 0x05, 0x04, 0x03, 0x02,
+    0x08, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02,
+    0x02, 0x16, 0x4b, 0x03, 0x01, 0x00, 0x00, 0x04, 0x5d, 0x00, 0x04, 0x04,
+    0x15, 0x04, 0x4c, 0x11, 0x15, 0x11, 0x15, 0x10, 0x05, 0x07, 0x19, 0x2b,
+    0x37, 0x33, 0x35, 0x07, 0x35, 0x37, 0x11, 0x23, 0x35, 0x33, 0x11, 0x37,
+    0x15, 0x07, 0x15, 0x33, 0x15, 0x21, 0x4f, 0x87, 0x4f, 0x4f, 0x81, 0xca,
+    0x5b, 0x5b, 0x86, 0xfe, 0xaa, 0x3a, 0xdd, 0x1b, 0x42, 0x1b, 0x01, 0x06,
+    0x3a, 0xfe, 0xd9, 0x21, 0x45, 0x1f, 0xf5, 0x3a, 0x00, 0x01, 0x00, 0x26,
+    0x00, 0x00, 0x01, 0xd7, 0x01, 0xd4, 0x00, 0x24, 0x00, 0x8f, 0xb6, 0x08,
+    0x02, 0x02, 0x03, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
+    0x15, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5f, 0x02, 0x01, 0x02, 0x00, 0x00,
+    0x17, 0x4b, 0x07, 0x05, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b,
+    0xb0, 0x10, 0x50, 0x58, 0x40, 0x19, 0x00, 0x00, 0x00, 0x17, 0x4b, 0x06,
+    0x01, 0x04, 0x04, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x1f, 0x4b, 0x07,
+    0x05, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50,
+    0x58, 0x40, 0x15, 0x06, 0x01, 0x04, 0x04, 0x00, 0x5f, 0x02, 0x01, 0x02,
+    0x00, 0x00, 0x17, 0x4b, 0x07, 0x05, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c,
+    0x1b, 0x40, 0x19, 0x00, 0x00, 0x00, 0x17, 0x4b, 0x06, 0x01, 0x04, 0x04,
+    0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x1f, 0x4b, 0x07, 0x05, 0x02, 0x03,
+    0x03, 0x15, 0x03, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x0b, 0x14, 0x23, 0x14,
+    0x23, 0x13, 0x24, 0x23, 0x10, 0x08, 0x07, 0x1c, 0x2b, 0x13, 0x33, 0x15,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x36, 0x36, 0x33, 0x32, 0x16, 0x07,
+    0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23,
+    0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x26, 0x42,
+    0x10, 0x32, 0x1b, 0x1e, 0x2d, 0x06, 0x0d, 0x38, 0x22, 0x2d, 0x2d, 0x02,
+    0x42, 0x16, 0x15, 0x12, 0x22, 0x15, 0x43, 0x15, 0x1d, 0x0f, 0x1f, 0x14,
+    0x42, 0x01, 0xc9, 0x2d, 0x19, 0x1f, 0x26, 0x1d, 0x1e, 0x25, 0x41, 0x34,
+    0xfe, 0xa1, 0x01, 0x44, 0x39, 0x22, 0x22, 0x35, 0x1a, 0xfe, 0xd2, 0x01,
+    0x3e, 0x38, 0x27, 0x1b, 0x31, 0x20, 0xfe, 0xcf, 0xff, 0xff, 0x00, 0x26,
+    0xff, 0x60, 0x01, 0xd5, 0x01, 0xd4, 0x00, 0x22, 0x01, 0x5b, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x48,
+    0x00, 0x00, 0x01, 0xaf, 0x01, 0xd4, 0x00, 0x14, 0x00, 0x7e, 0xb5, 0x02,
+    0x01, 0x02, 0x03, 0x01, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x12,
+    0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x04,
+    0x01, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58,
+    0x40, 0x16, 0x00, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5f,
+    0x00, 0x01, 0x01, 0x1f, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x15, 0x02, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x12, 0x00, 0x03, 0x03, 0x00,
+    0x5f, 0x01, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x04, 0x01, 0x02, 0x02, 0x15,
+    0x02, 0x4c, 0x1b, 0x40, 0x16, 0x00, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x03,
+    0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x04, 0x01, 0x02, 0x02,
+    0x15, 0x02, 0x4c, 0x59, 0x59, 0x59, 0xb7, 0x14, 0x23, 0x13, 0x23, 0x10,
+    0x05, 0x07, 0x19, 0x2b, 0x13, 0x33, 0x15, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11,
+    0x23, 0x48, 0x46, 0x1b, 0x52, 0x2e, 0x3d, 0x49, 0x46, 0x2e, 0x26, 0x1f,
+    0x3f, 0x29, 0x46, 0x01, 0xc9, 0x51, 0x2a, 0x32, 0x5d, 0x62, 0xfe, 0xeb,
+    0x01, 0x13, 0x44, 0x3e, 0x24, 0x41, 0x29, 0xfe, 0xf9, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xaf, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce, 0x01, 0xf8, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xaf, 0x02, 0xb0, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x01, 0xfd, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0xfe, 0xed, 0x01, 0xaf, 0x01, 0xd4, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde, 0x02, 0x0c, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xaf, 0x02, 0x90, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc, 0x01, 0xfe, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0xff, 0x60, 0x01, 0xaf, 0x01, 0xd4, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x02, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x44, 0xff, 0x50, 0x01, 0xb0, 0x01, 0xd4, 0x00, 0x1f,
+    0x00, 0xb6, 0x40, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x02,
+    0x01, 0x01, 0x05, 0x00, 0x03, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
+    0x1c, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x17, 0x4b,
+    0x00, 0x02, 0x02, 0x15, 0x4b, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x06, 0x01,
+    0x05, 0x05, 0x21, 0x05, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40,
+    0x20, 0x00, 0x03, 0x03, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5f, 0x00,
+    0x04, 0x04, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x4b, 0x00, 0x00, 0x00,
+    0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x21, 0x05, 0x4c, 0x1b, 0x4b, 0xb0,
+    0x17, 0x50, 0x58, 0x40, 0x1c, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x04, 0x01,
+    0x03, 0x03, 0x17, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x4b, 0x00, 0x00, 0x00,
+    0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x21, 0x05, 0x4c, 0x1b, 0x40, 0x20,
+    0x00, 0x03, 0x03, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5f, 0x00, 0x04,
+    0x04, 0x1f, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x4b, 0x00, 0x00, 0x00, 0x05,
+    0x5f, 0x06, 0x01, 0x05, 0x05, 0x21, 0x05, 0x4c, 0x59, 0x59, 0x59, 0x40,
+    0x0e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x1e, 0x23, 0x11, 0x14, 0x24, 0x25,
+    0x07, 0x07, 0x19, 0x2b, 0x16, 0x27, 0x37, 0x1e, 0x02, 0x33, 0x32, 0x35,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x11, 0x33,
+    0x15, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x14, 0x06, 0x23, 0xd0,
+    0x2b, 0x22, 0x02, 0x0c, 0x1a, 0x19, 0x61, 0x2e, 0x26, 0x20, 0x3f, 0x28,
+    0x4a, 0x4a, 0x1a, 0x51, 0x2a, 0x41, 0x4c, 0x5d, 0x4d, 0xb0, 0x22, 0x43,
+    0x01, 0x13, 0x0e, 0x9a, 0xe6, 0x44, 0x3e, 0x24, 0x41, 0x29, 0xfe, 0xf9,
+    0x01, 0xc9, 0x51, 0x2a, 0x32, 0x5c, 0x63, 0xdd, 0x75, 0x73, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0xff, 0x65, 0x01, 0xaf, 0x01, 0xd4, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2, 0x02, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xb4, 0x02, 0xab, 0x00, 0x22,
+    0x01, 0x5d, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd5, 0x01, 0xf9, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x01, 0xd3, 0x00, 0x0f,
+    0x00, 0x1d, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x1f, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01,
+    0x01, 0x01, 0x1d, 0x01, 0x4c, 0x10, 0x10, 0x00, 0x00, 0x10, 0x1d, 0x10,
+    0x1c, 0x17, 0x15, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x06, 0x07, 0x15, 0x2b,
+    0x16, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x33, 0xbd, 0x60, 0x36, 0x36, 0x60, 0x3d, 0x3d,
+    0x60, 0x36, 0x36, 0x60, 0x3d, 0x27, 0x3d, 0x23, 0x4c, 0x3b, 0x3b, 0x4c,
+    0x23, 0x3d, 0x27, 0x08, 0x3c, 0x6c, 0x45, 0x45, 0x6c, 0x3d, 0x3d, 0x6c,
+    0x45, 0x45, 0x6c, 0x3c, 0x3c, 0x2e, 0x51, 0x33, 0x4e, 0x63, 0x63, 0x4e,
+    0x33, 0x51, 0x2e, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x02, 0xaa, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce,
+    0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x02, 0x8e, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd3,
+    0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x02, 0xad, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xe6,
+    0x03, 0x26, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce, 0x02, 0x77, 0x00, 0x7c,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x7c, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0x60, 0x01, 0xcd, 0x02, 0xad, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x03, 0x3b, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd1, 0x01, 0xf6, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcd,
+    0x02, 0x70, 0x00, 0x91, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x91, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x03, 0x24, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1,
+    0x01, 0xf5, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7, 0x02, 0x7c, 0x00, 0x64,
+    0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x64, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x03, 0x2a, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd1, 0x01, 0xf5, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xf0, 0x01, 0xec, 0x00, 0x8d, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x8d, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x02, 0xaa, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xcd, 0x01, 0xa4, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcd,
+    0x02, 0x44, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x02, 0x99, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcb,
+    0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x03, 0x01, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcb,
+    0x01, 0xf3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd6, 0x01, 0xf5, 0x00, 0x94,
+    0x00, 0x08, 0xb1, 0x04, 0x01, 0xb0, 0x94, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x03, 0x01, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcc, 0x01, 0xef, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x94, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x94, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0x60, 0x01, 0xcd, 0x01, 0xd3, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x02, 0xaa, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x02, 0xc0, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd7, 0x02, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x02, 0x08, 0x00, 0x17, 0x00, 0x25, 0x00, 0x66,
+    0xb5, 0x17, 0x01, 0x05, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+    0x40, 0x20, 0x00, 0x03, 0x01, 0x03, 0x83, 0x00, 0x02, 0x02, 0x17, 0x4b,
+    0x00, 0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x06, 0x01,
+    0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x1b, 0x40,
+    0x23, 0x00, 0x03, 0x01, 0x03, 0x83, 0x00, 0x02, 0x01, 0x04, 0x01, 0x02,
+    0x04, 0x7e, 0x00, 0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f, 0x4b,
+    0x06, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c,
+    0x59, 0x40, 0x0e, 0x18, 0x18, 0x18, 0x25, 0x18, 0x24, 0x29, 0x12, 0x11,
+    0x26, 0x25, 0x07, 0x07, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x36,
+    0x36, 0x35, 0x33, 0x14, 0x06, 0x07, 0x02, 0x36, 0x36, 0x35, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x01, 0xb1, 0x1c, 0x36,
+    0x60, 0x3d, 0x3d, 0x60, 0x36, 0x36, 0x60, 0x3d, 0x3e, 0x30, 0x10, 0x0d,
+    0x40, 0x13, 0x1b, 0x76, 0x3d, 0x23, 0x4c, 0x3b, 0x3b, 0x4c, 0x23, 0x3d,
+    0x27, 0x01, 0x6a, 0x54, 0x31, 0x45, 0x6c, 0x3c, 0x3c, 0x6c, 0x45, 0x45,
+    0x6c, 0x3d, 0x1f, 0x01, 0x22, 0x31, 0x3a, 0x39, 0x0b, 0xfe, 0xaa, 0x2e,
+    0x51, 0x33, 0x4e, 0x63, 0x63, 0x4e, 0x33, 0x51, 0x2e, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x76, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce, 0x01, 0xe9, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0x60, 0x01, 0xcd, 0x02, 0x08, 0x00, 0x22,
+    0x01, 0x76, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x76, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcd, 0x01, 0xe9, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0xc0, 0x00, 0x22,
+    0x01, 0x76, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd7, 0x02, 0x03, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0xab, 0x00, 0x22,
+    0x01, 0x76, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd5, 0x01, 0xea, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0xbb, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcf, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0x84, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd9, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x02, 0x6d, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x03, 0x44, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xce, 0x01, 0xe9, 0x00, 0x9a, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x03, 0x44, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcd,
+    0x01, 0xe9, 0x00, 0x9a, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0x9a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x27, 0xff, 0x27, 0x01, 0xcd,
+    0x01, 0xd3, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x24, 0x40, 0x21, 0x06, 0x05,
+    0x02, 0x00, 0x47, 0x00, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f,
+    0x4b, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c,
+    0x25, 0x29, 0x26, 0x2b, 0x04, 0x07, 0x18, 0x2b, 0x04, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0x07, 0x26, 0x26, 0x35, 0x34, 0x37, 0x23, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x26, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x01, 0x29, 0x2b, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x47, 0x09,
+    0x3d, 0x60, 0x36, 0x36, 0x60, 0x3d, 0x3d, 0x60, 0x36, 0x44, 0x3a, 0xdc,
+    0x23, 0x3d, 0x27, 0x27, 0x3d, 0x23, 0x4c, 0x3b, 0x3b, 0x4c, 0x14, 0x42,
+    0x1b, 0x16, 0x1e, 0x04, 0x30, 0x07, 0x2e, 0x25, 0x3c, 0x3b, 0x3c, 0x6c,
+    0x45, 0x45, 0x6c, 0x3d, 0x3d, 0x6c, 0x45, 0x4d, 0x74, 0x1a, 0xa9, 0x51,
+    0x2e, 0x2e, 0x51, 0x33, 0x4e, 0x63, 0x63, 0x4e, 0x00, 0x03, 0x00, 0x28,
+    0xff, 0xc0, 0x01, 0xcc, 0x02, 0x07, 0x00, 0x15, 0x00, 0x1e, 0x00, 0x27,
+    0x00, 0x40, 0x40, 0x3d, 0x0c, 0x09, 0x02, 0x02, 0x00, 0x25, 0x24, 0x1e,
+    0x03, 0x03, 0x02, 0x14, 0x01, 0x02, 0x01, 0x03, 0x03, 0x4a, 0x0b, 0x0a,
+    0x02, 0x00, 0x48, 0x15, 0x01, 0x01, 0x47, 0x00, 0x02, 0x02, 0x00, 0x5f,
+    0x00, 0x00, 0x00, 0x1f, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x00,
+    0x01, 0x01, 0x1d, 0x01, 0x4c, 0x1f, 0x1f, 0x1f, 0x27, 0x1f, 0x26, 0x24,
+    0x29, 0x26, 0x05, 0x07, 0x17, 0x2b, 0x17, 0x37, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x17, 0x37, 0x17, 0x07, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x22, 0x27, 0x07, 0x13, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x17, 0x16, 0x36, 0x36, 0x35, 0x34, 0x27, 0x03, 0x16, 0x33, 0x46, 0x2c,
+    0x4a, 0x3b, 0x64, 0x3a, 0x26, 0x28, 0x25, 0x35, 0x27, 0x4a, 0x37, 0x5d,
+    0x39, 0x32, 0x2b, 0x28, 0xb6, 0x19, 0x1b, 0x24, 0x3f, 0x25, 0x22, 0x8d,
+    0x3d, 0x24, 0x25, 0x9d, 0x1d, 0x20, 0x25, 0x51, 0x47, 0x6a, 0x46, 0x70,
+    0x40, 0x11, 0x45, 0x1d, 0x49, 0x44, 0x74, 0x4b, 0x6f, 0x3b, 0x16, 0x4a,
+    0x01, 0xc9, 0x0d, 0x2c, 0x4e, 0x31, 0x4c, 0x31, 0x3c, 0x2a, 0x4f, 0x34,
+    0x52, 0x31, 0xfe, 0xe1, 0x11, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x28,
+    0xff, 0xc0, 0x01, 0xcc, 0x02, 0xaa, 0x00, 0x22, 0x01, 0x82, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xce, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x02, 0xab, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd5, 0x01, 0xea, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27,
+    0xff, 0xf8, 0x01, 0xcd, 0x03, 0x5d, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xd5, 0x01, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce,
+    0x01, 0xe9, 0x00, 0xb3, 0x00, 0x08, 0xb1, 0x03, 0x01, 0xb0, 0xb3, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd,
+    0x03, 0x4c, 0x00, 0x22, 0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd5,
+    0x01, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcb, 0x01, 0xf3, 0x00, 0xb3,
+    0x00, 0x08, 0xb1, 0x03, 0x02, 0xb0, 0xb3, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x27, 0xff, 0xf8, 0x01, 0xcd, 0x03, 0x20, 0x00, 0x22,
+    0x01, 0x66, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd5, 0x01, 0xea, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0xb3, 0x00, 0x08, 0xb1, 0x03,
+    0x01, 0xb0, 0xb3, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06,
+    0xff, 0xf4, 0x01, 0xee, 0x01, 0xd2, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x34,
+    0x00, 0x90, 0x40, 0x10, 0x0b, 0x01, 0x06, 0x01, 0x25, 0x18, 0x02, 0x04,
+    0x03, 0x19, 0x01, 0x02, 0x00, 0x04, 0x03, 0x4a, 0x4b, 0xb0, 0x2e, 0x50,
+    0x58, 0x40, 0x24, 0x0b, 0x01, 0x07, 0x00, 0x03, 0x04, 0x07, 0x03, 0x65,
+    0x08, 0x01, 0x06, 0x06, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x1f, 0x4b,
+    0x0c, 0x09, 0x02, 0x04, 0x04, 0x00, 0x5f, 0x0a, 0x05, 0x02, 0x00, 0x00,
+    0x1d, 0x00, 0x4c, 0x1b, 0x40, 0x2e, 0x0b, 0x01, 0x07, 0x00, 0x03, 0x04,
+    0x07, 0x03, 0x65, 0x00, 0x06, 0x06, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01,
+    0x1f, 0x4b, 0x00, 0x08, 0x08, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01, 0x1f,
+    0x4b, 0x0c, 0x09, 0x02, 0x04, 0x04, 0x00, 0x5f, 0x0a, 0x05, 0x02, 0x00,
+    0x00, 0x1d, 0x00, 0x4c, 0x59, 0x40, 0x1e, 0x23, 0x23, 0x1c, 0x1c, 0x00,
+    0x00, 0x23, 0x34, 0x23, 0x33, 0x2f, 0x2d, 0x1c, 0x22, 0x1c, 0x22, 0x20,
+    0x1e, 0x00, 0x1b, 0x00, 0x1a, 0x23, 0x13, 0x22, 0x24, 0x22, 0x0d, 0x07,
+    0x19, 0x2b, 0x04, 0x27, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x17, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x23, 0x1e, 0x02, 0x33,
+    0x32, 0x37, 0x17, 0x06, 0x23, 0x13, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x06, 0x36, 0x35, 0x27, 0x26, 0x35, 0x34, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x01, 0x2f, 0x32, 0x2b, 0x38, 0x3d,
+    0x57, 0x58, 0x43, 0x3c, 0x22, 0x27, 0x3e, 0x40, 0x46, 0xe4, 0x01, 0x17,
+    0x2b, 0x22, 0x3d, 0x23, 0x23, 0x34, 0x46, 0x3b, 0x26, 0x2b, 0x28, 0x2f,
+    0x4f, 0x1d, 0x03, 0x0a, 0x09, 0x1c, 0x14, 0x28, 0x37, 0x33, 0x2e, 0x0c,
+    0x29, 0x28, 0x6d, 0x82, 0x7b, 0x73, 0x2e, 0x2e, 0x5d, 0x5a, 0x3e, 0x46,
+    0x4b, 0x1d, 0x26, 0x2b, 0x36, 0x01, 0x22, 0x47, 0x3e, 0x46, 0x3f, 0xe4,
+    0x16, 0x11, 0x17, 0x3b, 0x43, 0x39, 0x3e, 0x05, 0x13, 0x19, 0x52, 0x55,
+    0x5e, 0x5f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3c, 0xff, 0x59, 0x01, 0xcf,
+    0x01, 0xd3, 0x00, 0x12, 0x00, 0x1e, 0x00, 0x60, 0xb6, 0x10, 0x02, 0x02,
+    0x05, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1c, 0x00,
+    0x04, 0x04, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x06, 0x01,
+    0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1d, 0x4b, 0x00, 0x03, 0x03,
+    0x19, 0x03, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x00, 0x00, 0x17, 0x4b, 0x00,
+    0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x06, 0x01, 0x05,
+    0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1d, 0x4b, 0x00, 0x03, 0x03, 0x19,
+    0x03, 0x4c, 0x59, 0x40, 0x0e, 0x13, 0x13, 0x13, 0x1e, 0x13, 0x1d, 0x25,
+    0x13, 0x26, 0x23, 0x10, 0x07, 0x07, 0x19, 0x2b, 0x13, 0x33, 0x15, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
+    0x27, 0x15, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x16, 0x16, 0x33, 0x3c, 0x49, 0x0f, 0x4a, 0x32, 0x34, 0x57, 0x34, 0x36,
+    0x59, 0x32, 0x29, 0x48, 0x17, 0x4a, 0xfd, 0x4b, 0x42, 0x3d, 0x39, 0x47,
+    0x02, 0x42, 0x39, 0x01, 0xc9, 0x5a, 0x32, 0x32, 0x35, 0x6a, 0x4c, 0x4d,
+    0x6f, 0x38, 0x26, 0x22, 0xe3, 0xdb, 0x53, 0x5e, 0x55, 0x5b, 0x5f, 0x61,
+    0x4f, 0x52, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3c, 0xff, 0x59, 0x01, 0xcf,
+    0x02, 0x99, 0x00, 0x15, 0x00, 0x21, 0x00, 0x38, 0x40, 0x35, 0x13, 0x05,
+    0x02, 0x05, 0x04, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x04,
+    0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x06, 0x01, 0x05, 0x05,
+    0x02, 0x5f, 0x00, 0x02, 0x02, 0x1d, 0x4b, 0x00, 0x03, 0x03, 0x19, 0x03,
+    0x4c, 0x16, 0x16, 0x16, 0x21, 0x16, 0x20, 0x25, 0x13, 0x26, 0x26, 0x10,
+    0x07, 0x07, 0x19, 0x2b, 0x13, 0x33, 0x14, 0x06, 0x15, 0x15, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
+    0x15, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x16,
+    0x16, 0x33, 0x3c, 0x50, 0x07, 0x17, 0x4d, 0x27, 0x34, 0x57, 0x34, 0x36,
+    0x58, 0x32, 0x2a, 0x48, 0x17, 0x4a, 0xfd, 0x4b, 0x44, 0x3d, 0x39, 0x45,
+    0x02, 0x3f, 0x3a, 0x02, 0x99, 0x07, 0x19, 0x0b, 0xeb, 0x24, 0x2c, 0x35,
+    0x6a, 0x4c, 0x4d, 0x6f, 0x38, 0x26, 0x22, 0xe3, 0xdb, 0x4e, 0x59, 0x58,
+    0x63, 0x60, 0x5a, 0x5a, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2a,
+    0xff, 0x59, 0x01, 0xba, 0x01, 0xd5, 0x00, 0x12, 0x00, 0x1d, 0x00, 0x60,
+    0xb6, 0x0e, 0x00, 0x02, 0x05, 0x04, 0x01, 0x4a, 0x4b, 0xb0, 0x09, 0x50,
+    0x58, 0x40, 0x1c, 0x00, 0x04, 0x04, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x01,
+    0x1f, 0x4b, 0x06, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d,
+    0x4b, 0x00, 0x03, 0x03, 0x19, 0x03, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x02,
+    0x02, 0x17, 0x4b, 0x00, 0x04, 0x04, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f,
+    0x4b, 0x06, 0x01, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x4b,
+    0x00, 0x03, 0x03, 0x19, 0x03, 0x4c, 0x59, 0x40, 0x0e, 0x13, 0x13, 0x13,
+    0x1d, 0x13, 0x1c, 0x24, 0x11, 0x13, 0x26, 0x22, 0x07, 0x07, 0x19, 0x2b,
+    0x25, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x35, 0x33, 0x11, 0x23, 0x26, 0x36, 0x35, 0x34, 0x23,
+    0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x01, 0x72, 0x15, 0x4a, 0x2d, 0x34,
+    0x56, 0x32, 0x36, 0x5c, 0x37, 0x2f, 0x42, 0x12, 0x44, 0x48, 0x47, 0x45,
+    0x75, 0x3c, 0x4c, 0x45, 0x3b, 0x49, 0x27, 0x2c, 0x3d, 0x6d, 0x46, 0x49,
+    0x6d, 0x39, 0x29, 0x26, 0x43, 0xfd, 0x90, 0xdc, 0x5d, 0x5f, 0xa9, 0x5a,
+    0x57, 0x53, 0x61, 0x00, 0x00, 0x01, 0x00, 0x77, 0xff, 0xff, 0x01, 0xca,
+    0x01, 0xd4, 0x00, 0x15, 0x00, 0x89, 0x40, 0x0b, 0x01, 0x01, 0x00, 0x02,
+    0x12, 0x03, 0x02, 0x01, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58,
+    0x40, 0x12, 0x00, 0x00, 0x00, 0x02, 0x5f, 0x04, 0x03, 0x02, 0x02, 0x02,
+    0x17, 0x4b, 0x00, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x10,
+    0x50, 0x58, 0x40, 0x16, 0x00, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x00, 0x00,
+    0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x01, 0x01, 0x15,
+    0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x12, 0x00, 0x00,
+    0x00, 0x02, 0x5f, 0x04, 0x03, 0x02, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x01,
+    0x01, 0x15, 0x01, 0x4c, 0x1b, 0x40, 0x16, 0x00, 0x02, 0x02, 0x17, 0x4b,
+    0x00, 0x00, 0x00, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x1f, 0x4b, 0x00,
+    0x01, 0x01, 0x15, 0x01, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x0c, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x14, 0x11, 0x14, 0x28, 0x05, 0x07, 0x17, 0x2b, 0x00,
+    0x17, 0x07, 0x07, 0x27, 0x26, 0x26, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x15, 0x23, 0x11, 0x33, 0x07, 0x36, 0x36, 0x33, 0x01, 0x9a, 0x30,
+    0x20, 0x04, 0x07, 0x03, 0x08, 0x0d, 0x1a, 0x21, 0x24, 0x40, 0x28, 0x49,
+    0x4b, 0x02, 0x13, 0x4f, 0x2f, 0x01, 0xd4, 0x32, 0x38, 0x09, 0x04, 0x0b,
+    0x0d, 0x08, 0x11, 0x24, 0x49, 0x37, 0xf3, 0x01, 0xca, 0x54, 0x2d, 0x32,
+    0xff, 0xff, 0x00, 0x77, 0xff, 0xff, 0x01, 0xca, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce, 0x01, 0xe9, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x62, 0xff, 0xff, 0x01, 0xca, 0x02, 0xb0, 0x00, 0x22,
+    0x01, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x01, 0xee, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x77, 0xfe, 0xed, 0x01, 0xca, 0x01, 0xd4, 0x00, 0x22,
+    0x01, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde, 0x02, 0x16, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x4a, 0xff, 0xff, 0x01, 0xca, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0x8c, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcd, 0x01, 0xa4, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x02, 0x44, 0x00, 0x00, 0xff, 0xff, 0x00, 0x77,
+    0xff, 0x60, 0x01, 0xca, 0x01, 0xd4, 0x00, 0x22, 0x01, 0x8c, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x02, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0xff, 0x4f, 0x01, 0xe8, 0x01, 0xca, 0x00, 0x26, 0x00, 0x3e, 0x40, 0x3b,
+    0x0b, 0x03, 0x02, 0x01, 0x02, 0x09, 0x01, 0x00, 0x01, 0x22, 0x01, 0x03,
+    0x00, 0x24, 0x01, 0x04, 0x03, 0x04, 0x4a, 0x00, 0x02, 0x02, 0x17, 0x4b,
+    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x4b, 0x00, 0x03,
+    0x03, 0x04, 0x5f, 0x05, 0x01, 0x04, 0x04, 0x21, 0x04, 0x4c, 0x00, 0x00,
+    0x00, 0x26, 0x00, 0x25, 0x23, 0x14, 0x2a, 0x25, 0x06, 0x07, 0x18, 0x2b,
+    0x04, 0x26, 0x37, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x37,
+    0x17, 0x1e, 0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x33,
+    0x13, 0x14, 0x16, 0x33, 0x32, 0x37, 0x36, 0x36, 0x37, 0x37, 0x17, 0x17,
+    0x06, 0x23, 0x01, 0x58, 0x4d, 0x01, 0x01, 0x12, 0x4a, 0x2c, 0x1f, 0x32,
+    0x1b, 0x1e, 0x04, 0x06, 0x01, 0x04, 0x09, 0x08, 0x15, 0x1e, 0x21, 0x3b,
+    0x26, 0x49, 0x02, 0x24, 0x1c, 0x0b, 0x0c, 0x0e, 0x0b, 0x03, 0x06, 0x05,
+    0x13, 0x23, 0x39, 0xb1, 0x40, 0x48, 0x7f, 0x2e, 0x33, 0x18, 0x1a, 0x38,
+    0x09, 0x03, 0x03, 0x0f, 0x0c, 0x06, 0x0e, 0x24, 0x4a, 0x36, 0xf3, 0xfe,
+    0x0d, 0x23, 0x27, 0x03, 0x04, 0x0d, 0x0a, 0x03, 0x09, 0x30, 0x26, 0x00,
+    0xff, 0xff, 0x00, 0x6c, 0xff, 0xff, 0x01, 0xca, 0x02, 0x84, 0x00, 0x22,
+    0x01, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd9, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x77, 0xff, 0x65, 0x01, 0xca, 0x01, 0xd4, 0x00, 0x22,
+    0x01, 0x8c, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2, 0x02, 0x0a, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x23, 0xff, 0xff, 0x01, 0xca, 0x01, 0xd4, 0x00, 0x1d,
+    0x00, 0xb5, 0x40, 0x0b, 0x01, 0x01, 0x00, 0x06, 0x1a, 0x03, 0x02, 0x01,
+    0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x1c, 0x05, 0x01,
+    0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x65, 0x00, 0x00, 0x00, 0x06,
+    0x5f, 0x08, 0x07, 0x02, 0x06, 0x06, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x15,
+    0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x20, 0x05, 0x01,
+    0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x65, 0x00, 0x06, 0x06, 0x17,
+    0x4b, 0x00, 0x00, 0x00, 0x07, 0x5f, 0x08, 0x01, 0x07, 0x07, 0x1f, 0x4b,
+    0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+    0x40, 0x1c, 0x05, 0x01, 0x01, 0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x65,
+    0x00, 0x00, 0x00, 0x06, 0x5f, 0x08, 0x07, 0x02, 0x06, 0x06, 0x17, 0x4b,
+    0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x40, 0x20, 0x05, 0x01, 0x01,
+    0x04, 0x01, 0x02, 0x03, 0x01, 0x02, 0x65, 0x00, 0x06, 0x06, 0x17, 0x4b,
+    0x00, 0x00, 0x00, 0x07, 0x5f, 0x08, 0x01, 0x07, 0x07, 0x1f, 0x4b, 0x00,
+    0x03, 0x03, 0x15, 0x03, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x10, 0x00, 0x00,
+    0x00, 0x1d, 0x00, 0x1c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x28, 0x09,
+    0x07, 0x1b, 0x2b, 0x00, 0x17, 0x07, 0x07, 0x27, 0x26, 0x26, 0x27, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35,
+    0x23, 0x35, 0x33, 0x35, 0x33, 0x07, 0x36, 0x36, 0x33, 0x01, 0x9a, 0x30,
+    0x20, 0x04, 0x07, 0x03, 0x08, 0x0d, 0x1a, 0x21, 0x24, 0x40, 0x28, 0x71,
+    0x71, 0x49, 0x54, 0x54, 0x4b, 0x02, 0x13, 0x4f, 0x2f, 0x01, 0xd4, 0x32,
+    0x38, 0x09, 0x04, 0x0b, 0x0d, 0x08, 0x11, 0x24, 0x49, 0x37, 0x0d, 0x39,
+    0xad, 0xad, 0x39, 0xe4, 0x54, 0x2d, 0x32, 0x00, 0x00, 0x01, 0x00, 0x39,
+    0xff, 0xf6, 0x01, 0xb8, 0x01, 0xd4, 0x00, 0x2e, 0x00, 0x2e, 0x40, 0x2b,
+    0x1b, 0x19, 0x03, 0x01, 0x04, 0x00, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02,
+    0x01, 0x5f, 0x00, 0x01, 0x01, 0x1f, 0x4b, 0x00, 0x00, 0x00, 0x03, 0x5f,
+    0x04, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x00, 0x00, 0x00, 0x2e, 0x00,
+    0x2d, 0x2a, 0x29, 0x2a, 0x05, 0x07, 0x17, 0x2b, 0x16, 0x27, 0x37, 0x37,
+    0x17, 0x14, 0x16, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34,
+    0x26, 0x27, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07,
+    0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x87, 0x4e, 0x28, 0x06, 0x06,
+    0x03, 0x08, 0x07, 0x17, 0x3b, 0x2c, 0x36, 0x3e, 0x32, 0x41, 0xac, 0x57,
+    0x51, 0x3e, 0x55, 0x23, 0x29, 0x07, 0x05, 0x01, 0x07, 0x0b, 0x17, 0x39,
+    0x1c, 0x2b, 0x37, 0x38, 0x49, 0x56, 0x47, 0x61, 0x5c, 0x0a, 0x48, 0x44,
+    0x09, 0x04, 0x02, 0x0e, 0x0e, 0x07, 0x17, 0x19, 0x27, 0x22, 0x1d, 0x26,
+    0x15, 0x31, 0x5d, 0x35, 0x3e, 0x23, 0x25, 0x32, 0x08, 0x05, 0x0b, 0x0e,
+    0x09, 0x12, 0x13, 0x1e, 0x1b, 0x19, 0x2a, 0x15, 0x1a, 0x3d, 0x31, 0x3e,
+    0x51, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x39, 0xff, 0xf6, 0x01, 0xb8,
+    0x02, 0xaa, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce,
+    0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x39, 0xff, 0xf6, 0x01, 0xb8,
+    0x03, 0x28, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00, 0x00, 0x23, 0x02, 0xce,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcc, 0x02, 0x0d, 0x00, 0x98,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0x98, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x39, 0xff, 0xf6, 0x01, 0xb8, 0x02, 0xb0, 0x00, 0x22,
+    0x01, 0x96, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd2, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x39, 0xff, 0xf6, 0x01, 0xb8, 0x03, 0x23, 0x00, 0x22,
+    0x01, 0x96, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd2, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xcc, 0x01, 0xf5, 0x00, 0x93, 0x00, 0x08, 0xb1, 0x02,
+    0x01, 0xb0, 0x93, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x39,
+    0xff, 0x3b, 0x01, 0xb8, 0x01, 0xd4, 0x00, 0x42, 0x00, 0xa9, 0x40, 0x15,
+    0x32, 0x30, 0x1a, 0x18, 0x04, 0x04, 0x06, 0x03, 0x01, 0x02, 0x03, 0x0c,
+    0x01, 0x01, 0x02, 0x0b, 0x01, 0x00, 0x01, 0x04, 0x4a, 0x4b, 0xb0, 0x10,
+    0x50, 0x58, 0x40, 0x26, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x70, 0x00,
+    0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x1f, 0x4b, 0x00, 0x04, 0x04,
+    0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+    0x40, 0x27, 0x00, 0x02, 0x03, 0x01, 0x03, 0x02, 0x01, 0x7e, 0x00, 0x06,
+    0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x1f, 0x4b, 0x00, 0x04, 0x04, 0x03,
+    0x5f, 0x00, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x40, 0x24, 0x00, 0x02, 0x03, 0x01,
+    0x03, 0x02, 0x01, 0x7e, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00,
+    0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x1f, 0x4b, 0x00, 0x04, 0x04,
+    0x03, 0x5f, 0x00, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x0a,
+    0x2a, 0x29, 0x2a, 0x21, 0x23, 0x23, 0x28, 0x07, 0x07, 0x1b, 0x2b, 0x24,
+    0x06, 0x07, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x27, 0x37,
+    0x16, 0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x23, 0x22, 0x27,
+    0x37, 0x37, 0x17, 0x14, 0x16, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x27, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x07, 0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x01, 0xb8, 0x46, 0x42, 0x05, 0x2a,
+    0x2b, 0x3c, 0x38, 0x35, 0x2e, 0x19, 0x26, 0x31, 0x32, 0x1b, 0x18, 0x1e,
+    0x0a, 0x09, 0x74, 0x4e, 0x28, 0x06, 0x06, 0x03, 0x08, 0x07, 0x17, 0x3b,
+    0x2c, 0x36, 0x3e, 0x32, 0x41, 0xac, 0x57, 0x51, 0x3e, 0x55, 0x23, 0x29,
+    0x07, 0x05, 0x01, 0x07, 0x0b, 0x17, 0x39, 0x1c, 0x2b, 0x37, 0x38, 0x49,
+    0x56, 0x47, 0x52, 0x4c, 0x0c, 0x29, 0x04, 0x25, 0x18, 0x24, 0x31, 0x1f,
+    0x2a, 0x1e, 0x24, 0x10, 0x11, 0x4b, 0x48, 0x44, 0x09, 0x04, 0x02, 0x0e,
+    0x0e, 0x07, 0x17, 0x19, 0x27, 0x22, 0x1d, 0x26, 0x15, 0x31, 0x5d, 0x35,
+    0x3e, 0x23, 0x25, 0x32, 0x08, 0x05, 0x0b, 0x0e, 0x09, 0x12, 0x13, 0x1e,
+    0x1b, 0x19, 0x2a, 0x15, 0x1a, 0x3d, 0x31, 0x00, 0xff, 0xff, 0x00, 0x39,
+    0xff, 0xf6, 0x01, 0xb8, 0x02, 0xad, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x39,
+    0xfe, 0xed, 0x01, 0xb8, 0x01, 0xd4, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xde, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x39,
+    0xff, 0xf6, 0x01, 0xb8, 0x02, 0x90, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcc, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x39,
+    0xff, 0x60, 0x01, 0xb8, 0x01, 0xd4, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x39,
+    0xff, 0x60, 0x01, 0xb8, 0x02, 0x90, 0x00, 0x22, 0x01, 0x96, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xdc, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc,
+    0x01, 0xf4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x37, 0xff, 0xf6, 0x01, 0xd0,
+    0x02, 0x9d, 0x00, 0x2b, 0x00, 0x6f, 0x40, 0x0e, 0x24, 0x01, 0x01, 0x02,
+    0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x04, 0x00, 0x03, 0x4a, 0x4b, 0xb0,
+    0x19, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x67, 0x00, 0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x16, 0x4b, 0x00,
+    0x00, 0x00, 0x04, 0x5f, 0x07, 0x06, 0x02, 0x04, 0x04, 0x15, 0x04, 0x4c,
+    0x1b, 0x40, 0x23, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00,
+    0x03, 0x03, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x16, 0x4b, 0x00, 0x04, 0x04,
+    0x15, 0x4b, 0x00, 0x00, 0x00, 0x06, 0x5f, 0x07, 0x01, 0x06, 0x06, 0x1d,
+    0x06, 0x4c, 0x59, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x2a, 0x23,
+    0x13, 0x24, 0x21, 0x25, 0x23, 0x08, 0x07, 0x1a, 0x2b, 0x16, 0x27, 0x37,
+    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x35, 0x33,
+    0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x23, 0xdf, 0x2e, 0x23, 0x1e, 0x2b, 0x1c, 0x35,
+    0x20, 0x4d, 0x4d, 0x1e, 0x24, 0x28, 0x3e, 0x40, 0x2f, 0x38, 0x3e, 0x44,
+    0x5f, 0x51, 0x34, 0x57, 0x32, 0x2a, 0x25, 0x39, 0x42, 0x2d, 0x53, 0x37,
+    0x0a, 0x1f, 0x38, 0x18, 0x25, 0x40, 0x27, 0x3a, 0x48, 0x39, 0x3b, 0x33,
+    0x33, 0x46, 0x65, 0x55, 0xfe, 0x57, 0x01, 0xa7, 0x78, 0x7e, 0x31, 0x51,
+    0x2e, 0x2b, 0x48, 0x13, 0x12, 0x61, 0x3f, 0x35, 0x57, 0x33, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x46, 0xff, 0xf9, 0x01, 0xbc, 0x02, 0x51, 0x00, 0x1f,
+    0x00, 0x2f, 0x40, 0x2c, 0x1f, 0x01, 0x05, 0x01, 0x01, 0x4a, 0x12, 0x0e,
+    0x0c, 0x03, 0x02, 0x48, 0x04, 0x01, 0x01, 0x01, 0x02, 0x5d, 0x03, 0x01,
+    0x02, 0x02, 0x17, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x1d, 0x00, 0x4c, 0x25, 0x11, 0x18, 0x11, 0x15, 0x21, 0x06, 0x07, 0x1a,
+    0x2b, 0x25, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x37, 0x23, 0x35,
+    0x33, 0x3f, 0x02, 0x17, 0x06, 0x06, 0x07, 0x07, 0x33, 0x15, 0x23, 0x07,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x01, 0xbc, 0x42, 0x4f,
+    0x4c, 0x3f, 0x02, 0x09, 0x65, 0x69, 0x07, 0x50, 0x0a, 0x01, 0x07, 0x07,
+    0x01, 0x0b, 0x98, 0x9c, 0x09, 0x02, 0x25, 0x29, 0x1e, 0x32, 0x20, 0x2a,
+    0x31, 0x5c, 0x68, 0x11, 0x2a, 0x96, 0x3b, 0x7a, 0x0d, 0x01, 0x06, 0x0a,
+    0x0e, 0x0f, 0x5b, 0x3b, 0x9b, 0x28, 0x0d, 0x50, 0x39, 0x16, 0x18, 0x00,
+    0x00, 0x01, 0x00, 0x3d, 0xff, 0xf9, 0x01, 0xbc, 0x02, 0x51, 0x00, 0x23,
+    0x00, 0x3e, 0x40, 0x3b, 0x23, 0x01, 0x09, 0x01, 0x01, 0x4a, 0x14, 0x10,
+    0x0e, 0x03, 0x04, 0x48, 0x07, 0x01, 0x02, 0x08, 0x01, 0x01, 0x09, 0x02,
+    0x01, 0x65, 0x06, 0x01, 0x03, 0x03, 0x04, 0x5d, 0x05, 0x01, 0x04, 0x04,
+    0x17, 0x4b, 0x00, 0x09, 0x09, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00,
+    0x4c, 0x21, 0x1f, 0x11, 0x11, 0x11, 0x18, 0x11, 0x11, 0x11, 0x13, 0x21,
+    0x0a, 0x07, 0x1d, 0x2b, 0x25, 0x06, 0x23, 0x22, 0x26, 0x35, 0x37, 0x23,
+    0x35, 0x33, 0x37, 0x23, 0x35, 0x33, 0x3f, 0x02, 0x17, 0x06, 0x06, 0x07,
+    0x07, 0x33, 0x15, 0x23, 0x07, 0x33, 0x15, 0x23, 0x06, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x01, 0xbc, 0x42, 0x4f, 0x4c, 0x3f, 0x01, 0x64, 0x67,
+    0x07, 0x65, 0x69, 0x07, 0x50, 0x0a, 0x01, 0x07, 0x07, 0x01, 0x0b, 0x98,
+    0x9c, 0x07, 0x9a, 0x9d, 0x02, 0x0f, 0x23, 0x1d, 0x1e, 0x32, 0x20, 0x2a,
+    0x31, 0x5c, 0x65, 0x22, 0x39, 0x79, 0x3b, 0x7a, 0x0d, 0x01, 0x06, 0x0a,
+    0x0e, 0x0f, 0x5b, 0x3b, 0x79, 0x39, 0x44, 0x48, 0x1b, 0x16, 0x18, 0x00,
+    0xff, 0xff, 0x00, 0x46, 0xff, 0xf9, 0x01, 0xd3, 0x02, 0xc2, 0x00, 0x22,
+    0x01, 0xa2, 0x00, 0x00, 0x01, 0x07, 0x02, 0xf1, 0x00, 0xae, 0x00, 0x23,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x23, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x46, 0xff, 0x3b, 0x01, 0xbc, 0x02, 0x51, 0x00, 0x35,
+    0x00, 0xb9, 0x40, 0x1d, 0x2f, 0x01, 0x07, 0x03, 0x30, 0x11, 0x02, 0x08,
+    0x07, 0x35, 0x01, 0x02, 0x08, 0x08, 0x01, 0x01, 0x02, 0x07, 0x01, 0x00,
+    0x01, 0x05, 0x4a, 0x22, 0x1e, 0x1c, 0x03, 0x04, 0x48, 0x4b, 0xb0, 0x10,
+    0x50, 0x58, 0x40, 0x28, 0x00, 0x02, 0x08, 0x01, 0x08, 0x02, 0x70, 0x06,
+    0x01, 0x03, 0x03, 0x04, 0x5d, 0x05, 0x01, 0x04, 0x04, 0x17, 0x4b, 0x00,
+    0x07, 0x07, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1d, 0x4b, 0x00, 0x01, 0x01,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x4b, 0xb0, 0x17,
+    0x50, 0x58, 0x40, 0x29, 0x00, 0x02, 0x08, 0x01, 0x08, 0x02, 0x01, 0x7e,
+    0x06, 0x01, 0x03, 0x03, 0x04, 0x5d, 0x05, 0x01, 0x04, 0x04, 0x17, 0x4b,
+    0x00, 0x07, 0x07, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1d, 0x4b, 0x00, 0x01,
+    0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x4c, 0x1b, 0x40, 0x26,
+    0x00, 0x02, 0x08, 0x01, 0x08, 0x02, 0x01, 0x7e, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x63, 0x06, 0x01, 0x03, 0x03, 0x04, 0x5d, 0x05, 0x01, 0x04,
+    0x04, 0x17, 0x4b, 0x00, 0x07, 0x07, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1d,
+    0x08, 0x4c, 0x59, 0x59, 0x40, 0x0c, 0x24, 0x25, 0x11, 0x18, 0x11, 0x18,
+    0x23, 0x23, 0x24, 0x09, 0x07, 0x1d, 0x2b, 0x04, 0x16, 0x15, 0x14, 0x06,
+    0x23, 0x22, 0x27, 0x37, 0x16, 0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23,
+    0x37, 0x33, 0x26, 0x26, 0x35, 0x34, 0x37, 0x37, 0x23, 0x35, 0x33, 0x3f,
+    0x02, 0x17, 0x06, 0x06, 0x07, 0x07, 0x33, 0x15, 0x23, 0x07, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x23, 0x22, 0x27, 0x07,
+    0x01, 0x40, 0x2b, 0x3c, 0x38, 0x35, 0x2e, 0x19, 0x26, 0x31, 0x32, 0x1b,
+    0x18, 0x1e, 0x0b, 0x06, 0x2e, 0x28, 0x02, 0x09, 0x65, 0x69, 0x07, 0x50,
+    0x0a, 0x01, 0x07, 0x07, 0x01, 0x0b, 0x98, 0x9c, 0x09, 0x02, 0x25, 0x29,
+    0x1e, 0x32, 0x20, 0x16, 0x42, 0x4f, 0x0b, 0x05, 0x05, 0x33, 0x25, 0x18,
+    0x24, 0x31, 0x1f, 0x2a, 0x1e, 0x24, 0x10, 0x11, 0x55, 0x0f, 0x5b, 0x54,
+    0x10, 0x2a, 0x96, 0x3b, 0x7a, 0x0d, 0x01, 0x06, 0x0a, 0x0e, 0x0f, 0x5b,
+    0x3b, 0x9b, 0x28, 0x0d, 0x50, 0x39, 0x16, 0x18, 0x39, 0x31, 0x01, 0x29,
+    0xff, 0xff, 0x00, 0x46, 0xfe, 0xed, 0x01, 0xbc, 0x02, 0x51, 0x00, 0x22,
+    0x01, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x02, 0xde, 0x02, 0x02, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x46, 0xff, 0xf9, 0x01, 0xbc, 0x03, 0x1b, 0x00, 0x22,
+    0x01, 0xa2, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcb, 0x01, 0xea, 0x00, 0x82,
+    0x00, 0x08, 0xb1, 0x01, 0x02, 0xb0, 0x82, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x46, 0xff, 0x60, 0x01, 0xbc, 0x02, 0x51, 0x00, 0x22,
+    0x01, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x46, 0xff, 0x65, 0x01, 0xbc, 0x02, 0x51, 0x00, 0x22,
+    0x01, 0xa2, 0x00, 0x00, 0x00, 0x03, 0x02, 0xe2, 0x01, 0xf6, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x3f, 0xff, 0xf5, 0x01, 0xba, 0x01, 0xc9, 0x00, 0x18,
+    0x00, 0x88, 0xb5, 0x15, 0x01, 0x01, 0x00, 0x01, 0x4a, 0x4b, 0xb0, 0x0e,
+    0x50, 0x58, 0x40, 0x13, 0x02, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x01,
+    0x01, 0x03, 0x5f, 0x05, 0x04, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b,
+    0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x17, 0x02, 0x01, 0x00, 0x00, 0x17,
+    0x4b, 0x00, 0x03, 0x03, 0x15, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5f, 0x05,
+    0x01, 0x04, 0x04, 0x1d, 0x04, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+    0x40, 0x13, 0x02, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x03,
+    0x5f, 0x05, 0x04, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x40, 0x17,
+    0x02, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x15, 0x4b, 0x00,
+    0x01, 0x01, 0x04, 0x5f, 0x05, 0x01, 0x04, 0x04, 0x1d, 0x04, 0x4c, 0x59,
+    0x59, 0x59, 0x40, 0x0d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x17, 0x14, 0x13,
+    0x23, 0x13, 0x06, 0x07, 0x18, 0x2b, 0x16, 0x26, 0x37, 0x37, 0x33, 0x15,
+    0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x35, 0x33, 0x11, 0x14, 0x16, 0x17,
+    0x23, 0x26, 0x26, 0x35, 0x06, 0x06, 0x23, 0x95, 0x56, 0x01, 0x01, 0x46,
+    0x39, 0x2f, 0x34, 0x47, 0x46, 0x03, 0x07, 0x45, 0x07, 0x03, 0x16, 0x4b,
+    0x2d, 0x0b, 0x6b, 0x6a, 0xff, 0xff, 0x52, 0x49, 0x51, 0x4d, 0xfc, 0xfe,
+    0x7e, 0x18, 0x1f, 0x10, 0x0f, 0x20, 0x17, 0x26, 0x2b, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce, 0x01, 0xe9, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x02, 0x8e, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd3, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x02, 0xad, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x23, 0x02, 0xcd, 0x01, 0xa4, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x02, 0x44, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40,
+    0xff, 0xf5, 0x01, 0xba, 0x02, 0x99, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcb, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40,
+    0xff, 0x60, 0x01, 0xba, 0x01, 0xc9, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40,
+    0xff, 0xf5, 0x01, 0xba, 0x02, 0xaa, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40,
+    0xff, 0xf5, 0x01, 0xba, 0x02, 0xc0, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd7, 0x02, 0x03, 0x00, 0x00, 0xff, 0xff, 0x00, 0x28,
+    0xff, 0xf5, 0x01, 0xe6, 0x02, 0x1d, 0x00, 0x22, 0x01, 0xd7, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdb, 0x01, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x28,
+    0xff, 0xf5, 0x01, 0xe6, 0x02, 0xaa, 0x00, 0x22, 0x01, 0xd7, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xdb, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce,
+    0x01, 0xd5, 0x00, 0x00, 0xff, 0xff, 0x00, 0x28, 0xff, 0x60, 0x01, 0xe6,
+    0x02, 0x1d, 0x00, 0x22, 0x01, 0xd7, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdb,
+    0x01, 0xf0, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc, 0x01, 0xe1, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x28, 0xff, 0xf5, 0x01, 0xe6, 0x02, 0xaa, 0x00, 0x22,
+    0x01, 0xd7, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdb, 0x01, 0xf0, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x01, 0xd5, 0x00, 0x00, 0xff, 0xff, 0x00, 0x28,
+    0xff, 0xf5, 0x01, 0xe6, 0x02, 0xc0, 0x00, 0x22, 0x01, 0xd7, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0xdb, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd7,
+    0x01, 0xef, 0x00, 0x00, 0xff, 0xff, 0x00, 0x28, 0xff, 0xf5, 0x01, 0xe6,
+    0x02, 0x9d, 0x00, 0x22, 0x01, 0xd7, 0x00, 0x00, 0x00, 0x23, 0x02, 0xdb,
+    0x01, 0xf0, 0x00, 0x00, 0x00, 0x03, 0x02, 0xf0, 0x01, 0xd6, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xbb, 0x02, 0xbb, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcf, 0x01, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x02, 0x84, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd9, 0x01, 0xec, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x02, 0x6d, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba, 0x03, 0x33, 0x00, 0x22,
+    0x01, 0xaa, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd6, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0x07, 0x02, 0xcb, 0x01, 0xf3, 0x00, 0x9a, 0x00, 0x08, 0xb1, 0x02,
+    0x02, 0xb0, 0x9a, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3f,
+    0xff, 0x1d, 0x01, 0xba, 0x01, 0xc9, 0x00, 0x25, 0x00, 0xcc, 0x4b, 0xb0,
+    0x0e, 0x50, 0x58, 0x40, 0x0c, 0x0d, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x22,
+    0x03, 0x02, 0x03, 0x00, 0x47, 0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40,
+    0x10, 0x0d, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x22, 0x01, 0x00, 0x01, 0x49,
+    0x03, 0x02, 0x02, 0x01, 0x47, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40,
+    0x0c, 0x0d, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x22, 0x03, 0x02, 0x03, 0x00,
+    0x47, 0x1b, 0x40, 0x10, 0x0d, 0x01, 0x03, 0x02, 0x01, 0x4a, 0x22, 0x01,
+    0x00, 0x01, 0x49, 0x03, 0x02, 0x02, 0x01, 0x47, 0x59, 0x59, 0x59, 0x4b,
+    0xb0, 0x0e, 0x50, 0x58, 0x40, 0x12, 0x04, 0x01, 0x02, 0x02, 0x17, 0x4b,
+    0x00, 0x03, 0x03, 0x00, 0x5f, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x10, 0x50, 0x58, 0x40, 0x16, 0x04, 0x01, 0x02, 0x02,
+    0x17, 0x4b, 0x00, 0x00, 0x00, 0x15, 0x4b, 0x00, 0x03, 0x03, 0x01, 0x5f,
+    0x00, 0x01, 0x01, 0x1d, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58,
+    0x40, 0x12, 0x04, 0x01, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x03, 0x03, 0x00,
+    0x5f, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x1b, 0x40, 0x16, 0x04,
+    0x01, 0x02, 0x02, 0x17, 0x4b, 0x00, 0x00, 0x00, 0x15, 0x4b, 0x00, 0x03,
+    0x03, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x1d, 0x01, 0x4c, 0x59, 0x59, 0x59,
+    0xb7, 0x13, 0x23, 0x13, 0x25, 0x19, 0x05, 0x07, 0x19, 0x2b, 0x04, 0x16,
+    0x17, 0x07, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x23, 0x26, 0x26, 0x35,
+    0x06, 0x06, 0x23, 0x22, 0x26, 0x37, 0x37, 0x33, 0x15, 0x14, 0x16, 0x33,
+    0x32, 0x36, 0x35, 0x35, 0x33, 0x11, 0x14, 0x16, 0x17, 0x06, 0x06, 0x15,
+    0x01, 0x68, 0x1f, 0x1f, 0x10, 0x33, 0x3d, 0x30, 0x2e, 0x0f, 0x07, 0x03,
+    0x16, 0x4b, 0x2d, 0x48, 0x56, 0x01, 0x01, 0x46, 0x39, 0x2f, 0x34, 0x47,
+    0x46, 0x03, 0x07, 0x26, 0x2c, 0x91, 0x1e, 0x04, 0x30, 0x07, 0x2e, 0x25,
+    0x23, 0x46, 0x20, 0x0f, 0x20, 0x17, 0x26, 0x2b, 0x6b, 0x6a, 0xff, 0xff,
+    0x52, 0x49, 0x51, 0x4d, 0xfc, 0xfe, 0x7e, 0x18, 0x1f, 0x10, 0x1e, 0x42,
+    0x1b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba,
+    0x02, 0xb5, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd4,
+    0x01, 0xed, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba,
+    0x02, 0xab, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd5,
+    0x01, 0xea, 0x00, 0x00, 0xff, 0xff, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xba,
+    0x03, 0x5d, 0x00, 0x22, 0x01, 0xaa, 0x00, 0x00, 0x00, 0x23, 0x02, 0xd5,
+    0x01, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce, 0x01, 0xe9, 0x00, 0xb3,
+    0x00, 0x08, 0xb1, 0x02, 0x01, 0xb0, 0xb3, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x01, 0xc7, 0x01, 0xc9, 0x00, 0x0a,
+    0x00, 0x21, 0x40, 0x1e, 0x07, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x03, 0x02,
+    0x02, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x00,
+    0x00, 0x00, 0x0a, 0x00, 0x0a, 0x11, 0x13, 0x04, 0x07, 0x16, 0x2b, 0x01,
+    0x06, 0x07, 0x03, 0x23, 0x03, 0x33, 0x13, 0x37, 0x36, 0x37, 0x01, 0xc7,
+    0x10, 0x33, 0x6f, 0x38, 0xb5, 0x48, 0x8d, 0x4a, 0x2e, 0x0e, 0x01, 0xc9,
+    0x51, 0x77, 0xfe, 0xff, 0x01, 0xc9, 0xfe, 0x9a, 0xa9, 0x68, 0x55, 0x00,
+    0x00, 0x01, 0x00, 0x10, 0xff, 0xff, 0x01, 0xe1, 0x01, 0xc9, 0x00, 0x10,
+    0x00, 0x28, 0x40, 0x25, 0x0e, 0x05, 0x02, 0x03, 0x03, 0x01, 0x01, 0x4a,
+    0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x03, 0x7e, 0x02, 0x01, 0x00, 0x00,
+    0x17, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x12, 0x12, 0x15,
+    0x12, 0x10, 0x05, 0x07, 0x19, 0x2b, 0x13, 0x33, 0x13, 0x13, 0x33, 0x13,
+    0x36, 0x36, 0x35, 0x35, 0x33, 0x06, 0x07, 0x23, 0x03, 0x03, 0x23, 0x10,
+    0x3f, 0x4a, 0x4e, 0x2c, 0x61, 0x1c, 0x0e, 0x43, 0x1e, 0x2e, 0x44, 0x54,
+    0x50, 0x41, 0x01, 0xc9, 0xfe, 0x91, 0x01, 0x44, 0xfe, 0xbd, 0xbb, 0x75,
+    0x2f, 0x0f, 0xe8, 0xe2, 0x01, 0x28, 0xfe, 0xd8, 0xff, 0xff, 0x00, 0x10,
+    0xff, 0xff, 0x01, 0xe1, 0x02, 0xaa, 0x00, 0x22, 0x01, 0xc2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xce, 0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0xff, 0xff, 0x01, 0xe1, 0x02, 0xad, 0x00, 0x22, 0x01, 0xc2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd1, 0x01, 0xf4, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0xff, 0xff, 0x01, 0xe1, 0x02, 0x99, 0x00, 0x22, 0x01, 0xc2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcb, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x10,
+    0xff, 0xff, 0x01, 0xe1, 0x02, 0xaa, 0x00, 0x22, 0x01, 0xc2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xcd, 0x01, 0xe9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2f,
+    0x00, 0x00, 0x01, 0xc8, 0x01, 0xc9, 0x00, 0x0b, 0x00, 0x1f, 0x40, 0x1c,
+    0x09, 0x06, 0x03, 0x03, 0x02, 0x00, 0x01, 0x4a, 0x01, 0x01, 0x00, 0x00,
+    0x17, 0x4b, 0x03, 0x01, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x12, 0x12, 0x12,
+    0x11, 0x04, 0x07, 0x18, 0x2b, 0x37, 0x27, 0x33, 0x17, 0x37, 0x33, 0x07,
+    0x17, 0x23, 0x27, 0x07, 0x23, 0xd0, 0x9e, 0x4f, 0x77, 0x72, 0x4a, 0x94,
+    0xa8, 0x52, 0x7e, 0x77, 0x52, 0xe8, 0xe1, 0xa9, 0xa9, 0xde, 0xeb, 0xb2,
+    0xb2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x01, 0xc9, 0x00, 0x1b, 0x00, 0x2d, 0x40, 0x2a, 0x17, 0x14, 0x0b, 0x03,
+    0x01, 0x02, 0x09, 0x01, 0x00, 0x01, 0x02, 0x4a, 0x04, 0x03, 0x02, 0x02,
+    0x02, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x4c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x1b, 0x13, 0x28, 0x26, 0x05,
+    0x07, 0x17, 0x2b, 0x01, 0x06, 0x06, 0x07, 0x03, 0x06, 0x06, 0x23, 0x22,
+    0x27, 0x37, 0x37, 0x17, 0x16, 0x16, 0x17, 0x16, 0x33, 0x32, 0x36, 0x37,
+    0x03, 0x33, 0x13, 0x37, 0x36, 0x36, 0x37, 0x01, 0xbb, 0x06, 0x19, 0x17,
+    0x72, 0x17, 0x4a, 0x33, 0x40, 0x29, 0x1f, 0x06, 0x06, 0x02, 0x0a, 0x0e,
+    0x12, 0x16, 0x25, 0x2c, 0x15, 0xbb, 0x4b, 0x8e, 0x3c, 0x16, 0x15, 0x05,
+    0x01, 0xc9, 0x29, 0x50, 0x42, 0xfe, 0xbe, 0x40, 0x3a, 0x27, 0x31, 0x09,
+    0x04, 0x0a, 0x0d, 0x05, 0x06, 0x34, 0x3c, 0x01, 0xcc, 0xfe, 0x92, 0xb8,
+    0x45, 0x49, 0x28, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0xaa, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xce,
+    0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0xad, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd1,
+    0x01, 0xf7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0x99, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcb,
+    0x01, 0xf6, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0x90, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcc,
+    0x01, 0xf2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x01, 0xc9, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xdc,
+    0x02, 0x77, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0xaa, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xcd,
+    0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0xc0, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd7,
+    0x02, 0x06, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0x6d, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd6,
+    0x01, 0xf7, 0x00, 0x00, 0xff, 0xff, 0x00, 0x16, 0xff, 0x52, 0x01, 0xbb,
+    0x02, 0xab, 0x00, 0x22, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd5,
+    0x01, 0xed, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc2,
+    0x01, 0xc9, 0x00, 0x0d, 0x00, 0x2d, 0x40, 0x2a, 0x05, 0x01, 0x00, 0x01,
+    0x0a, 0x01, 0x02, 0x00, 0x00, 0x01, 0x03, 0x02, 0x03, 0x4a, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x00, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x02, 0x02, 0x03,
+    0x5d, 0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x14, 0x22, 0x11, 0x11, 0x04,
+    0x07, 0x18, 0x2b, 0x37, 0x01, 0x21, 0x35, 0x21, 0x15, 0x01, 0x21, 0x32,
+    0x36, 0x37, 0x33, 0x15, 0x21, 0x32, 0x01, 0x1b, 0xfe, 0xfa, 0x01, 0x63,
+    0xfe, 0xea, 0x01, 0x02, 0x10, 0x0f, 0x06, 0x07, 0xfe, 0x70, 0x31, 0x01,
+    0x59, 0x3f, 0x31, 0xfe, 0xa6, 0x04, 0x06, 0x48, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xc2, 0x02, 0xaa, 0x00, 0x22, 0x01, 0xd2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xce, 0x01, 0xe9, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xc2, 0x02, 0xb0, 0x00, 0x22, 0x01, 0xd2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xd2, 0x01, 0xee, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xc2, 0x02, 0x90, 0x00, 0x22, 0x01, 0xd2, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x32,
+    0xff, 0x60, 0x01, 0xc2, 0x01, 0xc9, 0x00, 0x22, 0x01, 0xd2, 0x00, 0x00,
+    0x00, 0x03, 0x02, 0xdc, 0x01, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x27,
+    0xff, 0xf5, 0x01, 0x8f, 0x01, 0xc9, 0x00, 0x18, 0x00, 0x88, 0xb5, 0x15,
+    0x01, 0x01, 0x00, 0x01, 0x4a, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x13,
+    0x02, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x05,
+    0x04, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x10, 0x50,
+    0x58, 0x40, 0x17, 0x02, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00, 0x03, 0x03,
+    0x15, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5f, 0x05, 0x01, 0x04, 0x04, 0x1d,
+    0x04, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x13, 0x02, 0x01,
+    0x00, 0x00, 0x17, 0x4b, 0x00, 0x01, 0x01, 0x03, 0x5f, 0x05, 0x04, 0x02,
+    0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x40, 0x17, 0x02, 0x01, 0x00, 0x00,
+    0x17, 0x4b, 0x00, 0x03, 0x03, 0x15, 0x4b, 0x00, 0x01, 0x01, 0x04, 0x5f,
+    0x05, 0x01, 0x04, 0x04, 0x1d, 0x04, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x0d,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x17, 0x14, 0x13, 0x23, 0x13, 0x06, 0x07,
+    0x18, 0x2b, 0x16, 0x26, 0x37, 0x37, 0x33, 0x15, 0x14, 0x16, 0x33, 0x32,
+    0x36, 0x35, 0x35, 0x33, 0x11, 0x14, 0x16, 0x17, 0x23, 0x26, 0x26, 0x35,
+    0x06, 0x06, 0x23, 0x78, 0x51, 0x01, 0x01, 0x42, 0x36, 0x2d, 0x32, 0x43,
+    0x42, 0x03, 0x07, 0x42, 0x06, 0x03, 0x15, 0x47, 0x2b, 0x0b, 0x6a, 0x6b,
+    0xff, 0xff, 0x52, 0x49, 0x51, 0x4d, 0xfc, 0xfe, 0x7e, 0x18, 0x1f, 0x10,
+    0x0f, 0x20, 0x17, 0x26, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3f,
+    0xff, 0xff, 0x01, 0xd5, 0x01, 0xd3, 0x00, 0x19, 0x00, 0x06, 0xb3, 0x18,
+    0x08, 0x01, 0x30, 0x2b, 0x37, 0x33, 0x11, 0x23, 0x35, 0x33, 0x07, 0x36,
+    0x36, 0x33, 0x32, 0x17, 0x07, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x15, 0x33, 0x15, 0x23, 0x3f, 0x41, 0x3f, 0x89, 0x03, 0x16,
+    0x51, 0x31, 0x45, 0x31, 0x22, 0x0c, 0x0c, 0x10, 0x1e, 0x1d, 0x21, 0x40,
+    0x28, 0x60, 0xe8, 0x36, 0x01, 0x59, 0x3a, 0x58, 0x2d, 0x35, 0x31, 0x45,
+    0x09, 0x0d, 0x11, 0x11, 0x31, 0x51, 0x2d, 0xb0, 0x37, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x01, 0xb6, 0x02, 0x9f, 0x00, 0x1a,
+    0x00, 0x26, 0x00, 0x2c, 0x00, 0x83, 0x40, 0x0a, 0x09, 0x01, 0x03, 0x07,
+    0x0b, 0x01, 0x08, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40,
+    0x2a, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x0c,
+    0x01, 0x08, 0x08, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x09, 0x05,
+    0x02, 0x00, 0x00, 0x01, 0x5d, 0x0a, 0x04, 0x02, 0x01, 0x01, 0x17, 0x4b,
+    0x0b, 0x01, 0x06, 0x06, 0x15, 0x06, 0x4c, 0x1b, 0x40, 0x28, 0x00, 0x02,
+    0x00, 0x03, 0x08, 0x02, 0x03, 0x67, 0x0c, 0x01, 0x08, 0x08, 0x07, 0x5f,
+    0x00, 0x07, 0x07, 0x16, 0x4b, 0x09, 0x05, 0x02, 0x00, 0x00, 0x01, 0x5d,
+    0x0a, 0x04, 0x02, 0x01, 0x01, 0x17, 0x4b, 0x0b, 0x01, 0x06, 0x06, 0x15,
+    0x06, 0x4c, 0x59, 0x40, 0x17, 0x1b, 0x1b, 0x2c, 0x2b, 0x2a, 0x29, 0x28,
+    0x27, 0x1b, 0x26, 0x1b, 0x25, 0x25, 0x11, 0x11, 0x13, 0x28, 0x23, 0x11,
+    0x10, 0x0d, 0x07, 0x1c, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x17, 0x07, 0x07, 0x27, 0x26, 0x26, 0x27, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x00, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x07, 0x23, 0x35, 0x33,
+    0x11, 0x23, 0x48, 0x27, 0x27, 0x4a, 0x3d, 0x45, 0x28, 0x20, 0x06, 0x06,
+    0x02, 0x08, 0x0d, 0x10, 0x14, 0x20, 0x28, 0x78, 0x78, 0x45, 0x01, 0x25,
+    0x1e, 0x1d, 0x16, 0x15, 0x1f, 0x1f, 0x15, 0x20, 0x29, 0x71, 0x48, 0x01,
+    0x8f, 0x3a, 0x26, 0x58, 0x58, 0x2b, 0x31, 0x09, 0x04, 0x0b, 0x0e, 0x07,
+    0x08, 0x40, 0x37, 0x26, 0x3a, 0xfe, 0x71, 0x02, 0x29, 0x1e, 0x15, 0x16,
+    0x1e, 0x1f, 0x15, 0x15, 0x1e, 0x9a, 0x3a, 0xfe, 0x37, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x21, 0x00, 0x00, 0x01, 0xab, 0x02, 0x9f, 0x00, 0x17,
+    0x00, 0x1b, 0x00, 0xa2, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x0a, 0x0a,
+    0x01, 0x03, 0x02, 0x0b, 0x01, 0x01, 0x03, 0x02, 0x4a, 0x1b, 0x40, 0x0a,
+    0x0a, 0x01, 0x03, 0x07, 0x0b, 0x01, 0x01, 0x03, 0x02, 0x4a, 0x59, 0x4b,
+    0xb0, 0x26, 0x50, 0x58, 0x40, 0x1e, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x07,
+    0x01, 0x02, 0x02, 0x16, 0x4b, 0x05, 0x01, 0x00, 0x00, 0x01, 0x5d, 0x04,
+    0x01, 0x01, 0x01, 0x17, 0x4b, 0x08, 0x01, 0x06, 0x06, 0x15, 0x06, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40, 0x22, 0x00, 0x07, 0x07, 0x16,
+    0x4b, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x05,
+    0x01, 0x00, 0x00, 0x01, 0x5d, 0x04, 0x01, 0x01, 0x01, 0x17, 0x4b, 0x08,
+    0x01, 0x06, 0x06, 0x15, 0x06, 0x4c, 0x1b, 0x40, 0x20, 0x00, 0x02, 0x00,
+    0x03, 0x01, 0x02, 0x03, 0x67, 0x00, 0x07, 0x07, 0x16, 0x4b, 0x05, 0x01,
+    0x00, 0x00, 0x01, 0x5d, 0x04, 0x01, 0x01, 0x01, 0x17, 0x4b, 0x08, 0x01,
+    0x06, 0x06, 0x15, 0x06, 0x4c, 0x59, 0x59, 0x40, 0x0c, 0x11, 0x11, 0x11,
+    0x11, 0x13, 0x25, 0x23, 0x11, 0x10, 0x09, 0x07, 0x1d, 0x2b, 0x13, 0x23,
+    0x35, 0x33, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0x01, 0x33,
+    0x11, 0x23, 0x48, 0x27, 0x27, 0x4f, 0x42, 0x22, 0x38, 0x12, 0x27, 0x13,
+    0x17, 0x16, 0x25, 0x2c, 0x78, 0x78, 0x45, 0x01, 0x1a, 0x49, 0x49, 0x01,
+    0x90, 0x39, 0x26, 0x58, 0x58, 0x18, 0x17, 0x36, 0x1a, 0x11, 0x38, 0x3e,
+    0x26, 0x39, 0xfe, 0x70, 0x02, 0x99, 0xfd, 0x67, 0x00, 0x03, 0x00, 0x4c,
+    0x00, 0x98, 0x01, 0xa9, 0x02, 0x6e, 0x00, 0x16, 0x00, 0x21, 0x00, 0x25,
+    0x00, 0xfe, 0x40, 0x0f, 0x0c, 0x0b, 0x02, 0x00, 0x01, 0x19, 0x01, 0x06,
+    0x05, 0x14, 0x01, 0x03, 0x06, 0x03, 0x4a, 0x4b, 0xb0, 0x19, 0x50, 0x58,
+    0x40, 0x29, 0x00, 0x07, 0x00, 0x08, 0x07, 0x08, 0x61, 0x00, 0x01, 0x01,
+    0x02, 0x5f, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x00, 0x5f,
+    0x00, 0x00, 0x00, 0x47, 0x4b, 0x0a, 0x01, 0x06, 0x06, 0x03, 0x5f, 0x09,
+    0x04, 0x02, 0x03, 0x03, 0x3d, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x23, 0x50,
+    0x58, 0x40, 0x2d, 0x00, 0x07, 0x00, 0x08, 0x07, 0x08, 0x61, 0x00, 0x01,
+    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x05, 0x05, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x00, 0x03, 0x03, 0x3d, 0x4b, 0x0a,
+    0x01, 0x06, 0x06, 0x04, 0x5f, 0x09, 0x01, 0x04, 0x04, 0x3d, 0x04, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40, 0x30, 0x00, 0x03, 0x06, 0x04,
+    0x06, 0x03, 0x04, 0x7e, 0x00, 0x07, 0x00, 0x08, 0x07, 0x08, 0x61, 0x00,
+    0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x3c, 0x4b, 0x00, 0x05, 0x05,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x0a, 0x01, 0x06, 0x06, 0x04,
+    0x5f, 0x09, 0x01, 0x04, 0x04, 0x3d, 0x04, 0x4c, 0x1b, 0x40, 0x2e, 0x00,
+    0x03, 0x06, 0x04, 0x06, 0x03, 0x04, 0x7e, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x02, 0x01, 0x67, 0x00, 0x07, 0x00, 0x08, 0x07, 0x08, 0x61, 0x00, 0x05,
+    0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x47, 0x4b, 0x0a, 0x01, 0x06, 0x06,
+    0x04, 0x5f, 0x09, 0x01, 0x04, 0x04, 0x3d, 0x04, 0x4c, 0x59, 0x59, 0x59,
+    0x40, 0x19, 0x17, 0x17, 0x00, 0x00, 0x25, 0x24, 0x23, 0x22, 0x17, 0x21,
+    0x17, 0x20, 0x1c, 0x1a, 0x00, 0x16, 0x00, 0x15, 0x13, 0x23, 0x22, 0x33,
+    0x0b, 0x09, 0x18, 0x2b, 0x12, 0x26, 0x35, 0x34, 0x33, 0x32, 0x17, 0x34,
+    0x26, 0x23, 0x22, 0x07, 0x27, 0x36, 0x33, 0x16, 0x16, 0x15, 0x15, 0x23,
+    0x35, 0x06, 0x23, 0x36, 0x36, 0x35, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0x07, 0x21, 0x15, 0x21, 0xaa, 0x44, 0xae, 0x0f, 0x22, 0x22,
+    0x28, 0x3e, 0x20, 0x22, 0x32, 0x54, 0x46, 0x3e, 0x3f, 0x2e, 0x38, 0x35,
+    0x33, 0x12, 0x20, 0x39, 0x37, 0x23, 0x1e, 0x9b, 0x01, 0x5d, 0xfe, 0xa3,
+    0x01, 0x01, 0x3d, 0x2c, 0x74, 0x02, 0x31, 0x2c, 0x2c, 0x29, 0x38, 0x02,
+    0x44, 0x43, 0xda, 0x21, 0x2b, 0x36, 0x3a, 0x37, 0x02, 0x1f, 0x20, 0x15,
+    0x1f, 0x69, 0x36, 0x00, 0x00, 0x03, 0x00, 0x4c, 0x00, 0x98, 0x01, 0xa9,
+    0x02, 0x6e, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x1e, 0x00, 0x5e, 0x4b, 0xb0,
+    0x30, 0x50, 0x58, 0x40, 0x1e, 0x00, 0x04, 0x00, 0x05, 0x04, 0x05, 0x61,
+    0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x07, 0x01,
+    0x03, 0x03, 0x01, 0x5f, 0x06, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b,
+    0x40, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x00, 0x04,
+    0x00, 0x05, 0x04, 0x05, 0x61, 0x07, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x06,
+    0x01, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x59, 0x40, 0x16, 0x0f, 0x0f, 0x00,
+    0x00, 0x1e, 0x1d, 0x1c, 0x1b, 0x0f, 0x1a, 0x0f, 0x19, 0x15, 0x13, 0x00,
+    0x0e, 0x00, 0x0d, 0x26, 0x08, 0x09, 0x15, 0x2b, 0x12, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x07,
+    0x21, 0x15, 0x21, 0xcc, 0x44, 0x28, 0x2a, 0x46, 0x29, 0x40, 0x54, 0x2a,
+    0x45, 0x29, 0x28, 0x34, 0x34, 0x26, 0x26, 0x35, 0x34, 0x26, 0xaa, 0x01,
+    0x5d, 0xfe, 0xa3, 0x01, 0x00, 0x2d, 0x51, 0x34, 0x36, 0x56, 0x30, 0x61,
+    0x54, 0x38, 0x54, 0x2d, 0x3a, 0x41, 0x3a, 0x3b, 0x46, 0x46, 0x3a, 0x3a,
+    0x42, 0x6c, 0x36, 0x00, 0xff, 0xff, 0x00, 0x48, 0x00, 0x00, 0x01, 0xaf,
+    0x01, 0xd4, 0x00, 0x02, 0x01, 0x5d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0xd0, 0x02, 0x6f, 0x00, 0x0d, 0x00, 0x11, 0x00, 0x08,
+    0xb5, 0x0f, 0x0e, 0x0c, 0x07, 0x02, 0x30, 0x2b, 0x01, 0x01, 0x33, 0x32,
+    0x36, 0x37, 0x33, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x01, 0x01,
+    0x23, 0x01, 0x01, 0xd0, 0xff, 0x01, 0xd2, 0x10, 0x0f, 0x06, 0x07, 0xfe,
+    0x63, 0x01, 0x03, 0xfe, 0xff, 0x01, 0x9c, 0xfe, 0xcf, 0x01, 0x02, 0x3b,
+    0xfe, 0xfc, 0x02, 0x3e, 0xfd, 0xec, 0x04, 0x06, 0x34, 0x31, 0x02, 0x13,
+    0x2b, 0xfd, 0xbb, 0x02, 0x1a, 0xfd, 0xe6, 0x00, 0x00, 0x03, 0x00, 0x39,
+    0xff, 0xf5, 0x01, 0xbb, 0x02, 0x73, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x1c,
+    0x00, 0x3a, 0x40, 0x37, 0x1a, 0x19, 0x11, 0x10, 0x04, 0x03, 0x02, 0x01,
+    0x4a, 0x05, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x01, 0x14,
+    0x4b, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00,
+    0x4c, 0x15, 0x15, 0x0c, 0x0c, 0x00, 0x00, 0x15, 0x1c, 0x15, 0x1b, 0x0c,
+    0x14, 0x0c, 0x13, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x07, 0x07, 0x15, 0x2b,
+    0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x06, 0x06, 0x15, 0x14, 0x17, 0x13, 0x26, 0x26, 0x23, 0x12, 0x36, 0x35,
+    0x34, 0x27, 0x03, 0x16, 0x33, 0x01, 0x56, 0x65, 0x64, 0x5d, 0x5d, 0x64,
+    0x65, 0x5c, 0x39, 0x40, 0x09, 0xd4, 0x0f, 0x33, 0x22, 0x39, 0x40, 0x07,
+    0xd4, 0x20, 0x42, 0x02, 0x73, 0xaa, 0x95, 0x99, 0xa6, 0xa6, 0x99, 0x95,
+    0xaa, 0x3d, 0x8b, 0x77, 0x41, 0x32, 0x01, 0x12, 0x30, 0x33, 0xfd, 0xfc,
+    0x86, 0x7c, 0x3a, 0x2a, 0xfe, 0xf2, 0x58, 0x00, 0x00, 0x01, 0x00, 0x58,
+    0x00, 0x00, 0x01, 0x2c, 0x02, 0x70, 0x00, 0x06, 0x00, 0x1b, 0x40, 0x18,
+    0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x14,
+    0x4b, 0x00, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x11, 0x13, 0x02, 0x07, 0x16,
+    0x2b, 0x13, 0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0xe6, 0x7e, 0x10, 0xa3,
+    0x31, 0x46, 0x02, 0x19, 0x25, 0x27, 0x55, 0xfd, 0x90, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x3a, 0x00, 0x00, 0x01, 0xb7, 0x02, 0x73, 0x00, 0x23,
+    0x00, 0x2d, 0x40, 0x2a, 0x20, 0x11, 0x0f, 0x0e, 0x0c, 0x05, 0x02, 0x00,
+    0x00, 0x01, 0x03, 0x02, 0x02, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00,
+    0x01, 0x01, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5d, 0x00, 0x03, 0x03,
+    0x15, 0x03, 0x4c, 0x14, 0x27, 0x2a, 0x27, 0x04, 0x07, 0x18, 0x2b, 0x37,
+    0x37, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15, 0x14,
+    0x17, 0x07, 0x27, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x07, 0x07, 0x33, 0x32, 0x36, 0x37, 0x33, 0x15, 0x21, 0x49, 0x51,
+    0x51, 0x51, 0x30, 0x3a, 0x30, 0x4b, 0x32, 0x0d, 0x01, 0x04, 0x08, 0x33,
+    0x1e, 0x68, 0x41, 0x50, 0x63, 0x34, 0x51, 0x48, 0x44, 0xe8, 0x10, 0x0f,
+    0x06, 0x07, 0xfe, 0x92, 0x38, 0x52, 0x51, 0x5c, 0x5b, 0x31, 0x3d, 0x36,
+    0x3f, 0x10, 0x0c, 0x06, 0x03, 0x05, 0x05, 0x28, 0x3a, 0x3f, 0x60, 0x52,
+    0x36, 0x66, 0x5c, 0x47, 0x45, 0x04, 0x06, 0x47, 0x00, 0x01, 0x00, 0x45,
+    0xff, 0xf5, 0x01, 0xab, 0x02, 0x73, 0x00, 0x2c, 0x00, 0x40, 0x40, 0x3d,
+    0x1d, 0x1c, 0x02, 0x02, 0x03, 0x25, 0x01, 0x01, 0x02, 0x13, 0x04, 0x02,
+    0x03, 0x00, 0x01, 0x03, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x67, 0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x14, 0x4b, 0x00,
+    0x00, 0x00, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x1d, 0x05, 0x4c, 0x00,
+    0x00, 0x00, 0x2c, 0x00, 0x2b, 0x23, 0x24, 0x12, 0x24, 0x2a, 0x07, 0x07,
+    0x19, 0x2b, 0x16, 0x26, 0x27, 0x37, 0x37, 0x17, 0x16, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x35, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x27, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0xbe,
+    0x59, 0x20, 0x2e, 0x07, 0x05, 0x01, 0x06, 0x0b, 0x13, 0x2b, 0x1e, 0x3a,
+    0x3c, 0x4b, 0x44, 0x0a, 0x16, 0x59, 0x41, 0x31, 0x28, 0x41, 0x31, 0x2a,
+    0x3d, 0x5e, 0x4b, 0x57, 0x32, 0x30, 0x37, 0x40, 0x2c, 0x54, 0x3b, 0x0b,
+    0x24, 0x23, 0x37, 0x08, 0x05, 0x0a, 0x0f, 0x0a, 0x10, 0x12, 0x44, 0x39,
+    0x3e, 0x3e, 0x02, 0x38, 0x42, 0x39, 0x2a, 0x32, 0x2e, 0x2a, 0x40, 0x55,
+    0x46, 0x33, 0x4c, 0x0f, 0x12, 0x50, 0x3d, 0x32, 0x53, 0x31, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x30, 0x00, 0x00, 0x01, 0xd8, 0x02, 0x70, 0x00, 0x0a,
+    0x00, 0x0d, 0x00, 0x31, 0x40, 0x2e, 0x0c, 0x01, 0x02, 0x01, 0x02, 0x01,
+    0x00, 0x02, 0x02, 0x4a, 0x06, 0x05, 0x02, 0x02, 0x03, 0x01, 0x00, 0x04,
+    0x02, 0x00, 0x65, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x00, 0x04, 0x04, 0x15,
+    0x04, 0x4c, 0x0b, 0x0b, 0x0b, 0x0d, 0x0b, 0x0d, 0x11, 0x11, 0x11, 0x12,
+    0x10, 0x07, 0x07, 0x19, 0x2b, 0x25, 0x21, 0x35, 0x01, 0x33, 0x11, 0x33,
+    0x15, 0x23, 0x15, 0x23, 0x35, 0x11, 0x03, 0x01, 0x3e, 0xfe, 0xf2, 0x01,
+    0x1d, 0x3b, 0x50, 0x50, 0x4a, 0xbd, 0x99, 0x33, 0x01, 0xa4, 0xfe, 0x63,
+    0x3b, 0x98, 0xd4, 0x01, 0x1e, 0xfe, 0xe2, 0x00, 0x00, 0x01, 0x00, 0x40,
+    0xff, 0xf5, 0x01, 0xbd, 0x02, 0x6f, 0x00, 0x24, 0x00, 0x3d, 0x40, 0x3a,
+    0x1a, 0x01, 0x01, 0x04, 0x15, 0x14, 0x04, 0x03, 0x02, 0x05, 0x00, 0x01,
+    0x02, 0x4a, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x67, 0x00, 0x03,
+    0x03, 0x02, 0x5d, 0x00, 0x02, 0x02, 0x14, 0x4b, 0x00, 0x00, 0x00, 0x05,
+    0x5f, 0x06, 0x01, 0x05, 0x05, 0x1d, 0x05, 0x4c, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x23, 0x22, 0x11, 0x14, 0x25, 0x29, 0x07, 0x07, 0x19, 0x2b, 0x16,
+    0x26, 0x27, 0x37, 0x17, 0x06, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x13, 0x21, 0x15,
+    0x21, 0x07, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+    0xc0, 0x61, 0x1f, 0x40, 0x04, 0x01, 0x06, 0x0b, 0x14, 0x32, 0x23, 0x20,
+    0x38, 0x21, 0x49, 0x37, 0x20, 0x3e, 0x17, 0x2c, 0x15, 0x01, 0x3c, 0xfe,
+    0xff, 0x0a, 0x31, 0x35, 0x36, 0x55, 0x31, 0x33, 0x59, 0x38, 0x0b, 0x32,
+    0x2e, 0x30, 0x05, 0x09, 0x0f, 0x0b, 0x16, 0x15, 0x25, 0x43, 0x2d, 0x44,
+    0x50, 0x1f, 0x1c, 0x12, 0x01, 0x3d, 0x3f, 0xb3, 0x18, 0x33, 0x5f, 0x3f,
+    0x3f, 0x5e, 0x32, 0x00, 0x00, 0x02, 0x00, 0x43, 0xff, 0xf6, 0x01, 0xb7,
+    0x02, 0x76, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x44, 0x40, 0x41, 0x08, 0x01,
+    0x01, 0x00, 0x09, 0x01, 0x02, 0x01, 0x13, 0x01, 0x05, 0x04, 0x03, 0x4a,
+    0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x07, 0x01, 0x05, 0x05, 0x03, 0x5f,
+    0x06, 0x01, 0x03, 0x03, 0x1d, 0x03, 0x4c, 0x1f, 0x1f, 0x00, 0x00, 0x1f,
+    0x2e, 0x1f, 0x2d, 0x26, 0x24, 0x00, 0x1e, 0x00, 0x1d, 0x25, 0x27, 0x25,
+    0x08, 0x07, 0x17, 0x2b, 0x16, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x17, 0x07, 0x27, 0x26, 0x26, 0x27, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0xa9, 0x66, 0x36, 0x63, 0x43, 0x4e, 0x3b, 0x33, 0x05,
+    0x01, 0x07, 0x0d, 0x16, 0x24, 0x21, 0x44, 0x33, 0x01, 0x15, 0x47, 0x28,
+    0x2f, 0x4e, 0x2e, 0x2f, 0x52, 0x31, 0x30, 0x3e, 0x20, 0x32, 0x1b, 0x23,
+    0x42, 0x15, 0x02, 0x1f, 0x3a, 0x25, 0x0a, 0x9d, 0x89, 0x6e, 0x9c, 0x50,
+    0x39, 0x3a, 0x05, 0x0a, 0x0e, 0x09, 0x0f, 0x29, 0x6b, 0x5d, 0x23, 0x28,
+    0x33, 0x5d, 0x3c, 0x3d, 0x5e, 0x35, 0x3e, 0x4d, 0x44, 0x2f, 0x41, 0x20,
+    0x2f, 0x25, 0x10, 0x0a, 0x2c, 0x52, 0x35, 0x00, 0x00, 0x01, 0x00, 0x4f,
+    0x00, 0x00, 0x01, 0xb0, 0x02, 0x6f, 0x00, 0x08, 0x00, 0x1f, 0x40, 0x1c,
+    0x05, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x01, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x13, 0x11,
+    0x11, 0x03, 0x07, 0x17, 0x2b, 0x12, 0x13, 0x21, 0x35, 0x21, 0x15, 0x02,
+    0x03, 0x23, 0xf2, 0x67, 0xfe, 0xf6, 0x01, 0x61, 0x7b, 0x4b, 0x4f, 0x01,
+    0x1d, 0x01, 0x10, 0x42, 0x27, 0xfe, 0xca, 0xfe, 0xee, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x3c, 0xff, 0xf6, 0x01, 0xb9, 0x02, 0x77, 0x00, 0x19,
+    0x00, 0x25, 0x00, 0x31, 0x00, 0x35, 0x40, 0x32, 0x2b, 0x25, 0x12, 0x06,
+    0x04, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00,
+    0x00, 0x1c, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01, 0x01,
+    0x01, 0x1d, 0x01, 0x4c, 0x26, 0x26, 0x00, 0x00, 0x26, 0x31, 0x26, 0x30,
+    0x20, 0x1e, 0x00, 0x19, 0x00, 0x18, 0x2b, 0x06, 0x07, 0x15, 0x2b, 0x16,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x12, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x17, 0x12, 0x36, 0x35, 0x34, 0x26, 0x27, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0xc1, 0x57, 0x2e, 0x44, 0x39, 0x2b, 0x34, 0x56, 0x4f, 0x52, 0x53,
+    0x36, 0x2d, 0x36, 0x42, 0x2f, 0x57, 0x39, 0x36, 0x30, 0x34, 0x2f, 0x2f,
+    0x31, 0x36, 0x38, 0x29, 0x3e, 0x48, 0x3d, 0x2e, 0x3b, 0x41, 0x37, 0x0a,
+    0x2c, 0x4c, 0x2f, 0x36, 0x5e, 0x1a, 0x16, 0x4f, 0x2d, 0x43, 0x57, 0x53,
+    0x41, 0x2d, 0x51, 0x18, 0x19, 0x5d, 0x36, 0x30, 0x4e, 0x2d, 0x01, 0x85,
+    0x43, 0x23, 0x26, 0x35, 0x33, 0x25, 0x2a, 0x36, 0x1e, 0xfe, 0xcf, 0x3d,
+    0x2f, 0x2e, 0x4d, 0x13, 0x13, 0x4c, 0x2c, 0x2f, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x44, 0xff, 0xf6, 0x01, 0xb7, 0x02, 0x73, 0x00, 0x1d,
+    0x00, 0x29, 0x00, 0x48, 0x40, 0x45, 0x20, 0x01, 0x05, 0x04, 0x12, 0x01,
+    0x02, 0x05, 0x09, 0x01, 0x01, 0x02, 0x08, 0x01, 0x00, 0x01, 0x04, 0x4a,
+    0x07, 0x01, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x00, 0x04, 0x04,
+    0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x14, 0x4b, 0x00, 0x01, 0x01, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x1e, 0x1e, 0x00, 0x00, 0x1e,
+    0x29, 0x1e, 0x28, 0x24, 0x22, 0x00, 0x1d, 0x00, 0x1c, 0x24, 0x27, 0x25,
+    0x08, 0x07, 0x17, 0x2b, 0x00, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x22,
+    0x27, 0x37, 0x17, 0x16, 0x16, 0x17, 0x16, 0x33, 0x32, 0x36, 0x37, 0x06,
+    0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x12, 0x36,
+    0x37, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x01, 0x31,
+    0x57, 0x2f, 0x6e, 0x65, 0x5a, 0x3b, 0x32, 0x05, 0x01, 0x08, 0x0c, 0x1b,
+    0x28, 0x44, 0x4a, 0x07, 0x19, 0x3b, 0x26, 0x33, 0x53, 0x2f, 0x30, 0x52,
+    0x31, 0x2d, 0x39, 0x17, 0x04, 0x3b, 0x3b, 0x34, 0x3e, 0x42, 0x30, 0x02,
+    0x73, 0x43, 0x78, 0x4d, 0xb8, 0xbb, 0x02, 0x39, 0x39, 0x05, 0x0a, 0x0e,
+    0x08, 0x11, 0x84, 0x63, 0x16, 0x17, 0x30, 0x55, 0x37, 0x39, 0x5d, 0x35,
+    0xfe, 0xb6, 0x18, 0x1c, 0x6e, 0x6b, 0x4c, 0x41, 0x3a, 0x46, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x39, 0xff, 0xf5, 0x01, 0xbb, 0x02, 0x73, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x2c, 0x40, 0x29, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x14, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01,
+    0x01, 0x01, 0x1d, 0x01, 0x4c, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c,
+    0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b,
+    0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0x9d, 0x64, 0x65, 0x5c, 0x5c, 0x65, 0x64, 0x5d, 0x39, 0x40, 0x40, 0x39,
+    0x39, 0x40, 0x40, 0x39, 0x0b, 0xa6, 0x99, 0x95, 0xaa, 0xaa, 0x95, 0x99,
+    0xa6, 0x3d, 0x86, 0x7c, 0x77, 0x8b, 0x8b, 0x77, 0x7c, 0x86, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x39, 0xff, 0xf5, 0x01, 0xbb, 0x02, 0x73, 0x00, 0x26,
+    0x02, 0x21, 0x0f, 0xee, 0x01, 0x02, 0x01, 0xe9, 0x00, 0x00, 0x00, 0x09,
+    0xb1, 0x00, 0x01, 0xb8, 0xff, 0xee, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x78, 0xff, 0xfb, 0x01, 0x8c, 0x01, 0x84, 0x00, 0x0b,
+    0x00, 0x13, 0x00, 0x1b, 0x00, 0x3a, 0x40, 0x37, 0x19, 0x18, 0x11, 0x10,
+    0x04, 0x03, 0x02, 0x01, 0x4a, 0x05, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x04,
+    0x01, 0x01, 0x01, 0x30, 0x4b, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x31, 0x00, 0x4c, 0x14, 0x14, 0x0c, 0x0c, 0x00, 0x00, 0x14,
+    0x1b, 0x14, 0x1a, 0x0c, 0x13, 0x0c, 0x12, 0x00, 0x0b, 0x00, 0x0a, 0x24,
+    0x07, 0x08, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x06, 0x06, 0x15, 0x14, 0x17, 0x37, 0x26, 0x23,
+    0x12, 0x36, 0x35, 0x34, 0x27, 0x07, 0x16, 0x33, 0x01, 0x43, 0x49, 0x47,
+    0x43, 0x43, 0x47, 0x48, 0x42, 0x24, 0x2a, 0x07, 0x82, 0x14, 0x27, 0x25,
+    0x29, 0x04, 0x80, 0x14, 0x22, 0x01, 0x84, 0x69, 0x5b, 0x5f, 0x66, 0x66,
+    0x5f, 0x5c, 0x68, 0x37, 0x4c, 0x41, 0x2a, 0x1b, 0xa9, 0x29, 0xfe, 0xe5,
+    0x4a, 0x44, 0x20, 0x14, 0xa3, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7a,
+    0xff, 0xf6, 0x01, 0x2b, 0x01, 0x72, 0x00, 0x06, 0x00, 0x4a, 0xb7, 0x02,
+    0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x4b, 0xb0, 0x2c, 0x50, 0x58,
+    0x40, 0x0b, 0x00, 0x00, 0x00, 0x28, 0x4b, 0x00, 0x01, 0x01, 0x29, 0x01,
+    0x4c, 0x1b, 0x4b, 0xb0, 0x32, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x00,
+    0x01, 0x5d, 0x00, 0x01, 0x01, 0x29, 0x01, 0x4c, 0x1b, 0x40, 0x10, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x01,
+    0x00, 0x01, 0x4d, 0x59, 0x59, 0xb4, 0x11, 0x13, 0x02, 0x08, 0x16, 0x2b,
+    0x13, 0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0xeb, 0x61, 0x10, 0x85, 0x2c,
+    0x40, 0x01, 0x2c, 0x23, 0x1f, 0x4a, 0xfe, 0x84, 0xff, 0xff, 0x00, 0x6f,
+    0x00, 0x00, 0x01, 0x90, 0x01, 0x83, 0x01, 0x07, 0x02, 0x0b, 0x00, 0x00,
+    0xff, 0x03, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8, 0xff, 0x03, 0xb0, 0x33,
+    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x70, 0xff, 0xf2, 0x01, 0x97,
+    0x01, 0x7b, 0x01, 0x07, 0x02, 0x0c, 0x00, 0x00, 0xfe, 0xfb, 0x00, 0x09,
+    0xb1, 0x00, 0x01, 0xb8, 0xfe, 0xfb, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x5b, 0x00, 0x01, 0x01, 0x96, 0x01, 0x7d, 0x01, 0x07,
+    0x02, 0x0d, 0x00, 0x00, 0xff, 0x04, 0x00, 0x09, 0xb1, 0x00, 0x02, 0xb8,
+    0xff, 0x04, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7b,
+    0xff, 0xfb, 0x01, 0x82, 0x01, 0x7d, 0x00, 0x20, 0x00, 0x3d, 0x40, 0x3a,
+    0x1e, 0x01, 0x02, 0x05, 0x19, 0x18, 0x0b, 0x0a, 0x08, 0x05, 0x01, 0x02,
+    0x02, 0x4a, 0x06, 0x01, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x00,
+    0x04, 0x04, 0x03, 0x5d, 0x00, 0x03, 0x03, 0x28, 0x4b, 0x00, 0x01, 0x01,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x31, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x1f, 0x11, 0x13, 0x24, 0x29, 0x24, 0x07, 0x08, 0x19, 0x2b, 0x00,
+    0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x37, 0x17, 0x06,
+    0x16, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07,
+    0x27, 0x37, 0x33, 0x15, 0x23, 0x07, 0x36, 0x33, 0x01, 0x40, 0x42, 0x4c,
+    0x3b, 0x29, 0x43, 0x14, 0x2e, 0x08, 0x04, 0x01, 0x07, 0x0d, 0x14, 0x1a,
+    0x22, 0x29, 0x23, 0x1e, 0x31, 0x1c, 0x27, 0x0f, 0xd3, 0x9f, 0x06, 0x1c,
+    0x26, 0x01, 0x01, 0x45, 0x38, 0x3d, 0x4c, 0x25, 0x20, 0x22, 0x06, 0x05,
+    0x09, 0x0e, 0x0a, 0x10, 0x2e, 0x24, 0x21, 0x25, 0x1c, 0x0f, 0xc0, 0x36,
+    0x57, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x79, 0xff, 0xfb, 0x01, 0x7d,
+    0x01, 0x84, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x48, 0x40, 0x45, 0x08, 0x01,
+    0x01, 0x00, 0x0a, 0x01, 0x02, 0x01, 0x13, 0x01, 0x04, 0x02, 0x23, 0x01,
+    0x05, 0x04, 0x04, 0x4a, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67,
+    0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x30, 0x4b, 0x07, 0x01,
+    0x05, 0x05, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x31, 0x03, 0x4c, 0x1c,
+    0x1c, 0x00, 0x00, 0x1c, 0x28, 0x1c, 0x27, 0x22, 0x20, 0x00, 0x1b, 0x00,
+    0x1a, 0x23, 0x29, 0x24, 0x08, 0x08, 0x17, 0x2b, 0x16, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07, 0x27, 0x26, 0x26, 0x27, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0xc1, 0x48, 0x50, 0x42, 0x21, 0x30, 0x17, 0x20, 0x06, 0x06, 0x02,
+    0x09, 0x0d, 0x0e, 0x10, 0x22, 0x33, 0x05, 0x25, 0x24, 0x38, 0x45, 0x4a,
+    0x37, 0x25, 0x21, 0x27, 0x1f, 0x21, 0x23, 0x01, 0x2b, 0x22, 0x05, 0x62,
+    0x54, 0x63, 0x70, 0x13, 0x16, 0x2c, 0x08, 0x04, 0x0b, 0x0d, 0x05, 0x06,
+    0x39, 0x30, 0x19, 0x45, 0x3b, 0x3a, 0x49, 0x39, 0x25, 0x24, 0x25, 0x2a,
+    0x17, 0x07, 0x0d, 0x30, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x92,
+    0x00, 0x01, 0x01, 0x72, 0x01, 0x7d, 0x00, 0x08, 0x00, 0x1f, 0x40, 0x1c,
+    0x05, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x01, 0x28, 0x4b, 0x00, 0x02, 0x02, 0x29, 0x02, 0x4c, 0x13, 0x11,
+    0x11, 0x03, 0x08, 0x17, 0x2b, 0x36, 0x37, 0x23, 0x35, 0x33, 0x15, 0x06,
+    0x07, 0x23, 0xd7, 0x52, 0x97, 0xe0, 0x57, 0x2d, 0x42, 0x82, 0xc5, 0x36,
+    0x1f, 0xc9, 0x94, 0x00, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xfc, 0x01, 0x75,
+    0x01, 0x84, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x35, 0x40, 0x32,
+    0x28, 0x22, 0x10, 0x04, 0x04, 0x03, 0x02, 0x01, 0x4a, 0x00, 0x02, 0x02,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x30, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01,
+    0x5f, 0x04, 0x01, 0x01, 0x01, 0x31, 0x01, 0x4c, 0x23, 0x23, 0x00, 0x00,
+    0x23, 0x2e, 0x23, 0x2d, 0x1d, 0x1b, 0x00, 0x16, 0x00, 0x15, 0x29, 0x06,
+    0x08, 0x15, 0x2b, 0x16, 0x26, 0x35, 0x34, 0x37, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0x16, 0x36, 0x35, 0x34, 0x26, 0x27, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0xc1, 0x42, 0x48, 0x18, 0x1f, 0x3e, 0x2d, 0x2c, 0x41, 0x20,
+    0x1a, 0x22, 0x25, 0x44, 0x38, 0x21, 0x15, 0x1c, 0x17, 0x18, 0x1b, 0x1c,
+    0x1e, 0x19, 0x20, 0x26, 0x25, 0x1c, 0x1e, 0x22, 0x21, 0x04, 0x3b, 0x2d,
+    0x41, 0x27, 0x0f, 0x2e, 0x19, 0x29, 0x39, 0x37, 0x27, 0x19, 0x30, 0x10,
+    0x13, 0x30, 0x26, 0x2d, 0x3b, 0xf3, 0x1b, 0x17, 0x13, 0x1a, 0x1b, 0x15,
+    0x14, 0x19, 0x0f, 0xb0, 0x1e, 0x1a, 0x1d, 0x23, 0x0b, 0x0c, 0x22, 0x1b,
+    0x18, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x92, 0xff, 0xfb, 0x01, 0x7e,
+    0x01, 0x84, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x48, 0x40, 0x45, 0x1e, 0x01,
+    0x05, 0x04, 0x0d, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x03, 0x00, 0x04, 0x4a, 0x07, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05, 0x01,
+    0x67, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x30, 0x4b, 0x00,
+    0x00, 0x00, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x31, 0x03, 0x4c, 0x1c,
+    0x1c, 0x00, 0x00, 0x1c, 0x29, 0x1c, 0x28, 0x24, 0x22, 0x00, 0x1b, 0x00,
+    0x1a, 0x24, 0x23, 0x29, 0x08, 0x08, 0x17, 0x2b, 0x16, 0x27, 0x37, 0x37,
+    0x17, 0x1e, 0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x37, 0x06, 0x23, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36,
+    0x36, 0x37, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0xbf, 0x2a, 0x1d, 0x04, 0x06, 0x01, 0x04, 0x0b, 0x09, 0x12, 0x13,
+    0x23, 0x26, 0x04, 0x1e, 0x2c, 0x2e, 0x3d, 0x41, 0x2f, 0x3b, 0x41, 0x48,
+    0x3e, 0x1b, 0x24, 0x0d, 0x01, 0x22, 0x1f, 0x1d, 0x22, 0x20, 0x19, 0x05,
+    0x27, 0x33, 0x09, 0x04, 0x02, 0x0d, 0x0b, 0x05, 0x08, 0x3a, 0x3d, 0x21,
+    0x46, 0x35, 0x36, 0x4a, 0x59, 0x57, 0x68, 0x71, 0xc6, 0x16, 0x14, 0x06,
+    0x0b, 0x26, 0x2b, 0x27, 0x21, 0x22, 0x22, 0x00, 0xff, 0xff, 0x00, 0x78,
+    0xff, 0xfb, 0x01, 0x8c, 0x01, 0x84, 0x00, 0x02, 0x01, 0xeb, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x7a, 0xff, 0xf6, 0x01, 0x2b, 0x01, 0x72, 0x00, 0x02,
+    0x01, 0xec, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6f, 0x00, 0x00, 0x01, 0x90,
+    0x01, 0x83, 0x01, 0x07, 0x02, 0x0b, 0x00, 0x00, 0xff, 0x03, 0x00, 0x09,
+    0xb1, 0x00, 0x01, 0xb8, 0xff, 0x03, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x70, 0xff, 0xdf, 0x01, 0x97, 0x01, 0x68, 0x01, 0x07,
+    0x02, 0x0c, 0x00, 0x00, 0xfe, 0xe8, 0x00, 0x09, 0xb1, 0x00, 0x01, 0xb8,
+    0xfe, 0xe8, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5b,
+    0x00, 0x01, 0x01, 0x96, 0x01, 0x7d, 0x01, 0x07, 0x02, 0x0d, 0x00, 0x00,
+    0xff, 0x04, 0x00, 0x09, 0xb1, 0x00, 0x02, 0xb8, 0xff, 0x04, 0xb0, 0x33,
+    0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7b, 0xff, 0xfb, 0x01, 0x82,
+    0x01, 0x7d, 0x00, 0x02, 0x01, 0xf0, 0x00, 0x00, 0xff, 0xff, 0x00, 0x79,
+    0xff, 0xfb, 0x01, 0x7d, 0x01, 0x84, 0x00, 0x02, 0x01, 0xf1, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x92, 0x00, 0x01, 0x01, 0x72, 0x01, 0x7d, 0x00, 0x02,
+    0x01, 0xf2, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xfc, 0x01, 0x75,
+    0x01, 0x84, 0x00, 0x02, 0x01, 0xf3, 0x00, 0x00, 0xff, 0xff, 0x00, 0x92,
+    0xff, 0xfb, 0x01, 0x7e, 0x01, 0x84, 0x00, 0x02, 0x01, 0xf4, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x78, 0x00, 0xf7, 0x01, 0x8c, 0x02, 0x80, 0x00, 0x02,
+    0x02, 0x09, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7a, 0x00, 0xfd, 0x01, 0x2b,
+    0x02, 0x79, 0x00, 0x02, 0x02, 0x0a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x6f,
+    0x00, 0xfd, 0x01, 0x90, 0x02, 0x80, 0x00, 0x02, 0x02, 0x0b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x70, 0x00, 0xf7, 0x01, 0x97, 0x02, 0x80, 0x00, 0x02,
+    0x02, 0x0c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x5b, 0x00, 0xfd, 0x01, 0x96,
+    0x02, 0x79, 0x00, 0x02, 0x02, 0x0d, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7b,
+    0x00, 0xf7, 0x01, 0x82, 0x02, 0x79, 0x00, 0x02, 0x02, 0x0e, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x79, 0x00, 0xf7, 0x01, 0x7d, 0x02, 0x80, 0x00, 0x02,
+    0x02, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x92, 0x00, 0xfd, 0x01, 0x72,
+    0x02, 0x79, 0x00, 0x02, 0x02, 0x10, 0x00, 0x00, 0xff, 0xff, 0x00, 0x7f,
+    0x00, 0xf8, 0x01, 0x75, 0x02, 0x80, 0x00, 0x02, 0x02, 0x11, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x92, 0x00, 0xf7, 0x01, 0x7e, 0x02, 0x80, 0x00, 0x02,
+    0x02, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x78, 0x00, 0xf7, 0x01, 0x8c,
+    0x02, 0x80, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x5d, 0x40, 0x09,
+    0x19, 0x18, 0x11, 0x10, 0x04, 0x03, 0x02, 0x01, 0x4a, 0x4b, 0xb0, 0x30,
+    0x50, 0x58, 0x40, 0x18, 0x05, 0x01, 0x02, 0x02, 0x01, 0x5f, 0x04, 0x01,
+    0x01, 0x01, 0x44, 0x4b, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00,
+    0x00, 0x45, 0x00, 0x4c, 0x1b, 0x40, 0x16, 0x04, 0x01, 0x01, 0x05, 0x01,
+    0x02, 0x03, 0x01, 0x02, 0x67, 0x06, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x45, 0x00, 0x4c, 0x59, 0x40, 0x16, 0x14, 0x14, 0x0c, 0x0c,
+    0x00, 0x00, 0x14, 0x1b, 0x14, 0x1a, 0x0c, 0x13, 0x0c, 0x12, 0x00, 0x0b,
+    0x00, 0x0a, 0x24, 0x07, 0x09, 0x15, 0x2b, 0x00, 0x16, 0x15, 0x14, 0x06,
+    0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x06, 0x06, 0x15, 0x14, 0x17,
+    0x37, 0x26, 0x23, 0x12, 0x36, 0x35, 0x34, 0x27, 0x07, 0x16, 0x33, 0x01,
+    0x43, 0x49, 0x47, 0x43, 0x43, 0x47, 0x48, 0x42, 0x24, 0x2a, 0x07, 0x82,
+    0x14, 0x27, 0x25, 0x29, 0x04, 0x80, 0x14, 0x22, 0x02, 0x80, 0x69, 0x5b,
+    0x5f, 0x66, 0x66, 0x5f, 0x5c, 0x68, 0x37, 0x4c, 0x41, 0x2a, 0x1b, 0xa9,
+    0x29, 0xfe, 0xe5, 0x4a, 0x44, 0x20, 0x14, 0xa3, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x7a, 0x00, 0xfd, 0x01, 0x2b, 0x02, 0x79, 0x00, 0x06,
+    0x00, 0x31, 0xb7, 0x02, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x4a, 0x4b,
+    0xb0, 0x30, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x3c, 0x4b, 0x00,
+    0x01, 0x01, 0x3d, 0x01, 0x4c, 0x1b, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x01,
+    0x5d, 0x00, 0x01, 0x01, 0x3d, 0x01, 0x4c, 0x59, 0xb4, 0x11, 0x13, 0x02,
+    0x09, 0x16, 0x2b, 0x13, 0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0xeb, 0x61,
+    0x10, 0x85, 0x2c, 0x40, 0x02, 0x33, 0x23, 0x1f, 0x4a, 0xfe, 0x84, 0x00,
+    0x00, 0x01, 0x00, 0x6f, 0x00, 0xfd, 0x01, 0x90, 0x02, 0x80, 0x00, 0x23,
+    0x00, 0x4c, 0x40, 0x0e, 0x23, 0x12, 0x10, 0x0f, 0x04, 0x03, 0x01, 0x01,
+    0x4a, 0x03, 0x01, 0x03, 0x01, 0x49, 0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40,
+    0x15, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00,
+    0x03, 0x03, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x1b, 0x40,
+    0x13, 0x00, 0x02, 0x00, 0x01, 0x03, 0x02, 0x01, 0x67, 0x00, 0x03, 0x03,
+    0x00, 0x5d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x4c, 0x59, 0xb6, 0x29, 0x29,
+    0x27, 0x11, 0x04, 0x09, 0x18, 0x2b, 0x01, 0x15, 0x21, 0x35, 0x3e, 0x02,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x06, 0x17, 0x07, 0x27, 0x27,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x06, 0x06,
+    0x07, 0x33, 0x32, 0x36, 0x37, 0x01, 0x90, 0xfe, 0xe9, 0x4f, 0x52, 0x28,
+    0x1e, 0x1a, 0x33, 0x22, 0x0b, 0x04, 0x01, 0x04, 0x08, 0x2c, 0x18, 0x51,
+    0x33, 0x3a, 0x3f, 0x25, 0x38, 0x34, 0x0b, 0x1a, 0x0d, 0xa3, 0x10, 0x0f,
+    0x06, 0x01, 0x3d, 0x40, 0x36, 0x41, 0x4b, 0x37, 0x17, 0x1c, 0x1d, 0x21,
+    0x0a, 0x0e, 0x0b, 0x06, 0x06, 0x28, 0x28, 0x2e, 0x40, 0x33, 0x20, 0x39,
+    0x32, 0x28, 0x09, 0x13, 0x0b, 0x04, 0x06, 0x00, 0x00, 0x01, 0x00, 0x70,
+    0x00, 0xf7, 0x01, 0x97, 0x02, 0x80, 0x00, 0x2c, 0x00, 0x6d, 0x40, 0x11,
+    0x1d, 0x1c, 0x02, 0x02, 0x03, 0x25, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01,
+    0x03, 0x00, 0x01, 0x03, 0x4a, 0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40, 0x20,
+    0x00, 0x03, 0x03, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x44, 0x4b, 0x00, 0x01,
+    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x47, 0x4b, 0x00, 0x00, 0x00, 0x05,
+    0x5f, 0x06, 0x01, 0x05, 0x05, 0x45, 0x05, 0x4c, 0x1b, 0x40, 0x1e, 0x00,
+    0x04, 0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x00, 0x01, 0x01, 0x02, 0x5f,
+    0x00, 0x02, 0x02, 0x47, 0x4b, 0x00, 0x00, 0x00, 0x05, 0x5f, 0x06, 0x01,
+    0x05, 0x05, 0x45, 0x05, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x2c,
+    0x00, 0x2b, 0x23, 0x23, 0x31, 0x34, 0x29, 0x07, 0x09, 0x19, 0x2b, 0x36,
+    0x27, 0x37, 0x17, 0x14, 0x16, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x35, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x23, 0x22, 0x07, 0x27, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0xa9, 0x39, 0x30, 0x05,
+    0x01, 0x08, 0x07, 0x0f, 0x25, 0x1b, 0x25, 0x2e, 0x30, 0x27, 0x08, 0x16,
+    0x07, 0x0d, 0x28, 0x23, 0x40, 0x37, 0x27, 0x28, 0x34, 0x53, 0x38, 0x46,
+    0x18, 0x19, 0x21, 0x27, 0x28, 0x44, 0x28, 0xf7, 0x45, 0x37, 0x05, 0x02,
+    0x0e, 0x0d, 0x07, 0x0e, 0x0e, 0x21, 0x1b, 0x1f, 0x20, 0x02, 0x37, 0x01,
+    0x1c, 0x1b, 0x33, 0x30, 0x2c, 0x3d, 0x34, 0x2c, 0x1f, 0x2a, 0x0e, 0x08,
+    0x30, 0x22, 0x21, 0x37, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5b,
+    0x00, 0xfd, 0x01, 0x96, 0x02, 0x79, 0x00, 0x0a, 0x00, 0x0d, 0x00, 0x54,
+    0x40, 0x0a, 0x0c, 0x01, 0x02, 0x01, 0x02, 0x01, 0x00, 0x02, 0x02, 0x4a,
+    0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40, 0x16, 0x06, 0x05, 0x02, 0x02, 0x03,
+    0x01, 0x00, 0x04, 0x02, 0x00, 0x65, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00,
+    0x04, 0x04, 0x3d, 0x04, 0x4c, 0x1b, 0x40, 0x16, 0x06, 0x05, 0x02, 0x02,
+    0x03, 0x01, 0x00, 0x04, 0x02, 0x00, 0x65, 0x00, 0x01, 0x01, 0x04, 0x5d,
+    0x00, 0x04, 0x04, 0x3d, 0x04, 0x4c, 0x59, 0x40, 0x0e, 0x0b, 0x0b, 0x0b,
+    0x0d, 0x0b, 0x0d, 0x11, 0x11, 0x11, 0x12, 0x10, 0x07, 0x09, 0x19, 0x2b,
+    0x01, 0x23, 0x35, 0x37, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35,
+    0x35, 0x07, 0x01, 0x1c, 0xc1, 0xca, 0x32, 0x3f, 0x3f, 0x3b, 0x82, 0x01,
+    0x57, 0x34, 0xee, 0xed, 0x36, 0x59, 0x8f, 0x96, 0x96, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x7b, 0x00, 0xf7, 0x01, 0x82, 0x02, 0x79, 0x00, 0x20,
+    0x00, 0x66, 0x40, 0x0e, 0x1e, 0x01, 0x02, 0x05, 0x19, 0x18, 0x0b, 0x0a,
+    0x08, 0x05, 0x01, 0x02, 0x02, 0x4a, 0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40,
+    0x1e, 0x06, 0x01, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x00, 0x04,
+    0x04, 0x03, 0x5d, 0x00, 0x03, 0x03, 0x3c, 0x4b, 0x00, 0x01, 0x01, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x4c, 0x1b, 0x40, 0x1c, 0x00, 0x03,
+    0x00, 0x04, 0x05, 0x03, 0x04, 0x65, 0x06, 0x01, 0x05, 0x00, 0x02, 0x01,
+    0x05, 0x02, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x45,
+    0x00, 0x4c, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x1f, 0x11,
+    0x13, 0x24, 0x29, 0x24, 0x07, 0x09, 0x19, 0x2b, 0x00, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x37, 0x17, 0x06, 0x16, 0x17, 0x16,
+    0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x27, 0x37, 0x33,
+    0x15, 0x23, 0x07, 0x36, 0x33, 0x01, 0x40, 0x42, 0x4c, 0x3b, 0x29, 0x43,
+    0x14, 0x2e, 0x08, 0x04, 0x01, 0x07, 0x0d, 0x14, 0x1a, 0x22, 0x29, 0x23,
+    0x1e, 0x31, 0x1c, 0x27, 0x0f, 0xd3, 0x9f, 0x06, 0x1c, 0x26, 0x01, 0xfd,
+    0x45, 0x38, 0x3d, 0x4c, 0x25, 0x20, 0x22, 0x06, 0x05, 0x09, 0x0e, 0x0a,
+    0x10, 0x2e, 0x24, 0x21, 0x25, 0x1c, 0x0f, 0xc0, 0x36, 0x57, 0x11, 0x00,
+    0x00, 0x02, 0x00, 0x79, 0x00, 0xf7, 0x01, 0x7d, 0x02, 0x80, 0x00, 0x1b,
+    0x00, 0x28, 0x00, 0x72, 0x40, 0x12, 0x08, 0x01, 0x01, 0x00, 0x0a, 0x01,
+    0x02, 0x01, 0x13, 0x01, 0x04, 0x02, 0x23, 0x01, 0x05, 0x04, 0x04, 0x4a,
+    0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x02, 0x00, 0x04, 0x05,
+    0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x44,
+    0x4b, 0x07, 0x01, 0x05, 0x05, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x45,
+    0x03, 0x4c, 0x1b, 0x40, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x67, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x07, 0x01, 0x05,
+    0x05, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x40,
+    0x14, 0x1c, 0x1c, 0x00, 0x00, 0x1c, 0x28, 0x1c, 0x27, 0x22, 0x20, 0x00,
+    0x1b, 0x00, 0x1a, 0x23, 0x29, 0x24, 0x08, 0x09, 0x17, 0x2b, 0x36, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x07, 0x27, 0x26, 0x26,
+    0x27, 0x26, 0x23, 0x22, 0x06, 0x07, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0xc1, 0x48, 0x50, 0x42, 0x21, 0x30, 0x17, 0x20, 0x06,
+    0x06, 0x02, 0x09, 0x0d, 0x0e, 0x10, 0x22, 0x33, 0x05, 0x25, 0x24, 0x38,
+    0x45, 0x4a, 0x37, 0x25, 0x21, 0x27, 0x1f, 0x22, 0x22, 0x01, 0x2b, 0x22,
+    0xf7, 0x62, 0x54, 0x63, 0x70, 0x13, 0x16, 0x2c, 0x08, 0x04, 0x0b, 0x0d,
+    0x05, 0x06, 0x39, 0x30, 0x19, 0x45, 0x3b, 0x3a, 0x49, 0x39, 0x25, 0x24,
+    0x25, 0x2a, 0x17, 0x07, 0x0d, 0x30, 0x3d, 0x00, 0x00, 0x01, 0x00, 0x92,
+    0x00, 0xfd, 0x01, 0x72, 0x02, 0x79, 0x00, 0x08, 0x00, 0x38, 0xb5, 0x05,
+    0x01, 0x00, 0x01, 0x01, 0x4a, 0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40, 0x10,
+    0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x01, 0x01, 0x3c, 0x4b, 0x00, 0x02,
+    0x02, 0x3d, 0x02, 0x4c, 0x1b, 0x40, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x02,
+    0x01, 0x00, 0x65, 0x00, 0x02, 0x02, 0x3d, 0x02, 0x4c, 0x59, 0xb5, 0x13,
+    0x11, 0x11, 0x03, 0x09, 0x17, 0x2b, 0x12, 0x37, 0x23, 0x35, 0x33, 0x15,
+    0x06, 0x07, 0x23, 0xd7, 0x52, 0x97, 0xe0, 0x57, 0x2d, 0x42, 0x01, 0x7e,
+    0xc5, 0x36, 0x1f, 0xc9, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7f,
+    0x00, 0xf8, 0x01, 0x75, 0x02, 0x80, 0x00, 0x16, 0x00, 0x22, 0x00, 0x2e,
+    0x00, 0x57, 0x40, 0x09, 0x28, 0x22, 0x10, 0x04, 0x04, 0x03, 0x02, 0x01,
+    0x4a, 0x4b, 0xb0, 0x30, 0x50, 0x58, 0x40, 0x17, 0x00, 0x02, 0x02, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x44, 0x4b, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f,
+    0x04, 0x01, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x1b, 0x40, 0x15, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f,
+    0x04, 0x01, 0x01, 0x01, 0x45, 0x01, 0x4c, 0x59, 0x40, 0x12, 0x23, 0x23,
+    0x00, 0x00, 0x23, 0x2e, 0x23, 0x2d, 0x1d, 0x1b, 0x00, 0x16, 0x00, 0x15,
+    0x29, 0x06, 0x09, 0x15, 0x2b, 0x36, 0x26, 0x35, 0x34, 0x37, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x17, 0x16, 0x36, 0x35, 0x34, 0x26, 0x27, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x33, 0xc1, 0x42, 0x48, 0x18, 0x1f, 0x3e, 0x2d, 0x2c,
+    0x41, 0x20, 0x1a, 0x22, 0x25, 0x44, 0x38, 0x21, 0x15, 0x1c, 0x17, 0x18,
+    0x1b, 0x1c, 0x1e, 0x19, 0x20, 0x26, 0x25, 0x1c, 0x1e, 0x22, 0x21, 0xf8,
+    0x3b, 0x2d, 0x41, 0x27, 0x0f, 0x2e, 0x19, 0x29, 0x39, 0x37, 0x27, 0x19,
+    0x30, 0x10, 0x13, 0x30, 0x26, 0x2d, 0x3b, 0xf3, 0x1b, 0x17, 0x13, 0x1a,
+    0x1b, 0x15, 0x14, 0x19, 0x0f, 0xb0, 0x1e, 0x1a, 0x1d, 0x23, 0x0b, 0x0c,
+    0x22, 0x1b, 0x18, 0x22, 0x00, 0x02, 0x00, 0x92, 0x00, 0xf7, 0x01, 0x7e,
+    0x02, 0x80, 0x00, 0x1b, 0x00, 0x29, 0x00, 0x9c, 0x40, 0x12, 0x1e, 0x01,
+    0x05, 0x04, 0x0d, 0x01, 0x01, 0x05, 0x03, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x03, 0x00, 0x04, 0x4a, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x21, 0x00,
+    0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00, 0x01, 0x01,
+    0x05, 0x5f, 0x07, 0x01, 0x05, 0x05, 0x3f, 0x4b, 0x00, 0x00, 0x00, 0x03,
+    0x5f, 0x06, 0x01, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x30,
+    0x50, 0x58, 0x40, 0x1f, 0x07, 0x01, 0x05, 0x00, 0x01, 0x00, 0x05, 0x01,
+    0x67, 0x00, 0x04, 0x04, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x44, 0x4b, 0x00,
+    0x00, 0x00, 0x03, 0x5f, 0x06, 0x01, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x1b,
+    0x40, 0x1d, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x07, 0x01,
+    0x05, 0x00, 0x01, 0x00, 0x05, 0x01, 0x67, 0x00, 0x00, 0x00, 0x03, 0x5f,
+    0x06, 0x01, 0x03, 0x03, 0x45, 0x03, 0x4c, 0x59, 0x59, 0x40, 0x14, 0x1c,
+    0x1c, 0x00, 0x00, 0x1c, 0x29, 0x1c, 0x28, 0x24, 0x22, 0x00, 0x1b, 0x00,
+    0x1a, 0x24, 0x23, 0x29, 0x08, 0x09, 0x17, 0x2b, 0x36, 0x27, 0x37, 0x37,
+    0x17, 0x1e, 0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x37, 0x06, 0x23, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36,
+    0x36, 0x37, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0xbf, 0x2a, 0x1d, 0x04, 0x06, 0x01, 0x04, 0x0b, 0x09, 0x12, 0x13,
+    0x23, 0x26, 0x04, 0x1e, 0x2c, 0x2e, 0x3d, 0x41, 0x2f, 0x3b, 0x41, 0x48,
+    0x3e, 0x1b, 0x24, 0x0d, 0x01, 0x22, 0x1f, 0x1d, 0x22, 0x20, 0x19, 0xf7,
+    0x27, 0x33, 0x09, 0x04, 0x02, 0x0d, 0x0b, 0x05, 0x08, 0x3a, 0x3d, 0x21,
+    0x46, 0x35, 0x36, 0x4a, 0x59, 0x57, 0x68, 0x71, 0xc6, 0x16, 0x14, 0x06,
+    0x0b, 0x26, 0x2b, 0x27, 0x21, 0x22, 0x22, 0x00, 0x00, 0x01, 0x00, 0x4c,
+    0xff, 0xd6, 0x01, 0xb5, 0x02, 0x99, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x17, 0x01, 0x17, 0x01, 0x4c, 0x01, 0x39, 0x30,
+    0xfe, 0xc6, 0x10, 0x02, 0xa9, 0x1b, 0xfd, 0x58, 0x00, 0x03, 0x00, 0x05,
+    0xff, 0xb7, 0x01, 0xee, 0x02, 0xa5, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x2a,
+    0x00, 0x45, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x3a, 0x09, 0x02, 0x01, 0x00,
+    0x04, 0x01, 0x00, 0x19, 0x01, 0x04, 0x02, 0x0b, 0x01, 0x05, 0x04, 0x03,
+    0x4a, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x65, 0x00, 0x03, 0x00,
+    0x02, 0x04, 0x03, 0x02, 0x67, 0x00, 0x04, 0x05, 0x05, 0x04, 0x55, 0x00,
+    0x04, 0x04, 0x05, 0x5d, 0x00, 0x05, 0x04, 0x05, 0x4d, 0x14, 0x18, 0x26,
+    0x2c, 0x11, 0x13, 0x06, 0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13,
+    0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0x03, 0x01, 0x17, 0x01, 0x37, 0x36,
+    0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x07, 0x06, 0x06, 0x07,
+    0x27, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x06, 0x07,
+    0x33, 0x32, 0x36, 0x33, 0x15, 0x23, 0x5f, 0x4d, 0x0d, 0x6b, 0x22, 0x33,
+    0x13, 0x01, 0x39, 0x30, 0xfe, 0xc6, 0x93, 0x2a, 0x3f, 0x26, 0x1a, 0x21,
+    0x1b, 0x2e, 0x19, 0x02, 0x04, 0x02, 0x25, 0x27, 0x57, 0x29, 0x39, 0x0d,
+    0x24, 0x28, 0x2c, 0x19, 0x92, 0x02, 0x0d, 0x04, 0xe0, 0x02, 0x66, 0x14,
+    0x19, 0x3a, 0xfe, 0xd1, 0xfe, 0x7a, 0x02, 0xa9, 0x1b, 0xfd, 0x58, 0x04,
+    0x38, 0x2f, 0x1e, 0x1d, 0x10, 0x19, 0x1d, 0x22, 0x02, 0x0c, 0x03, 0x19,
+    0x43, 0x37, 0x25, 0x16, 0x1e, 0x20, 0x1c, 0x20, 0x1c, 0x07, 0x33, 0x00,
+    0x00, 0x04, 0x00, 0x05, 0xff, 0xba, 0x01, 0xdd, 0x02, 0xa5, 0x00, 0x06,
+    0x00, 0x0a, 0x00, 0x15, 0x00, 0x18, 0x00, 0x4f, 0xb1, 0x06, 0x64, 0x44,
+    0x40, 0x44, 0x09, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x17, 0x01, 0x04,
+    0x03, 0x0d, 0x01, 0x02, 0x04, 0x03, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x03,
+    0x00, 0x01, 0x65, 0x00, 0x03, 0x04, 0x06, 0x03, 0x55, 0x08, 0x07, 0x02,
+    0x04, 0x05, 0x01, 0x02, 0x06, 0x04, 0x02, 0x65, 0x00, 0x03, 0x03, 0x06,
+    0x5d, 0x00, 0x06, 0x03, 0x06, 0x4d, 0x16, 0x16, 0x16, 0x18, 0x16, 0x18,
+    0x11, 0x11, 0x11, 0x12, 0x15, 0x11, 0x13, 0x09, 0x07, 0x1b, 0x2b, 0xb1,
+    0x06, 0x00, 0x44, 0x13, 0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0x03, 0x01,
+    0x17, 0x01, 0x25, 0x23, 0x35, 0x37, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15,
+    0x23, 0x37, 0x35, 0x07, 0x5f, 0x4d, 0x0d, 0x6b, 0x22, 0x33, 0x13, 0x01,
+    0x39, 0x30, 0xfe, 0xc6, 0x01, 0x02, 0x91, 0xa0, 0x1f, 0x32, 0x32, 0x2e,
+    0x01, 0x5e, 0x02, 0x66, 0x14, 0x19, 0x3a, 0xfe, 0xd1, 0xfe, 0x7a, 0x02,
+    0xa9, 0x1b, 0xfd, 0x58, 0x32, 0x1d, 0xcd, 0xc5, 0x25, 0x4e, 0x73, 0x77,
+    0x77, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0b, 0xff, 0xba, 0x01, 0xdd,
+    0x02, 0xac, 0x00, 0x2a, 0x00, 0x2e, 0x00, 0x39, 0x00, 0x3c, 0x00, 0x79,
+    0xb1, 0x06, 0x64, 0x44, 0x40, 0x6e, 0x2d, 0x1c, 0x1b, 0x10, 0x04, 0x02,
+    0x03, 0x24, 0x12, 0x02, 0x01, 0x02, 0x0f, 0x02, 0x01, 0x03, 0x00, 0x01,
+    0x3b, 0x01, 0x08, 0x07, 0x31, 0x01, 0x06, 0x08, 0x05, 0x4a, 0x00, 0x04,
+    0x00, 0x03, 0x02, 0x04, 0x03, 0x67, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02,
+    0x01, 0x67, 0x00, 0x00, 0x0c, 0x01, 0x05, 0x07, 0x00, 0x05, 0x67, 0x00,
+    0x07, 0x08, 0x0a, 0x07, 0x55, 0x0d, 0x0b, 0x02, 0x08, 0x09, 0x01, 0x06,
+    0x0a, 0x08, 0x06, 0x65, 0x00, 0x07, 0x07, 0x0a, 0x5d, 0x00, 0x0a, 0x07,
+    0x0a, 0x4d, 0x3a, 0x3a, 0x00, 0x00, 0x3a, 0x3c, 0x3a, 0x3c, 0x39, 0x38,
+    0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x30, 0x2f, 0x00, 0x2a, 0x00, 0x29,
+    0x23, 0x24, 0x15, 0x24, 0x26, 0x0e, 0x07, 0x19, 0x2b, 0xb1, 0x06, 0x00,
+    0x44, 0x12, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x07, 0x35, 0x16, 0x33, 0x37, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x07, 0x27, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x03, 0x01, 0x17, 0x01,
+    0x37, 0x23, 0x35, 0x37, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x37,
+    0x35, 0x07, 0x39, 0x2e, 0x26, 0x02, 0x06, 0x03, 0x1a, 0x25, 0x1d, 0x2d,
+    0x21, 0x26, 0x10, 0x08, 0x06, 0x03, 0x0d, 0x1e, 0x1f, 0x22, 0x1a, 0x2d,
+    0x1d, 0x1d, 0x2a, 0x40, 0x2c, 0x3c, 0x19, 0x14, 0x1a, 0x21, 0x48, 0x31,
+    0x2c, 0x01, 0x39, 0x30, 0xfe, 0xc6, 0xfd, 0x91, 0xa0, 0x1f, 0x32, 0x32,
+    0x2e, 0x01, 0x5e, 0x01, 0x76, 0x34, 0x2a, 0x02, 0x12, 0x03, 0x1a, 0x1d,
+    0x13, 0x18, 0x18, 0x01, 0x28, 0x02, 0x01, 0x18, 0x11, 0x12, 0x1e, 0x26,
+    0x1e, 0x32, 0x32, 0x24, 0x16, 0x22, 0x07, 0x04, 0x27, 0x19, 0x27, 0x36,
+    0xfe, 0x7a, 0x02, 0xa9, 0x1b, 0xfd, 0x58, 0x32, 0x1d, 0xcd, 0xc5, 0x25,
+    0x4e, 0x73, 0x77, 0x77, 0xff, 0xff, 0x00, 0x78, 0xff, 0xf1, 0x01, 0x8c,
+    0x01, 0x7a, 0x01, 0x07, 0x02, 0x1a, 0x00, 0x00, 0xfe, 0xfa, 0x00, 0x09,
+    0xb1, 0x00, 0x02, 0xb8, 0xfe, 0xfa, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x78, 0xff, 0xf1, 0x01, 0x8c, 0x01, 0x7a, 0x01, 0x07,
+    0x02, 0x1a, 0x00, 0x00, 0xfe, 0xfa, 0x00, 0x09, 0xb1, 0x00, 0x02, 0xb8,
+    0xfe, 0xfa, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x78,
+    0x00, 0xf7, 0x01, 0x8c, 0x02, 0x80, 0x00, 0x02, 0x02, 0x1a, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x78, 0x00, 0xf7, 0x01, 0x8c, 0x02, 0x80, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x4f, 0x4b, 0xb0, 0x32, 0x50, 0x58, 0x40, 0x14, 0x05,
+    0x01, 0x03, 0x04, 0x01, 0x01, 0x03, 0x01, 0x63, 0x00, 0x02, 0x02, 0x00,
+    0x5f, 0x00, 0x00, 0x00, 0x1c, 0x02, 0x4c, 0x1b, 0x40, 0x1b, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x05, 0x01, 0x03, 0x01, 0x01, 0x03,
+    0x57, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x03, 0x01,
+    0x4f, 0x59, 0x40, 0x12, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16,
+    0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0x36,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xbf,
+    0x47, 0x48, 0x42, 0x41, 0x49, 0x47, 0x43, 0x25, 0x29, 0x2a, 0x24, 0x24,
+    0x2a, 0x29, 0x25, 0xf7, 0x66, 0x5f, 0x5c, 0x68, 0x69, 0x5b, 0x5f, 0x66,
+    0x37, 0x4a, 0x44, 0x41, 0x4c, 0x4c, 0x41, 0x44, 0x4a, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x78, 0xff, 0xfb, 0x01, 0x8c, 0x01, 0x84, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+    0x02, 0x67, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x01,
+    0x15, 0x01, 0x4c, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16, 0x12,
+    0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0x16, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xbf, 0x47,
+    0x48, 0x42, 0x41, 0x49, 0x47, 0x43, 0x25, 0x29, 0x2a, 0x24, 0x24, 0x2a,
+    0x29, 0x25, 0x05, 0x66, 0x5f, 0x5c, 0x68, 0x69, 0x5b, 0x5f, 0x66, 0x37,
+    0x4a, 0x44, 0x41, 0x4c, 0x4c, 0x41, 0x44, 0x4a, 0xff, 0xff, 0x00, 0x78,
+    0xff, 0xfb, 0x01, 0x8c, 0x01, 0x84, 0x00, 0x02, 0x02, 0x1b, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x78, 0x00, 0xf7, 0x01, 0x8c, 0x02, 0x80, 0x00, 0x02,
+    0x02, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x78, 0x00, 0xf7, 0x01, 0x8c,
+    0x02, 0x80, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x23, 0x00, 0x91, 0x4b, 0xb0,
+    0x1f, 0x50, 0x58, 0x40, 0x1f, 0x07, 0x01, 0x03, 0x06, 0x01, 0x01, 0x03,
+    0x01, 0x63, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b,
+    0x08, 0x01, 0x05, 0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1f, 0x05, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x32, 0x50, 0x58, 0x40, 0x1d, 0x00, 0x04, 0x08, 0x01,
+    0x05, 0x03, 0x04, 0x05, 0x67, 0x07, 0x01, 0x03, 0x06, 0x01, 0x01, 0x03,
+    0x01, 0x63, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x02,
+    0x4c, 0x1b, 0x40, 0x24, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x02, 0x67,
+    0x00, 0x04, 0x08, 0x01, 0x05, 0x03, 0x04, 0x05, 0x67, 0x07, 0x01, 0x03,
+    0x01, 0x01, 0x03, 0x57, 0x07, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x06, 0x01,
+    0x01, 0x03, 0x01, 0x4f, 0x59, 0x59, 0x40, 0x1a, 0x18, 0x18, 0x0c, 0x0c,
+    0x00, 0x00, 0x18, 0x23, 0x18, 0x22, 0x1e, 0x1c, 0x0c, 0x17, 0x0c, 0x16,
+    0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x09, 0x07, 0x15, 0x2b, 0x36,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xbf,
+    0x47, 0x48, 0x42, 0x41, 0x49, 0x47, 0x43, 0x25, 0x29, 0x2a, 0x24, 0x24,
+    0x2a, 0x29, 0x25, 0x0d, 0x15, 0x16, 0x0e, 0x0e, 0x16, 0x15, 0x0f, 0xf7,
+    0x66, 0x5f, 0x5c, 0x68, 0x69, 0x5b, 0x5f, 0x66, 0x37, 0x4a, 0x44, 0x41,
+    0x4c, 0x4c, 0x41, 0x44, 0x4a, 0x71, 0x14, 0x0f, 0x0e, 0x14, 0x14, 0x0e,
+    0x0e, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x7b, 0x01, 0xca,
+    0x02, 0x18, 0x00, 0x0e, 0x00, 0x1a, 0x40, 0x17, 0x0e, 0x0d, 0x0c, 0x0b,
+    0x0a, 0x09, 0x08, 0x07, 0x04, 0x03, 0x02, 0x01, 0x0c, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0x74, 0x15, 0x01, 0x07, 0x15, 0x2b, 0x37, 0x37, 0x27, 0x37,
+    0x17, 0x27, 0x33, 0x07, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x54,
+    0x82, 0xad, 0x1a, 0xa2, 0x10, 0x4e, 0x12, 0x9f, 0x1a, 0xab, 0x7e, 0x37,
+    0x6c, 0x70, 0xa7, 0x96, 0x35, 0x41, 0x4c, 0xb1, 0xb1, 0x48, 0x3d, 0x34,
+    0x97, 0x2b, 0xa6, 0xa7, 0x00, 0x01, 0x00, 0x40, 0xff, 0xd6, 0x01, 0xb5,
+    0x02, 0x99, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03, 0x01, 0x01, 0x30, 0x2b,
+    0x13, 0x37, 0x01, 0x07, 0x40, 0x3b, 0x01, 0x3a, 0x3b, 0x02, 0x7a, 0x1f,
+    0xfd, 0x5a, 0x1d, 0x00, 0x00, 0x01, 0x00, 0xb3, 0x01, 0x12, 0x01, 0x2a,
+    0x01, 0x84, 0x00, 0x0b, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01,
+    0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b,
+    0x12, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0xd5, 0x22, 0x23, 0x18, 0x17, 0x25, 0x23, 0x19, 0x01, 0x12, 0x21, 0x18,
+    0x18, 0x21, 0x22, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0xab,
+    0x00, 0xd5, 0x01, 0x55, 0x01, 0x7c, 0x00, 0x0b, 0x00, 0x1e, 0x40, 0x1b,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02,
+    0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24,
+    0x03, 0x07, 0x15, 0x2b, 0x36, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0xdd, 0x32, 0x33, 0x22, 0x23, 0x32, 0x32, 0x23,
+    0xd5, 0x31, 0x22, 0x23, 0x31, 0x32, 0x22, 0x22, 0x31, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0xb3, 0xff, 0xf5, 0x01, 0x2a, 0x01, 0xa7, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x00, 0x04, 0x01, 0x01, 0x02,
+    0x00, 0x01, 0x67, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x05, 0x01, 0x03, 0x03,
+    0x1d, 0x03, 0x4c, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16, 0x12,
+    0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0x12, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x02, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xd7, 0x24,
+    0x23, 0x18, 0x18, 0x24, 0x24, 0x18, 0x19, 0x22, 0x23, 0x18, 0x18, 0x24,
+    0x23, 0x19, 0x01, 0x34, 0x22, 0x17, 0x18, 0x22, 0x22, 0x18, 0x17, 0x22,
+    0xfe, 0xc1, 0x21, 0x18, 0x18, 0x22, 0x22, 0x18, 0x17, 0x22, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xa5, 0xff, 0x58, 0x01, 0x32, 0x00, 0x67, 0x00, 0x11,
+    0x00, 0x0f, 0x40, 0x0c, 0x11, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x74,
+    0x2b, 0x01, 0x07, 0x15, 0x2b, 0x17, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0xa5,
+    0x1c, 0x25, 0x0a, 0x0d, 0x0e, 0x0e, 0x21, 0x1a, 0x1b, 0x29, 0x6b, 0x8a,
+    0x1a, 0x3c, 0x13, 0x09, 0x0c, 0x0c, 0x0d, 0x12, 0x0d, 0x19, 0x22, 0x2f,
+    0x24, 0x4e, 0x6e, 0x00, 0x00, 0x03, 0x00, 0x07, 0xff, 0xf5, 0x01, 0xd6,
+    0x00, 0x68, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x23, 0x00, 0x2f, 0x40, 0x2c,
+    0x04, 0x02, 0x02, 0x00, 0x00, 0x01, 0x5f, 0x08, 0x05, 0x07, 0x03, 0x06,
+    0x05, 0x01, 0x01, 0x1d, 0x01, 0x4c, 0x18, 0x18, 0x0c, 0x0c, 0x00, 0x00,
+    0x18, 0x23, 0x18, 0x22, 0x1e, 0x1c, 0x0c, 0x17, 0x0c, 0x16, 0x12, 0x10,
+    0x00, 0x0b, 0x00, 0x0a, 0x24, 0x09, 0x07, 0x15, 0x2b, 0x16, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x32, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x32, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x28, 0x21, 0x23,
+    0x18, 0x18, 0x23, 0x22, 0x19, 0x93, 0x22, 0x23, 0x18, 0x18, 0x24, 0x23,
+    0x19, 0x94, 0x22, 0x23, 0x18, 0x18, 0x23, 0x22, 0x19, 0x0b, 0x21, 0x18,
+    0x17, 0x23, 0x22, 0x18, 0x17, 0x22, 0x21, 0x18, 0x18, 0x22, 0x22, 0x18,
+    0x17, 0x22, 0x21, 0x18, 0x18, 0x22, 0x22, 0x18, 0x17, 0x22, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0xb4, 0xff, 0xf5, 0x01, 0x2b, 0x02, 0x9c, 0x00, 0x07,
+    0x00, 0x13, 0x00, 0x25, 0x40, 0x22, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x04, 0x01, 0x03,
+    0x03, 0x1d, 0x03, 0x4c, 0x08, 0x08, 0x08, 0x13, 0x08, 0x12, 0x25, 0x12,
+    0x22, 0x05, 0x07, 0x17, 0x2b, 0x13, 0x34, 0x36, 0x33, 0x32, 0x15, 0x03,
+    0x23, 0x14, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x23, 0xbe, 0x1b, 0x18, 0x33, 0x1b, 0x32, 0x23, 0x23, 0x18, 0x18, 0x24,
+    0x24, 0x18, 0x02, 0x52, 0x23, 0x27, 0x54, 0xfe, 0x7a, 0xcd, 0x22, 0x18,
+    0x18, 0x24, 0x24, 0x18, 0x17, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0xb4,
+    0xff, 0xaf, 0x01, 0x2b, 0x02, 0x56, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x30,
+    0x40, 0x2d, 0x04, 0x01, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x67, 0x05,
+    0x01, 0x03, 0x02, 0x02, 0x03, 0x55, 0x05, 0x01, 0x03, 0x03, 0x02, 0x5f,
+    0x00, 0x02, 0x03, 0x02, 0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x13, 0x0c,
+    0x13, 0x10, 0x0e, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b,
+    0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x17, 0x13, 0x14, 0x23, 0x22, 0x26, 0x35, 0x13, 0x01, 0x07, 0x24, 0x24,
+    0x18, 0x18, 0x23, 0x23, 0x18, 0x1a, 0x1b, 0x33, 0x18, 0x1b, 0x19, 0x02,
+    0x56, 0x23, 0x17, 0x18, 0x24, 0x24, 0x18, 0x18, 0x22, 0xcd, 0xfe, 0x7a,
+    0x54, 0x27, 0x23, 0x01, 0x90, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc8,
+    0xff, 0x7e, 0x01, 0x4e, 0x00, 0x8b, 0x00, 0x0f, 0x00, 0x22, 0x40, 0x1f,
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x00, 0x03, 0x00, 0x03, 0x4f,
+    0x16, 0x11, 0x14, 0x10, 0x04, 0x07, 0x18, 0x2b, 0x17, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x35, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+    0xc8, 0x20, 0x2a, 0x29, 0x21, 0x26, 0x3d, 0x23, 0x23, 0x3d, 0x26, 0x4b,
+    0x2f, 0x21, 0x21, 0x30, 0x35, 0x24, 0x3e, 0x25, 0x24, 0x3d, 0x25, 0x00,
+    0x00, 0x02, 0x00, 0x19, 0x00, 0x0a, 0x01, 0xdc, 0x02, 0x72, 0x00, 0x1b,
+    0x00, 0x1f, 0x00, 0xb2, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x28, 0x10,
+    0x0f, 0x0b, 0x03, 0x03, 0x0c, 0x02, 0x02, 0x00, 0x01, 0x03, 0x00, 0x65,
+    0x08, 0x01, 0x06, 0x06, 0x14, 0x4b, 0x0e, 0x0a, 0x02, 0x04, 0x04, 0x05,
+    0x5d, 0x09, 0x07, 0x02, 0x05, 0x05, 0x17, 0x4b, 0x0d, 0x01, 0x01, 0x01,
+    0x15, 0x01, 0x4c, 0x1b, 0x4b, 0xb0, 0x2e, 0x50, 0x58, 0x40, 0x28, 0x0d,
+    0x01, 0x01, 0x00, 0x01, 0x84, 0x10, 0x0f, 0x0b, 0x03, 0x03, 0x0c, 0x02,
+    0x02, 0x00, 0x01, 0x03, 0x00, 0x65, 0x08, 0x01, 0x06, 0x06, 0x14, 0x4b,
+    0x0e, 0x0a, 0x02, 0x04, 0x04, 0x05, 0x5d, 0x09, 0x07, 0x02, 0x05, 0x05,
+    0x17, 0x04, 0x4c, 0x1b, 0x40, 0x2d, 0x0d, 0x01, 0x01, 0x00, 0x01, 0x84,
+    0x00, 0x0b, 0x03, 0x00, 0x0b, 0x55, 0x10, 0x0f, 0x02, 0x03, 0x0c, 0x02,
+    0x02, 0x00, 0x01, 0x03, 0x00, 0x65, 0x08, 0x01, 0x06, 0x06, 0x14, 0x4b,
+    0x0e, 0x0a, 0x02, 0x04, 0x04, 0x05, 0x5d, 0x09, 0x07, 0x02, 0x05, 0x05,
+    0x17, 0x04, 0x4c, 0x59, 0x59, 0x40, 0x1e, 0x1c, 0x1c, 0x1c, 0x1f, 0x1c,
+    0x1f, 0x1e, 0x1d, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13,
+    0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x11, 0x07,
+    0x1d, 0x2b, 0x25, 0x23, 0x07, 0x07, 0x37, 0x23, 0x37, 0x33, 0x37, 0x23,
+    0x37, 0x33, 0x37, 0x37, 0x07, 0x33, 0x37, 0x37, 0x07, 0x33, 0x07, 0x23,
+    0x07, 0x33, 0x07, 0x23, 0x07, 0x07, 0x37, 0x37, 0x23, 0x07, 0x01, 0x24,
+    0x6f, 0x15, 0x3b, 0x15, 0x61, 0x04, 0x63, 0x14, 0x6d, 0x03, 0x6f, 0x14,
+    0x3d, 0x15, 0x6e, 0x14, 0x3e, 0x14, 0x5b, 0x06, 0x5b, 0x15, 0x63, 0x05,
+    0x63, 0x16, 0x3d, 0x1b, 0x15, 0x6f, 0x14, 0xc1, 0xb3, 0x01, 0xb2, 0x2d,
+    0xab, 0x2e, 0xab, 0x02, 0xab, 0xa7, 0x01, 0xa6, 0x2f, 0xa9, 0x2d, 0xb6,
+    0x04, 0xe4, 0xaa, 0xaa, 0x00, 0x01, 0x00, 0xb4, 0xff, 0xf5, 0x01, 0x27,
+    0x00, 0x67, 0x00, 0x0b, 0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x01,
+    0x5f, 0x02, 0x01, 0x01, 0x01, 0x1d, 0x01, 0x4c, 0x00, 0x00, 0x00, 0x0b,
+    0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b, 0x16, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xd6, 0x22, 0x22, 0x18, 0x17,
+    0x22, 0x22, 0x17, 0x0b, 0x22, 0x17, 0x17, 0x22, 0x22, 0x17, 0x17, 0x22,
+    0x00, 0x02, 0x00, 0x40, 0xff, 0xf5, 0x01, 0xb2, 0x02, 0x99, 0x00, 0x20,
+    0x00, 0x2c, 0x00, 0x36, 0x40, 0x33, 0x12, 0x10, 0x0f, 0x03, 0x02, 0x00,
+    0x01, 0x4a, 0x00, 0x02, 0x00, 0x03, 0x00, 0x02, 0x03, 0x7e, 0x00, 0x00,
+    0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x16, 0x4b, 0x00, 0x03, 0x03, 0x04,
+    0x5f, 0x05, 0x01, 0x04, 0x04, 0x1d, 0x04, 0x4c, 0x21, 0x21, 0x21, 0x2c,
+    0x21, 0x2b, 0x25, 0x19, 0x2a, 0x28, 0x06, 0x07, 0x18, 0x2b, 0x37, 0x34,
+    0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x06,
+    0x06, 0x17, 0x07, 0x27, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x06, 0x06, 0x15, 0x15, 0x23, 0x16, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xe2, 0x24, 0x23, 0x22, 0x22,
+    0x3e, 0x31, 0x26, 0x3a, 0x16, 0x0a, 0x05, 0x01, 0x04, 0x08, 0x2e, 0x23,
+    0x58, 0x46, 0x50, 0x61, 0x28, 0x26, 0x21, 0x1f, 0x42, 0x0b, 0x22, 0x22,
+    0x18, 0x17, 0x22, 0x22, 0x17, 0xe2, 0x31, 0x3c, 0x22, 0x22, 0x38, 0x2d,
+    0x2d, 0x37, 0x16, 0x18, 0x0b, 0x0e, 0x0a, 0x06, 0x06, 0x26, 0x34, 0x34,
+    0x54, 0x48, 0x39, 0x44, 0x24, 0x21, 0x32, 0x27, 0x29, 0xc4, 0x22, 0x17,
+    0x17, 0x22, 0x22, 0x17, 0x17, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40,
+    0xff, 0x85, 0x01, 0xb2, 0x02, 0x29, 0x00, 0x0b, 0x00, 0x2c, 0x00, 0x3c,
+    0x40, 0x39, 0x1e, 0x1c, 0x1b, 0x03, 0x02, 0x04, 0x01, 0x4a, 0x00, 0x04,
+    0x00, 0x02, 0x00, 0x04, 0x02, 0x7e, 0x05, 0x01, 0x01, 0x00, 0x00, 0x04,
+    0x01, 0x00, 0x67, 0x00, 0x02, 0x03, 0x03, 0x02, 0x57, 0x00, 0x02, 0x02,
+    0x03, 0x60, 0x00, 0x03, 0x02, 0x03, 0x50, 0x00, 0x00, 0x2c, 0x2b, 0x22,
+    0x20, 0x16, 0x14, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b,
+    0x00, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x17, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x36, 0x36, 0x27, 0x37, 0x17, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26,
+    0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x35, 0x33, 0x01, 0x05, 0x22,
+    0x22, 0x18, 0x17, 0x22, 0x22, 0x17, 0x23, 0x24, 0x23, 0x22, 0x22, 0x3e,
+    0x31, 0x26, 0x3a, 0x16, 0x0a, 0x05, 0x01, 0x04, 0x08, 0x2e, 0x23, 0x58,
+    0x46, 0x50, 0x61, 0x28, 0x26, 0x21, 0x1f, 0x42, 0x02, 0x29, 0x22, 0x17,
+    0x17, 0x22, 0x22, 0x17, 0x17, 0x22, 0xed, 0x31, 0x3c, 0x22, 0x22, 0x38,
+    0x2d, 0x2d, 0x37, 0x16, 0x18, 0x0b, 0x0e, 0x0a, 0x06, 0x06, 0x26, 0x34,
+    0x34, 0x54, 0x48, 0x39, 0x44, 0x24, 0x21, 0x32, 0x27, 0x29, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x87, 0x01, 0x97, 0x01, 0x6d, 0x02, 0x99, 0x00, 0x22,
+    0x02, 0x2e, 0xb5, 0x00, 0x00, 0x02, 0x02, 0x2e, 0x4b, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xd2, 0x01, 0x97, 0x01, 0x22, 0x02, 0x99, 0x00, 0x09,
+    0x00, 0x19, 0x40, 0x16, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x02, 0x01, 0x01,
+    0x01, 0x16, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x09, 0x14, 0x03,
+    0x07, 0x15, 0x2b, 0x01, 0x14, 0x06, 0x07, 0x07, 0x23, 0x27, 0x26, 0x26,
+    0x35, 0x01, 0x22, 0x05, 0x05, 0x06, 0x30, 0x06, 0x05, 0x05, 0x02, 0x99,
+    0x54, 0x4f, 0x2f, 0x30, 0x30, 0x2d, 0x50, 0x55, 0x00, 0x02, 0x00, 0xa5,
+    0xff, 0x58, 0x01, 0x32, 0x01, 0xa7, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x29,
+    0x40, 0x26, 0x1d, 0x01, 0x02, 0x47, 0x00, 0x02, 0x01, 0x02, 0x84, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x03, 0x01,
+    0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x19, 0x17, 0x00, 0x0b, 0x00, 0x0a,
+    0x24, 0x04, 0x07, 0x15, 0x2b, 0x12, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x23, 0x03, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0xd7,
+    0x24, 0x23, 0x18, 0x18, 0x24, 0x24, 0x18, 0x49, 0x1c, 0x25, 0x0a, 0x0d,
+    0x0e, 0x0e, 0x21, 0x1a, 0x1b, 0x29, 0x6b, 0x01, 0x34, 0x22, 0x17, 0x18,
+    0x22, 0x22, 0x18, 0x17, 0x22, 0xfe, 0x42, 0x1a, 0x3c, 0x13, 0x09, 0x0c,
+    0x0c, 0x0d, 0x12, 0x0d, 0x19, 0x22, 0x2f, 0x24, 0x4e, 0x6e, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x40, 0xff, 0xd6, 0x01, 0xb5, 0x02, 0x99, 0x00, 0x03,
+    0x00, 0x06, 0xb3, 0x03, 0x01, 0x01, 0x30, 0x2b, 0x17, 0x01, 0x17, 0x01,
+    0x40, 0x01, 0x39, 0x3c, 0xfe, 0xc6, 0x0d, 0x02, 0xa6, 0x1f, 0xfd, 0x5c,
+    0x00, 0x01, 0x00, 0x23, 0xff, 0xb0, 0x01, 0xd2, 0xff, 0xed, 0x00, 0x03,
+    0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d,
+    0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x17, 0x21,
+    0x15, 0x21, 0x23, 0x01, 0xaf, 0xfe, 0x51, 0x13, 0x3d, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0xb3, 0x01, 0x12, 0x01, 0x2a, 0x01, 0x84, 0x00, 0x02,
+    0x02, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0xb7, 0x01, 0xca,
+    0x02, 0x54, 0x00, 0x0e, 0x00, 0x1a, 0x40, 0x17, 0x0e, 0x0d, 0x0c, 0x0b,
+    0x0a, 0x09, 0x08, 0x07, 0x04, 0x03, 0x02, 0x01, 0x0c, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0x74, 0x15, 0x01, 0x07, 0x15, 0x2b, 0x37, 0x37, 0x27, 0x37,
+    0x17, 0x27, 0x33, 0x07, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x54,
+    0x82, 0xad, 0x1a, 0xa2, 0x10, 0x4e, 0x12, 0x9f, 0x1a, 0xab, 0x7e, 0x37,
+    0x6c, 0x70, 0xe3, 0x96, 0x35, 0x41, 0x4c, 0xb1, 0xb1, 0x48, 0x3d, 0x34,
+    0x97, 0x2b, 0xa6, 0xa7, 0xff, 0xff, 0x00, 0x71, 0x01, 0x99, 0x01, 0x83,
+    0x02, 0x99, 0x00, 0x22, 0x02, 0x35, 0xa3, 0x00, 0x00, 0x02, 0x02, 0x35,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xce, 0x01, 0x99, 0x01, 0x3f,
+    0x02, 0x99, 0x00, 0x0c, 0x00, 0x11, 0x40, 0x0e, 0x0c, 0x01, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x4c, 0x25, 0x01, 0x07, 0x15, 0x2b, 0x13,
+    0x36, 0x36, 0x35, 0x35, 0x34, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0xce, 0x0f, 0x0a, 0x2c, 0x15, 0x17, 0x17, 0x23, 0x01, 0xa9, 0x2e, 0x44,
+    0x24, 0x24, 0x36, 0x1b, 0x19, 0x22, 0x4b, 0x5f, 0x00, 0x01, 0x00, 0x35,
+    0xff, 0x61, 0x01, 0x98, 0x02, 0x7d, 0x00, 0x21, 0x00, 0x35, 0x40, 0x32,
+    0x18, 0x01, 0x00, 0x01, 0x01, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x67, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1c, 0x4b,
+    0x00, 0x04, 0x04, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x19, 0x05, 0x4c,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x20, 0x29, 0x21, 0x24, 0x21, 0x26, 0x07,
+    0x07, 0x19, 0x2b, 0x04, 0x26, 0x26, 0x37, 0x37, 0x34, 0x26, 0x23, 0x23,
+    0x35, 0x33, 0x32, 0x36, 0x35, 0x27, 0x34, 0x33, 0x33, 0x15, 0x23, 0x22,
+    0x15, 0x17, 0x14, 0x07, 0x16, 0x15, 0x07, 0x14, 0x16, 0x33, 0x33, 0x15,
+    0x23, 0x01, 0x27, 0x5e, 0x2d, 0x03, 0x04, 0x2c, 0x2e, 0x14, 0x13, 0x2f,
+    0x2e, 0x02, 0xb6, 0x3f, 0x52, 0x5d, 0x02, 0x57, 0x55, 0x03, 0x3a, 0x44,
+    0x33, 0x24, 0x9f, 0x1e, 0x4c, 0x45, 0x64, 0x3f, 0x31, 0x38, 0x33, 0x38,
+    0x48, 0xae, 0x39, 0x6a, 0x46, 0x6e, 0x26, 0x1c, 0x7f, 0x54, 0x43, 0x35,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x36, 0xff, 0x61, 0x01, 0x99,
+    0x02, 0x7d, 0x00, 0x21, 0x00, 0x35, 0x40, 0x32, 0x08, 0x01, 0x04, 0x03,
+    0x01, 0x4a, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x04, 0x67, 0x00, 0x01,
+    0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x1c, 0x4b, 0x00, 0x00, 0x00, 0x05,
+    0x5f, 0x06, 0x01, 0x05, 0x05, 0x19, 0x05, 0x4c, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x20, 0x21, 0x24, 0x21, 0x29, 0x21, 0x07, 0x07, 0x19, 0x2b, 0x17,
+    0x35, 0x33, 0x32, 0x36, 0x35, 0x27, 0x34, 0x37, 0x26, 0x35, 0x37, 0x34,
+    0x23, 0x23, 0x35, 0x33, 0x32, 0x15, 0x07, 0x14, 0x16, 0x33, 0x33, 0x15,
+    0x23, 0x22, 0x06, 0x15, 0x17, 0x16, 0x06, 0x06, 0x23, 0x37, 0x33, 0x44,
+    0x3a, 0x03, 0x55, 0x57, 0x02, 0x5d, 0x52, 0x3f, 0xb6, 0x02, 0x2e, 0x2f,
+    0x13, 0x14, 0x2e, 0x2c, 0x04, 0x03, 0x2d, 0x5e, 0x4c, 0x9f, 0x38, 0x35,
+    0x43, 0x54, 0x7f, 0x1c, 0x26, 0x6e, 0x46, 0x6a, 0x39, 0xae, 0x48, 0x38,
+    0x33, 0x38, 0x31, 0x3f, 0x64, 0x45, 0x4c, 0x1e, 0x00, 0x01, 0x00, 0x83,
+    0xff, 0xa7, 0x01, 0xa2, 0x02, 0x9e, 0x00, 0x07, 0x00, 0x3e, 0x4b, 0xb0,
+    0x32, 0x50, 0x58, 0x40, 0x12, 0x00, 0x02, 0x00, 0x03, 0x02, 0x03, 0x61,
+    0x00, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x16, 0x01, 0x4c, 0x1b,
+    0x40, 0x18, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x65, 0x00, 0x02,
+    0x03, 0x03, 0x02, 0x55, 0x00, 0x02, 0x02, 0x03, 0x5d, 0x00, 0x03, 0x02,
+    0x03, 0x4d, 0x59, 0xb6, 0x11, 0x11, 0x11, 0x10, 0x04, 0x07, 0x18, 0x2b,
+    0x13, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x21, 0x83, 0x01, 0x1e, 0xde,
+    0xdf, 0xfe, 0xe1, 0x02, 0x9e, 0x3c, 0xfd, 0x7e, 0x39, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x83, 0xff, 0xa7, 0x01, 0xa2, 0x02, 0x9e, 0x00, 0x07,
+    0x00, 0x46, 0x4b, 0xb0, 0x32, 0x50, 0x58, 0x40, 0x13, 0x00, 0x00, 0x04,
+    0x01, 0x03, 0x00, 0x03, 0x61, 0x00, 0x01, 0x01, 0x02, 0x5d, 0x00, 0x02,
+    0x02, 0x16, 0x01, 0x4c, 0x1b, 0x40, 0x19, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x02, 0x01, 0x65, 0x00, 0x00, 0x03, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00,
+    0x03, 0x5d, 0x04, 0x01, 0x03, 0x00, 0x03, 0x4d, 0x59, 0x40, 0x0c, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x07, 0x11, 0x11, 0x11, 0x05, 0x07, 0x17, 0x2b,
+    0x17, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x11, 0x83, 0xdf, 0xde, 0x01,
+    0x1e, 0x59, 0x39, 0x02, 0x82, 0x3c, 0xfd, 0x09, 0x00, 0x01, 0x00, 0x7a,
+    0xff, 0x52, 0x01, 0x9e, 0x02, 0x99, 0x00, 0x0f, 0x00, 0x06, 0xb3, 0x0f,
+    0x07, 0x01, 0x30, 0x2b, 0x04, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37,
+    0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x07, 0x01, 0x39, 0x7c, 0x43,
+    0x42, 0x79, 0x50, 0x13, 0x62, 0x75, 0x78, 0x65, 0x13, 0x88, 0x84, 0xa6,
+    0x58, 0x58, 0xa2, 0x7f, 0x26, 0x3e, 0x35, 0xc0, 0x6f, 0x70, 0xc4, 0x35,
+    0x3c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x72, 0xff, 0x52, 0x01, 0x96,
+    0x02, 0x99, 0x00, 0x0f, 0x00, 0x06, 0xb3, 0x0f, 0x07, 0x01, 0x30, 0x2b,
+    0x17, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x37, 0x1e, 0x02, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x72, 0x65, 0x78, 0x75, 0x62, 0x13, 0x50, 0x79, 0x42,
+    0x43, 0x7c, 0x52, 0x72, 0x35, 0xc4, 0x70, 0x6f, 0xc0, 0x35, 0x3e, 0x26,
+    0x7f, 0xa2, 0x58, 0x58, 0xa6, 0x84, 0x26, 0x00, 0x00, 0x01, 0x00, 0x0a,
+    0x01, 0x19, 0x01, 0xea, 0x01, 0x5c, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0x13, 0x21,
+    0x15, 0x21, 0x0a, 0x01, 0xe0, 0xfe, 0x20, 0x01, 0x5c, 0x43, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x47, 0x01, 0x19, 0x01, 0xaf, 0x01, 0x5c, 0x00, 0x03,
+    0x00, 0x1f, 0x40, 0x1c, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x55, 0x02,
+    0x01, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x07, 0x15, 0x2b, 0x01, 0x15, 0x21,
+    0x35, 0x01, 0xaf, 0xfe, 0x98, 0x01, 0x5c, 0x43, 0x43, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x14, 0x01, 0x19, 0x01, 0xe0, 0x01, 0x5c, 0x00, 0x03,
+    0x00, 0x18, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07,
+    0x16, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x14, 0x01, 0xcc, 0xfe, 0x34, 0x01,
+    0x5c, 0x43, 0x00, 0x00, 0xff, 0xff, 0x00, 0x0a, 0x01, 0x19, 0x01, 0xea,
+    0x01, 0x5c, 0x00, 0x02, 0x02, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47,
+    0x01, 0x19, 0x01, 0xaf, 0x01, 0x5c, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0x13, 0x21,
+    0x15, 0x21, 0x47, 0x01, 0x68, 0xfe, 0x98, 0x01, 0x5c, 0x43, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x47, 0x01, 0x19, 0x01, 0xaf, 0x01, 0x5c, 0x00, 0x02,
+    0x02, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47, 0x01, 0x19, 0x01, 0xaf,
+    0x01, 0x5c, 0x00, 0x03, 0x00, 0x18, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d,
+    0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x47, 0x01,
+    0x68, 0xfe, 0x98, 0x01, 0x5c, 0x43, 0x00, 0x00, 0x00, 0x02, 0x00, 0x43,
+    0x00, 0x3d, 0x01, 0xbe, 0x01, 0x90, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x08,
+    0xb5, 0x0d, 0x09, 0x06, 0x02, 0x02, 0x30, 0x2b, 0x37, 0x35, 0x37, 0x17,
+    0x07, 0x17, 0x07, 0x37, 0x35, 0x37, 0x17, 0x07, 0x17, 0x07, 0x43, 0x98,
+    0x27, 0x79, 0x80, 0x28, 0x18, 0x97, 0x27, 0x79, 0x80, 0x28, 0xe6, 0x17,
+    0x93, 0x29, 0x76, 0x8c, 0x28, 0xa9, 0x17, 0x93, 0x29, 0x76, 0x8c, 0x28,
+    0x00, 0x02, 0x00, 0x48, 0x00, 0x3d, 0x01, 0xc3, 0x01, 0x90, 0x00, 0x06,
+    0x00, 0x0d, 0x00, 0x08, 0xb5, 0x0d, 0x0a, 0x06, 0x03, 0x02, 0x30, 0x2b,
+    0x37, 0x37, 0x27, 0x37, 0x17, 0x15, 0x07, 0x37, 0x37, 0x27, 0x37, 0x17,
+    0x15, 0x07, 0x48, 0x80, 0x79, 0x27, 0x97, 0x9d, 0x8d, 0x80, 0x79, 0x27,
+    0x98, 0x9e, 0x65, 0x8c, 0x76, 0x29, 0x93, 0x17, 0xa9, 0x28, 0x8c, 0x76,
+    0x29, 0x93, 0x17, 0xa9, 0x00, 0x01, 0x00, 0x91, 0x00, 0x3d, 0x01, 0x57,
+    0x01, 0x90, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x06, 0x02, 0x01, 0x30, 0x2b,
+    0x37, 0x35, 0x37, 0x17, 0x07, 0x17, 0x07, 0x91, 0x98, 0x27, 0x79, 0x80,
+    0x28, 0xe6, 0x17, 0x93, 0x29, 0x76, 0x8c, 0x28, 0x00, 0x01, 0x00, 0x91,
+    0x00, 0x3d, 0x01, 0x57, 0x01, 0x90, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x06,
+    0x03, 0x01, 0x30, 0x2b, 0x37, 0x37, 0x27, 0x37, 0x17, 0x15, 0x07, 0x91,
+    0x80, 0x79, 0x27, 0x98, 0x9e, 0x65, 0x8c, 0x76, 0x29, 0x93, 0x17, 0xa9,
+    0x00, 0x02, 0x00, 0x3d, 0xff, 0x58, 0x01, 0x99, 0x00, 0x67, 0x00, 0x11,
+    0x00, 0x23, 0x00, 0x13, 0x40, 0x10, 0x23, 0x11, 0x02, 0x00, 0x47, 0x01,
+    0x01, 0x00, 0x00, 0x74, 0x1f, 0x1d, 0x2b, 0x02, 0x07, 0x15, 0x2b, 0x17,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x07, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0x3d,
+    0x1d, 0x24, 0x0b, 0x0c, 0x0d, 0x0f, 0x21, 0x1a, 0x1c, 0x28, 0x6a, 0xac,
+    0x1d, 0x24, 0x0a, 0x0d, 0x0e, 0x0e, 0x21, 0x1a, 0x1c, 0x28, 0x6a, 0x8a,
+    0x1a, 0x3c, 0x13, 0x09, 0x0e, 0x0b, 0x0c, 0x13, 0x0c, 0x19, 0x22, 0x2f,
+    0x24, 0x52, 0x6a, 0x1e, 0x1a, 0x3c, 0x13, 0x09, 0x0c, 0x0c, 0x0d, 0x12,
+    0x0d, 0x19, 0x22, 0x2f, 0x24, 0x52, 0x6a, 0x00, 0x00, 0x02, 0x00, 0x4f,
+    0x01, 0x6f, 0x01, 0xaa, 0x02, 0x7e, 0x00, 0x11, 0x00, 0x23, 0x00, 0x22,
+    0x40, 0x1f, 0x1a, 0x17, 0x16, 0x08, 0x05, 0x04, 0x06, 0x00, 0x48, 0x03,
+    0x01, 0x02, 0x03, 0x00, 0x00, 0x74, 0x12, 0x12, 0x00, 0x00, 0x12, 0x23,
+    0x12, 0x22, 0x00, 0x11, 0x00, 0x10, 0x04, 0x07, 0x14, 0x2b, 0x12, 0x26,
+    0x35, 0x34, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x32, 0x26, 0x35, 0x34, 0x37, 0x17, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x77, 0x28,
+    0x6a, 0x22, 0x1b, 0x26, 0x0c, 0x0b, 0x0e, 0x0f, 0x22, 0x1a, 0xb4, 0x28,
+    0x6a, 0x22, 0x1b, 0x26, 0x0c, 0x0b, 0x0e, 0x0f, 0x22, 0x1a, 0x01, 0x6f,
+    0x2f, 0x24, 0x52, 0x6a, 0x1f, 0x18, 0x3e, 0x13, 0x08, 0x0f, 0x09, 0x0c,
+    0x14, 0x0d, 0x18, 0x22, 0x2f, 0x24, 0x52, 0x6a, 0x1f, 0x18, 0x3e, 0x13,
+    0x08, 0x0f, 0x09, 0x0c, 0x14, 0x0d, 0x18, 0x22, 0x00, 0x02, 0x00, 0x52,
+    0x01, 0x6f, 0x01, 0xad, 0x02, 0x7e, 0x00, 0x11, 0x00, 0x23, 0x00, 0x24,
+    0x40, 0x21, 0x1a, 0x17, 0x16, 0x08, 0x05, 0x04, 0x06, 0x00, 0x47, 0x03,
+    0x01, 0x02, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x4c, 0x12, 0x12, 0x00, 0x00,
+    0x12, 0x23, 0x12, 0x22, 0x00, 0x11, 0x00, 0x10, 0x04, 0x07, 0x14, 0x2b,
+    0x12, 0x16, 0x15, 0x14, 0x07, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0x27,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0xb6, 0x28, 0x6a, 0x22, 0x1b, 0x26, 0x0c, 0x0b, 0x0e, 0x0f, 0x22, 0x1a,
+    0xea, 0x28, 0x6a, 0x22, 0x1b, 0x26, 0x0c, 0x0b, 0x0e, 0x0f, 0x22, 0x1a,
+    0x02, 0x7e, 0x2f, 0x24, 0x52, 0x6a, 0x1f, 0x18, 0x3e, 0x13, 0x08, 0x0f,
+    0x09, 0x0c, 0x14, 0x0d, 0x18, 0x22, 0x2f, 0x24, 0x52, 0x6a, 0x1f, 0x18,
+    0x3e, 0x13, 0x08, 0x0f, 0x09, 0x0c, 0x14, 0x0d, 0x18, 0x22, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xb6, 0x01, 0x6f, 0x01, 0x43, 0x02, 0x7e, 0x00, 0x11,
+    0x00, 0x16, 0x40, 0x13, 0x05, 0x04, 0x02, 0x00, 0x48, 0x01, 0x01, 0x00,
+    0x00, 0x74, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x02, 0x07, 0x14, 0x2b,
+    0x12, 0x26, 0x35, 0x34, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0xdf, 0x29, 0x6a, 0x23, 0x1b, 0x26,
+    0x0a, 0x0d, 0x0e, 0x0e, 0x21, 0x1a, 0x01, 0x6f, 0x2f, 0x24, 0x52, 0x6a,
+    0x1f, 0x18, 0x3e, 0x13, 0x09, 0x0c, 0x0c, 0x0d, 0x12, 0x0d, 0x18, 0x22,
+    0x00, 0x01, 0x00, 0xa5, 0x01, 0x6f, 0x01, 0x32, 0x02, 0x7e, 0x00, 0x11,
+    0x00, 0x11, 0x40, 0x0e, 0x11, 0x01, 0x00, 0x47, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x4c, 0x2b, 0x01, 0x07, 0x15, 0x2b, 0x13, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x07, 0xa5, 0x1c, 0x25, 0x0b, 0x0c, 0x0d, 0x0f, 0x21, 0x1a, 0x1b, 0x29,
+    0x6b, 0x01, 0x8d, 0x1a, 0x3c, 0x13, 0x09, 0x0e, 0x0b, 0x0c, 0x13, 0x0c,
+    0x19, 0x22, 0x2f, 0x24, 0x4e, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa5,
+    0xff, 0x58, 0x01, 0x32, 0x00, 0x67, 0x00, 0x11, 0x00, 0x10, 0x40, 0x0d,
+    0x11, 0x03, 0x02, 0x00, 0x47, 0x00, 0x00, 0x00, 0x74, 0x2b, 0x01, 0x07,
+    0x15, 0x2b, 0x17, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0xa5, 0x1c, 0x25, 0x0b,
+    0x0a, 0x0f, 0x0f, 0x21, 0x1a, 0x21, 0x23, 0x6b, 0x8a, 0x1a, 0x3c, 0x13,
+    0x08, 0x0c, 0x08, 0x0d, 0x14, 0x10, 0x19, 0x22, 0x2d, 0x26, 0x4e, 0x6e,
+    0x00, 0x02, 0x00, 0x29, 0xff, 0xb9, 0x01, 0xd5, 0x02, 0xa3, 0x00, 0x1e,
+    0x00, 0x25, 0x00, 0x47, 0x40, 0x12, 0x22, 0x21, 0x1e, 0x1d, 0x19, 0x18,
+    0x17, 0x15, 0x12, 0x0f, 0x09, 0x03, 0x02, 0x0d, 0x00, 0x02, 0x01, 0x4a,
+    0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x10, 0x00, 0x01, 0x00, 0x01, 0x84,
+    0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x1b,
+    0x40, 0x10, 0x00, 0x02, 0x00, 0x02, 0x83, 0x00, 0x01, 0x00, 0x01, 0x84,
+    0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x59, 0xb5, 0x18, 0x11, 0x15, 0x03,
+    0x07, 0x17, 0x2b, 0x24, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x15, 0x23,
+    0x35, 0x26, 0x26, 0x27, 0x34, 0x36, 0x37, 0x35, 0x33, 0x15, 0x16, 0x16,
+    0x17, 0x07, 0x07, 0x27, 0x37, 0x34, 0x27, 0x26, 0x27, 0x11, 0x26, 0x16,
+    0x17, 0x11, 0x06, 0x06, 0x15, 0x01, 0x4e, 0x38, 0x12, 0x34, 0x1c, 0x4d,
+    0x35, 0x39, 0x5c, 0x6f, 0x01, 0x75, 0x57, 0x39, 0x3a, 0x57, 0x16, 0x3c,
+    0x09, 0x03, 0x02, 0x0e, 0x22, 0x31, 0xc1, 0x4c, 0x3c, 0x40, 0x48, 0x39,
+    0x26, 0x1f, 0x22, 0x30, 0x32, 0x03, 0x3e, 0x40, 0x0e, 0x9e, 0x8f, 0x98,
+    0x98, 0x0d, 0x32, 0x30, 0x05, 0x41, 0x34, 0x1c, 0x04, 0x07, 0x08, 0x0a,
+    0x12, 0x2f, 0x07, 0xfd, 0xfa, 0xa1, 0x8c, 0x12, 0x02, 0x01, 0x0e, 0x85,
+    0x6c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x38, 0xff, 0xb7, 0x01, 0xc9,
+    0x02, 0x6f, 0x00, 0x21, 0x00, 0x29, 0x00, 0x68, 0x40, 0x12, 0x25, 0x24,
+    0x1e, 0x19, 0x18, 0x16, 0x13, 0x02, 0x01, 0x09, 0x04, 0x02, 0x09, 0x01,
+    0x00, 0x04, 0x02, 0x4a, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x1d, 0x00,
+    0x02, 0x03, 0x04, 0x03, 0x02, 0x04, 0x7e, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x6f, 0x05, 0x01, 0x04, 0x00, 0x00, 0x01, 0x04, 0x00, 0x68, 0x00, 0x03,
+    0x03, 0x14, 0x03, 0x4c, 0x1b, 0x40, 0x1c, 0x00, 0x02, 0x03, 0x04, 0x03,
+    0x02, 0x04, 0x7e, 0x00, 0x01, 0x00, 0x01, 0x84, 0x05, 0x01, 0x04, 0x00,
+    0x00, 0x01, 0x04, 0x00, 0x68, 0x00, 0x03, 0x03, 0x14, 0x03, 0x4c, 0x59,
+    0x40, 0x0d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x1f, 0x11, 0x17, 0x12, 0x23,
+    0x06, 0x07, 0x18, 0x2b, 0x24, 0x37, 0x17, 0x06, 0x23, 0x22, 0x27, 0x07,
+    0x23, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x37, 0x33, 0x07,
+    0x16, 0x16, 0x17, 0x07, 0x07, 0x27, 0x34, 0x26, 0x27, 0x26, 0x27, 0x03,
+    0x16, 0x33, 0x26, 0x16, 0x17, 0x13, 0x0e, 0x02, 0x15, 0x01, 0x66, 0x32,
+    0x2a, 0x43, 0x62, 0x11, 0x08, 0x0e, 0x34, 0x10, 0x46, 0x54, 0x38, 0x63,
+    0x3e, 0x10, 0x31, 0x0f, 0x2a, 0x46, 0x16, 0x2d, 0x07, 0x05, 0x07, 0x0c,
+    0x1c, 0x27, 0x2d, 0x06, 0x0e, 0x9f, 0x30, 0x29, 0x2e, 0x24, 0x3e, 0x25,
+    0x61, 0x38, 0x31, 0x48, 0x01, 0x6a, 0x75, 0x17, 0x7a, 0x52, 0x42, 0x6a,
+    0x40, 0x02, 0x72, 0x75, 0x07, 0x2a, 0x21, 0x2c, 0x07, 0x05, 0x09, 0x0f,
+    0x0a, 0x1a, 0x07, 0xfe, 0xa5, 0x01, 0x7b, 0x56, 0x15, 0x01, 0x4f, 0x03,
+    0x2c, 0x4d, 0x30, 0x00, 0x00, 0x03, 0x00, 0x29, 0xff, 0xb9, 0x01, 0xd5,
+    0x02, 0xa3, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x80, 0x40, 0x1b,
+    0x20, 0x1d, 0x1b, 0x03, 0x07, 0x03, 0x37, 0x30, 0x2b, 0x26, 0x25, 0x24,
+    0x22, 0x03, 0x02, 0x09, 0x06, 0x07, 0x10, 0x0d, 0x0b, 0x08, 0x04, 0x00,
+    0x06, 0x03, 0x4a, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x22, 0x02, 0x01,
+    0x01, 0x00, 0x01, 0x84, 0x05, 0x01, 0x04, 0x04, 0x16, 0x4b, 0x00, 0x07,
+    0x07, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1c, 0x4b, 0x08, 0x01, 0x06, 0x06,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x1b, 0x40, 0x22, 0x05,
+    0x01, 0x04, 0x03, 0x04, 0x83, 0x02, 0x01, 0x01, 0x00, 0x01, 0x84, 0x00,
+    0x07, 0x07, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1c, 0x4b, 0x08, 0x01, 0x06,
+    0x06, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x59, 0x40, 0x11,
+    0x00, 0x00, 0x32, 0x31, 0x00, 0x2d, 0x00, 0x2c, 0x14, 0x11, 0x27, 0x14,
+    0x12, 0x25, 0x09, 0x07, 0x1a, 0x2b, 0x24, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x23, 0x22, 0x27, 0x07, 0x23, 0x37, 0x26, 0x27, 0x07, 0x23, 0x37, 0x26,
+    0x26, 0x27, 0x34, 0x36, 0x36, 0x33, 0x33, 0x37, 0x33, 0x07, 0x16, 0x17,
+    0x37, 0x33, 0x07, 0x16, 0x17, 0x07, 0x07, 0x27, 0x37, 0x34, 0x27, 0x26,
+    0x17, 0x03, 0x16, 0x33, 0x26, 0x16, 0x17, 0x13, 0x06, 0x06, 0x15, 0x16,
+    0x17, 0x13, 0x26, 0x27, 0x03, 0x01, 0x3f, 0x44, 0x15, 0x34, 0x1f, 0x54,
+    0x3c, 0x1e, 0x1c, 0x12, 0x25, 0x15, 0x0e, 0x0e, 0x19, 0x25, 0x1f, 0x2c,
+    0x30, 0x01, 0x46, 0x6c, 0x3e, 0x09, 0x0d, 0x25, 0x0e, 0x18, 0x06, 0x10,
+    0x25, 0x14, 0x36, 0x1a, 0x3c, 0x09, 0x03, 0x02, 0x0e, 0x0f, 0x01, 0x80,
+    0x14, 0x13, 0xad, 0x19, 0x16, 0x77, 0x4d, 0x59, 0x56, 0x0f, 0x82, 0x0b,
+    0x12, 0x7f, 0x32, 0x29, 0x23, 0x22, 0x33, 0x33, 0x06, 0x43, 0x4e, 0x05,
+    0x0a, 0x5d, 0x73, 0x28, 0x84, 0x5c, 0x73, 0x8f, 0x3e, 0x2f, 0x33, 0x06,
+    0x03, 0x3c, 0x4c, 0x20, 0x3e, 0x1c, 0x04, 0x07, 0x08, 0x0a, 0x12, 0x12,
+    0x01, 0xfe, 0x23, 0x06, 0xcf, 0x5e, 0x23, 0x01, 0xbc, 0x02, 0x89, 0x78,
+    0xe7, 0x0a, 0x01, 0xe5, 0x07, 0x04, 0xfe, 0x25, 0x00, 0x02, 0x00, 0x44,
+    0x00, 0xa4, 0x01, 0xb0, 0x02, 0x0f, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x49,
+    0x40, 0x46, 0x0e, 0x0c, 0x08, 0x06, 0x04, 0x02, 0x00, 0x13, 0x0f, 0x05,
+    0x01, 0x04, 0x03, 0x02, 0x1a, 0x16, 0x14, 0x03, 0x01, 0x03, 0x03, 0x4a,
+    0x0d, 0x07, 0x02, 0x00, 0x48, 0x1b, 0x15, 0x02, 0x01, 0x47, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x04, 0x01, 0x03, 0x01, 0x01, 0x03,
+    0x57, 0x04, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x00, 0x01, 0x03, 0x01, 0x4f,
+    0x1c, 0x1c, 0x1c, 0x27, 0x1c, 0x26, 0x27, 0x2c, 0x29, 0x05, 0x07, 0x17,
+    0x2b, 0x37, 0x37, 0x26, 0x35, 0x34, 0x37, 0x27, 0x37, 0x17, 0x36, 0x33,
+    0x32, 0x17, 0x37, 0x17, 0x07, 0x16, 0x15, 0x14, 0x07, 0x17, 0x07, 0x27,
+    0x06, 0x23, 0x22, 0x27, 0x07, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x44, 0x38, 0x1c, 0x1d, 0x39, 0x24, 0x38,
+    0x29, 0x32, 0x30, 0x29, 0x38, 0x24, 0x38, 0x1e, 0x1d, 0x37, 0x24, 0x37,
+    0x27, 0x33, 0x32, 0x2a, 0x37, 0xc1, 0x36, 0x36, 0x2f, 0x2e, 0x36, 0x36,
+    0x2e, 0xc7, 0x39, 0x28, 0x31, 0x33, 0x27, 0x39, 0x23, 0x38, 0x1d, 0x1c,
+    0x37, 0x23, 0x37, 0x2a, 0x32, 0x32, 0x29, 0x37, 0x23, 0x37, 0x1d, 0x1e,
+    0x38, 0x51, 0x3a, 0x2a, 0x2b, 0x3a, 0x3a, 0x2b, 0x2a, 0x3a, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x3c, 0xff, 0xd1, 0x01, 0xcc, 0x02, 0x8b, 0x00, 0x29,
+    0x00, 0x2f, 0x00, 0x36, 0x00, 0x4f, 0x40, 0x17, 0x36, 0x35, 0x2f, 0x2a,
+    0x20, 0x1f, 0x1a, 0x19, 0x17, 0x0f, 0x09, 0x08, 0x03, 0x02, 0x0e, 0x00,
+    0x01, 0x27, 0x01, 0x02, 0x00, 0x02, 0x4a, 0x4b, 0xb0, 0x1d, 0x50, 0x58,
+    0x40, 0x10, 0x00, 0x02, 0x00, 0x02, 0x84, 0x00, 0x01, 0x01, 0x16, 0x4b,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x1b, 0x40, 0x12, 0x00, 0x00, 0x01,
+    0x02, 0x01, 0x00, 0x02, 0x7e, 0x00, 0x02, 0x02, 0x82, 0x00, 0x01, 0x01,
+    0x16, 0x01, 0x4c, 0x59, 0xb6, 0x29, 0x28, 0x1f, 0x10, 0x03, 0x07, 0x16,
+    0x2b, 0x37, 0x26, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x17, 0x35, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x37, 0x35, 0x33, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x15, 0x16, 0x17, 0x07, 0x26, 0x26, 0x27, 0x26, 0x27, 0x15, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x07, 0x15, 0x23, 0x11, 0x06, 0x06, 0x15, 0x14,
+    0x17, 0x12, 0x36, 0x35, 0x34, 0x26, 0x27, 0x15, 0xeb, 0x6b, 0x44, 0x2b,
+    0x03, 0x02, 0x02, 0x31, 0x4c, 0x50, 0x4c, 0x57, 0x45, 0x40, 0x01, 0x06,
+    0x01, 0x5d, 0x38, 0x2b, 0x04, 0x04, 0x03, 0x22, 0x3d, 0x5a, 0x4d, 0x29,
+    0x4c, 0x32, 0x3a, 0x2b, 0x2f, 0x5a, 0x69, 0x37, 0x2f, 0x37, 0x0e, 0x07,
+    0x49, 0x3c, 0x02, 0x11, 0x02, 0x35, 0x08, 0xdc, 0x1b, 0x49, 0x36, 0x37,
+    0x50, 0x0a, 0x3c, 0x01, 0x02, 0x02, 0x0b, 0x05, 0x26, 0x0a, 0x43, 0x36,
+    0x02, 0x10, 0x03, 0x28, 0x0b, 0xc1, 0x1d, 0x46, 0x3c, 0x26, 0x47, 0x32,
+    0x06, 0x3f, 0x02, 0x45, 0x05, 0x2c, 0x1f, 0x39, 0x24, 0xfe, 0xea, 0x3a,
+    0x24, 0x23, 0x2b, 0x12, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x41,
+    0x00, 0x00, 0x01, 0xb9, 0x02, 0x7f, 0x00, 0x23, 0x00, 0x2f, 0x00, 0x33,
+    0x01, 0x13, 0xb6, 0x18, 0x0a, 0x02, 0x09, 0x08, 0x01, 0x4a, 0x4b, 0xb0,
+    0x1d, 0x50, 0x58, 0x40, 0x2f, 0x0c, 0x07, 0x02, 0x05, 0x04, 0x01, 0x00,
+    0x03, 0x05, 0x00, 0x66, 0x0d, 0x01, 0x09, 0x02, 0x01, 0x01, 0x0a, 0x09,
+    0x01, 0x67, 0x00, 0x06, 0x06, 0x14, 0x4b, 0x00, 0x08, 0x08, 0x03, 0x5f,
+    0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x0a, 0x0a, 0x0b, 0x5d, 0x00, 0x0b,
+    0x0b, 0x15, 0x0b, 0x4c, 0x1b, 0x4b, 0xb0, 0x21, 0x50, 0x58, 0x40, 0x36,
+    0x00, 0x01, 0x09, 0x02, 0x09, 0x01, 0x02, 0x7e, 0x0c, 0x07, 0x02, 0x05,
+    0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x66, 0x0d, 0x01, 0x09, 0x00, 0x02,
+    0x0a, 0x09, 0x02, 0x67, 0x00, 0x06, 0x06, 0x14, 0x4b, 0x00, 0x08, 0x08,
+    0x03, 0x5f, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x0a, 0x0a, 0x0b, 0x5d,
+    0x00, 0x0b, 0x0b, 0x15, 0x0b, 0x4c, 0x1b, 0x4b, 0xb0, 0x23, 0x50, 0x58,
+    0x40, 0x36, 0x00, 0x06, 0x05, 0x06, 0x83, 0x00, 0x01, 0x09, 0x02, 0x09,
+    0x01, 0x02, 0x7e, 0x0c, 0x07, 0x02, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05,
+    0x00, 0x66, 0x0d, 0x01, 0x09, 0x00, 0x02, 0x0a, 0x09, 0x02, 0x67, 0x00,
+    0x08, 0x08, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x1f, 0x4b, 0x00, 0x0a, 0x0a,
+    0x0b, 0x5d, 0x00, 0x0b, 0x0b, 0x15, 0x0b, 0x4c, 0x1b, 0x40, 0x34, 0x00,
+    0x06, 0x05, 0x06, 0x83, 0x00, 0x01, 0x09, 0x02, 0x09, 0x01, 0x02, 0x7e,
+    0x0c, 0x07, 0x02, 0x05, 0x04, 0x01, 0x00, 0x03, 0x05, 0x00, 0x66, 0x00,
+    0x03, 0x00, 0x08, 0x09, 0x03, 0x08, 0x67, 0x0d, 0x01, 0x09, 0x00, 0x02,
+    0x0a, 0x09, 0x02, 0x67, 0x00, 0x0a, 0x0a, 0x0b, 0x5d, 0x00, 0x0b, 0x0b,
+    0x15, 0x0b, 0x4c, 0x59, 0x59, 0x59, 0x40, 0x1c, 0x24, 0x24, 0x00, 0x00,
+    0x33, 0x32, 0x31, 0x30, 0x24, 0x2f, 0x24, 0x2e, 0x2a, 0x28, 0x00, 0x23,
+    0x00, 0x23, 0x11, 0x11, 0x13, 0x26, 0x25, 0x14, 0x11, 0x0e, 0x07, 0x1b,
+    0x2b, 0x01, 0x15, 0x23, 0x13, 0x14, 0x16, 0x17, 0x23, 0x26, 0x26, 0x35,
+    0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x17, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x06, 0x06, 0x15,
+    0x15, 0x02, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0x07, 0x21, 0x15, 0x21, 0x01, 0xb9, 0x3e, 0x01, 0x03, 0x05, 0x39,
+    0x05, 0x03, 0x12, 0x37, 0x22, 0x27, 0x45, 0x2b, 0x2c, 0x47, 0x27, 0x25,
+    0x37, 0x0f, 0x9b, 0x9b, 0x3d, 0x05, 0x03, 0x68, 0x2e, 0x32, 0x33, 0x30,
+    0x33, 0x36, 0x32, 0x85, 0x01, 0x41, 0xfe, 0xbf, 0x02, 0x39, 0x36, 0xfe,
+    0xa1, 0x13, 0x19, 0x0d, 0x0d, 0x19, 0x13, 0x1e, 0x23, 0x2c, 0x58, 0x3e,
+    0x3f, 0x56, 0x28, 0x22, 0x1d, 0x60, 0x36, 0x46, 0x06, 0x04, 0x0c, 0x0d,
+    0x23, 0xfe, 0x5c, 0x4f, 0x40, 0x41, 0x4e, 0x47, 0x3e, 0x46, 0x53, 0x5f,
+    0x36, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x21, 0xff, 0xf5, 0x01, 0xd0,
+    0x02, 0x74, 0x00, 0x29, 0x00, 0x55, 0x40, 0x52, 0x0f, 0x01, 0x05, 0x04,
+    0x10, 0x01, 0x03, 0x05, 0x26, 0x01, 0x0a, 0x00, 0x27, 0x01, 0x0b, 0x0a,
+    0x04, 0x4a, 0x06, 0x01, 0x03, 0x07, 0x01, 0x02, 0x01, 0x03, 0x02, 0x65,
+    0x08, 0x01, 0x01, 0x09, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x65, 0x00, 0x05,
+    0x05, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x1c, 0x4b, 0x00, 0x0a, 0x0a, 0x0b,
+    0x5f, 0x0c, 0x01, 0x0b, 0x0b, 0x1d, 0x0b, 0x4c, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x28, 0x25, 0x23, 0x21, 0x20, 0x13, 0x11, 0x12, 0x26, 0x22, 0x11,
+    0x12, 0x11, 0x12, 0x0d, 0x07, 0x1d, 0x2b, 0x16, 0x26, 0x27, 0x23, 0x37,
+    0x33, 0x26, 0x37, 0x23, 0x37, 0x33, 0x36, 0x36, 0x33, 0x32, 0x17, 0x07,
+    0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x33, 0x07, 0x23, 0x06,
+    0x15, 0x15, 0x33, 0x07, 0x23, 0x16, 0x16, 0x33, 0x32, 0x37, 0x17, 0x06,
+    0x23, 0xe9, 0x80, 0x0e, 0x3a, 0x0d, 0x28, 0x02, 0x04, 0x37, 0x0d, 0x33,
+    0x16, 0x82, 0x50, 0x52, 0x35, 0x19, 0x0a, 0x09, 0x0d, 0x26, 0x2c, 0x3b,
+    0x5a, 0x11, 0xf7, 0x16, 0xea, 0x02, 0xce, 0x17, 0xb1, 0x0e, 0x5c, 0x43,
+    0x3c, 0x2f, 0x1d, 0x3a, 0x52, 0x0b, 0x77, 0x6e, 0x3a, 0x24, 0x2c, 0x3a,
+    0x6d, 0x69, 0x36, 0x44, 0x05, 0x11, 0x15, 0x16, 0x4f, 0x4e, 0x3a, 0x0d,
+    0x1c, 0x27, 0x3a, 0x52, 0x57, 0x29, 0x32, 0x33, 0x00, 0x01, 0x00, 0x12,
+    0xff, 0x51, 0x01, 0xe0, 0x02, 0xa1, 0x00, 0x23, 0x00, 0x71, 0x40, 0x13,
+    0x13, 0x01, 0x04, 0x03, 0x1c, 0x14, 0x02, 0x02, 0x04, 0x02, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x07, 0x00, 0x04, 0x4a, 0x4b, 0xb0, 0x26, 0x50, 0x58,
+    0x40, 0x20, 0x05, 0x01, 0x02, 0x06, 0x01, 0x01, 0x00, 0x02, 0x01, 0x65,
+    0x00, 0x04, 0x04, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x16, 0x4b, 0x00, 0x00,
+    0x00, 0x07, 0x5f, 0x08, 0x01, 0x07, 0x07, 0x21, 0x07, 0x4c, 0x1b, 0x40,
+    0x1e, 0x00, 0x03, 0x00, 0x04, 0x02, 0x03, 0x04, 0x67, 0x05, 0x01, 0x02,
+    0x06, 0x01, 0x01, 0x00, 0x02, 0x01, 0x65, 0x00, 0x00, 0x00, 0x07, 0x5f,
+    0x08, 0x01, 0x07, 0x07, 0x21, 0x07, 0x4c, 0x59, 0x40, 0x10, 0x00, 0x00,
+    0x00, 0x23, 0x00, 0x22, 0x11, 0x13, 0x26, 0x23, 0x11, 0x13, 0x25, 0x09,
+    0x07, 0x1b, 0x2b, 0x16, 0x27, 0x37, 0x1e, 0x02, 0x33, 0x32, 0x36, 0x37,
+    0x13, 0x23, 0x35, 0x33, 0x37, 0x36, 0x36, 0x33, 0x32, 0x17, 0x07, 0x22,
+    0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x07, 0x33, 0x15, 0x23, 0x03,
+    0x06, 0x23, 0x33, 0x21, 0x29, 0x03, 0x0d, 0x12, 0x10, 0x1c, 0x25, 0x05,
+    0x16, 0x79, 0x7d, 0x07, 0x08, 0x50, 0x44, 0x44, 0x2c, 0x21, 0x08, 0x01,
+    0x04, 0x29, 0x18, 0x28, 0x2a, 0x06, 0x06, 0x7b, 0x80, 0x18, 0x12, 0x80,
+    0xaf, 0x23, 0x40, 0x01, 0x13, 0x0c, 0x45, 0x42, 0x01, 0x2b, 0x39, 0x5c,
+    0x64, 0x62, 0x35, 0x42, 0x0a, 0x17, 0x1d, 0x40, 0x57, 0x52, 0x39, 0xfe,
+    0xd2, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x01, 0xb5,
+    0x02, 0x70, 0x00, 0x11, 0x00, 0x37, 0x40, 0x34, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x65, 0x06, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x02,
+    0x03, 0x65, 0x09, 0x01, 0x08, 0x08, 0x07, 0x5d, 0x00, 0x07, 0x07, 0x14,
+    0x4b, 0x00, 0x04, 0x04, 0x15, 0x04, 0x4c, 0x00, 0x00, 0x00, 0x11, 0x00,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x07, 0x1c,
+    0x2b, 0x13, 0x15, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23,
+    0x35, 0x23, 0x35, 0x33, 0x11, 0x21, 0x15, 0x94, 0xe9, 0xe9, 0x8f, 0x8f,
+    0x46, 0x39, 0x39, 0x01, 0x67, 0x02, 0x33, 0xc4, 0x3d, 0x67, 0x39, 0x92,
+    0x92, 0x39, 0x01, 0xa5, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x23,
+    0xff, 0xb9, 0x01, 0xcc, 0x02, 0xa3, 0x00, 0x1f, 0x00, 0x26, 0x00, 0x5a,
+    0x40, 0x13, 0x23, 0x18, 0x13, 0x12, 0x0f, 0x0c, 0x06, 0x04, 0x02, 0x22,
+    0x1b, 0x19, 0x05, 0x00, 0x05, 0x00, 0x03, 0x02, 0x4a, 0x4b, 0xb0, 0x21,
+    0x50, 0x58, 0x40, 0x18, 0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x04, 0x00,
+    0x03, 0x00, 0x04, 0x03, 0x65, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00, 0x00,
+    0x00, 0x1d, 0x00, 0x4c, 0x1b, 0x40, 0x18, 0x00, 0x02, 0x04, 0x02, 0x83,
+    0x00, 0x01, 0x00, 0x01, 0x84, 0x00, 0x04, 0x00, 0x03, 0x00, 0x04, 0x03,
+    0x65, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x4c, 0x59, 0xb7, 0x11, 0x1e, 0x19,
+    0x11, 0x11, 0x05, 0x07, 0x19, 0x2b, 0x25, 0x06, 0x07, 0x15, 0x23, 0x35,
+    0x26, 0x26, 0x35, 0x26, 0x36, 0x36, 0x37, 0x35, 0x33, 0x15, 0x16, 0x16,
+    0x17, 0x07, 0x26, 0x27, 0x26, 0x26, 0x27, 0x11, 0x36, 0x37, 0x35, 0x23,
+    0x35, 0x33, 0x04, 0x16, 0x17, 0x11, 0x06, 0x06, 0x15, 0x01, 0xcc, 0x53,
+    0x58, 0x39, 0x5b, 0x69, 0x01, 0x3b, 0x59, 0x31, 0x39, 0x37, 0x5a, 0x18,
+    0x38, 0x06, 0x0a, 0x18, 0x27, 0x22, 0x3c, 0x2e, 0x3f, 0x80, 0xfe, 0x9d,
+    0x45, 0x3a, 0x38, 0x47, 0x37, 0x3d, 0x04, 0x3d, 0x41, 0x11, 0xa6, 0x7f,
+    0x6d, 0x8c, 0x42, 0x08, 0x30, 0x2e, 0x06, 0x37, 0x2b, 0x39, 0x08, 0x10,
+    0x22, 0x23, 0x05, 0xfd, 0xfe, 0x05, 0x21, 0x94, 0x3d, 0x56, 0x87, 0x13,
+    0x01, 0xf9, 0x0d, 0x76, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0xff, 0xfc, 0x01, 0xeb, 0x02, 0x74, 0x00, 0x18, 0x00, 0x30, 0x40, 0x2d,
+    0x10, 0x01, 0x02, 0x03, 0x03, 0x02, 0x02, 0x00, 0x02, 0x02, 0x4a, 0x06,
+    0x01, 0x03, 0x07, 0x01, 0x02, 0x00, 0x03, 0x02, 0x66, 0x05, 0x01, 0x04,
+    0x04, 0x14, 0x4b, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x11, 0x11,
+    0x27, 0x11, 0x11, 0x11, 0x13, 0x10, 0x08, 0x07, 0x1c, 0x2b, 0x21, 0x07,
+    0x03, 0x07, 0x11, 0x23, 0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x06,
+    0x06, 0x15, 0x15, 0x01, 0x16, 0x33, 0x33, 0x07, 0x33, 0x15, 0x23, 0x01,
+    0xeb, 0x5a, 0xd7, 0x31, 0x4b, 0x30, 0x30, 0x54, 0x06, 0x03, 0x01, 0x04,
+    0x19, 0x1b, 0x1a, 0xd7, 0xbd, 0xbf, 0x04, 0x01, 0x3c, 0x36, 0xfe, 0xfe,
+    0x01, 0x47, 0x33, 0xf5, 0x07, 0x06, 0x0e, 0x11, 0xf3, 0x01, 0x24, 0x05,
+    0xf5, 0x33, 0x00, 0x00, 0xff, 0xff, 0x00, 0x27, 0xff, 0xf1, 0x01, 0xd6,
+    0x02, 0x6f, 0x00, 0x02, 0x02, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x00, 0x01, 0xbb, 0x02, 0x6f, 0x00, 0x1d, 0x00, 0x3d, 0x40, 0x3a,
+    0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x0c, 0x0b, 0x0a, 0x09,
+    0x08, 0x07, 0x06, 0x05, 0x10, 0x03, 0x01, 0x01, 0x4a, 0x04, 0x01, 0x03,
+    0x01, 0x02, 0x01, 0x03, 0x02, 0x7e, 0x00, 0x01, 0x01, 0x14, 0x4b, 0x00,
+    0x02, 0x02, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x00, 0x00,
+    0x00, 0x1d, 0x00, 0x1d, 0x1c, 0x19, 0x22, 0x05, 0x07, 0x17, 0x2b, 0x25,
+    0x14, 0x06, 0x23, 0x23, 0x11, 0x07, 0x35, 0x37, 0x35, 0x07, 0x35, 0x37,
+    0x35, 0x33, 0x14, 0x06, 0x15, 0x15, 0x37, 0x15, 0x07, 0x15, 0x37, 0x15,
+    0x07, 0x15, 0x32, 0x36, 0x35, 0x01, 0xbb, 0x8e, 0x7a, 0x49, 0x51, 0x51,
+    0x51, 0x51, 0x52, 0x09, 0xbb, 0xbb, 0xbb, 0xbb, 0x60, 0x6d, 0xe6, 0x72,
+    0x74, 0x01, 0x17, 0x1d, 0x3d, 0x1d, 0x38, 0x1d, 0x3d, 0x1d, 0xa6, 0x07,
+    0x15, 0x06, 0x6b, 0x42, 0x3d, 0x42, 0x38, 0x42, 0x3d, 0x42, 0xf3, 0x4b,
+    0x5e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xc6,
+    0x02, 0x99, 0x00, 0x1a, 0x00, 0x24, 0x40, 0x21, 0x1a, 0x17, 0x0b, 0x08,
+    0x04, 0x01, 0x03, 0x01, 0x4a, 0x00, 0x01, 0x01, 0x03, 0x5d, 0x00, 0x03,
+    0x03, 0x16, 0x4b, 0x02, 0x01, 0x00, 0x00, 0x15, 0x00, 0x4c, 0x15, 0x27,
+    0x15, 0x13, 0x04, 0x07, 0x18, 0x2b, 0x00, 0x16, 0x15, 0x11, 0x23, 0x11,
+    0x34, 0x26, 0x27, 0x11, 0x23, 0x11, 0x06, 0x06, 0x15, 0x11, 0x14, 0x16,
+    0x15, 0x23, 0x11, 0x34, 0x36, 0x37, 0x35, 0x33, 0x15, 0x01, 0x6d, 0x59,
+    0x43, 0x30, 0x37, 0x43, 0x34, 0x2e, 0x07, 0x4c, 0x55, 0x52, 0x43, 0x02,
+    0x3d, 0x72, 0x68, 0xfe, 0x9d, 0x01, 0x64, 0x49, 0x54, 0x09, 0xfe, 0x59,
+    0x01, 0xa7, 0x0a, 0x53, 0x46, 0xfe, 0xb9, 0x0b, 0x12, 0x03, 0x01, 0x66,
+    0x63, 0x73, 0x0a, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0e,
+    0x00, 0x00, 0x01, 0xe9, 0x02, 0x6f, 0x00, 0x17, 0x00, 0x1a, 0x00, 0x1d,
+    0x00, 0x3f, 0x40, 0x3c, 0x19, 0x01, 0x05, 0x06, 0x1d, 0x01, 0x01, 0x00,
+    0x02, 0x4a, 0x0c, 0x0a, 0x09, 0x07, 0x04, 0x05, 0x0b, 0x04, 0x02, 0x03,
+    0x00, 0x01, 0x05, 0x00, 0x66, 0x08, 0x01, 0x06, 0x06, 0x14, 0x4b, 0x03,
+    0x01, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x18, 0x18, 0x1c, 0x1b, 0x18, 0x1a,
+    0x18, 0x1a, 0x17, 0x16, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x10, 0x0d, 0x07, 0x1d, 0x2b, 0x01, 0x23, 0x11, 0x23, 0x03, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x35, 0x33, 0x11, 0x33, 0x13, 0x33, 0x11, 0x33, 0x15,
+    0x06, 0x06, 0x15, 0x15, 0x33, 0x21, 0x27, 0x15, 0x17, 0x23, 0x17, 0x01,
+    0xe9, 0x3f, 0x31, 0x8b, 0x6d, 0x3c, 0x37, 0x37, 0x3d, 0x98, 0x54, 0x44,
+    0x05, 0x03, 0x3f, 0xfe, 0xeb, 0x53, 0xed, 0x3a, 0x3a, 0x01, 0x13, 0xfe,
+    0xed, 0x01, 0x13, 0xfe, 0xed, 0x01, 0x13, 0x33, 0x01, 0x29, 0xfe, 0xd7,
+    0x01, 0x29, 0x07, 0x06, 0x0e, 0x11, 0xfd, 0xa4, 0xa4, 0x33, 0x72, 0x00,
+    0x00, 0x03, 0x00, 0x36, 0xff, 0xf2, 0x01, 0xeb, 0x02, 0x6f, 0x00, 0x0a,
+    0x00, 0x12, 0x00, 0x5c, 0x01, 0x33, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40,
+    0x18, 0x27, 0x01, 0x00, 0x03, 0x26, 0x01, 0x08, 0x00, 0x4f, 0x01, 0x07,
+    0x08, 0x50, 0x43, 0x39, 0x03, 0x0b, 0x07, 0x1a, 0x01, 0x01, 0x0b, 0x05,
+    0x4a, 0x1b, 0x4b, 0xb0, 0x26, 0x50, 0x58, 0x40, 0x18, 0x27, 0x01, 0x00,
+    0x03, 0x26, 0x01, 0x08, 0x00, 0x4f, 0x01, 0x07, 0x0e, 0x50, 0x43, 0x39,
+    0x03, 0x0b, 0x07, 0x1a, 0x01, 0x01, 0x0b, 0x05, 0x4a, 0x1b, 0x40, 0x18,
+    0x27, 0x01, 0x00, 0x03, 0x26, 0x01, 0x0d, 0x00, 0x4f, 0x01, 0x07, 0x0e,
+    0x50, 0x43, 0x39, 0x03, 0x0b, 0x07, 0x1a, 0x01, 0x01, 0x0b, 0x05, 0x4a,
+    0x59, 0x59, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x31, 0x0f, 0x01, 0x03,
+    0x00, 0x00, 0x08, 0x03, 0x00, 0x67, 0x0d, 0x09, 0x02, 0x08, 0x0e, 0x0a,
+    0x02, 0x07, 0x0b, 0x08, 0x07, 0x65, 0x00, 0x04, 0x04, 0x02, 0x5d, 0x00,
+    0x02, 0x02, 0x14, 0x4b, 0x00, 0x01, 0x01, 0x15, 0x4b, 0x0c, 0x01, 0x0b,
+    0x0b, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x1d, 0x05, 0x4c, 0x1b, 0x4b,
+    0xb0, 0x26, 0x50, 0x58, 0x40, 0x36, 0x0f, 0x01, 0x03, 0x00, 0x00, 0x08,
+    0x03, 0x00, 0x67, 0x00, 0x0e, 0x07, 0x08, 0x0e, 0x57, 0x0d, 0x09, 0x02,
+    0x08, 0x0a, 0x01, 0x07, 0x0b, 0x08, 0x07, 0x65, 0x00, 0x04, 0x04, 0x02,
+    0x5d, 0x00, 0x02, 0x02, 0x14, 0x4b, 0x00, 0x01, 0x01, 0x15, 0x4b, 0x0c,
+    0x01, 0x0b, 0x0b, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x1d, 0x05, 0x4c,
+    0x1b, 0x40, 0x37, 0x0f, 0x01, 0x03, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x67,
+    0x00, 0x0d, 0x00, 0x0e, 0x07, 0x0d, 0x0e, 0x67, 0x09, 0x01, 0x08, 0x0a,
+    0x01, 0x07, 0x0b, 0x08, 0x07, 0x65, 0x00, 0x04, 0x04, 0x02, 0x5d, 0x00,
+    0x02, 0x02, 0x14, 0x4b, 0x00, 0x01, 0x01, 0x15, 0x4b, 0x0c, 0x01, 0x0b,
+    0x0b, 0x05, 0x5f, 0x06, 0x01, 0x05, 0x05, 0x1d, 0x05, 0x4c, 0x59, 0x59,
+    0x40, 0x22, 0x0c, 0x0b, 0x58, 0x56, 0x4d, 0x4b, 0x41, 0x3f, 0x36, 0x34,
+    0x2f, 0x2e, 0x2d, 0x2c, 0x25, 0x24, 0x23, 0x22, 0x1d, 0x1b, 0x19, 0x17,
+    0x11, 0x0f, 0x0b, 0x12, 0x0c, 0x12, 0x21, 0x11, 0x21, 0x10, 0x07, 0x17,
+    0x2b, 0x00, 0x06, 0x23, 0x23, 0x11, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15,
+    0x07, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x15, 0x04, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x22, 0x27, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0x37,
+    0x23, 0x37, 0x33, 0x35, 0x37, 0x17, 0x06, 0x06, 0x15, 0x15, 0x33, 0x07,
+    0x23, 0x07, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x3f, 0x02, 0x17, 0x1e,
+    0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x36, 0x26, 0x27, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x27, 0x34, 0x26, 0x26,
+    0x27, 0x26, 0x23, 0x22, 0x15, 0x14, 0x16, 0x17, 0x01, 0x0f, 0x46, 0x43,
+    0x17, 0x39, 0x4b, 0x45, 0x49, 0x91, 0x58, 0x2c, 0x2b, 0x10, 0x01, 0x56,
+    0x26, 0x38, 0x2e, 0x2b, 0x21, 0x1c, 0x22, 0x28, 0x25, 0x01, 0x07, 0x37,
+    0x07, 0x32, 0x3e, 0x01, 0x06, 0x05, 0x3c, 0x08, 0x36, 0x07, 0x01, 0x0e,
+    0x11, 0x0f, 0x13, 0x14, 0x04, 0x06, 0x02, 0x02, 0x06, 0x08, 0x13, 0x20,
+    0x18, 0x19, 0x01, 0x18, 0x1d, 0x2d, 0x29, 0x31, 0x27, 0x21, 0x30, 0x13,
+    0x24, 0x06, 0x02, 0x09, 0x09, 0x0e, 0x16, 0x26, 0x18, 0x1e, 0x01, 0x93,
+    0x58, 0xfe, 0xc5, 0x02, 0x6f, 0x55, 0x40, 0x6b, 0x69, 0x29, 0x36, 0xc8,
+    0xe5, 0x24, 0x1d, 0x27, 0x30, 0x15, 0x13, 0x31, 0x35, 0x13, 0x0b, 0x5b,
+    0x30, 0x2e, 0x0c, 0x07, 0x0a, 0x0e, 0x0f, 0x0c, 0x30, 0x54, 0x0d, 0x16,
+    0x1f, 0x18, 0x0c, 0x25, 0x09, 0x03, 0x05, 0x0f, 0x0d, 0x06, 0x11, 0x10,
+    0x0e, 0x0e, 0x17, 0x0a, 0x0f, 0x24, 0x1e, 0x21, 0x26, 0x16, 0x19, 0x30,
+    0x04, 0x02, 0x0f, 0x0c, 0x06, 0x0a, 0x18, 0x0c, 0x10, 0x0b, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x01, 0xf2, 0x02, 0x6f, 0x00, 0x1c,
+    0x00, 0x22, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x61, 0x40, 0x5e, 0x25, 0x01,
+    0x05, 0x00, 0x01, 0x4a, 0x06, 0x01, 0x05, 0x01, 0x49, 0x0a, 0x09, 0x02,
+    0x07, 0x0c, 0x06, 0x02, 0x00, 0x05, 0x07, 0x00, 0x65, 0x10, 0x0d, 0x02,
+    0x05, 0x0e, 0x04, 0x02, 0x01, 0x0f, 0x05, 0x01, 0x65, 0x11, 0x01, 0x0f,
+    0x00, 0x02, 0x03, 0x0f, 0x02, 0x65, 0x00, 0x0b, 0x0b, 0x08, 0x5d, 0x00,
+    0x08, 0x08, 0x14, 0x4b, 0x00, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x2a, 0x2a,
+    0x23, 0x23, 0x2a, 0x2e, 0x2a, 0x2d, 0x2c, 0x2b, 0x23, 0x29, 0x23, 0x29,
+    0x28, 0x27, 0x22, 0x20, 0x1e, 0x1d, 0x1c, 0x1b, 0x21, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x22, 0x16, 0x10, 0x12, 0x07, 0x1d, 0x2b, 0x01, 0x23, 0x16,
+    0x15, 0x14, 0x07, 0x33, 0x15, 0x23, 0x06, 0x06, 0x23, 0x23, 0x11, 0x23,
+    0x11, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x32, 0x16,
+    0x17, 0x33, 0x21, 0x33, 0x26, 0x26, 0x23, 0x23, 0x17, 0x36, 0x35, 0x34,
+    0x27, 0x23, 0x15, 0x16, 0x37, 0x23, 0x15, 0x33, 0x01, 0xf2, 0x2b, 0x01,
+    0x01, 0x2b, 0x33, 0x11, 0x5b, 0x4b, 0x85, 0x48, 0x2e, 0x2e, 0x2e, 0x2e,
+    0xc8, 0x4e, 0x5e, 0x11, 0x32, 0xfe, 0x91, 0xec, 0x0e, 0x37, 0x29, 0x7e,
+    0xfc, 0x01, 0x02, 0xfb, 0xd1, 0x1d, 0xee, 0x7d, 0x01, 0xd2, 0x06, 0x0d,
+    0x0e, 0x07, 0x29, 0x33, 0x3b, 0xfe, 0xed, 0x01, 0x81, 0x29, 0x28, 0x29,
+    0x74, 0x3e, 0x36, 0x17, 0x1b, 0x83, 0x06, 0x0d, 0x07, 0x0e, 0x28, 0x59,
+    0x30, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x13, 0x00, 0x00, 0x01, 0xd2,
+    0x02, 0x6f, 0x00, 0x16, 0x00, 0x1f, 0x00, 0x37, 0x40, 0x34, 0x09, 0x01,
+    0x06, 0x08, 0x01, 0x05, 0x00, 0x06, 0x05, 0x65, 0x04, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x02, 0x00, 0x01, 0x65, 0x00, 0x0a, 0x0a, 0x07, 0x5d, 0x00,
+    0x07, 0x07, 0x14, 0x4b, 0x00, 0x02, 0x02, 0x15, 0x02, 0x4c, 0x1f, 0x1d,
+    0x19, 0x17, 0x24, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0b,
+    0x07, 0x1d, 0x2b, 0x37, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35,
+    0x33, 0x35, 0x23, 0x35, 0x33, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x8d,
+    0x9e, 0x9e, 0x48, 0x32, 0x32, 0x32, 0x32, 0xc8, 0x63, 0x62, 0x60, 0x60,
+    0x85, 0x7d, 0x42, 0x3e, 0x40, 0x3f, 0x7e, 0xdb, 0x3e, 0x9d, 0x9d, 0x3e,
+    0x38, 0x3e, 0x01, 0x1e, 0x62, 0x4e, 0x4d, 0x5f, 0x3e, 0x39, 0x33, 0x31,
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x33, 0x00, 0x00, 0x01, 0xce,
+    0x02, 0x6f, 0x00, 0x1a, 0x00, 0x06, 0xb3, 0x19, 0x0a, 0x01, 0x30, 0x2b,
+    0x01, 0x23, 0x16, 0x17, 0x33, 0x15, 0x23, 0x06, 0x06, 0x07, 0x13, 0x23,
+    0x03, 0x23, 0x35, 0x33, 0x32, 0x37, 0x21, 0x35, 0x21, 0x26, 0x26, 0x23,
+    0x23, 0x35, 0x21, 0x01, 0xce, 0x8d, 0x32, 0x0d, 0x4e, 0x4d, 0x08, 0x44,
+    0x31, 0x90, 0x4e, 0x8a, 0x88, 0x88, 0x68, 0x13, 0xfe, 0xfc, 0x01, 0x05,
+    0x08, 0x3e, 0x36, 0x89, 0x01, 0x9b, 0x02, 0x32, 0x1e, 0x3c, 0x3d, 0x2e,
+    0x4b, 0x0c, 0xfe, 0xea, 0x01, 0x13, 0x3e, 0x4a, 0x3d, 0x27, 0x2e, 0x42,
+    0x00, 0x01, 0x00, 0x27, 0xff, 0xf1, 0x01, 0xd6, 0x02, 0x6f, 0x00, 0x34,
+    0x00, 0x4b, 0x40, 0x48, 0x10, 0x01, 0x03, 0x02, 0x11, 0x01, 0x01, 0x03,
+    0x2a, 0x01, 0x07, 0x06, 0x34, 0x2b, 0x02, 0x08, 0x09, 0x04, 0x4a, 0x04,
+    0x01, 0x01, 0x05, 0x01, 0x00, 0x06, 0x01, 0x00, 0x65, 0x00, 0x06, 0x00,
+    0x09, 0x08, 0x06, 0x09, 0x67, 0x00, 0x03, 0x03, 0x02, 0x5f, 0x00, 0x02,
+    0x02, 0x14, 0x4b, 0x00, 0x07, 0x07, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x1d,
+    0x08, 0x4c, 0x33, 0x31, 0x23, 0x24, 0x34, 0x11, 0x14, 0x24, 0x25, 0x11,
+    0x15, 0x0a, 0x07, 0x1d, 0x2b, 0x37, 0x36, 0x36, 0x35, 0x34, 0x27, 0x23,
+    0x35, 0x33, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x17, 0x07, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x17, 0x33, 0x15, 0x23, 0x16, 0x15,
+    0x14, 0x07, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x37,
+    0x17, 0x06, 0x23, 0x22, 0x27, 0x26, 0x26, 0x23, 0x22, 0x07, 0x27, 0x3e,
+    0x2f, 0x0f, 0x42, 0x34, 0x07, 0x2f, 0x51, 0x30, 0x4b, 0x37, 0x2c, 0x15,
+    0x2a, 0x29, 0x29, 0x32, 0x08, 0x82, 0x74, 0x0d, 0x24, 0x06, 0x0b, 0x17,
+    0x2d, 0x1e, 0x1e, 0x21, 0x11, 0x25, 0x22, 0x1a, 0x34, 0x34, 0x11, 0x3b,
+    0x2a, 0x30, 0x14, 0x2c, 0x47, 0x31, 0x1e, 0x49, 0x46, 0x26, 0x3d, 0x39,
+    0x20, 0x20, 0x35, 0x53, 0x2d, 0x33, 0x37, 0x19, 0x18, 0x42, 0x39, 0x16,
+    0x2b, 0x39, 0x35, 0x2c, 0x4b, 0x3b, 0x01, 0x0b, 0x0b, 0x0a, 0x08, 0x1c,
+    0x34, 0x2a, 0x13, 0x0d, 0x0d, 0x26, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e,
+    0x00, 0x00, 0x01, 0xe9, 0x02, 0x6f, 0x00, 0x17, 0x00, 0x1a, 0x00, 0x1d,
+    0x00, 0x20, 0x00, 0x50, 0x40, 0x4d, 0x19, 0x01, 0x05, 0x08, 0x20, 0x1d,
+    0x02, 0x01, 0x00, 0x02, 0x4a, 0x00, 0x08, 0x06, 0x05, 0x06, 0x08, 0x05,
+    0x7e, 0x0f, 0x0c, 0x0b, 0x09, 0x07, 0x05, 0x05, 0x0e, 0x0d, 0x04, 0x02,
+    0x04, 0x00, 0x01, 0x05, 0x00, 0x66, 0x0a, 0x01, 0x06, 0x06, 0x14, 0x4b,
+    0x03, 0x01, 0x01, 0x01, 0x15, 0x01, 0x4c, 0x18, 0x18, 0x1f, 0x1e, 0x1c,
+    0x1b, 0x18, 0x1a, 0x18, 0x1a, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x10, 0x07, 0x1d, 0x2b,
+    0x01, 0x23, 0x03, 0x23, 0x03, 0x23, 0x03, 0x23, 0x03, 0x23, 0x35, 0x33,
+    0x03, 0x33, 0x13, 0x33, 0x37, 0x33, 0x17, 0x33, 0x13, 0x33, 0x03, 0x33,
+    0x23, 0x27, 0x07, 0x07, 0x23, 0x17, 0x37, 0x23, 0x17, 0x01, 0xe9, 0x4d,
+    0x29, 0x18, 0x44, 0x3a, 0x45, 0x1a, 0x29, 0x47, 0x41, 0x2b, 0x3b, 0x2a,
+    0x30, 0x3c, 0x14, 0x3d, 0x2d, 0x24, 0x35, 0x2a, 0x47, 0xdc, 0x13, 0x14,
+    0x37, 0x20, 0x0c, 0xd3, 0x1f, 0x15, 0x01, 0x1e, 0xfe, 0xe2, 0x01, 0x1e,
+    0xfe, 0xe2, 0x01, 0x1e, 0x28, 0x01, 0x29, 0xfe, 0xd7, 0xfb, 0xfb, 0x01,
+    0x29, 0xfe, 0xd7, 0x51, 0x51, 0x28, 0x54, 0x54, 0x56, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0x01, 0xd2, 0x02, 0x70, 0x00, 0x18,
+    0x00, 0x3b, 0x40, 0x38, 0x18, 0x15, 0x12, 0x03, 0x00, 0x09, 0x01, 0x4a,
+    0x08, 0x01, 0x00, 0x07, 0x01, 0x01, 0x02, 0x00, 0x01, 0x66, 0x06, 0x01,
+    0x02, 0x05, 0x01, 0x03, 0x04, 0x02, 0x03, 0x65, 0x0a, 0x01, 0x09, 0x09,
+    0x14, 0x4b, 0x00, 0x04, 0x04, 0x15, 0x04, 0x4c, 0x17, 0x16, 0x14, 0x13,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0b, 0x07, 0x1d,
+    0x2b, 0x01, 0x33, 0x15, 0x23, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x35,
+    0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x03, 0x33, 0x13, 0x13,
+    0x33, 0x03, 0x01, 0x24, 0x86, 0x86, 0x86, 0x86, 0x44, 0x8c, 0x8c, 0x8c,
+    0x8c, 0xbc, 0x4e, 0x91, 0x85, 0x4a, 0xae, 0x01, 0x12, 0x39, 0x3f, 0x38,
+    0x62, 0x62, 0x38, 0x3f, 0x39, 0x15, 0x01, 0x49, 0xfe, 0xfb, 0x01, 0x04,
+    0xfe, 0xb8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x88, 0x01, 0xca,
+    0x02, 0x25, 0x00, 0x0e, 0x00, 0x06, 0xb3, 0x0e, 0x05, 0x01, 0x30, 0x2b,
+    0x37, 0x37, 0x27, 0x37, 0x17, 0x27, 0x33, 0x07, 0x37, 0x17, 0x07, 0x17,
+    0x07, 0x27, 0x07, 0x54, 0x82, 0xad, 0x1a, 0xa2, 0x10, 0x4e, 0x12, 0x9f,
+    0x1a, 0xab, 0x7e, 0x37, 0x6c, 0x70, 0xb4, 0x96, 0x35, 0x41, 0x4c, 0xb1,
+    0xb1, 0x48, 0x3d, 0x34, 0x97, 0x2b, 0xa6, 0xa7, 0x00, 0x01, 0x00, 0x8e,
+    0x00, 0xa5, 0x01, 0x64, 0x01, 0x72, 0x00, 0x0c, 0x00, 0x06, 0xb3, 0x04,
+    0x00, 0x01, 0x30, 0x2b, 0x36, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x14, 0x06, 0x23, 0xcc, 0x3e, 0x40, 0x2a, 0x1b, 0x32, 0x1f,
+    0x3f, 0x2d, 0xa5, 0x3c, 0x2b, 0x2a, 0x3c, 0x1b, 0x2f, 0x1c, 0x2a, 0x3d,
+    0x00, 0x01, 0x00, 0x33, 0xff, 0x66, 0x01, 0xad, 0x03, 0x09, 0x00, 0x03,
+    0x00, 0x06, 0xb3, 0x03, 0x01, 0x01, 0x30, 0x2b, 0x17, 0x01, 0x17, 0x01,
+    0x33, 0x01, 0x48, 0x32, 0xfe, 0xb8, 0x86, 0x03, 0x8f, 0x15, 0xfc, 0x72,
+    0x00, 0x01, 0x00, 0x28, 0x00, 0x04, 0x01, 0xbd, 0x01, 0xc5, 0x00, 0x14,
+    0x00, 0x06, 0xb3, 0x10, 0x09, 0x01, 0x30, 0x2b, 0x12, 0x06, 0x07, 0x21,
+    0x15, 0x21, 0x16, 0x33, 0x33, 0x15, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x33, 0x15, 0x23, 0xc0, 0x68, 0x06, 0x01, 0x6b, 0xfe, 0x95,
+    0x09, 0xc1, 0xa1, 0xaf, 0x6b, 0x7b, 0x39, 0x67, 0x44, 0xb1, 0xa1, 0x01,
+    0x9d, 0x56, 0x51, 0x28, 0xa2, 0x28, 0x76, 0x67, 0x44, 0x67, 0x39, 0x28,
+    0xff, 0xff, 0x00, 0x2d, 0x01, 0x1a, 0x01, 0xc8, 0x01, 0x57, 0x00, 0x02,
+    0x02, 0x6f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x68, 0x01, 0xc8,
+    0x02, 0x0b, 0x00, 0x0b, 0x00, 0x26, 0x40, 0x23, 0x00, 0x02, 0x01, 0x05,
+    0x02, 0x55, 0x03, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x65,
+    0x00, 0x02, 0x02, 0x05, 0x5d, 0x00, 0x05, 0x02, 0x05, 0x4d, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x13, 0x23, 0x35, 0x33,
+    0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0xde, 0xb1, 0xb1, 0x3f,
+    0xab, 0xab, 0x3f, 0x01, 0x23, 0x3d, 0xab, 0xab, 0x3d, 0xbb, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x2d, 0x01, 0x1a, 0x01, 0xc8, 0x01, 0x57, 0x00, 0x03,
+    0x00, 0x18, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x09,
+    0x16, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x2d, 0x01, 0x9b, 0xfe, 0x65, 0x01,
+    0x57, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x55, 0x00, 0x91, 0x01, 0xae,
+    0x01, 0xf7, 0x00, 0x0b, 0x00, 0x06, 0xb3, 0x0b, 0x05, 0x01, 0x30, 0x2b,
+    0x13, 0x07, 0x27, 0x37, 0x27, 0x37, 0x17, 0x37, 0x17, 0x07, 0x17, 0x07,
+    0xfe, 0x7d, 0x2c, 0x7e, 0x7e, 0x2f, 0x7c, 0x7e, 0x30, 0x82, 0x7f, 0x2e,
+    0x01, 0x16, 0x81, 0x2c, 0x83, 0x85, 0x2e, 0x83, 0x83, 0x2c, 0x86, 0x86,
+    0x2e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x47, 0x00, 0x72, 0x01, 0xaf,
+    0x02, 0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x3b, 0x40, 0x38,
+    0x00, 0x00, 0x06, 0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x02, 0x00,
+    0x03, 0x04, 0x02, 0x03, 0x65, 0x00, 0x04, 0x05, 0x05, 0x04, 0x57, 0x00,
+    0x04, 0x04, 0x05, 0x5f, 0x07, 0x01, 0x05, 0x04, 0x05, 0x4f, 0x10, 0x10,
+    0x00, 0x00, 0x10, 0x1b, 0x10, 0x1a, 0x16, 0x14, 0x0f, 0x0e, 0x0d, 0x0c,
+    0x00, 0x0b, 0x00, 0x0a, 0x24, 0x08, 0x07, 0x15, 0x2b, 0x12, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x07, 0x21, 0x15,
+    0x21, 0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x23, 0xed, 0x1a, 0x1b, 0x11, 0x12, 0x1b, 0x1a, 0x13, 0xb8, 0x01, 0x68,
+    0xfe, 0x98, 0xa7, 0x1c, 0x1c, 0x12, 0x11, 0x1b, 0x1a, 0x12, 0x01, 0xa6,
+    0x1a, 0x12, 0x13, 0x1b, 0x1c, 0x12, 0x12, 0x1a, 0x4a, 0x43, 0xa7, 0x1a,
+    0x12, 0x14, 0x1a, 0x1c, 0x12, 0x12, 0x1a, 0x00, 0x00, 0x02, 0x00, 0x2d,
+    0x00, 0xdc, 0x01, 0xc8, 0x01, 0xb6, 0x00, 0x03, 0x00, 0x07, 0x00, 0x3e,
+    0x4b, 0xb0, 0x1b, 0x50, 0x58, 0x40, 0x12, 0x00, 0x02, 0x00, 0x03, 0x02,
+    0x03, 0x61, 0x00, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x17, 0x01,
+    0x4c, 0x1b, 0x40, 0x18, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x65,
+    0x00, 0x02, 0x03, 0x03, 0x02, 0x55, 0x00, 0x02, 0x02, 0x03, 0x5d, 0x00,
+    0x03, 0x02, 0x03, 0x4d, 0x59, 0xb6, 0x11, 0x11, 0x11, 0x10, 0x04, 0x07,
+    0x18, 0x2b, 0x13, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x2d, 0x01,
+    0x9b, 0xfe, 0x65, 0x01, 0x9b, 0xfe, 0x65, 0x01, 0xb6, 0x3d, 0x60, 0x3d,
+    0x00, 0x01, 0x00, 0x2d, 0x00, 0x37, 0x01, 0xc8, 0x02, 0x68, 0x00, 0x13,
+    0x00, 0x06, 0xb3, 0x0f, 0x05, 0x01, 0x30, 0x2b, 0x01, 0x07, 0x33, 0x15,
+    0x23, 0x07, 0x27, 0x37, 0x23, 0x35, 0x33, 0x37, 0x23, 0x35, 0x33, 0x37,
+    0x17, 0x07, 0x33, 0x15, 0x01, 0x27, 0x38, 0xd9, 0xfc, 0x5f, 0x2b, 0x51,
+    0x66, 0x89, 0x37, 0xc0, 0xe4, 0x66, 0x2b, 0x58, 0x7e, 0x01, 0x79, 0x60,
+    0x3d, 0xa5, 0x18, 0x8d, 0x3d, 0x60, 0x3d, 0xb2, 0x19, 0x99, 0x3d, 0x00,
+    0x00, 0x01, 0x00, 0x28, 0x00, 0x2f, 0x01, 0xd2, 0x02, 0x37, 0x00, 0x06,
+    0x00, 0x06, 0xb3, 0x06, 0x03, 0x01, 0x30, 0x2b, 0x37, 0x25, 0x25, 0x35,
+    0x05, 0x15, 0x05, 0x28, 0x01, 0x5d, 0xfe, 0xa5, 0x01, 0xa8, 0xfe, 0x56,
+    0x7b, 0xc4, 0xb1, 0x47, 0xdf, 0x30, 0xf9, 0x00, 0x00, 0x01, 0x00, 0x23,
+    0x00, 0x2f, 0x01, 0xcd, 0x02, 0x37, 0x00, 0x06, 0x00, 0x06, 0xb3, 0x06,
+    0x02, 0x01, 0x30, 0x2b, 0x13, 0x35, 0x25, 0x15, 0x05, 0x05, 0x15, 0x23,
+    0x01, 0xa7, 0xfe, 0xa5, 0x01, 0x5e, 0x01, 0x28, 0x30, 0xdf, 0x47, 0xb1,
+    0xc4, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x23, 0x00, 0x11, 0x01, 0xca,
+    0x02, 0x0f, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x08, 0xb5, 0x08, 0x07, 0x06,
+    0x03, 0x02, 0x30, 0x2b, 0x37, 0x25, 0x25, 0x35, 0x05, 0x15, 0x05, 0x17,
+    0x35, 0x21, 0x15, 0x23, 0x01, 0x5b, 0xfe, 0xa5, 0x01, 0xa7, 0xfe, 0x59,
+    0x01, 0x01, 0x9b, 0xad, 0x9c, 0x7f, 0x47, 0xad, 0x30, 0xc7, 0x5a, 0x3f,
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x23, 0x00, 0x11, 0x01, 0xca,
+    0x02, 0x0f, 0x00, 0x06, 0x00, 0x0a, 0x00, 0x08, 0xb5, 0x09, 0x07, 0x06,
+    0x02, 0x02, 0x30, 0x2b, 0x13, 0x35, 0x25, 0x15, 0x05, 0x05, 0x15, 0x05,
+    0x21, 0x15, 0x21, 0x23, 0x01, 0xa7, 0xfe, 0xa5, 0x01, 0x5b, 0xfe, 0x64,
+    0x01, 0x9b, 0xfe, 0x65, 0x01, 0x32, 0x30, 0xad, 0x47, 0x7f, 0x9c, 0x42,
+    0x1b, 0x3f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2d, 0x00, 0x11, 0x01, 0xc9,
+    0x02, 0x3f, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x58, 0x4b, 0xb0, 0x1d, 0x50,
+    0x58, 0x40, 0x1d, 0x03, 0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00,
+    0x65, 0x00, 0x02, 0x00, 0x05, 0x06, 0x02, 0x05, 0x65, 0x00, 0x06, 0x06,
+    0x07, 0x5d, 0x00, 0x07, 0x07, 0x15, 0x07, 0x4c, 0x1b, 0x40, 0x22, 0x03,
+    0x01, 0x01, 0x04, 0x01, 0x00, 0x05, 0x01, 0x00, 0x65, 0x00, 0x02, 0x00,
+    0x05, 0x06, 0x02, 0x05, 0x65, 0x00, 0x06, 0x07, 0x07, 0x06, 0x55, 0x00,
+    0x06, 0x06, 0x07, 0x5d, 0x00, 0x07, 0x06, 0x07, 0x4d, 0x59, 0x40, 0x0b,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x08, 0x07, 0x1c, 0x2b,
+    0x13, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23,
+    0x07, 0x21, 0x15, 0x21, 0xde, 0xb1, 0xb1, 0x3f, 0xab, 0xab, 0x3f, 0xb0,
+    0x01, 0x9b, 0xfe, 0x65, 0x01, 0x57, 0x3d, 0xab, 0xab, 0x3d, 0xbc, 0x4b,
+    0x3f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x47, 0x00, 0xba, 0x01, 0xcd,
+    0x01, 0xd1, 0x00, 0x26, 0x02, 0x7a, 0x00, 0x5a, 0x01, 0x06, 0x02, 0x7a,
+    0x00, 0xb0, 0x00, 0x11, 0xb1, 0x00, 0x01, 0xb0, 0x5a, 0xb0, 0x33, 0x2b,
+    0xb1, 0x01, 0x01, 0xb8, 0xff, 0xb0, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x47, 0x01, 0x0a, 0x01, 0xcd, 0x01, 0x77, 0x00, 0x19,
+    0x00, 0x3c, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x31, 0x16, 0x15, 0x02, 0x02,
+    0x01, 0x09, 0x08, 0x02, 0x03, 0x00, 0x02, 0x4a, 0x00, 0x02, 0x00, 0x03,
+    0x02, 0x57, 0x00, 0x01, 0x00, 0x00, 0x03, 0x01, 0x00, 0x67, 0x00, 0x02,
+    0x02, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x02, 0x03, 0x4f, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x18, 0x24, 0x25, 0x24, 0x05, 0x07, 0x17, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x00, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
+    0x17, 0x06, 0x06, 0x23, 0x01, 0x43, 0x27, 0x17, 0x16, 0x1b, 0x10, 0x18,
+    0x24, 0x10, 0x31, 0x11, 0x3e, 0x2c, 0x18, 0x23, 0x18, 0x14, 0x1e, 0x11,
+    0x16, 0x1d, 0x14, 0x2e, 0x1a, 0x32, 0x25, 0x01, 0x0a, 0x10, 0x0e, 0x0c,
+    0x0c, 0x15, 0x1a, 0x16, 0x24, 0x2c, 0x0f, 0x0e, 0x0d, 0x0c, 0x14, 0x1c,
+    0x1c, 0x2a, 0x21, 0x00, 0x00, 0x01, 0x00, 0x5b, 0x00, 0x9d, 0x01, 0x9e,
+    0x01, 0x5b, 0x00, 0x05, 0x00, 0x3e, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40,
+    0x16, 0x00, 0x02, 0x00, 0x00, 0x02, 0x6f, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x55, 0x00, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x1b,
+    0x40, 0x15, 0x00, 0x02, 0x00, 0x02, 0x84, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x55, 0x00, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x01, 0x00, 0x4d, 0x59,
+    0xb5, 0x11, 0x11, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x01, 0x21, 0x35, 0x21,
+    0x15, 0x23, 0x01, 0x5e, 0xfe, 0xfd, 0x01, 0x43, 0x40, 0x01, 0x1c, 0x3f,
+    0xbe, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0xae, 0x01, 0xec,
+    0x01, 0xaf, 0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x0a, 0xb7, 0x29,
+    0x23, 0x1d, 0x17, 0x0b, 0x01, 0x03, 0x30, 0x2b, 0x24, 0x06, 0x23, 0x22,
+    0x27, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x24, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x36, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x01, 0xec, 0x45, 0x35, 0x49, 0x2f,
+    0x33, 0x43, 0x35, 0x45, 0x46, 0x34, 0x25, 0x3a, 0x19, 0x18, 0x3a, 0x25,
+    0x35, 0x44, 0xfe, 0xda, 0x27, 0x19, 0x1d, 0x23, 0x23, 0x1d, 0x1b, 0x28,
+    0x11, 0xd6, 0x23, 0x1c, 0x1a, 0x28, 0x13, 0x13, 0x29, 0x18, 0x1d, 0x23,
+    0xf8, 0x4a, 0x4f, 0x4f, 0x49, 0x37, 0x38, 0x49, 0x25, 0x2a, 0x28, 0x27,
+    0x47, 0x3a, 0x27, 0x20, 0x27, 0x1f, 0x1f, 0x27, 0x23, 0x23, 0x1e, 0x27,
+    0x22, 0x24, 0x24, 0x22, 0x27, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0d,
+    0x00, 0x68, 0x01, 0xe9, 0x02, 0x26, 0x00, 0x17, 0x00, 0x20, 0x00, 0x29,
+    0x00, 0x0a, 0xb7, 0x24, 0x22, 0x1b, 0x19, 0x16, 0x0a, 0x03, 0x30, 0x2b,
+    0x01, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x07, 0x27,
+    0x37, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x37, 0x17,
+    0x04, 0x17, 0x37, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x24, 0x27, 0x07,
+    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0xa8, 0x2f, 0x3c, 0x65, 0x3c,
+    0x29, 0x4c, 0x1e, 0x40, 0x1a, 0x40, 0x2e, 0x3b, 0x65, 0x3b, 0x29, 0x4d,
+    0x1e, 0x42, 0x19, 0xfe, 0x6d, 0x1f, 0xf0, 0x2f, 0x3c, 0x2d, 0x4b, 0x2c,
+    0x01, 0x4a, 0x21, 0xf0, 0x2e, 0x3d, 0x2d, 0x4c, 0x2d, 0x01, 0xcd, 0x3c,
+    0x4b, 0x3b, 0x66, 0x3b, 0x1e, 0x1b, 0x3b, 0x1c, 0x3b, 0x3c, 0x4b, 0x3b,
+    0x65, 0x3b, 0x1d, 0x1b, 0x3d, 0x1c, 0xf9, 0x2c, 0xde, 0x27, 0x2c, 0x4c,
+    0x2c, 0x36, 0x2c, 0xe0, 0x28, 0x2d, 0x4c, 0x2d, 0x00, 0x01, 0x00, 0x49,
+    0xff, 0x10, 0x01, 0xb4, 0x02, 0xf8, 0x00, 0x16, 0x00, 0x06, 0xb3, 0x09,
+    0x00, 0x01, 0x30, 0x2b, 0x16, 0x27, 0x35, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x11, 0x34, 0x33, 0x32, 0x17, 0x15, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11,
+    0x14, 0x06, 0x23, 0x6a, 0x21, 0x1d, 0x21, 0x28, 0x2d, 0x97, 0x22, 0x1f,
+    0x1c, 0x1f, 0x2c, 0x29, 0x4f, 0x45, 0xf0, 0x0d, 0x3e, 0x0d, 0x3c, 0x3f,
+    0x02, 0x75, 0xba, 0x0c, 0x3d, 0x0b, 0x39, 0x4b, 0xfd, 0x8c, 0x59, 0x59,
+    0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x01, 0xe8, 0x02, 0xa3, 0x00, 0x1f,
+    0x00, 0x06, 0xb3, 0x0e, 0x06, 0x01, 0x30, 0x2b, 0x12, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0x15, 0x23, 0x35, 0x33, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x33, 0x15, 0x23, 0x35, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0xb0, 0x59, 0x4d, 0x39, 0xb4, 0x73, 0x3d, 0x4b,
+    0x7c, 0x70, 0x6d, 0x7b, 0x49, 0x3f, 0x74, 0xb6, 0x43, 0x45, 0x57, 0x4f,
+    0x02, 0x60, 0x88, 0x80, 0x5d, 0x95, 0x21, 0x45, 0x43, 0x28, 0x94, 0x62,
+    0x9e, 0xa4, 0xa3, 0xa0, 0x63, 0x94, 0x26, 0x43, 0x45, 0x22, 0x8f, 0x61,
+    0x83, 0x86, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x01, 0x01, 0xd3,
+    0x02, 0x99, 0x00, 0x05, 0x00, 0x08, 0x00, 0x08, 0xb5, 0x07, 0x06, 0x04,
+    0x01, 0x02, 0x30, 0x2b, 0x25, 0x15, 0x21, 0x35, 0x13, 0x33, 0x07, 0x03,
+    0x21, 0x01, 0xd3, 0xfe, 0x4d, 0xaf, 0x57, 0x2b, 0x93, 0x01, 0x23, 0x2e,
+    0x2d, 0x2e, 0x02, 0x6a, 0x3b, 0xfd, 0xde, 0x00, 0x00, 0x01, 0x00, 0x36,
+    0xff, 0x42, 0x01, 0xbf, 0x02, 0x6f, 0x00, 0x0a, 0x00, 0x06, 0xb3, 0x05,
+    0x00, 0x01, 0x30, 0x2b, 0x13, 0x21, 0x14, 0x06, 0x07, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x36, 0x01, 0x89, 0x05, 0x01, 0x47, 0xf3, 0x49, 0x02,
+    0x6f, 0x05, 0x0d, 0x04, 0xfc, 0xe9, 0x02, 0xf2, 0xfd, 0x0e, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x24, 0xff, 0x55, 0x01, 0xca, 0x02, 0x9c, 0x00, 0x0b,
+    0x00, 0x06, 0xb3, 0x0a, 0x05, 0x01, 0x30, 0x2b, 0x01, 0x21, 0x13, 0x03,
+    0x21, 0x15, 0x21, 0x35, 0x13, 0x03, 0x35, 0x21, 0x01, 0xca, 0xfe, 0x98,
+    0xd0, 0xd7, 0x01, 0x6f, 0xfe, 0x5a, 0xc3, 0xc3, 0x01, 0xa6, 0x02, 0x61,
+    0xfe, 0x9a, 0xfe, 0x95, 0x3b, 0x51, 0x01, 0x53, 0x01, 0x56, 0x4d, 0x00,
+    0x00, 0x01, 0x00, 0x0c, 0xff, 0xf9, 0x01, 0xea, 0x02, 0xa3, 0x00, 0x08,
+    0x00, 0x06, 0xb3, 0x07, 0x05, 0x01, 0x30, 0x2b, 0x13, 0x23, 0x35, 0x33,
+    0x13, 0x13, 0x33, 0x03, 0x23, 0x65, 0x59, 0x7e, 0x5f, 0xc7, 0x3a, 0xe6,
+    0x34, 0x01, 0x1c, 0x37, 0xfe, 0xfd, 0x02, 0x53, 0xfd, 0x56, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x18, 0xff, 0x59, 0x01, 0xee, 0x01, 0xc9, 0x00, 0x24,
+    0x00, 0x30, 0x40, 0x2d, 0x21, 0x1b, 0x15, 0x03, 0x02, 0x00, 0x16, 0x09,
+    0x02, 0x03, 0x02, 0x02, 0x4a, 0x01, 0x01, 0x00, 0x00, 0x17, 0x4b, 0x00,
+    0x02, 0x02, 0x03, 0x5f, 0x04, 0x01, 0x03, 0x03, 0x1d, 0x4b, 0x00, 0x05,
+    0x05, 0x19, 0x05, 0x4c, 0x14, 0x24, 0x25, 0x22, 0x18, 0x14, 0x06, 0x07,
+    0x1a, 0x2b, 0x16, 0x37, 0x36, 0x35, 0x35, 0x33, 0x11, 0x14, 0x16, 0x17,
+    0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x33, 0x32, 0x36, 0x37, 0x37,
+    0x17, 0x06, 0x23, 0x22, 0x26, 0x27, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
+    0x14, 0x07, 0x23, 0x18, 0x09, 0x0b, 0x42, 0x34, 0x2d, 0x31, 0x34, 0x40,
+    0x28, 0x0e, 0x1d, 0x06, 0x06, 0x1b, 0x25, 0x33, 0x20, 0x2e, 0x04, 0x11,
+    0x43, 0x27, 0x26, 0x3e, 0x0e, 0x01, 0x3e, 0x83, 0x82, 0xb0, 0x1b, 0xff,
+    0xfe, 0xf1, 0x4c, 0x3f, 0x04, 0x04, 0x4d, 0x44, 0x01, 0x09, 0xfe, 0xab,
+    0x45, 0x17, 0x0e, 0x0c, 0x33, 0x37, 0x2c, 0x21, 0x25, 0x28, 0x24, 0x22,
+    0x97, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x23, 0xff, 0xf5, 0x01, 0xd3,
+    0x02, 0x95, 0x00, 0x1f, 0x00, 0x2e, 0x00, 0x08, 0xb5, 0x24, 0x20, 0x15,
+    0x00, 0x02, 0x30, 0x2b, 0x16, 0x26, 0x27, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x17, 0x37, 0x34, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+    0x36, 0x36, 0x37, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x17,
+    0x16, 0x16, 0x33, 0x8c, 0x5e, 0x09, 0x02, 0x2e, 0x5e, 0x44, 0x5e, 0x37,
+    0x01, 0x04, 0x0b, 0x48, 0x49, 0x1d, 0x3f, 0x17, 0x07, 0x38, 0x42, 0x6a,
+    0x6f, 0x0d, 0x04, 0x31, 0x6d, 0x55, 0x4f, 0x50, 0x06, 0x17, 0x40, 0x2a,
+    0x31, 0x44, 0x21, 0x02, 0x07, 0x3c, 0x2f, 0x0b, 0x61, 0x53, 0x18, 0x0e,
+    0x3f, 0x6f, 0x45, 0x56, 0x0d, 0x11, 0x1a, 0x59, 0x61, 0x0e, 0x0e, 0x3b,
+    0x18, 0x7e, 0x77, 0x20, 0x29, 0x5b, 0xa1, 0x66, 0x37, 0x99, 0x66, 0x33,
+    0x2e, 0x3a, 0x5b, 0x32, 0x0a, 0x14, 0x3c, 0x3f, 0x00, 0x05, 0x00, 0x1c,
+    0xff, 0xf6, 0x01, 0xe2, 0x02, 0x7a, 0x00, 0x0e, 0x00, 0x12, 0x00, 0x1e,
+    0x00, 0x2d, 0x00, 0x39, 0x01, 0x36, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
+    0x2b, 0x0b, 0x01, 0x05, 0x0a, 0x01, 0x01, 0x06, 0x05, 0x01, 0x67, 0x00,
+    0x06, 0x00, 0x08, 0x09, 0x06, 0x08, 0x68, 0x00, 0x04, 0x04, 0x00, 0x5f,
+    0x02, 0x01, 0x00, 0x00, 0x1c, 0x4b, 0x0d, 0x01, 0x09, 0x09, 0x03, 0x5f,
+    0x0c, 0x07, 0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x10,
+    0x50, 0x58, 0x40, 0x2f, 0x0b, 0x01, 0x05, 0x0a, 0x01, 0x01, 0x06, 0x05,
+    0x01, 0x67, 0x00, 0x06, 0x00, 0x08, 0x09, 0x06, 0x08, 0x68, 0x00, 0x02,
+    0x02, 0x14, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c,
+    0x4b, 0x0d, 0x01, 0x09, 0x09, 0x03, 0x5f, 0x0c, 0x07, 0x02, 0x03, 0x03,
+    0x15, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x2b, 0x0b,
+    0x01, 0x05, 0x0a, 0x01, 0x01, 0x06, 0x05, 0x01, 0x67, 0x00, 0x06, 0x00,
+    0x08, 0x09, 0x06, 0x08, 0x68, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x02, 0x01,
+    0x00, 0x00, 0x1c, 0x4b, 0x0d, 0x01, 0x09, 0x09, 0x03, 0x5f, 0x0c, 0x07,
+    0x02, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58,
+    0x40, 0x2f, 0x0b, 0x01, 0x05, 0x0a, 0x01, 0x01, 0x06, 0x05, 0x01, 0x67,
+    0x00, 0x06, 0x00, 0x08, 0x09, 0x06, 0x08, 0x68, 0x00, 0x02, 0x02, 0x14,
+    0x4b, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x0d,
+    0x01, 0x09, 0x09, 0x03, 0x5f, 0x0c, 0x07, 0x02, 0x03, 0x03, 0x15, 0x03,
+    0x4c, 0x1b, 0x40, 0x33, 0x0b, 0x01, 0x05, 0x0a, 0x01, 0x01, 0x06, 0x05,
+    0x01, 0x67, 0x00, 0x06, 0x00, 0x08, 0x09, 0x06, 0x08, 0x68, 0x00, 0x02,
+    0x02, 0x14, 0x4b, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c,
+    0x4b, 0x00, 0x03, 0x03, 0x15, 0x4b, 0x0d, 0x01, 0x09, 0x09, 0x07, 0x5f,
+    0x0c, 0x01, 0x07, 0x07, 0x1d, 0x07, 0x4c, 0x59, 0x59, 0x59, 0x59, 0x40,
+    0x26, 0x2e, 0x2e, 0x1f, 0x1f, 0x13, 0x13, 0x00, 0x00, 0x2e, 0x39, 0x2e,
+    0x38, 0x34, 0x32, 0x1f, 0x2d, 0x1f, 0x2c, 0x27, 0x25, 0x13, 0x1e, 0x13,
+    0x1d, 0x19, 0x17, 0x12, 0x11, 0x10, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x26,
+    0x0e, 0x07, 0x15, 0x2b, 0x12, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x37, 0x33, 0x01, 0x23, 0x12,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x12,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0x6e, 0x34, 0x1e, 0x1e, 0x34, 0x1e, 0x1e, 0x34, 0x1e, 0x40,
+    0x30, 0xfb, 0x39, 0xfe, 0xa4, 0x36, 0x73, 0x1c, 0x1e, 0x15, 0x14, 0x1d,
+    0x1e, 0x15, 0xc9, 0x34, 0x1e, 0x1e, 0x34, 0x1e, 0x2e, 0x41, 0x1e, 0x33,
+    0x1e, 0x17, 0x1d, 0x1d, 0x18, 0x16, 0x1e, 0x20, 0x16, 0x01, 0x75, 0x22,
+    0x3c, 0x25, 0x24, 0x3b, 0x23, 0x23, 0x3c, 0x24, 0x39, 0x49, 0xfa, 0xfd,
+    0x91, 0x01, 0xaa, 0x26, 0x28, 0x28, 0x26, 0x26, 0x28, 0x27, 0x27, 0xfe,
+    0x4c, 0x22, 0x3b, 0x24, 0x24, 0x3b, 0x23, 0x4c, 0x36, 0x24, 0x3b, 0x22,
+    0x32, 0x28, 0x26, 0x23, 0x2d, 0x27, 0x27, 0x28, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x14, 0xff, 0xf5, 0x01, 0xe0, 0x02, 0x78, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x1b, 0x00, 0x27, 0x00, 0x33, 0x00, 0x3f, 0x00, 0x4b,
+    0x00, 0xb1, 0x40, 0x0f, 0x1a, 0x19, 0x02, 0x03, 0x02, 0x18, 0x01, 0x04,
+    0x01, 0x1b, 0x01, 0x08, 0x04, 0x03, 0x4a, 0x4b, 0xb0, 0x1f, 0x50, 0x58,
+    0x40, 0x31, 0x06, 0x01, 0x04, 0x0a, 0x01, 0x08, 0x09, 0x04, 0x08, 0x67,
+    0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x0c, 0x01,
+    0x01, 0x01, 0x03, 0x5f, 0x0d, 0x01, 0x03, 0x03, 0x17, 0x4b, 0x11, 0x0b,
+    0x10, 0x03, 0x09, 0x09, 0x05, 0x5f, 0x0f, 0x07, 0x0e, 0x03, 0x05, 0x05,
+    0x1d, 0x05, 0x4c, 0x1b, 0x40, 0x2f, 0x0d, 0x01, 0x03, 0x0c, 0x01, 0x01,
+    0x04, 0x03, 0x01, 0x67, 0x06, 0x01, 0x04, 0x0a, 0x01, 0x08, 0x09, 0x04,
+    0x08, 0x67, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b,
+    0x11, 0x0b, 0x10, 0x03, 0x09, 0x09, 0x05, 0x5f, 0x0f, 0x07, 0x0e, 0x03,
+    0x05, 0x05, 0x1d, 0x05, 0x4c, 0x59, 0x40, 0x32, 0x40, 0x40, 0x34, 0x34,
+    0x28, 0x28, 0x1c, 0x1c, 0x0c, 0x0c, 0x00, 0x00, 0x40, 0x4b, 0x40, 0x4a,
+    0x46, 0x44, 0x34, 0x3f, 0x34, 0x3e, 0x3a, 0x38, 0x28, 0x33, 0x28, 0x32,
+    0x2e, 0x2c, 0x1c, 0x27, 0x1c, 0x26, 0x22, 0x20, 0x0c, 0x17, 0x0c, 0x16,
+    0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x12, 0x07, 0x15, 0x2b, 0x12,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x07,
+    0x01, 0x15, 0x01, 0x16, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x32, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x26, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0x20, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0x57, 0x3d, 0x3d, 0x2b, 0x2b, 0x3d, 0x3b, 0x2d, 0x12,
+    0x1a, 0x1b, 0x13, 0x12, 0x1a, 0x1b, 0x13, 0x6e, 0x01, 0xcc, 0xfe, 0x34,
+    0x43, 0x3d, 0x3d, 0x2b, 0x2b, 0x3d, 0x3b, 0x2d, 0xca, 0x3d, 0x3d, 0x2b,
+    0x2b, 0x3d, 0x3b, 0x2d, 0xe3, 0x1a, 0x1b, 0x13, 0x12, 0x1a, 0x1b, 0x13,
+    0x01, 0x08, 0x19, 0x1b, 0x13, 0x12, 0x1a, 0x1b, 0x13, 0x01, 0x85, 0x46,
+    0x34, 0x33, 0x46, 0x47, 0x33, 0x35, 0x44, 0x34, 0x22, 0x24, 0x24, 0x22,
+    0x22, 0x24, 0x24, 0x22, 0x9f, 0x01, 0x04, 0x38, 0xfe, 0xfc, 0xed, 0x46,
+    0x34, 0x33, 0x46, 0x47, 0x33, 0x35, 0x44, 0x46, 0x34, 0x33, 0x46, 0x47,
+    0x33, 0x34, 0x45, 0x34, 0x22, 0x24, 0x24, 0x22, 0x22, 0x24, 0x24, 0x22,
+    0x22, 0x24, 0x24, 0x22, 0x23, 0x23, 0x23, 0x23, 0x00, 0x03, 0x00, 0x29,
+    0x00, 0x63, 0x01, 0xca, 0x02, 0x05, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2b,
+    0x00, 0x0a, 0xb7, 0x2a, 0x24, 0x16, 0x10, 0x06, 0x00, 0x03, 0x30, 0x2b,
+    0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x27, 0x23, 0x35, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0xc0, 0x5f, 0x38, 0x38, 0x5f,
+    0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d,
+    0x2e, 0x2d, 0x4d, 0x2e, 0x2e, 0x4d, 0x2d, 0x12, 0x73, 0x73, 0x29, 0x70,
+    0x70, 0x29, 0x63, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39,
+    0x39, 0x60, 0x38, 0x28, 0x2e, 0x4e, 0x2d, 0x2d, 0x4d, 0x2e, 0x2e, 0x4d,
+    0x2d, 0x2d, 0x4e, 0x2e, 0x98, 0x28, 0x6f, 0x6f, 0x28, 0x79, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x47, 0x01, 0xd2, 0x01, 0xcd, 0x02, 0x3f, 0x01, 0x07,
+    0x02, 0x7a, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x08, 0xb1, 0x00, 0x01, 0xb0,
+    0xc8, 0xb0, 0x33, 0x2b, 0x00, 0x01, 0x00, 0x3b, 0x00, 0x07, 0x01, 0xb9,
+    0x02, 0x45, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x08, 0x03, 0x01, 0x30, 0x2b,
+    0x13, 0x07, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x11, 0x23, 0xda, 0x74,
+    0x2b, 0xbb, 0x16, 0xad, 0x32, 0x6a, 0x43, 0x01, 0xc6, 0x90, 0x23, 0xec,
+    0xee, 0x21, 0x8f, 0xfe, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x69, 0x01, 0xdd, 0x02, 0x30, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x08,
+    0x03, 0x01, 0x30, 0x2b, 0x01, 0x07, 0x27, 0x25, 0x17, 0x03, 0x27, 0x37,
+    0x01, 0x27, 0x01, 0x60, 0xb8, 0x06, 0x01, 0x2b, 0x10, 0x2e, 0x3b, 0x1a,
+    0xfe, 0xb0, 0x30, 0x01, 0xea, 0x14, 0x37, 0x23, 0x10, 0xfe, 0xde, 0x0c,
+    0xb0, 0xfe, 0xaf, 0x30, 0x00, 0x01, 0x00, 0x10, 0x00, 0x69, 0x01, 0xd9,
+    0x01, 0xe7, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x05, 0x02, 0x01, 0x30, 0x2b,
+    0x01, 0x27, 0x37, 0x17, 0x15, 0x07, 0x27, 0x37, 0x21, 0x35, 0x01, 0x5a,
+    0x90, 0x23, 0xec, 0xee, 0x21, 0x8f, 0xfe, 0xb7, 0x01, 0x48, 0x74, 0x2b,
+    0xbb, 0x16, 0xad, 0x32, 0x6a, 0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0e,
+    0x00, 0x27, 0x01, 0xdd, 0x01, 0xee, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x05,
+    0x00, 0x01, 0x30, 0x2b, 0x13, 0x01, 0x27, 0x37, 0x13, 0x07, 0x25, 0x37,
+    0x17, 0x01, 0x3e, 0x01, 0x50, 0x1a, 0x3b, 0x2e, 0x10, 0xfe, 0xd5, 0x06,
+    0xb8, 0xfe, 0xae, 0x01, 0xee, 0xfe, 0xaf, 0xb0, 0x0c, 0xfe, 0xde, 0x10,
+    0x23, 0x37, 0x14, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3b,
+    0x00, 0x1d, 0x01, 0xb9, 0x02, 0x5b, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x04,
+    0x00, 0x01, 0x30, 0x2b, 0x01, 0x11, 0x37, 0x17, 0x07, 0x23, 0x27, 0x37,
+    0x17, 0x11, 0x01, 0x1d, 0x6a, 0x32, 0xad, 0x16, 0xbb, 0x2b, 0x74, 0x02,
+    0x5b, 0xfe, 0x42, 0x8f, 0x21, 0xee, 0xec, 0x23, 0x90, 0x01, 0xbf, 0x00,
+    0x00, 0x01, 0x00, 0x0b, 0x00, 0x27, 0x01, 0xda, 0x01, 0xee, 0x00, 0x09,
+    0x00, 0x06, 0xb3, 0x08, 0x03, 0x01, 0x30, 0x2b, 0x37, 0x37, 0x17, 0x05,
+    0x27, 0x13, 0x17, 0x07, 0x01, 0x17, 0x88, 0xb8, 0x06, 0xfe, 0xd5, 0x10,
+    0x2e, 0x3b, 0x1a, 0x01, 0x50, 0x30, 0x6d, 0x14, 0x37, 0x23, 0x10, 0x01,
+    0x22, 0x0c, 0xb0, 0x01, 0x51, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0x00, 0x69, 0x01, 0xe0, 0x01, 0xe7, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x06,
+    0x03, 0x01, 0x30, 0x2b, 0x01, 0x21, 0x17, 0x07, 0x27, 0x35, 0x37, 0x17,
+    0x07, 0x21, 0x01, 0xe0, 0xfe, 0xb7, 0x8f, 0x21, 0xee, 0xec, 0x23, 0x90,
+    0x01, 0x4a, 0x01, 0x05, 0x6a, 0x32, 0xad, 0x16, 0xbb, 0x2b, 0x74, 0x00,
+    0x00, 0x01, 0x00, 0x0b, 0x00, 0x6a, 0x01, 0xda, 0x02, 0x31, 0x00, 0x09,
+    0x00, 0x06, 0xb3, 0x05, 0x00, 0x01, 0x30, 0x2b, 0x25, 0x01, 0x17, 0x07,
+    0x03, 0x37, 0x05, 0x07, 0x27, 0x01, 0x01, 0xaa, 0xfe, 0xb0, 0x1a, 0x3b,
+    0x2e, 0x10, 0x01, 0x2b, 0x06, 0xb8, 0x01, 0x52, 0x6a, 0x01, 0x51, 0xb0,
+    0x0c, 0x01, 0x22, 0x10, 0x23, 0x37, 0x14, 0xfe, 0xaf, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0a, 0x00, 0x6a, 0x01, 0xea, 0x01, 0xe8, 0x00, 0x0f,
+    0x00, 0x06, 0xb3, 0x0a, 0x02, 0x01, 0x30, 0x2b, 0x01, 0x15, 0x07, 0x27,
+    0x37, 0x23, 0x17, 0x07, 0x27, 0x35, 0x37, 0x17, 0x07, 0x33, 0x27, 0x37,
+    0x01, 0xea, 0xb2, 0x21, 0x5d, 0xf4, 0x5d, 0x21, 0xb2, 0xb0, 0x23, 0x5e,
+    0xf6, 0x5e, 0x23, 0x01, 0x2d, 0x16, 0xad, 0x32, 0x6a, 0x6a, 0x32, 0xad,
+    0x16, 0xbb, 0x2b, 0x74, 0x74, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3b,
+    0x00, 0x38, 0x01, 0xb9, 0x02, 0x18, 0x00, 0x0f, 0x00, 0x06, 0xb3, 0x08,
+    0x00, 0x01, 0x30, 0x2b, 0x37, 0x23, 0x27, 0x37, 0x17, 0x35, 0x07, 0x27,
+    0x37, 0x33, 0x17, 0x07, 0x27, 0x15, 0x37, 0x17, 0xfe, 0x16, 0xad, 0x32,
+    0x6a, 0x6a, 0x32, 0xad, 0x16, 0xbb, 0x2b, 0x74, 0x74, 0x2b, 0x38, 0xb2,
+    0x21, 0x5d, 0xf4, 0x5d, 0x21, 0xb2, 0xb0, 0x23, 0x5e, 0xf6, 0x5e, 0x23,
+    0x00, 0x02, 0x00, 0x22, 0x00, 0x00, 0x01, 0xd4, 0x02, 0x7c, 0x00, 0x0c,
+    0x00, 0x13, 0x00, 0x08, 0xb5, 0x11, 0x0e, 0x0a, 0x05, 0x02, 0x30, 0x2b,
+    0x01, 0x23, 0x17, 0x27, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x37, 0x33,
+    0x17, 0x07, 0x27, 0x07, 0x33, 0x11, 0x33, 0x11, 0x01, 0xd4, 0x0f, 0x01,
+    0x03, 0x58, 0xdf, 0x6a, 0xcc, 0x1b, 0xcb, 0x35, 0xa4, 0xa4, 0x5d, 0x8f,
+    0x01, 0x6d, 0x03, 0x03, 0xfe, 0x93, 0x01, 0x6d, 0x2c, 0xe3, 0xe3, 0x03,
+    0xb9, 0xb9, 0xfe, 0x92, 0x01, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a,
+    0x00, 0x43, 0x01, 0xea, 0x01, 0xf5, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x08,
+    0xb5, 0x13, 0x0e, 0x0b, 0x02, 0x02, 0x30, 0x2b, 0x01, 0x15, 0x07, 0x23,
+    0x35, 0x07, 0x37, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x17, 0x27, 0x15,
+    0x23, 0x15, 0x33, 0x15, 0x01, 0xea, 0xe3, 0x2c, 0x03, 0x03, 0xd1, 0xd1,
+    0x2c, 0xb6, 0xb9, 0xd2, 0xd2, 0x01, 0x29, 0x1b, 0xcb, 0x0f, 0x01, 0x03,
+    0x58, 0xdf, 0x6a, 0xd9, 0xa4, 0x5d, 0x8f, 0x5c, 0x00, 0x02, 0x00, 0x22,
+    0x00, 0x00, 0x01, 0xd4, 0x02, 0x7c, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x08,
+    0xb5, 0x13, 0x0f, 0x07, 0x02, 0x02, 0x30, 0x2b, 0x01, 0x15, 0x07, 0x23,
+    0x27, 0x35, 0x33, 0x11, 0x33, 0x11, 0x33, 0x37, 0x07, 0x07, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0x17, 0x01, 0xd4, 0xcb, 0x1b, 0xcc, 0x6a, 0xdf, 0x58,
+    0x03, 0x01, 0x26, 0x5c, 0x8f, 0x5d, 0xa4, 0x01, 0x0f, 0x2c, 0xe3, 0xe3,
+    0x2c, 0x01, 0x6d, 0xfe, 0x93, 0x03, 0x03, 0x29, 0x01, 0x6e, 0xfe, 0x92,
+    0xb9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x43, 0x01, 0xea,
+    0x01, 0xf5, 0x00, 0x0c, 0x00, 0x13, 0x00, 0x08, 0xb5, 0x12, 0x0d, 0x08,
+    0x04, 0x02, 0x30, 0x2b, 0x25, 0x15, 0x17, 0x27, 0x15, 0x23, 0x27, 0x35,
+    0x37, 0x33, 0x15, 0x33, 0x15, 0x07, 0x35, 0x33, 0x35, 0x23, 0x35, 0x07,
+    0x01, 0x19, 0x03, 0x03, 0x2c, 0xe3, 0xe3, 0x2c, 0xd1, 0xfa, 0xd2, 0xd2,
+    0xb9, 0xac, 0x58, 0x03, 0x01, 0x0f, 0xcb, 0x1b, 0xcc, 0x6a, 0xdf, 0x34,
+    0x5c, 0x8f, 0x5d, 0xa4, 0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x01, 0xd4,
+    0x02, 0x7c, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x07, 0x02, 0x01, 0x30, 0x2b,
+    0x01, 0x23, 0x11, 0x23, 0x11, 0x23, 0x35, 0x37, 0x33, 0x17, 0x01, 0xd4,
+    0x69, 0xdf, 0x6a, 0xcc, 0x1b, 0xcb, 0x01, 0x6d, 0xfe, 0x93, 0x01, 0x6d,
+    0x2c, 0xe3, 0xe3, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x43, 0x01, 0xea,
+    0x01, 0xf5, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x06, 0x02, 0x01, 0x30, 0x2b,
+    0x13, 0x33, 0x35, 0x33, 0x17, 0x15, 0x07, 0x23, 0x35, 0x23, 0x0a, 0xd1,
+    0x2c, 0xe3, 0xe3, 0x2c, 0xd1, 0x01, 0x8b, 0x6a, 0xcc, 0x1b, 0xcb, 0x69,
+    0x00, 0x01, 0x00, 0x22, 0x00, 0x00, 0x01, 0xd4, 0x02, 0x7c, 0x00, 0x09,
+    0x00, 0x06, 0xb3, 0x05, 0x00, 0x01, 0x30, 0x2b, 0x21, 0x23, 0x27, 0x35,
+    0x33, 0x11, 0x33, 0x11, 0x33, 0x15, 0x01, 0x09, 0x1b, 0xcc, 0x6a, 0xdf,
+    0x69, 0xe3, 0x2c, 0x01, 0x6d, 0xfe, 0x93, 0x2c, 0x00, 0x01, 0x00, 0x0a,
+    0x00, 0x43, 0x01, 0xea, 0x01, 0xf5, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x05,
+    0x01, 0x01, 0x30, 0x2b, 0x25, 0x15, 0x23, 0x27, 0x35, 0x37, 0x33, 0x15,
+    0x33, 0x15, 0x01, 0x19, 0x2c, 0xe3, 0xe3, 0x2c, 0xd1, 0xac, 0x69, 0xcb,
+    0x1b, 0xcc, 0x6a, 0xdf, 0x00, 0x01, 0x00, 0x29, 0x00, 0x63, 0x01, 0xca,
+    0x02, 0x05, 0x00, 0x0f, 0x00, 0x06, 0xb3, 0x06, 0x00, 0x01, 0x30, 0x2b,
+    0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0xc0, 0x5f, 0x38, 0x38, 0x5f, 0x39, 0x39, 0x60,
+    0x38, 0x38, 0x60, 0x39, 0x63, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38,
+    0x60, 0x39, 0x39, 0x60, 0x38, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x29,
+    0x00, 0x63, 0x01, 0xca, 0x02, 0x05, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x08,
+    0xb5, 0x16, 0x10, 0x06, 0x00, 0x02, 0x30, 0x2b, 0x36, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
+    0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0xc0, 0x5f, 0x38, 0x38, 0x5f, 0x39, 0x39, 0x60, 0x38,
+    0x38, 0x60, 0x39, 0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2d, 0x4d, 0x2e,
+    0x2e, 0x4d, 0x2d, 0x63, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60,
+    0x39, 0x39, 0x60, 0x38, 0x28, 0x2e, 0x4e, 0x2d, 0x2d, 0x4d, 0x2e, 0x2e,
+    0x4d, 0x2d, 0x2d, 0x4e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0x00, 0x35, 0x01, 0xdb, 0x01, 0xf7, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x01, 0x07, 0x27, 0x37, 0x01, 0xdb, 0xe1, 0xe1,
+    0xe1, 0x01, 0x16, 0xe1, 0xe1, 0xe1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x19,
+    0x00, 0x35, 0x01, 0xdb, 0x01, 0xf7, 0x00, 0x03, 0x00, 0x07, 0x00, 0x08,
+    0xb5, 0x06, 0x04, 0x03, 0x01, 0x02, 0x30, 0x2b, 0x01, 0x07, 0x27, 0x37,
+    0x11, 0x37, 0x27, 0x07, 0x01, 0xdb, 0xe1, 0xe1, 0xe1, 0xa8, 0xa8, 0xa8,
+    0x01, 0x16, 0xe1, 0xe1, 0xe1, 0xfe, 0x77, 0xa8, 0xa8, 0xa8, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x2f, 0x00, 0x00, 0x01, 0xd8, 0x02, 0x81, 0x00, 0x05,
+    0x00, 0x09, 0x00, 0x08, 0xb5, 0x09, 0x07, 0x04, 0x01, 0x02, 0x30, 0x2b,
+    0x13, 0x13, 0x33, 0x13, 0x03, 0x23, 0x13, 0x27, 0x07, 0x17, 0x2f, 0xc4,
+    0x21, 0xc4, 0xc4, 0x21, 0x9e, 0x8d, 0x8e, 0x8e, 0x01, 0x40, 0x01, 0x41,
+    0xfe, 0xbf, 0xfe, 0xc0, 0x01, 0x40, 0xea, 0xea, 0xe8, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x29, 0x00, 0x63, 0x01, 0xca, 0x02, 0x05, 0x00, 0x0f,
+    0x00, 0x1f, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x43, 0x00, 0x0f, 0x40, 0x0c,
+    0x3b, 0x38, 0x30, 0x2c, 0x24, 0x20, 0x16, 0x10, 0x06, 0x00, 0x05, 0x30,
+    0x2b, 0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x23, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x32, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x06, 0x16, 0x17, 0x07,
+    0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x33, 0xc0, 0x5f, 0x38, 0x38,
+    0x5f, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39, 0x2e, 0x4d, 0x2e, 0x2e,
+    0x4d, 0x2e, 0x2d, 0x4d, 0x2e, 0x2e, 0x4d, 0x2d, 0x50, 0x13, 0x13, 0x0c,
+    0x0c, 0x13, 0x13, 0x0c, 0x7e, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x13, 0x0c,
+    0x27, 0x38, 0x14, 0x14, 0x29, 0x2d, 0x19, 0x2b, 0x0e, 0x1a, 0x2e, 0x3e,
+    0x63, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39, 0x39, 0x60,
+    0x38, 0x28, 0x2e, 0x4e, 0x2d, 0x2d, 0x4d, 0x2e, 0x2e, 0x4d, 0x2d, 0x2d,
+    0x4e, 0x2e, 0xb3, 0x13, 0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x13,
+    0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x1f, 0x1f, 0x1a, 0x1f, 0x33,
+    0x1c, 0x17, 0x21, 0x37, 0x00, 0x05, 0x00, 0x29, 0x00, 0x63, 0x01, 0xca,
+    0x02, 0x05, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2b, 0x00, 0x37, 0x00, 0x43,
+    0x00, 0x0f, 0x40, 0x0c, 0x3a, 0x38, 0x30, 0x2c, 0x24, 0x20, 0x16, 0x10,
+    0x06, 0x00, 0x05, 0x30, 0x2b, 0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x3e, 0x02, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x32, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x06, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x37, 0x17, 0x06, 0x06, 0x23,
+    0xc0, 0x5f, 0x38, 0x38, 0x5f, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39,
+    0x2e, 0x4d, 0x2e, 0x2e, 0x4d, 0x2e, 0x2d, 0x4d, 0x2e, 0x2e, 0x4d, 0x2d,
+    0x50, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x7e, 0x13, 0x13, 0x0c,
+    0x0c, 0x13, 0x13, 0x0c, 0x83, 0x2e, 0x1a, 0x0e, 0x2b, 0x19, 0x2e, 0x28,
+    0x14, 0x14, 0x38, 0x1e, 0x63, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38,
+    0x60, 0x39, 0x39, 0x60, 0x38, 0x28, 0x2e, 0x4e, 0x2d, 0x2d, 0x4d, 0x2e,
+    0x2e, 0x4d, 0x2d, 0x2d, 0x4e, 0x2e, 0xb3, 0x13, 0x0c, 0x0c, 0x13, 0x13,
+    0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x81,
+    0x37, 0x21, 0x17, 0x1c, 0x33, 0x1f, 0x1a, 0x1f, 0x00, 0x04, 0x00, 0x28,
+    0x00, 0x63, 0x01, 0xc9, 0x02, 0x05, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x27,
+    0x00, 0x33, 0x00, 0x0d, 0x40, 0x0a, 0x2b, 0x28, 0x20, 0x1c, 0x14, 0x10,
+    0x06, 0x00, 0x04, 0x30, 0x2b, 0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x26, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x06, 0x36, 0x37,
+    0x27, 0x06, 0x23, 0x22, 0x26, 0x27, 0x07, 0x16, 0x33, 0xbf, 0x5f, 0x38,
+    0x38, 0x5f, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39, 0x38, 0x13, 0x13,
+    0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x96, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x13,
+    0x0c, 0x27, 0x38, 0x14, 0x14, 0x28, 0x2e, 0x19, 0x2b, 0x0e, 0x1a, 0x2e,
+    0x3e, 0x63, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39, 0x39,
+    0x60, 0x38, 0xdb, 0x13, 0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x13,
+    0x0c, 0x0c, 0x13, 0x13, 0x0c, 0x0c, 0x13, 0x81, 0x1f, 0x1a, 0x1f, 0x33,
+    0x1c, 0x17, 0x21, 0x37, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x01, 0xe7,
+    0x02, 0x59, 0x00, 0x22, 0x00, 0x06, 0xb3, 0x1a, 0x08, 0x01, 0x30, 0x2b,
+    0x24, 0x06, 0x23, 0x22, 0x27, 0x16, 0x16, 0x17, 0x17, 0x21, 0x37, 0x36,
+    0x36, 0x37, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x3e,
+    0x02, 0x35, 0x33, 0x16, 0x16, 0x17, 0x1e, 0x02, 0x15, 0x01, 0xe7, 0x3e,
+    0x2d, 0x44, 0x29, 0x0c, 0x4c, 0x47, 0x03, 0xfe, 0x92, 0x03, 0x4c, 0x4c,
+    0x0b, 0x2b, 0x46, 0x2d, 0x3e, 0x1f, 0x2c, 0x25, 0x23, 0x2a, 0x1c, 0x28,
+    0x03, 0x35, 0x32, 0x25, 0x2c, 0x1e, 0xc7, 0x41, 0x23, 0x4a, 0x49, 0x04,
+    0x12, 0x12, 0x03, 0x49, 0x4e, 0x26, 0x41, 0x34, 0x2c, 0x42, 0x2d, 0x1e,
+    0x1c, 0x29, 0x3a, 0x26, 0x35, 0x46, 0x29, 0x1e, 0x2d, 0x43, 0x2c, 0x00,
+    0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x01, 0xef, 0x02, 0x49, 0x00, 0x29,
+    0x00, 0x06, 0xb3, 0x21, 0x0d, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x22, 0x27, 0x16, 0x16, 0x17, 0x17, 0x23, 0x37,
+    0x36, 0x36, 0x37, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x33, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x07, 0x33, 0x01, 0x92, 0x3b, 0x22, 0x22, 0x3b, 0x22, 0x2f, 0x23, 0x03,
+    0x1a, 0x1a, 0x03, 0xbc, 0x03, 0x1a, 0x1a, 0x03, 0x23, 0x2e, 0x35, 0x4b,
+    0x22, 0x3b, 0x23, 0x05, 0x10, 0x22, 0x3b, 0x23, 0x22, 0x3b, 0x22, 0x10,
+    0x07, 0x01, 0x8b, 0x22, 0x3b, 0x22, 0x23, 0x3b, 0x22, 0x1e, 0x4d, 0x48,
+    0x03, 0x12, 0x12, 0x03, 0x48, 0x4c, 0x1d, 0x4b, 0x35, 0x22, 0x3b, 0x22,
+    0x1d, 0x22, 0x22, 0x3b, 0x22, 0x22, 0x3b, 0x22, 0x22, 0x1d, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0c, 0x00, 0x00, 0x01, 0xe8, 0x02, 0x4f, 0x00, 0x1d,
+    0x00, 0x06, 0xb3, 0x0a, 0x00, 0x01, 0x30, 0x2b, 0x00, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x0e, 0x02, 0x15, 0x23, 0x34, 0x26, 0x26, 0x27, 0x2e,
+    0x02, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x33, 0x34, 0x36, 0x33,
+    0x01, 0xa6, 0x42, 0x1e, 0x2d, 0x24, 0x24, 0x2a, 0x1d, 0x28, 0x1d, 0x2a,
+    0x24, 0x24, 0x2d, 0x1e, 0x42, 0x30, 0x35, 0x42, 0x0a, 0x48, 0x2f, 0x02,
+    0x4f, 0x47, 0x35, 0x35, 0x54, 0x3e, 0x2a, 0x29, 0x3b, 0x4e, 0x30, 0x30,
+    0x4e, 0x3b, 0x29, 0x2a, 0x3e, 0x54, 0x35, 0x35, 0x47, 0x3c, 0x36, 0x34,
+    0x3e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x02, 0x01, 0xe5,
+    0x02, 0x59, 0x00, 0x07, 0x00, 0x06, 0xb3, 0x03, 0x00, 0x01, 0x30, 0x2b,
+    0x01, 0x13, 0x15, 0x03, 0x23, 0x03, 0x35, 0x13, 0x01, 0x0e, 0xd7, 0xd7,
+    0x1e, 0xe1, 0xe1, 0x02, 0x59, 0xfe, 0xe8, 0x1e, 0xfe, 0xdf, 0x01, 0x21,
+    0x1e, 0x01, 0x18, 0x00, 0x00, 0x01, 0x00, 0x09, 0xff, 0xf0, 0x01, 0xd6,
+    0x02, 0x77, 0x00, 0x09, 0x00, 0x06, 0xb3, 0x09, 0x03, 0x01, 0x30, 0x2b,
+    0x01, 0x06, 0x02, 0x07, 0x27, 0x37, 0x17, 0x36, 0x12, 0x37, 0x01, 0xd6,
+    0x29, 0xa8, 0x64, 0x98, 0x3d, 0x5b, 0x49, 0x6b, 0x21, 0x02, 0x59, 0xba,
+    0xfe, 0xc3, 0x72, 0xa9, 0x34, 0x6b, 0x66, 0x01, 0x00, 0xaf, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf2, 0x02, 0x79, 0x00, 0x0a,
+    0x00, 0x06, 0xb3, 0x0a, 0x03, 0x01, 0x30, 0x2b, 0x01, 0x06, 0x02, 0x07,
+    0x27, 0x27, 0x37, 0x17, 0x36, 0x36, 0x37, 0x01, 0xf2, 0x37, 0xbc, 0x74,
+    0x5a, 0x31, 0x68, 0x21, 0x4b, 0x89, 0x2a, 0x02, 0x52, 0xbc, 0xfe, 0xd7,
+    0x6d, 0x30, 0xf3, 0x17, 0xab, 0x5c, 0xfa, 0x94, 0xff, 0xff, 0x00, 0x55,
+    0x00, 0x91, 0x01, 0xae, 0x01, 0xf7, 0x00, 0x02, 0x02, 0x70, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x01, 0xf4, 0x02, 0x75, 0x00, 0x13,
+    0x00, 0x06, 0xb3, 0x0e, 0x08, 0x01, 0x30, 0x2b, 0x00, 0x07, 0x16, 0x17,
+    0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x37, 0x16,
+    0x17, 0x36, 0x37, 0x17, 0x01, 0x8e, 0x59, 0x36, 0x4e, 0x45, 0x4a, 0x35,
+    0x4f, 0x61, 0x45, 0x5b, 0x7a, 0x2a, 0x1a, 0x54, 0x18, 0x1d, 0x4a, 0x61,
+    0x2f, 0x01, 0xb5, 0x66, 0x92, 0x6b, 0x44, 0x6e, 0x85, 0x62, 0x93, 0x39,
+    0x87, 0x8a, 0x7e, 0x88, 0x19, 0x7a, 0x5b, 0x4e, 0x5e, 0x39, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0xff, 0xfd, 0x02, 0x10, 0x02, 0x91, 0x00, 0x13,
+    0x00, 0x06, 0xb3, 0x0e, 0x04, 0x01, 0x30, 0x2b, 0x00, 0x07, 0x16, 0x17,
+    0x07, 0x26, 0x27, 0x06, 0x07, 0x27, 0x36, 0x37, 0x26, 0x27, 0x37, 0x16,
+    0x17, 0x36, 0x37, 0x17, 0x01, 0xa0, 0x59, 0x37, 0x4d, 0x55, 0x4c, 0x38,
+    0x41, 0x4f, 0x5e, 0x68, 0x56, 0x2a, 0x1e, 0x70, 0x16, 0x1e, 0x4f, 0x5a,
+    0x49, 0x01, 0xad, 0x68, 0x89, 0x73, 0x4c, 0x5f, 0x7c, 0x56, 0x7c, 0x53,
+    0x92, 0x68, 0x76, 0xa0, 0x28, 0x73, 0x62, 0x56, 0x4f, 0x4f, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x1f, 0xff, 0xf5, 0x01, 0xd1, 0x02, 0x79, 0x00, 0x28,
+    0x00, 0x33, 0x00, 0xef, 0x4b, 0xb0, 0x1d, 0x50, 0x58, 0x40, 0x16, 0x18,
+    0x01, 0x07, 0x03, 0x2b, 0x01, 0x08, 0x07, 0x0e, 0x01, 0x01, 0x08, 0x25,
+    0x01, 0x05, 0x01, 0x26, 0x01, 0x06, 0x05, 0x05, 0x4a, 0x1b, 0x40, 0x16,
+    0x18, 0x01, 0x07, 0x03, 0x2b, 0x01, 0x08, 0x07, 0x0e, 0x01, 0x01, 0x08,
+    0x25, 0x01, 0x05, 0x02, 0x26, 0x01, 0x06, 0x05, 0x05, 0x4a, 0x59, 0x4b,
+    0xb0, 0x1d, 0x50, 0x58, 0x40, 0x2a, 0x0a, 0x01, 0x08, 0x02, 0x01, 0x01,
+    0x05, 0x08, 0x01, 0x67, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+    0x1c, 0x4b, 0x00, 0x07, 0x07, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x17, 0x4b,
+    0x00, 0x05, 0x05, 0x06, 0x5f, 0x09, 0x01, 0x06, 0x06, 0x1d, 0x06, 0x4c,
+    0x1b, 0x4b, 0xb0, 0x2a, 0x50, 0x58, 0x40, 0x31, 0x00, 0x01, 0x08, 0x02,
+    0x08, 0x01, 0x02, 0x7e, 0x0a, 0x01, 0x08, 0x00, 0x02, 0x05, 0x08, 0x02,
+    0x67, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00,
+    0x07, 0x07, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x17, 0x4b, 0x00, 0x05, 0x05,
+    0x06, 0x5f, 0x09, 0x01, 0x06, 0x06, 0x1d, 0x06, 0x4c, 0x1b, 0x40, 0x2f,
+    0x00, 0x01, 0x08, 0x02, 0x08, 0x01, 0x02, 0x7e, 0x00, 0x03, 0x00, 0x07,
+    0x08, 0x03, 0x07, 0x67, 0x0a, 0x01, 0x08, 0x00, 0x02, 0x05, 0x08, 0x02,
+    0x67, 0x00, 0x04, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x00,
+    0x05, 0x05, 0x06, 0x5f, 0x09, 0x01, 0x06, 0x06, 0x1d, 0x06, 0x4c, 0x59,
+    0x59, 0x40, 0x17, 0x29, 0x29, 0x00, 0x00, 0x29, 0x33, 0x29, 0x32, 0x2e,
+    0x2c, 0x00, 0x28, 0x00, 0x27, 0x26, 0x23, 0x24, 0x22, 0x14, 0x26, 0x0b,
+    0x07, 0x1a, 0x2b, 0x16, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x15, 0x23, 0x35, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x17, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x37, 0x17, 0x06, 0x23, 0x36, 0x36, 0x35, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xe2, 0x79, 0x4a, 0x46, 0x6e,
+    0x3c, 0x33, 0x59, 0x36, 0x3c, 0x27, 0x3a, 0x39, 0x4c, 0x66, 0x5f, 0x14,
+    0x0a, 0x49, 0x3d, 0x31, 0x52, 0x30, 0x3c, 0x61, 0x37, 0x3a, 0x31, 0x1b,
+    0x41, 0x4b, 0x45, 0x29, 0x18, 0x0a, 0x41, 0x45, 0x29, 0x27, 0x0b, 0x48,
+    0x92, 0x6a, 0x69, 0x90, 0x47, 0x33, 0x66, 0x48, 0xe9, 0x26, 0x2e, 0x4b,
+    0x39, 0x41, 0x51, 0x01, 0x3a, 0x4d, 0x38, 0x73, 0x54, 0x5b, 0x7d, 0x3e,
+    0x21, 0x31, 0x29, 0xe9, 0x4e, 0x5e, 0x02, 0x31, 0x2c, 0x26, 0x2b, 0x00,
+    0x00, 0x03, 0x00, 0x24, 0xff, 0xf4, 0x01, 0xe1, 0x02, 0x75, 0x00, 0x22,
+    0x00, 0x2d, 0x00, 0x36, 0x00, 0x3d, 0x40, 0x3a, 0x30, 0x2f, 0x2d, 0x20,
+    0x1e, 0x1d, 0x1b, 0x18, 0x17, 0x0a, 0x0a, 0x03, 0x02, 0x21, 0x01, 0x00,
+    0x03, 0x02, 0x4a, 0x22, 0x01, 0x00, 0x47, 0x00, 0x02, 0x02, 0x01, 0x5f,
+    0x00, 0x01, 0x01, 0x1c, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x1d, 0x00, 0x4c, 0x2e, 0x2e, 0x2e, 0x36, 0x2e, 0x35, 0x29,
+    0x27, 0x2b, 0x22, 0x05, 0x07, 0x16, 0x2b, 0x25, 0x06, 0x06, 0x23, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x17, 0x36, 0x36, 0x37, 0x34,
+    0x37, 0x17, 0x06, 0x07, 0x17, 0x07, 0x02, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x22, 0x06, 0x15, 0x14, 0x17, 0x12, 0x37, 0x27, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0x01, 0x69, 0x1f, 0x5a, 0x30, 0x2c, 0x48, 0x28, 0x44, 0x3a,
+    0x47, 0x25, 0x3f, 0x25, 0x27, 0x3e, 0x22, 0x3d, 0x2f, 0x70, 0x18, 0x13,
+    0x02, 0x04, 0x41, 0x25, 0x27, 0x46, 0x3b, 0xa0, 0x29, 0x29, 0x1b, 0x1d,
+    0x28, 0x3d, 0x2a, 0x3d, 0x7f, 0x27, 0x2e, 0x33, 0x24, 0x4c, 0x28, 0x2e,
+    0x29, 0x45, 0x29, 0x3e, 0x6b, 0x21, 0x56, 0x45, 0x25, 0x3c, 0x22, 0x25,
+    0x3c, 0x22, 0x31, 0x62, 0x15, 0x9d, 0x1d, 0x2b, 0x1d, 0x06, 0x04, 0x2d,
+    0x41, 0x33, 0x5b, 0x2c, 0x01, 0x92, 0x44, 0x22, 0x21, 0x2d, 0x29, 0x20,
+    0x30, 0x4c, 0xfe, 0xc1, 0x45, 0xad, 0x18, 0x50, 0x28, 0x29, 0x39, 0x00,
+    0x00, 0x01, 0x00, 0x40, 0xff, 0xbc, 0x01, 0xb4, 0x02, 0x99, 0x00, 0x0e,
+    0x00, 0x23, 0x40, 0x20, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x02, 0x7e,
+    0x04, 0x01, 0x02, 0x02, 0x82, 0x00, 0x03, 0x03, 0x01, 0x5d, 0x00, 0x01,
+    0x01, 0x16, 0x03, 0x4c, 0x11, 0x11, 0x11, 0x25, 0x10, 0x05, 0x07, 0x19,
+    0x2b, 0x13, 0x2e, 0x02, 0x35, 0x34, 0x36, 0x33, 0x33, 0x11, 0x23, 0x11,
+    0x23, 0x11, 0x23, 0xf3, 0x31, 0x52, 0x30, 0x76, 0x81, 0x7d, 0x3a, 0x4c,
+    0x3b, 0x01, 0x42, 0x02, 0x32, 0x51, 0x2f, 0x48, 0x5b, 0xfd, 0x23, 0x02,
+    0xa4, 0xfd, 0x5c, 0x00, 0x00, 0x02, 0x00, 0x41, 0xff, 0xca, 0x01, 0xa2,
+    0x02, 0xa0, 0x00, 0x37, 0x00, 0x46, 0x00, 0x56, 0x40, 0x0c, 0x3d, 0x31,
+    0x1f, 0x1e, 0x15, 0x03, 0x02, 0x07, 0x00, 0x02, 0x01, 0x4a, 0x4b, 0xb0,
+    0x2a, 0x50, 0x58, 0x40, 0x13, 0x00, 0x00, 0x04, 0x01, 0x03, 0x00, 0x03,
+    0x63, 0x00, 0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x16, 0x02, 0x4c,
+    0x1b, 0x40, 0x19, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x02, 0x67, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x04, 0x01,
+    0x03, 0x00, 0x03, 0x4f, 0x59, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x37, 0x00,
+    0x36, 0x25, 0x23, 0x1c, 0x1a, 0x28, 0x05, 0x07, 0x15, 0x2b, 0x16, 0x26,
+    0x27, 0x37, 0x1e, 0x02, 0x17, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+    0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x17, 0x17, 0x16, 0x15, 0x14, 0x06, 0x07, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x23, 0x12, 0x35, 0x34, 0x26, 0x27, 0x27, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x17, 0x17, 0x16, 0x17, 0xba, 0x5b, 0x1e, 0x34,
+    0x07, 0x03, 0x0a, 0x11, 0x20, 0x30, 0x2f, 0x38, 0x31, 0x44, 0x4d, 0x40,
+    0x2d, 0x25, 0x43, 0x2b, 0x4b, 0x2d, 0x31, 0x53, 0x18, 0x39, 0x04, 0x02,
+    0x04, 0x36, 0x24, 0x25, 0x34, 0x1b, 0x34, 0x38, 0x18, 0x5c, 0x29, 0x21,
+    0x40, 0x2c, 0x4e, 0x30, 0x69, 0x2f, 0x38, 0x2b, 0x14, 0x19, 0x31, 0x37,
+    0x14, 0x1b, 0x04, 0x36, 0x2c, 0x29, 0x3d, 0x02, 0x0f, 0x12, 0x10, 0x1d,
+    0x2d, 0x22, 0x23, 0x2a, 0x14, 0x19, 0x3a, 0x2d, 0x21, 0x37, 0x0d, 0x28,
+    0x49, 0x26, 0x41, 0x27, 0x2f, 0x2a, 0x32, 0x04, 0x07, 0x1b, 0x2a, 0x2d,
+    0x20, 0x1b, 0x22, 0x1a, 0x15, 0x09, 0x2c, 0x46, 0x1e, 0x35, 0x0d, 0x2b,
+    0x44, 0x2b, 0x46, 0x27, 0x01, 0x2e, 0x2c, 0x20, 0x29, 0x13, 0x0f, 0x07,
+    0x22, 0x16, 0x21, 0x2b, 0x10, 0x06, 0x08, 0x02, 0x00, 0x03, 0x00, 0x0e,
+    0x00, 0x13, 0x01, 0xf2, 0x02, 0x12, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x3e,
+    0x00, 0x5e, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x53, 0x3b, 0x3a, 0x2b, 0x2a,
+    0x04, 0x06, 0x05, 0x01, 0x4a, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x02,
+    0x67, 0x00, 0x04, 0x00, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x06, 0x0a,
+    0x01, 0x07, 0x03, 0x06, 0x07, 0x67, 0x09, 0x01, 0x03, 0x01, 0x01, 0x03,
+    0x57, 0x09, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x08, 0x01, 0x01, 0x03, 0x01,
+    0x4f, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x20, 0x3e, 0x20, 0x3d, 0x38,
+    0x36, 0x32, 0x30, 0x28, 0x26, 0x10, 0x1f, 0x10, 0x1e, 0x18, 0x16, 0x00,
+    0x0f, 0x00, 0x0e, 0x26, 0x0b, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x07, 0x06, 0x23, 0x3e, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x2e, 0x02, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2e, 0x02, 0x27, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23,
+    0xbe, 0x6f, 0x41, 0x41, 0x70, 0x41, 0x41, 0x6f, 0x42, 0x48, 0x47, 0x64,
+    0x37, 0x5b, 0x36, 0x35, 0x5b, 0x36, 0x36, 0x5b, 0x35, 0x35, 0x5b, 0x36,
+    0x24, 0x43, 0x27, 0x28, 0x41, 0x22, 0x35, 0x46, 0x0a, 0x34, 0x04, 0x01,
+    0x09, 0x13, 0x10, 0x18, 0x21, 0x3a, 0x37, 0x27, 0x18, 0x28, 0x0b, 0x2c,
+    0x15, 0x42, 0x24, 0x13, 0x45, 0x75, 0x45, 0x45, 0x76, 0x45, 0x45, 0x76,
+    0x45, 0x6a, 0x4b, 0x4a, 0x2b, 0x3a, 0x62, 0x39, 0x39, 0x62, 0x3a, 0x39,
+    0x62, 0x3b, 0x3a, 0x61, 0x39, 0x3c, 0x2a, 0x47, 0x29, 0x29, 0x44, 0x27,
+    0x32, 0x2b, 0x13, 0x06, 0x12, 0x0f, 0x0d, 0x0a, 0x2f, 0x2e, 0x2c, 0x3f,
+    0x18, 0x15, 0x1d, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0e,
+    0x00, 0x13, 0x01, 0xf2, 0x02, 0x12, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x2d,
+    0x00, 0x34, 0x00, 0x6d, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x62, 0x2b, 0x01,
+    0x04, 0x07, 0x2c, 0x01, 0x05, 0x04, 0x2d, 0x01, 0x03, 0x05, 0x03, 0x4a,
+    0x00, 0x05, 0x04, 0x03, 0x04, 0x05, 0x03, 0x7e, 0x00, 0x00, 0x00, 0x02,
+    0x06, 0x00, 0x02, 0x67, 0x00, 0x06, 0x00, 0x08, 0x07, 0x06, 0x08, 0x67,
+    0x0b, 0x01, 0x07, 0x00, 0x04, 0x05, 0x07, 0x04, 0x65, 0x0a, 0x01, 0x03,
+    0x01, 0x01, 0x03, 0x57, 0x0a, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x09, 0x01,
+    0x01, 0x03, 0x01, 0x4f, 0x2f, 0x2e, 0x10, 0x10, 0x00, 0x00, 0x33, 0x31,
+    0x2e, 0x34, 0x2f, 0x34, 0x26, 0x24, 0x23, 0x22, 0x21, 0x20, 0x10, 0x1f,
+    0x10, 0x1e, 0x18, 0x16, 0x00, 0x0f, 0x00, 0x0e, 0x26, 0x0c, 0x07, 0x15,
+    0x2b, 0xb1, 0x06, 0x00, 0x44, 0x36, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x07, 0x06, 0x23, 0x3e, 0x02, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
+    0x37, 0x23, 0x15, 0x23, 0x11, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x17, 0x07, 0x27, 0x32, 0x35, 0x34, 0x23, 0x23, 0x15, 0xbe, 0x6f, 0x41,
+    0x41, 0x70, 0x41, 0x41, 0x6f, 0x42, 0x48, 0x47, 0x64, 0x37, 0x5b, 0x36,
+    0x35, 0x5b, 0x36, 0x36, 0x5b, 0x35, 0x35, 0x5b, 0x36, 0x0a, 0x42, 0x2e,
+    0x5e, 0x3e, 0x3a, 0x1e, 0x1b, 0x40, 0x2f, 0x4c, 0x47, 0x4a, 0x31, 0x13,
+    0x45, 0x75, 0x45, 0x45, 0x76, 0x45, 0x45, 0x76, 0x45, 0x6a, 0x4b, 0x4a,
+    0x2b, 0x3a, 0x62, 0x39, 0x39, 0x62, 0x3a, 0x39, 0x62, 0x3b, 0x3a, 0x61,
+    0x39, 0xc2, 0x7b, 0x01, 0x24, 0x2e, 0x27, 0x1a, 0x2b, 0x08, 0x7d, 0x07,
+    0xa5, 0x2c, 0x2c, 0x58, 0x00, 0x02, 0x00, 0x12, 0x01, 0x40, 0x01, 0xe3,
+    0x02, 0x7b, 0x00, 0x07, 0x00, 0x14, 0x00, 0x08, 0xb5, 0x0d, 0x08, 0x06,
+    0x02, 0x02, 0x30, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x15, 0x23, 0x11, 0x23,
+    0x13, 0x33, 0x17, 0x37, 0x33, 0x11, 0x23, 0x35, 0x07, 0x27, 0x27, 0x15,
+    0x23, 0x68, 0x56, 0xdd, 0x5a, 0x2d, 0xa4, 0x23, 0x48, 0x4b, 0x21, 0x2a,
+    0x3c, 0x10, 0x37, 0x2a, 0x02, 0x53, 0x28, 0x28, 0xfe, 0xed, 0x01, 0x3b,
+    0x91, 0x91, 0xfe, 0xc5, 0xd7, 0x6c, 0x01, 0x6b, 0xd7, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x79, 0x01, 0x72, 0x01, 0x87, 0x02, 0x7f, 0x00, 0x0f,
+    0x00, 0x1b, 0x00, 0x38, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x2d, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x05, 0x01, 0x03, 0x01, 0x01, 0x03,
+    0x57, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x03, 0x01,
+    0x4f, 0x10, 0x10, 0x00, 0x00, 0x10, 0x1b, 0x10, 0x1a, 0x16, 0x14, 0x00,
+    0x0f, 0x00, 0x0e, 0x26, 0x06, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x12, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x33, 0xdb, 0x3e, 0x24, 0x25, 0x3e, 0x24, 0x24, 0x3e,
+    0x25, 0x24, 0x3e, 0x25, 0x20, 0x2b, 0x2b, 0x1f, 0x1f, 0x2c, 0x2b, 0x1f,
+    0x01, 0x72, 0x24, 0x3d, 0x25, 0x25, 0x3e, 0x24, 0x25, 0x3e, 0x24, 0x24,
+    0x3d, 0x25, 0x37, 0x2f, 0x21, 0x20, 0x31, 0x31, 0x20, 0x20, 0x30, 0x00,
+    0x00, 0x01, 0x00, 0xd9, 0xff, 0x69, 0x01, 0x1c, 0x02, 0x8c, 0x00, 0x03,
+    0x00, 0x28, 0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x0b, 0x00, 0x00, 0x00,
+    0x16, 0x4b, 0x00, 0x01, 0x01, 0x19, 0x01, 0x4c, 0x1b, 0x40, 0x0b, 0x00,
+    0x01, 0x00, 0x01, 0x84, 0x00, 0x00, 0x00, 0x16, 0x00, 0x4c, 0x59, 0xb4,
+    0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0x13, 0x33, 0x11, 0x23, 0xd9, 0x43,
+    0x43, 0x02, 0x8c, 0xfc, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xd9,
+    0xff, 0x69, 0x01, 0x1c, 0x02, 0x8c, 0x00, 0x03, 0x00, 0x07, 0x00, 0x3b,
+    0x4b, 0xb0, 0x1f, 0x50, 0x58, 0x40, 0x15, 0x00, 0x01, 0x01, 0x00, 0x5d,
+    0x00, 0x00, 0x00, 0x16, 0x4b, 0x00, 0x02, 0x02, 0x03, 0x5d, 0x00, 0x03,
+    0x03, 0x19, 0x03, 0x4c, 0x1b, 0x40, 0x12, 0x00, 0x02, 0x00, 0x03, 0x02,
+    0x03, 0x61, 0x00, 0x01, 0x01, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x16, 0x01,
+    0x4c, 0x59, 0xb6, 0x11, 0x11, 0x11, 0x10, 0x04, 0x07, 0x18, 0x2b, 0x13,
+    0x33, 0x11, 0x23, 0x15, 0x33, 0x11, 0x23, 0xd9, 0x43, 0x43, 0x43, 0x43,
+    0x02, 0x8c, 0xfe, 0x9b, 0x63, 0xfe, 0xa5, 0x00, 0x00, 0x01, 0x00, 0x31,
+    0xff, 0x69, 0x01, 0xc2, 0x02, 0x8c, 0x00, 0x0b, 0x00, 0x45, 0x4b, 0xb0,
+    0x1f, 0x50, 0x58, 0x40, 0x17, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x04, 0x01,
+    0x00, 0x00, 0x01, 0x5d, 0x03, 0x01, 0x01, 0x01, 0x17, 0x4b, 0x00, 0x05,
+    0x05, 0x19, 0x05, 0x4c, 0x1b, 0x40, 0x17, 0x00, 0x05, 0x00, 0x05, 0x84,
+    0x00, 0x02, 0x02, 0x16, 0x4b, 0x04, 0x01, 0x00, 0x00, 0x01, 0x5d, 0x03,
+    0x01, 0x01, 0x01, 0x17, 0x00, 0x4c, 0x59, 0x40, 0x09, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x10, 0x06, 0x07, 0x1a, 0x2b, 0x13, 0x23, 0x35, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x23, 0xd9, 0xa8, 0xa8, 0x43, 0xa6,
+    0xa6, 0x43, 0x01, 0x8d, 0x3c, 0xc3, 0xc3, 0x3c, 0xfd, 0xdc, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x17, 0xff, 0xf8, 0x01, 0xad, 0x02, 0xa9, 0x00, 0x1c,
+    0x00, 0x23, 0x00, 0x08, 0xb5, 0x21, 0x1d, 0x12, 0x05, 0x02, 0x30, 0x2b,
+    0x24, 0x36, 0x37, 0x33, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x06,
+    0x07, 0x35, 0x36, 0x37, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x07, 0x15, 0x14, 0x16, 0x33, 0x12, 0x23, 0x22, 0x15, 0x15, 0x36, 0x35,
+    0x01, 0x41, 0x25, 0x03, 0x44, 0x04, 0x49, 0x55, 0x4b, 0x4b, 0x3b, 0x23,
+    0x38, 0x26, 0x4b, 0x48, 0x46, 0x48, 0xcf, 0x28, 0x29, 0x31, 0x41, 0x41,
+    0x82, 0x34, 0x3a, 0x37, 0x55, 0x58, 0x5d, 0x52, 0x43, 0x15, 0x08, 0x3c,
+    0x0f, 0x0f, 0xdf, 0x50, 0x53, 0x50, 0x4d, 0xb7, 0x52, 0x59, 0x3e, 0x38,
+    0x02, 0x3c, 0x5e, 0xd0, 0x40, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x31,
+    0xff, 0x69, 0x01, 0xc2, 0x02, 0x8c, 0x00, 0x13, 0x00, 0x5e, 0x4b, 0xb0,
+    0x1f, 0x50, 0x58, 0x40, 0x21, 0x07, 0x01, 0x01, 0x08, 0x01, 0x00, 0x09,
+    0x01, 0x00, 0x65, 0x00, 0x04, 0x04, 0x16, 0x4b, 0x06, 0x01, 0x02, 0x02,
+    0x03, 0x5d, 0x05, 0x01, 0x03, 0x03, 0x17, 0x4b, 0x00, 0x09, 0x09, 0x19,
+    0x09, 0x4c, 0x1b, 0x40, 0x21, 0x00, 0x09, 0x00, 0x09, 0x84, 0x07, 0x01,
+    0x01, 0x08, 0x01, 0x00, 0x09, 0x01, 0x00, 0x65, 0x00, 0x04, 0x04, 0x16,
+    0x4b, 0x06, 0x01, 0x02, 0x02, 0x03, 0x5d, 0x05, 0x01, 0x03, 0x03, 0x17,
+    0x02, 0x4c, 0x59, 0x40, 0x0e, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x10, 0x0a, 0x07, 0x1d, 0x2b, 0x37, 0x23, 0x35, 0x33,
+    0x11, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x15, 0x23, 0x11, 0x33,
+    0x15, 0x23, 0x15, 0x23, 0xd9, 0xa8, 0xa8, 0xa8, 0xa8, 0x43, 0xa6, 0xa6,
+    0xa6, 0xa6, 0x43, 0x3d, 0x3c, 0x01, 0x14, 0x3c, 0xc3, 0xc3, 0x3c, 0xfe,
+    0xec, 0x3c, 0xd4, 0x00, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x01, 0xd2,
+    0x02, 0x7a, 0x00, 0x0b, 0x00, 0x18, 0x00, 0x24, 0x00, 0x28, 0x00, 0xee,
+    0x40, 0x0a, 0x13, 0x01, 0x01, 0x06, 0x18, 0x01, 0x03, 0x09, 0x02, 0x4a,
+    0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40, 0x27, 0x00, 0x08, 0x00, 0x09, 0x03,
+    0x08, 0x09, 0x65, 0x0b, 0x01, 0x07, 0x07, 0x00, 0x5d, 0x05, 0x02, 0x02,
+    0x00, 0x00, 0x14, 0x4b, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x5f, 0x00, 0x06,
+    0x06, 0x1f, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x1b, 0x4b,
+    0xb0, 0x10, 0x50, 0x58, 0x40, 0x2b, 0x00, 0x08, 0x00, 0x09, 0x03, 0x08,
+    0x09, 0x65, 0x05, 0x01, 0x02, 0x02, 0x14, 0x4b, 0x0b, 0x01, 0x07, 0x07,
+    0x00, 0x5f, 0x00, 0x00, 0x00, 0x1c, 0x4b, 0x0a, 0x01, 0x01, 0x01, 0x06,
+    0x5f, 0x00, 0x06, 0x06, 0x1f, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x15, 0x03,
+    0x4c, 0x1b, 0x4b, 0xb0, 0x17, 0x50, 0x58, 0x40, 0x27, 0x00, 0x08, 0x00,
+    0x09, 0x03, 0x08, 0x09, 0x65, 0x0b, 0x01, 0x07, 0x07, 0x00, 0x5d, 0x05,
+    0x02, 0x02, 0x00, 0x00, 0x14, 0x4b, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x5f,
+    0x00, 0x06, 0x06, 0x1f, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x15, 0x03, 0x4c,
+    0x1b, 0x40, 0x2b, 0x00, 0x08, 0x00, 0x09, 0x03, 0x08, 0x09, 0x65, 0x05,
+    0x01, 0x02, 0x02, 0x14, 0x4b, 0x0b, 0x01, 0x07, 0x07, 0x00, 0x5f, 0x00,
+    0x00, 0x00, 0x1c, 0x4b, 0x0a, 0x01, 0x01, 0x01, 0x06, 0x5f, 0x00, 0x06,
+    0x06, 0x1f, 0x4b, 0x04, 0x01, 0x03, 0x03, 0x15, 0x03, 0x4c, 0x59, 0x59,
+    0x59, 0x40, 0x1e, 0x19, 0x19, 0x00, 0x00, 0x28, 0x27, 0x26, 0x25, 0x19,
+    0x24, 0x19, 0x23, 0x1f, 0x1d, 0x17, 0x16, 0x15, 0x14, 0x12, 0x11, 0x0d,
+    0x0c, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x0c, 0x07, 0x15, 0x2b, 0x00, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x27, 0x33,
+    0x14, 0x06, 0x15, 0x11, 0x23, 0x03, 0x11, 0x23, 0x11, 0x33, 0x13, 0x12,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x07,
+    0x33, 0x15, 0x23, 0x01, 0x59, 0x30, 0x33, 0x23, 0x24, 0x2f, 0x32, 0x24,
+    0xb5, 0x43, 0x07, 0x30, 0x65, 0x3e, 0x3f, 0x58, 0xa4, 0x1a, 0x1a, 0x12,
+    0x13, 0x19, 0x19, 0x12, 0x55, 0xa9, 0xa9, 0x01, 0xad, 0x38, 0x2c, 0x2e,
+    0x3b, 0x36, 0x2f, 0x30, 0x38, 0xc2, 0x03, 0x10, 0x08, 0xfd, 0xac, 0x01,
+    0xb2, 0xfe, 0x4e, 0x02, 0x6f, 0xfe, 0x6f, 0x01, 0x73, 0x22, 0x1c, 0x1c,
+    0x20, 0x20, 0x1c, 0x1c, 0x22, 0xc4, 0x2a, 0x00, 0x00, 0x02, 0x00, 0x19,
+    0xff, 0xf9, 0x01, 0xdf, 0x01, 0xdd, 0x00, 0x17, 0x00, 0x1f, 0x00, 0x08,
+    0xb5, 0x1e, 0x1a, 0x06, 0x00, 0x02, 0x30, 0x2b, 0x16, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x21, 0x15, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x13, 0x26, 0x26, 0x23,
+    0x22, 0x07, 0x15, 0x21, 0xb5, 0x67, 0x35, 0x42, 0x68, 0x39, 0x41, 0x67,
+    0x3b, 0xfe, 0x9e, 0x15, 0x45, 0x25, 0x3c, 0x4e, 0x20, 0x1e, 0x24, 0x59,
+    0x4b, 0x80, 0x14, 0x43, 0x2a, 0x4a, 0x34, 0x00, 0xff, 0x07, 0x42, 0x6f,
+    0x41, 0x50, 0x6d, 0x35, 0x3b, 0x6e, 0x49, 0x99, 0x16, 0x1f, 0x31, 0x33,
+    0x11, 0x39, 0x3e, 0x01, 0x8d, 0x14, 0x1f, 0x32, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x5d, 0x01, 0x57, 0x01, 0x93, 0x02, 0x6f, 0x00, 0x06,
+    0x00, 0x1a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0f, 0x06, 0x05, 0x04, 0x03,
+    0x04, 0x00, 0x47, 0x00, 0x00, 0x00, 0x74, 0x11, 0x01, 0x07, 0x15, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x13, 0x13, 0x33, 0x17, 0x07, 0x27, 0x07, 0x5d,
+    0x99, 0x16, 0x87, 0x35, 0x61, 0x6e, 0x01, 0x6f, 0x01, 0x00, 0xff, 0x19,
+    0xaf, 0xaf, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0xff, 0xbe, 0x01, 0xc4,
+    0x00, 0x46, 0x00, 0x07, 0x00, 0x06, 0xb3, 0x06, 0x00, 0x01, 0x30, 0x2b,
+    0x37, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x21, 0x30, 0x2f, 0x01, 0x35,
+    0x30, 0xfe, 0x6c, 0x46, 0x5b, 0x5b, 0x88, 0x00, 0x00, 0x02, 0x00, 0x29,
+    0x00, 0x63, 0x01, 0xca, 0x02, 0x05, 0x00, 0x19, 0x00, 0x23, 0x00, 0x08,
+    0xb5, 0x22, 0x1d, 0x06, 0x00, 0x02, 0x30, 0x2b, 0x00, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x35, 0x07, 0x23,
+    0x35, 0x37, 0x33, 0x15, 0x23, 0x17, 0x07, 0x27, 0x01, 0x32, 0x60, 0x38,
+    0x38, 0x60, 0x39, 0x39, 0x5f, 0x38, 0x28, 0x2e, 0x4d, 0x2d, 0x2e, 0x4d,
+    0x2e, 0x2e, 0x4d, 0x2e, 0xac, 0x24, 0x0a, 0x61, 0x32, 0xa6, 0x19, 0xa2,
+    0x02, 0x05, 0x38, 0x60, 0x39, 0x39, 0x60, 0x38, 0x38, 0x60, 0x39, 0x2d,
+    0x4e, 0x2e, 0x2e, 0x4e, 0x2d, 0x2d, 0x4d, 0x2e, 0x29, 0x69, 0x60, 0x09,
+    0x1f, 0xa8, 0x18, 0xa6, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x01, 0xd8,
+    0x01, 0xcf, 0x00, 0x04, 0x00, 0x09, 0x00, 0x08, 0xb5, 0x08, 0x05, 0x03,
+    0x00, 0x02, 0x30, 0x2b, 0x21, 0x21, 0x11, 0x37, 0x17, 0x01, 0x21, 0x11,
+    0x27, 0x07, 0x01, 0xd8, 0xfe, 0x44, 0xde, 0xde, 0xfe, 0x6c, 0x01, 0x6c,
+    0xb6, 0xb6, 0x01, 0x48, 0x87, 0x87, 0xfe, 0xe0, 0x01, 0x08, 0x6d, 0x6d,
+    0x00, 0x04, 0x00, 0x22, 0xff, 0xd8, 0x01, 0xd4, 0x02, 0x7c, 0x00, 0x0c,
+    0x00, 0x13, 0x00, 0x17, 0x00, 0x1b, 0x00, 0x0d, 0x40, 0x0a, 0x1a, 0x18,
+    0x16, 0x14, 0x11, 0x0e, 0x0a, 0x05, 0x04, 0x30, 0x2b, 0x01, 0x23, 0x17,
+    0x27, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x37, 0x33, 0x17, 0x07, 0x27,
+    0x07, 0x33, 0x15, 0x33, 0x35, 0x03, 0x33, 0x15, 0x23, 0x37, 0x33, 0x35,
+    0x23, 0x01, 0xd4, 0x0f, 0x01, 0x03, 0x58, 0xdf, 0x6a, 0xcc, 0x1b, 0xcb,
+    0x35, 0xa4, 0xa4, 0x5d, 0x8f, 0xb7, 0xdf, 0xdf, 0x28, 0x8f, 0x8f, 0x01,
+    0x6d, 0x03, 0x03, 0x9d, 0x9d, 0x2c, 0xe3, 0xe3, 0x03, 0xb9, 0xb9, 0x9e,
+    0x9e, 0xfe, 0xdd, 0x9b, 0x28, 0x4b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3d,
+    0x00, 0x4e, 0x01, 0xb7, 0x02, 0x0a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13,
+    0x00, 0x0a, 0xb7, 0x0f, 0x09, 0x05, 0x04, 0x01, 0x00, 0x03, 0x30, 0x2b,
+    0x01, 0x11, 0x21, 0x11, 0x01, 0x11, 0x21, 0x11, 0x13, 0x37, 0x17, 0x37,
+    0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x27, 0x37, 0x01, 0xb7, 0xfe, 0x86,
+    0x01, 0x52, 0xfe, 0xd6, 0x2a, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19,
+    0x52, 0x52, 0x19, 0x52, 0x02, 0x0a, 0xfe, 0x44, 0x01, 0xbc, 0xfe, 0x6c,
+    0x01, 0x6c, 0xfe, 0x94, 0x01, 0x08, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52,
+    0x19, 0x52, 0x52, 0x19, 0x52, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02,
+    0x00, 0x4e, 0x01, 0xce, 0x02, 0x0a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x15,
+    0x00, 0x0a, 0xb7, 0x11, 0x0b, 0x06, 0x05, 0x01, 0x00, 0x03, 0x30, 0x2b,
+    0x01, 0x11, 0x21, 0x27, 0x37, 0x01, 0x11, 0x21, 0x07, 0x17, 0x13, 0x37,
+    0x17, 0x37, 0x17, 0x07, 0x17, 0x07, 0x27, 0x07, 0x27, 0x37, 0x01, 0xce,
+    0xfe, 0xb8, 0x84, 0x84, 0x01, 0x20, 0xfe, 0xf8, 0x6d, 0x6d, 0x08, 0x19,
+    0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52, 0x02, 0x0a,
+    0xfe, 0x44, 0xde, 0xde, 0xfe, 0x6c, 0x01, 0x6c, 0xb6, 0xb6, 0x01, 0x08,
+    0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52, 0x00,
+    0x00, 0x03, 0x00, 0x16, 0x00, 0x4e, 0x01, 0xe2, 0x02, 0x0a, 0x00, 0x04,
+    0x00, 0x09, 0x00, 0x15, 0x00, 0x0a, 0xb7, 0x11, 0x0b, 0x08, 0x06, 0x03,
+    0x01, 0x03, 0x30, 0x2b, 0x01, 0x07, 0x21, 0x11, 0x21, 0x17, 0x27, 0x21,
+    0x11, 0x21, 0x27, 0x07, 0x27, 0x07, 0x27, 0x37, 0x27, 0x37, 0x17, 0x37,
+    0x17, 0x07, 0x01, 0xe2, 0x84, 0xfe, 0xb8, 0x01, 0x48, 0x55, 0x6d, 0xfe,
+    0xf8, 0x01, 0x08, 0x08, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52,
+    0x52, 0x19, 0x52, 0x01, 0x2c, 0xde, 0x01, 0xbc, 0xde, 0xb6, 0xfe, 0x94,
+    0x64, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52, 0x52, 0x19, 0x52,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x01, 0xc9, 0x00, 0x07,
+    0x00, 0x0b, 0x00, 0x08, 0xb5, 0x0a, 0x08, 0x06, 0x02, 0x02, 0x30, 0x2b,
+    0x13, 0x23, 0x35, 0x33, 0x13, 0x33, 0x15, 0x23, 0x03, 0x33, 0x15, 0x23,
+    0x81, 0x81, 0x9c, 0xd6, 0x82, 0x9d, 0x14, 0xb1, 0xb1, 0x01, 0x9e, 0x2b,
+    0xfe, 0x62, 0x2b, 0x01, 0xc9, 0x2b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x15,
+    0x00, 0x08, 0x01, 0xd9, 0x01, 0xcb, 0x00, 0x2f, 0x00, 0x3a, 0x00, 0x45,
+    0x00, 0x49, 0x00, 0x54, 0x00, 0x5f, 0x00, 0x11, 0x40, 0x0e, 0x59, 0x55,
+    0x4d, 0x4a, 0x47, 0x46, 0x40, 0x3b, 0x33, 0x30, 0x0d, 0x00, 0x06, 0x30,
+    0x2b, 0x36, 0x26, 0x35, 0x34, 0x36, 0x33, 0x33, 0x35, 0x23, 0x22, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x33, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23, 0x15, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x23, 0x15, 0x14, 0x06,
+    0x23, 0x13, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0x21, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x15, 0x07,
+    0x35, 0x23, 0x15, 0x06, 0x36, 0x35, 0x35, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0x20, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x15, 0x14, 0x16,
+    0x33, 0x4c, 0x37, 0x37, 0x26, 0x34, 0x34, 0x26, 0x37, 0x37, 0x26, 0x26,
+    0x36, 0x52, 0x36, 0x26, 0x26, 0x37, 0x37, 0x26, 0x34, 0x34, 0x26, 0x37,
+    0x37, 0x26, 0x26, 0x36, 0x52, 0x36, 0x26, 0x34, 0x1e, 0x16, 0x16, 0x1f,
+    0x1f, 0x16, 0x01, 0x0a, 0x16, 0x1f, 0x1f, 0x16, 0x16, 0x1e, 0x28, 0x52,
+    0x46, 0x1e, 0x34, 0x16, 0x1f, 0x1f, 0x16, 0x01, 0x20, 0x1f, 0x1f, 0x16,
+    0x34, 0x1e, 0x16, 0x08, 0x37, 0x26, 0x26, 0x36, 0x51, 0x36, 0x26, 0x26,
+    0x37, 0x37, 0x26, 0x34, 0x34, 0x26, 0x37, 0x37, 0x26, 0x26, 0x36, 0x51,
+    0x36, 0x26, 0x26, 0x37, 0x37, 0x26, 0x34, 0x34, 0x26, 0x37, 0x01, 0x32,
+    0x34, 0x16, 0x1f, 0x1f, 0x16, 0x16, 0x1e, 0x1e, 0x16, 0x16, 0x1f, 0x1f,
+    0x16, 0x34, 0x79, 0x51, 0x51, 0x91, 0x1f, 0x16, 0x34, 0x1e, 0x16, 0x16,
+    0x1f, 0x1f, 0x16, 0x16, 0x1e, 0x34, 0x16, 0x1f, 0x00, 0x02, 0x00, 0x21,
+    0x00, 0x21, 0x01, 0xcc, 0x01, 0xc9, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x08,
+    0xb5, 0x12, 0x0c, 0x03, 0x00, 0x02, 0x30, 0x2b, 0x01, 0x11, 0x21, 0x15,
+    0x23, 0x27, 0x35, 0x37, 0x33, 0x15, 0x33, 0x35, 0x17, 0x23, 0x15, 0x23,
+    0x35, 0x07, 0x17, 0x35, 0x21, 0x01, 0xcc, 0xfe, 0xf2, 0x12, 0x8b, 0x8b,
+    0x14, 0x80, 0x64, 0x3c, 0xcb, 0x4e, 0x4c, 0x01, 0x09, 0x01, 0xc9, 0xfe,
+    0xb2, 0x5a, 0x9b, 0x1a, 0x8d, 0x58, 0xbe, 0x28, 0xbe, 0x35, 0x51, 0x56,
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc7, 0x02, 0x02, 0x01, 0x24,
+    0x02, 0xb6, 0x00, 0x03, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x02, 0x01, 0x01, 0x00, 0x01,
+    0x4d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x07, 0x15, 0x2b,
+    0x13, 0x37, 0x33, 0x07, 0xc7, 0x16, 0x47, 0x31, 0x02, 0x02, 0xb4, 0xb4,
+    0xff, 0xff, 0x00, 0x8b, 0x02, 0x02, 0x01, 0x6a, 0x02, 0xb6, 0x00, 0x22,
+    0x02, 0xc7, 0x46, 0x00, 0x00, 0x02, 0x02, 0xc7, 0xc4, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x5f, 0x01, 0x75, 0x01, 0x95, 0x02, 0x8d, 0x01, 0x06,
+    0x02, 0xbc, 0x02, 0x1e, 0x00, 0x08, 0xb1, 0x00, 0x01, 0xb0, 0x1e, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xad, 0xff, 0xb4, 0x01, 0x32,
+    0x00, 0x68, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x01, 0x00, 0x01, 0x30, 0x2b,
+    0x17, 0x37, 0x33, 0x07, 0xad, 0x3e, 0x47, 0x59, 0x4c, 0xb4, 0xb4, 0x00,
+    0x00, 0x02, 0xfe, 0x7c, 0x02, 0x34, 0xff, 0x93, 0x02, 0x99, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x32, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x27, 0x02, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x05,
+    0x03, 0x04, 0x03, 0x01, 0x00, 0x01, 0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c,
+    0x17, 0x0c, 0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07,
+    0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x32, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xfe, 0x9a, 0x1e, 0x1e, 0x15, 0x14,
+    0x1e, 0x1e, 0x14, 0x9d, 0x1d, 0x1d, 0x15, 0x14, 0x1e, 0x1e, 0x14, 0x02,
+    0x34, 0x1e, 0x14, 0x14, 0x1f, 0x1e, 0x15, 0x14, 0x1e, 0x1d, 0x15, 0x15,
+    0x1e, 0x1e, 0x15, 0x14, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xd7,
+    0x02, 0x29, 0xff, 0x3e, 0x02, 0x90, 0x00, 0x0b, 0x00, 0x26, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00,
+    0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0xfe, 0xf5, 0x1e, 0x1d, 0x16, 0x15, 0x1f, 0x1f, 0x15, 0x02, 0x29, 0x1e,
+    0x15, 0x16, 0x1e, 0x1f, 0x15, 0x15, 0x1e, 0x00, 0x00, 0x01, 0xfe, 0xa6,
+    0x01, 0xfb, 0xff, 0x31, 0x02, 0xaa, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x01, 0x37, 0x17, 0x07, 0xfe, 0xa6, 0x37, 0x54,
+    0x26, 0x02, 0x82, 0x28, 0x95, 0x1a, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xe4,
+    0x01, 0xfb, 0xff, 0x6f, 0x02, 0xaa, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x01, 0x37, 0x17, 0x07, 0xfe, 0xe4, 0x54, 0x37,
+    0x65, 0x02, 0x15, 0x95, 0x28, 0x87, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x8a,
+    0x02, 0x0a, 0xff, 0xbc, 0x02, 0xbb, 0x00, 0x03, 0x00, 0x07, 0x00, 0x08,
+    0xb5, 0x07, 0x05, 0x03, 0x01, 0x02, 0x30, 0x2b, 0x01, 0x37, 0x17, 0x07,
+    0x37, 0x37, 0x17, 0x07, 0xfe, 0x8a, 0x58, 0x3f, 0x65, 0x69, 0x58, 0x3f,
+    0x65, 0x02, 0x28, 0x93, 0x2a, 0x87, 0x1e, 0x93, 0x2a, 0x87, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0xd9, 0x01, 0xdf, 0xff, 0x3b, 0x02, 0x95, 0x00, 0x0d,
+    0x00, 0x06, 0xb3, 0x05, 0x00, 0x01, 0x30, 0x2b, 0x02, 0x16, 0x15, 0x14,
+    0x07, 0x07, 0x27, 0x37, 0x36, 0x35, 0x35, 0x34, 0x36, 0x33, 0xda, 0x15,
+    0x05, 0x33, 0x2a, 0x0e, 0x06, 0x17, 0x12, 0x02, 0x95, 0x14, 0x10, 0x09,
+    0x0d, 0x7c, 0x10, 0x2c, 0x14, 0x1e, 0x20, 0x13, 0x15, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0x6f, 0x01, 0xff, 0xff, 0x9d, 0x02, 0xad, 0x00, 0x06,
+    0x00, 0x1a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0f, 0x06, 0x05, 0x04, 0x03,
+    0x04, 0x00, 0x47, 0x00, 0x00, 0x00, 0x74, 0x11, 0x01, 0x07, 0x15, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x01, 0x37, 0x33, 0x17, 0x07, 0x27, 0x07, 0xfe,
+    0x6f, 0x8b, 0x18, 0x8b, 0x28, 0x6f, 0x6f, 0x02, 0x21, 0x8c, 0x8c, 0x22,
+    0x6e, 0x6e, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x74, 0x02, 0x02, 0xff, 0xa2,
+    0x02, 0xb0, 0x00, 0x06, 0x00, 0x1a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0f,
+    0x06, 0x05, 0x02, 0x01, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x74, 0x13,
+    0x01, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x03, 0x37, 0x17, 0x07,
+    0x23, 0x27, 0x37, 0xf5, 0x6f, 0x28, 0x8b, 0x18, 0x8b, 0x28, 0x02, 0x42,
+    0x6e, 0x22, 0x8c, 0x8c, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x80,
+    0x02, 0x1a, 0xff, 0x9c, 0x02, 0x8e, 0x00, 0x0d, 0x00, 0x26, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x1b, 0x0d, 0x07, 0x06, 0x03, 0x01, 0x48, 0x00, 0x01,
+    0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01,
+    0x00, 0x4f, 0x25, 0x22, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x37, 0x64, 0x17, 0x49, 0x2e, 0x2e, 0x49, 0x17, 0x34, 0x10, 0x2c,
+    0x1e, 0x1e, 0x2c, 0x10, 0x02, 0x76, 0x2c, 0x30, 0x30, 0x2c, 0x18, 0x23,
+    0x21, 0x21, 0x23, 0x00, 0x00, 0x02, 0xfe, 0xb1, 0x02, 0x05, 0xff, 0x68,
+    0x02, 0xb5, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x38, 0xb1, 0x06, 0x64, 0x44,
+    0x40, 0x2d, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x05, 0x01,
+    0x03, 0x01, 0x01, 0x03, 0x57, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04,
+    0x01, 0x01, 0x03, 0x01, 0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c,
+    0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x33, 0xfe, 0xe8, 0x37, 0x37, 0x24, 0x26, 0x36, 0x37,
+    0x25, 0x12, 0x19, 0x19, 0x11, 0x11, 0x18, 0x18, 0x11, 0x02, 0x05, 0x34,
+    0x24, 0x24, 0x34, 0x33, 0x25, 0x24, 0x34, 0x2b, 0x1b, 0x13, 0x13, 0x1b,
+    0x1b, 0x13, 0x13, 0x1b, 0x00, 0x01, 0xfe, 0x71, 0x02, 0x3e, 0xff, 0xbb,
+    0x02, 0xab, 0x00, 0x19, 0x00, 0x35, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x2a,
+    0x19, 0x01, 0x03, 0x02, 0x0d, 0x0c, 0x02, 0x00, 0x01, 0x02, 0x4a, 0x00,
+    0x03, 0x01, 0x00, 0x03, 0x57, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+    0x67, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x24,
+    0x25, 0x24, 0x22, 0x04, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x03,
+    0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x45, 0x16, 0x29, 0x1e, 0x15, 0x21, 0x16, 0x13, 0x17, 0x0e, 0x12,
+    0x1a, 0x0c, 0x31, 0x0f, 0x33, 0x25, 0x15, 0x1e, 0x15, 0x11, 0x1a, 0x0f,
+    0x10, 0x15, 0x0e, 0x02, 0x89, 0x2a, 0x21, 0x0f, 0x0f, 0x0c, 0x0c, 0x15,
+    0x1a, 0x16, 0x24, 0x2c, 0x0f, 0x0e, 0x0d, 0x0c, 0x14, 0x1c, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0x87, 0x02, 0x35, 0xff, 0x85, 0x02, 0x6d, 0x00, 0x03,
+    0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d,
+    0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x33,
+    0x15, 0x23, 0xfe, 0x87, 0xfe, 0xfe, 0x02, 0x6d, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0xa5, 0x02, 0x0b, 0xff, 0x4c, 0x02, 0xc0, 0x00, 0x19,
+    0x00, 0x2c, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x21, 0x13, 0x01, 0x00, 0x01,
+    0x01, 0x4a, 0x12, 0x07, 0x05, 0x03, 0x00, 0x47, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f,
+    0x24, 0x2f, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x02, 0x06,
+    0x07, 0x06, 0x06, 0x15, 0x15, 0x23, 0x35, 0x34, 0x37, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0xb4, 0x0e, 0x0f, 0x0e, 0x0d, 0x33, 0x1d, 0x0c, 0x0b, 0x12, 0x0d, 0x22,
+    0x0a, 0x25, 0x12, 0x29, 0x1b, 0x22, 0x2f, 0x02, 0x63, 0x15, 0x0d, 0x0c,
+    0x13, 0x10, 0x07, 0x1c, 0x14, 0x19, 0x0b, 0x0e, 0x07, 0x0d, 0x0f, 0x20,
+    0x26, 0x16, 0x14, 0x28, 0x22, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x6b,
+    0x01, 0xfb, 0xff, 0x96, 0x02, 0xaa, 0x00, 0x22, 0x02, 0xcd, 0xc5, 0x00,
+    0x00, 0x02, 0x02, 0xcd, 0x65, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x80,
+    0x02, 0x10, 0xff, 0x9c, 0x02, 0x84, 0x00, 0x0d, 0x00, 0x27, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x1c, 0x0d, 0x0c, 0x06, 0x05, 0x04, 0x00, 0x47, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
+    0x01, 0x00, 0x4f, 0x25, 0x21, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00,
+    0x44, 0x02, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x17, 0x07, 0xa8, 0x2c, 0x1e, 0x1e, 0x2c, 0x10, 0x34, 0x17, 0x49,
+    0x2e, 0x2e, 0x49, 0x17, 0x34, 0x02, 0x33, 0x21, 0x21, 0x23, 0x18, 0x2c,
+    0x30, 0x30, 0x2c, 0x18, 0x00, 0x01, 0xfe, 0xb2, 0x02, 0x26, 0xff, 0x3f,
+    0x03, 0x35, 0x00, 0x11, 0x00, 0x17, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0c,
+    0x11, 0x01, 0x00, 0x48, 0x00, 0x00, 0x00, 0x74, 0x2b, 0x01, 0x07, 0x15,
+    0x2b, 0xb1, 0x06, 0x00, 0x44, 0x03, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37, 0xc1,
+    0x1c, 0x25, 0x0a, 0x0d, 0x0e, 0x0e, 0x21, 0x1a, 0x1b, 0x29, 0x6b, 0x03,
+    0x17, 0x1a, 0x3c, 0x13, 0x09, 0x0c, 0x0c, 0x0d, 0x12, 0x0d, 0x19, 0x22,
+    0x2f, 0x24, 0x4e, 0x6e, 0x00, 0x01, 0xff, 0x98, 0x01, 0x98, 0xff, 0xf6,
+    0x02, 0x1d, 0x00, 0x08, 0x00, 0x46, 0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0,
+    0x0e, 0x50, 0x58, 0x40, 0x16, 0x00, 0x01, 0x00, 0x00, 0x01, 0x6e, 0x00,
+    0x00, 0x02, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x02,
+    0x00, 0x02, 0x50, 0x1b, 0x40, 0x15, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00,
+    0x00, 0x02, 0x02, 0x00, 0x57, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x02,
+    0x00, 0x02, 0x50, 0x59, 0xb5, 0x13, 0x12, 0x10, 0x03, 0x07, 0x17, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x03, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06,
+    0x23, 0x68, 0x11, 0x0d, 0x40, 0x0e, 0x28, 0x28, 0x01, 0xc9, 0x22, 0x32,
+    0x34, 0x37, 0x1a, 0x00, 0x00, 0x01, 0xfe, 0xc4, 0xff, 0x60, 0xff, 0x2b,
+    0xff, 0xc7, 0x00, 0x0b, 0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02,
+    0x01, 0x01, 0x00, 0x01, 0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24,
+    0x03, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x04, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xfe, 0xe2, 0x1e, 0x1e,
+    0x16, 0x15, 0x1e, 0x1e, 0x15, 0xa0, 0x1e, 0x15, 0x15, 0x1f, 0x1f, 0x15,
+    0x15, 0x1e, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x7c, 0xff, 0x5a, 0xff, 0x93,
+    0xff, 0xbf, 0x01, 0x07, 0x02, 0xcb, 0x00, 0x00, 0xfd, 0x26, 0x00, 0x09,
+    0xb1, 0x00, 0x02, 0xb8, 0xfd, 0x26, 0xb0, 0x33, 0x2b, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0xbc, 0xfe, 0xed, 0xff, 0x3b, 0xff, 0xe1, 0x00, 0x11,
+    0x00, 0x18, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0d, 0x11, 0x03, 0x02, 0x00,
+    0x47, 0x00, 0x00, 0x00, 0x74, 0x2b, 0x01, 0x07, 0x15, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x05, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0xfe, 0xbc, 0x19, 0x22,
+    0x09, 0x0c, 0x0d, 0x0c, 0x1e, 0x17, 0x19, 0x24, 0x60, 0xf8, 0x17, 0x36,
+    0x11, 0x08, 0x0b, 0x0b, 0x0c, 0x10, 0x0c, 0x16, 0x1f, 0x2b, 0x20, 0x46,
+    0x63, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xb5, 0xff, 0x3b, 0xff, 0x8c,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x3e, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x33,
+    0x0d, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x01, 0x01, 0x01, 0x03, 0x00,
+    0x03, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x5f, 0x04, 0x01, 0x03,
+    0x00, 0x03, 0x4f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x11, 0x23, 0x23,
+    0x05, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x04, 0x27, 0x37, 0x16,
+    0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37, 0x33, 0x07, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0xfe, 0xe3, 0x2e, 0x19, 0x25, 0x32, 0x32, 0x1b,
+    0x18, 0x1e, 0x0b, 0x2c, 0x06, 0x2a, 0x2b, 0x3c, 0x38, 0xc5, 0x1f, 0x2a,
+    0x1e, 0x24, 0x10, 0x11, 0x55, 0x2f, 0x04, 0x25, 0x18, 0x24, 0x31, 0x00,
+    0x00, 0x01, 0xfe, 0xa3, 0xff, 0x1d, 0xff, 0x37, 0x00, 0x11, 0x00, 0x0d,
+    0x00, 0x06, 0xb3, 0x06, 0x00, 0x01, 0x30, 0x2b, 0x07, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0xed, 0x33,
+    0x3d, 0x3f, 0x3a, 0x1b, 0x26, 0x2c, 0x1f, 0x1f, 0xe3, 0x07, 0x2e, 0x25,
+    0x28, 0x50, 0x22, 0x11, 0x1e, 0x42, 0x1b, 0x16, 0x1e, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0x80, 0xff, 0x51, 0xff, 0x9c, 0xff, 0xc5, 0x00, 0x0d,
+    0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x0d, 0x07, 0x06, 0x03,
+    0x01, 0x48, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00,
+    0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x25, 0x22, 0x02, 0x07, 0x16, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x07, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x64, 0x17, 0x49, 0x2e, 0x2e, 0x49,
+    0x17, 0x34, 0x10, 0x2c, 0x1e, 0x1e, 0x2c, 0x10, 0x53, 0x2c, 0x30, 0x30,
+    0x2c, 0x18, 0x23, 0x21, 0x21, 0x23, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x87,
+    0xff, 0x65, 0xff, 0x85, 0xff, 0x9d, 0x00, 0x03, 0x00, 0x20, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07,
+    0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x05, 0x33, 0x15, 0x23, 0xfe, 0x87,
+    0xfe, 0xfe, 0x63, 0x38, 0x00, 0x01, 0xfe, 0x85, 0x01, 0x1e, 0xff, 0x93,
+    0x01, 0x57, 0x00, 0x03, 0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x01, 0x21, 0x15, 0x21, 0xfe, 0x85, 0x01, 0x0e, 0xfe, 0xf2,
+    0x01, 0x57, 0x39, 0x00, 0x00, 0x01, 0xfe, 0x53, 0x01, 0x19, 0xff, 0xbb,
+    0x01, 0x5c, 0x00, 0x03, 0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x01, 0x21, 0x15, 0x21, 0xfe, 0x53, 0x01, 0x68, 0xfe, 0x98,
+    0x01, 0x5c, 0x43, 0x00, 0x00, 0x02, 0xfe, 0x7b, 0x02, 0xb0, 0xff, 0x92,
+    0x03, 0x15, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x27, 0x02, 0x01,
+    0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x05,
+    0x03, 0x04, 0x03, 0x01, 0x00, 0x01, 0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c,
+    0x17, 0x0c, 0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07,
+    0x15, 0x2b, 0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x32, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0xfe, 0x99, 0x1e, 0x1e, 0x14, 0x15, 0x1e, 0x1e, 0x15, 0x9e,
+    0x1d, 0x1d, 0x14, 0x15, 0x1e, 0x1e, 0x15, 0x02, 0xb0, 0x1e, 0x14, 0x14,
+    0x1f, 0x1e, 0x15, 0x14, 0x1e, 0x1d, 0x15, 0x15, 0x1e, 0x1e, 0x15, 0x14,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x05, 0x02, 0xb1, 0xff, 0x6c,
+    0x03, 0x17, 0x00, 0x0b, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01,
+    0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b,
+    0x02, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0xdc, 0x1f, 0x1e, 0x15, 0x15, 0x1f, 0x1f, 0x15, 0x02, 0xb1, 0x1e, 0x15,
+    0x15, 0x1e, 0x1e, 0x15, 0x15, 0x1e, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc7,
+    0x02, 0x94, 0xff, 0x88, 0x03, 0x17, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x01, 0x37, 0x17, 0x07, 0xfe, 0xc7, 0x28, 0x99,
+    0x17, 0x02, 0xd1, 0x46, 0x59, 0x2a, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xb9,
+    0x02, 0x94, 0xff, 0x79, 0x03, 0x17, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x01, 0x37, 0x17, 0x07, 0xfe, 0xb9, 0x98, 0x28,
+    0xa9, 0x02, 0xbe, 0x59, 0x46, 0x3d, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x7c,
+    0x02, 0x85, 0xff, 0xdf, 0x03, 0x2a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x08,
+    0xb5, 0x07, 0x05, 0x03, 0x01, 0x02, 0x30, 0x2b, 0x01, 0x37, 0x17, 0x07,
+    0x37, 0x37, 0x17, 0x07, 0xfe, 0x7c, 0x83, 0x2f, 0x92, 0x92, 0x83, 0x2e,
+    0x91, 0x02, 0xae, 0x7c, 0x40, 0x65, 0x29, 0x7c, 0x40, 0x65, 0x00, 0x00,
+    0x00, 0x01, 0xfe, 0x68, 0x02, 0x8f, 0xff, 0xa4, 0x03, 0x17, 0x00, 0x06,
+    0x00, 0x12, 0x40, 0x0f, 0x06, 0x05, 0x04, 0x03, 0x04, 0x00, 0x47, 0x00,
+    0x00, 0x00, 0x74, 0x11, 0x01, 0x07, 0x15, 0x2b, 0x01, 0x37, 0x33, 0x17,
+    0x07, 0x27, 0x07, 0xfe, 0x68, 0x8f, 0x16, 0x97, 0x1e, 0x82, 0x7b, 0x02,
+    0xb5, 0x62, 0x63, 0x24, 0x46, 0x47, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x7c,
+    0x02, 0x8f, 0xff, 0x90, 0x03, 0x17, 0x00, 0x06, 0x00, 0x12, 0x40, 0x0f,
+    0x04, 0x03, 0x02, 0x01, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x74, 0x15,
+    0x01, 0x07, 0x15, 0x2b, 0x01, 0x37, 0x17, 0x37, 0x17, 0x07, 0x23, 0xfe,
+    0x7c, 0x21, 0x67, 0x70, 0x1c, 0x83, 0x16, 0x02, 0xf1, 0x26, 0x47, 0x44,
+    0x21, 0x64, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x78, 0x02, 0x9f, 0xff, 0x94,
+    0x03, 0x13, 0x00, 0x0d, 0x00, 0x1e, 0x40, 0x1b, 0x0d, 0x07, 0x06, 0x03,
+    0x01, 0x48, 0x00, 0x01, 0x00, 0x00, 0x01, 0x57, 0x00, 0x01, 0x01, 0x00,
+    0x5f, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x25, 0x22, 0x02, 0x07, 0x16, 0x2b,
+    0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x37, 0x6c, 0x17, 0x49, 0x2e, 0x2e, 0x49, 0x17, 0x34, 0x10, 0x2c,
+    0x1e, 0x1e, 0x2c, 0x10, 0x02, 0xfb, 0x2c, 0x30, 0x30, 0x2c, 0x18, 0x23,
+    0x21, 0x21, 0x23, 0x00, 0x00, 0x02, 0xfe, 0xab, 0x02, 0x6b, 0xff, 0x62,
+    0x03, 0x1b, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x04, 0x01, 0x01, 0x01, 0x03, 0x5f,
+    0x05, 0x01, 0x03, 0x03, 0x16, 0x01, 0x4c, 0x0c, 0x0c, 0x00, 0x00, 0x0c,
+    0x17, 0x0c, 0x16, 0x12, 0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07,
+    0x15, 0x2b, 0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x33, 0xfe, 0xe1, 0x36, 0x37, 0x25, 0x25, 0x36, 0x35, 0x26, 0x12,
+    0x18, 0x18, 0x11, 0x12, 0x18, 0x19, 0x11, 0x02, 0x6b, 0x34, 0x24, 0x24,
+    0x34, 0x34, 0x25, 0x24, 0x33, 0x2b, 0x1a, 0x13, 0x14, 0x1a, 0x1a, 0x14,
+    0x13, 0x1a, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x6c, 0x02, 0xb0, 0xff, 0xb6,
+    0x03, 0x1d, 0x00, 0x19, 0x00, 0x2d, 0x40, 0x2a, 0x19, 0x01, 0x03, 0x02,
+    0x0d, 0x0c, 0x02, 0x00, 0x01, 0x02, 0x4a, 0x00, 0x03, 0x01, 0x00, 0x03,
+    0x57, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x67, 0x00, 0x03, 0x03,
+    0x00, 0x5f, 0x00, 0x00, 0x03, 0x00, 0x4f, 0x24, 0x25, 0x24, 0x22, 0x04,
+    0x07, 0x18, 0x2b, 0x03, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x4a, 0x16, 0x29, 0x1e, 0x15, 0x21, 0x16,
+    0x13, 0x17, 0x0e, 0x12, 0x1a, 0x0c, 0x31, 0x0f, 0x33, 0x25, 0x15, 0x1e,
+    0x15, 0x11, 0x1a, 0x0f, 0x10, 0x15, 0x0e, 0x02, 0xfb, 0x2a, 0x21, 0x0f,
+    0x0f, 0x0c, 0x0c, 0x15, 0x1a, 0x16, 0x24, 0x2c, 0x0f, 0x0e, 0x0d, 0x0c,
+    0x14, 0x1c, 0x00, 0x00, 0x00, 0x01, 0xff, 0x9a, 0x02, 0x3e, 0xff, 0xfd,
+    0x02, 0xcd, 0x00, 0x09, 0x00, 0x34, 0x4b, 0xb0, 0x0e, 0x50, 0x58, 0x40,
+    0x11, 0x00, 0x01, 0x00, 0x00, 0x01, 0x6e, 0x00, 0x02, 0x02, 0x00, 0x5f,
+    0x00, 0x00, 0x00, 0x14, 0x02, 0x4c, 0x1b, 0x40, 0x10, 0x00, 0x01, 0x00,
+    0x01, 0x83, 0x00, 0x02, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x14, 0x02,
+    0x4c, 0x59, 0xb5, 0x13, 0x13, 0x10, 0x03, 0x07, 0x17, 0x2b, 0x03, 0x32,
+    0x36, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x23, 0x66, 0x13, 0x11, 0x05,
+    0x3a, 0x0c, 0x26, 0x27, 0x02, 0x6f, 0x0f, 0x25, 0x2a, 0x39, 0x3b, 0x1b,
+    0x00, 0x01, 0xfe, 0x7e, 0x02, 0x2f, 0xff, 0x9f, 0x02, 0x9d, 0x00, 0x17,
+    0x00, 0x4b, 0x40, 0x0e, 0x17, 0x01, 0x01, 0x02, 0x0c, 0x01, 0x00, 0x03,
+    0x02, 0x4a, 0x0b, 0x01, 0x00, 0x47, 0x4b, 0xb0, 0x2c, 0x50, 0x58, 0x40,
+    0x15, 0x00, 0x01, 0x01, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x16, 0x4b, 0x00,
+    0x00, 0x00, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x14, 0x00, 0x4c, 0x1b, 0x40,
+    0x12, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x63, 0x00, 0x01, 0x01, 0x02,
+    0x5f, 0x00, 0x02, 0x02, 0x16, 0x01, 0x4c, 0x59, 0xb6, 0x24, 0x24, 0x24,
+    0x21, 0x04, 0x07, 0x18, 0x2b, 0x03, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x61, 0x24, 0x30, 0x15, 0x21, 0x11, 0x10,
+    0x12, 0x0a, 0x0f, 0x13, 0x07, 0x31, 0x17, 0x47, 0x15, 0x1f, 0x12, 0x0c,
+    0x11, 0x09, 0x0d, 0x12, 0x0a, 0x02, 0x77, 0x47, 0x13, 0x10, 0x0d, 0x0b,
+    0x1d, 0x1f, 0x0e, 0x60, 0x12, 0x10, 0x0b, 0x0b, 0x13, 0x17, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xb4, 0x01, 0xc6, 0x01, 0x25, 0x02, 0x9f, 0x00, 0x11,
+    0x00, 0x18, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0d, 0x11, 0x03, 0x02, 0x00,
+    0x47, 0x00, 0x00, 0x00, 0x74, 0x2b, 0x01, 0x07, 0x15, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x13, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x07, 0xb4, 0x17, 0x1d, 0x0b,
+    0x07, 0x0c, 0x0b, 0x1b, 0x15, 0x16, 0x20, 0x55, 0x01, 0xde, 0x14, 0x32,
+    0x0f, 0x07, 0x0c, 0x06, 0x0b, 0x0e, 0x0b, 0x14, 0x1b, 0x26, 0x1c, 0x42,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb2, 0x01, 0x87, 0x01, 0x31,
+    0x02, 0x7b, 0x00, 0x11, 0x00, 0x18, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0d,
+    0x11, 0x03, 0x02, 0x00, 0x48, 0x00, 0x00, 0x00, 0x74, 0x2b, 0x01, 0x07,
+    0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x37,
+    0x01, 0x31, 0x19, 0x22, 0x09, 0x0c, 0x0d, 0x0c, 0x1e, 0x17, 0x19, 0x24,
+    0x60, 0x02, 0x60, 0x17, 0x36, 0x11, 0x08, 0x0b, 0x0b, 0x0c, 0x10, 0x0c,
+    0x16, 0x1f, 0x2b, 0x20, 0x46, 0x63, 0x00, 0x00, 0xff, 0xff, 0x00, 0x8b,
+    0x02, 0x02, 0x01, 0x6a, 0x02, 0xb6, 0x00, 0x22, 0x02, 0xc7, 0x46, 0x00,
+    0x00, 0x02, 0x02, 0xc7, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7b,
+    0x02, 0x35, 0x01, 0x79, 0x02, 0x6d, 0x00, 0x03, 0x00, 0x20, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x15, 0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07,
+    0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x33, 0x15, 0x23, 0x7b, 0xfe,
+    0xfe, 0x02, 0x6d, 0x38, 0x00, 0x01, 0x00, 0xb4, 0x02, 0x0a, 0x01, 0x4b,
+    0x02, 0xbb, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03, 0x01, 0x01, 0x30, 0x2b,
+    0x13, 0x37, 0x17, 0x07, 0xb4, 0x3f, 0x58, 0x32, 0x02, 0x91, 0x2a, 0x93,
+    0x1e, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xc7, 0x02, 0x02, 0x01, 0x24,
+    0x02, 0xb6, 0x00, 0x02, 0x02, 0xc7, 0x00, 0x00, 0x00, 0x01, 0x00, 0xc4,
+    0x01, 0xc2, 0x01, 0x31, 0x02, 0x99, 0x00, 0x0d, 0x00, 0x30, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x25, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x67,
+    0x00, 0x02, 0x03, 0x03, 0x02, 0x57, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x04,
+    0x01, 0x03, 0x02, 0x03, 0x4f, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0d, 0x14,
+    0x11, 0x14, 0x05, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x00, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x15,
+    0x01, 0x03, 0x3f, 0x40, 0x2c, 0x01, 0x17, 0x22, 0x21, 0x17, 0x01, 0xc2,
+    0x3e, 0x2d, 0x2d, 0x3f, 0x2e, 0x25, 0x18, 0x18, 0x24, 0x30, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xc3, 0x01, 0xc2, 0x01, 0x30, 0x02, 0x99, 0x00, 0x0d,
+    0x00, 0x2a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f, 0x00, 0x02, 0x00, 0x01,
+    0x00, 0x02, 0x01, 0x67, 0x00, 0x00, 0x03, 0x03, 0x00, 0x57, 0x00, 0x00,
+    0x00, 0x03, 0x5f, 0x00, 0x03, 0x00, 0x03, 0x4f, 0x14, 0x11, 0x14, 0x10,
+    0x04, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x37, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xc4, 0x17,
+    0x21, 0x22, 0x17, 0x01, 0x2c, 0x40, 0x3f, 0x2d, 0x01, 0xf2, 0x24, 0x18,
+    0x18, 0x25, 0x2e, 0x3f, 0x2d, 0x2d, 0x3e, 0x00, 0x00, 0x01, 0x00, 0xb8,
+    0x02, 0x2e, 0x01, 0x5a, 0x02, 0xc0, 0x00, 0x03, 0x00, 0x1f, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x14, 0x00, 0x00, 0x01, 0x00, 0x83, 0x02, 0x01, 0x01,
+    0x01, 0x74, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x07, 0x15,
+    0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x37, 0x33, 0x07, 0xb8, 0x5b, 0x47,
+    0x76, 0x02, 0x2e, 0x92, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd6,
+    0xff, 0x42, 0x01, 0x1f, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x26, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00,
+    0x00, 0x01, 0x5d, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4d, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x03, 0x11, 0x03, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x17, 0x35, 0x33, 0x15, 0xd6, 0x49, 0xbe, 0xdc, 0xdc, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xdd, 0x01, 0xbd, 0x01, 0x24, 0x02, 0x99, 0x00, 0x03,
+    0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x02, 0x01, 0x01, 0x00, 0x01,
+    0x4d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x11, 0x03, 0x07, 0x15, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x13, 0x35, 0x33, 0x15, 0xdd, 0x47, 0x01, 0xbd,
+    0xdc, 0xdc, 0x00, 0x00, 0x00, 0x01, 0x00, 0xd8, 0x02, 0x0a, 0x01, 0x63,
+    0x02, 0xb9, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03, 0x01, 0x01, 0x30, 0x2b,
+    0x13, 0x37, 0x17, 0x07, 0xd8, 0x54, 0x37, 0x65, 0x02, 0x24, 0x95, 0x28,
+    0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x65, 0x02, 0x0c, 0x01, 0x8d,
+    0x02, 0x86, 0x00, 0x0b, 0x00, 0x2d, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x22,
+    0x08, 0x07, 0x02, 0x01, 0x04, 0x00, 0x48, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01, 0x4f,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b, 0xb1,
+    0x06, 0x00, 0x44, 0x12, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x37, 0x17,
+    0x06, 0x06, 0x23, 0xa6, 0x41, 0x24, 0x14, 0x3b, 0x22, 0x40, 0x37, 0x1c,
+    0x1c, 0x4d, 0x29, 0x02, 0x0c, 0x4d, 0x2d, 0x1f, 0x27, 0x46, 0x2a, 0x25,
+    0x2b, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0x02, 0x06, 0x01, 0x79,
+    0x02, 0xb6, 0x00, 0x06, 0x00, 0x1a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0f,
+    0x04, 0x03, 0x02, 0x01, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x74, 0x15,
+    0x01, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x13, 0x37, 0x17, 0x37,
+    0x17, 0x07, 0x23, 0x86, 0x2e, 0x4e, 0x51, 0x26, 0x6f, 0x16, 0x02, 0x93,
+    0x23, 0x67, 0x66, 0x23, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xa9,
+    0xff, 0x3b, 0x01, 0x80, 0x00, 0x00, 0x00, 0x13, 0x00, 0x3e, 0xb1, 0x06,
+    0x64, 0x44, 0x40, 0x33, 0x0d, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, 0x01,
+    0x01, 0x01, 0x03, 0x00, 0x03, 0x4a, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02,
+    0x01, 0x67, 0x00, 0x00, 0x03, 0x03, 0x00, 0x57, 0x00, 0x00, 0x00, 0x03,
+    0x5f, 0x04, 0x01, 0x03, 0x00, 0x03, 0x4f, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x12, 0x11, 0x23, 0x23, 0x05, 0x07, 0x17, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x16, 0x27, 0x37, 0x16, 0x33, 0x32, 0x35, 0x34, 0x26, 0x23, 0x23, 0x37,
+    0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0xd7, 0x2e, 0x19, 0x26,
+    0x31, 0x32, 0x1b, 0x18, 0x1e, 0x0b, 0x2c, 0x06, 0x2a, 0x2b, 0x3c, 0x38,
+    0xc5, 0x1f, 0x2a, 0x1e, 0x24, 0x10, 0x11, 0x55, 0x2f, 0x04, 0x25, 0x18,
+    0x24, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7c, 0x02, 0x03, 0x01, 0x83,
+    0x02, 0xad, 0x00, 0x06, 0x00, 0x1a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0f,
+    0x06, 0x05, 0x02, 0x01, 0x04, 0x00, 0x47, 0x00, 0x00, 0x00, 0x74, 0x13,
+    0x01, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x07, 0x27, 0x37,
+    0x33, 0x17, 0x07, 0x00, 0xff, 0x5f, 0x24, 0x79, 0x16, 0x78, 0x2c, 0x02,
+    0x6d, 0x6a, 0x1e, 0x8c, 0x8d, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x70,
+    0x02, 0x34, 0x01, 0x87, 0x02, 0x99, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x32,
+    0xb1, 0x06, 0x64, 0x44, 0x40, 0x27, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00,
+    0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x05, 0x03, 0x04, 0x03, 0x01,
+    0x00, 0x01, 0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16, 0x12,
+    0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x12, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x32, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x8e, 0x1e, 0x1e, 0x15, 0x14, 0x1e, 0x1e, 0x14, 0x9d, 0x1d,
+    0x1d, 0x15, 0x14, 0x1e, 0x1e, 0x14, 0x02, 0x34, 0x1e, 0x14, 0x14, 0x1f,
+    0x1e, 0x15, 0x14, 0x1e, 0x1d, 0x15, 0x15, 0x1e, 0x1e, 0x15, 0x14, 0x1e,
+    0x00, 0x01, 0x00, 0xcb, 0x02, 0x29, 0x01, 0x32, 0x02, 0x90, 0x00, 0x0b,
+    0x00, 0x26, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01,
+    0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b,
+    0xb1, 0x06, 0x00, 0x44, 0x12, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0xe9, 0x1e, 0x1d, 0x16, 0x15, 0x1f, 0x1f, 0x15,
+    0x02, 0x29, 0x1e, 0x15, 0x16, 0x1e, 0x1f, 0x15, 0x15, 0x1e, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x9a, 0x01, 0xfb, 0x01, 0x25, 0x02, 0xaa, 0x00, 0x03,
+    0x00, 0x06, 0xb3, 0x03, 0x01, 0x01, 0x30, 0x2b, 0x13, 0x37, 0x17, 0x07,
+    0x9a, 0x37, 0x54, 0x26, 0x02, 0x82, 0x28, 0x95, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x7e, 0x02, 0x0a, 0x01, 0xb0, 0x02, 0xbb, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x08, 0xb5, 0x07, 0x05, 0x03, 0x01, 0x02, 0x30, 0x2b,
+    0x13, 0x37, 0x17, 0x07, 0x37, 0x37, 0x17, 0x07, 0x7e, 0x58, 0x3f, 0x65,
+    0x69, 0x58, 0x3f, 0x65, 0x02, 0x28, 0x93, 0x2a, 0x87, 0x1e, 0x93, 0x2a,
+    0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x7b, 0x02, 0x35, 0x01, 0x79,
+    0x02, 0x6d, 0x00, 0x03, 0x00, 0x20, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x15,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x5d, 0x00,
+    0x01, 0x00, 0x01, 0x4d, 0x11, 0x10, 0x02, 0x07, 0x16, 0x2b, 0xb1, 0x06,
+    0x00, 0x44, 0x13, 0x33, 0x15, 0x23, 0x7b, 0xfe, 0xfe, 0x02, 0x6d, 0x38,
+    0x00, 0x01, 0x01, 0x14, 0xff, 0x50, 0x01, 0xa8, 0x00, 0x00, 0x00, 0x0f,
+    0x00, 0x5a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x0a, 0x0c, 0x01, 0x01, 0x00,
+    0x0d, 0x01, 0x02, 0x01, 0x02, 0x4a, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40,
+    0x17, 0x00, 0x00, 0x01, 0x01, 0x00, 0x6e, 0x00, 0x01, 0x02, 0x02, 0x01,
+    0x57, 0x00, 0x01, 0x01, 0x02, 0x60, 0x03, 0x01, 0x02, 0x01, 0x02, 0x50,
+    0x1b, 0x40, 0x16, 0x00, 0x00, 0x01, 0x00, 0x83, 0x00, 0x01, 0x02, 0x02,
+    0x01, 0x57, 0x00, 0x01, 0x01, 0x02, 0x60, 0x03, 0x01, 0x02, 0x01, 0x02,
+    0x50, 0x59, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0e, 0x24, 0x14,
+    0x04, 0x07, 0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x04, 0x26, 0x35, 0x34,
+    0x37, 0x33, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x37, 0x15, 0x06, 0x23,
+    0x01, 0x3e, 0x2a, 0x50, 0x42, 0x54, 0x10, 0x0c, 0x1d, 0x1d, 0x1d, 0x26,
+    0xb0, 0x22, 0x1b, 0x32, 0x41, 0x4b, 0x1b, 0x0c, 0x10, 0x17, 0x2e, 0x17,
+    0x00, 0x02, 0x00, 0xa5, 0x02, 0x05, 0x01, 0x5c, 0x02, 0xb5, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x38, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x2d, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x02, 0x67, 0x05, 0x01, 0x03, 0x01, 0x01, 0x03,
+    0x57, 0x05, 0x01, 0x03, 0x03, 0x01, 0x5f, 0x04, 0x01, 0x01, 0x03, 0x01,
+    0x4f, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16, 0x12, 0x10, 0x00,
+    0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0xb1, 0x06, 0x00, 0x44,
+    0x12, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0xdc, 0x37, 0x37, 0x24, 0x26, 0x36, 0x37, 0x25, 0x12, 0x19, 0x19, 0x11,
+    0x11, 0x18, 0x18, 0x11, 0x02, 0x05, 0x34, 0x24, 0x24, 0x34, 0x33, 0x25,
+    0x24, 0x34, 0x2b, 0x1b, 0x13, 0x13, 0x1b, 0x1b, 0x13, 0x13, 0x1b, 0x00,
+    0xff, 0xff, 0x00, 0x65, 0x02, 0x3e, 0x01, 0xaf, 0x02, 0xab, 0x00, 0x03,
+    0x02, 0xd5, 0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xad,
+    0x02, 0x94, 0x01, 0x6d, 0x03, 0x17, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x13, 0x37, 0x17, 0x07, 0xad, 0x98, 0x28, 0xa9,
+    0x02, 0xbe, 0x59, 0x46, 0x3d, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x70,
+    0x02, 0x95, 0x01, 0x8c, 0x03, 0x09, 0x01, 0x07, 0x02, 0xd3, 0x01, 0xf0,
+    0x00, 0x7b, 0x00, 0x08, 0xb1, 0x00, 0x01, 0xb0, 0x7b, 0xb0, 0x33, 0x2b,
+    0x00, 0x01, 0x00, 0x66, 0x02, 0x8f, 0x01, 0x7a, 0x03, 0x17, 0x00, 0x06,
+    0x00, 0x12, 0x40, 0x0f, 0x04, 0x03, 0x02, 0x01, 0x04, 0x00, 0x48, 0x00,
+    0x00, 0x00, 0x74, 0x15, 0x01, 0x07, 0x15, 0x2b, 0x13, 0x37, 0x17, 0x37,
+    0x17, 0x07, 0x23, 0x66, 0x21, 0x67, 0x70, 0x1c, 0x83, 0x16, 0x02, 0xf1,
+    0x26, 0x47, 0x44, 0x21, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa1,
+    0x02, 0xb0, 0x01, 0xb8, 0x03, 0x15, 0x00, 0x0b, 0x00, 0x17, 0x00, 0x2a,
+    0x40, 0x27, 0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00,
+    0x00, 0x01, 0x5f, 0x05, 0x03, 0x04, 0x03, 0x01, 0x00, 0x01, 0x4f, 0x0c,
+    0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16, 0x12, 0x10, 0x00, 0x0b, 0x00,
+    0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0x12, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x32, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0xbf, 0x1e, 0x1e, 0x14, 0x15, 0x1e,
+    0x1e, 0x15, 0x9e, 0x1d, 0x1d, 0x14, 0x15, 0x1e, 0x1e, 0x15, 0x02, 0xb0,
+    0x1e, 0x14, 0x14, 0x1f, 0x1e, 0x15, 0x14, 0x1e, 0x1d, 0x15, 0x15, 0x1e,
+    0x1e, 0x15, 0x14, 0x1e, 0x00, 0x01, 0x00, 0xf9, 0x02, 0xb1, 0x01, 0x60,
+    0x03, 0x17, 0x00, 0x0b, 0x00, 0x1e, 0x40, 0x1b, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x02, 0x01, 0x01, 0x00, 0x01,
+    0x4f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x03, 0x07, 0x15, 0x2b,
+    0x00, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x01, 0x18, 0x1f, 0x1e, 0x15, 0x15, 0x1f, 0x1f, 0x15, 0x02, 0xb1, 0x1e,
+    0x15, 0x15, 0x1e, 0x1e, 0x15, 0x15, 0x1e, 0x00, 0x00, 0x01, 0x00, 0xbb,
+    0x02, 0x94, 0x01, 0x7c, 0x03, 0x17, 0x00, 0x03, 0x00, 0x06, 0xb3, 0x03,
+    0x01, 0x01, 0x30, 0x2b, 0x13, 0x37, 0x17, 0x07, 0xbb, 0x28, 0x99, 0x17,
+    0x02, 0xd1, 0x46, 0x59, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x70,
+    0x02, 0x85, 0x01, 0xd3, 0x03, 0x2a, 0x00, 0x03, 0x00, 0x07, 0x00, 0x08,
+    0xb5, 0x07, 0x05, 0x03, 0x01, 0x02, 0x30, 0x2b, 0x13, 0x37, 0x17, 0x07,
+    0x37, 0x37, 0x17, 0x07, 0x70, 0x83, 0x2f, 0x92, 0x92, 0x83, 0x2e, 0x91,
+    0x02, 0xae, 0x7c, 0x40, 0x65, 0x29, 0x7c, 0x40, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0xbb, 0x02, 0x6b, 0x01, 0x72, 0x03, 0x1b, 0x00, 0x0b,
+    0x00, 0x17, 0x00, 0x2a, 0x40, 0x27, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00,
+    0x02, 0x67, 0x04, 0x01, 0x01, 0x01, 0x03, 0x5f, 0x05, 0x01, 0x03, 0x03,
+    0x16, 0x01, 0x4c, 0x0c, 0x0c, 0x00, 0x00, 0x0c, 0x17, 0x0c, 0x16, 0x12,
+    0x10, 0x00, 0x0b, 0x00, 0x0a, 0x24, 0x06, 0x07, 0x15, 0x2b, 0x12, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xf1, 0x36,
+    0x37, 0x25, 0x25, 0x36, 0x35, 0x26, 0x12, 0x18, 0x18, 0x11, 0x12, 0x18,
+    0x19, 0x11, 0x02, 0x6b, 0x34, 0x24, 0x24, 0x34, 0x34, 0x25, 0x24, 0x33,
+    0x2b, 0x1a, 0x13, 0x14, 0x1a, 0x1a, 0x14, 0x13, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x65, 0x02, 0xc0, 0x01, 0xaf, 0x03, 0x2d, 0x00, 0x19,
+    0x00, 0x2d, 0x40, 0x2a, 0x19, 0x01, 0x03, 0x02, 0x0d, 0x0c, 0x02, 0x00,
+    0x01, 0x02, 0x4a, 0x00, 0x03, 0x01, 0x00, 0x03, 0x57, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x02, 0x01, 0x67, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x00, 0x00,
+    0x03, 0x00, 0x4f, 0x24, 0x25, 0x24, 0x22, 0x04, 0x07, 0x18, 0x2b, 0x01,
+    0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x01, 0xaf, 0x16, 0x29, 0x1e, 0x15, 0x21, 0x16, 0x13, 0x17, 0x0e,
+    0x12, 0x1a, 0x0c, 0x31, 0x0f, 0x33, 0x25, 0x15, 0x1e, 0x15, 0x11, 0x1a,
+    0x0f, 0x10, 0x15, 0x0e, 0x03, 0x0b, 0x2a, 0x21, 0x0f, 0x0f, 0x0c, 0x0c,
+    0x15, 0x1a, 0x16, 0x24, 0x2c, 0x0f, 0x0e, 0x0d, 0x0c, 0x14, 0x1c, 0x00,
+    0xff, 0xff, 0xfe, 0x80, 0x02, 0x1a, 0xff, 0x9c, 0x03, 0x2d, 0x00, 0x22,
+    0x02, 0xd3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xce, 0x00, 0x08, 0x00, 0x83,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x83, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0xfe, 0x80, 0x02, 0x1a, 0xff, 0x9c, 0x03, 0x2d, 0x00, 0x22,
+    0x02, 0xd3, 0x00, 0x00, 0x01, 0x07, 0x02, 0xcd, 0x00, 0x08, 0x00, 0x83,
+    0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x83, 0xb0, 0x33, 0x2b, 0x00, 0x00,
+    0xff, 0xff, 0xfe, 0x80, 0x02, 0x1a, 0xff, 0x9c, 0x03, 0x3f, 0x00, 0x22,
+    0x02, 0xd3, 0x00, 0x00, 0x01, 0x06, 0x02, 0xd7, 0x11, 0x7f, 0x00, 0x08,
+    0xb1, 0x01, 0x01, 0xb0, 0x7f, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xfe, 0x7d,
+    0x02, 0x1a, 0xff, 0x9e, 0x03, 0x14, 0x00, 0x22, 0x02, 0xd3, 0x00, 0x00,
+    0x01, 0x06, 0x02, 0xf0, 0xff, 0x77, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0,
+    0x77, 0xb0, 0x33, 0x2b, 0xff, 0xff, 0xfe, 0x75, 0x01, 0xff, 0xff, 0xf8,
+    0x03, 0x26, 0x00, 0x22, 0x02, 0xd1, 0x06, 0x00, 0x01, 0x07, 0x02, 0xce,
+    0x00, 0x89, 0x00, 0x7c, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x7c, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x77, 0x01, 0xff, 0xff, 0xb3,
+    0x03, 0x3b, 0x00, 0x22, 0x02, 0xd1, 0x08, 0x00, 0x01, 0x07, 0x02, 0xcd,
+    0x00, 0x82, 0x00, 0x91, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x91, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x71, 0x01, 0xff, 0xff, 0xd5,
+    0x03, 0x24, 0x00, 0x22, 0x02, 0xd1, 0x02, 0x00, 0x01, 0x07, 0x02, 0xd7,
+    0x00, 0x89, 0x00, 0x64, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x64, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x78, 0x01, 0xff, 0xff, 0xa6,
+    0x03, 0x2a, 0x00, 0x22, 0x02, 0xd1, 0x09, 0x00, 0x01, 0x07, 0x02, 0xf0,
+    0x00, 0x00, 0x00, 0x8d, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x8d, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x68, 0x02, 0x8f, 0x00, 0x27,
+    0x03, 0x81, 0x00, 0x22, 0x02, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe8,
+    0x00, 0xae, 0x00, 0x6a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x6a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x68, 0x02, 0x8f, 0xff, 0xa4,
+    0x03, 0xa1, 0x00, 0x22, 0x02, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xe7,
+    0x00, 0x00, 0x00, 0x8a, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0x8a, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x68, 0x02, 0x8f, 0xff, 0xd2,
+    0x03, 0xa2, 0x00, 0x22, 0x02, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xd7,
+    0x00, 0x86, 0x00, 0xe2, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xe2, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0xff, 0xff, 0xfe, 0x68, 0x02, 0x8f, 0xff, 0xa4,
+    0x03, 0x97, 0x00, 0x22, 0x02, 0xea, 0x00, 0x00, 0x01, 0x07, 0x02, 0xf0,
+    0xff, 0xf6, 0x00, 0xfa, 0x00, 0x08, 0xb1, 0x01, 0x01, 0xb0, 0xfa, 0xb0,
+    0x33, 0x2b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x02, 0x01, 0xe5,
+    0x02, 0x59, 0x00, 0x07, 0x00, 0x27, 0x00, 0x33, 0x00, 0x0a, 0xb7, 0x2c,
+    0x28, 0x11, 0x08, 0x06, 0x02, 0x03, 0x30, 0x2b, 0x13, 0x35, 0x13, 0x33,
+    0x13, 0x15, 0x03, 0x23, 0x37, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x17, 0x17, 0x37, 0x26, 0x36, 0x37,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x15,
+    0x16, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33,
+    0x0f, 0xe1, 0x1e, 0xd7, 0xd7, 0x1e, 0x1f, 0x18, 0x17, 0x17, 0x17, 0x3b,
+    0x30, 0x29, 0x38, 0x1a, 0x1c, 0x08, 0x04, 0x01, 0x07, 0x0d, 0x1c, 0x21,
+    0x1d, 0x26, 0x15, 0x15, 0x19, 0x18, 0x28, 0x16, 0x16, 0x0e, 0x0f, 0x14,
+    0x14, 0x0f, 0x01, 0x23, 0x1e, 0x01, 0x18, 0xfe, 0xe8, 0x1e, 0xfe, 0xdf,
+    0xb1, 0x19, 0x1e, 0x25, 0x14, 0x15, 0x24, 0x1d, 0x2d, 0x37, 0x20, 0x21,
+    0x16, 0x07, 0x06, 0x09, 0x0f, 0x08, 0x12, 0x1e, 0x21, 0x18, 0x20, 0x14,
+    0x19, 0x27, 0x20, 0x19, 0x7a, 0x15, 0x0e, 0x0f, 0x15, 0x15, 0x0f, 0x0e,
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x41,
+    0x43, 0xaa, 0xaf, 0x9e, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x03, 0x03, 0xe8,
+    0x00, 0x00, 0x00, 0x00, 0xd4, 0xb7, 0x6e, 0xe7, 0x00, 0x00, 0x00, 0x00,
+    0xd4, 0xf5, 0x79, 0x90, 0xfe, 0x53, 0xfe, 0xed, 0x02, 0x2e, 0x03, 0xc3,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x5b, 0xff, 0x42, 0x00, 0x00, 0x01, 0xf4,
+    0xfe, 0x53, 0xff, 0xc6, 0x02, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f,
+    0x01, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x0f,
+    0x01, 0xf4, 0x00, 0x0f, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x36, 0x01, 0xf4, 0x00, 0x1e, 0x01, 0xf4, 0x00, 0x36,
+    0x01, 0xf4, 0x00, 0x1e, 0x01, 0xf4, 0x00, 0x36, 0x01, 0xf4, 0x00, 0x36,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x47,
+    0x01, 0xf4, 0x00, 0x4e, 0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x24,
+    0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x24,
+    0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51,
+    0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x3f,
+    0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51,
+    0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51,
+    0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51, 0x01, 0xf4, 0x00, 0x51,
+    0x01, 0xf4, 0x00, 0x50, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x2a, 0x01, 0xf4, 0x00, 0x2a, 0x01, 0xf4, 0x00, 0x2a,
+    0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42,
+    0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42,
+    0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42,
+    0x01, 0xf4, 0x00, 0x14, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x09, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x1d, 0x01, 0xf4, 0x00, 0x38,
+    0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38,
+    0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38,
+    0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34,
+    0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34,
+    0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34,
+    0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34, 0x01, 0xf4, 0x00, 0x34,
+    0x01, 0xf4, 0x00, 0x37, 0x01, 0xf4, 0x00, 0x1b, 0x01, 0xf4, 0x00, 0x1f,
+    0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x1f,
+    0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x1f,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d,
+    0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x19,
+    0x01, 0xf4, 0x00, 0x11, 0x01, 0xf4, 0x00, 0x11, 0x01, 0xf4, 0x00, 0x11,
+    0x01, 0xf4, 0x00, 0x11, 0x01, 0xf4, 0x00, 0x11, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x1c,
+    0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x1c,
+    0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x1c,
+    0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x0a,
+    0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x3c, 0x01, 0xf4, 0x00, 0x1b,
+    0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38,
+    0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x38,
+    0x01, 0xf4, 0x00, 0x38, 0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x28,
+    0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d,
+    0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x37,
+    0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x37, 0x01, 0xf4, 0x00, 0x5b,
+    0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0x26, 0x01, 0xf4, 0x00, 0x26,
+    0x01, 0xf4, 0x00, 0x26, 0x01, 0xf4, 0x00, 0x26, 0x01, 0xf4, 0x00, 0x26,
+    0x01, 0xf4, 0x00, 0x26, 0x01, 0xf4, 0x00, 0x26, 0x01, 0xf4, 0x00, 0x49,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x49, 0x01, 0xf4, 0xff, 0xd8,
+    0x01, 0xf4, 0x00, 0x49, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64,
+    0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64,
+    0x01, 0xf4, 0x00, 0x4a, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64,
+    0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64,
+    0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64,
+    0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x64, 0x01, 0xf4, 0x00, 0x30,
+    0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x42,
+    0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x42, 0x01, 0xf4, 0x00, 0x4f,
+    0x01, 0xf4, 0x00, 0x4f, 0x01, 0xf4, 0x00, 0x4f, 0x01, 0xf4, 0x00, 0x4f,
+    0x01, 0xf4, 0x00, 0x45, 0x01, 0xf4, 0x00, 0x4f, 0x01, 0xf4, 0x00, 0x13,
+    0x01, 0xf4, 0x00, 0x4f, 0x01, 0xf4, 0x00, 0x4f, 0x01, 0xf4, 0x00, 0x26,
+    0x01, 0xf4, 0x00, 0x26, 0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x48,
+    0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x48,
+    0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0x48,
+    0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x28,
+    0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x06,
+    0x01, 0xf4, 0x00, 0x3c, 0x01, 0xf4, 0x00, 0x3c, 0x01, 0xf4, 0x00, 0x2a,
+    0x01, 0xf4, 0x00, 0x77, 0x01, 0xf4, 0x00, 0x77, 0x01, 0xf4, 0x00, 0x62,
+    0x01, 0xf4, 0x00, 0x77, 0x01, 0xf4, 0x00, 0x4a, 0x01, 0xf4, 0x00, 0x77,
+    0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0x6c, 0x01, 0xf4, 0x00, 0x77,
+    0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39,
+    0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39,
+    0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39,
+    0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39,
+    0x01, 0xf4, 0x00, 0x37, 0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0x3d,
+    0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0x46,
+    0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0x46, 0x01, 0xf4, 0x00, 0x46,
+    0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40,
+    0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
+    0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x28,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0x40,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x28,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10,
+    0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x2f,
+    0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x16,
+    0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x16,
+    0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x16,
+    0x01, 0xf4, 0x00, 0x16, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x3f, 0x01, 0xf4, 0x00, 0x21,
+    0x01, 0xf4, 0x00, 0x21, 0x01, 0xf4, 0x00, 0x4c, 0x01, 0xf4, 0x00, 0x4c,
+    0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x32, 0x01, 0xf4, 0x00, 0x39,
+    0x01, 0xf4, 0x00, 0x58, 0x01, 0xf4, 0x00, 0x3a, 0x01, 0xf4, 0x00, 0x45,
+    0x01, 0xf4, 0x00, 0x30, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x43,
+    0x01, 0xf4, 0x00, 0x4f, 0x01, 0xf4, 0x00, 0x3c, 0x01, 0xf4, 0x00, 0x44,
+    0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x39, 0x01, 0xf4, 0x00, 0x78,
+    0x01, 0xf4, 0x00, 0x7a, 0x01, 0xf4, 0x00, 0x6f, 0x01, 0xf4, 0x00, 0x70,
+    0x01, 0xf4, 0x00, 0x5b, 0x01, 0xf4, 0x00, 0x7b, 0x01, 0xf4, 0x00, 0x79,
+    0x01, 0xf4, 0x00, 0x92, 0x01, 0xf4, 0x00, 0x7f, 0x01, 0xf4, 0x00, 0x92,
+    0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x7a, 0x01, 0xf4, 0x00, 0x6f,
+    0x01, 0xf4, 0x00, 0x70, 0x01, 0xf4, 0x00, 0x5b, 0x01, 0xf4, 0x00, 0x7b,
+    0x01, 0xf4, 0x00, 0x79, 0x01, 0xf4, 0x00, 0x92, 0x01, 0xf4, 0x00, 0x7f,
+    0x01, 0xf4, 0x00, 0x92, 0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x7a,
+    0x01, 0xf4, 0x00, 0x6f, 0x01, 0xf4, 0x00, 0x70, 0x01, 0xf4, 0x00, 0x5b,
+    0x01, 0xf4, 0x00, 0x7b, 0x01, 0xf4, 0x00, 0x79, 0x01, 0xf4, 0x00, 0x92,
+    0x01, 0xf4, 0x00, 0x7f, 0x01, 0xf4, 0x00, 0x92, 0x01, 0xf4, 0x00, 0x78,
+    0x01, 0xf4, 0x00, 0x7a, 0x01, 0xf4, 0x00, 0x6f, 0x01, 0xf4, 0x00, 0x70,
+    0x01, 0xf4, 0x00, 0x5b, 0x01, 0xf4, 0x00, 0x7b, 0x01, 0xf4, 0x00, 0x79,
+    0x01, 0xf4, 0x00, 0x92, 0x01, 0xf4, 0x00, 0x7f, 0x01, 0xf4, 0x00, 0x92,
+    0x01, 0xf4, 0x00, 0x4c, 0x01, 0xf4, 0x00, 0x05, 0x01, 0xf4, 0x00, 0x05,
+    0x01, 0xf4, 0x00, 0x0b, 0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x78,
+    0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x78,
+    0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x78, 0x01, 0xf4, 0x00, 0x78,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0xb3,
+    0x01, 0xf4, 0x00, 0xab, 0x01, 0xf4, 0x00, 0xb3, 0x01, 0xf4, 0x00, 0xa5,
+    0x01, 0xf4, 0x00, 0x07, 0x01, 0xf4, 0x00, 0xb4, 0x01, 0xf4, 0x00, 0xb4,
+    0x01, 0xf4, 0x00, 0xc8, 0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0xb4,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x87,
+    0x01, 0xf4, 0x00, 0xd2, 0x01, 0xf4, 0x00, 0xa5, 0x01, 0xf4, 0x00, 0x40,
+    0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0xb3, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x71, 0x01, 0xf4, 0x00, 0xce, 0x01, 0xf4, 0x00, 0x35,
+    0x01, 0xf4, 0x00, 0x36, 0x01, 0xf4, 0x00, 0x83, 0x01, 0xf4, 0x00, 0x83,
+    0x01, 0xf4, 0x00, 0x7a, 0x01, 0xf4, 0x00, 0x72, 0x01, 0xf4, 0x00, 0x0a,
+    0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x14, 0x01, 0xf4, 0x00, 0x0a,
+    0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x47,
+    0x01, 0xf4, 0x00, 0x43, 0x01, 0xf4, 0x00, 0x48, 0x01, 0xf4, 0x00, 0x91,
+    0x01, 0xf4, 0x00, 0x91, 0x01, 0xf4, 0x00, 0x3d, 0x01, 0xf4, 0x00, 0x4f,
+    0x01, 0xf4, 0x00, 0x52, 0x01, 0xf4, 0x00, 0xb6, 0x01, 0xf4, 0x00, 0xa5,
+    0x01, 0xf4, 0x00, 0xa5, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x38,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x44, 0x01, 0xf4, 0x00, 0x3c,
+    0x01, 0xf4, 0x00, 0x41, 0x01, 0xf4, 0x00, 0x21, 0x01, 0xf4, 0x00, 0x12,
+    0x01, 0xf4, 0x00, 0x15, 0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x0e,
+    0x01, 0xf4, 0x00, 0x27, 0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0x32,
+    0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x36, 0x01, 0xf4, 0x00, 0x0d,
+    0x01, 0xf4, 0x00, 0x13, 0x01, 0xf4, 0x00, 0x33, 0x01, 0xf4, 0x00, 0x27,
+    0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x8e, 0x01, 0xf4, 0x00, 0x33, 0x01, 0xf4, 0x00, 0x28,
+    0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x2d,
+    0x01, 0xf4, 0x00, 0x55, 0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x2d,
+    0x01, 0xf4, 0x00, 0x2d, 0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x23,
+    0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x2d,
+    0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x5b,
+    0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x0d, 0x01, 0xf4, 0x00, 0x49,
+    0x01, 0xf4, 0x00, 0x14, 0x01, 0xf4, 0x00, 0x20, 0x01, 0xf4, 0x00, 0x36,
+    0x01, 0xf4, 0x00, 0x24, 0x01, 0xf4, 0x00, 0x0c, 0x01, 0xf4, 0x00, 0x18,
+    0x01, 0xf4, 0x00, 0x23, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x14,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x47, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x10, 0x01, 0xf4, 0x00, 0x0e,
+    0x01, 0xf4, 0x00, 0x3b, 0x01, 0xf4, 0x00, 0x0b, 0x01, 0xf4, 0x00, 0x17,
+    0x01, 0xf4, 0x00, 0x0b, 0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x3b,
+    0x01, 0xf4, 0x00, 0x22, 0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x22,
+    0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x22, 0x01, 0xf4, 0x00, 0x0a,
+    0x01, 0xf4, 0x00, 0x22, 0x01, 0xf4, 0x00, 0x0a, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0x19,
+    0x01, 0xf4, 0x00, 0x2f, 0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x29,
+    0x01, 0xf4, 0x00, 0x28, 0x01, 0xf4, 0x00, 0x0d, 0x01, 0xf4, 0x00, 0x05,
+    0x01, 0xf4, 0x00, 0x0c, 0x01, 0xf4, 0x00, 0x0f, 0x01, 0xf4, 0x00, 0x09,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x55, 0x01, 0xf4, 0x00, 0x00,
+    0x01, 0xf4, 0x00, 0x04, 0x01, 0xf4, 0x00, 0x1f, 0x01, 0xf4, 0x00, 0x24,
+    0x01, 0xf4, 0x00, 0x40, 0x01, 0xf4, 0x00, 0x41, 0x01, 0xf4, 0x00, 0x0e,
+    0x01, 0xf4, 0x00, 0x0e, 0x01, 0xf4, 0x00, 0x12, 0x01, 0xf4, 0x00, 0x79,
+    0x01, 0xf4, 0x00, 0xd9, 0x01, 0xf4, 0x00, 0xd9, 0x01, 0xf4, 0x00, 0x31,
+    0x01, 0xf4, 0x00, 0x17, 0x01, 0xf4, 0x00, 0x31, 0x01, 0xf4, 0x00, 0x30,
+    0x01, 0xf4, 0x00, 0x19, 0x01, 0xf4, 0x00, 0x5d, 0x01, 0xf4, 0x00, 0x30,
+    0x01, 0xf4, 0x00, 0x29, 0x01, 0xf4, 0x00, 0x1c, 0x01, 0xf4, 0x00, 0x22,
+    0x01, 0xf4, 0x00, 0x3d, 0x01, 0xf4, 0x00, 0x02, 0x01, 0xf4, 0x00, 0x16,
+    0x01, 0xf4, 0x00, 0x00, 0x01, 0xf4, 0x00, 0x15, 0x01, 0xf4, 0x00, 0x21,
+    0x01, 0xf4, 0x00, 0xc7, 0x01, 0xf4, 0x00, 0x8b, 0x01, 0xf4, 0x00, 0x5f,
+    0x01, 0xf4, 0x00, 0xad, 0x00, 0x00, 0xfe, 0x7c, 0x00, 0x00, 0xfe, 0xd7,
+    0x00, 0x00, 0xfe, 0xa6, 0x00, 0x00, 0xfe, 0xe4, 0x00, 0x00, 0xfe, 0x8a,
+    0x00, 0x00, 0xfe, 0xd9, 0x00, 0x00, 0xfe, 0x6f, 0x00, 0x00, 0xfe, 0x74,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xfe, 0xb1, 0x00, 0x00, 0xfe, 0x71,
+    0x00, 0x00, 0xfe, 0x87, 0x00, 0x00, 0xfe, 0xa5, 0x00, 0x00, 0xfe, 0x6b,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xfe, 0xb2, 0x00, 0x00, 0xff, 0x98,
+    0x00, 0x00, 0xfe, 0xc4, 0x00, 0x00, 0xfe, 0x7c, 0x00, 0x00, 0xfe, 0xbc,
+    0x00, 0x00, 0xfe, 0xb5, 0x00, 0x00, 0xfe, 0xa3, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0xfe, 0x87, 0x00, 0x00, 0xfe, 0x85, 0x00, 0x00, 0xfe, 0x53,
+    0x00, 0x00, 0xfe, 0x7b, 0x00, 0x00, 0xff, 0x05, 0x00, 0x00, 0xfe, 0xc7,
+    0x00, 0x00, 0xfe, 0xb9, 0x00, 0x00, 0xfe, 0x7c, 0x00, 0x00, 0xfe, 0x68,
+    0x00, 0x00, 0xfe, 0x7c, 0x00, 0x00, 0xfe, 0x78, 0x00, 0x00, 0xfe, 0xab,
+    0x00, 0x00, 0xfe, 0x6c, 0x00, 0x00, 0xff, 0x9a, 0x00, 0x00, 0xfe, 0x7e,
+    0x01, 0xf4, 0x00, 0xb4, 0x01, 0xf4, 0x00, 0xb2, 0x01, 0xf4, 0x00, 0x8b,
+    0x01, 0xf4, 0x00, 0x7b, 0x01, 0xf4, 0x00, 0xb4, 0x01, 0xf4, 0x00, 0xc7,
+    0x01, 0xf4, 0x00, 0xc4, 0x01, 0xf4, 0x00, 0xc3, 0x01, 0xf4, 0x00, 0xb8,
+    0x01, 0xf4, 0x00, 0xd6, 0x01, 0xf4, 0x00, 0xdd, 0x01, 0xf4, 0x00, 0xd8,
+    0x01, 0xf4, 0x00, 0x65, 0x01, 0xf4, 0x00, 0x86, 0x01, 0xf4, 0x00, 0xa9,
+    0x01, 0xf4, 0x00, 0x7c, 0x01, 0xf4, 0x00, 0x70, 0x01, 0xf4, 0x00, 0xcb,
+    0x01, 0xf4, 0x00, 0x9a, 0x01, 0xf4, 0x00, 0x7e, 0x01, 0xf4, 0x00, 0x7b,
+    0x01, 0xf4, 0x01, 0x14, 0x01, 0xf4, 0x00, 0xa5, 0x01, 0xf4, 0x00, 0x65,
+    0x01, 0xf4, 0x00, 0xad, 0x01, 0xf4, 0x00, 0x70, 0x01, 0xf4, 0x00, 0x66,
+    0x01, 0xf4, 0x00, 0xa1, 0x01, 0xf4, 0x00, 0xf9, 0x01, 0xf4, 0x00, 0xbb,
+    0x01, 0xf4, 0x00, 0x70, 0x01, 0xf4, 0x00, 0xbb, 0x01, 0xf4, 0x00, 0x65,
+    0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xfe, 0x80, 0x00, 0x00, 0xfe, 0x80,
+    0x00, 0x00, 0xfe, 0x7d, 0x00, 0x00, 0xfe, 0x75, 0x00, 0x00, 0xfe, 0x77,
+    0x00, 0x00, 0xfe, 0x71, 0x00, 0x00, 0xfe, 0x78, 0x00, 0x00, 0xfe, 0x68,
+    0x00, 0x00, 0xfe, 0x68, 0x00, 0x00, 0xfe, 0x68, 0x00, 0x00, 0xfe, 0x68,
+    0x01, 0xf4, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x42, 0x00, 0x58, 0x00, 0x68,
+    0x00, 0x7e, 0x00, 0x94, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xcc, 0x00, 0xdc,
+    0x00, 0xf2, 0x01, 0x08, 0x01, 0x1e, 0x01, 0x38, 0x01, 0x44, 0x01, 0x50,
+    0x01, 0x5c, 0x01, 0x6e, 0x01, 0x80, 0x01, 0x92, 0x01, 0xd4, 0x02, 0x26,
+    0x02, 0x84, 0x02, 0x90, 0x02, 0xd0, 0x02, 0xdc, 0x03, 0x28, 0x03, 0x74,
+    0x03, 0x80, 0x03, 0x8c, 0x04, 0x32, 0x04, 0xe6, 0x04, 0xf2, 0x04, 0xfe,
+    0x05, 0x32, 0x05, 0x76, 0x05, 0x82, 0x05, 0x8a, 0x05, 0x96, 0x05, 0xa2,
+    0x05, 0xce, 0x05, 0xda, 0x05, 0xe6, 0x05, 0xf2, 0x06, 0x02, 0x06, 0x0e,
+    0x06, 0x24, 0x06, 0x34, 0x06, 0x4a, 0x06, 0x60, 0x06, 0x76, 0x06, 0x90,
+    0x06, 0x9c, 0x06, 0xa8, 0x06, 0xb4, 0x06, 0xc0, 0x06, 0xd2, 0x06, 0xe4,
+    0x06, 0xf6, 0x07, 0x10, 0x07, 0x2a, 0x07, 0x36, 0x07, 0x42, 0x07, 0x90,
+    0x07, 0xb6, 0x08, 0x0a, 0x08, 0x16, 0x08, 0x22, 0x08, 0x2e, 0x08, 0x3a,
+    0x08, 0x46, 0x08, 0x58, 0x08, 0x8a, 0x08, 0xbc, 0x08, 0xc8, 0x08, 0xd4,
+    0x08, 0xe0, 0x09, 0x08, 0x09, 0x14, 0x09, 0x20, 0x09, 0x2c, 0x09, 0x46,
+    0x09, 0x52, 0x09, 0x68, 0x09, 0x74, 0x09, 0x80, 0x09, 0x8c, 0x09, 0x9e,
+    0x09, 0xb0, 0x09, 0xc2, 0x09, 0xfe, 0x0a, 0x0e, 0x0a, 0x4c, 0x0a, 0x58,
+    0x0a, 0x8a, 0x0a, 0x96, 0x0a, 0xdc, 0x0a, 0xfe, 0x0b, 0x5e, 0x0b, 0x6a,
+    0x0b, 0xbc, 0x0b, 0xc8, 0x0b, 0xd4, 0x0b, 0xe0, 0x0c, 0x4a, 0x0c, 0x56,
+    0x0c, 0x8c, 0x0c, 0xba, 0x0c, 0xc6, 0x0c, 0xf2, 0x0c, 0xfe, 0x0d, 0x0a,
+    0x0d, 0x16, 0x0d, 0x22, 0x0d, 0x2e, 0x0d, 0x86, 0x0d, 0x92, 0x0d, 0x9e,
+    0x0d, 0xda, 0x0d, 0xe6, 0x0d, 0xf2, 0x0d, 0xfe, 0x0e, 0x14, 0x0e, 0x24,
+    0x0e, 0x3a, 0x0e, 0x50, 0x0e, 0x66, 0x0e, 0x80, 0x0e, 0x8c, 0x0e, 0xa2,
+    0x0e, 0xb8, 0x0e, 0xc4, 0x0e, 0xd0, 0x0e, 0xe2, 0x0f, 0x42, 0x0f, 0x4e,
+    0x0f, 0x5a, 0x0f, 0x66, 0x0f, 0x78, 0x0f, 0x84, 0x0f, 0x90, 0x0f, 0xa2,
+    0x0f, 0xb4, 0x0f, 0xce, 0x0f, 0xe8, 0x10, 0x32, 0x10, 0x90, 0x10, 0x9c,
+    0x10, 0xa8, 0x10, 0xbe, 0x10, 0xd4, 0x10, 0xee, 0x11, 0xbe, 0x11, 0xf4,
+    0x12, 0x3a, 0x12, 0xa6, 0x12, 0xe6, 0x12, 0xf2, 0x12, 0xfe, 0x13, 0x0a,
+    0x13, 0x24, 0x13, 0x30, 0x13, 0x42, 0x13, 0x4e, 0x13, 0xb0, 0x13, 0xbc,
+    0x13, 0xd2, 0x13, 0xde, 0x13, 0xf4, 0x14, 0xac, 0x14, 0xb8, 0x14, 0xc4,
+    0x14, 0xd0, 0x14, 0xdc, 0x14, 0xec, 0x15, 0x64, 0x15, 0x6c, 0x15, 0x8c,
+    0x15, 0xbe, 0x15, 0xca, 0x15, 0xd6, 0x15, 0xe2, 0x15, 0xee, 0x15, 0xfa,
+    0x16, 0x2e, 0x16, 0x3a, 0x16, 0x46, 0x16, 0x52, 0x16, 0x6c, 0x16, 0x78,
+    0x16, 0x84, 0x16, 0x90, 0x16, 0xa2, 0x16, 0xf8, 0x17, 0x04, 0x17, 0x10,
+    0x17, 0x1c, 0x17, 0x2e, 0x17, 0x3a, 0x17, 0x46, 0x17, 0x58, 0x17, 0x6a,
+    0x17, 0x84, 0x17, 0xd2, 0x17, 0xde, 0x17, 0xea, 0x18, 0x00, 0x18, 0x20,
+    0x18, 0x50, 0x18, 0x5c, 0x18, 0x68, 0x18, 0x74, 0x18, 0x80, 0x18, 0xaa,
+    0x18, 0xce, 0x18, 0xda, 0x18, 0xe6, 0x18, 0xf2, 0x18, 0xfe, 0x19, 0x0a,
+    0x19, 0x16, 0x19, 0x28, 0x19, 0x3a, 0x19, 0x46, 0x19, 0x78, 0x19, 0x84,
+    0x19, 0x90, 0x19, 0x9c, 0x19, 0xa8, 0x19, 0xce, 0x1a, 0x6c, 0x1a, 0x78,
+    0x1a, 0x84, 0x1a, 0x9a, 0x1a, 0xaa, 0x1a, 0xc0, 0x1a, 0xd6, 0x1a, 0xec,
+    0x1a, 0xf8, 0x1b, 0x0e, 0x1b, 0x1e, 0x1b, 0x34, 0x1b, 0x4a, 0x1b, 0x60,
+    0x1b, 0x70, 0x1b, 0x7c, 0x1b, 0x88, 0x1b, 0x94, 0x1b, 0xa0, 0x1b, 0xac,
+    0x1b, 0xb8, 0x1c, 0xaa, 0x1c, 0xb6, 0x1c, 0xcc, 0x1c, 0xd8, 0x1d, 0x82,
+    0x1d, 0x8e, 0x1e, 0x1c, 0x1e, 0x70, 0x1e, 0xba, 0x1e, 0xc6, 0x1e, 0xd2,
+    0x1f, 0x76, 0x20, 0x26, 0x20, 0x32, 0x20, 0x3e, 0x20, 0xae, 0x21, 0x0e,
+    0x21, 0x98, 0x22, 0x1a, 0x22, 0x26, 0x22, 0x32, 0x22, 0x7e, 0x22, 0x8a,
+    0x22, 0x96, 0x22, 0xa2, 0x23, 0x7a, 0x23, 0x86, 0x23, 0x9c, 0x23, 0xac,
+    0x23, 0xc2, 0x23, 0xd8, 0x23, 0xee, 0x23, 0xfe, 0x24, 0x0a, 0x24, 0x16,
+    0x24, 0x22, 0x24, 0x2e, 0x24, 0x3a, 0x24, 0x46, 0x24, 0x52, 0x24, 0x68,
+    0x24, 0x7e, 0x24, 0x8a, 0x24, 0xec, 0x24, 0xf8, 0x25, 0x44, 0x25, 0x54,
+    0x25, 0xac, 0x26, 0x84, 0x26, 0x90, 0x26, 0x9c, 0x26, 0xa8, 0x26, 0xba,
+    0x26, 0xc6, 0x26, 0xd2, 0x27, 0x0c, 0x27, 0x5a, 0x27, 0x66, 0x27, 0x78,
+    0x27, 0x84, 0x27, 0x90, 0x27, 0xb4, 0x27, 0xc0, 0x27, 0xcc, 0x27, 0xd8,
+    0x27, 0xe8, 0x27, 0xf4, 0x28, 0x0a, 0x28, 0x16, 0x28, 0x26, 0x28, 0x32,
+    0x28, 0x3e, 0x28, 0x4a, 0x28, 0x56, 0x28, 0xaa, 0x28, 0xb6, 0x28, 0xc2,
+    0x28, 0xfe, 0x29, 0x0a, 0x29, 0x3c, 0x29, 0x48, 0x29, 0x76, 0x29, 0x9a,
+    0x29, 0xac, 0x29, 0xb8, 0x29, 0xc4, 0x2a, 0x00, 0x2a, 0x0c, 0x2a, 0x9c,
+    0x2a, 0xa8, 0x2a, 0xdc, 0x2b, 0x5a, 0x2b, 0x66, 0x2b, 0xc8, 0x2b, 0xd4,
+    0x2b, 0xe0, 0x2b, 0xec, 0x2b, 0xf8, 0x2c, 0x04, 0x2c, 0x8e, 0x2c, 0x9a,
+    0x2c, 0xa6, 0x2c, 0xea, 0x2c, 0xf6, 0x2d, 0x02, 0x2d, 0x0e, 0x2d, 0x24,
+    0x2d, 0x34, 0x2d, 0x4a, 0x2d, 0x60, 0x2d, 0x76, 0x2d, 0x86, 0x2d, 0x92,
+    0x2d, 0xa8, 0x2d, 0xbe, 0x2d, 0xca, 0x2d, 0xd6, 0x2d, 0xe2, 0x2e, 0x50,
+    0x2e, 0x5c, 0x2e, 0x68, 0x2e, 0x74, 0x2e, 0x80, 0x2e, 0x8c, 0x2e, 0x98,
+    0x2e, 0xa4, 0x2e, 0xb0, 0x2e, 0xc6, 0x2e, 0xdc, 0x2f, 0x2c, 0x2f, 0x8c,
+    0x2f, 0x98, 0x2f, 0xa4, 0x2f, 0xba, 0x2f, 0xd0, 0x2f, 0xe6, 0x30, 0x7a,
+    0x30, 0xda, 0x31, 0x2a, 0x31, 0x88, 0x31, 0xf2, 0x31, 0xfe, 0x32, 0x0a,
+    0x32, 0x16, 0x32, 0x26, 0x32, 0x32, 0x32, 0x8e, 0x32, 0x9a, 0x32, 0xa6,
+    0x33, 0x2e, 0x33, 0x8c, 0x33, 0x98, 0x33, 0xae, 0x33, 0xba, 0x33, 0xd0,
+    0x34, 0x84, 0x34, 0x90, 0x34, 0x9c, 0x34, 0xa8, 0x34, 0xb4, 0x34, 0xc4,
+    0x35, 0x3a, 0x35, 0x82, 0x35, 0xd6, 0x35, 0xe8, 0x36, 0x90, 0x36, 0x9c,
+    0x36, 0xae, 0x36, 0xba, 0x36, 0xc6, 0x37, 0x32, 0x37, 0x3e, 0x37, 0x4a,
+    0x37, 0x56, 0x37, 0x66, 0x37, 0x72, 0x37, 0x7e, 0x37, 0x8a, 0x37, 0x96,
+    0x37, 0xa2, 0x37, 0xb2, 0x37, 0xc2, 0x37, 0xd2, 0x37, 0xe2, 0x37, 0xf2,
+    0x37, 0xfe, 0x38, 0x0a, 0x38, 0x16, 0x38, 0x2c, 0x38, 0xcc, 0x38, 0xd8,
+    0x38, 0xe4, 0x38, 0xfa, 0x39, 0x24, 0x39, 0x58, 0x39, 0x64, 0x39, 0x70,
+    0x39, 0x7c, 0x39, 0x88, 0x39, 0xb0, 0x39, 0xf8, 0x3a, 0x04, 0x3a, 0x10,
+    0x3a, 0x1c, 0x3a, 0x28, 0x3a, 0x34, 0x3a, 0x40, 0x3a, 0x4c, 0x3a, 0x58,
+    0x3a, 0x64, 0x3a, 0x96, 0x3a, 0xa2, 0x3a, 0xae, 0x3a, 0xba, 0x3a, 0xc6,
+    0x3b, 0x32, 0x3b, 0x5e, 0x3b, 0xe2, 0x3c, 0x5e, 0x3d, 0x16, 0x3d, 0x76,
+    0x3d, 0x7e, 0x3d, 0xa8, 0x3d, 0xf6, 0x3e, 0x16, 0x3e, 0x62, 0x3e, 0xc4,
+    0x3e, 0xf8, 0x3f, 0x50, 0x3f, 0xb8, 0x3f, 0xde, 0x40, 0x44, 0x40, 0xaa,
+    0x40, 0xe6, 0x40, 0xf8, 0x41, 0x44, 0x41, 0x7a, 0x41, 0x8a, 0x41, 0x9a,
+    0x41, 0xaa, 0x41, 0xfc, 0x42, 0x5e, 0x42, 0x80, 0x42, 0xe0, 0x43, 0x42,
+    0x43, 0x4a, 0x43, 0x52, 0x43, 0x62, 0x43, 0x72, 0x43, 0x82, 0x43, 0x8a,
+    0x43, 0x92, 0x43, 0x9a, 0x43, 0xa2, 0x43, 0xaa, 0x43, 0xb2, 0x43, 0xba,
+    0x43, 0xc2, 0x43, 0xca, 0x43, 0xd2, 0x43, 0xda, 0x43, 0xe2, 0x43, 0xea,
+    0x43, 0xf2, 0x43, 0xfa, 0x44, 0x58, 0x44, 0x82, 0x44, 0xe0, 0x45, 0x58,
+    0x45, 0x9c, 0x46, 0x02, 0x46, 0x78, 0x46, 0xa8, 0x47, 0x18, 0x47, 0xa4,
+    0x47, 0xb6, 0x48, 0x1e, 0x48, 0x74, 0x49, 0x0a, 0x49, 0x1a, 0x49, 0x2a,
+    0x49, 0x32, 0x49, 0x80, 0x49, 0xba, 0x49, 0xc2, 0x49, 0xca, 0x4a, 0x48,
+    0x4a, 0x72, 0x4a, 0x84, 0x4a, 0xaa, 0x4a, 0xd0, 0x4b, 0x0c, 0x4b, 0x32,
+    0x4b, 0x7e, 0x4b, 0xb2, 0x4b, 0xee, 0x4c, 0x1a, 0x4c, 0xa6, 0x4c, 0xc8,
+    0x4d, 0x26, 0x4d, 0x88, 0x4d, 0x94, 0x4d, 0xb6, 0x4d, 0xfa, 0x4e, 0x0c,
+    0x4e, 0x2a, 0x4e, 0x32, 0x4e, 0x5c, 0x4e, 0x68, 0x4e, 0x88, 0x4e, 0xd4,
+    0x4f, 0x1e, 0x4f, 0x50, 0x4f, 0x84, 0x4f, 0xa6, 0x4f, 0xc6, 0x4f, 0xe0,
+    0x4f, 0xfe, 0x50, 0x18, 0x50, 0x20, 0x50, 0x3a, 0x50, 0x42, 0x50, 0x5c,
+    0x50, 0x7c, 0x50, 0x9c, 0x50, 0xb0, 0x50, 0xc4, 0x51, 0x04, 0x51, 0x4c,
+    0x51, 0x96, 0x51, 0xc0, 0x51, 0xe8, 0x52, 0x0e, 0x52, 0x0e, 0x52, 0x0e,
+    0x52, 0x0e, 0x52, 0x0e, 0x52, 0x0e, 0x52, 0x0e, 0x52, 0x70, 0x52, 0xe8,
+    0x53, 0x86, 0x53, 0xe8, 0x54, 0x64, 0x55, 0x3a, 0x55, 0xa2, 0x56, 0x12,
+    0x56, 0x4a, 0x56, 0xb6, 0x56, 0xf6, 0x56, 0xfe, 0x57, 0x4a, 0x57, 0x88,
+    0x57, 0xd8, 0x58, 0xf2, 0x59, 0x66, 0x59, 0xae, 0x59, 0xdc, 0x5a, 0x4c,
+    0x5a, 0xae, 0x5a, 0xf2, 0x5b, 0x12, 0x5b, 0x2c, 0x5b, 0x3e, 0x5b, 0x62,
+    0x5b, 0x6a, 0x5b, 0x92, 0x5b, 0xac, 0x5b, 0xca, 0x5c, 0x14, 0x5c, 0x46,
+    0x5c, 0x6a, 0x5c, 0x80, 0x5c, 0x96, 0x5c, 0xb4, 0x5c, 0xd2, 0x5d, 0x1a,
+    0x5d, 0x30, 0x5d, 0x7a, 0x5d, 0xaa, 0x5d, 0xf4, 0x5e, 0x3c, 0x5e, 0x62,
+    0x5e, 0x94, 0x5e, 0xae, 0x5e, 0xc8, 0x5e, 0xe6, 0x5e, 0xfe, 0x5f, 0x4e,
+    0x5f, 0x98, 0x60, 0x8a, 0x61, 0x4e, 0x61, 0x92, 0x61, 0xa0, 0x61, 0xba,
+    0x61, 0xd6, 0x61, 0xf0, 0x62, 0x0e, 0x62, 0x28, 0x62, 0x44, 0x62, 0x5e,
+    0x62, 0x7c, 0x62, 0x9e, 0x62, 0xbe, 0x62, 0xe6, 0x63, 0x0a, 0x63, 0x32,
+    0x63, 0x56, 0x63, 0x6e, 0x63, 0x84, 0x63, 0x9a, 0x63, 0xb0, 0x63, 0xd0,
+    0x64, 0x06, 0x64, 0x18, 0x64, 0x32, 0x64, 0x50, 0x64, 0xb8, 0x65, 0x20,
+    0x65, 0x72, 0x65, 0xac, 0x65, 0xee, 0x66, 0x20, 0x66, 0x38, 0x66, 0x54,
+    0x66, 0x70, 0x66, 0x78, 0x66, 0xa2, 0x66, 0xcc, 0x67, 0x8c, 0x67, 0xfe,
+    0x68, 0x2a, 0x68, 0xbc, 0x69, 0x46, 0x69, 0xc8, 0x69, 0xf0, 0x6a, 0x38,
+    0x6a, 0x5a, 0x6a, 0x8a, 0x6a, 0xc2, 0x6a, 0xfc, 0x6b, 0x48, 0x6b, 0xfe,
+    0x6c, 0x36, 0x6c, 0x56, 0x6c, 0x6a, 0x6c, 0xa4, 0x6c, 0xc0, 0x6c, 0xf4,
+    0x6d, 0x24, 0x6d, 0x56, 0x6d, 0x86, 0x6d, 0xa2, 0x6e, 0x26, 0x6e, 0x4e,
+    0x6e, 0x6a, 0x6e, 0x76, 0x6e, 0x84, 0x6e, 0x94, 0x6e, 0xd4, 0x6e, 0xfe,
+    0x6f, 0x10, 0x6f, 0x22, 0x6f, 0x3c, 0x6f, 0x5a, 0x6f, 0x7a, 0x6f, 0x9a,
+    0x6f, 0xc8, 0x70, 0x0a, 0x70, 0x50, 0x70, 0x6e, 0x70, 0xae, 0x70, 0xba,
+    0x70, 0xe8, 0x71, 0x12, 0x71, 0x48, 0x71, 0x72, 0x71, 0x82, 0x71, 0xae,
+    0x71, 0xee, 0x72, 0x0c, 0x72, 0x3a, 0x72, 0x56, 0x72, 0x74, 0x72, 0x92,
+    0x72, 0xce, 0x72, 0xf4, 0x73, 0x06, 0x73, 0x18, 0x73, 0x32, 0x73, 0x4e,
+    0x73, 0x6a, 0x73, 0x94, 0x73, 0xd0, 0x74, 0x12, 0x74, 0x40, 0x74, 0x8e,
+    0x74, 0xba, 0x74, 0xe6, 0x74, 0xf2, 0x75, 0x0e, 0x75, 0x20, 0x75, 0x28,
+    0x75, 0x5a, 0x75, 0x88, 0x75, 0xa6, 0x75, 0xc6, 0x75, 0xe6, 0x75, 0xf8,
+    0x76, 0x28, 0x76, 0x48, 0x76, 0x88, 0x76, 0xa8, 0x76, 0xe6, 0x77, 0x10,
+    0x77, 0x22, 0x77, 0x3c, 0x77, 0x58, 0x77, 0xa0, 0x77, 0xe2, 0x77, 0xec,
+    0x77, 0xfe, 0x78, 0x0c, 0x78, 0x28, 0x78, 0x62, 0x78, 0x88, 0x78, 0x9a,
+    0x78, 0xb4, 0x78, 0xf0, 0x79, 0x32, 0x79, 0x44, 0x79, 0x56, 0x79, 0x66,
+    0x79, 0x76, 0x79, 0x88, 0x79, 0x9a, 0x79, 0xac, 0x79, 0xbe, 0x79, 0xd0,
+    0x79, 0xe2, 0x79, 0xf4, 0x7a, 0x06, 0x7a, 0x59, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x1f, 0x00, 0x60, 0x00, 0x07, 0x00, 0x5c, 0x00, 0x05, 0x00, 0x02,
+    0x00, 0x24, 0x00, 0x35, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x87, 0x0d, 0x16,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x3e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x2e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x39, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x40, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x13, 0x00, 0x5e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x71, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x13, 0x00, 0x7e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x13, 0x00, 0x91, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x13, 0x00, 0xa4, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x2d, 0x00, 0xb7, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x2d, 0x00, 0xe4, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x90, 0x01, 0x11, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x01, 0xa1, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x5c, 0x01, 0xbb, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x16, 0x02, 0x17, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x02, 0x2d, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x3c, 0x02, 0x3b, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x26, 0x02, 0x77, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x1a, 0x02, 0x9d, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x26, 0x02, 0xb7, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x26, 0x02, 0xdd, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x26, 0x03, 0x03, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x5a, 0x03, 0x29, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x5a, 0x03, 0x83, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x01, 0x20, 0x03, 0xdd, 0x00, 0x03,
+    0x00, 0x01, 0x04, 0x09, 0x00, 0x0e, 0x00, 0x34, 0x04, 0xfd, 0x43, 0x6f,
+    0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x30, 0x36,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73, 0x6f,
+    0x6c, 0x61, 0x74, 0x61, 0x20, 0x50, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74,
+    0x20, 0x41, 0x75, 0x74, 0x68, 0x6f, 0x72, 0x73, 0x49, 0x6e, 0x63, 0x6f,
+    0x6e, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x52, 0x65, 0x67, 0x75, 0x6c,
+    0x61, 0x72, 0x32, 0x2e, 0x30, 0x30, 0x31, 0x3b, 0x43, 0x59, 0x52, 0x45,
+    0x3b, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61,
+    0x2d, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x49, 0x6e, 0x63, 0x6f,
+    0x6e, 0x73, 0x6f, 0x6c, 0x61, 0x74, 0x61, 0x20, 0x52, 0x65, 0x67, 0x75,
+    0x6c, 0x61, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x32,
+    0x2e, 0x30, 0x30, 0x31, 0x49, 0x6e, 0x63, 0x6f, 0x6e, 0x73, 0x6f, 0x6c,
+    0x61, 0x74, 0x61, 0x2d, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x52,
+    0x61, 0x70, 0x68, 0x20, 0x4c, 0x65, 0x76, 0x69, 0x65, 0x6e, 0x2c, 0x20,
+    0x43, 0x79, 0x72, 0x65, 0x61, 0x6c, 0x52, 0x61, 0x70, 0x68, 0x20, 0x4c,
+    0x65, 0x76, 0x69, 0x65, 0x6e, 0x2c, 0x20, 0x43, 0x79, 0x72, 0x65, 0x61,
+    0x6c, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e,
+    0x6c, 0x65, 0x76, 0x69, 0x65, 0x6e, 0x2e, 0x63, 0x6f, 0x6d, 0x20, 0x7c,
+    0x20, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e,
+    0x63, 0x79, 0x72, 0x65, 0x61, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x6c, 0x65, 0x76,
+    0x69, 0x65, 0x6e, 0x2e, 0x63, 0x6f, 0x6d, 0x20, 0x7c, 0x20, 0x68, 0x74,
+    0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x63, 0x79, 0x72,
+    0x65, 0x61, 0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x46, 0x6f, 0x6e, 0x74, 0x20, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+    0x64, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x53, 0x49, 0x4c, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x20, 0x46, 0x6f, 0x6e,
+    0x74, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x2c, 0x20, 0x56,
+    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x31, 0x2e, 0x20,
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c,
+    0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x46, 0x41, 0x51,
+    0x20, 0x61, 0x74, 0x3a, 0x20, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69, 0x6c, 0x2e,
+    0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x68, 0x74, 0x74, 0x70, 0x3a,
+    0x2f, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x2e, 0x73, 0x69,
+    0x6c, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x4f, 0x46, 0x4c, 0x00, 0x43, 0x00,
+    0x6f, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00,
+    0x68, 0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00,
+    0x36, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00,
+    0x49, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x20, 0x00,
+    0x50, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x63, 0x00,
+    0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00,
+    0x6f, 0x00, 0x72, 0x00, 0x73, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x63, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00,
+    0x74, 0x00, 0x61, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00,
+    0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x30, 0x00,
+    0x30, 0x00, 0x31, 0x00, 0x3b, 0x00, 0x43, 0x00, 0x59, 0x00, 0x52, 0x00,
+    0x45, 0x00, 0x3b, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x74, 0x00,
+    0x61, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00,
+    0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x49, 0x00, 0x6e, 0x00, 0x63, 0x00,
+    0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x61, 0x00,
+    0x74, 0x00, 0x61, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00,
+    0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x56, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00,
+    0x32, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x49, 0x00,
+    0x6e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x6f, 0x00,
+    0x6c, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x2d, 0x00, 0x52, 0x00,
+    0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00,
+    0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x68, 0x00, 0x20, 0x00, 0x4c, 0x00,
+    0x65, 0x00, 0x76, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x2c, 0x00,
+    0x20, 0x00, 0x43, 0x00, 0x79, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00,
+    0x6c, 0x00, 0x52, 0x00, 0x61, 0x00, 0x70, 0x00, 0x68, 0x00, 0x20, 0x00,
+    0x4c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6e, 0x00,
+    0x2c, 0x00, 0x20, 0x00, 0x43, 0x00, 0x79, 0x00, 0x72, 0x00, 0x65, 0x00,
+    0x61, 0x00, 0x6c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00,
+    0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00,
+    0x2e, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x76, 0x00, 0x69, 0x00, 0x65, 0x00,
+    0x6e, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x20, 0x00,
+    0x7c, 0x00, 0x20, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00,
+    0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00,
+    0x2e, 0x00, 0x63, 0x00, 0x79, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00,
+    0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x68, 0x00,
+    0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00,
+    0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x6c, 0x00, 0x65, 0x00,
+    0x76, 0x00, 0x69, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x63, 0x00,
+    0x6f, 0x00, 0x6d, 0x00, 0x20, 0x00, 0x7c, 0x00, 0x20, 0x00, 0x68, 0x00,
+    0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00,
+    0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x79, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00,
+    0x72, 0x00, 0x67, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00,
+    0x20, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00,
+    0x53, 0x00, 0x6f, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00,
+    0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6e, 0x00, 0x64, 0x00,
+    0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00,
+    0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4c, 0x00, 0x20, 0x00, 0x4f, 0x00,
+    0x70, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4c, 0x00, 0x69, 0x00, 0x63, 0x00,
+    0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x00,
+    0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00,
+    0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x31, 0x00, 0x2e, 0x00,
+    0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00,
+    0x6c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00,
+    0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00,
+    0x76, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x62, 0x00,
+    0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00,
+    0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00,
+    0x51, 0x00, 0x20, 0x00, 0x61, 0x00, 0x74, 0x00, 0x3a, 0x00, 0x20, 0x00,
+    0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, 0x00,
+    0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00,
+    0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6c, 0x00,
+    0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x4f, 0x00,
+    0x46, 0x00, 0x4c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00,
+    0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2e, 0x00, 0x73, 0x00,
+    0x69, 0x00, 0x6c, 0x00, 0x2e, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x67, 0x00,
+    0x2f, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x4c, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x51, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x00, 0x00, 0x01, 0x02, 0x00, 0x02,
+    0x00, 0x03, 0x00, 0x24, 0x00, 0xc9, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05,
+    0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x00, 0xc7, 0x01, 0x09, 0x01, 0x0a,
+    0x01, 0x0b, 0x01, 0x0c, 0x01, 0x0d, 0x01, 0x0e, 0x00, 0x62, 0x01, 0x0f,
+    0x00, 0xad, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x00, 0x63,
+    0x01, 0x14, 0x00, 0xae, 0x00, 0x90, 0x01, 0x15, 0x00, 0x25, 0x00, 0x26,
+    0x00, 0xfd, 0x00, 0xff, 0x00, 0x64, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18,
+    0x00, 0x27, 0x00, 0xe9, 0x01, 0x19, 0x01, 0x1a, 0x01, 0x1b, 0x01, 0x1c,
+    0x00, 0x28, 0x00, 0x65, 0x01, 0x1d, 0x01, 0x1e, 0x01, 0x1f, 0x00, 0xc8,
+    0x01, 0x20, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25,
+    0x00, 0xca, 0x01, 0x26, 0x01, 0x27, 0x00, 0xcb, 0x01, 0x28, 0x01, 0x29,
+    0x01, 0x2a, 0x01, 0x2b, 0x01, 0x2c, 0x01, 0x2d, 0x01, 0x2e, 0x01, 0x2f,
+    0x00, 0x29, 0x00, 0x2a, 0x00, 0xf8, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32,
+    0x01, 0x33, 0x01, 0x34, 0x00, 0x2b, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37,
+    0x01, 0x38, 0x00, 0x2c, 0x00, 0xcc, 0x01, 0x39, 0x00, 0xcd, 0x01, 0x3a,
+    0x00, 0xce, 0x01, 0x3b, 0x00, 0xfa, 0x01, 0x3c, 0x00, 0xcf, 0x01, 0x3d,
+    0x01, 0x3e, 0x01, 0x3f, 0x01, 0x40, 0x01, 0x41, 0x00, 0x2d, 0x01, 0x42,
+    0x00, 0x2e, 0x01, 0x43, 0x01, 0x44, 0x00, 0x2f, 0x01, 0x45, 0x01, 0x46,
+    0x01, 0x47, 0x01, 0x48, 0x01, 0x49, 0x01, 0x4a, 0x01, 0x4b, 0x01, 0x4c,
+    0x00, 0xe2, 0x00, 0x30, 0x01, 0x4d, 0x00, 0x31, 0x01, 0x4e, 0x01, 0x4f,
+    0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x00, 0x66,
+    0x00, 0x32, 0x00, 0xd0, 0x01, 0x55, 0x00, 0xd1, 0x01, 0x56, 0x01, 0x57,
+    0x01, 0x58, 0x01, 0x59, 0x01, 0x5a, 0x01, 0x5b, 0x00, 0x67, 0x01, 0x5c,
+    0x01, 0x5d, 0x01, 0x5e, 0x00, 0xd3, 0x01, 0x5f, 0x01, 0x60, 0x01, 0x61,
+    0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67,
+    0x01, 0x68, 0x01, 0x69, 0x01, 0x6a, 0x01, 0x6b, 0x00, 0x91, 0x01, 0x6c,
+    0x00, 0xaf, 0x01, 0x6d, 0x01, 0x6e, 0x01, 0x6f, 0x00, 0xb0, 0x00, 0x33,
+    0x00, 0xed, 0x00, 0x34, 0x00, 0x35, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72,
+    0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x00, 0x36, 0x01, 0x77,
+    0x01, 0x78, 0x00, 0xe4, 0x01, 0x79, 0x00, 0xfb, 0x01, 0x7a, 0x01, 0x7b,
+    0x01, 0x7c, 0x01, 0x7d, 0x01, 0x7e, 0x01, 0x7f, 0x01, 0x80, 0x00, 0x37,
+    0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86,
+    0x00, 0x38, 0x00, 0xd4, 0x01, 0x87, 0x00, 0xd5, 0x01, 0x88, 0x00, 0x68,
+    0x01, 0x89, 0x00, 0xd6, 0x01, 0x8a, 0x01, 0x8b, 0x01, 0x8c, 0x01, 0x8d,
+    0x01, 0x8e, 0x01, 0x8f, 0x01, 0x90, 0x01, 0x91, 0x01, 0x92, 0x01, 0x93,
+    0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x00, 0x39,
+    0x00, 0x3a, 0x01, 0x99, 0x01, 0x9a, 0x01, 0x9b, 0x01, 0x9c, 0x00, 0x3b,
+    0x00, 0x3c, 0x00, 0xeb, 0x01, 0x9d, 0x00, 0xbb, 0x01, 0x9e, 0x01, 0x9f,
+    0x01, 0xa0, 0x01, 0xa1, 0x01, 0xa2, 0x01, 0xa3, 0x00, 0x3d, 0x01, 0xa4,
+    0x00, 0xe6, 0x01, 0xa5, 0x01, 0xa6, 0x01, 0xa7, 0x00, 0x44, 0x00, 0x69,
+    0x01, 0xa8, 0x01, 0xa9, 0x01, 0xaa, 0x01, 0xab, 0x01, 0xac, 0x01, 0xad,
+    0x00, 0x6b, 0x01, 0xae, 0x01, 0xaf, 0x01, 0xb0, 0x01, 0xb1, 0x01, 0xb2,
+    0x01, 0xb3, 0x00, 0x6c, 0x01, 0xb4, 0x00, 0x6a, 0x01, 0xb5, 0x01, 0xb6,
+    0x01, 0xb7, 0x01, 0xb8, 0x00, 0x6e, 0x01, 0xb9, 0x00, 0x6d, 0x00, 0xa0,
+    0x01, 0xba, 0x00, 0x45, 0x01, 0xbb, 0x00, 0x46, 0x00, 0xfe, 0x01, 0x00,
+    0x00, 0x6f, 0x01, 0xbc, 0x01, 0xbd, 0x01, 0xbe, 0x00, 0x47, 0x00, 0xea,
+    0x01, 0xbf, 0x01, 0x01, 0x01, 0xc0, 0x01, 0xc1, 0x00, 0x48, 0x00, 0x70,
+    0x01, 0xc2, 0x01, 0xc3, 0x01, 0xc4, 0x00, 0x72, 0x01, 0xc5, 0x01, 0xc6,
+    0x01, 0xc7, 0x01, 0xc8, 0x01, 0xc9, 0x01, 0xca, 0x00, 0x73, 0x01, 0xcb,
+    0x01, 0xcc, 0x00, 0x71, 0x01, 0xcd, 0x01, 0xce, 0x01, 0xcf, 0x01, 0xd0,
+    0x01, 0xd1, 0x01, 0xd2, 0x01, 0xd3, 0x01, 0xd4, 0x01, 0xd5, 0x01, 0xd6,
+    0x00, 0x49, 0x00, 0x4a, 0x00, 0xf9, 0x01, 0xd7, 0x01, 0xd8, 0x01, 0xd9,
+    0x01, 0xda, 0x01, 0xdb, 0x00, 0x4b, 0x01, 0xdc, 0x01, 0xdd, 0x01, 0xde,
+    0x01, 0xdf, 0x00, 0x4c, 0x00, 0xd7, 0x00, 0x74, 0x01, 0xe0, 0x00, 0x76,
+    0x01, 0xe1, 0x00, 0x77, 0x01, 0xe2, 0x01, 0xe3, 0x01, 0xe4, 0x00, 0x75,
+    0x01, 0xe5, 0x01, 0xe6, 0x01, 0xe7, 0x01, 0xe8, 0x01, 0xe9, 0x00, 0x4d,
+    0x01, 0xea, 0x01, 0xeb, 0x00, 0x4e, 0x01, 0xec, 0x01, 0xed, 0x00, 0x4f,
+    0x01, 0xee, 0x01, 0xef, 0x01, 0xf0, 0x01, 0xf1, 0x01, 0xf2, 0x01, 0xf3,
+    0x01, 0xf4, 0x00, 0xe3, 0x00, 0x50, 0x01, 0xf5, 0x00, 0x51, 0x01, 0xf6,
+    0x01, 0xf7, 0x01, 0xf8, 0x01, 0xf9, 0x01, 0xfa, 0x01, 0xfb, 0x01, 0xfc,
+    0x00, 0x78, 0x00, 0x52, 0x00, 0x79, 0x01, 0xfd, 0x00, 0x7b, 0x01, 0xfe,
+    0x01, 0xff, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x7c,
+    0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x00, 0x7a, 0x02, 0x07, 0x02, 0x08,
+    0x02, 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0c, 0x02, 0x0d, 0x02, 0x0e,
+    0x02, 0x0f, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x00, 0xa1,
+    0x02, 0x14, 0x00, 0x7d, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x00, 0xb1,
+    0x00, 0x53, 0x00, 0xee, 0x00, 0x54, 0x00, 0x55, 0x02, 0x18, 0x02, 0x19,
+    0x02, 0x1a, 0x02, 0x1b, 0x02, 0x1c, 0x02, 0x1d, 0x02, 0x1e, 0x02, 0x1f,
+    0x02, 0x20, 0x00, 0x56, 0x02, 0x21, 0x02, 0x22, 0x00, 0xe5, 0x02, 0x23,
+    0x00, 0xfc, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28,
+    0x00, 0x89, 0x00, 0x57, 0x02, 0x29, 0x02, 0x2a, 0x02, 0x2b, 0x02, 0x2c,
+    0x02, 0x2d, 0x02, 0x2e, 0x02, 0x2f, 0x00, 0x58, 0x00, 0x7e, 0x02, 0x30,
+    0x00, 0x80, 0x02, 0x31, 0x00, 0x81, 0x02, 0x32, 0x00, 0x7f, 0x02, 0x33,
+    0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x02, 0x37, 0x02, 0x38, 0x02, 0x39,
+    0x02, 0x3a, 0x02, 0x3b, 0x02, 0x3c, 0x02, 0x3d, 0x02, 0x3e, 0x02, 0x3f,
+    0x02, 0x40, 0x02, 0x41, 0x00, 0x59, 0x00, 0x5a, 0x02, 0x42, 0x02, 0x43,
+    0x02, 0x44, 0x02, 0x45, 0x00, 0x5b, 0x00, 0x5c, 0x00, 0xec, 0x02, 0x46,
+    0x00, 0xba, 0x02, 0x47, 0x02, 0x48, 0x02, 0x49, 0x02, 0x4a, 0x02, 0x4b,
+    0x02, 0x4c, 0x00, 0x5d, 0x02, 0x4d, 0x00, 0xe7, 0x02, 0x4e, 0x02, 0x4f,
+    0x02, 0x50, 0x02, 0x51, 0x00, 0xc0, 0x00, 0xc1, 0x00, 0x9d, 0x00, 0x9e,
+    0x02, 0x52, 0x02, 0x53, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
+    0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c,
+    0x02, 0x54, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59,
+    0x02, 0x5a, 0x02, 0x5b, 0x02, 0x5c, 0x02, 0x5d, 0x02, 0x5e, 0x02, 0x5f,
+    0x02, 0x60, 0x02, 0x61, 0x02, 0x62, 0x02, 0x63, 0x02, 0x64, 0x02, 0x65,
+    0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6a, 0x02, 0x6b,
+    0x02, 0x6c, 0x02, 0x6d, 0x02, 0x6e, 0x02, 0x6f, 0x02, 0x70, 0x02, 0x71,
+    0x02, 0x72, 0x02, 0x73, 0x02, 0x74, 0x02, 0x75, 0x02, 0x76, 0x02, 0x77,
+    0x02, 0x78, 0x02, 0x79, 0x02, 0x7a, 0x02, 0x7b, 0x02, 0x7c, 0x02, 0x7d,
+    0x00, 0xbc, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xf6, 0x02, 0x7e, 0x02, 0x7f,
+    0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85,
+    0x00, 0x0d, 0x00, 0x3f, 0x00, 0xc3, 0x00, 0x87, 0x00, 0x1d, 0x00, 0x0f,
+    0x00, 0xab, 0x00, 0x04, 0x00, 0xa3, 0x02, 0x86, 0x00, 0x06, 0x00, 0x11,
+    0x00, 0x22, 0x00, 0xa2, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x12,
+    0x00, 0x42, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89, 0x02, 0x8a, 0x00, 0x5e,
+    0x00, 0x60, 0x00, 0x3e, 0x00, 0x40, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0xb3,
+    0x00, 0xb2, 0x02, 0x8b, 0x02, 0x8c, 0x00, 0x10, 0x02, 0x8d, 0x02, 0x8e,
+    0x00, 0xa9, 0x00, 0xaa, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc5, 0x00, 0xb4,
+    0x00, 0xb5, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x02, 0x8f, 0x02, 0x90,
+    0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95, 0x00, 0x84,
+    0x02, 0x96, 0x00, 0xbd, 0x00, 0x07, 0x02, 0x97, 0x02, 0x98, 0x00, 0xa6,
+    0x00, 0xf7, 0x02, 0x99, 0x02, 0x9a, 0x02, 0x9b, 0x02, 0x9c, 0x02, 0x9d,
+    0x02, 0x9e, 0x02, 0x9f, 0x02, 0xa0, 0x02, 0xa1, 0x02, 0xa2, 0x00, 0x85,
+    0x02, 0xa3, 0x00, 0x96, 0x02, 0xa4, 0x02, 0xa5, 0x02, 0xa6, 0x02, 0xa7,
+    0x02, 0xa8, 0x00, 0x0e, 0x00, 0xef, 0x00, 0xf0, 0x00, 0xb8, 0x00, 0x20,
+    0x00, 0x8f, 0x00, 0x21, 0x00, 0x1f, 0x00, 0x95, 0x00, 0x94, 0x00, 0x93,
+    0x00, 0xa7, 0x00, 0x61, 0x00, 0xa4, 0x00, 0x92, 0x02, 0xa9, 0x00, 0x9c,
+    0x02, 0xaa, 0x02, 0xab, 0x00, 0x9a, 0x00, 0x99, 0x00, 0xa5, 0x02, 0xac,
+    0x00, 0x98, 0x00, 0x08, 0x00, 0xc6, 0x02, 0xad, 0x02, 0xae, 0x02, 0xaf,
+    0x02, 0xb0, 0x02, 0xb1, 0x02, 0xb2, 0x02, 0xb3, 0x02, 0xb4, 0x02, 0xb5,
+    0x02, 0xb6, 0x02, 0xb7, 0x02, 0xb8, 0x02, 0xb9, 0x02, 0xba, 0x02, 0xbb,
+    0x02, 0xbc, 0x02, 0xbd, 0x02, 0xbe, 0x02, 0xbf, 0x02, 0xc0, 0x02, 0xc1,
+    0x02, 0xc2, 0x02, 0xc3, 0x02, 0xc4, 0x00, 0xb9, 0x02, 0xc5, 0x02, 0xc6,
+    0x02, 0xc7, 0x02, 0xc8, 0x02, 0xc9, 0x02, 0xca, 0x02, 0xcb, 0x02, 0xcc,
+    0x02, 0xcd, 0x02, 0xce, 0x02, 0xcf, 0x02, 0xd0, 0x00, 0x23, 0x00, 0x09,
+    0x00, 0x88, 0x00, 0x86, 0x00, 0x8b, 0x00, 0x8a, 0x00, 0x8c, 0x00, 0x83,
+    0x00, 0x5f, 0x00, 0xe8, 0x00, 0x82, 0x02, 0xd1, 0x00, 0xc2, 0x02, 0xd2,
+    0x02, 0xd3, 0x00, 0x41, 0x02, 0xd4, 0x02, 0xd5, 0x02, 0xd6, 0x02, 0xd7,
+    0x02, 0xd8, 0x02, 0xd9, 0x02, 0xda, 0x02, 0xdb, 0x02, 0xdc, 0x02, 0xdd,
+    0x02, 0xde, 0x02, 0xdf, 0x02, 0xe0, 0x02, 0xe1, 0x02, 0xe2, 0x02, 0xe3,
+    0x02, 0xe4, 0x02, 0xe5, 0x02, 0xe6, 0x02, 0xe7, 0x02, 0xe8, 0x02, 0xe9,
+    0x02, 0xea, 0x02, 0xeb, 0x02, 0xec, 0x02, 0xed, 0x02, 0xee, 0x02, 0xef,
+    0x02, 0xf0, 0x02, 0xf1, 0x02, 0xf2, 0x02, 0xf3, 0x02, 0xf4, 0x02, 0xf5,
+    0x02, 0xf6, 0x02, 0xf7, 0x02, 0xf8, 0x02, 0xf9, 0x02, 0xfa, 0x02, 0xfb,
+    0x02, 0xfc, 0x02, 0xfd, 0x02, 0xfe, 0x02, 0xff, 0x03, 0x00, 0x03, 0x01,
+    0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07,
+    0x03, 0x08, 0x03, 0x09, 0x03, 0x0a, 0x03, 0x0b, 0x03, 0x0c, 0x03, 0x0d,
+    0x03, 0x0e, 0x03, 0x0f, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x00, 0x8d,
+    0x00, 0xdb, 0x00, 0xe1, 0x00, 0xde, 0x00, 0xd8, 0x00, 0x8e, 0x00, 0xdc,
+    0x00, 0x43, 0x00, 0xdf, 0x00, 0xda, 0x00, 0xe0, 0x00, 0xdd, 0x00, 0xd9,
+    0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17, 0x03, 0x18,
+    0x03, 0x19, 0x03, 0x1a, 0x03, 0x1b, 0x03, 0x1c, 0x03, 0x1d, 0x03, 0x1e,
+    0x03, 0x1f, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23, 0x03, 0x24,
+    0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x04, 0x4e, 0x55, 0x4c,
+    0x4c, 0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x41, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x36,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x30, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x34,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x34, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x41, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x36,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x38, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x41, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x30,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x30, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x41, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x32,
+    0x07, 0x41, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x41, 0x6f, 0x67,
+    0x6f, 0x6e, 0x65, 0x6b, 0x0a, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63,
+    0x75, 0x74, 0x65, 0x07, 0x41, 0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x38, 0x0b, 0x43, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0a, 0x43, 0x64, 0x6f, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6f,
+    0x6e, 0x06, 0x44, 0x63, 0x72, 0x6f, 0x61, 0x74, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x45,
+    0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x45, 0x63, 0x61, 0x72,
+    0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x43, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x42, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x30, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x43, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x43, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x34, 0x0a, 0x45,
+    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42,
+    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x36, 0x07, 0x45, 0x6d,
+    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31,
+    0x36, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x34, 0x07, 0x45, 0x6f,
+    0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42,
+    0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42, 0x38, 0x06, 0x47, 0x63,
+    0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
+    0x66, 0x6c, 0x65, 0x78, 0x0c, 0x47, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61,
+    0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x47, 0x64, 0x6f, 0x74, 0x61, 0x63,
+    0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x30,
+    0x04, 0x48, 0x62, 0x61, 0x72, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32,
+    0x41, 0x0b, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
+    0x78, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x34, 0x06, 0x49, 0x62,
+    0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x38,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x45, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x38,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x41, 0x07, 0x49, 0x6d, 0x61,
+    0x63, 0x72, 0x6f, 0x6e, 0x07, 0x49, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
+    0x06, 0x49, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x0b, 0x4a, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x4b, 0x63, 0x6f, 0x6d,
+    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x31, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x37,
+    0x06, 0x4c, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x4c, 0x63, 0x61, 0x72,
+    0x6f, 0x6e, 0x0c, 0x4c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63,
+    0x65, 0x6e, 0x74, 0x04, 0x4c, 0x64, 0x6f, 0x74, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x33, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x43, 0x38,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x41, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x34, 0x32, 0x06, 0x4e, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x4e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c, 0x4e, 0x63, 0x6f, 0x6d, 0x6d,
+    0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x34, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x36, 0x03,
+    0x45, 0x6e, 0x67, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x38, 0x06,
+    0x4f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x44, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x38, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x44, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x44, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x36, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x32, 0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
+    0x32, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x30, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x43, 0x45, 0x05, 0x4f, 0x68, 0x6f, 0x72, 0x6e, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x44, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x32,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x43, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x44, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x30,
+    0x0d, 0x4f, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61,
+    0x75, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x45, 0x07, 0x4f,
+    0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x35, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x30, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x31, 0x45, 0x41, 0x0b, 0x4f, 0x73, 0x6c, 0x61, 0x73,
+    0x68, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x34, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x45, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x32, 0x32, 0x43, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x06, 0x52, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c, 0x52, 0x63, 0x6f,
+    0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e,
+    0x69, 0x30, 0x32, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x35,
+    0x41, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x32, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x35, 0x45, 0x06, 0x53, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x34, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x36, 0x36, 0x0b, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
+    0x66, 0x6c, 0x65, 0x78, 0x0c, 0x53, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61,
+    0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36,
+    0x30, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x32, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x36, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x39,
+    0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x38, 0x46, 0x04, 0x54, 0x62,
+    0x61, 0x72, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e,
+    0x69, 0x30, 0x31, 0x36, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31,
+    0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x43, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x36, 0x45, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x34, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x45, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x36,
+    0x05, 0x55, 0x68, 0x6f, 0x72, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x30, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x45, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x45, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x45, 0x0d, 0x55,
+    0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x36, 0x07, 0x55, 0x6d, 0x61,
+    0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x37, 0x41,
+    0x07, 0x55, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x05, 0x55, 0x72, 0x69,
+    0x6e, 0x67, 0x06, 0x55, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x37, 0x38, 0x06, 0x57, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x0b, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
+    0x09, 0x57, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x57,
+    0x67, 0x72, 0x61, 0x76, 0x65, 0x0b, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x38,
+    0x45, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x34, 0x06, 0x59, 0x67,
+    0x72, 0x61, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x36,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x32, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x46, 0x38, 0x06, 0x5a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0a,
+    0x5a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x39, 0x32, 0x03, 0x55, 0x2e, 0x69, 0x06, 0x61,
+    0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41,
+    0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x37, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x42, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42,
+    0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x35, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x41, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41,
+    0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41, 0x37, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x41, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41,
+    0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x31, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x41, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x41,
+    0x33, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x33, 0x07, 0x61, 0x6d,
+    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x61, 0x6f, 0x67, 0x6f, 0x6e, 0x65,
+    0x6b, 0x0a, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x07, 0x61, 0x65, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x32, 0x39, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x39,
+    0x0b, 0x63, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
+    0x0a, 0x63, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x06,
+    0x64, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x30, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x30, 0x46, 0x06, 0x65,
+    0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65, 0x63, 0x61, 0x72, 0x6f, 0x6e,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x44, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x37,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x31, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x43, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x35,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x35, 0x0a, 0x65, 0x64, 0x6f,
+    0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x42, 0x07,
+    0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x37, 0x07, 0x65, 0x6d, 0x61, 0x63,
+    0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x37, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x31, 0x35, 0x07, 0x65, 0x6f, 0x67, 0x6f,
+    0x6e, 0x65, 0x6b, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x39, 0x41, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x32, 0x35, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x42, 0x39, 0x06,
+    0x67, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0b, 0x67, 0x63, 0x69, 0x72, 0x63,
+    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x0c, 0x67, 0x63, 0x6f, 0x6d, 0x6d,
+    0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x0a, 0x67, 0x64, 0x6f, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x32, 0x31, 0x04, 0x68, 0x62, 0x61, 0x72, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x32, 0x42, 0x0b, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+    0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x35, 0x06,
+    0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
+    0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x32, 0x46, 0x09, 0x69,
+    0x2e, 0x6c, 0x6f, 0x63, 0x6c, 0x54, 0x52, 0x4b, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x39,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x42, 0x07, 0x69, 0x6d, 0x61,
+    0x63, 0x72, 0x6f, 0x6e, 0x07, 0x69, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b,
+    0x06, 0x69, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x32, 0x33, 0x37, 0x0b, 0x6a, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
+    0x6c, 0x65, 0x78, 0x0c, 0x6b, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63,
+    0x63, 0x65, 0x6e, 0x74, 0x0c, 0x6b, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x6c,
+    0x61, 0x6e, 0x64, 0x69, 0x63, 0x06, 0x6c, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x06, 0x6c, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c, 0x6c, 0x63, 0x6f, 0x6d,
+    0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x04, 0x6c, 0x64, 0x6f,
+    0x74, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33, 0x37, 0x07, 0x75, 0x6e,
+    0x69, 0x30, 0x31, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x33,
+    0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x33, 0x06, 0x6e, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x06, 0x6e, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x0c,
+    0x6e, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74,
+    0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x35, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x34, 0x37, 0x03, 0x65, 0x6e, 0x67, 0x07, 0x75, 0x6e, 0x69,
+    0x31, 0x45, 0x34, 0x39, 0x06, 0x6f, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x44, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x33, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x44, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x30, 0x44, 0x07,
+    0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x32, 0x33, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x44, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x43, 0x46, 0x05, 0x6f, 0x68, 0x6f, 0x72,
+    0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x42, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x45, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44,
+    0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x44, 0x46, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x45, 0x31, 0x0d, 0x6f, 0x68, 0x75, 0x6e, 0x67, 0x61,
+    0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x32, 0x30, 0x46, 0x07, 0x6f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x35, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x35, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x45, 0x42, 0x0b,
+    0x6f, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x34, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x34, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x32, 0x44, 0x06,
+    0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x63, 0x61, 0x72, 0x6f,
+    0x6e, 0x0c, 0x72, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65,
+    0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x31, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x35, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
+    0x37, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x33, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x35, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32,
+    0x34, 0x44, 0x06, 0x73, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x36, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36,
+    0x37, 0x0b, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
+    0x78, 0x0c, 0x73, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x61, 0x63, 0x63, 0x65,
+    0x6e, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x31, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x36, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x36, 0x39, 0x04, 0x74, 0x62, 0x61, 0x72, 0x06, 0x74, 0x63, 0x61, 0x72,
+    0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x31, 0x36, 0x33, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x39, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x36, 0x44, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x36, 0x46, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76,
+    0x65, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x35, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x45, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45,
+    0x37, 0x05, 0x75, 0x68, 0x6f, 0x72, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x31, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x31,
+    0x45, 0x45, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x45, 0x46, 0x0d,
+    0x75, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61, 0x75,
+    0x74, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x31, 0x37, 0x07, 0x75, 0x6d,
+    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x37,
+    0x42, 0x07, 0x75, 0x6f, 0x67, 0x6f, 0x6e, 0x65, 0x6b, 0x05, 0x75, 0x72,
+    0x69, 0x6e, 0x67, 0x06, 0x75, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x07, 0x75,
+    0x6e, 0x69, 0x31, 0x45, 0x37, 0x39, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x0b, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65,
+    0x78, 0x09, 0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06,
+    0x77, 0x67, 0x72, 0x61, 0x76, 0x65, 0x0b, 0x79, 0x63, 0x69, 0x72, 0x63,
+    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45,
+    0x38, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46, 0x35, 0x06, 0x79,
+    0x67, 0x72, 0x61, 0x76, 0x65, 0x07, 0x75, 0x6e, 0x69, 0x31, 0x45, 0x46,
+    0x37, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x33, 0x33, 0x07, 0x75, 0x6e,
+    0x69, 0x31, 0x45, 0x46, 0x39, 0x06, 0x7a, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x0a, 0x7a, 0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x07,
+    0x75, 0x6e, 0x69, 0x31, 0x45, 0x39, 0x33, 0x03, 0x75, 0x2e, 0x69, 0x07,
+    0x72, 0x2e, 0x73, 0x65, 0x72, 0x69, 0x66, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x37, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x32, 0x34, 0x09,
+    0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x73, 0x73, 0x30, 0x32, 0x09, 0x7a, 0x65,
+    0x72, 0x6f, 0x2e, 0x7a, 0x65, 0x72, 0x6f, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x38, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x31, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x38, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x34, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x38, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x37, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x38, 0x39, 0x09, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x64, 0x6e, 0x6f,
+    0x6d, 0x08, 0x6f, 0x6e, 0x65, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x08, 0x74,
+    0x77, 0x6f, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x0a, 0x74, 0x68, 0x72, 0x65,
+    0x65, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x09, 0x66, 0x6f, 0x75, 0x72, 0x2e,
+    0x64, 0x6e, 0x6f, 0x6d, 0x09, 0x66, 0x69, 0x76, 0x65, 0x2e, 0x64, 0x6e,
+    0x6f, 0x6d, 0x08, 0x73, 0x69, 0x78, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x0a,
+    0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x0a, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x09, 0x6e, 0x69,
+    0x6e, 0x65, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x09, 0x7a, 0x65, 0x72, 0x6f,
+    0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x08, 0x6f, 0x6e, 0x65, 0x2e, 0x6e, 0x75,
+    0x6d, 0x72, 0x08, 0x74, 0x77, 0x6f, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x0a,
+    0x74, 0x68, 0x72, 0x65, 0x65, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x09, 0x66,
+    0x6f, 0x75, 0x72, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x09, 0x66, 0x69, 0x76,
+    0x65, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x08, 0x73, 0x69, 0x78, 0x2e, 0x6e,
+    0x75, 0x6d, 0x72, 0x0a, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x2e, 0x6e, 0x75,
+    0x6d, 0x72, 0x0a, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2e, 0x6e, 0x75, 0x6d,
+    0x72, 0x09, 0x6e, 0x69, 0x6e, 0x65, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x30, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07,
+    0x75, 0x6e, 0x69, 0x30, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x37, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x35, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x37, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x38, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x39, 0x0c, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x38, 0x30, 0x2e, 0x73, 0x73, 0x30, 0x32, 0x0e, 0x7a, 0x65, 0x72,
+    0x6f, 0x2e, 0x64, 0x6e, 0x6f, 0x6d, 0x2e, 0x73, 0x73, 0x30, 0x32, 0x0e,
+    0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x2e, 0x73, 0x73,
+    0x30, 0x32, 0x0c, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x30, 0x2e, 0x73,
+    0x73, 0x30, 0x32, 0x0c, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x38, 0x30, 0x2e,
+    0x7a, 0x65, 0x72, 0x6f, 0x0e, 0x7a, 0x65, 0x72, 0x6f, 0x2e, 0x64, 0x6e,
+    0x6f, 0x6d, 0x2e, 0x7a, 0x65, 0x72, 0x6f, 0x0e, 0x7a, 0x65, 0x72, 0x6f,
+    0x2e, 0x6e, 0x75, 0x6d, 0x72, 0x2e, 0x7a, 0x65, 0x72, 0x6f, 0x0c, 0x75,
+    0x6e, 0x69, 0x32, 0x30, 0x37, 0x30, 0x2e, 0x7a, 0x65, 0x72, 0x6f, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x45, 0x31, 0x32, 0x16, 0x70, 0x65, 0x72, 0x69,
+    0x6f, 0x64, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2e, 0x6c,
+    0x6f, 0x63, 0x6c, 0x43, 0x41, 0x54, 0x0d, 0x61, 0x73, 0x74, 0x65, 0x72,
+    0x69, 0x73, 0x6b, 0x2e, 0x73, 0x73, 0x30, 0x31, 0x0d, 0x71, 0x75, 0x6f,
+    0x74, 0x65, 0x64, 0x62, 0x6c, 0x2e, 0x73, 0x73, 0x30, 0x33, 0x10, 0x71,
+    0x75, 0x6f, 0x74, 0x65, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x2e, 0x73,
+    0x73, 0x30, 0x33, 0x0a, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x61,
+    0x73, 0x68, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x31, 0x35, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x30, 0x31, 0x30, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30,
+    0x41, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x30, 0x37, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x30, 0x30, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
+    0x30, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x30, 0x41, 0x30, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x30, 0x30, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
+    0x30, 0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x35, 0x0d, 0x63,
+    0x6f, 0x6c, 0x6f, 0x6e, 0x6d, 0x6f, 0x6e, 0x65, 0x74, 0x61, 0x72, 0x79,
+    0x04, 0x64, 0x6f, 0x6e, 0x67, 0x04, 0x45, 0x75, 0x72, 0x6f, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
+    0x41, 0x44, 0x04, 0x6c, 0x69, 0x72, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x30, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x43, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x36, 0x06, 0x70, 0x65, 0x73, 0x65,
+    0x74, 0x61, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x42, 0x31, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x30, 0x42, 0x44, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30,
+    0x42, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x30, 0x41, 0x39, 0x0c, 0x61,
+    0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6b, 0x6d, 0x61, 0x74, 0x68, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x32, 0x31, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32,
+    0x32, 0x31, 0x35, 0x07, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x30, 0x37, 0x42, 0x08, 0x65, 0x6d, 0x70, 0x74,
+    0x79, 0x73, 0x65, 0x74, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x32, 0x36,
+    0x07, 0x75, 0x6e, 0x69, 0x32, 0x32, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x30, 0x42, 0x35, 0x0a, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x70,
+    0x6c, 0x75, 0x73, 0x0f, 0x61, 0x73, 0x63, 0x69, 0x69, 0x74, 0x69, 0x6c,
+    0x64, 0x65, 0x2e, 0x73, 0x73, 0x30, 0x31, 0x07, 0x61, 0x72, 0x72, 0x6f,
+    0x77, 0x75, 0x70, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x39, 0x37, 0x0a,
+    0x61, 0x72, 0x72, 0x6f, 0x77, 0x72, 0x69, 0x67, 0x68, 0x74, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x31, 0x39, 0x38, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77,
+    0x64, 0x6f, 0x77, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x39, 0x39,
+    0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x6c, 0x65, 0x66, 0x74, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x31, 0x39, 0x36, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77,
+    0x62, 0x6f, 0x74, 0x68, 0x09, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x75, 0x70,
+    0x64, 0x6e, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x45, 0x37, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x31, 0x45, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31,
+    0x45, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x45, 0x36, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x42, 0x30, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x42,
+    0x39, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x42, 0x30, 0x37, 0x07, 0x75,
+    0x6e, 0x69, 0x32, 0x42, 0x30, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35,
+    0x43, 0x46, 0x06, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x07, 0x75, 0x6e,
+    0x69, 0x32, 0x35, 0x43, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x35, 0x43,
+    0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x36, 0x33, 0x39, 0x09, 0x73, 0x6d,
+    0x69, 0x6c, 0x65, 0x66, 0x61, 0x63, 0x65, 0x0c, 0x69, 0x6e, 0x76, 0x73,
+    0x6d, 0x69, 0x6c, 0x65, 0x66, 0x61, 0x63, 0x65, 0x05, 0x73, 0x70, 0x61,
+    0x64, 0x65, 0x04, 0x63, 0x6c, 0x75, 0x62, 0x05, 0x68, 0x65, 0x61, 0x72,
+    0x74, 0x07, 0x64, 0x69, 0x61, 0x6d, 0x6f, 0x6e, 0x64, 0x07, 0x75, 0x6e,
+    0x69, 0x32, 0x37, 0x31, 0x33, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x31,
+    0x34, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x31, 0x35, 0x07, 0x75, 0x6e,
+    0x69, 0x32, 0x37, 0x31, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x37, 0x31,
+    0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x31, 0x33, 0x07, 0x75, 0x6e,
+    0x69, 0x32, 0x31, 0x31, 0x36, 0x09, 0x65, 0x73, 0x74, 0x69, 0x6d, 0x61,
+    0x74, 0x65, 0x64, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x34, 0x32, 0x33, 0x07,
+    0x75, 0x6e, 0x69, 0x32, 0x33, 0x38, 0x42, 0x05, 0x68, 0x6f, 0x75, 0x73,
+    0x65, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x31, 0x45, 0x41, 0x07, 0x75, 0x6e,
+    0x69, 0x32, 0x33, 0x32, 0x37, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x32,
+    0x42, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x32, 0x36, 0x07, 0x75, 0x6e,
+    0x69, 0x32, 0x33, 0x32, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x31,
+    0x38, 0x07, 0x75, 0x6e, 0x69, 0x32, 0x33, 0x43, 0x45, 0x06, 0x6d, 0x69,
+    0x6e, 0x75, 0x74, 0x65, 0x06, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x10,
+    0x61, 0x73, 0x63, 0x69, 0x69, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x2e,
+    0x73, 0x73, 0x30, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x37, 0x35,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x38, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x33, 0x30, 0x37, 0x09, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6f,
+    0x6d, 0x62, 0x09, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6f, 0x6d, 0x62,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x42, 0x0d, 0x63, 0x61, 0x72,
+    0x6f, 0x6e, 0x63, 0x6f, 0x6d, 0x62, 0x2e, 0x61, 0x6c, 0x74, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x33, 0x30, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
+    0x30, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x33, 0x30, 0x41, 0x09, 0x74, 0x69, 0x6c, 0x64, 0x65,
+    0x63, 0x6f, 0x6d, 0x62, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x34,
+    0x0d, 0x68, 0x6f, 0x6f, 0x6b, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x63, 0x6f,
+    0x6d, 0x62, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x46, 0x07, 0x75,
+    0x6e, 0x69, 0x30, 0x33, 0x31, 0x31, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33,
+    0x31, 0x32, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x31, 0x42, 0x0c, 0x64,
+    0x6f, 0x74, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x63, 0x6f, 0x6d, 0x62, 0x07,
+    0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x34, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x33, 0x32, 0x36, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x37, 0x07,
+    0x75, 0x6e, 0x69, 0x30, 0x33, 0x32, 0x38, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x33, 0x32, 0x45, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x33, 0x31, 0x07,
+    0x75, 0x6e, 0x69, 0x30, 0x33, 0x33, 0x35, 0x07, 0x75, 0x6e, 0x69, 0x30,
+    0x33, 0x33, 0x36, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x38, 0x2e,
+    0x63, 0x61, 0x73, 0x65, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x37,
+    0x2e, 0x63, 0x61, 0x73, 0x65, 0x0e, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63,
+    0x6f, 0x6d, 0x62, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0e, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0c,
+    0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x42, 0x2e, 0x63, 0x61, 0x73, 0x65,
+    0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32, 0x2e, 0x63, 0x61, 0x73,
+    0x65, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x43, 0x2e, 0x63, 0x61,
+    0x73, 0x65, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36, 0x2e, 0x63,
+    0x61, 0x73, 0x65, 0x0c, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x41, 0x2e,
+    0x63, 0x61, 0x73, 0x65, 0x0e, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x63, 0x6f,
+    0x6d, 0x62, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0c, 0x75, 0x6e, 0x69, 0x30,
+    0x33, 0x31, 0x42, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0b, 0x74, 0x69, 0x6c,
+    0x64, 0x65, 0x63, 0x6f, 0x6d, 0x62, 0x2e, 0x69, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x32, 0x42, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x42,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x41, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x32, 0x43, 0x39, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x42,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x39, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x32, 0x42, 0x46, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x42, 0x45,
+    0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x41, 0x07, 0x75, 0x6e, 0x69,
+    0x30, 0x32, 0x43, 0x43, 0x07, 0x75, 0x6e, 0x69, 0x30, 0x32, 0x43, 0x38,
+    0x0a, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a,
+    0x62, 0x72, 0x65, 0x76, 0x65, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x63,
+    0x61, 0x72, 0x6f, 0x6e, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0d, 0x64, 0x69,
+    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x0e,
+    0x64, 0x6f, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x61,
+    0x73, 0x65, 0x0a, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2e, 0x63, 0x61, 0x73,
+    0x65, 0x11, 0x68, 0x75, 0x6e, 0x67, 0x61, 0x72, 0x75, 0x6d, 0x6c, 0x61,
+    0x75, 0x74, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x09, 0x72, 0x69, 0x6e, 0x67,
+    0x2e, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2e,
+    0x63, 0x61, 0x73, 0x65, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36,
+    0x30, 0x33, 0x30, 0x31, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36,
+    0x30, 0x33, 0x30, 0x30, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36,
+    0x30, 0x33, 0x30, 0x39, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x36,
+    0x30, 0x33, 0x30, 0x33, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x31, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x30, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x39, 0x0b, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x33, 0x10, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x31, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6e,
+    0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x30, 0x2e, 0x63, 0x61,
+    0x73, 0x65, 0x10, 0x75, 0x6e, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33,
+    0x30, 0x39, 0x2e, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6e, 0x69, 0x30,
+    0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x33, 0x2e, 0x63, 0x61, 0x73, 0x65,
+    0x07, 0x75, 0x6e, 0x69, 0x46, 0x46, 0x46, 0x44, 0x00, 0x01, 0x00, 0x01,
+    0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x4c, 0x00, 0x4c, 0x00, 0x3c, 0x00, 0x3c, 0x02, 0x70, 0x00, 0x00,
+    0x02, 0x94, 0x01, 0xc9, 0x00, 0x00, 0xff, 0x59, 0x03, 0xec, 0xfe, 0xce,
+    0x02, 0x76, 0xff, 0xf6, 0x02, 0x94, 0x01, 0xd4, 0xff, 0xf6, 0xff, 0x52,
+    0x03, 0xec, 0xfe, 0xce, 0x00, 0x4c, 0x00, 0x4c, 0x00, 0x3c, 0x00, 0x3c,
+    0x01, 0x7d, 0x00, 0x00, 0x02, 0x94, 0x01, 0xc9, 0x00, 0x00, 0xff, 0x59,
+    0x03, 0xec, 0xfe, 0xce, 0x01, 0x84, 0xff, 0xfb, 0x02, 0x94, 0x01, 0xd4,
+    0xff, 0xf6, 0xff, 0x59, 0x03, 0xec, 0xfe, 0xce, 0x00, 0x4c, 0x00, 0x4c,
+    0x00, 0x3c, 0x00, 0x3c, 0x02, 0x70, 0x00, 0xfd, 0x02, 0x94, 0x01, 0xc9,
+    0x00, 0x00, 0xff, 0x59, 0x03, 0xec, 0xfe, 0xce, 0x02, 0x80, 0x00, 0xf7,
+    0x02, 0x94, 0x01, 0xd4, 0xff, 0xf6, 0xff, 0x54, 0x03, 0xec, 0xfe, 0xce,
+    0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20,
+    0x4b, 0xb8, 0x00, 0x0e, 0x51, 0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0,
+    0x34, 0x1b, 0xb0, 0x28, 0x59, 0x60, 0x66, 0x20, 0x8a, 0x55, 0x58, 0xb0,
+    0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x62,
+    0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2,
+    0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x01, 0x2c, 0xb0, 0x20,
+    0x60, 0x66, 0x2d, 0xb0, 0x02, 0x2c, 0x20, 0x64, 0x20, 0xb0, 0xc0, 0x50,
+    0xb0, 0x04, 0x26, 0x5a, 0xb2, 0x28, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45,
+    0xb0, 0x06, 0x45, 0x58, 0x21, 0xb0, 0x03, 0x25, 0x59, 0x52, 0x5b, 0x58,
+    0x21, 0x23, 0x21, 0x1b, 0x8a, 0x58, 0x20, 0xb0, 0x50, 0x50, 0x58, 0x21,
+    0xb0, 0x40, 0x59, 0x1b, 0x20, 0xb0, 0x38, 0x50, 0x58, 0x21, 0xb0, 0x38,
+    0x59, 0x59, 0x20, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45, 0x61, 0x64,
+    0xb0, 0x28, 0x50, 0x58, 0x21, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0x45,
+    0x20, 0xb0, 0x30, 0x50, 0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0,
+    0xc0, 0x50, 0x58, 0x20, 0x66, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x0a,
+    0x50, 0x58, 0x60, 0x1b, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x0a,
+    0x60, 0x1b, 0x20, 0xb0, 0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b,
+    0x60, 0x59, 0x59, 0x59, 0x1b, 0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0,
+    0x00, 0x50, 0x58, 0x65, 0x59, 0x59, 0x2d, 0xb0, 0x03, 0x2c, 0x20, 0x45,
+    0x20, 0xb0, 0x04, 0x25, 0x61, 0x64, 0x20, 0xb0, 0x05, 0x43, 0x50, 0x58,
+    0xb0, 0x05, 0x23, 0x42, 0xb0, 0x06, 0x23, 0x42, 0x1b, 0x21, 0x21, 0x59,
+    0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x04, 0x2c, 0x23, 0x21, 0x23, 0x21, 0x20,
+    0x64, 0xb1, 0x05, 0x62, 0x42, 0x20, 0xb0, 0x06, 0x23, 0x42, 0xb0, 0x06,
+    0x45, 0x58, 0x1b, 0xb1, 0x01, 0x0a, 0x43, 0x45, 0x63, 0xb1, 0x01, 0x0a,
+    0x43, 0xb0, 0x03, 0x60, 0x45, 0x63, 0xb0, 0x03, 0x2a, 0x21, 0x20, 0xb0,
+    0x06, 0x43, 0x20, 0x8a, 0x20, 0x8a, 0xb0, 0x01, 0x2b, 0xb1, 0x30, 0x05,
+    0x25, 0xb0, 0x04, 0x26, 0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52, 0x59,
+    0x58, 0x23, 0x59, 0x21, 0x59, 0x20, 0xb0, 0x40, 0x53, 0x58, 0xb0, 0x01,
+    0x2b, 0x1b, 0x21, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65,
+    0x59, 0x2d, 0xb0, 0x05, 0x2c, 0xb0, 0x07, 0x43, 0x2b, 0xb2, 0x00, 0x02,
+    0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x06, 0x2c, 0xb0, 0x07, 0x23, 0x42,
+    0x23, 0x20, 0xb0, 0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62, 0x66, 0xb0,
+    0x01, 0x63, 0xb0, 0x01, 0x60, 0xb0, 0x05, 0x2a, 0x2d, 0xb0, 0x07, 0x2c,
+    0x20, 0x20, 0x45, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62,
+    0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
+    0x63, 0x60, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x08, 0x2c, 0xb2, 0x07,
+    0x0b, 0x00, 0x43, 0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43,
+    0x60, 0x42, 0x2d, 0xb0, 0x09, 0x2c, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2,
+    0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0a, 0x2c, 0x20, 0x20,
+    0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25,
+    0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0x20, 0xb0, 0x20, 0x50,
+    0x58, 0x21, 0xb0, 0x00, 0x1b, 0xb0, 0x30, 0x50, 0x58, 0xb0, 0x20, 0x1b,
+    0xb0, 0x40, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0,
+    0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0b,
+    0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43,
+    0xb0, 0x04, 0x25, 0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0xb0,
+    0x24, 0x50, 0x58, 0xb0, 0x00, 0x1b, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00,
+    0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0,
+    0x01, 0x60, 0x2d, 0xb0, 0x0c, 0x2c, 0x20, 0xb0, 0x00, 0x23, 0x42, 0xb2,
+    0x0b, 0x0a, 0x03, 0x45, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x2a, 0x21,
+    0x2d, 0xb0, 0x0d, 0x2c, 0xb1, 0x02, 0x02, 0x45, 0xb0, 0x64, 0x61, 0x44,
+    0x2d, 0xb0, 0x0e, 0x2c, 0xb0, 0x01, 0x60, 0x20, 0x20, 0xb0, 0x0c, 0x43,
+    0x4a, 0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0c, 0x23, 0x42, 0x59, 0xb0,
+    0x0d, 0x43, 0x4a, 0xb0, 0x00, 0x52, 0x58, 0x20, 0xb0, 0x0d, 0x23, 0x42,
+    0x59, 0x2d, 0xb0, 0x0f, 0x2c, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01,
+    0x63, 0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x43,
+    0x60, 0x20, 0x8a, 0x60, 0x20, 0xb0, 0x0e, 0x23, 0x42, 0x23, 0x2d, 0xb0,
+    0x10, 0x2c, 0x4b, 0x54, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x24, 0xb0,
+    0x0d, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x11, 0x2c, 0x4b, 0x51, 0x58, 0x4b,
+    0x53, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b, 0x21, 0x59, 0x24, 0xb0,
+    0x13, 0x65, 0x23, 0x78, 0x2d, 0xb0, 0x12, 0x2c, 0xb1, 0x00, 0x0f, 0x43,
+    0x55, 0x58, 0xb1, 0x0f, 0x0f, 0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x0f,
+    0x2b, 0x59, 0xb0, 0x00, 0x43, 0xb0, 0x02, 0x25, 0x42, 0xb1, 0x0c, 0x02,
+    0x25, 0x42, 0xb1, 0x0d, 0x02, 0x25, 0x42, 0xb0, 0x01, 0x16, 0x23, 0x20,
+    0xb0, 0x03, 0x25, 0x50, 0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04,
+    0x25, 0x42, 0x8a, 0x8a, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21,
+    0x23, 0xb0, 0x01, 0x61, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x0e, 0x2a, 0x21,
+    0x1b, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x02, 0x25, 0x42, 0xb0, 0x02,
+    0x25, 0x61, 0xb0, 0x0e, 0x2a, 0x21, 0x59, 0xb0, 0x0c, 0x43, 0x47, 0xb0,
+    0x0d, 0x43, 0x47, 0x60, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
+    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x20, 0xb0, 0x0b, 0x43,
+    0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
+    0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23,
+    0x44, 0xb0, 0x01, 0x43, 0xb0, 0x00, 0x3e, 0xb2, 0x01, 0x01, 0x01, 0x43,
+    0x60, 0x42, 0x2d, 0xb0, 0x13, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54,
+    0x58, 0xb0, 0x0f, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0b, 0x23, 0x42, 0xb0,
+    0x0a, 0x23, 0xb0, 0x03, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5,
+    0x11, 0x11, 0x01, 0x00, 0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12,
+    0x06, 0x2b, 0xb0, 0x89, 0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x14, 0x2c,
+    0xb1, 0x00, 0x13, 0x2b, 0x2d, 0xb0, 0x15, 0x2c, 0xb1, 0x01, 0x13, 0x2b,
+    0x2d, 0xb0, 0x16, 0x2c, 0xb1, 0x02, 0x13, 0x2b, 0x2d, 0xb0, 0x17, 0x2c,
+    0xb1, 0x03, 0x13, 0x2b, 0x2d, 0xb0, 0x18, 0x2c, 0xb1, 0x04, 0x13, 0x2b,
+    0x2d, 0xb0, 0x19, 0x2c, 0xb1, 0x05, 0x13, 0x2b, 0x2d, 0xb0, 0x1a, 0x2c,
+    0xb1, 0x06, 0x13, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c, 0xb1, 0x07, 0x13, 0x2b,
+    0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x08, 0x13, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c,
+    0xb1, 0x09, 0x13, 0x2b, 0x2d, 0xb0, 0x29, 0x2c, 0x23, 0x20, 0xb0, 0x10,
+    0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x06, 0x60, 0x4b, 0x54, 0x58, 0x23,
+    0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x2a,
+    0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x16,
+    0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x71, 0x1b, 0x21,
+    0x21, 0x59, 0x2d, 0xb0, 0x2b, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66,
+    0xb0, 0x01, 0x63, 0xb0, 0x26, 0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e,
+    0xb0, 0x01, 0x72, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x1e, 0x2c, 0x00,
+    0xb0, 0x0d, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x0f, 0x23,
+    0x42, 0x20, 0x45, 0xb0, 0x0b, 0x23, 0x42, 0xb0, 0x0a, 0x23, 0xb0, 0x03,
+    0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5, 0x11, 0x11, 0x01, 0x00,
+    0x0e, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x12, 0x06, 0x2b, 0xb0, 0x89,
+    0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x1f, 0x2c, 0xb1, 0x00, 0x1e, 0x2b,
+    0x2d, 0xb0, 0x20, 0x2c, 0xb1, 0x01, 0x1e, 0x2b, 0x2d, 0xb0, 0x21, 0x2c,
+    0xb1, 0x02, 0x1e, 0x2b, 0x2d, 0xb0, 0x22, 0x2c, 0xb1, 0x03, 0x1e, 0x2b,
+    0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x04, 0x1e, 0x2b, 0x2d, 0xb0, 0x24, 0x2c,
+    0xb1, 0x05, 0x1e, 0x2b, 0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x06, 0x1e, 0x2b,
+    0x2d, 0xb0, 0x26, 0x2c, 0xb1, 0x07, 0x1e, 0x2b, 0x2d, 0xb0, 0x27, 0x2c,
+    0xb1, 0x08, 0x1e, 0x2b, 0x2d, 0xb0, 0x28, 0x2c, 0xb1, 0x09, 0x1e, 0x2b,
+    0x2d, 0xb0, 0x2c, 0x2c, 0x20, 0x3c, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x2d,
+    0x2c, 0x20, 0x60, 0xb0, 0x11, 0x60, 0x20, 0x43, 0x23, 0xb0, 0x01, 0x60,
+    0x43, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x01, 0x60, 0xb0, 0x2c, 0x2a, 0x21,
+    0x2d, 0xb0, 0x2e, 0x2c, 0xb0, 0x2d, 0x2b, 0xb0, 0x2d, 0x2a, 0x2d, 0xb0,
+    0x2f, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8,
+    0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
+    0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x23, 0x20, 0x8a, 0x55,
+    0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00,
+    0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+    0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x1b, 0x21, 0x59, 0x2d, 0xb0, 0x30,
+    0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0,
+    0x2f, 0x2a, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22,
+    0x59, 0x2d, 0xb0, 0x31, 0x2c, 0x00, 0xb0, 0x0d, 0x2b, 0xb1, 0x00, 0x02,
+    0x45, 0x54, 0x58, 0xb0, 0x01, 0x16, 0xb0, 0x2f, 0x2a, 0xb1, 0x05, 0x01,
+    0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x32, 0x2c,
+    0x20, 0x35, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x33, 0x2c, 0x00, 0xb0, 0x01,
+    0x45, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
+    0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x0b,
+    0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
+    0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x00,
+    0x16, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1,
+    0x32, 0x01, 0x15, 0x2a, 0x21, 0x2d, 0xb0, 0x34, 0x2c, 0x20, 0x3c, 0x20,
+    0x47, 0x20, 0xb0, 0x0b, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0,
+    0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60,
+    0xb0, 0x00, 0x43, 0x61, 0x38, 0x2d, 0xb0, 0x35, 0x2c, 0x2e, 0x17, 0x3c,
+    0x2d, 0xb0, 0x36, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0b, 0x43,
+    0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
+    0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0xb0,
+    0x01, 0x43, 0x63, 0x38, 0x2d, 0xb0, 0x37, 0x2c, 0xb1, 0x02, 0x00, 0x16,
+    0x25, 0x20, 0x2e, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25,
+    0x49, 0x8a, 0x8a, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x58, 0x62, 0x1b,
+    0x21, 0x59, 0xb0, 0x01, 0x23, 0x42, 0xb2, 0x36, 0x01, 0x01, 0x15, 0x14,
+    0x2a, 0x2d, 0xb0, 0x38, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x10, 0x23, 0x42,
+    0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0,
+    0x09, 0x43, 0x2b, 0x65, 0x8a, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38,
+    0x2d, 0xb0, 0x39, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x10, 0x23, 0x42, 0xb0,
+    0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61,
+    0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0, 0x60,
+    0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x02, 0x20, 0x03, 0x20,
+    0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20, 0xb0,
+    0x08, 0x43, 0x20, 0x8a, 0x23, 0x47, 0x23, 0x47, 0x23, 0x61, 0x23, 0x46,
+    0x60, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
+    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01,
+    0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23,
+    0xb0, 0x03, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x02, 0x43, 0x61, 0x1b,
+    0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20,
+    0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
+    0x61, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x1b,
+    0x23, 0xb0, 0x08, 0x43, 0x46, 0xb0, 0x02, 0x25, 0xb0, 0x08, 0x43, 0x47,
+    0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62,
+    0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
+    0x63, 0x60, 0x23, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x04, 0x43, 0x60,
+    0xb0, 0x01, 0x2b, 0xb0, 0x05, 0x25, 0x61, 0xb0, 0x05, 0x25, 0xb0, 0x02,
+    0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
+    0x01, 0x63, 0xb0, 0x04, 0x26, 0x61, 0x20, 0xb0, 0x04, 0x25, 0x60, 0x64,
+    0x23, 0xb0, 0x03, 0x25, 0x60, 0x64, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21,
+    0x59, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46, 0x61, 0x38, 0x59,
+    0x2d, 0xb0, 0x3a, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x10, 0x23, 0x42, 0x20,
+    0x20, 0x20, 0xb0, 0x05, 0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61,
+    0x23, 0x3c, 0x38, 0x2d, 0xb0, 0x3b, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x10,
+    0x23, 0x42, 0x20, 0xb0, 0x08, 0x23, 0x42, 0x20, 0x20, 0x20, 0x46, 0x23,
+    0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0, 0x3c, 0x2c, 0xb0,
+    0x00, 0x16, 0xb0, 0x10, 0x23, 0x42, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x25,
+    0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x00, 0x54, 0x58, 0x2e, 0x20, 0x3c,
+    0x23, 0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25, 0x47, 0x23, 0x47,
+    0x23, 0x61, 0x20, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25, 0x47, 0x23, 0x47,
+    0x23, 0x61, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0x49, 0xb0, 0x02, 0x25,
+    0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x20, 0x58, 0x62,
+    0x1b, 0x21, 0x59, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50,
+    0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x2e,
+    0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59, 0x2d, 0xb0, 0x3d,
+    0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x10, 0x23, 0x42, 0x20, 0xb0, 0x08, 0x43,
+    0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x60, 0xb0, 0x20, 0x60,
+    0x66, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
+    0x59, 0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d,
+    0xb0, 0x3e, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0,
+    0x10, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e,
+    0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x3f, 0x2c, 0x23, 0x20, 0x2e,
+    0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x10, 0x43, 0x58, 0x52, 0x1b, 0x50,
+    0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d,
+    0xb0, 0x40, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0,
+    0x10, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x23,
+    0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x10, 0x43, 0x58, 0x52,
+    0x1b, 0x50, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14,
+    0x2b, 0x2d, 0xb0, 0x41, 0x2c, 0xb0, 0x38, 0x2b, 0x23, 0x20, 0x2e, 0x46,
+    0xb0, 0x02, 0x25, 0x46, 0xb0, 0x10, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59,
+    0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0,
+    0x42, 0x2c, 0xb0, 0x39, 0x2b, 0x8a, 0x20, 0x20, 0x3c, 0xb0, 0x04, 0x23,
+    0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0,
+    0x10, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e,
+    0xb1, 0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04, 0x43, 0x2e, 0xb0, 0x2e, 0x2b,
+    0x2d, 0xb0, 0x43, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04,
+    0x26, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x09, 0x43, 0x2b,
+    0x23, 0x20, 0x3c, 0x20, 0x2e, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b,
+    0x2d, 0xb0, 0x44, 0x2c, 0xb1, 0x08, 0x04, 0x25, 0x42, 0xb0, 0x00, 0x16,
+    0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23,
+    0x61, 0x20, 0xb0, 0x04, 0x23, 0x42, 0xb0, 0x09, 0x43, 0x2b, 0x20, 0xb0,
+    0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x02, 0x20, 0x03,
+    0x20, 0x1b, 0xb3, 0x02, 0x26, 0x03, 0x1a, 0x59, 0x42, 0x42, 0x23, 0x20,
+    0x47, 0xb0, 0x04, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
+    0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x20, 0xb0, 0x01,
+    0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x02, 0x43, 0x60, 0x64, 0x23,
+    0xb0, 0x03, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x02, 0x43, 0x61, 0x1b,
+    0xb0, 0x03, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0, 0x02, 0x62, 0x20,
+    0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
+    0x61, 0xb0, 0x02, 0x25, 0x46, 0x61, 0x38, 0x23, 0x20, 0x3c, 0x23, 0x38,
+    0x1b, 0x21, 0x20, 0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61,
+    0x38, 0x21, 0x59, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x45, 0x2c,
+    0xb1, 0x00, 0x38, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0,
+    0x46, 0x2c, 0xb1, 0x00, 0x39, 0x2b, 0x21, 0x23, 0x20, 0x20, 0x3c, 0xb0,
+    0x04, 0x23, 0x42, 0x23, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0xb0, 0x04,
+    0x43, 0x2e, 0xb0, 0x2e, 0x2b, 0x2d, 0xb0, 0x47, 0x2c, 0xb0, 0x00, 0x15,
+    0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14,
+    0x13, 0x2e, 0xb0, 0x34, 0x2a, 0x2d, 0xb0, 0x48, 0x2c, 0xb0, 0x00, 0x15,
+    0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2, 0x00, 0x01, 0x01, 0x15, 0x14,
+    0x13, 0x2e, 0xb0, 0x34, 0x2a, 0x2d, 0xb0, 0x49, 0x2c, 0xb1, 0x00, 0x01,
+    0x14, 0x13, 0xb0, 0x35, 0x2a, 0x2d, 0xb0, 0x4a, 0x2c, 0xb0, 0x37, 0x2a,
+    0x2d, 0xb0, 0x4b, 0x2c, 0xb0, 0x00, 0x16, 0x45, 0x23, 0x20, 0x2e, 0x20,
+    0x46, 0x8a, 0x23, 0x61, 0x38, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0,
+    0x4c, 0x2c, 0xb0, 0x08, 0x23, 0x42, 0xb0, 0x4b, 0x2b, 0x2d, 0xb0, 0x4d,
+    0x2c, 0xb2, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb2, 0x00,
+    0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x4f, 0x2c, 0xb2, 0x01, 0x00, 0x44, 0x2b,
+    0x2d, 0xb0, 0x50, 0x2c, 0xb2, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x51,
+    0x2c, 0xb2, 0x00, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x52, 0x2c, 0xb2, 0x00,
+    0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x01, 0x00, 0x45, 0x2b,
+    0x2d, 0xb0, 0x54, 0x2c, 0xb2, 0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x55,
+    0x2c, 0xb3, 0x00, 0x00, 0x00, 0x41, 0x2b, 0x2d, 0xb0, 0x56, 0x2c, 0xb3,
+    0x00, 0x01, 0x00, 0x41, 0x2b, 0x2d, 0xb0, 0x57, 0x2c, 0xb3, 0x01, 0x00,
+    0x00, 0x41, 0x2b, 0x2d, 0xb0, 0x58, 0x2c, 0xb3, 0x01, 0x01, 0x00, 0x41,
+    0x2b, 0x2d, 0xb0, 0x59, 0x2c, 0xb3, 0x00, 0x00, 0x01, 0x41, 0x2b, 0x2d,
+    0xb0, 0x5a, 0x2c, 0xb3, 0x00, 0x01, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x5b,
+    0x2c, 0xb3, 0x01, 0x00, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x5c, 0x2c, 0xb3,
+    0x01, 0x01, 0x01, 0x41, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb2, 0x00, 0x00,
+    0x43, 0x2b, 0x2d, 0xb0, 0x5e, 0x2c, 0xb2, 0x00, 0x01, 0x43, 0x2b, 0x2d,
+    0xb0, 0x5f, 0x2c, 0xb2, 0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x60, 0x2c,
+    0xb2, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x61, 0x2c, 0xb2, 0x00, 0x00,
+    0x46, 0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x00, 0x01, 0x46, 0x2b, 0x2d,
+    0xb0, 0x63, 0x2c, 0xb2, 0x01, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x64, 0x2c,
+    0xb2, 0x01, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x65, 0x2c, 0xb3, 0x00, 0x00,
+    0x00, 0x42, 0x2b, 0x2d, 0xb0, 0x66, 0x2c, 0xb3, 0x00, 0x01, 0x00, 0x42,
+    0x2b, 0x2d, 0xb0, 0x67, 0x2c, 0xb3, 0x01, 0x00, 0x00, 0x42, 0x2b, 0x2d,
+    0xb0, 0x68, 0x2c, 0xb3, 0x01, 0x01, 0x00, 0x42, 0x2b, 0x2d, 0xb0, 0x69,
+    0x2c, 0xb3, 0x00, 0x00, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x6a, 0x2c, 0xb3,
+    0x00, 0x01, 0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x6b, 0x2c, 0xb3, 0x01, 0x00,
+    0x01, 0x42, 0x2b, 0x2d, 0xb0, 0x6c, 0x2c, 0xb3, 0x01, 0x01, 0x01, 0x42,
+    0x2b, 0x2d, 0xb0, 0x6d, 0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0x2e, 0xb1, 0x2e,
+    0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0xb0,
+    0x3e, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0xb0, 0x3f,
+    0x2b, 0x2d, 0xb0, 0x70, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x00, 0x3a, 0x2b,
+    0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb1, 0x01, 0x3a, 0x2b, 0xb0,
+    0x3e, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb1, 0x01, 0x3a, 0x2b, 0xb0, 0x3f,
+    0x2b, 0x2d, 0xb0, 0x73, 0x2c, 0xb0, 0x00, 0x16, 0xb1, 0x01, 0x3a, 0x2b,
+    0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x74, 0x2c, 0xb1, 0x00, 0x3b, 0x2b, 0x2e,
+    0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb1, 0x00, 0x3b,
+    0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x76, 0x2c, 0xb1, 0x00, 0x3b, 0x2b,
+    0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x77, 0x2c, 0xb1, 0x00, 0x3b, 0x2b, 0xb0,
+    0x40, 0x2b, 0x2d, 0xb0, 0x78, 0x2c, 0xb1, 0x01, 0x3b, 0x2b, 0xb0, 0x3e,
+    0x2b, 0x2d, 0xb0, 0x79, 0x2c, 0xb1, 0x01, 0x3b, 0x2b, 0xb0, 0x3f, 0x2b,
+    0x2d, 0xb0, 0x7a, 0x2c, 0xb1, 0x01, 0x3b, 0x2b, 0xb0, 0x40, 0x2b, 0x2d,
+    0xb0, 0x7b, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14,
+    0x2b, 0x2d, 0xb0, 0x7c, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x3e, 0x2b,
+    0x2d, 0xb0, 0x7d, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d,
+    0xb0, 0x7e, 0x2c, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
+    0x7f, 0x2c, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x80,
+    0x2c, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x81, 0x2c,
+    0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x82, 0x2c, 0xb1,
+    0x00, 0x3d, 0x2b, 0x2e, 0xb1, 0x2e, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x83,
+    0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x84, 0x2c,
+    0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x85, 0x2c, 0xb1,
+    0x00, 0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x86, 0x2c, 0xb1, 0x01,
+    0x3d, 0x2b, 0xb0, 0x3e, 0x2b, 0x2d, 0xb0, 0x87, 0x2c, 0xb1, 0x01, 0x3d,
+    0x2b, 0xb0, 0x3f, 0x2b, 0x2d, 0xb0, 0x88, 0x2c, 0xb1, 0x01, 0x3d, 0x2b,
+    0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x89, 0x2c, 0xb3, 0x09, 0x04, 0x02, 0x03,
+    0x45, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x42, 0x2b, 0xb0, 0x08, 0x65,
+    0xb0, 0x03, 0x24, 0x50, 0x78, 0xb1, 0x05, 0x01, 0x15, 0x45, 0x58, 0x30,
+    0x59, 0x2d, 0x00, 0x00, 0x00, 0x4b, 0xb8, 0x00, 0xc8, 0x52, 0x58, 0xb1,
+    0x01, 0x01, 0x8e, 0x59, 0xb0, 0x01, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63,
+    0x70, 0xb1, 0x00, 0x07, 0x42, 0xb4, 0x47, 0x33, 0x1f, 0x03, 0x00, 0x2a,
+    0xb1, 0x00, 0x07, 0x42, 0xb7, 0x3a, 0x08, 0x26, 0x08, 0x12, 0x08, 0x03,
+    0x08, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb7, 0x44, 0x06, 0x30, 0x06, 0x1c,
+    0x06, 0x03, 0x08, 0x2a, 0xb1, 0x00, 0x0a, 0x42, 0xbc, 0x0e, 0xc0, 0x09,
+    0xc0, 0x04, 0xc0, 0x00, 0x03, 0x00, 0x09, 0x2a, 0xb1, 0x00, 0x0d, 0x42,
+    0xbc, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x03, 0x00, 0x09, 0x2a,
+    0xb1, 0x03, 0x00, 0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58, 0xb0, 0x40,
+    0x88, 0x58, 0xb1, 0x03, 0x64, 0x44, 0xb1, 0x26, 0x01, 0x88, 0x51, 0x58,
+    0xba, 0x08, 0x80, 0x00, 0x01, 0x04, 0x40, 0x88, 0x63, 0x54, 0x58, 0xb1,
+    0x03, 0x00, 0x44, 0x59, 0x59, 0x59, 0x59, 0xb7, 0x3c, 0x08, 0x28, 0x08,
+    0x14, 0x08, 0x03, 0x0c, 0x2a, 0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d,
+    0xb1, 0x02, 0x00, 0x44, 0xb3, 0x05, 0x64, 0x06, 0x00, 0x44, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr u8 resources_fonts_act_ttf[] = {
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x4c, 0x54, 0x53, 0x48, 0xbb, 0xe9, 0xaf, 0x31, 0x00, 0x00, 0x03, 0x6c,
+    0x00, 0x00, 0x00, 0x65, 0x4f, 0x53, 0x2f, 0x32, 0x82, 0xe2, 0x1a, 0x0b,
+    0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0x60, 0x56, 0x44, 0x4d, 0x58,
+    0x5f, 0x7a, 0x67, 0x26, 0x00, 0x00, 0x03, 0xd4, 0x00, 0x00, 0x05, 0xe0,
+    0x63, 0x6d, 0x61, 0x70, 0x99, 0x81, 0xe0, 0xba, 0x00, 0x00, 0x12, 0xb8,
+    0x00, 0x00, 0x03, 0x2c, 0x63, 0x76, 0x74, 0x20, 0x00, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x5c, 0x00, 0x00, 0x00, 0x02, 0x66, 0x70, 0x67, 0x6d,
+    0x06, 0x59, 0x9c, 0x37, 0x00, 0x00, 0x15, 0xe4, 0x00, 0x00, 0x01, 0x73,
+    0x67, 0x6c, 0x79, 0x66, 0x3a, 0xdb, 0x20, 0x75, 0x00, 0x00, 0x17, 0x60,
+    0x00, 0x00, 0x53, 0x64, 0x68, 0x64, 0x6d, 0x78, 0x9c, 0x42, 0x96, 0x52,
+    0x00, 0x00, 0x09, 0xb4, 0x00, 0x00, 0x09, 0x04, 0x68, 0x65, 0x61, 0x64,
+    0xf3, 0xb4, 0x2a, 0x4b, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x36,
+    0x68, 0x68, 0x65, 0x61, 0x04, 0x51, 0x00, 0xea, 0x00, 0x00, 0x01, 0x44,
+    0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78, 0x5c, 0xe8, 0xff, 0x7a,
+    0x00, 0x00, 0x01, 0xe8, 0x00, 0x00, 0x01, 0x84, 0x6c, 0x6f, 0x63, 0x61,
+    0x0c, 0x80, 0x22, 0x2e, 0x00, 0x00, 0x6a, 0xc4, 0x00, 0x00, 0x00, 0xc4,
+    0x6d, 0x61, 0x78, 0x70, 0x02, 0x71, 0x01, 0xdf, 0x00, 0x00, 0x01, 0x68,
+    0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0xf6, 0x87, 0x5e, 0x38,
+    0x00, 0x00, 0x6b, 0x88, 0x00, 0x00, 0x01, 0xec, 0x70, 0x6f, 0x73, 0x74,
+    0xff, 0xb8, 0x00, 0x32, 0x00, 0x00, 0x6d, 0x74, 0x00, 0x00, 0x00, 0x20,
+    0x70, 0x72, 0x65, 0x70, 0xb8, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x17, 0x58,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x11, 0x55, 0x03, 0xd4, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x19, 0x03, 0xe8,
+    0x00, 0x00, 0x00, 0x00, 0xc9, 0x93, 0x2a, 0x2b, 0x00, 0x00, 0x00, 0x00,
+    0xc9, 0x93, 0xbd, 0x6d, 0xff, 0x92, 0xff, 0x45, 0x01, 0xce, 0x02, 0x88,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x02, 0xee, 0xff, 0x06, 0x00, 0x00, 0x01, 0xe0,
+    0xff, 0x92, 0xff, 0xa2, 0x01, 0xce, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x61, 0x00, 0x6b, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xf4,
+    0x01, 0x90, 0x00, 0x05, 0x00, 0x04, 0x02, 0xbc, 0x02, 0x8a, 0x00, 0x00,
+    0x00, 0x8c, 0x02, 0xbc, 0x02, 0x8a, 0x00, 0x00, 0x01, 0xdd, 0x00, 0x32,
+    0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x79, 0x72, 0x73, 0x00, 0x40,
+    0x00, 0x20, 0x20, 0x44, 0x02, 0xee, 0xff, 0x06, 0x00, 0x00, 0x02, 0x88,
+    0x00, 0xbb, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd,
+    0x02, 0x74, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00,
+    0x00, 0xc8, 0xff, 0xf5, 0x00, 0xe7, 0x00, 0x06, 0x00, 0xe0, 0x00, 0x05,
+    0x00, 0xe4, 0xff, 0xfc, 0x01, 0x0b, 0x00, 0x0a, 0x01, 0x05, 0xff, 0xfb,
+    0x00, 0x68, 0xff, 0xc1, 0x01, 0x01, 0xff, 0xfd, 0x00, 0xeb, 0xff, 0xf0,
+    0x00, 0x72, 0x00, 0x1b, 0x00, 0xa4, 0xff, 0xcd, 0x00, 0xdc, 0xff, 0xf4,
+    0x00, 0x63, 0x00, 0x16, 0x01, 0x4d, 0x00, 0x09, 0x01, 0x10, 0xff, 0xfe,
+    0x00, 0xec, 0xff, 0xf8, 0x01, 0x11, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xfc,
+    0x00, 0xdc, 0x00, 0x08, 0x01, 0x32, 0x00, 0x08, 0x00, 0x61, 0xff, 0x92,
+    0x01, 0x1f, 0xff, 0xfb, 0x00, 0xb5, 0x00, 0x09, 0x00, 0xe4, 0x00, 0x09,
+    0x00, 0xf2, 0xff, 0xec, 0x01, 0x82, 0xff, 0xf0, 0x01, 0x79, 0xff, 0xf9,
+    0x01, 0x92, 0xff, 0xb6, 0x01, 0x33, 0xff, 0xfe, 0x00, 0xd0, 0xff, 0xf8,
+    0x01, 0x59, 0xff, 0xff, 0x01, 0x18, 0xff, 0xfb, 0x01, 0x0f, 0xff, 0xf9,
+    0x00, 0xd9, 0xff, 0xfb, 0x01, 0x2d, 0x00, 0x0a, 0x01, 0x2b, 0x00, 0x0a,
+    0x00, 0xda, 0x00, 0x06, 0x01, 0xe0, 0x00, 0x08, 0x01, 0x3c, 0x00, 0x0b,
+    0x01, 0x49, 0xff, 0xf8, 0x01, 0x55, 0x00, 0x06, 0x00, 0xf6, 0xff, 0xf0,
+    0x00, 0xa9, 0x00, 0x09, 0x01, 0x38, 0x00, 0x09, 0x00, 0xb6, 0xff, 0xe8,
+    0x01, 0x17, 0xff, 0xf9, 0x01, 0x0d, 0x00, 0x04, 0x00, 0xff, 0x00, 0x0d,
+    0x00, 0xf3, 0xff, 0xf5, 0x01, 0x75, 0x00, 0x0c, 0x01, 0x40, 0x00, 0x10,
+    0x00, 0xbf, 0x00, 0x06, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x07,
+    0x01, 0x50, 0x00, 0x03, 0x01, 0x2f, 0xff, 0xf4, 0x01, 0x1c, 0x00, 0x0d,
+    0x01, 0x3b, 0x00, 0x06, 0x01, 0x2b, 0xff, 0xfe, 0x00, 0xc5, 0xff, 0xf2,
+    0x01, 0x18, 0x00, 0x03, 0x00, 0xea, 0xff, 0xfb, 0x01, 0x2d, 0xff, 0xfb,
+    0x00, 0x7e, 0x00, 0x10, 0x00, 0x7c, 0x00, 0x10, 0x00, 0x8f, 0x00, 0x20,
+    0x00, 0xa4, 0x00, 0x02, 0x01, 0x17, 0xff, 0xf5, 0x00, 0xc8, 0xff, 0xf4,
+    0x01, 0x67, 0x00, 0x04, 0x00, 0xfe, 0xff, 0xff, 0x00, 0x57, 0x00, 0x07,
+    0x00, 0xd2, 0xff, 0xfb, 0x01, 0x0c, 0xff, 0xff, 0x01, 0x49, 0x00, 0x09,
+    0x01, 0x42, 0x00, 0x03, 0x00, 0x7f, 0x00, 0x1a, 0x01, 0x18, 0x00, 0x04,
+    0x00, 0x7d, 0x00, 0x15, 0x00, 0x93, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x02,
+    0x00, 0x9a, 0xff, 0xfd, 0x00, 0xeb, 0xff, 0xe8, 0x01, 0x9a, 0xff, 0xfa,
+    0x00, 0xb2, 0x00, 0x12, 0x00, 0xbb, 0x00, 0x12, 0x00, 0xba, 0x00, 0x02,
+    0x00, 0xb8, 0x00, 0x02, 0x01, 0x03, 0x00, 0x03, 0x01, 0x58, 0x00, 0x0d,
+    0x00, 0x93, 0xff, 0xfc, 0x00, 0xc2, 0xff, 0xf7, 0x00, 0xce, 0xff, 0xf7,
+    0x00, 0x92, 0x00, 0x17, 0x01, 0x27, 0x00, 0x05, 0x00, 0xf7, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x61, 0x01, 0x44, 0x01, 0x44, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x26, 0x44, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2b, 0x01, 0x4c, 0x01, 0x01,
+    0x01, 0x01, 0x4c, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x33, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4c, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x0c, 0x00, 0xf8, 0x08, 0xff,
+    0x00, 0x08, 0x00, 0x06, 0xff, 0xfe, 0x00, 0x09, 0x00, 0x06, 0xff, 0xfe,
+    0x00, 0x0a, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x0b, 0x00, 0x08, 0xff, 0xfd,
+    0x00, 0x0c, 0x00, 0x08, 0xff, 0xfd, 0x00, 0x0d, 0x00, 0x09, 0xff, 0xfd,
+    0x00, 0x0e, 0x00, 0x0a, 0xff, 0xfd, 0x00, 0x0f, 0x00, 0x0a, 0xff, 0xfd,
+    0x00, 0x10, 0x00, 0x0b, 0xff, 0xfd, 0x00, 0x11, 0x00, 0x0c, 0xff, 0xfc,
+    0x00, 0x12, 0x00, 0x0c, 0xff, 0xfc, 0x00, 0x13, 0x00, 0x0d, 0xff, 0xfc,
+    0x00, 0x14, 0x00, 0x0d, 0xff, 0xfc, 0x00, 0x15, 0x00, 0x0e, 0xff, 0xfc,
+    0x00, 0x16, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x17, 0x00, 0x0f, 0xff, 0xfb,
+    0x00, 0x18, 0x00, 0x10, 0xff, 0xfb, 0x00, 0x19, 0x00, 0x11, 0xff, 0xfb,
+    0x00, 0x1a, 0x00, 0x11, 0xff, 0xfb, 0x00, 0x1b, 0x00, 0x12, 0xff, 0xfa,
+    0x00, 0x1c, 0x00, 0x13, 0xff, 0xfa, 0x00, 0x1d, 0x00, 0x13, 0xff, 0xfa,
+    0x00, 0x1e, 0x00, 0x14, 0xff, 0xfa, 0x00, 0x1f, 0x00, 0x15, 0xff, 0xfa,
+    0x00, 0x20, 0x00, 0x15, 0xff, 0xfa, 0x00, 0x21, 0x00, 0x16, 0xff, 0xf9,
+    0x00, 0x22, 0x00, 0x17, 0xff, 0xf9, 0x00, 0x23, 0x00, 0x17, 0xff, 0xf9,
+    0x00, 0x24, 0x00, 0x18, 0xff, 0xf9, 0x00, 0x25, 0x00, 0x18, 0xff, 0xf9,
+    0x00, 0x26, 0x00, 0x19, 0xff, 0xf8, 0x00, 0x27, 0x00, 0x1a, 0xff, 0xf8,
+    0x00, 0x28, 0x00, 0x1a, 0xff, 0xf8, 0x00, 0x29, 0x00, 0x1b, 0xff, 0xf8,
+    0x00, 0x2a, 0x00, 0x1c, 0xff, 0xf8, 0x00, 0x2b, 0x00, 0x1c, 0xff, 0xf7,
+    0x00, 0x2c, 0x00, 0x1d, 0xff, 0xf7, 0x00, 0x2d, 0x00, 0x1e, 0xff, 0xf7,
+    0x00, 0x2e, 0x00, 0x1e, 0xff, 0xf7, 0x00, 0x2f, 0x00, 0x1f, 0xff, 0xf7,
+    0x00, 0x30, 0x00, 0x20, 0xff, 0xf7, 0x00, 0x31, 0x00, 0x20, 0xff, 0xf6,
+    0x00, 0x32, 0x00, 0x21, 0xff, 0xf6, 0x00, 0x33, 0x00, 0x22, 0xff, 0xf6,
+    0x00, 0x34, 0x00, 0x22, 0xff, 0xf6, 0x00, 0x35, 0x00, 0x23, 0xff, 0xf6,
+    0x00, 0x36, 0x00, 0x23, 0xff, 0xf5, 0x00, 0x37, 0x00, 0x24, 0xff, 0xf5,
+    0x00, 0x38, 0x00, 0x25, 0xff, 0xf5, 0x00, 0x39, 0x00, 0x25, 0xff, 0xf5,
+    0x00, 0x3a, 0x00, 0x26, 0xff, 0xf5, 0x00, 0x3b, 0x00, 0x27, 0xff, 0xf4,
+    0x00, 0x3c, 0x00, 0x27, 0xff, 0xf4, 0x00, 0x3d, 0x00, 0x28, 0xff, 0xf4,
+    0x00, 0x3e, 0x00, 0x29, 0xff, 0xf4, 0x00, 0x3f, 0x00, 0x29, 0xff, 0xf4,
+    0x00, 0x40, 0x00, 0x2a, 0xff, 0xf4, 0x00, 0x41, 0x00, 0x2b, 0xff, 0xf3,
+    0x00, 0x42, 0x00, 0x2b, 0xff, 0xf3, 0x00, 0x43, 0x00, 0x2c, 0xff, 0xf3,
+    0x00, 0x44, 0x00, 0x2d, 0xff, 0xf3, 0x00, 0x45, 0x00, 0x2d, 0xff, 0xf3,
+    0x00, 0x46, 0x00, 0x2e, 0xff, 0xf2, 0x00, 0x47, 0x00, 0x2f, 0xff, 0xf2,
+    0x00, 0x48, 0x00, 0x2f, 0xff, 0xf2, 0x00, 0x49, 0x00, 0x30, 0xff, 0xf2,
+    0x00, 0x4a, 0x00, 0x30, 0xff, 0xf2, 0x00, 0x4b, 0x00, 0x31, 0xff, 0xf1,
+    0x00, 0x4c, 0x00, 0x32, 0xff, 0xf1, 0x00, 0x4d, 0x00, 0x32, 0xff, 0xf1,
+    0x00, 0x4e, 0x00, 0x33, 0xff, 0xf1, 0x00, 0x4f, 0x00, 0x34, 0xff, 0xf1,
+    0x00, 0x50, 0x00, 0x34, 0xff, 0xf1, 0x00, 0x51, 0x00, 0x35, 0xff, 0xf0,
+    0x00, 0x52, 0x00, 0x36, 0xff, 0xf0, 0x00, 0x53, 0x00, 0x36, 0xff, 0xf0,
+    0x00, 0x54, 0x00, 0x37, 0xff, 0xf0, 0x00, 0x55, 0x00, 0x38, 0xff, 0xf0,
+    0x00, 0x56, 0x00, 0x38, 0xff, 0xef, 0x00, 0x57, 0x00, 0x39, 0xff, 0xef,
+    0x00, 0x58, 0x00, 0x3a, 0xff, 0xef, 0x00, 0x59, 0x00, 0x3a, 0xff, 0xef,
+    0x00, 0x5a, 0x00, 0x3b, 0xff, 0xef, 0x00, 0x5b, 0x00, 0x3b, 0xff, 0xee,
+    0x00, 0x5c, 0x00, 0x3c, 0xff, 0xee, 0x00, 0x5d, 0x00, 0x3d, 0xff, 0xee,
+    0x00, 0x5e, 0x00, 0x3d, 0xff, 0xee, 0x00, 0x5f, 0x00, 0x3e, 0xff, 0xee,
+    0x00, 0x60, 0x00, 0x3f, 0xff, 0xee, 0x00, 0x61, 0x00, 0x3f, 0xff, 0xed,
+    0x00, 0x62, 0x00, 0x40, 0xff, 0xed, 0x00, 0x63, 0x00, 0x41, 0xff, 0xed,
+    0x00, 0x64, 0x00, 0x41, 0xff, 0xed, 0x00, 0x65, 0x00, 0x42, 0xff, 0xed,
+    0x00, 0x66, 0x00, 0x43, 0xff, 0xec, 0x00, 0x67, 0x00, 0x43, 0xff, 0xec,
+    0x00, 0x68, 0x00, 0x44, 0xff, 0xec, 0x00, 0x69, 0x00, 0x45, 0xff, 0xec,
+    0x00, 0x6a, 0x00, 0x45, 0xff, 0xec, 0x00, 0x6b, 0x00, 0x46, 0xff, 0xeb,
+    0x00, 0x6c, 0x00, 0x46, 0xff, 0xeb, 0x00, 0x6d, 0x00, 0x47, 0xff, 0xeb,
+    0x00, 0x6e, 0x00, 0x48, 0xff, 0xeb, 0x00, 0x6f, 0x00, 0x48, 0xff, 0xeb,
+    0x00, 0x70, 0x00, 0x49, 0xff, 0xeb, 0x00, 0x71, 0x00, 0x4a, 0xff, 0xea,
+    0x00, 0x72, 0x00, 0x4a, 0xff, 0xea, 0x00, 0x73, 0x00, 0x4b, 0xff, 0xea,
+    0x00, 0x74, 0x00, 0x4c, 0xff, 0xea, 0x00, 0x75, 0x00, 0x4c, 0xff, 0xea,
+    0x00, 0x76, 0x00, 0x4d, 0xff, 0xe9, 0x00, 0x77, 0x00, 0x4e, 0xff, 0xe9,
+    0x00, 0x78, 0x00, 0x4e, 0xff, 0xe9, 0x00, 0x79, 0x00, 0x4f, 0xff, 0xe9,
+    0x00, 0x7a, 0x00, 0x50, 0xff, 0xe9, 0x00, 0x7b, 0x00, 0x50, 0xff, 0xe8,
+    0x00, 0x7c, 0x00, 0x51, 0xff, 0xe8, 0x00, 0x7d, 0x00, 0x51, 0xff, 0xe8,
+    0x00, 0x7e, 0x00, 0x52, 0xff, 0xe8, 0x00, 0x7f, 0x00, 0x53, 0xff, 0xe8,
+    0x00, 0x80, 0x00, 0x53, 0xff, 0xe8, 0x00, 0x81, 0x00, 0x54, 0xff, 0xe7,
+    0x00, 0x82, 0x00, 0x55, 0xff, 0xe7, 0x00, 0x83, 0x00, 0x55, 0xff, 0xe7,
+    0x00, 0x84, 0x00, 0x56, 0xff, 0xe7, 0x00, 0x85, 0x00, 0x57, 0xff, 0xe7,
+    0x00, 0x86, 0x00, 0x57, 0xff, 0xe6, 0x00, 0x87, 0x00, 0x58, 0xff, 0xe6,
+    0x00, 0x88, 0x00, 0x59, 0xff, 0xe6, 0x00, 0x89, 0x00, 0x59, 0xff, 0xe6,
+    0x00, 0x8a, 0x00, 0x5a, 0xff, 0xe6, 0x00, 0x8b, 0x00, 0x5b, 0xff, 0xe6,
+    0x00, 0x8c, 0x00, 0x5b, 0xff, 0xe5, 0x00, 0x8d, 0x00, 0x5c, 0xff, 0xe5,
+    0x00, 0x8e, 0x00, 0x5d, 0xff, 0xe5, 0x00, 0x8f, 0x00, 0x5d, 0xff, 0xe5,
+    0x00, 0x90, 0x00, 0x5e, 0xff, 0xe5, 0x00, 0x91, 0x00, 0x5e, 0xff, 0xe4,
+    0x00, 0x92, 0x00, 0x5f, 0xff, 0xe4, 0x00, 0x93, 0x00, 0x60, 0xff, 0xe4,
+    0x00, 0x94, 0x00, 0x60, 0xff, 0xe4, 0x00, 0x95, 0x00, 0x61, 0xff, 0xe4,
+    0x00, 0x96, 0x00, 0x62, 0xff, 0xe3, 0x00, 0x97, 0x00, 0x62, 0xff, 0xe3,
+    0x00, 0x98, 0x00, 0x63, 0xff, 0xe3, 0x00, 0x99, 0x00, 0x64, 0xff, 0xe3,
+    0x00, 0x9a, 0x00, 0x64, 0xff, 0xe3, 0x00, 0x9b, 0x00, 0x65, 0xff, 0xe3,
+    0x00, 0x9c, 0x00, 0x66, 0xff, 0xe2, 0x00, 0x9d, 0x00, 0x66, 0xff, 0xe2,
+    0x00, 0x9e, 0x00, 0x67, 0xff, 0xe2, 0x00, 0x9f, 0x00, 0x68, 0xff, 0xe2,
+    0x00, 0xa0, 0x00, 0x68, 0xff, 0xe2, 0x00, 0xa1, 0x00, 0x69, 0xff, 0xe1,
+    0x00, 0xa2, 0x00, 0x69, 0xff, 0xe1, 0x00, 0xa3, 0x00, 0x6a, 0xff, 0xe1,
+    0x00, 0xa4, 0x00, 0x6b, 0xff, 0xe1, 0x00, 0xa5, 0x00, 0x6b, 0xff, 0xe1,
+    0x00, 0xa6, 0x00, 0x6c, 0xff, 0xe0, 0x00, 0xa7, 0x00, 0x6d, 0xff, 0xe0,
+    0x00, 0xa8, 0x00, 0x6d, 0xff, 0xe0, 0x00, 0xa9, 0x00, 0x6e, 0xff, 0xe0,
+    0x00, 0xaa, 0x00, 0x6f, 0xff, 0xe0, 0x00, 0xab, 0x00, 0x6f, 0xff, 0xe0,
+    0x00, 0xac, 0x00, 0x70, 0xff, 0xdf, 0x00, 0xad, 0x00, 0x71, 0xff, 0xdf,
+    0x00, 0xae, 0x00, 0x71, 0xff, 0xdf, 0x00, 0xaf, 0x00, 0x72, 0xff, 0xdf,
+    0x00, 0xb0, 0x00, 0x73, 0xff, 0xdf, 0x00, 0xb1, 0x00, 0x73, 0xff, 0xde,
+    0x00, 0xb2, 0x00, 0x74, 0xff, 0xde, 0x00, 0xb3, 0x00, 0x74, 0xff, 0xde,
+    0x00, 0xb4, 0x00, 0x75, 0xff, 0xde, 0x00, 0xb5, 0x00, 0x76, 0xff, 0xde,
+    0x00, 0xb6, 0x00, 0x76, 0xff, 0xdd, 0x00, 0xb7, 0x00, 0x77, 0xff, 0xdd,
+    0x00, 0xb8, 0x00, 0x78, 0xff, 0xdd, 0x00, 0xb9, 0x00, 0x78, 0xff, 0xdd,
+    0x00, 0xba, 0x00, 0x79, 0xff, 0xdd, 0x00, 0xbb, 0x00, 0x7a, 0xff, 0xdd,
+    0x00, 0xbc, 0x00, 0x7a, 0xff, 0xdc, 0x00, 0xbd, 0x00, 0x7b, 0xff, 0xdc,
+    0x00, 0xbe, 0x00, 0x7c, 0xff, 0xdc, 0x00, 0xbf, 0x00, 0x7c, 0xff, 0xdc,
+    0x00, 0xc0, 0x00, 0x7d, 0xff, 0xdc, 0x00, 0xc1, 0x00, 0x7e, 0xff, 0xdb,
+    0x00, 0xc2, 0x00, 0x7e, 0xff, 0xdb, 0x00, 0xc3, 0x00, 0x7f, 0xff, 0xdb,
+    0x00, 0xc4, 0x00, 0x80, 0xff, 0xdb, 0x00, 0xc5, 0x00, 0x80, 0xff, 0xdb,
+    0x00, 0xc6, 0x00, 0x81, 0xff, 0xda, 0x00, 0xc7, 0x00, 0x81, 0xff, 0xda,
+    0x00, 0xc8, 0x00, 0x82, 0xff, 0xda, 0x00, 0xc9, 0x00, 0x83, 0xff, 0xda,
+    0x00, 0xca, 0x00, 0x83, 0xff, 0xda, 0x00, 0xcb, 0x00, 0x84, 0xff, 0xda,
+    0x00, 0xcc, 0x00, 0x85, 0xff, 0xd9, 0x00, 0xcd, 0x00, 0x85, 0xff, 0xd9,
+    0x00, 0xce, 0x00, 0x86, 0xff, 0xd9, 0x00, 0xcf, 0x00, 0x87, 0xff, 0xd9,
+    0x00, 0xd0, 0x00, 0x87, 0xff, 0xd9, 0x00, 0xd1, 0x00, 0x88, 0xff, 0xd8,
+    0x00, 0xd2, 0x00, 0x89, 0xff, 0xd8, 0x00, 0xd3, 0x00, 0x89, 0xff, 0xd8,
+    0x00, 0xd4, 0x00, 0x8a, 0xff, 0xd8, 0x00, 0xd5, 0x00, 0x8b, 0xff, 0xd8,
+    0x00, 0xd6, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0xd7, 0x00, 0x8c, 0xff, 0xd7,
+    0x00, 0xd8, 0x00, 0x8c, 0xff, 0xd7, 0x00, 0xd9, 0x00, 0x8d, 0xff, 0xd7,
+    0x00, 0xda, 0x00, 0x8e, 0xff, 0xd7, 0x00, 0xdb, 0x00, 0x8e, 0xff, 0xd7,
+    0x00, 0xdc, 0x00, 0x8f, 0xff, 0xd6, 0x00, 0xdd, 0x00, 0x90, 0xff, 0xd6,
+    0x00, 0xde, 0x00, 0x90, 0xff, 0xd6, 0x00, 0xdf, 0x00, 0x91, 0xff, 0xd6,
+    0x00, 0xe0, 0x00, 0x92, 0xff, 0xd6, 0x00, 0xe1, 0x00, 0x92, 0xff, 0xd5,
+    0x00, 0xe2, 0x00, 0x93, 0xff, 0xd5, 0x00, 0xe3, 0x00, 0x94, 0xff, 0xd5,
+    0x00, 0xe4, 0x00, 0x94, 0xff, 0xd5, 0x00, 0xe5, 0x00, 0x95, 0xff, 0xd5,
+    0x00, 0xe6, 0x00, 0x96, 0xff, 0xd4, 0x00, 0xe7, 0x00, 0x96, 0xff, 0xd4,
+    0x00, 0xe8, 0x00, 0x97, 0xff, 0xd4, 0x00, 0xe9, 0x00, 0x97, 0xff, 0xd4,
+    0x00, 0xea, 0x00, 0x98, 0xff, 0xd4, 0x00, 0xeb, 0x00, 0x99, 0xff, 0xd4,
+    0x00, 0xec, 0x00, 0x99, 0xff, 0xd3, 0x00, 0xed, 0x00, 0x9a, 0xff, 0xd3,
+    0x00, 0xee, 0x00, 0x9b, 0xff, 0xd3, 0x00, 0xef, 0x00, 0x9b, 0xff, 0xd3,
+    0x00, 0xf0, 0x00, 0x9c, 0xff, 0xd3, 0x00, 0xf1, 0x00, 0x9d, 0xff, 0xd2,
+    0x00, 0xf2, 0x00, 0x9d, 0xff, 0xd2, 0x00, 0xf3, 0x00, 0x9e, 0xff, 0xd2,
+    0x00, 0xf4, 0x00, 0x9f, 0xff, 0xd2, 0x00, 0xf5, 0x00, 0x9f, 0xff, 0xd2,
+    0x00, 0xf6, 0x00, 0xa0, 0xff, 0xd1, 0x00, 0xf7, 0x00, 0xa1, 0xff, 0xd1,
+    0x00, 0xf8, 0x00, 0xa1, 0xff, 0xd1, 0x00, 0xf9, 0x00, 0xa2, 0xff, 0xd1,
+    0x00, 0xfa, 0x00, 0xa2, 0xff, 0xd1, 0x00, 0xfb, 0x00, 0xa3, 0xff, 0xd1,
+    0x00, 0xfc, 0x00, 0xa4, 0xff, 0xd0, 0x00, 0xfd, 0x00, 0xa4, 0xff, 0xd0,
+    0x00, 0xfe, 0x00, 0xa5, 0xff, 0xd0, 0x00, 0xff, 0x00, 0xa6, 0xff, 0xd0,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x64, 0x09, 0x05, 0x02, 0x03,
+    0x02, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01,
+    0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x03, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x04, 0x03, 0x02, 0x03, 0x04, 0x04, 0x02, 0x03, 0x03, 0x02,
+    0x04, 0x05, 0x03, 0x04, 0x02, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02,
+    0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03,
+    0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x03, 0x02, 0x01, 0x02,
+    0x02, 0x03, 0x03, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x02, 0x04, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x00,
+    0x0a, 0x05, 0x02, 0x03, 0x02, 0x04, 0x02, 0x03, 0x03, 0x01, 0x03, 0x02,
+    0x01, 0x02, 0x02, 0x01, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x01,
+    0x03, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x03, 0x02, 0x03, 0x04, 0x04,
+    0x02, 0x03, 0x03, 0x02, 0x05, 0x05, 0x03, 0x04, 0x02, 0x02, 0x03, 0x02,
+    0x04, 0x04, 0x03, 0x02, 0x04, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02,
+    0x04, 0x03, 0x01, 0x02, 0x03, 0x03, 0x03, 0x01, 0x03, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04, 0x03, 0x03, 0x01, 0x02, 0x02,
+    0x01, 0x03, 0x02, 0x00, 0x0b, 0x05, 0x02, 0x03, 0x03, 0x04, 0x03, 0x03,
+    0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x02, 0x01, 0x04, 0x03, 0x03, 0x03,
+    0x03, 0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x03,
+    0x02, 0x04, 0x04, 0x04, 0x02, 0x03, 0x03, 0x02, 0x05, 0x05, 0x04, 0x05,
+    0x03, 0x02, 0x03, 0x02, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x03, 0x02,
+    0x02, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x02, 0x03, 0x04, 0x04, 0x01,
+    0x03, 0x01, 0x02, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x0c, 0x06, 0x02, 0x04,
+    0x03, 0x04, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x02, 0x03, 0x01,
+    0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x01, 0x03, 0x02, 0x03, 0x03,
+    0x05, 0x05, 0x05, 0x04, 0x03, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x03,
+    0x06, 0x05, 0x04, 0x05, 0x03, 0x02, 0x04, 0x02, 0x04, 0x05, 0x03, 0x03,
+    0x04, 0x04, 0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 0x04, 0x04, 0x02, 0x03,
+    0x04, 0x04, 0x02, 0x01, 0x02, 0x02, 0x03, 0x02, 0x04, 0x03, 0x01, 0x03,
+    0x03, 0x04, 0x04, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x05, 0x02,
+    0x02, 0x02, 0x03, 0x03, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x00,
+    0x0d, 0x06, 0x02, 0x04, 0x03, 0x04, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03,
+    0x01, 0x02, 0x03, 0x01, 0x04, 0x04, 0x03, 0x04, 0x03, 0x03, 0x04, 0x01,
+    0x04, 0x02, 0x03, 0x03, 0x05, 0x05, 0x05, 0x04, 0x03, 0x04, 0x05, 0x05,
+    0x03, 0x04, 0x04, 0x03, 0x06, 0x06, 0x04, 0x05, 0x03, 0x02, 0x04, 0x02,
+    0x05, 0x05, 0x03, 0x03, 0x05, 0x04, 0x03, 0x02, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x03, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x04, 0x03,
+    0x05, 0x03, 0x01, 0x03, 0x03, 0x04, 0x04, 0x02, 0x04, 0x02, 0x02, 0x03,
+    0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x02, 0x03, 0x03,
+    0x02, 0x04, 0x03, 0x00, 0x0f, 0x07, 0x03, 0x04, 0x03, 0x05, 0x03, 0x04,
+    0x04, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03, 0x01, 0x05, 0x04, 0x04, 0x04,
+    0x04, 0x03, 0x05, 0x01, 0x04, 0x03, 0x03, 0x04, 0x06, 0x06, 0x06, 0x05,
+    0x03, 0x05, 0x05, 0x05, 0x03, 0x05, 0x04, 0x03, 0x07, 0x06, 0x05, 0x06,
+    0x04, 0x03, 0x05, 0x03, 0x05, 0x05, 0x04, 0x04, 0x06, 0x05, 0x04, 0x03,
+    0x03, 0x05, 0x05, 0x04, 0x05, 0x04, 0x03, 0x04, 0x04, 0x05, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0x03, 0x05, 0x04, 0x01, 0x03, 0x04, 0x05, 0x05, 0x02,
+    0x04, 0x02, 0x02, 0x03, 0x02, 0x04, 0x06, 0x03, 0x03, 0x03, 0x03, 0x04,
+    0x05, 0x02, 0x03, 0x03, 0x02, 0x04, 0x04, 0x00, 0x10, 0x08, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x04, 0x04, 0x02, 0x04, 0x04, 0x02, 0x03, 0x04, 0x02,
+    0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x02, 0x05, 0x03, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x05, 0x03, 0x06, 0x05, 0x05, 0x03, 0x05, 0x05, 0x03,
+    0x08, 0x06, 0x05, 0x06, 0x04, 0x03, 0x05, 0x03, 0x05, 0x06, 0x04, 0x04,
+    0x06, 0x05, 0x04, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04,
+    0x04, 0x05, 0x02, 0x02, 0x02, 0x03, 0x04, 0x03, 0x06, 0x04, 0x01, 0x03,
+    0x04, 0x05, 0x05, 0x02, 0x04, 0x02, 0x02, 0x04, 0x02, 0x04, 0x07, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x06, 0x02, 0x03, 0x03, 0x02, 0x05, 0x04, 0x00,
+    0x11, 0x08, 0x03, 0x04, 0x04, 0x05, 0x04, 0x05, 0x04, 0x02, 0x04, 0x04,
+    0x02, 0x03, 0x04, 0x02, 0x06, 0x05, 0x04, 0x05, 0x04, 0x04, 0x05, 0x02,
+    0x05, 0x03, 0x04, 0x04, 0x07, 0x06, 0x07, 0x05, 0x04, 0x06, 0x05, 0x05,
+    0x04, 0x05, 0x05, 0x04, 0x08, 0x07, 0x06, 0x06, 0x04, 0x03, 0x05, 0x03,
+    0x06, 0x06, 0x04, 0x04, 0x06, 0x05, 0x04, 0x03, 0x04, 0x06, 0x05, 0x05,
+    0x05, 0x05, 0x03, 0x05, 0x04, 0x05, 0x02, 0x02, 0x02, 0x03, 0x05, 0x03,
+    0x06, 0x04, 0x01, 0x04, 0x05, 0x06, 0x05, 0x02, 0x05, 0x02, 0x03, 0x04,
+    0x03, 0x04, 0x07, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x03, 0x03, 0x04,
+    0x02, 0x05, 0x04, 0x00, 0x13, 0x09, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05,
+    0x05, 0x02, 0x05, 0x04, 0x02, 0x03, 0x04, 0x02, 0x06, 0x05, 0x04, 0x05,
+    0x05, 0x04, 0x06, 0x02, 0x05, 0x03, 0x04, 0x05, 0x07, 0x07, 0x08, 0x06,
+    0x04, 0x07, 0x06, 0x06, 0x04, 0x06, 0x06, 0x04, 0x09, 0x07, 0x06, 0x07,
+    0x05, 0x03, 0x06, 0x03, 0x06, 0x06, 0x05, 0x05, 0x07, 0x06, 0x04, 0x04,
+    0x04, 0x06, 0x06, 0x05, 0x06, 0x06, 0x04, 0x05, 0x05, 0x06, 0x02, 0x02,
+    0x03, 0x03, 0x05, 0x04, 0x07, 0x05, 0x02, 0x04, 0x05, 0x06, 0x06, 0x02,
+    0x05, 0x02, 0x03, 0x04, 0x03, 0x04, 0x08, 0x03, 0x04, 0x04, 0x04, 0x05,
+    0x07, 0x03, 0x04, 0x04, 0x03, 0x06, 0x05, 0x00, 0x15, 0x0a, 0x04, 0x05,
+    0x05, 0x05, 0x05, 0x06, 0x05, 0x02, 0x05, 0x05, 0x02, 0x03, 0x05, 0x02,
+    0x07, 0x06, 0x05, 0x06, 0x05, 0x05, 0x06, 0x02, 0x06, 0x04, 0x05, 0x05,
+    0x08, 0x08, 0x08, 0x06, 0x04, 0x07, 0x06, 0x06, 0x05, 0x06, 0x06, 0x05,
+    0x0a, 0x08, 0x07, 0x08, 0x05, 0x04, 0x07, 0x04, 0x06, 0x07, 0x05, 0x05,
+    0x08, 0x07, 0x05, 0x04, 0x05, 0x07, 0x06, 0x06, 0x07, 0x06, 0x04, 0x06,
+    0x05, 0x06, 0x03, 0x03, 0x03, 0x03, 0x06, 0x04, 0x08, 0x05, 0x02, 0x04,
+    0x06, 0x07, 0x07, 0x03, 0x06, 0x03, 0x03, 0x05, 0x03, 0x05, 0x09, 0x04,
+    0x04, 0x04, 0x04, 0x05, 0x07, 0x03, 0x04, 0x04, 0x03, 0x06, 0x05, 0x00,
+    0x18, 0x0c, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x03, 0x06, 0x06,
+    0x03, 0x04, 0x05, 0x02, 0x08, 0x07, 0x06, 0x07, 0x06, 0x05, 0x07, 0x02,
+    0x07, 0x04, 0x05, 0x06, 0x09, 0x09, 0x0a, 0x07, 0x05, 0x08, 0x07, 0x07,
+    0x05, 0x07, 0x07, 0x05, 0x0c, 0x07, 0x08, 0x08, 0x06, 0x04, 0x07, 0x04,
+    0x07, 0x07, 0x06, 0x06, 0x09, 0x08, 0x05, 0x05, 0x05, 0x08, 0x07, 0x07,
+    0x08, 0x07, 0x05, 0x07, 0x06, 0x07, 0x03, 0x03, 0x03, 0x04, 0x07, 0x05,
+    0x09, 0x06, 0x02, 0x05, 0x06, 0x08, 0x08, 0x03, 0x07, 0x03, 0x04, 0x05,
+    0x04, 0x06, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x06, 0x08, 0x04, 0x05, 0x05,
+    0x04, 0x07, 0x06, 0x00, 0x1b, 0x0d, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07,
+    0x07, 0x03, 0x07, 0x06, 0x03, 0x04, 0x06, 0x03, 0x09, 0x07, 0x06, 0x07,
+    0x07, 0x06, 0x08, 0x03, 0x08, 0x05, 0x06, 0x07, 0x0a, 0x0a, 0x0b, 0x08,
+    0x06, 0x09, 0x08, 0x07, 0x06, 0x08, 0x08, 0x06, 0x0d, 0x08, 0x09, 0x09,
+    0x07, 0x05, 0x08, 0x05, 0x08, 0x08, 0x07, 0x07, 0x0a, 0x09, 0x05, 0x05,
+    0x06, 0x09, 0x08, 0x08, 0x09, 0x08, 0x05, 0x08, 0x06, 0x08, 0x03, 0x03,
+    0x04, 0x04, 0x08, 0x05, 0x0a, 0x07, 0x02, 0x06, 0x07, 0x09, 0x09, 0x03,
+    0x08, 0x03, 0x04, 0x06, 0x04, 0x06, 0x0b, 0x05, 0x05, 0x05, 0x04, 0x07,
+    0x09, 0x04, 0x05, 0x06, 0x04, 0x08, 0x07, 0x00, 0x1d, 0x0e, 0x06, 0x06,
+    0x07, 0x07, 0x07, 0x08, 0x08, 0x03, 0x07, 0x07, 0x03, 0x05, 0x06, 0x03,
+    0x0a, 0x08, 0x07, 0x08, 0x07, 0x06, 0x09, 0x03, 0x08, 0x05, 0x07, 0x07,
+    0x0b, 0x0b, 0x0c, 0x09, 0x06, 0x0a, 0x08, 0x08, 0x06, 0x09, 0x09, 0x06,
+    0x0e, 0x09, 0x0a, 0x0a, 0x07, 0x05, 0x09, 0x05, 0x08, 0x09, 0x07, 0x07,
+    0x0b, 0x09, 0x06, 0x06, 0x07, 0x0a, 0x09, 0x08, 0x09, 0x09, 0x06, 0x08,
+    0x06, 0x09, 0x04, 0x04, 0x04, 0x05, 0x08, 0x06, 0x0a, 0x07, 0x03, 0x06,
+    0x08, 0x0a, 0x09, 0x04, 0x08, 0x04, 0x04, 0x06, 0x04, 0x07, 0x0c, 0x05,
+    0x05, 0x05, 0x05, 0x08, 0x0a, 0x04, 0x06, 0x06, 0x04, 0x09, 0x07, 0x00,
+    0x20, 0x0f, 0x06, 0x07, 0x07, 0x07, 0x07, 0x09, 0x08, 0x03, 0x08, 0x08,
+    0x04, 0x05, 0x07, 0x03, 0x0b, 0x09, 0x08, 0x09, 0x08, 0x07, 0x0a, 0x03,
+    0x09, 0x06, 0x07, 0x08, 0x0c, 0x0c, 0x0d, 0x0a, 0x07, 0x0b, 0x09, 0x08,
+    0x07, 0x0a, 0x0a, 0x07, 0x0f, 0x09, 0x0b, 0x0b, 0x08, 0x05, 0x0a, 0x06,
+    0x09, 0x09, 0x08, 0x08, 0x0c, 0x0a, 0x06, 0x06, 0x07, 0x0b, 0x0a, 0x09,
+    0x0a, 0x0a, 0x06, 0x09, 0x07, 0x0a, 0x04, 0x04, 0x05, 0x05, 0x09, 0x06,
+    0x0b, 0x08, 0x03, 0x07, 0x09, 0x0b, 0x0a, 0x04, 0x09, 0x04, 0x05, 0x07,
+    0x05, 0x08, 0x0d, 0x06, 0x06, 0x06, 0x05, 0x08, 0x0b, 0x05, 0x06, 0x07,
+    0x05, 0x09, 0x08, 0x00, 0x21, 0x10, 0x06, 0x07, 0x08, 0x07, 0x08, 0x09,
+    0x09, 0x03, 0x08, 0x08, 0x04, 0x05, 0x07, 0x03, 0x0b, 0x09, 0x08, 0x09,
+    0x08, 0x07, 0x0a, 0x03, 0x09, 0x06, 0x08, 0x08, 0x0d, 0x0c, 0x0d, 0x0a,
+    0x07, 0x0b, 0x09, 0x09, 0x07, 0x0a, 0x0a, 0x07, 0x10, 0x0a, 0x0b, 0x0b,
+    0x08, 0x06, 0x0a, 0x06, 0x09, 0x09, 0x08, 0x08, 0x0c, 0x0b, 0x06, 0x06,
+    0x07, 0x0b, 0x0a, 0x09, 0x0a, 0x0a, 0x07, 0x09, 0x07, 0x0a, 0x04, 0x04,
+    0x05, 0x05, 0x09, 0x07, 0x0c, 0x08, 0x03, 0x07, 0x09, 0x0b, 0x0b, 0x04,
+    0x09, 0x04, 0x05, 0x07, 0x05, 0x08, 0x0e, 0x06, 0x06, 0x06, 0x05, 0x09,
+    0x0b, 0x05, 0x06, 0x07, 0x05, 0x0a, 0x08, 0x00, 0x25, 0x12, 0x07, 0x08,
+    0x09, 0x0a, 0x08, 0x0a, 0x0a, 0x04, 0x0a, 0x09, 0x04, 0x06, 0x08, 0x04,
+    0x0c, 0x0a, 0x09, 0x0a, 0x09, 0x08, 0x0b, 0x04, 0x0b, 0x07, 0x08, 0x09,
+    0x0e, 0x0e, 0x0f, 0x0b, 0x08, 0x0d, 0x0b, 0x09, 0x08, 0x0b, 0x0b, 0x08,
+    0x12, 0x0b, 0x0c, 0x0c, 0x09, 0x06, 0x0c, 0x07, 0x0a, 0x0a, 0x09, 0x09,
+    0x0e, 0x0c, 0x07, 0x07, 0x08, 0x0c, 0x0b, 0x0b, 0x0c, 0x0b, 0x07, 0x0a,
+    0x09, 0x0b, 0x05, 0x05, 0x05, 0x06, 0x0a, 0x07, 0x0d, 0x09, 0x03, 0x08,
+    0x0a, 0x0c, 0x0c, 0x05, 0x0a, 0x05, 0x05, 0x08, 0x06, 0x09, 0x0f, 0x07,
+    0x07, 0x07, 0x05, 0x0a, 0x0d, 0x05, 0x07, 0x08, 0x05, 0x0b, 0x09, 0x00,
+    0x2a, 0x14, 0x08, 0x09, 0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x04, 0x0b, 0x0a,
+    0x05, 0x07, 0x09, 0x04, 0x0e, 0x0b, 0x0a, 0x0b, 0x0b, 0x09, 0x0d, 0x04,
+    0x0c, 0x08, 0x0a, 0x0a, 0x10, 0x10, 0x11, 0x0d, 0x09, 0x0e, 0x0c, 0x0b,
+    0x09, 0x0d, 0x0d, 0x09, 0x14, 0x0e, 0x0e, 0x0e, 0x0a, 0x07, 0x0d, 0x08,
+    0x0c, 0x0c, 0x0b, 0x0a, 0x10, 0x0d, 0x08, 0x08, 0x09, 0x0e, 0x0d, 0x0c,
+    0x0d, 0x0d, 0x08, 0x0c, 0x0a, 0x0d, 0x05, 0x05, 0x06, 0x07, 0x0c, 0x08,
+    0x0f, 0x0b, 0x04, 0x09, 0x0b, 0x0e, 0x0e, 0x05, 0x0c, 0x05, 0x06, 0x09,
+    0x06, 0x0a, 0x11, 0x07, 0x08, 0x08, 0x08, 0x0b, 0x0e, 0x06, 0x08, 0x09,
+    0x06, 0x0c, 0x0a, 0x00, 0x2e, 0x16, 0x09, 0x0a, 0x0b, 0x0a, 0x0a, 0x0c,
+    0x0c, 0x05, 0x0c, 0x0b, 0x05, 0x08, 0x0a, 0x05, 0x0f, 0x0d, 0x0b, 0x0d,
+    0x0c, 0x0a, 0x0e, 0x04, 0x0d, 0x08, 0x0a, 0x0b, 0x12, 0x11, 0x12, 0x0e,
+    0x0a, 0x10, 0x0d, 0x0c, 0x0a, 0x0e, 0x0e, 0x0a, 0x16, 0x0f, 0x0f, 0x0f,
+    0x0b, 0x08, 0x0e, 0x08, 0x0d, 0x0d, 0x0c, 0x0b, 0x11, 0x0f, 0x09, 0x09,
+    0x0a, 0x0f, 0x0e, 0x0d, 0x0e, 0x0e, 0x09, 0x0d, 0x0b, 0x0e, 0x06, 0x06,
+    0x07, 0x08, 0x0d, 0x09, 0x11, 0x0c, 0x04, 0x0a, 0x0c, 0x0f, 0x0f, 0x06,
+    0x0d, 0x06, 0x07, 0x0a, 0x07, 0x0b, 0x13, 0x08, 0x09, 0x09, 0x09, 0x0c,
+    0x10, 0x07, 0x09, 0x09, 0x07, 0x0e, 0x0b, 0x00, 0x32, 0x18, 0x0a, 0x0a,
+    0x0c, 0x0b, 0x0b, 0x0d, 0x0d, 0x05, 0x0d, 0x0c, 0x06, 0x08, 0x0b, 0x05,
+    0x11, 0x0e, 0x0c, 0x0e, 0x0d, 0x0b, 0x0f, 0x05, 0x0e, 0x09, 0x0b, 0x0c,
+    0x13, 0x13, 0x14, 0x0f, 0x0a, 0x11, 0x0e, 0x0d, 0x0b, 0x0f, 0x0f, 0x0b,
+    0x18, 0x10, 0x10, 0x11, 0x0c, 0x08, 0x10, 0x09, 0x0e, 0x0e, 0x0d, 0x0c,
+    0x13, 0x10, 0x09, 0x0a, 0x0b, 0x11, 0x0f, 0x0e, 0x10, 0x0f, 0x0a, 0x0e,
+    0x0c, 0x0f, 0x06, 0x06, 0x07, 0x08, 0x0e, 0x0a, 0x12, 0x0d, 0x04, 0x0b,
+    0x0d, 0x10, 0x10, 0x06, 0x0e, 0x06, 0x07, 0x0b, 0x08, 0x0c, 0x15, 0x09,
+    0x09, 0x09, 0x09, 0x0d, 0x11, 0x07, 0x0a, 0x0a, 0x07, 0x0f, 0x0c, 0x00,
+    0x36, 0x1a, 0x0a, 0x0b, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0x06, 0x0e, 0x0d,
+    0x06, 0x09, 0x0c, 0x05, 0x12, 0x0f, 0x0d, 0x0f, 0x0e, 0x0c, 0x11, 0x05,
+    0x10, 0x0a, 0x0c, 0x0d, 0x15, 0x14, 0x16, 0x11, 0x0b, 0x13, 0x0f, 0x0f,
+    0x0c, 0x10, 0x10, 0x0c, 0x1a, 0x11, 0x12, 0x13, 0x0d, 0x09, 0x11, 0x0a,
+    0x0f, 0x0f, 0x0e, 0x0d, 0x14, 0x11, 0x0a, 0x0a, 0x0c, 0x12, 0x10, 0x0f,
+    0x11, 0x10, 0x0b, 0x0f, 0x0c, 0x10, 0x07, 0x07, 0x08, 0x09, 0x0f, 0x0b,
+    0x13, 0x0e, 0x05, 0x0b, 0x0e, 0x12, 0x11, 0x07, 0x0f, 0x07, 0x08, 0x0c,
+    0x08, 0x0d, 0x16, 0x0a, 0x0a, 0x0a, 0x0a, 0x0e, 0x13, 0x08, 0x0a, 0x0b,
+    0x08, 0x10, 0x0d, 0x00, 0x3a, 0x1c, 0x0b, 0x0c, 0x0d, 0x0d, 0x0d, 0x0f,
+    0x0f, 0x06, 0x0f, 0x0e, 0x07, 0x0a, 0x0d, 0x06, 0x13, 0x10, 0x0e, 0x10,
+    0x0f, 0x0d, 0x12, 0x06, 0x11, 0x0b, 0x0d, 0x0e, 0x16, 0x16, 0x17, 0x12,
+    0x0c, 0x14, 0x10, 0x10, 0x0d, 0x11, 0x11, 0x0d, 0x1c, 0x12, 0x13, 0x14,
+    0x0e, 0x0a, 0x12, 0x0b, 0x10, 0x10, 0x0f, 0x0e, 0x16, 0x13, 0x0b, 0x0b,
+    0x0d, 0x13, 0x12, 0x10, 0x12, 0x11, 0x0b, 0x10, 0x0e, 0x11, 0x07, 0x07,
+    0x08, 0x0a, 0x10, 0x0c, 0x15, 0x0f, 0x05, 0x0c, 0x10, 0x13, 0x13, 0x07,
+    0x10, 0x07, 0x09, 0x0d, 0x09, 0x0e, 0x18, 0x0a, 0x0b, 0x0b, 0x0a, 0x0f,
+    0x14, 0x09, 0x0b, 0x0c, 0x08, 0x11, 0x0e, 0x00, 0x43, 0x20, 0x0d, 0x0e,
+    0x0f, 0x10, 0x0f, 0x12, 0x11, 0x07, 0x11, 0x10, 0x08, 0x0b, 0x0f, 0x07,
+    0x16, 0x12, 0x10, 0x12, 0x11, 0x0f, 0x15, 0x07, 0x13, 0x0c, 0x0f, 0x10,
+    0x1a, 0x19, 0x1b, 0x15, 0x0e, 0x17, 0x13, 0x13, 0x0f, 0x14, 0x14, 0x0f,
+    0x20, 0x15, 0x16, 0x17, 0x10, 0x0b, 0x15, 0x0c, 0x13, 0x13, 0x11, 0x10,
+    0x19, 0x15, 0x0d, 0x0d, 0x0f, 0x17, 0x14, 0x13, 0x15, 0x14, 0x0d, 0x13,
+    0x10, 0x14, 0x08, 0x08, 0x0a, 0x0b, 0x13, 0x0d, 0x18, 0x11, 0x06, 0x0e,
+    0x12, 0x16, 0x16, 0x09, 0x13, 0x08, 0x0a, 0x0f, 0x0a, 0x10, 0x1b, 0x0c,
+    0x0d, 0x0c, 0x0d, 0x11, 0x17, 0x0a, 0x0d, 0x0e, 0x0a, 0x14, 0x11, 0x00,
+    0x4b, 0x24, 0x0e, 0x0f, 0x11, 0x11, 0x11, 0x14, 0x14, 0x08, 0x13, 0x12,
+    0x09, 0x0c, 0x11, 0x07, 0x19, 0x14, 0x12, 0x14, 0x13, 0x11, 0x17, 0x07,
+    0x16, 0x0e, 0x11, 0x12, 0x1d, 0x1c, 0x1e, 0x17, 0x10, 0x1a, 0x15, 0x14,
+    0x10, 0x17, 0x16, 0x10, 0x24, 0x18, 0x19, 0x19, 0x12, 0x0d, 0x17, 0x0e,
+    0x14, 0x15, 0x13, 0x12, 0x1c, 0x18, 0x0e, 0x0e, 0x11, 0x19, 0x17, 0x15,
+    0x18, 0x16, 0x0f, 0x15, 0x11, 0x17, 0x09, 0x09, 0x0b, 0x0c, 0x15, 0x0f,
+    0x1b, 0x13, 0x07, 0x10, 0x14, 0x19, 0x18, 0x0a, 0x15, 0x09, 0x0b, 0x11,
+    0x0c, 0x12, 0x1f, 0x0d, 0x0e, 0x0e, 0x0d, 0x13, 0x1a, 0x0b, 0x0f, 0x0f,
+    0x0b, 0x16, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x02, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x9c, 0x00, 0x06, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0xbb, 0x00, 0x35, 0x00, 0x42, 0x00, 0x43,
+    0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49,
+    0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x4f,
+    0x00, 0x55, 0x00, 0x3f, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38, 0x00, 0x39,
+    0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x40,
+    0x00, 0x41, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
+    0x00, 0x20, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
+    0x00, 0x1f, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25,
+    0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x2a,
+    0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x30,
+    0x00, 0x31, 0x00, 0x33, 0x00, 0x57, 0x00, 0x34, 0x00, 0x58, 0x00, 0x59,
+    0x00, 0x5a, 0x00, 0x5b, 0x00, 0x60, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03,
+    0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b,
+    0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11,
+    0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x02, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x5c, 0x00, 0x5e,
+    0x00, 0x5d, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x04, 0x00, 0xc8,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x00, 0x03, 0x00, 0x06, 0x00, 0x20,
+    0x00, 0x2e, 0x00, 0x30, 0x00, 0x39, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x64,
+    0x00, 0x74, 0x00, 0x7e, 0x20, 0x44, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x21, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x50,
+    0x00, 0x65, 0x00, 0x75, 0x20, 0x44, 0xff, 0xff, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0xd9, 0x00, 0x00, 0xff, 0xa1,
+    0x00, 0x00, 0xe0, 0x12, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x55, 0x00, 0x3f, 0x00, 0x40,
+    0x00, 0x41, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
+    0x00, 0x20, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
+    0x00, 0x1f, 0x00, 0x2b, 0x00, 0x29, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2d,
+    0x00, 0x2e, 0x00, 0x2f, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33,
+    0x00, 0x57, 0x00, 0x34, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b,
+    0x00, 0x60, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x5c, 0x00, 0x5e,
+    0x00, 0x5d, 0x00, 0x5f, 0x00, 0x04, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x10, 0x00, 0x03, 0x00, 0x06, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x30,
+    0x00, 0x39, 0x00, 0x47, 0x00, 0x4f, 0x00, 0x64, 0x00, 0x74, 0x00, 0x7e,
+    0x20, 0x44, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x21, 0x00, 0x2f,
+    0x00, 0x31, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x50, 0x00, 0x65, 0x00, 0x75,
+    0x20, 0x44, 0xff, 0xff, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0xff, 0xd9, 0x00, 0x00, 0xff, 0xa1, 0x00, 0x00, 0xe0, 0x12,
+    0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x35, 0x00, 0x55, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x50,
+    0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x20, 0x00, 0x1a,
+    0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x2b,
+    0x00, 0x29, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f,
+    0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x33, 0x00, 0x57, 0x00, 0x34,
+    0x00, 0x58, 0x00, 0x59, 0x00, 0x5a, 0x00, 0x5b, 0x00, 0x60, 0x00, 0x05,
+    0x00, 0x04, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x16, 0x00, 0x17,
+    0x00, 0x18, 0x00, 0x19, 0x00, 0x5c, 0x00, 0x5e, 0x00, 0x5d, 0x00, 0x5f,
+    0xb8, 0x00, 0x00, 0x2c, 0x4b, 0xb8, 0x00, 0x09, 0x50, 0x58, 0xb1, 0x01,
+    0x01, 0x8e, 0x59, 0xb8, 0x01, 0xff, 0x85, 0xb8, 0x00, 0x44, 0x1d, 0xb9,
+    0x00, 0x09, 0x00, 0x03, 0x5f, 0x5e, 0x2d, 0xb8, 0x00, 0x01, 0x2c, 0x20,
+    0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x02, 0x2c,
+    0xb8, 0x00, 0x01, 0x2a, 0x21, 0x2d, 0xb8, 0x00, 0x03, 0x2c, 0x20, 0x46,
+    0xb0, 0x03, 0x25, 0x46, 0x52, 0x58, 0x23, 0x59, 0x20, 0x8a, 0x20, 0x8a,
+    0x49, 0x64, 0x8a, 0x20, 0x46, 0x20, 0x68, 0x61, 0x64, 0xb0, 0x04, 0x25,
+    0x46, 0x20, 0x68, 0x61, 0x64, 0x52, 0x58, 0x23, 0x65, 0x8a, 0x59, 0x2f,
+    0x20, 0xb0, 0x00, 0x53, 0x58, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21,
+    0xb0, 0x40, 0x59, 0x1b, 0x69, 0x20, 0xb0, 0x00, 0x54, 0x58, 0x21, 0xb0,
+    0x40, 0x65, 0x59, 0x59, 0x3a, 0x2d, 0xb8, 0x00, 0x04, 0x2c, 0x20, 0x46,
+    0xb0, 0x04, 0x25, 0x46, 0x52, 0x58, 0x23, 0x8a, 0x59, 0x20, 0x46, 0x20,
+    0x6a, 0x61, 0x64, 0xb0, 0x04, 0x25, 0x46, 0x20, 0x6a, 0x61, 0x64, 0x52,
+    0x58, 0x23, 0x8a, 0x59, 0x2f, 0xfd, 0x2d, 0xb8, 0x00, 0x05, 0x2c, 0x4b,
+    0x20, 0xb0, 0x03, 0x26, 0x50, 0x58, 0x51, 0x58, 0xb0, 0x80, 0x44, 0x1b,
+    0xb0, 0x40, 0x44, 0x59, 0x1b, 0x21, 0x21, 0x20, 0x45, 0xb0, 0xc0, 0x50,
+    0x58, 0xb0, 0xc0, 0x44, 0x1b, 0x21, 0x59, 0x59, 0x2d, 0xb8, 0x00, 0x06,
+    0x2c, 0x20, 0x20, 0x45, 0x69, 0x44, 0xb0, 0x01, 0x60, 0x20, 0x20, 0x45,
+    0x7d, 0x69, 0x18, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb8, 0x00, 0x07, 0x2c,
+    0xb8, 0x00, 0x06, 0x2a, 0x2d, 0xb8, 0x00, 0x08, 0x2c, 0x4b, 0x20, 0xb0,
+    0x03, 0x26, 0x53, 0x58, 0xb0, 0x40, 0x1b, 0xb0, 0x00, 0x59, 0x8a, 0x8a,
+    0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb0, 0x80, 0x8a, 0x8a,
+    0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21,
+    0xb8, 0x00, 0xc0, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb0, 0x03,
+    0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01, 0x00, 0x8a, 0x8a, 0x1b, 0x8a,
+    0x23, 0x59, 0x20, 0xb0, 0x03, 0x26, 0x53, 0x58, 0x23, 0x21, 0xb8, 0x01,
+    0x40, 0x8a, 0x8a, 0x1b, 0x8a, 0x23, 0x59, 0x20, 0xb8, 0x00, 0x03, 0x26,
+    0x53, 0x58, 0xb0, 0x03, 0x25, 0x45, 0xb8, 0x01, 0x80, 0x50, 0x58, 0x23,
+    0x21, 0xb8, 0x01, 0x80, 0x23, 0x21, 0x1b, 0xb0, 0x03, 0x25, 0x45, 0x23,
+    0x21, 0x23, 0x21, 0x59, 0x1b, 0x21, 0x59, 0x44, 0x2d, 0xb8, 0x00, 0x09,
+    0x2c, 0x4b, 0x53, 0x58, 0x45, 0x44, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0x00,
+    0xb8, 0x00, 0x00, 0x2b, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf5,
+    0x00, 0x02, 0x00, 0xbc, 0x00, 0xe2, 0x00, 0x1b, 0x00, 0x17, 0xba, 0x00,
+    0x10, 0x00, 0x0e, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x10, 0x10, 0xb8, 0x00,
+    0x1d, 0xdc, 0x00, 0xb8, 0x00, 0x17, 0x2f, 0x30, 0x31, 0x27, 0x26, 0x3e,
+    0x01, 0x32, 0x17, 0x1e, 0x03, 0x17, 0x3e, 0x01, 0x37, 0x35, 0x37, 0x15,
+    0x0e, 0x01, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x2e, 0x03, 0x05, 0x06, 0x02,
+    0x0a, 0x10, 0x08, 0x0f, 0x15, 0x12, 0x12, 0x0d, 0x09, 0x1c, 0x01, 0x28,
+    0x01, 0x11, 0x08, 0x06, 0x09, 0x09, 0x1c, 0x19, 0x1e, 0x16, 0x15, 0xc0,
+    0x09, 0x10, 0x09, 0x07, 0x12, 0x2a, 0x2d, 0x2c, 0x13, 0x2b, 0x53, 0x2c,
+    0x02, 0x03, 0x03, 0x21, 0x3c, 0x21, 0x16, 0x29, 0x15, 0x0b, 0x08, 0x30,
+    0x39, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xff, 0x00, 0xd0,
+    0x00, 0xd3, 0x00, 0x2f, 0x00, 0x00, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x1e,
+    0x01, 0x17, 0x16, 0x06, 0x15, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x27,
+    0x32, 0x16, 0x33, 0x22, 0x07, 0x17, 0x16, 0x06, 0x1e, 0x01, 0x17, 0x16,
+    0x06, 0x27, 0x2e, 0x01, 0x27, 0x0e, 0x03, 0x27, 0x2e, 0x01, 0x34, 0x36,
+    0x27, 0x2e, 0x01, 0x06, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x02, 0x0a, 0x02,
+    0x01, 0x03, 0x20, 0x1e, 0x0f, 0x06, 0x0d, 0x07, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x0e, 0x01, 0x01, 0x04, 0x0a, 0x0b, 0x08, 0x16, 0x10, 0x0e,
+    0x0e, 0x03, 0x0a, 0x19, 0x1b, 0x1c, 0x0d, 0x0b, 0x07, 0x03, 0x01, 0x02,
+    0x0a, 0xbc, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x17, 0x2e, 0x17, 0x0b, 0x19,
+    0x0c, 0x1c, 0x46, 0x26, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x12, 0x0f,
+    0x21, 0x21, 0x1d, 0x0c, 0x11, 0x14, 0x0a, 0x0f, 0x23, 0x14, 0x14, 0x27,
+    0x1b, 0x0a, 0x09, 0x07, 0x16, 0x18, 0x19, 0x0a, 0x17, 0x2e, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x05, 0x00, 0x0d, 0x00, 0xb9, 0x02, 0x67, 0x00, 0x29,
+    0x00, 0x3a, 0x00, 0xf0, 0xba, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x2b,
+    0x41, 0x05, 0x00, 0xda, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x02,
+    0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+    0x29, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+    0x59, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+    0xb9, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x0d, 0x5d, 0xba, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x05, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x38, 0x2f,
+    0x41, 0x05, 0x00, 0xda, 0x00, 0x38, 0x00, 0xea, 0x00, 0x38, 0x00, 0x02,
+    0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x38, 0x00, 0x19, 0x00, 0x38, 0x00,
+    0x29, 0x00, 0x38, 0x00, 0x39, 0x00, 0x38, 0x00, 0x49, 0x00, 0x38, 0x00,
+    0x59, 0x00, 0x38, 0x00, 0x69, 0x00, 0x38, 0x00, 0x79, 0x00, 0x38, 0x00,
+    0x89, 0x00, 0x38, 0x00, 0x99, 0x00, 0x38, 0x00, 0xa9, 0x00, 0x38, 0x00,
+    0xb9, 0x00, 0x38, 0x00, 0xc9, 0x00, 0x38, 0x00, 0x0d, 0x5d, 0xb8, 0x00,
+    0x0b, 0xdc, 0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00,
+    0x0b, 0x10, 0xb8, 0x00, 0x0e, 0xd0, 0xb8, 0x00, 0x0e, 0x2f, 0xb8, 0x00,
+    0x38, 0x10, 0xb8, 0x00, 0x24, 0xd0, 0xb8, 0x00, 0x24, 0x2f, 0xb8, 0x00,
+    0x38, 0x10, 0xb8, 0x00, 0x27, 0xd0, 0xb8, 0x00, 0x38, 0x10, 0xb8, 0x00,
+    0x2a, 0xd0, 0xb8, 0x00, 0x2a, 0x2f, 0xb8, 0x00, 0x38, 0x10, 0xb8, 0x00,
+    0x2d, 0xd0, 0xb8, 0x00, 0x2d, 0x2f, 0xb8, 0x00, 0x0b, 0x10, 0xb8, 0x00,
+    0x3c, 0xdc, 0x30, 0x31, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x17,
+    0x16, 0x14, 0x17, 0x16, 0x14, 0x15, 0x23, 0x14, 0x16, 0x15, 0x27, 0x35,
+    0x0e, 0x02, 0x26, 0x27, 0x2e, 0x02, 0x36, 0x37, 0x3e, 0x01, 0x17, 0x1e,
+    0x01, 0x17, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x13, 0x34, 0x26, 0x35, 0x2e,
+    0x01, 0x27, 0x0e, 0x02, 0x16, 0x37, 0x3e, 0x01, 0x37, 0x32, 0x36, 0x77,
+    0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x02, 0x0f, 0x03, 0x03, 0x01, 0x02, 0x01,
+    0x01, 0x28, 0x12, 0x15, 0x12, 0x15, 0x11, 0x16, 0x15, 0x02, 0x10, 0x0f,
+    0x12, 0x27, 0x18, 0x08, 0x0c, 0x06, 0x01, 0x01, 0x02, 0x03, 0x0f, 0x17,
+    0x01, 0x03, 0x1b, 0x21, 0x0c, 0x14, 0x03, 0x12, 0x1a, 0x0e, 0x17, 0x0d,
+    0x01, 0x02, 0x02, 0x50, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x3c, 0x76, 0x3c,
+    0x41, 0x80, 0x41, 0x11, 0x21, 0x10, 0x02, 0x05, 0x02, 0x03, 0x03, 0x05,
+    0x08, 0x03, 0x04, 0x07, 0x09, 0x31, 0x3b, 0x36, 0x0d, 0x0f, 0x10, 0x0e,
+    0x05, 0x0a, 0x05, 0x25, 0x4a, 0x25, 0x3c, 0x77, 0xfe, 0x32, 0x09, 0x12,
+    0x0a, 0x1f, 0x31, 0x05, 0x0a, 0x2f, 0x30, 0x23, 0x03, 0x02, 0x09, 0x03,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x0a, 0x00, 0xc5,
+    0x00, 0xe4, 0x00, 0x27, 0x00, 0x00, 0x37, 0x0e, 0x01, 0x22, 0x26, 0x27,
+    0x35, 0x2e, 0x01, 0x27, 0x26, 0x0e, 0x01, 0x16, 0x17, 0x1e, 0x01, 0x3e,
+    0x01, 0x37, 0x36, 0x1e, 0x01, 0x06, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37,
+    0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x1e, 0x01, 0xb6, 0x02,
+    0x0a, 0x0d, 0x0c, 0x03, 0x0b, 0x18, 0x0c, 0x15, 0x1a, 0x0c, 0x04, 0x09,
+    0x0b, 0x1e, 0x20, 0x21, 0x0e, 0x09, 0x0d, 0x06, 0x03, 0x07, 0x23, 0x45,
+    0x36, 0x21, 0x02, 0x01, 0x0b, 0x09, 0x08, 0x0c, 0x0b, 0x0f, 0x2b, 0x28,
+    0x1f, 0xb1, 0x09, 0x0a, 0x09, 0x08, 0x01, 0x04, 0x08, 0x02, 0x02, 0x18,
+    0x24, 0x28, 0x0e, 0x10, 0x0c, 0x01, 0x0a, 0x07, 0x02, 0x06, 0x0b, 0x0e,
+    0x06, 0x11, 0x06, 0x1a, 0x39, 0x2d, 0x0e, 0x1e, 0x09, 0x08, 0x13, 0x02,
+    0x04, 0x04, 0x08, 0x16, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x06, 0x00, 0xeb,
+    0x02, 0x6c, 0x00, 0x41, 0x00, 0x62, 0xba, 0x00, 0x37, 0x00, 0x39, 0x00,
+    0x03, 0x2b, 0xba, 0x00, 0x00, 0x00, 0x39, 0x00, 0x37, 0x11, 0x12, 0x39,
+    0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x05, 0xdc, 0xb8, 0x00, 0x37, 0x10,
+    0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x37, 0x10, 0xb8, 0x00, 0x0b, 0xd0,
+    0xb8, 0x00, 0x0b, 0x2f, 0xba, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x05, 0x11,
+    0x12, 0x39, 0xb8, 0x00, 0x39, 0x10, 0xb8, 0x00, 0x15, 0xdc, 0xb8, 0x00,
+    0x37, 0x10, 0xb8, 0x00, 0x34, 0xd0, 0xb8, 0x00, 0x34, 0x2f, 0xb8, 0x00,
+    0x39, 0x10, 0xb8, 0x00, 0x3c, 0xd0, 0xb8, 0x00, 0x3c, 0x2f, 0xb8, 0x00,
+    0x39, 0x10, 0xb8, 0x00, 0x3f, 0xd0, 0x30, 0x31, 0x13, 0x3e, 0x02, 0x16,
+    0x17, 0x0e, 0x01, 0x07, 0x06, 0x16, 0x17, 0x34, 0x37, 0x3e, 0x01, 0x37,
+    0x36, 0x1e, 0x02, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x06, 0x07, 0x06, 0x2e,
+    0x01, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x03, 0x27, 0x2e, 0x03, 0x07,
+    0x0e, 0x01, 0x07, 0x06, 0x0f, 0x01, 0x14, 0x07, 0x15, 0x23, 0x07, 0x26,
+    0x36, 0x37, 0x34, 0x26, 0x37, 0x3e, 0x01, 0x1c, 0x01, 0x0b, 0x0e, 0x0c,
+    0x02, 0x02, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0a, 0x1b, 0x11, 0x19,
+    0x2d, 0x23, 0x14, 0x10, 0x18, 0x1b, 0x0b, 0x20, 0x29, 0x0a, 0x0c, 0x02,
+    0x08, 0x0a, 0x11, 0x1d, 0x0e, 0x09, 0x16, 0x11, 0x0a, 0x02, 0x02, 0x0d,
+    0x13, 0x17, 0x0a, 0x0c, 0x12, 0x08, 0x10, 0x0b, 0x06, 0x03, 0x07, 0x21,
+    0x03, 0x02, 0x04, 0x04, 0x01, 0x01, 0x0c, 0x02, 0x55, 0x0a, 0x0c, 0x01,
+    0x0a, 0x0b, 0x5b, 0xb2, 0x5b, 0x13, 0x24, 0x12, 0x01, 0x02, 0x0e, 0x24,
+    0x05, 0x09, 0x0d, 0x21, 0x2e, 0x17, 0x0e, 0x1b, 0x16, 0x12, 0x06, 0x11,
+    0x06, 0x01, 0x0b, 0x0e, 0x0e, 0x02, 0x02, 0x09, 0x07, 0x05, 0x0e, 0x11,
+    0x16, 0x0c, 0x09, 0x16, 0x12, 0x08, 0x06, 0x06, 0x18, 0x0b, 0x18, 0x1f,
+    0x15, 0x1f, 0x1e, 0x01, 0x02, 0x10, 0x21, 0x11, 0x2a, 0x51, 0x2a, 0x5b,
+    0xb2, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfb, 0xff, 0xfd, 0x00, 0xf0,
+    0x00, 0xee, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x00, 0x37, 0x0e, 0x01, 0x22,
+    0x26, 0x07, 0x06, 0x2b, 0x01, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x32,
+    0x37, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x17, 0x0e, 0x03, 0x27,
+    0x2e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x02, 0x06,
+    0x27, 0x26, 0x0e, 0x02, 0x07, 0x3e, 0x01, 0x3a, 0x01, 0x37, 0x2e, 0x03,
+    0xbc, 0x0b, 0x20, 0x23, 0x24, 0x10, 0x08, 0x08, 0x03, 0x07, 0x26, 0x1d,
+    0x14, 0x23, 0x11, 0x02, 0x03, 0x04, 0x07, 0x03, 0x06, 0x02, 0x08, 0x0d,
+    0x07, 0x02, 0x2a, 0x35, 0x35, 0x0d, 0x1c, 0x23, 0x11, 0x02, 0x05, 0x03,
+    0x16, 0x1f, 0x25, 0x12, 0x11, 0x19, 0x0e, 0x07, 0x10, 0x09, 0x01, 0x63,
+    0x0f, 0x16, 0x0f, 0x09, 0x02, 0x0e, 0x1e, 0x1e, 0x1f, 0x0e, 0x04, 0x0e,
+    0x10, 0x10, 0x7a, 0x09, 0x05, 0x01, 0x03, 0x06, 0x1a, 0x23, 0x0b, 0x08,
+    0x03, 0x09, 0x05, 0x02, 0x01, 0x01, 0x05, 0x09, 0x05, 0x11, 0x1b, 0x10,
+    0x03, 0x07, 0x0f, 0x22, 0x28, 0x30, 0x1f, 0x16, 0x1c, 0x0e, 0x02, 0x03,
+    0x02, 0x1a, 0x0b, 0x05, 0x13, 0x15, 0x15, 0x42, 0x07, 0x05, 0x12, 0x19,
+    0x0d, 0x05, 0x02, 0x03, 0x06, 0x0d, 0x0c, 0x0a, 0x00, 0x01, 0xff, 0xc1,
+    0xff, 0xdd, 0x00, 0xa2, 0x02, 0x59, 0x00, 0x3a, 0x00, 0x2e, 0xba, 0x00,
+    0x29, 0x00, 0x38, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x38, 0x10, 0xb8, 0x00,
+    0x08, 0xd0, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x29, 0x10, 0xb8, 0x00,
+    0x1b, 0xd0, 0xb8, 0x00, 0x1b, 0x2f, 0xb8, 0x00, 0x29, 0x10, 0xb8, 0x00,
+    0x1e, 0xd0, 0xb8, 0x00, 0x1e, 0x2f, 0x30, 0x31, 0x03, 0x2e, 0x01, 0x34,
+    0x36, 0x37, 0x1e, 0x01, 0x17, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x32, 0x16,
+    0x17, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x26, 0x06, 0x23, 0x22, 0x26, 0x07,
+    0x0e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x36, 0x1e, 0x01, 0x06, 0x07, 0x06,
+    0x07, 0x17, 0x16, 0x14, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x01, 0x26, 0x27,
+    0x2e, 0x02, 0x34, 0x2f, 0x02, 0x2d, 0x09, 0x09, 0x09, 0x09, 0x10, 0x18,
+    0x0b, 0x02, 0x02, 0x08, 0x04, 0x2b, 0x33, 0x2c, 0x05, 0x01, 0x08, 0x0c,
+    0x0e, 0x04, 0x09, 0x15, 0x08, 0x0c, 0x0c, 0x0a, 0x04, 0x02, 0x01, 0x0b,
+    0x19, 0x10, 0x09, 0x0d, 0x06, 0x03, 0x07, 0x22, 0x23, 0x03, 0x01, 0x04,
+    0x09, 0x0b, 0x01, 0x09, 0x0d, 0x0e, 0x04, 0x0b, 0x0a, 0x04, 0x01, 0x03,
+    0x35, 0x01, 0x5f, 0x03, 0x0b, 0x0d, 0x0b, 0x02, 0x01, 0x02, 0x02, 0x32,
+    0x64, 0x23, 0x0f, 0x0f, 0x0f, 0x10, 0x0a, 0x0c, 0x04, 0x05, 0x07, 0x05,
+    0x01, 0x01, 0x05, 0x2b, 0x55, 0x2b, 0x02, 0x06, 0x08, 0x02, 0x06, 0x0b,
+    0x0e, 0x06, 0x0f, 0x02, 0x45, 0x23, 0x4a, 0x49, 0x49, 0x22, 0x0b, 0x0c,
+    0x03, 0x08, 0x09, 0x23, 0x4a, 0x4b, 0x4b, 0x24, 0x47, 0x03, 0x00, 0x00,
+    0x00, 0x02, 0xff, 0xfd, 0xff, 0x5f, 0x00, 0xfc, 0x00, 0xde, 0x00, 0x2c,
+    0x00, 0x3d, 0x00, 0x00, 0x3f, 0x01, 0x1e, 0x03, 0x07, 0x14, 0x06, 0x15,
+    0x1e, 0x02, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x2e, 0x01, 0x36, 0x37,
+    0x3e, 0x01, 0x37, 0x3e, 0x01, 0x2e, 0x01, 0x27, 0x0e, 0x01, 0x27, 0x2e,
+    0x02, 0x3e, 0x02, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x15, 0x2e, 0x01, 0x35,
+    0x06, 0x27, 0x26, 0x27, 0x22, 0x0e, 0x02, 0x17, 0x16, 0x36, 0x3f, 0x01,
+    0xa5, 0x09, 0x0f, 0x12, 0x08, 0x01, 0x01, 0x01, 0x0d, 0x16, 0x03, 0x15,
+    0x1f, 0x0b, 0x1a, 0x0d, 0x0a, 0x0c, 0x02, 0x08, 0x0a, 0x11, 0x1b, 0x0b,
+    0x09, 0x04, 0x05, 0x0b, 0x07, 0x14, 0x36, 0x1a, 0x28, 0x2a, 0x0a, 0x11,
+    0x26, 0x34, 0x1e, 0x05, 0x0b, 0x05, 0x0a, 0x05, 0x0b, 0x0c, 0x09, 0x01,
+    0x04, 0x0e, 0x25, 0x1d, 0x09, 0x0f, 0x22, 0x3c, 0x17, 0x06, 0xb7, 0x05,
+    0x02, 0x14, 0x19, 0x1d, 0x0b, 0x02, 0x03, 0x02, 0x20, 0x45, 0x40, 0x3a,
+    0x15, 0x07, 0x01, 0x02, 0x01, 0x0b, 0x0e, 0x0e, 0x02, 0x03, 0x03, 0x0e,
+    0x0b, 0x23, 0x28, 0x2b, 0x14, 0x17, 0x1b, 0x04, 0x06, 0x26, 0x31, 0x36,
+    0x2c, 0x1c, 0x01, 0x03, 0x07, 0x04, 0x15, 0x4a, 0x0c, 0x18, 0x0c, 0x02,
+    0x0c, 0x04, 0x08, 0x1b, 0x25, 0x28, 0x0d, 0x1d, 0x13, 0x20, 0x09, 0x00,
+    0x00, 0x01, 0xff, 0xf0, 0xff, 0xfd, 0x00, 0xd0, 0x02, 0x53, 0x00, 0x3b,
+    0x00, 0x0a, 0xba, 0x00, 0x0b, 0x00, 0x37, 0x00, 0x03, 0x2b, 0x30, 0x31,
+    0x03, 0x26, 0x3e, 0x01, 0x16, 0x17, 0x1e, 0x02, 0x06, 0x1d, 0x01, 0x3e,
+    0x01, 0x37, 0x36, 0x16, 0x17, 0x1e, 0x02, 0x06, 0x15, 0x0e, 0x01, 0x22,
+    0x26, 0x27, 0x3e, 0x01, 0x27, 0x34, 0x2e, 0x02, 0x23, 0x22, 0x26, 0x07,
+    0x0e, 0x03, 0x07, 0x2a, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x34, 0x36, 0x35,
+    0x2e, 0x01, 0x27, 0x26, 0x36, 0x2e, 0x01, 0x0c, 0x04, 0x07, 0x0e, 0x0f,
+    0x05, 0x11, 0x0e, 0x03, 0x02, 0x0a, 0x1c, 0x15, 0x15, 0x24, 0x0e, 0x0a,
+    0x09, 0x02, 0x03, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x01, 0x02, 0x02,
+    0x03, 0x04, 0x03, 0x07, 0x0e, 0x07, 0x10, 0x13, 0x0c, 0x05, 0x02, 0x05,
+    0x0c, 0x05, 0x05, 0x09, 0x05, 0x01, 0x08, 0x03, 0x02, 0x01, 0x03, 0x02,
+    0x0d, 0x02, 0x35, 0x0a, 0x0f, 0x05, 0x05, 0x09, 0x27, 0x68, 0x6e, 0x69,
+    0x27, 0x26, 0x1c, 0x27, 0x02, 0x02, 0x02, 0x11, 0x0c, 0x31, 0x37, 0x34,
+    0x0e, 0x09, 0x0a, 0x09, 0x08, 0x18, 0x31, 0x18, 0x03, 0x15, 0x17, 0x12,
+    0x02, 0x03, 0x07, 0x2a, 0x34, 0x32, 0x0e, 0x01, 0x01, 0x02, 0x02, 0x01,
+    0x02, 0x02, 0x1a, 0x38, 0x1b, 0x28, 0x7a, 0x81, 0x77, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x1b, 0x00, 0x05, 0x00, 0x55, 0x01, 0x44, 0x00, 0x10,
+    0x00, 0x1f, 0x00, 0x17, 0x00, 0xb8, 0x00, 0x11, 0x2f, 0xb8, 0x00, 0x1b,
+    0x2f, 0xb8, 0x00, 0x1e, 0x2f, 0xb8, 0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x0d,
+    0x2f, 0x30, 0x31, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x16,
+    0x07, 0x14, 0x06, 0x15, 0x27, 0x2e, 0x01, 0x37, 0x1e, 0x01, 0x0e, 0x01,
+    0x27, 0x23, 0x27, 0x36, 0x34, 0x35, 0x33, 0x32, 0x17, 0x32, 0x1b, 0x01,
+    0x0b, 0x0e, 0x0c, 0x02, 0x06, 0x05, 0x04, 0x03, 0x01, 0x01, 0x27, 0x06,
+    0x05, 0x15, 0x09, 0x06, 0x04, 0x0f, 0x0a, 0x01, 0x08, 0x01, 0x01, 0x04,
+    0x04, 0x05, 0xae, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x26, 0x4d, 0x26, 0x07,
+    0x07, 0x01, 0x02, 0x01, 0x04, 0x2a, 0x51, 0xbb, 0x05, 0x0e, 0x0e, 0x07,
+    0x03, 0x02, 0x0a, 0x14, 0x0a, 0x02, 0x00, 0x00, 0x00, 0x02, 0xff, 0xcd,
+    0xff, 0x5f, 0x00, 0x79, 0x01, 0x67, 0x00, 0x24, 0x00, 0x30, 0x00, 0x07,
+    0x00, 0xb8, 0x00, 0x2a, 0x2f, 0x30, 0x31, 0x37, 0x3e, 0x02, 0x16, 0x17,
+    0x1c, 0x01, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x07, 0x0e, 0x02, 0x26, 0x27,
+    0x26, 0x34, 0x3e, 0x01, 0x17, 0x1e, 0x01, 0x3e, 0x01, 0x37, 0x3e, 0x01,
+    0x37, 0x36, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x34, 0x36, 0x37,
+    0x33, 0x1e, 0x01, 0x14, 0x06, 0x07, 0x2c, 0x01, 0x0b, 0x0e, 0x0c, 0x02,
+    0x02, 0x04, 0x04, 0x0e, 0x0d, 0x12, 0x06, 0x24, 0x2d, 0x2e, 0x10, 0x05,
+    0x08, 0x0e, 0x08, 0x06, 0x13, 0x15, 0x13, 0x05, 0x0e, 0x0a, 0x02, 0x06,
+    0x10, 0x0a, 0x02, 0x09, 0x0e, 0x09, 0x09, 0x09, 0x09, 0x05, 0x0b, 0x0a,
+    0x0b, 0x0a, 0xcb, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x0a, 0x04, 0x05, 0x0e,
+    0x13, 0x3f, 0x81, 0x40, 0x15, 0x1b, 0x0a, 0x06, 0x0c, 0x07, 0x0f, 0x0b,
+    0x02, 0x04, 0x04, 0x03, 0x01, 0x05, 0x04, 0x0a, 0x24, 0x0e, 0x30, 0x62,
+    0x2f, 0x0e, 0x1f, 0x82, 0x03, 0x0b, 0x0d, 0x0b, 0x02, 0x01, 0x0c, 0x0e,
+    0x0c, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf4, 0xff, 0xe8, 0x00, 0xc7,
+    0x02, 0x42, 0x00, 0x2f, 0x00, 0x7c, 0xba, 0x00, 0x2b, 0x00, 0x20, 0x00,
+    0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x2b, 0x00, 0x16, 0x00, 0x2b,
+    0x00, 0x26, 0x00, 0x2b, 0x00, 0x36, 0x00, 0x2b, 0x00, 0x46, 0x00, 0x2b,
+    0x00, 0x56, 0x00, 0x2b, 0x00, 0x66, 0x00, 0x2b, 0x00, 0x76, 0x00, 0x2b,
+    0x00, 0x86, 0x00, 0x2b, 0x00, 0x96, 0x00, 0x2b, 0x00, 0xa6, 0x00, 0x2b,
+    0x00, 0xb6, 0x00, 0x2b, 0x00, 0xc6, 0x00, 0x2b, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x2b, 0x00, 0xe5, 0x00, 0x2b, 0x00, 0x02, 0x5d,
+    0xb8, 0x00, 0x2b, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f,
+    0xb8, 0x00, 0x2b, 0x10, 0xb8, 0x00, 0x1b, 0xd0, 0xb8, 0x00, 0x1b, 0x2f,
+    0xb8, 0x00, 0x2b, 0x10, 0xb8, 0x00, 0x23, 0xdc, 0xb8, 0x00, 0x2b, 0x10,
+    0xb8, 0x00, 0x28, 0xd0, 0xb8, 0x00, 0x28, 0x2f, 0x30, 0x31, 0x13, 0x3e,
+    0x01, 0x1e, 0x01, 0x07, 0x0e, 0x03, 0x07, 0x06, 0x1e, 0x02, 0x17, 0x16,
+    0x0e, 0x01, 0x26, 0x27, 0x2e, 0x03, 0x27, 0x06, 0x15, 0x0e, 0x01, 0x22,
+    0x26, 0x27, 0x36, 0x12, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x0e, 0x01, 0x07,
+    0x3e, 0x03, 0x77, 0x03, 0x0f, 0x0d, 0x09, 0x01, 0x06, 0x1c, 0x1e, 0x1a,
+    0x06, 0x02, 0x22, 0x2f, 0x2d, 0x09, 0x04, 0x04, 0x0c, 0x10, 0x06, 0x08,
+    0x23, 0x27, 0x25, 0x0b, 0x03, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x0a,
+    0x01, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x01, 0x04, 0x02, 0x09, 0x1a, 0x19,
+    0x15, 0x01, 0x66, 0x0a, 0x08, 0x04, 0x0e, 0x0a, 0x18, 0x20, 0x1a, 0x1a,
+    0x11, 0x06, 0x1b, 0x21, 0x22, 0x0d, 0x09, 0x0f, 0x08, 0x02, 0x08, 0x0c,
+    0x18, 0x19, 0x1b, 0x0f, 0x62, 0x62, 0x09, 0x0a, 0x09, 0x08, 0x8d, 0x01,
+    0x18, 0x8d, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x4c, 0x96, 0x4c, 0x0e, 0x17,
+    0x17, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0xff, 0xe2, 0x00, 0x43,
+    0x02, 0x0e, 0x00, 0x17, 0x00, 0x68, 0xba, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x03, 0x2b, 0x41, 0x05, 0x00, 0xda, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00,
+    0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00,
+    0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x49, 0x00,
+    0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x79, 0x00,
+    0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xa9, 0x00,
+    0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x0d, 0x5d,
+    0xb8, 0x00, 0x0c, 0x10, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x05, 0x2f,
+    0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x11, 0x2f,
+    0x30, 0x31, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x14, 0x16, 0x14,
+    0x16, 0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x34, 0x26, 0x34,
+    0x26, 0x16, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0xf7, 0x0a,
+    0x0c, 0x01, 0x0a, 0x0b, 0x3c, 0x5a, 0x4a, 0x43, 0x4a, 0x5a, 0x3d, 0x09,
+    0x0a, 0x09, 0x08, 0x3d, 0x5a, 0x4a, 0x42, 0x4a, 0x5a, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x09, 0xff, 0xec, 0x01, 0x2a, 0x00, 0xfb, 0x00, 0x3d,
+    0x00, 0x00, 0x37, 0x32, 0x36, 0x33, 0x1c, 0x01, 0x17, 0x34, 0x36, 0x35,
+    0x3e, 0x03, 0x17, 0x1e, 0x01, 0x17, 0x36, 0x3f, 0x01, 0x1e, 0x03, 0x17,
+    0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x03, 0x27, 0x0e, 0x03, 0x15, 0x07,
+    0x35, 0x2e, 0x01, 0x27, 0x0e, 0x03, 0x15, 0x2a, 0x01, 0x0f, 0x01, 0x35,
+    0x2e, 0x01, 0x35, 0x33, 0x32, 0x36, 0x13, 0x08, 0x0f, 0x07, 0x01, 0x01,
+    0x04, 0x0d, 0x12, 0x17, 0x0f, 0x0d, 0x11, 0x06, 0x0d, 0x16, 0x19, 0x18,
+    0x1d, 0x10, 0x07, 0x02, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x07, 0x0c,
+    0x12, 0x0b, 0x0b, 0x0b, 0x05, 0x01, 0x28, 0x05, 0x0c, 0x12, 0x0c, 0x0d,
+    0x06, 0x02, 0x05, 0x0b, 0x06, 0x12, 0x0b, 0x0d, 0x04, 0x02, 0x02, 0xd8,
+    0x01, 0x08, 0x10, 0x08, 0x02, 0x01, 0x02, 0x0b, 0x19, 0x13, 0x06, 0x07,
+    0x06, 0x28, 0x1b, 0x1f, 0x13, 0x02, 0x11, 0x36, 0x3e, 0x40, 0x1b, 0x09,
+    0x0a, 0x09, 0x08, 0x0d, 0x38, 0x3b, 0x31, 0x07, 0x0b, 0x30, 0x37, 0x33,
+    0x0e, 0x08, 0x06, 0x33, 0x6a, 0x31, 0x04, 0x38, 0x45, 0x41, 0x0c, 0x01,
+    0x06, 0x05, 0x37, 0x69, 0x39, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe,
+    0xff, 0xd7, 0x00, 0xf4, 0x00, 0xed, 0x00, 0x31, 0x00, 0x07, 0x00, 0xb8,
+    0x00, 0x1b, 0x2f, 0x30, 0x31, 0x37, 0x2e, 0x01, 0x27, 0x26, 0x3f, 0x02,
+    0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x1e, 0x02,
+    0x06, 0x17, 0x16, 0x06, 0x0f, 0x01, 0x2e, 0x01, 0x27, 0x26, 0x36, 0x34,
+    0x26, 0x27, 0x26, 0x0e, 0x02, 0x07, 0x06, 0x14, 0x07, 0x15, 0x23, 0x0f,
+    0x01, 0x35, 0x26, 0x28, 0x03, 0x0d, 0x0e, 0x0c, 0x04, 0x02, 0x21, 0x09,
+    0x0d, 0x05, 0x08, 0x14, 0x0c, 0x09, 0x16, 0x19, 0x18, 0x0b, 0x18, 0x12,
+    0x03, 0x03, 0x04, 0x03, 0x02, 0x08, 0x01, 0x08, 0x0e, 0x08, 0x05, 0x02,
+    0x08, 0x0d, 0x09, 0x18, 0x17, 0x13, 0x04, 0x10, 0x02, 0x01, 0x21, 0x06,
+    0x05, 0x48, 0x1e, 0x3a, 0x19, 0x09, 0x12, 0x04, 0x02, 0x0e, 0x20, 0x11,
+    0x0e, 0x1b, 0x0c, 0x08, 0x0e, 0x07, 0x03, 0x09, 0x16, 0x3b, 0x40, 0x41,
+    0x1d, 0x06, 0x0e, 0x06, 0x01, 0x04, 0x07, 0x03, 0x18, 0x39, 0x39, 0x35,
+    0x13, 0x0e, 0x04, 0x14, 0x1b, 0x08, 0x1a, 0x39, 0x1e, 0x09, 0x03, 0x01,
+    0x01, 0x1f, 0x00, 0x00, 0x00, 0x02, 0xff, 0xf8, 0x00, 0x06, 0x00, 0xcb,
+    0x00, 0xd9, 0x00, 0x12, 0x00, 0x27, 0x00, 0x00, 0x37, 0x16, 0x33, 0x1e,
+    0x02, 0x06, 0x07, 0x0e, 0x02, 0x26, 0x27, 0x2e, 0x02, 0x3e, 0x02, 0x17,
+    0x06, 0x26, 0x27, 0x0e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x37, 0x3e, 0x01,
+    0x2e, 0x01, 0x27, 0x26, 0x27, 0x23, 0x22, 0x7a, 0x01, 0x01, 0x1a, 0x25,
+    0x10, 0x07, 0x12, 0x09, 0x1b, 0x1d, 0x1d, 0x0b, 0x23, 0x25, 0x09, 0x10,
+    0x22, 0x32, 0x0e, 0x0a, 0x0e, 0x03, 0x10, 0x15, 0x09, 0x05, 0x0b, 0x10,
+    0x2a, 0x12, 0x15, 0x12, 0x02, 0x10, 0x0d, 0x02, 0x06, 0x06, 0x06, 0xcb,
+    0x01, 0x02, 0x27, 0x36, 0x3a, 0x15, 0x0a, 0x09, 0x03, 0x02, 0x01, 0x02,
+    0x26, 0x35, 0x39, 0x2a, 0x10, 0x39, 0x05, 0x07, 0x07, 0x04, 0x1d, 0x23,
+    0x21, 0x07, 0x0b, 0x04, 0x02, 0x03, 0x1c, 0x24, 0x23, 0x09, 0x02, 0x02,
+    0x00, 0x02, 0x00, 0x02, 0xff, 0x63, 0x00, 0xf9, 0x00, 0xe2, 0x00, 0x24,
+    0x00, 0x33, 0x00, 0x07, 0x00, 0xb8, 0x00, 0x1e, 0x2f, 0x30, 0x31, 0x37,
+    0x3e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x36, 0x16, 0x17, 0x1e, 0x03, 0x17,
+    0x16, 0x0e, 0x02, 0x07, 0x06, 0x26, 0x2f, 0x02, 0x1e, 0x02, 0x06, 0x0f,
+    0x01, 0x2e, 0x01, 0x34, 0x3e, 0x01, 0x26, 0x37, 0x0e, 0x01, 0x17, 0x36,
+    0x16, 0x1f, 0x01, 0x16, 0x3e, 0x02, 0x37, 0x2e, 0x01, 0x02, 0x02, 0x19,
+    0x09, 0x07, 0x14, 0x0d, 0x0c, 0x1c, 0x0b, 0x17, 0x1d, 0x16, 0x13, 0x0c,
+    0x0f, 0x15, 0x2c, 0x35, 0x10, 0x08, 0x13, 0x0a, 0x0f, 0x04, 0x02, 0x05,
+    0x02, 0x05, 0x08, 0x21, 0x09, 0x07, 0x03, 0x01, 0x02, 0x4d, 0x13, 0x0b,
+    0x02, 0x07, 0x12, 0x05, 0x06, 0x13, 0x24, 0x1c, 0x13, 0x02, 0x13, 0x3d,
+    0xb3, 0x11, 0x09, 0x0d, 0x0c, 0x12, 0x02, 0x02, 0x03, 0x05, 0x08, 0x08,
+    0x0c, 0x13, 0x13, 0x17, 0x30, 0x29, 0x1e, 0x06, 0x03, 0x04, 0x01, 0x0a,
+    0x07, 0x19, 0x32, 0x2d, 0x27, 0x0e, 0x07, 0x0d, 0x30, 0x3c, 0x44, 0x43,
+    0x3b, 0x1b, 0x15, 0x3d, 0x23, 0x04, 0x03, 0x0b, 0x0d, 0x02, 0x0f, 0x19,
+    0x22, 0x12, 0x18, 0x1a, 0x00, 0x01, 0xff, 0xfc, 0xff, 0x55, 0x01, 0x07,
+    0x00, 0xea, 0x00, 0x39, 0x00, 0x0b, 0x00, 0xb8, 0x00, 0x23, 0x2f, 0xb8,
+    0x00, 0x26, 0x2f, 0x30, 0x31, 0x37, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x26,
+    0x0e, 0x02, 0x17, 0x1e, 0x01, 0x3e, 0x01, 0x37, 0x35, 0x32, 0x36, 0x37,
+    0x33, 0x14, 0x0e, 0x01, 0x14, 0x17, 0x33, 0x3e, 0x01, 0x37, 0x36, 0x1e,
+    0x01, 0x06, 0x0f, 0x01, 0x2a, 0x01, 0x07, 0x2e, 0x01, 0x27, 0x2e, 0x01,
+    0x3e, 0x01, 0x37, 0x0e, 0x01, 0x2e, 0x01, 0x27, 0x26, 0x3e, 0x03, 0x16,
+    0xbc, 0x01, 0x09, 0x0d, 0x0e, 0x04, 0x02, 0x26, 0x2b, 0x1f, 0x05, 0x04,
+    0x2a, 0x30, 0x29, 0x02, 0x07, 0x0e, 0x07, 0x0c, 0x09, 0x07, 0x09, 0x01,
+    0x06, 0x0c, 0x06, 0x09, 0x0d, 0x06, 0x03, 0x07, 0x1f, 0x05, 0x09, 0x05,
+    0x0a, 0x0f, 0x05, 0x0a, 0x05, 0x03, 0x08, 0x03, 0x17, 0x38, 0x33, 0x26,
+    0x04, 0x04, 0x15, 0x26, 0x2f, 0x2c, 0x23, 0xc4, 0x0b, 0x0c, 0x03, 0x08,
+    0x09, 0x06, 0x03, 0x12, 0x1e, 0x14, 0x10, 0x08, 0x08, 0x16, 0x0e, 0x03,
+    0x01, 0x01, 0x22, 0x46, 0x45, 0x45, 0x22, 0x04, 0x07, 0x03, 0x02, 0x06,
+    0x0b, 0x0e, 0x06, 0x14, 0x01, 0x06, 0x09, 0x0b, 0x17, 0x37, 0x3b, 0x3d,
+    0x1d, 0x0d, 0x0c, 0x07, 0x1a, 0x18, 0x17, 0x2a, 0x21, 0x13, 0x03, 0x11,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x09, 0x00, 0xce, 0x01, 0x12, 0x00, 0x28,
+    0x00, 0x0b, 0x00, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x23, 0x2f, 0x30,
+    0x31, 0x37, 0x26, 0x3e, 0x01, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x36, 0x37,
+    0x3e, 0x01, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x2e, 0x01,
+    0x07, 0x0e, 0x01, 0x07, 0x16, 0x06, 0x17, 0x1e, 0x01, 0x07, 0x22, 0x06,
+    0x07, 0x2e, 0x01, 0x37, 0x34, 0x26, 0x0b, 0x03, 0x04, 0x0b, 0x0f, 0x07,
+    0x04, 0x07, 0x03, 0x05, 0x0a, 0x16, 0x2a, 0x24, 0x19, 0x06, 0x01, 0x09,
+    0x0d, 0x0e, 0x04, 0x07, 0x1e, 0x1a, 0x0b, 0x0f, 0x05, 0x01, 0x01, 0x02,
+    0x02, 0x03, 0x02, 0x0a, 0x14, 0x0a, 0x07, 0x02, 0x05, 0x09, 0xdb, 0x09,
+    0x0e, 0x06, 0x01, 0x06, 0x07, 0x0c, 0x07, 0x0a, 0x0a, 0x15, 0x12, 0x06,
+    0x20, 0x1e, 0x0b, 0x0c, 0x03, 0x08, 0x09, 0x20, 0x09, 0x1f, 0x0e, 0x24,
+    0x14, 0x11, 0x22, 0x11, 0x0f, 0x1b, 0x10, 0x01, 0x01, 0x17, 0x43, 0x23,
+    0x17, 0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x07, 0x01, 0x10,
+    0x00, 0xcb, 0x00, 0x2a, 0x00, 0x00, 0x37, 0x06, 0x27, 0x26, 0x06, 0x07,
+    0x1e, 0x03, 0x17, 0x07, 0x0e, 0x02, 0x26, 0x27, 0x3f, 0x01, 0x36, 0x1e,
+    0x02, 0x07, 0x1e, 0x01, 0x3e, 0x01, 0x37, 0x2e, 0x03, 0x27, 0x26, 0x3e,
+    0x02, 0x32, 0x16, 0x17, 0x15, 0x06, 0xc6, 0x13, 0x04, 0x10, 0x2e, 0x10,
+    0x16, 0x39, 0x34, 0x27, 0x05, 0x08, 0x14, 0x4e, 0x51, 0x44, 0x09, 0x06,
+    0x0c, 0x07, 0x0e, 0x0a, 0x03, 0x04, 0x11, 0x2c, 0x2e, 0x2d, 0x12, 0x0c,
+    0x39, 0x3c, 0x32, 0x04, 0x03, 0x12, 0x21, 0x2a, 0x29, 0x22, 0x09, 0x07,
+    0x92, 0x01, 0x10, 0x05, 0x07, 0x06, 0x09, 0x0d, 0x12, 0x1c, 0x17, 0x17,
+    0x0d, 0x12, 0x01, 0x14, 0x1a, 0x12, 0x0c, 0x04, 0x01, 0x08, 0x0e, 0x07,
+    0x06, 0x05, 0x02, 0x08, 0x08, 0x0d, 0x10, 0x10, 0x14, 0x11, 0x0c, 0x16,
+    0x0f, 0x08, 0x0b, 0x0b, 0x19, 0x07, 0x00, 0x00, 0x00, 0x01, 0xff, 0x92,
+    0xff, 0xf1, 0x00, 0x86, 0x01, 0xd0, 0x00, 0x23, 0x00, 0x43, 0xba, 0x00,
+    0x0f, 0x00, 0x08, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x0f, 0x10, 0xb8, 0x00,
+    0x16, 0xd0, 0xb8, 0x00, 0x16, 0x2f, 0xb8, 0x00, 0x08, 0x10, 0xb8, 0x00,
+    0x21, 0xd0, 0xb8, 0x00, 0x21, 0x2f, 0x00, 0xba, 0x00, 0x0f, 0x00, 0x16,
+    0x00, 0x03, 0x2b, 0xb8, 0x00, 0x0f, 0x10, 0xb8, 0x00, 0x08, 0xd0, 0xb8,
+    0x00, 0x08, 0x2f, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00, 0x21, 0xd0, 0xb8,
+    0x00, 0x21, 0x2f, 0x30, 0x31, 0x03, 0x2e, 0x01, 0x34, 0x36, 0x37, 0x32,
+    0x36, 0x3f, 0x01, 0x3e, 0x02, 0x16, 0x17, 0x07, 0x37, 0x1e, 0x01, 0x14,
+    0x06, 0x0f, 0x01, 0x06, 0x16, 0x17, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x2e,
+    0x01, 0x37, 0x0e, 0x01, 0x5c, 0x09, 0x09, 0x09, 0x09, 0x1a, 0x35, 0x1a,
+    0x04, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x04, 0x3c, 0x0b, 0x0a, 0x0b, 0x0a,
+    0x3e, 0x02, 0x05, 0x0b, 0x01, 0x09, 0x0d, 0x0e, 0x04, 0x0b, 0x05, 0x02,
+    0x1a, 0x34, 0x01, 0x0c, 0x03, 0x0b, 0x0d, 0x0b, 0x02, 0x04, 0x03, 0x7e,
+    0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x7c, 0x03, 0x01, 0x0c, 0x0e, 0x0c, 0x01,
+    0x03, 0x44, 0x85, 0x43, 0x0b, 0x0c, 0x03, 0x08, 0x09, 0x45, 0x87, 0x45,
+    0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfb, 0xff, 0xf3, 0x00, 0xff,
+    0x00, 0xed, 0x00, 0x3e, 0x00, 0x0f, 0x00, 0xb8, 0x00, 0x2a, 0x2f, 0xb8,
+    0x00, 0x2d, 0x2f, 0xb8, 0x00, 0x37, 0x2f, 0x30, 0x31, 0x37, 0x26, 0x34,
+    0x27, 0x26, 0x35, 0x36, 0x35, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x17, 0x3e,
+    0x03, 0x37, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17,
+    0x36, 0x26, 0x35, 0x3e, 0x02, 0x16, 0x17, 0x14, 0x1e, 0x01, 0x06, 0x07,
+    0x22, 0x06, 0x07, 0x2e, 0x01, 0x27, 0x07, 0x0e, 0x03, 0x0f, 0x01, 0x2e,
+    0x03, 0x27, 0x2e, 0x01, 0x08, 0x02, 0x02, 0x09, 0x01, 0x09, 0x12, 0x08,
+    0x10, 0x17, 0x08, 0x01, 0x05, 0x0a, 0x12, 0x0e, 0x06, 0x0b, 0x09, 0x05,
+    0x01, 0x04, 0x07, 0x03, 0x08, 0x10, 0x0b, 0x04, 0x03, 0x01, 0x0b, 0x0e,
+    0x0c, 0x02, 0x06, 0x01, 0x09, 0x0f, 0x08, 0x0e, 0x08, 0x1d, 0x20, 0x0f,
+    0x06, 0x02, 0x01, 0x01, 0x03, 0x06, 0x21, 0x09, 0x0b, 0x07, 0x06, 0x04,
+    0x05, 0x0e, 0xb1, 0x03, 0x09, 0x03, 0x07, 0x0d, 0x01, 0x02, 0x02, 0x04,
+    0x02, 0x15, 0x41, 0x1f, 0x12, 0x23, 0x1d, 0x13, 0x03, 0x01, 0x0b, 0x11,
+    0x0f, 0x02, 0x09, 0x12, 0x09, 0x15, 0x2b, 0x14, 0x2a, 0x54, 0x2a, 0x0a,
+    0x0c, 0x01, 0x0a, 0x0b, 0x08, 0x3c, 0x48, 0x45, 0x12, 0x01, 0x01, 0x1d,
+    0x52, 0x29, 0x23, 0x0e, 0x18, 0x19, 0x1b, 0x0f, 0x07, 0x0c, 0x1d, 0x20,
+    0x1f, 0x0d, 0x13, 0x20, 0x00, 0x01, 0x00, 0x09, 0xff, 0xf1, 0x00, 0xa0,
+    0x00, 0xf8, 0x00, 0x20, 0x00, 0x00, 0x37, 0x26, 0x3e, 0x01, 0x16, 0x17,
+    0x16, 0x17, 0x3e, 0x01, 0x37, 0x36, 0x16, 0x07, 0x0e, 0x01, 0x07, 0x16,
+    0x17, 0x16, 0x06, 0x2f, 0x01, 0x06, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37,
+    0x36, 0x37, 0x26, 0x0d, 0x04, 0x07, 0x0e, 0x0f, 0x05, 0x0c, 0x11, 0x0a,
+    0x14, 0x09, 0x0c, 0x1c, 0x03, 0x0c, 0x1a, 0x0e, 0x17, 0x1a, 0x08, 0x16,
+    0x10, 0x27, 0x10, 0x0b, 0x06, 0x0f, 0x0c, 0x07, 0x03, 0x11, 0x16, 0x1a,
+    0xc4, 0x0a, 0x0f, 0x05, 0x05, 0x09, 0x1e, 0x1f, 0x15, 0x29, 0x15, 0x0e,
+    0x0d, 0x12, 0x1c, 0x35, 0x1b, 0x26, 0x22, 0x11, 0x14, 0x0a, 0x38, 0x23,
+    0x20, 0x09, 0x05, 0x06, 0x0f, 0x0a, 0x30, 0x2c, 0x2d, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x09, 0xff, 0x4a, 0x00, 0xc9, 0x01, 0x06, 0x00, 0x32,
+    0x00, 0x34, 0x00, 0x07, 0x00, 0xb8, 0x00, 0x11, 0x2f, 0x30, 0x31, 0x37,
+    0x3e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x3e, 0x03, 0x37, 0x26, 0x36,
+    0x3f, 0x01, 0x1e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e,
+    0x03, 0x15, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x34, 0x36, 0x37, 0x3e, 0x01,
+    0x37, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x35, 0x09,
+    0x01, 0x09, 0x0c, 0x0d, 0x04, 0x07, 0x23, 0x19, 0x07, 0x0b, 0x09, 0x06,
+    0x02, 0x01, 0x01, 0x08, 0x17, 0x11, 0x03, 0x05, 0x01, 0x01, 0x02, 0x01,
+    0x03, 0x02, 0x03, 0x08, 0x07, 0x05, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x0a,
+    0x04, 0x02, 0x03, 0x02, 0x14, 0x2f, 0x14, 0x08, 0x0b, 0x07, 0x08, 0x0b,
+    0xb7, 0xce, 0x09, 0x0c, 0x03, 0x06, 0x09, 0x26, 0x4c, 0x1d, 0x04, 0x15,
+    0x1c, 0x1d, 0x0b, 0x17, 0x35, 0x0c, 0x09, 0x06, 0x1f, 0x0e, 0x09, 0x13,
+    0x09, 0x1b, 0x36, 0x1a, 0x28, 0x3d, 0x34, 0x31, 0x1c, 0x09, 0x0a, 0x09,
+    0x08, 0x21, 0x41, 0x21, 0x14, 0x26, 0x14, 0x13, 0x18, 0x23, 0x0f, 0x17,
+    0x0f, 0x11, 0x22, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xec,
+    0xff, 0xf6, 0x00, 0xd4, 0x00, 0xd1, 0x00, 0x25, 0x00, 0x17, 0x00, 0xba,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x00, 0x10, 0xb8,
+    0x00, 0x23, 0xd0, 0xb8, 0x00, 0x23, 0x2f, 0x30, 0x31, 0x27, 0x2e, 0x01,
+    0x34, 0x36, 0x37, 0x32, 0x36, 0x1e, 0x01, 0x1f, 0x01, 0x16, 0x0e, 0x02,
+    0x07, 0x16, 0x36, 0x37, 0x36, 0x1e, 0x01, 0x06, 0x07, 0x0e, 0x01, 0x2f,
+    0x01, 0x26, 0x3e, 0x02, 0x37, 0x36, 0x37, 0x2e, 0x01, 0x02, 0x09, 0x09,
+    0x09, 0x09, 0x28, 0x28, 0x1d, 0x1f, 0x1e, 0x0e, 0x07, 0x1b, 0x2b, 0x30,
+    0x0f, 0x23, 0x3e, 0x1f, 0x09, 0x0d, 0x06, 0x03, 0x07, 0x2a, 0x50, 0x2e,
+    0x12, 0x05, 0x18, 0x26, 0x2a, 0x0e, 0x09, 0x07, 0x25, 0x49, 0xa8, 0x03,
+    0x0b, 0x0d, 0x0b, 0x02, 0x01, 0x01, 0x04, 0x04, 0x0e, 0x1a, 0x2b, 0x25,
+    0x20, 0x0f, 0x05, 0x07, 0x0f, 0x02, 0x06, 0x0b, 0x0e, 0x06, 0x15, 0x04,
+    0x06, 0x11, 0x18, 0x27, 0x1f, 0x1b, 0x0c, 0x07, 0x09, 0x05, 0x01, 0x00,
+    0x00, 0x03, 0xff, 0xf0, 0xff, 0xea, 0x01, 0x62, 0x02, 0x5c, 0x00, 0x30,
+    0x00, 0x46, 0x00, 0x5d, 0x00, 0xc0, 0xb8, 0x00, 0x5e, 0x2f, 0xb8, 0x00,
+    0x23, 0x2f, 0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x5e, 0x10, 0xb8, 0x00,
+    0x29, 0xd0, 0xb8, 0x00, 0x29, 0x2f, 0xb8, 0x00, 0x43, 0xdc, 0x41, 0x1b,
+    0x00, 0x06, 0x00, 0x43, 0x00, 0x16, 0x00, 0x43, 0x00, 0x26, 0x00, 0x43,
+    0x00, 0x36, 0x00, 0x43, 0x00, 0x46, 0x00, 0x43, 0x00, 0x56, 0x00, 0x43,
+    0x00, 0x66, 0x00, 0x43, 0x00, 0x76, 0x00, 0x43, 0x00, 0x86, 0x00, 0x43,
+    0x00, 0x96, 0x00, 0x43, 0x00, 0xa6, 0x00, 0x43, 0x00, 0xb6, 0x00, 0x43,
+    0x00, 0xc6, 0x00, 0x43, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00,
+    0x43, 0x00, 0xe5, 0x00, 0x43, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x07, 0xd0,
+    0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x23, 0x10, 0xb8, 0x00, 0x4a, 0xdc,
+    0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x29, 0x10,
+    0xb8, 0x00, 0x2e, 0xd0, 0xb8, 0x00, 0x2e, 0x2f, 0xba, 0x00, 0x31, 0x00,
+    0x23, 0x00, 0x4a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x4a, 0x10, 0xb8, 0x00,
+    0x3f, 0xd0, 0xb8, 0x00, 0x3f, 0x2f, 0xba, 0x00, 0x47, 0x00, 0x23, 0x00,
+    0x4a, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x4a, 0x10, 0xb8, 0x00, 0x58, 0xd0,
+    0xb8, 0x00, 0x58, 0x2f, 0xb8, 0x00, 0x4a, 0x10, 0xb8, 0x00, 0x5a, 0xd0,
+    0xb8, 0x00, 0x5a, 0x2f, 0x30, 0x31, 0x13, 0x3e, 0x01, 0x1e, 0x01, 0x07,
+    0x06, 0x07, 0x3e, 0x01, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x02, 0x07, 0x36,
+    0x16, 0x17, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x03, 0x07, 0x22, 0x27,
+    0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x06, 0x26, 0x37,
+    0x36, 0x37, 0x3e, 0x01, 0x13, 0x3e, 0x05, 0x27, 0x2e, 0x02, 0x06, 0x07,
+    0x06, 0x2b, 0x01, 0x0e, 0x01, 0x07, 0x14, 0x16, 0x1f, 0x01, 0x1e, 0x01,
+    0x17, 0x37, 0x3e, 0x03, 0x37, 0x3e, 0x01, 0x27, 0x2e, 0x01, 0x0e, 0x01,
+    0x07, 0x14, 0x23, 0x22, 0x06, 0x23, 0x1a, 0x03, 0x0f, 0x0d, 0x09, 0x01,
+    0x05, 0x01, 0x1f, 0x49, 0x41, 0x30, 0x06, 0x0b, 0x09, 0x1f, 0x2f, 0x1a,
+    0x2c, 0x53, 0x20, 0x0b, 0x04, 0x07, 0x0c, 0x06, 0x0f, 0x30, 0x3a, 0x3e,
+    0x1d, 0x0c, 0x06, 0x08, 0x15, 0x05, 0x04, 0x13, 0x09, 0x05, 0x09, 0x01,
+    0x0c, 0x16, 0x05, 0x07, 0x17, 0x01, 0x03, 0x3c, 0x0f, 0x2a, 0x2b, 0x28,
+    0x1a, 0x07, 0x0b, 0x09, 0x1e, 0x23, 0x26, 0x10, 0x03, 0x09, 0x03, 0x09,
+    0x19, 0x0b, 0x0b, 0x05, 0x0d, 0x05, 0x0a, 0x03, 0x07, 0x1c, 0x3c, 0x36,
+    0x2b, 0x09, 0x05, 0x03, 0x08, 0x0c, 0x34, 0x3d, 0x3c, 0x14, 0x01, 0x02,
+    0x01, 0x01, 0x02, 0x4a, 0x0a, 0x08, 0x04, 0x0e, 0x0a, 0x14, 0x14, 0x06,
+    0x01, 0x0d, 0x1a, 0x13, 0x21, 0x3f, 0x3b, 0x35, 0x18, 0x08, 0x0e, 0x20,
+    0x0b, 0x1f, 0x21, 0x1f, 0x0b, 0x1b, 0x2a, 0x1d, 0x11, 0x03, 0x06, 0x08,
+    0x06, 0x0d, 0x4e, 0x9a, 0x4e, 0x2a, 0x52, 0x2a, 0x08, 0x11, 0x11, 0x0d,
+    0x0c, 0x0f, 0x1f, 0xfe, 0xa7, 0x0b, 0x24, 0x2a, 0x2f, 0x2e, 0x2b, 0x12,
+    0x0f, 0x0e, 0x06, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x2f, 0x5c, 0x2e,
+    0x6a, 0x2f, 0x5c, 0x30, 0x03, 0x02, 0x11, 0x1e, 0x2b, 0x1d, 0x0d, 0x1b,
+    0x0b, 0x12, 0x09, 0x07, 0x11, 0x07, 0x01, 0x01, 0x00, 0x01, 0xff, 0xf9,
+    0xff, 0xfc, 0x01, 0x52, 0x02, 0x08, 0x00, 0x2a, 0x00, 0x0b, 0x00, 0xba,
+    0x00, 0x12, 0x00, 0x15, 0x00, 0x03, 0x2b, 0x30, 0x31, 0x01, 0x16, 0x06,
+    0x07, 0x2e, 0x02, 0x06, 0x07, 0x0e, 0x01, 0x1e, 0x01, 0x17, 0x1e, 0x02,
+    0x32, 0x17, 0x16, 0x06, 0x07, 0x2e, 0x03, 0x27, 0x2e, 0x01, 0x2f, 0x01,
+    0x26, 0x3e, 0x02, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x1e, 0x02, 0x01, 0x30,
+    0x11, 0x05, 0x13, 0x1e, 0x31, 0x2e, 0x2d, 0x19, 0x24, 0x20, 0x04, 0x23,
+    0x1f, 0x1c, 0x2e, 0x31, 0x38, 0x26, 0x11, 0x05, 0x13, 0x1e, 0x44, 0x42,
+    0x3a, 0x14, 0x0f, 0x26, 0x05, 0x12, 0x03, 0x0b, 0x17, 0x22, 0x14, 0x16,
+    0x2c, 0x16, 0x10, 0x22, 0x22, 0x22, 0x01, 0xef, 0x08, 0x1d, 0x02, 0x05,
+    0x0c, 0x03, 0x0d, 0x15, 0x1e, 0x5b, 0x61, 0x5d, 0x1f, 0x1c, 0x19, 0x09,
+    0x03, 0x08, 0x1d, 0x02, 0x02, 0x03, 0x0d, 0x1f, 0x1f, 0x18, 0x2e, 0x1b,
+    0x68, 0x13, 0x3d, 0x3c, 0x32, 0x09, 0x0b, 0x12, 0x09, 0x06, 0x02, 0x09,
+    0x0b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xb6, 0xff, 0xf8, 0x01, 0x7c,
+    0x02, 0x3e, 0x00, 0x50, 0x00, 0x90, 0xba, 0x00, 0x41, 0x00, 0x46, 0x00,
+    0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x41, 0x00, 0x16, 0x00, 0x41,
+    0x00, 0x26, 0x00, 0x41, 0x00, 0x36, 0x00, 0x41, 0x00, 0x46, 0x00, 0x41,
+    0x00, 0x56, 0x00, 0x41, 0x00, 0x66, 0x00, 0x41, 0x00, 0x76, 0x00, 0x41,
+    0x00, 0x86, 0x00, 0x41, 0x00, 0x96, 0x00, 0x41, 0x00, 0xa6, 0x00, 0x41,
+    0x00, 0xb6, 0x00, 0x41, 0x00, 0xc6, 0x00, 0x41, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x41, 0x00, 0xe5, 0x00, 0x41, 0x00, 0x02, 0x5d,
+    0xb8, 0x00, 0x41, 0x10, 0xb8, 0x00, 0x33, 0xd0, 0xb8, 0x00, 0x33, 0x2f,
+    0xb8, 0x00, 0x41, 0x10, 0xb8, 0x00, 0x37, 0xd0, 0xb8, 0x00, 0x37, 0x2f,
+    0xb8, 0x00, 0x41, 0x10, 0xb8, 0x00, 0x3a, 0xd0, 0xb8, 0x00, 0x3a, 0x2f,
+    0xb8, 0x00, 0x46, 0x10, 0xb8, 0x00, 0x3e, 0xdc, 0xb8, 0x00, 0x3b, 0xd0,
+    0xb8, 0x00, 0x3b, 0x2f, 0xb8, 0x00, 0x46, 0x10, 0xb8, 0x00, 0x4e, 0xd0,
+    0xb8, 0x00, 0x4e, 0x2f, 0x30, 0x31, 0x03, 0x2e, 0x01, 0x34, 0x36, 0x37,
+    0x16, 0x17, 0x36, 0x37, 0x36, 0x16, 0x07, 0x16, 0x17, 0x1e, 0x01, 0x17,
+    0x1e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x04, 0x07, 0x06,
+    0x2e, 0x02, 0x37, 0x3e, 0x04, 0x26, 0x27, 0x26, 0x27, 0x2e, 0x01, 0x27,
+    0x22, 0x26, 0x23, 0x17, 0x34, 0x26, 0x35, 0x34, 0x16, 0x1f, 0x01, 0x1e,
+    0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x03,
+    0x27, 0x2e, 0x01, 0x35, 0x2e, 0x01, 0x38, 0x09, 0x09, 0x09, 0x09, 0x33,
+    0x32, 0x07, 0x0c, 0x0f, 0x0f, 0x05, 0x26, 0x2a, 0x15, 0x29, 0x12, 0x11,
+    0x24, 0x0d, 0x2a, 0x0b, 0x03, 0x03, 0x06, 0x15, 0x2a, 0x38, 0x3a, 0x37,
+    0x13, 0x08, 0x0f, 0x0b, 0x01, 0x06, 0x18, 0x44, 0x44, 0x3a, 0x19, 0x11,
+    0x29, 0x1a, 0x1f, 0x1e, 0x50, 0x22, 0x02, 0x02, 0x02, 0x06, 0x01, 0x02,
+    0x01, 0x07, 0x02, 0x02, 0x02, 0x02, 0x0b, 0x02, 0x02, 0x0a, 0x0d, 0x0c,
+    0x03, 0x01, 0x08, 0x06, 0x02, 0x04, 0x02, 0x0d, 0x17, 0x27, 0x02, 0x08,
+    0x03, 0x0b, 0x0d, 0x0b, 0x02, 0x03, 0x06, 0x0e, 0x05, 0x04, 0x14, 0x0b,
+    0x07, 0x0e, 0x07, 0x0f, 0x0c, 0x0b, 0x14, 0x10, 0x35, 0x0e, 0x27, 0x12,
+    0x20, 0x3d, 0x3a, 0x35, 0x30, 0x2a, 0x12, 0x07, 0x01, 0x0a, 0x10, 0x08,
+    0x16, 0x34, 0x3c, 0x43, 0x46, 0x4a, 0x25, 0x16, 0x11, 0x10, 0x1a, 0x08,
+    0x01, 0x1f, 0x02, 0x04, 0x02, 0x04, 0x0f, 0x04, 0x39, 0x1d, 0x37, 0x1e,
+    0x48, 0x8d, 0x48, 0x09, 0x0a, 0x09, 0x08, 0x32, 0x64, 0x63, 0x64, 0x32,
+    0x0f, 0x3c, 0x1d, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe,
+    0xff, 0xff, 0x01, 0x40, 0x02, 0x61, 0x00, 0x58, 0x00, 0x7f, 0xba, 0x00,
+    0x42, 0x00, 0x54, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x54, 0x10, 0xb8, 0x00,
+    0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
+    0x07, 0xd0, 0xb8, 0x00, 0x07, 0x2f, 0xb8, 0x00, 0x0a, 0x10, 0xb8, 0x00,
+    0x0f, 0xd0, 0xb8, 0x00, 0x0f, 0x2f, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
+    0x2f, 0xdc, 0xb8, 0x00, 0x2b, 0xd0, 0xb8, 0x00, 0x2b, 0x2f, 0xb8, 0x00,
+    0x2f, 0x10, 0xb8, 0x00, 0x2d, 0xd0, 0xb8, 0x00, 0x2f, 0x10, 0xb8, 0x00,
+    0x32, 0xd0, 0xb8, 0x00, 0x32, 0x2f, 0xb8, 0x00, 0x42, 0x10, 0xb8, 0x00,
+    0x3f, 0xd0, 0xb8, 0x00, 0x3f, 0x2f, 0xb8, 0x00, 0x54, 0x10, 0xb8, 0x00,
+    0x58, 0xd0, 0xb8, 0x00, 0x58, 0x2f, 0x00, 0xba, 0x00, 0x1e, 0x00, 0x23,
+    0x00, 0x03, 0x2b, 0xb8, 0x00, 0x23, 0x10, 0xb8, 0x00, 0x28, 0xd0, 0xb8,
+    0x00, 0x28, 0x2f, 0x30, 0x31, 0x13, 0x26, 0x27, 0x2e, 0x01, 0x3e, 0x01,
+    0x33, 0x3e, 0x01, 0x37, 0x34, 0x2e, 0x01, 0x34, 0x37, 0x2e, 0x01, 0x34,
+    0x36, 0x37, 0x32, 0x37, 0x36, 0x37, 0x36, 0x16, 0x17, 0x3e, 0x01, 0x37,
+    0x1e, 0x01, 0x14, 0x06, 0x07, 0x22, 0x06, 0x22, 0x06, 0x07, 0x0e, 0x01,
+    0x07, 0x14, 0x17, 0x16, 0x07, 0x0e, 0x01, 0x07, 0x16, 0x3e, 0x02, 0x37,
+    0x36, 0x1e, 0x01, 0x06, 0x07, 0x0e, 0x01, 0x27, 0x0e, 0x01, 0x15, 0x16,
+    0x3e, 0x02, 0x37, 0x1e, 0x01, 0x07, 0x0e, 0x03, 0x27, 0x0e, 0x01, 0x2e,
+    0x01, 0x27, 0x35, 0x2f, 0x01, 0x37, 0x12, 0x06, 0x02, 0x07, 0x04, 0x03,
+    0x0a, 0x07, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0x08, 0x09,
+    0x03, 0x02, 0x03, 0x05, 0x0a, 0x11, 0x03, 0x3a, 0x75, 0x3a, 0x0b, 0x0a,
+    0x0b, 0x0a, 0x11, 0x11, 0x0a, 0x0c, 0x0d, 0x2a, 0x54, 0x2a, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x12, 0x26, 0x26, 0x24, 0x10, 0x0a, 0x0e, 0x04,
+    0x06, 0x0a, 0x23, 0x55, 0x28, 0x02, 0x04, 0x11, 0x32, 0x33, 0x2c, 0x0b,
+    0x13, 0x04, 0x11, 0x0f, 0x2c, 0x32, 0x32, 0x15, 0x02, 0x0b, 0x0c, 0x0b,
+    0x03, 0x0a, 0x03, 0x09, 0x01, 0x0a, 0x02, 0x02, 0x05, 0x0d, 0x0c, 0x07,
+    0x23, 0x47, 0x24, 0x04, 0x14, 0x1b, 0x1e, 0x0e, 0x01, 0x0c, 0x0d, 0x0c,
+    0x02, 0x01, 0x09, 0x04, 0x06, 0x05, 0x08, 0x09, 0x07, 0x02, 0x01, 0x0c,
+    0x0e, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x06, 0x06, 0x05, 0x2b,
+    0x2d, 0x27, 0x4f, 0x27, 0x03, 0x04, 0x09, 0x0a, 0x05, 0x03, 0x09, 0x0d,
+    0x0f, 0x04, 0x0a, 0x15, 0x05, 0x33, 0x63, 0x33, 0x03, 0x02, 0x07, 0x08,
+    0x02, 0x02, 0x1e, 0x08, 0x03, 0x08, 0x06, 0x02, 0x03, 0x08, 0x07, 0x01,
+    0x08, 0x08, 0x0b, 0x09, 0x18, 0x13, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8,
+    0xff, 0xcf, 0x00, 0xd1, 0x02, 0x5f, 0x00, 0x3f, 0x00, 0xc3, 0xba, 0x00,
+    0x17, 0x00, 0x37, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x37, 0x10, 0xb8, 0x00,
+    0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x17,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x26, 0x00, 0x17, 0x00, 0x36, 0x00, 0x17,
+    0x00, 0x46, 0x00, 0x17, 0x00, 0x56, 0x00, 0x17, 0x00, 0x66, 0x00, 0x17,
+    0x00, 0x76, 0x00, 0x17, 0x00, 0x86, 0x00, 0x17, 0x00, 0x96, 0x00, 0x17,
+    0x00, 0xa6, 0x00, 0x17, 0x00, 0xb6, 0x00, 0x17, 0x00, 0xc6, 0x00, 0x17,
+    0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x17, 0x00, 0xe5, 0x00,
+    0x17, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x17, 0x10, 0xb8, 0x00, 0x05, 0xd0,
+    0xb8, 0x00, 0x05, 0x2f, 0xba, 0x00, 0x34, 0x00, 0x37, 0x00, 0x17, 0x11,
+    0x12, 0x39, 0xb8, 0x00, 0x34, 0x2f, 0xb8, 0x00, 0x2c, 0xdc, 0xb8, 0x00,
+    0x1a, 0xd0, 0xb8, 0x00, 0x1a, 0x2f, 0xb8, 0x00, 0x34, 0x10, 0xb8, 0x00,
+    0x2f, 0xdc, 0xb8, 0x00, 0x37, 0x10, 0xb8, 0x00, 0x3e, 0xd0, 0xb8, 0x00,
+    0x3e, 0x2f, 0x00, 0xba, 0x00, 0x09, 0x00, 0x14, 0x00, 0x03, 0x2b, 0xb8,
+    0x00, 0x09, 0x10, 0xb8, 0x00, 0x0c, 0xd0, 0xb8, 0x00, 0x0c, 0x2f, 0xb8,
+    0x00, 0x14, 0x10, 0xb8, 0x00, 0x11, 0xd0, 0xb8, 0x00, 0x11, 0x2f, 0xb8,
+    0x00, 0x14, 0x10, 0xb8, 0x00, 0x37, 0xd0, 0xb8, 0x00, 0x37, 0x2f, 0x30,
+    0x31, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x15, 0x1e, 0x01, 0x33, 0x32, 0x36,
+    0x37, 0x1e, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27,
+    0x1e, 0x01, 0x17, 0x16, 0x32, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x36, 0x1e,
+    0x01, 0x06, 0x07, 0x0e, 0x03, 0x27, 0x1e, 0x01, 0x17, 0x0e, 0x01, 0x22,
+    0x26, 0x27, 0x26, 0x02, 0x27, 0x22, 0x27, 0x34, 0x26, 0x35, 0x3f, 0x01,
+    0x35, 0x09, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x07, 0x0e, 0x06, 0x1d, 0x37,
+    0x1c, 0x0b, 0x0a, 0x0b, 0x0a, 0x1c, 0x38, 0x1c, 0x07, 0x0d, 0x06, 0x02,
+    0x05, 0x04, 0x01, 0x02, 0x02, 0x09, 0x19, 0x1b, 0x19, 0x08, 0x0a, 0x0e,
+    0x04, 0x06, 0x0a, 0x0e, 0x1b, 0x1b, 0x1b, 0x0d, 0x05, 0x07, 0x02, 0x02,
+    0x0a, 0x0d, 0x0c, 0x03, 0x02, 0x16, 0x04, 0x0a, 0x07, 0x01, 0x09, 0x08,
+    0x02, 0x48, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x08, 0x01, 0x01, 0x04, 0x01,
+    0x01, 0x0c, 0x0e, 0x0c, 0x01, 0x01, 0x04, 0x01, 0x01, 0x39, 0x72, 0x39,
+    0x01, 0x01, 0x06, 0x03, 0x0a, 0x0b, 0x02, 0x03, 0x09, 0x0d, 0x0f, 0x04,
+    0x03, 0x0b, 0x09, 0x04, 0x03, 0x4a, 0x93, 0x4b, 0x09, 0x0a, 0x09, 0x08,
+    0x8e, 0x01, 0x1a, 0x8e, 0x0a, 0x01, 0x01, 0x01, 0x1c, 0x03, 0x06, 0x00,
+    0x00, 0x01, 0xff, 0xff, 0xff, 0xc6, 0x01, 0x39, 0x02, 0x67, 0x00, 0x54,
+    0x00, 0x00, 0x13, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x34, 0x26, 0x35, 0x26,
+    0x0e, 0x04, 0x07, 0x0e, 0x02, 0x16, 0x17, 0x16, 0x32, 0x3e, 0x01, 0x37,
+    0x3e, 0x03, 0x27, 0x22, 0x0e, 0x02, 0x07, 0x26, 0x27, 0x34, 0x27, 0x37,
+    0x3e, 0x01, 0x37, 0x36, 0x16, 0x17, 0x16, 0x17, 0x1e, 0x01, 0x14, 0x06,
+    0x15, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x01, 0x37,
+    0x0e, 0x01, 0x07, 0x0e, 0x02, 0x26, 0x27, 0x2e, 0x03, 0x27, 0x26, 0x36,
+    0x37, 0x3e, 0x02, 0x16, 0xef, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x0d,
+    0x1c, 0x1b, 0x18, 0x14, 0x0c, 0x02, 0x0f, 0x10, 0x01, 0x10, 0x11, 0x03,
+    0x16, 0x18, 0x16, 0x04, 0x13, 0x2f, 0x24, 0x10, 0x0c, 0x0e, 0x13, 0x15,
+    0x1b, 0x15, 0x09, 0x0d, 0x02, 0x09, 0x0f, 0x1e, 0x10, 0x12, 0x21, 0x0e,
+    0x19, 0x11, 0x05, 0x03, 0x02, 0x03, 0x13, 0x02, 0x02, 0x0a, 0x0d, 0x0c,
+    0x03, 0x01, 0x08, 0x05, 0x18, 0x3c, 0x18, 0x0a, 0x1b, 0x1c, 0x1b, 0x0a,
+    0x0e, 0x11, 0x09, 0x04, 0x01, 0x07, 0x1c, 0x2a, 0x0c, 0x39, 0x39, 0x2c,
+    0x02, 0x26, 0x09, 0x0a, 0x09, 0x08, 0x05, 0x0a, 0x05, 0x0d, 0x04, 0x16,
+    0x22, 0x22, 0x1c, 0x05, 0x2f, 0x6a, 0x6b, 0x69, 0x2f, 0x09, 0x08, 0x0c,
+    0x02, 0x09, 0x21, 0x2b, 0x31, 0x18, 0x02, 0x04, 0x05, 0x04, 0x05, 0x05,
+    0x01, 0x04, 0x1c, 0x07, 0x0b, 0x02, 0x02, 0x02, 0x05, 0x02, 0x08, 0x03,
+    0x15, 0x17, 0x14, 0x03, 0x36, 0x6a, 0x37, 0x09, 0x0a, 0x09, 0x08, 0x22,
+    0x43, 0x21, 0x1b, 0x2a, 0x0b, 0x05, 0x0b, 0x05, 0x04, 0x0a, 0x0e, 0x29,
+    0x2d, 0x2d, 0x11, 0x64, 0xbc, 0x5a, 0x1a, 0x24, 0x07, 0x1b, 0x00, 0x00,
+    0x00, 0x02, 0xff, 0xfb, 0xff, 0xfb, 0x01, 0x27, 0x02, 0x32, 0x00, 0x31,
+    0x00, 0x50, 0x00, 0xa0, 0xba, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x03, 0x2b,
+    0xba, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x36,
+    0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x96,
+    0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xc6,
+    0x00, 0x00, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x00, 0x00,
+    0xe5, 0x00, 0x00, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
+    0x05, 0xdc, 0xb8, 0x00, 0x21, 0x10, 0xb8, 0x00, 0x1c, 0xd0, 0xb8, 0x00,
+    0x1c, 0x2f, 0xb8, 0x00, 0x21, 0x10, 0xb8, 0x00, 0x24, 0xd0, 0xb8, 0x00,
+    0x2c, 0x10, 0xb8, 0x00, 0x29, 0xd0, 0xb8, 0x00, 0x29, 0x2f, 0xb8, 0x00,
+    0x05, 0x10, 0xb8, 0x00, 0x2f, 0xd0, 0xb8, 0x00, 0x2f, 0x2f, 0xb8, 0x00,
+    0x2c, 0x10, 0xb8, 0x00, 0x3b, 0xd0, 0xb8, 0x00, 0x3b, 0x2f, 0xb8, 0x00,
+    0x21, 0x10, 0xb8, 0x00, 0x52, 0xdc, 0x30, 0x31, 0x37, 0x0e, 0x01, 0x22,
+    0x26, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x17,
+    0x1e, 0x03, 0x17, 0x1e, 0x01, 0x17, 0x37, 0x1e, 0x01, 0x0f, 0x01, 0x16,
+    0x06, 0x15, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3c, 0x01, 0x27, 0x0e, 0x01,
+    0x27, 0x1e, 0x01, 0x27, 0x16, 0x32, 0x17, 0x1e, 0x01, 0x37, 0x3e, 0x01,
+    0x37, 0x26, 0x27, 0x2e, 0x03, 0x27, 0x2e, 0x01, 0x27, 0x0e, 0x01, 0x07,
+    0x0e, 0x03, 0x17, 0x1e, 0x01, 0x17, 0x5d, 0x02, 0x0a, 0x0d, 0x0c, 0x03,
+    0x03, 0x13, 0x14, 0x10, 0x08, 0x0f, 0x18, 0x10, 0x09, 0x12, 0x13, 0x15,
+    0x0c, 0x03, 0x0f, 0x11, 0x0e, 0x03, 0x1d, 0x1b, 0x05, 0x16, 0x13, 0x04,
+    0x11, 0x1a, 0x03, 0x03, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x03, 0x26, 0x51,
+    0x23, 0x0b, 0x17, 0x29, 0x03, 0x05, 0x02, 0x0f, 0x26, 0x03, 0x17, 0x2f,
+    0x17, 0x03, 0x06, 0x02, 0x06, 0x0a, 0x0f, 0x0a, 0x05, 0x10, 0x07, 0x0c,
+    0x19, 0x0c, 0x10, 0x12, 0x09, 0x01, 0x01, 0x02, 0x05, 0x04, 0x16, 0x09,
+    0x0a, 0x09, 0x08, 0x2e, 0x59, 0x59, 0x5a, 0x2e, 0x12, 0x2a, 0x28, 0x22,
+    0x0a, 0x06, 0x0f, 0x0c, 0x05, 0x04, 0x01, 0x06, 0x09, 0x0a, 0x06, 0x33,
+    0x79, 0x42, 0x06, 0x02, 0x1e, 0x08, 0x06, 0x3e, 0x77, 0x35, 0x09, 0x0a,
+    0x09, 0x08, 0x38, 0x6f, 0x38, 0x0b, 0x10, 0x08, 0x30, 0x60, 0xbc, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x03, 0x0b, 0x07, 0x2a, 0x2a, 0x0e, 0x27, 0x28,
+    0x26, 0x0d, 0x07, 0x03, 0x04, 0x08, 0x0d, 0x08, 0x0b, 0x26, 0x2c, 0x2c,
+    0x10, 0x14, 0x26, 0x13, 0x00, 0x01, 0xff, 0xf9, 0xff, 0xe7, 0x00, 0xfb,
+    0x02, 0x65, 0x00, 0x35, 0x00, 0xd9, 0xb8, 0x00, 0x36, 0x2f, 0xb8, 0x00,
+    0x0b, 0x2f, 0xb8, 0x00, 0x36, 0x10, 0xb8, 0x00, 0x2c, 0xd0, 0xb8, 0x00,
+    0x2c, 0x2f, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00,
+    0x23, 0xdc, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x23, 0x00, 0x16, 0x00, 0x23,
+    0x00, 0x26, 0x00, 0x23, 0x00, 0x36, 0x00, 0x23, 0x00, 0x46, 0x00, 0x23,
+    0x00, 0x56, 0x00, 0x23, 0x00, 0x66, 0x00, 0x23, 0x00, 0x76, 0x00, 0x23,
+    0x00, 0x86, 0x00, 0x23, 0x00, 0x96, 0x00, 0x23, 0x00, 0xa6, 0x00, 0x23,
+    0x00, 0xb6, 0x00, 0x23, 0x00, 0xc6, 0x00, 0x23, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x23, 0x00, 0xe5, 0x00, 0x23, 0x00, 0x02, 0x5d,
+    0xb8, 0x00, 0x05, 0xd0, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00, 0x23, 0x10,
+    0xb8, 0x00, 0x08, 0xd0, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x0b, 0x10,
+    0xb8, 0x00, 0x0f, 0xd0, 0xb8, 0x00, 0x0f, 0x2f, 0xb8, 0x00, 0x0b, 0x10,
+    0xb8, 0x00, 0x17, 0xdc, 0xb8, 0x00, 0x1a, 0xd0, 0xb8, 0x00, 0x0b, 0x10,
+    0xb8, 0x00, 0x1c, 0xd0, 0xb8, 0x00, 0x23, 0x10, 0xb8, 0x00, 0x20, 0xd0,
+    0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00, 0x28, 0xd0,
+    0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00, 0x2e, 0xd0,
+    0xb8, 0x00, 0x2e, 0x2f, 0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00, 0x33, 0xd0,
+    0xb8, 0x00, 0x33, 0x2f, 0xb8, 0x00, 0x17, 0x10, 0xb8, 0x00, 0x37, 0xdc,
+    0x00, 0xb8, 0x00, 0x13, 0x2f, 0x30, 0x31, 0x13, 0x3e, 0x02, 0x16, 0x17,
+    0x14, 0x16, 0x17, 0x3e, 0x01, 0x37, 0x35, 0x34, 0x26, 0x27, 0x26, 0x3d,
+    0x01, 0x37, 0x1e, 0x01, 0x1d, 0x01, 0x16, 0x14, 0x07, 0x11, 0x07, 0x11,
+    0x0e, 0x01, 0x07, 0x1e, 0x01, 0x15, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x34,
+    0x26, 0x27, 0x23, 0x06, 0x2b, 0x01, 0x36, 0x34, 0x35, 0x37, 0x2e, 0x01,
+    0x04, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x01, 0x01, 0x27, 0x4e, 0x27, 0x02,
+    0x05, 0x02, 0x27, 0x08, 0x02, 0x09, 0x09, 0x28, 0x27, 0x4d, 0x27, 0x01,
+    0x01, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x01, 0x03, 0x02, 0x04, 0x05,
+    0x01, 0x0c, 0x01, 0x01, 0x02, 0x38, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x4a,
+    0x92, 0x49, 0x08, 0x10, 0x08, 0x8f, 0x23, 0x47, 0x22, 0x04, 0x01, 0x07,
+    0x09, 0x26, 0x52, 0x27, 0x8f, 0x05, 0x14, 0x08, 0xfe, 0xe3, 0x03, 0x01,
+    0x16, 0x08, 0x10, 0x08, 0x3c, 0x79, 0x3d, 0x09, 0x0a, 0x09, 0x08, 0x3c,
+    0x74, 0x3c, 0x01, 0x0b, 0x13, 0x0a, 0x02, 0x4b, 0x95, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xfb, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x5c, 0x00, 0x33,
+    0x00, 0x43, 0xba, 0x00, 0x1f, 0x00, 0x0a, 0x00, 0x03, 0x2b, 0x00, 0xba,
+    0x00, 0x26, 0x00, 0x2e, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x26, 0x10, 0xb8,
+    0x00, 0x02, 0xd0, 0xb8, 0x00, 0x02, 0x2f, 0xb8, 0x00, 0x26, 0x10, 0xb8,
+    0x00, 0x05, 0xd0, 0xb8, 0x00, 0x05, 0x2f, 0xb8, 0x00, 0x26, 0x10, 0xb8,
+    0x00, 0x24, 0xd0, 0xb8, 0x00, 0x24, 0x2f, 0xb8, 0x00, 0x2e, 0x10, 0xb8,
+    0x00, 0x2b, 0xd0, 0xb8, 0x00, 0x2b, 0x2f, 0x30, 0x31, 0x37, 0x36, 0x17,
+    0x32, 0x36, 0x33, 0x36, 0x2e, 0x02, 0x27, 0x06, 0x26, 0x27, 0x26, 0x3e,
+    0x02, 0x17, 0x36, 0x16, 0x17, 0x16, 0x36, 0x37, 0x36, 0x17, 0x37, 0x1e,
+    0x01, 0x0f, 0x01, 0x1e, 0x03, 0x07, 0x36, 0x33, 0x1e, 0x01, 0x14, 0x06,
+    0x07, 0x22, 0x06, 0x23, 0x0e, 0x01, 0x27, 0x35, 0x37, 0x17, 0x11, 0x0a,
+    0x0c, 0x18, 0x0d, 0x07, 0x01, 0x09, 0x0c, 0x03, 0x19, 0x2c, 0x0b, 0x06,
+    0x01, 0x09, 0x0e, 0x07, 0x04, 0x08, 0x04, 0x0c, 0x18, 0x0c, 0x07, 0x0a,
+    0x39, 0x13, 0x04, 0x11, 0x32, 0x03, 0x0c, 0x0a, 0x02, 0x07, 0x2a, 0x2c,
+    0x0b, 0x0a, 0x0b, 0x0a, 0x2b, 0x55, 0x2b, 0x09, 0x14, 0x07, 0x04, 0x29,
+    0x09, 0x0a, 0x01, 0x40, 0x7f, 0x80, 0x7f, 0x41, 0x02, 0x05, 0x0b, 0x08,
+    0x0f, 0x09, 0x02, 0x04, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x05, 0x03,
+    0x09, 0x02, 0x1e, 0x08, 0x08, 0x41, 0x7f, 0x80, 0x80, 0x41, 0x03, 0x01,
+    0x0c, 0x0e, 0x0c, 0x01, 0x04, 0x01, 0x01, 0x08, 0x1e, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0a, 0xff, 0xf6, 0x01, 0x0b, 0x02, 0x77, 0x00, 0x28,
+    0x00, 0x50, 0xba, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x41, 0x05,
+    0x00, 0xda, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x02, 0x5d, 0x41,
+    0x1b, 0x00, 0x09, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x29, 0x00,
+    0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x59, 0x00,
+    0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x89, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xb9, 0x00,
+    0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x0d, 0x5d, 0x30, 0x31, 0x13, 0x3e,
+    0x02, 0x16, 0x17, 0x1e, 0x03, 0x17, 0x1e, 0x03, 0x07, 0x0e, 0x03, 0x27,
+    0x2e, 0x01, 0x27, 0x26, 0x3e, 0x01, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x16,
+    0x3e, 0x02, 0x37, 0x36, 0x2e, 0x02, 0xa8, 0x01, 0x0b, 0x0e, 0x0c, 0x02,
+    0x01, 0x01, 0x02, 0x03, 0x03, 0x07, 0x17, 0x11, 0x02, 0x0d, 0x0b, 0x2a,
+    0x37, 0x43, 0x24, 0x0b, 0x0b, 0x08, 0x03, 0x04, 0x0b, 0x0f, 0x07, 0x0b,
+    0x10, 0x14, 0x13, 0x29, 0x23, 0x18, 0x03, 0x0c, 0x0a, 0x16, 0x19, 0x02,
+    0x60, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x13, 0x18, 0x16, 0x18, 0x12, 0x29,
+    0x5f, 0x63, 0x5f, 0x29, 0x23, 0x41, 0x27, 0x03, 0x1c, 0x09, 0x1a, 0x0b,
+    0x09, 0x0e, 0x06, 0x01, 0x06, 0x11, 0x1e, 0x08, 0x08, 0x16, 0x27, 0x2d,
+    0x0f, 0x39, 0x75, 0x74, 0x75, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a,
+    0xff, 0xec, 0x01, 0x49, 0x02, 0x6c, 0x00, 0x40, 0x00, 0x2e, 0xba, 0x00,
+    0x35, 0x00, 0x3e, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x35, 0x10, 0xb8, 0x00,
+    0x08, 0xd0, 0xb8, 0x00, 0x08, 0x2f, 0xb8, 0x00, 0x35, 0x10, 0xb8, 0x00,
+    0x0b, 0xd0, 0xb8, 0x00, 0x0b, 0x2f, 0xb8, 0x00, 0x3e, 0x10, 0xb8, 0x00,
+    0x3b, 0xd0, 0xb8, 0x00, 0x3b, 0x2f, 0x30, 0x31, 0x13, 0x3e, 0x01, 0x1e,
+    0x01, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x3e, 0x01, 0x37, 0x3e,
+    0x03, 0x37, 0x26, 0x36, 0x17, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01,
+    0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x01, 0x26, 0x27,
+    0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x23, 0x06, 0x07,
+    0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x34, 0x36, 0x1b,
+    0x03, 0x0f, 0x0d, 0x09, 0x01, 0x0f, 0x01, 0x01, 0x01, 0x27, 0x37, 0x1a,
+    0x01, 0x0b, 0x0e, 0x0e, 0x04, 0x07, 0x0c, 0x10, 0x12, 0x05, 0x0b, 0x11,
+    0x03, 0x1c, 0x33, 0x22, 0x0c, 0x14, 0x08, 0x2c, 0x5a, 0x23, 0x04, 0x04,
+    0x0c, 0x10, 0x06, 0x20, 0x53, 0x2d, 0x07, 0x0d, 0x07, 0x02, 0x03, 0x02,
+    0x03, 0x11, 0x18, 0x03, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x02, 0x03, 0x01,
+    0x02, 0x02, 0x5a, 0x0a, 0x08, 0x04, 0x0e, 0x0a, 0x42, 0x88, 0x44, 0x1f,
+    0x3c, 0x1e, 0x38, 0x79, 0x40, 0x02, 0x1c, 0x22, 0x20, 0x07, 0x0a, 0x15,
+    0x02, 0x05, 0x1b, 0x1f, 0x1e, 0x07, 0x3f, 0x7c, 0x3b, 0x07, 0x17, 0x08,
+    0x2d, 0x4f, 0x36, 0x09, 0x0f, 0x08, 0x02, 0x08, 0x33, 0x50, 0x26, 0x07,
+    0x0e, 0x06, 0x02, 0x04, 0x01, 0x1c, 0x1d, 0x79, 0x09, 0x0a, 0x09, 0x08,
+    0x4d, 0x98, 0x4d, 0x48, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06,
+    0xff, 0xf2, 0x00, 0xb5, 0x02, 0x78, 0x00, 0x1d, 0x00, 0x60, 0xba, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x05,
+    0x00, 0x16, 0x00, 0x05, 0x00, 0x26, 0x00, 0x05, 0x00, 0x36, 0x00, 0x05,
+    0x00, 0x46, 0x00, 0x05, 0x00, 0x56, 0x00, 0x05, 0x00, 0x66, 0x00, 0x05,
+    0x00, 0x76, 0x00, 0x05, 0x00, 0x86, 0x00, 0x05, 0x00, 0x96, 0x00, 0x05,
+    0x00, 0xa6, 0x00, 0x05, 0x00, 0xb6, 0x00, 0x05, 0x00, 0xc6, 0x00, 0x05,
+    0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x05, 0x00, 0xe5, 0x00,
+    0x05, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x08, 0xdc,
+    0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0x30, 0x31, 0x13, 0x3e,
+    0x02, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37,
+    0x36, 0x1e, 0x01, 0x06, 0x07, 0x0e, 0x03, 0x2f, 0x01, 0x2e, 0x03, 0x06,
+    0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x03, 0x08, 0x05, 0x04, 0x06, 0x0b, 0x11,
+    0x24, 0x11, 0x0a, 0x0e, 0x04, 0x06, 0x0a, 0x0a, 0x1a, 0x1b, 0x1b, 0x0b,
+    0x12, 0x0b, 0x0e, 0x08, 0x04, 0x02, 0x61, 0x0a, 0x0c, 0x01, 0x0a, 0x0b,
+    0x4e, 0x9d, 0x4f, 0x42, 0x88, 0x42, 0x05, 0x09, 0x06, 0x03, 0x09, 0x0d,
+    0x0f, 0x04, 0x04, 0x0a, 0x08, 0x03, 0x03, 0x11, 0x4a, 0x97, 0x97, 0x98,
+    0x00, 0x01, 0x00, 0x08, 0xff, 0xec, 0x01, 0xce, 0x02, 0x67, 0x00, 0x51,
+    0x00, 0x59, 0xba, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x2b, 0x41, 0x1b,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00,
+    0x00, 0x36, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00,
+    0x00, 0x66, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00,
+    0x00, 0x96, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00,
+    0x00, 0xc6, 0x00, 0x00, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00,
+    0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x5d, 0x00, 0xb8, 0x00, 0x0b,
+    0x2f, 0xb8, 0x00, 0x0e, 0x2f, 0x30, 0x31, 0x37, 0x0e, 0x01, 0x22, 0x26,
+    0x27, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x1e, 0x02,
+    0x14, 0x17, 0x1e, 0x03, 0x17, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x03, 0x37,
+    0x17, 0x1e, 0x01, 0x14, 0x16, 0x17, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x2e,
+    0x03, 0x27, 0x34, 0x2e, 0x02, 0x27, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07,
+    0x0e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27,
+    0x0e, 0x01, 0x07, 0x0e, 0x01, 0x30, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x05,
+    0x21, 0x1c, 0x0a, 0x12, 0x11, 0x07, 0x0e, 0x07, 0x09, 0x09, 0x03, 0x01,
+    0x08, 0x0e, 0x12, 0x18, 0x11, 0x07, 0x06, 0x07, 0x02, 0x05, 0x12, 0x1a,
+    0x24, 0x17, 0x21, 0x16, 0x0b, 0x01, 0x0e, 0x01, 0x09, 0x0d, 0x0e, 0x04,
+    0x08, 0x07, 0x02, 0x01, 0x02, 0x03, 0x04, 0x05, 0x03, 0x13, 0x1c, 0x0c,
+    0x06, 0x07, 0x05, 0x01, 0x0c, 0x15, 0x1d, 0x13, 0x05, 0x0a, 0x08, 0x05,
+    0x01, 0x17, 0x18, 0x0e, 0x01, 0x04, 0x02, 0x05, 0x09, 0x04, 0x1b, 0x22,
+    0x17, 0x09, 0x0a, 0x09, 0x08, 0x70, 0xdb, 0x6d, 0x23, 0x50, 0x20, 0x02,
+    0x03, 0x02, 0x07, 0x18, 0x1c, 0x1b, 0x0a, 0x2d, 0x5c, 0x5c, 0x5b, 0x2b,
+    0x10, 0x0e, 0x1f, 0x0f, 0x1f, 0x5f, 0x61, 0x55, 0x16, 0x09, 0x41, 0x89,
+    0x8c, 0x8a, 0x43, 0x0b, 0x0c, 0x03, 0x08, 0x09, 0x27, 0x53, 0x53, 0x52,
+    0x26, 0x09, 0x3a, 0x3f, 0x33, 0x02, 0x2e, 0x5f, 0x31, 0x17, 0x2f, 0x18,
+    0x09, 0x2f, 0x2d, 0x18, 0x0f, 0x04, 0x16, 0x17, 0x13, 0x02, 0x45, 0x8d,
+    0x47, 0x03, 0x24, 0x16, 0x13, 0x25, 0x11, 0x6a, 0xd3, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0b, 0xff, 0xeb, 0x01, 0x1e, 0x02, 0x50, 0x00, 0x36,
+    0x01, 0x1f, 0xba, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x2b, 0xba, 0x00,
+    0x1e, 0x00, 0x19, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x76, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00,
+    0x00, 0xa6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00,
+    0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xe5, 0x00,
+    0x00, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x08, 0xdc,
+    0x41, 0x05, 0x00, 0xda, 0x00, 0x19, 0x00, 0xea, 0x00, 0x19, 0x00, 0x02,
+    0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x19, 0x00, 0x19, 0x00, 0x19, 0x00,
+    0x29, 0x00, 0x19, 0x00, 0x39, 0x00, 0x19, 0x00, 0x49, 0x00, 0x19, 0x00,
+    0x59, 0x00, 0x19, 0x00, 0x69, 0x00, 0x19, 0x00, 0x79, 0x00, 0x19, 0x00,
+    0x89, 0x00, 0x19, 0x00, 0x99, 0x00, 0x19, 0x00, 0xa9, 0x00, 0x19, 0x00,
+    0xb9, 0x00, 0x19, 0x00, 0xc9, 0x00, 0x19, 0x00, 0x0d, 0x5d, 0xba, 0x00,
+    0x16, 0x00, 0x19, 0x00, 0x1e, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x16, 0x2f,
+    0x41, 0x05, 0x00, 0xda, 0x00, 0x16, 0x00, 0xea, 0x00, 0x16, 0x00, 0x02,
+    0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x16, 0x00, 0x19, 0x00, 0x16, 0x00,
+    0x29, 0x00, 0x16, 0x00, 0x39, 0x00, 0x16, 0x00, 0x49, 0x00, 0x16, 0x00,
+    0x59, 0x00, 0x16, 0x00, 0x69, 0x00, 0x16, 0x00, 0x79, 0x00, 0x16, 0x00,
+    0x89, 0x00, 0x16, 0x00, 0x99, 0x00, 0x16, 0x00, 0xa9, 0x00, 0x16, 0x00,
+    0xb9, 0x00, 0x16, 0x00, 0xc9, 0x00, 0x16, 0x00, 0x0d, 0x5d, 0xb8, 0x00,
+    0x21, 0xdc, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x2f, 0xd0, 0xb8, 0x00,
+    0x2f, 0x2f, 0xb8, 0x00, 0x08, 0x10, 0xb8, 0x00, 0x34, 0xdc, 0xb8, 0x00,
+    0x21, 0x10, 0xb8, 0x00, 0x38, 0xdc, 0x00, 0xb8, 0x00, 0x25, 0x2f, 0x30,
+    0x31, 0x37, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x01, 0x35, 0x34, 0x2e,
+    0x02, 0x3f, 0x01, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x17, 0x34, 0x26,
+    0x35, 0x3e, 0x02, 0x16, 0x17, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x0f, 0x01,
+    0x2e, 0x03, 0x27, 0x2e, 0x03, 0x27, 0x06, 0x1e, 0x02, 0x15, 0x14, 0x06,
+    0x33, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x02, 0x12, 0x06, 0x05, 0x01, 0x04,
+    0x12, 0x12, 0x19, 0x13, 0x0d, 0x06, 0x23, 0x37, 0x1d, 0x11, 0x01, 0x0b,
+    0x0e, 0x0c, 0x02, 0x0b, 0x04, 0x02, 0x05, 0x0b, 0x21, 0x0c, 0x10, 0x0d,
+    0x0b, 0x05, 0x0c, 0x1c, 0x20, 0x24, 0x13, 0x03, 0x03, 0x07, 0x06, 0x12,
+    0x0b, 0x09, 0x0a, 0x09, 0x08, 0x37, 0x6b, 0x37, 0x1f, 0x3e, 0x3d, 0x3d,
+    0x1f, 0x11, 0x01, 0x14, 0x1e, 0x22, 0x0d, 0x4e, 0xa0, 0x51, 0x7d, 0xf5,
+    0x7d, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x69, 0xcf, 0x6a, 0x27, 0x58, 0x27,
+    0x08, 0x0c, 0x22, 0x24, 0x25, 0x0f, 0x23, 0x58, 0x58, 0x51, 0x1d, 0x1a,
+    0x33, 0x33, 0x34, 0x1a, 0x36, 0x6c, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8,
+    0xff, 0xf7, 0x01, 0x3e, 0x02, 0x7d, 0x00, 0x27, 0x00, 0x47, 0x00, 0x4a,
+    0x00, 0x00, 0x13, 0x36, 0x1e, 0x01, 0x06, 0x0f, 0x01, 0x1e, 0x03, 0x17,
+    0x1e, 0x02, 0x06, 0x07, 0x0e, 0x03, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x2e,
+    0x04, 0x27, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x17, 0x06,
+    0x26, 0x37, 0x0e, 0x01, 0x07, 0x0e, 0x02, 0x16, 0x17, 0x1e, 0x03, 0x17,
+    0x16, 0x3e, 0x02, 0x37, 0x36, 0x26, 0x27, 0x2e, 0x03, 0x27, 0x26, 0x36,
+    0x17, 0x23, 0x32, 0xb6, 0x0a, 0x0e, 0x04, 0x06, 0x0a, 0x04, 0x12, 0x21,
+    0x1b, 0x11, 0x03, 0x0a, 0x0e, 0x06, 0x05, 0x0a, 0x05, 0x0d, 0x14, 0x1b,
+    0x13, 0x0e, 0x1e, 0x0f, 0x15, 0x26, 0x20, 0x1a, 0x13, 0x0d, 0x02, 0x11,
+    0x12, 0x1d, 0x08, 0x23, 0x0e, 0x0f, 0x31, 0x06, 0x0e, 0x12, 0x03, 0x04,
+    0x07, 0x04, 0x24, 0x25, 0x0e, 0x06, 0x07, 0x04, 0x0f, 0x1a, 0x27, 0x1b,
+    0x19, 0x25, 0x19, 0x0f, 0x04, 0x0e, 0x09, 0x14, 0x09, 0x0f, 0x10, 0x16,
+    0x12, 0x03, 0x01, 0x07, 0x01, 0x01, 0x02, 0x7a, 0x03, 0x09, 0x0d, 0x0f,
+    0x04, 0x02, 0x0a, 0x2b, 0x2f, 0x2a, 0x09, 0x1e, 0x4e, 0x51, 0x4d, 0x1e,
+    0x0e, 0x2a, 0x2a, 0x22, 0x06, 0x04, 0x07, 0x03, 0x04, 0x16, 0x27, 0x32,
+    0x32, 0x2c, 0x0e, 0x58, 0x99, 0x53, 0x16, 0x21, 0x11, 0x11, 0x05, 0x44,
+    0x07, 0x12, 0x0b, 0x02, 0x04, 0x02, 0x18, 0x5a, 0x66, 0x66, 0x25, 0x15,
+    0x3b, 0x38, 0x2b, 0x04, 0x04, 0x19, 0x28, 0x2e, 0x11, 0x42, 0x8e, 0x3f,
+    0x1e, 0x20, 0x16, 0x17, 0x14, 0x02, 0x01, 0x05, 0x00, 0x02, 0x00, 0x06,
+    0xff, 0xb6, 0x01, 0x38, 0x02, 0x7b, 0x00, 0x30, 0x00, 0x53, 0x00, 0x64,
+    0xba, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x03, 0x2b, 0x41, 0x05, 0x00, 0xda,
+    0x00, 0x3c, 0x00, 0xea, 0x00, 0x3c, 0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00,
+    0x09, 0x00, 0x3c, 0x00, 0x19, 0x00, 0x3c, 0x00, 0x29, 0x00, 0x3c, 0x00,
+    0x39, 0x00, 0x3c, 0x00, 0x49, 0x00, 0x3c, 0x00, 0x59, 0x00, 0x3c, 0x00,
+    0x69, 0x00, 0x3c, 0x00, 0x79, 0x00, 0x3c, 0x00, 0x89, 0x00, 0x3c, 0x00,
+    0x99, 0x00, 0x3c, 0x00, 0xa9, 0x00, 0x3c, 0x00, 0xb9, 0x00, 0x3c, 0x00,
+    0xc9, 0x00, 0x3c, 0x00, 0x0d, 0x5d, 0xb8, 0x00, 0x3c, 0x10, 0xb8, 0x00,
+    0x17, 0xd0, 0xb8, 0x00, 0x17, 0x2f, 0xb8, 0x00, 0x09, 0x10, 0xb8, 0x00,
+    0x55, 0xdc, 0x30, 0x31, 0x13, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x17, 0x1e,
+    0x01, 0x17, 0x16, 0x06, 0x07, 0x0e, 0x03, 0x07, 0x0e, 0x01, 0x07, 0x1e,
+    0x01, 0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x0e, 0x01,
+    0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x34, 0x3e, 0x01, 0x37, 0x3e,
+    0x03, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x16, 0x17, 0x36, 0x37, 0x36, 0x27,
+    0x2e, 0x01, 0x27, 0x2e, 0x01, 0x07, 0x0e, 0x03, 0x07, 0x0e, 0x02, 0x16,
+    0x17, 0x1e, 0x02, 0x36, 0x37, 0x2e, 0x01, 0x95, 0x06, 0x0c, 0x05, 0x05,
+    0x12, 0x09, 0x31, 0x32, 0x06, 0x03, 0x03, 0x08, 0x08, 0x06, 0x06, 0x0c,
+    0x0c, 0x03, 0x05, 0x03, 0x08, 0x0f, 0x02, 0x02, 0x0a, 0x0d, 0x0c, 0x03,
+    0x02, 0x08, 0x05, 0x13, 0x2b, 0x29, 0x25, 0x0d, 0x11, 0x1d, 0x06, 0x05,
+    0x07, 0x0e, 0x09, 0x05, 0x11, 0x1a, 0x26, 0x3c, 0x01, 0x0b, 0x0e, 0x0c,
+    0x02, 0x01, 0x07, 0x16, 0x0a, 0x0d, 0x06, 0x05, 0x26, 0x26, 0x0a, 0x13,
+    0x0b, 0x12, 0x19, 0x12, 0x0c, 0x03, 0x0a, 0x0d, 0x01, 0x0d, 0x10, 0x11,
+    0x21, 0x20, 0x1e, 0x0d, 0x08, 0x0a, 0x02, 0x76, 0x01, 0x01, 0x02, 0x07,
+    0x02, 0x08, 0x3f, 0x82, 0x50, 0x23, 0x57, 0x23, 0x1e, 0x1b, 0x13, 0x19,
+    0x1b, 0x06, 0x09, 0x05, 0x1a, 0x32, 0x1c, 0x09, 0x0a, 0x09, 0x08, 0x13,
+    0x24, 0x11, 0x0e, 0x03, 0x11, 0x25, 0x1a, 0x21, 0x45, 0x25, 0x1d, 0x44,
+    0x45, 0x42, 0x1b, 0x10, 0x36, 0x32, 0x24, 0xfe, 0x1e, 0x0a, 0x0c, 0x01,
+    0x0a, 0x0b, 0x18, 0x1a, 0x2e, 0x3c, 0x46, 0x49, 0x46, 0x6b, 0x35, 0x03,
+    0x07, 0x02, 0x02, 0x21, 0x2a, 0x29, 0x0c, 0x27, 0x52, 0x51, 0x51, 0x26,
+    0x27, 0x2d, 0x11, 0x08, 0x0e, 0x17, 0x2c, 0x00, 0x00, 0x02, 0xff, 0xf0,
+    0x00, 0x02, 0x00, 0xeb, 0x02, 0x6b, 0x00, 0x57, 0x00, 0x6a, 0x00, 0xbe,
+    0xba, 0x00, 0x68, 0x00, 0x1c, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x1c, 0x10,
+    0xb8, 0x00, 0x3b, 0xdc, 0xba, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3b, 0x11,
+    0x12, 0x39, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x68, 0x00, 0x16, 0x00, 0x68,
+    0x00, 0x26, 0x00, 0x68, 0x00, 0x36, 0x00, 0x68, 0x00, 0x46, 0x00, 0x68,
+    0x00, 0x56, 0x00, 0x68, 0x00, 0x66, 0x00, 0x68, 0x00, 0x76, 0x00, 0x68,
+    0x00, 0x86, 0x00, 0x68, 0x00, 0x96, 0x00, 0x68, 0x00, 0xa6, 0x00, 0x68,
+    0x00, 0xb6, 0x00, 0x68, 0x00, 0xc6, 0x00, 0x68, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x68, 0x00, 0xe5, 0x00, 0x68, 0x00, 0x02, 0x5d,
+    0xb8, 0x00, 0x68, 0x10, 0xb8, 0x00, 0x02, 0xd0, 0xb8, 0x00, 0x02, 0x2f,
+    0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x0f, 0xd0, 0xb8, 0x00, 0x0f, 0x2f,
+    0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x15, 0xd0, 0xb8, 0x00, 0x15, 0x2f,
+    0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x19, 0xd0, 0xb8, 0x00, 0x19, 0x2f,
+    0xb8, 0x00, 0x1c, 0x10, 0xb8, 0x00, 0x24, 0xd0, 0xb8, 0x00, 0x68, 0x10,
+    0xb8, 0x00, 0x2e, 0xd0, 0xb8, 0x00, 0x2e, 0x2f, 0xb8, 0x00, 0x68, 0x10,
+    0xb8, 0x00, 0x58, 0xd0, 0xb8, 0x00, 0x58, 0x2f, 0xb8, 0x00, 0x68, 0x10,
+    0xb8, 0x00, 0x5b, 0xd0, 0xb8, 0x00, 0x5b, 0x2f, 0x30, 0x31, 0x13, 0x06,
+    0x07, 0x0e, 0x01, 0x07, 0x06, 0x16, 0x0f, 0x01, 0x35, 0x36, 0x16, 0x14,
+    0x34, 0x35, 0x34, 0x26, 0x35, 0x3e, 0x01, 0x37, 0x35, 0x3e, 0x01, 0x35,
+    0x34, 0x26, 0x27, 0x23, 0x06, 0x2e, 0x01, 0x36, 0x37, 0x32, 0x37, 0x3e,
+    0x01, 0x37, 0x36, 0x1e, 0x02, 0x07, 0x06, 0x15, 0x32, 0x36, 0x33, 0x06,
+    0x23, 0x15, 0x37, 0x23, 0x3e, 0x01, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x02,
+    0x07, 0x22, 0x15, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17,
+    0x16, 0x0f, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x2f,
+    0x01, 0x1c, 0x01, 0x07, 0x3e, 0x03, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01,
+    0x0e, 0x01, 0x07, 0x1e, 0x01, 0x4a, 0x0a, 0x0a, 0x02, 0x07, 0x06, 0x02,
+    0x06, 0x02, 0x28, 0x01, 0x01, 0x04, 0x04, 0x09, 0x02, 0x01, 0x01, 0x05,
+    0x02, 0x01, 0x0a, 0x0c, 0x02, 0x08, 0x0a, 0x05, 0x02, 0x01, 0x07, 0x06,
+    0x07, 0x0f, 0x0a, 0x02, 0x05, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x08,
+    0x04, 0x18, 0x3c, 0x36, 0x26, 0x02, 0x02, 0x17, 0x26, 0x2e, 0x15, 0x01,
+    0x02, 0x03, 0x02, 0x14, 0x10, 0x0c, 0x07, 0x13, 0x0a, 0x07, 0x08, 0x01,
+    0x08, 0x12, 0x09, 0x1a, 0x1a, 0x11, 0x02, 0x0c, 0x03, 0x12, 0x01, 0x14,
+    0x33, 0x2c, 0x1b, 0x04, 0x02, 0x08, 0x0b, 0x0b, 0x1c, 0x20, 0x21, 0x10,
+    0x02, 0x02, 0x01, 0x57, 0x06, 0x03, 0x3e, 0x79, 0x3d, 0x12, 0x22, 0x12,
+    0x03, 0x06, 0x0c, 0x06, 0x07, 0x02, 0x14, 0x0b, 0x15, 0x0b, 0x44, 0x87,
+    0x44, 0x02, 0x11, 0x22, 0x11, 0x0d, 0x34, 0x1d, 0x01, 0x0b, 0x0e, 0x0e,
+    0x02, 0x01, 0x11, 0x1a, 0x08, 0x05, 0x02, 0x09, 0x0e, 0x08, 0x01, 0x0e,
+    0x01, 0x01, 0x01, 0x02, 0x06, 0x09, 0x07, 0x20, 0x24, 0x1b, 0x2d, 0x25,
+    0x1e, 0x0c, 0x01, 0x02, 0x04, 0x03, 0x31, 0x62, 0x34, 0x20, 0x3d, 0x20,
+    0x0b, 0x0d, 0x01, 0x03, 0x05, 0x02, 0x48, 0x93, 0x4a, 0x0a, 0x12, 0x09,
+    0x59, 0x0e, 0x1c, 0x0e, 0x08, 0x21, 0x26, 0x28, 0x10, 0x0b, 0x10, 0x05,
+    0x05, 0x02, 0x05, 0x08, 0x04, 0x1d, 0x3c, 0x00, 0x00, 0x02, 0x00, 0x09,
+    0xff, 0xdf, 0x00, 0xfc, 0x02, 0x75, 0x00, 0x2d, 0x00, 0x40, 0x00, 0x6a,
+    0xba, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06,
+    0x00, 0x2e, 0x00, 0x16, 0x00, 0x2e, 0x00, 0x26, 0x00, 0x2e, 0x00, 0x36,
+    0x00, 0x2e, 0x00, 0x46, 0x00, 0x2e, 0x00, 0x56, 0x00, 0x2e, 0x00, 0x66,
+    0x00, 0x2e, 0x00, 0x76, 0x00, 0x2e, 0x00, 0x86, 0x00, 0x2e, 0x00, 0x96,
+    0x00, 0x2e, 0x00, 0xa6, 0x00, 0x2e, 0x00, 0xb6, 0x00, 0x2e, 0x00, 0xc6,
+    0x00, 0x2e, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x2e, 0x00,
+    0xe5, 0x00, 0x2e, 0x00, 0x02, 0x5d, 0xba, 0x00, 0x2a, 0x00, 0x2d, 0x00,
+    0x2e, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x2a, 0x2f, 0xb8, 0x00, 0x1b, 0xdc,
+    0xb8, 0x00, 0x31, 0xd0, 0xb8, 0x00, 0x31, 0x2f, 0x30, 0x31, 0x13, 0x26,
+    0x34, 0x3e, 0x01, 0x17, 0x32, 0x16, 0x33, 0x16, 0x36, 0x17, 0x32, 0x16,
+    0x17, 0x1e, 0x03, 0x17, 0x16, 0x0e, 0x02, 0x07, 0x06, 0x27, 0x17, 0x1e,
+    0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x34,
+    0x26, 0x27, 0x2e, 0x01, 0x27, 0x17, 0x1e, 0x01, 0x17, 0x36, 0x37, 0x3e,
+    0x01, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x2a, 0x01, 0x0e,
+    0x05, 0x07, 0x0c, 0x07, 0x03, 0x0a, 0x04, 0x04, 0x08, 0x02, 0x08, 0x0e,
+    0x08, 0x13, 0x2b, 0x29, 0x1f, 0x07, 0x0f, 0x10, 0x2e, 0x44, 0x25, 0x09,
+    0x05, 0x03, 0x01, 0x05, 0x09, 0x0c, 0x06, 0x0f, 0x0c, 0x07, 0x03, 0x0b,
+    0x08, 0x06, 0x01, 0x04, 0x0b, 0x03, 0x29, 0x02, 0x07, 0x03, 0x06, 0x04,
+    0x16, 0x27, 0x11, 0x0c, 0x15, 0x07, 0x0f, 0x0c, 0x24, 0x33, 0x18, 0x05,
+    0x11, 0x02, 0x52, 0x07, 0x0f, 0x09, 0x04, 0x03, 0x05, 0x01, 0x03, 0x04,
+    0x01, 0x01, 0x02, 0x11, 0x19, 0x21, 0x12, 0x28, 0x43, 0x33, 0x20, 0x05,
+    0x02, 0x05, 0x36, 0x24, 0x4c, 0x4b, 0x49, 0x23, 0x09, 0x05, 0x06, 0x0f,
+    0x0a, 0x20, 0x45, 0x47, 0x47, 0x21, 0x4f, 0x9e, 0x50, 0x0c, 0x36, 0x6c,
+    0x37, 0x04, 0x01, 0x02, 0x0c, 0x0d, 0x08, 0x16, 0x0c, 0x19, 0x32, 0x27,
+    0x1a, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0xff, 0xfb, 0x01, 0x28,
+    0x02, 0x5b, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x16, 0x0e, 0x01, 0x26, 0x27,
+    0x2e, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x03, 0x17, 0x1e,
+    0x01, 0x0e, 0x02, 0x26, 0x27, 0x26, 0x36, 0x17, 0x1e, 0x01, 0x3e, 0x01,
+    0x27, 0x2e, 0x03, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x3e, 0x03, 0x16, 0x01,
+    0x14, 0x01, 0x06, 0x0c, 0x0e, 0x06, 0x05, 0x18, 0x1b, 0x1a, 0x08, 0x1f,
+    0x1b, 0x0b, 0x0a, 0x2e, 0x35, 0x31, 0x0e, 0x15, 0x01, 0x1f, 0x37, 0x46,
+    0x4f, 0x25, 0x0f, 0x0b, 0x12, 0x1e, 0x53, 0x48, 0x2b, 0x0b, 0x08, 0x3a,
+    0x41, 0x38, 0x05, 0x02, 0x02, 0x02, 0x02, 0x18, 0x2a, 0x34, 0x32, 0x2a,
+    0x02, 0x2e, 0x09, 0x0c, 0x06, 0x03, 0x08, 0x0e, 0x05, 0x07, 0x0e, 0x06,
+    0x15, 0x41, 0x25, 0x21, 0x32, 0x2d, 0x2e, 0x1f, 0x31, 0x4a, 0x34, 0x1d,
+    0x07, 0x0e, 0x12, 0x0a, 0x1c, 0x01, 0x0e, 0x10, 0x0c, 0x32, 0x35, 0x25,
+    0x3d, 0x3a, 0x3c, 0x24, 0x0e, 0x19, 0x0d, 0x16, 0x31, 0x29, 0x1e, 0x08,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe8, 0x00, 0x0b, 0x00, 0xec,
+    0x02, 0x6c, 0x00, 0x19, 0x00, 0x2f, 0xba, 0x00, 0x11, 0x00, 0x16, 0x00,
+    0x03, 0x2b, 0x00, 0xb8, 0x00, 0x08, 0x2f, 0xba, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x03, 0x2b, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x10, 0xd0, 0xb8,
+    0x00, 0x10, 0x2f, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x17, 0xd0, 0xb8,
+    0x00, 0x17, 0x2f, 0x30, 0x31, 0x03, 0x2e, 0x01, 0x34, 0x36, 0x37, 0x3e,
+    0x01, 0x37, 0x1e, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x11, 0x0e,
+    0x01, 0x22, 0x26, 0x27, 0x11, 0x0e, 0x01, 0x06, 0x09, 0x09, 0x09, 0x09,
+    0x38, 0x6e, 0x37, 0x0b, 0x0a, 0x0b, 0x0a, 0x15, 0x2a, 0x14, 0x02, 0x0a,
+    0x0d, 0x0c, 0x03, 0x19, 0x30, 0x02, 0x39, 0x03, 0x0b, 0x0d, 0x0b, 0x02,
+    0x01, 0x09, 0x01, 0x01, 0x0c, 0x0e, 0x0c, 0x01, 0x01, 0x01, 0x02, 0xfd,
+    0xde, 0x09, 0x0a, 0x09, 0x08, 0x02, 0x21, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xf9, 0xff, 0xb7, 0x01, 0x03, 0x02, 0x47, 0x00, 0x2f,
+    0x00, 0xcb, 0xb8, 0x00, 0x30, 0x2f, 0xb8, 0x00, 0x16, 0x2f, 0xb8, 0x00,
+    0x30, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00,
+    0x05, 0xdc, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x05, 0x00, 0x16, 0x00, 0x05,
+    0x00, 0x26, 0x00, 0x05, 0x00, 0x36, 0x00, 0x05, 0x00, 0x46, 0x00, 0x05,
+    0x00, 0x56, 0x00, 0x05, 0x00, 0x66, 0x00, 0x05, 0x00, 0x76, 0x00, 0x05,
+    0x00, 0x86, 0x00, 0x05, 0x00, 0x96, 0x00, 0x05, 0x00, 0xa6, 0x00, 0x05,
+    0x00, 0xb6, 0x00, 0x05, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x05, 0x00, 0xe5, 0x00, 0x05, 0x00, 0x02, 0x5d,
+    0x41, 0x05, 0x00, 0xda, 0x00, 0x16, 0x00, 0xea, 0x00, 0x16, 0x00, 0x02,
+    0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x16, 0x00, 0x19, 0x00, 0x16, 0x00,
+    0x29, 0x00, 0x16, 0x00, 0x39, 0x00, 0x16, 0x00, 0x49, 0x00, 0x16, 0x00,
+    0x59, 0x00, 0x16, 0x00, 0x69, 0x00, 0x16, 0x00, 0x79, 0x00, 0x16, 0x00,
+    0x89, 0x00, 0x16, 0x00, 0x99, 0x00, 0x16, 0x00, 0xa9, 0x00, 0x16, 0x00,
+    0xb9, 0x00, 0x16, 0x00, 0xc9, 0x00, 0x16, 0x00, 0x0d, 0x5d, 0xb8, 0x00,
+    0x16, 0x10, 0xb8, 0x00, 0x1b, 0xdc, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00,
+    0x2b, 0xd0, 0xb8, 0x00, 0x2b, 0x2f, 0xb8, 0x00, 0x1b, 0x10, 0xb8, 0x00,
+    0x31, 0xdc, 0x00, 0xb8, 0x00, 0x23, 0x2f, 0xb8, 0x00, 0x26, 0x2f, 0x30,
+    0x31, 0x03, 0x3e, 0x02, 0x16, 0x17, 0x14, 0x06, 0x1e, 0x01, 0x17, 0x1e,
+    0x03, 0x17, 0x3e, 0x03, 0x2e, 0x01, 0x27, 0x3e, 0x02, 0x16, 0x17, 0x1e,
+    0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x2a, 0x01, 0x07, 0x2e, 0x03,
+    0x27, 0x2e, 0x02, 0x36, 0x04, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x03, 0x01,
+    0x07, 0x0a, 0x03, 0x0b, 0x12, 0x19, 0x12, 0x21, 0x27, 0x12, 0x03, 0x05,
+    0x07, 0x01, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x02, 0x0b, 0x05, 0x1e, 0x27,
+    0x07, 0x1a, 0x0b, 0x05, 0x09, 0x05, 0x18, 0x1d, 0x14, 0x0d, 0x07, 0x11,
+    0x0f, 0x04, 0x03, 0x02, 0x10, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x31, 0x63,
+    0x63, 0x62, 0x31, 0x10, 0x34, 0x33, 0x2a, 0x07, 0x1b, 0x58, 0x6a, 0x75,
+    0x71, 0x66, 0x27, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x52, 0x95, 0x90, 0x8f,
+    0x4c, 0x0e, 0x10, 0x0a, 0x01, 0x09, 0x1a, 0x21, 0x28, 0x17, 0x39, 0x75,
+    0x76, 0x77, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xff, 0xd3, 0x01, 0x09,
+    0x02, 0x7c, 0x00, 0x2c, 0x00, 0xc1, 0xb8, 0x00, 0x2d, 0x2f, 0xb8, 0x00,
+    0x11, 0x2f, 0xb8, 0x00, 0x2d, 0x10, 0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00,
+    0x00, 0x2f, 0xb8, 0x00, 0x05, 0xdc, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x05,
+    0x00, 0x16, 0x00, 0x05, 0x00, 0x26, 0x00, 0x05, 0x00, 0x36, 0x00, 0x05,
+    0x00, 0x46, 0x00, 0x05, 0x00, 0x56, 0x00, 0x05, 0x00, 0x66, 0x00, 0x05,
+    0x00, 0x76, 0x00, 0x05, 0x00, 0x86, 0x00, 0x05, 0x00, 0x96, 0x00, 0x05,
+    0x00, 0xa6, 0x00, 0x05, 0x00, 0xb6, 0x00, 0x05, 0x00, 0xc6, 0x00, 0x05,
+    0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x05, 0x00, 0xe5, 0x00,
+    0x05, 0x00, 0x02, 0x5d, 0x41, 0x05, 0x00, 0xda, 0x00, 0x11, 0x00, 0xea,
+    0x00, 0x11, 0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x11, 0x00,
+    0x19, 0x00, 0x11, 0x00, 0x29, 0x00, 0x11, 0x00, 0x39, 0x00, 0x11, 0x00,
+    0x49, 0x00, 0x11, 0x00, 0x59, 0x00, 0x11, 0x00, 0x69, 0x00, 0x11, 0x00,
+    0x79, 0x00, 0x11, 0x00, 0x89, 0x00, 0x11, 0x00, 0x99, 0x00, 0x11, 0x00,
+    0xa9, 0x00, 0x11, 0x00, 0xb9, 0x00, 0x11, 0x00, 0xc9, 0x00, 0x11, 0x00,
+    0x0d, 0x5d, 0xb8, 0x00, 0x11, 0x10, 0xb8, 0x00, 0x16, 0xdc, 0xba, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x16, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x2e, 0xdc,
+    0x00, 0xb8, 0x00, 0x1f, 0x2f, 0x30, 0x31, 0x13, 0x3e, 0x02, 0x16, 0x17,
+    0x1e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x02,
+    0x16, 0x17, 0x0e, 0x03, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x26, 0x36, 0x27,
+    0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x03, 0x04, 0x01, 0x0b, 0x0e,
+    0x0c, 0x02, 0x03, 0x1f, 0x0e, 0x10, 0x16, 0x0d, 0x07, 0x0a, 0x17, 0x16,
+    0x11, 0x03, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x03, 0x12, 0x18, 0x1a, 0x0a,
+    0x08, 0x01, 0x08, 0x25, 0x08, 0x02, 0x02, 0x02, 0x09, 0x07, 0x0b, 0x13,
+    0x0c, 0x08, 0x12, 0x11, 0x0d, 0x02, 0x65, 0x0a, 0x0c, 0x01, 0x0a, 0x0b,
+    0x36, 0x67, 0x35, 0x39, 0x72, 0x39, 0x21, 0x2f, 0x5c, 0x5d, 0x5e, 0x30,
+    0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x35, 0x66, 0x66, 0x66, 0x34, 0x26, 0x4c,
+    0x25, 0x03, 0x16, 0x31, 0x17, 0x1e, 0x3c, 0x1d, 0x30, 0x60, 0x30, 0x20,
+    0x3e, 0x3f, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x0d, 0xff, 0xaf, 0x00, 0xe5,
+    0x02, 0x6e, 0x00, 0x30, 0x00, 0x50, 0xba, 0x00, 0x26, 0x00, 0x2b, 0x00,
+    0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x26, 0x00, 0x16, 0x00, 0x26,
+    0x00, 0x26, 0x00, 0x26, 0x00, 0x36, 0x00, 0x26, 0x00, 0x46, 0x00, 0x26,
+    0x00, 0x56, 0x00, 0x26, 0x00, 0x66, 0x00, 0x26, 0x00, 0x76, 0x00, 0x26,
+    0x00, 0x86, 0x00, 0x26, 0x00, 0x96, 0x00, 0x26, 0x00, 0xa6, 0x00, 0x26,
+    0x00, 0xb6, 0x00, 0x26, 0x00, 0xc6, 0x00, 0x26, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x26, 0x00, 0xe5, 0x00, 0x26, 0x00, 0x02, 0x5d,
+    0x30, 0x31, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x16, 0x17, 0x3e, 0x01, 0x37,
+    0x35, 0x3e, 0x02, 0x16, 0x17, 0x16, 0x0e, 0x02, 0x07, 0x0e, 0x01, 0x07,
+    0x1e, 0x01, 0x17, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x0e,
+    0x01, 0x07, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x01, 0x37, 0x2e, 0x01,
+    0x0d, 0x01, 0x09, 0x0c, 0x0d, 0x04, 0x1b, 0x1e, 0x10, 0x1d, 0x0b, 0x01,
+    0x0b, 0x0e, 0x0c, 0x02, 0x01, 0x0d, 0x14, 0x18, 0x09, 0x03, 0x05, 0x03,
+    0x17, 0x31, 0x1b, 0x01, 0x09, 0x0d, 0x0e, 0x04, 0x16, 0x28, 0x13, 0x14,
+    0x1e, 0x05, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x06, 0x2a, 0x1a, 0x14, 0x24,
+    0x02, 0x39, 0x09, 0x0c, 0x03, 0x06, 0x09, 0x68, 0x67, 0x35, 0x6a, 0x38,
+    0x0d, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x20, 0x44, 0x44, 0x43, 0x1e, 0x09,
+    0x12, 0x08, 0x4d, 0x96, 0x4a, 0x0b, 0x0c, 0x03, 0x08, 0x09, 0x3c, 0x78,
+    0x3d, 0x48, 0x91, 0x4d, 0x09, 0x0a, 0x09, 0x08, 0x61, 0xb3, 0x59, 0x43,
+    0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf5, 0xff, 0xe6, 0x01, 0x51,
+    0x02, 0x7e, 0x00, 0x3c, 0x00, 0x7f, 0xba, 0x00, 0x23, 0x00, 0x35, 0x00,
+    0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x23, 0x00, 0x16, 0x00, 0x23,
+    0x00, 0x26, 0x00, 0x23, 0x00, 0x36, 0x00, 0x23, 0x00, 0x46, 0x00, 0x23,
+    0x00, 0x56, 0x00, 0x23, 0x00, 0x66, 0x00, 0x23, 0x00, 0x76, 0x00, 0x23,
+    0x00, 0x86, 0x00, 0x23, 0x00, 0x96, 0x00, 0x23, 0x00, 0xa6, 0x00, 0x23,
+    0x00, 0xb6, 0x00, 0x23, 0x00, 0xc6, 0x00, 0x23, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x23, 0x00, 0xe5, 0x00, 0x23, 0x00, 0x02, 0x5d,
+    0xba, 0x00, 0x0d, 0x00, 0x35, 0x00, 0x23, 0x11, 0x12, 0x39, 0xb8, 0x00,
+    0x23, 0x10, 0xb8, 0x00, 0x20, 0xd0, 0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00,
+    0x35, 0x10, 0xb8, 0x00, 0x32, 0xd0, 0xb8, 0x00, 0x32, 0x2f, 0x00, 0xb8,
+    0x00, 0x26, 0x2f, 0xb8, 0x00, 0x29, 0x2f, 0xb8, 0x00, 0x2c, 0x2f, 0x30,
+    0x31, 0x03, 0x26, 0x3e, 0x01, 0x32, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01,
+    0x17, 0x36, 0x17, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x1e,
+    0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x23, 0x1e, 0x01,
+    0x07, 0x0e, 0x01, 0x07, 0x15, 0x26, 0x23, 0x22, 0x06, 0x07, 0x35, 0x34,
+    0x37, 0x3e, 0x01, 0x37, 0x36, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x03,
+    0x05, 0x06, 0x02, 0x0a, 0x10, 0x08, 0x22, 0x24, 0x11, 0x05, 0x0a, 0x07,
+    0x0c, 0x07, 0x0b, 0x17, 0x0b, 0x19, 0x2e, 0x1d, 0x07, 0x10, 0x0c, 0x04,
+    0x06, 0x26, 0x3d, 0x23, 0x08, 0x10, 0x0b, 0x01, 0x02, 0x02, 0x06, 0x04,
+    0x02, 0x0b, 0x04, 0x02, 0x04, 0x08, 0x11, 0x09, 0x02, 0x04, 0x09, 0x02,
+    0x03, 0x06, 0x01, 0x0a, 0x0c, 0x07, 0x0d, 0x12, 0x13, 0x19, 0x02, 0x5c,
+    0x09, 0x10, 0x09, 0x07, 0x2d, 0x65, 0x36, 0x0e, 0x1e, 0x0e, 0x03, 0x08,
+    0x14, 0x23, 0x13, 0x2a, 0x54, 0x28, 0x08, 0x02, 0x08, 0x10, 0x09, 0x35,
+    0x72, 0x37, 0x0d, 0x1b, 0x0b, 0x01, 0x3a, 0x74, 0x3a, 0x1a, 0x33, 0x1a,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x05, 0x06, 0x17, 0x2b, 0x17, 0x3c, 0x77,
+    0x3c, 0x0b, 0x20, 0x0e, 0x1c, 0x3c, 0x3b, 0x38, 0x00, 0x02, 0x00, 0x0c,
+    0x00, 0x07, 0x01, 0x85, 0x02, 0x7d, 0x00, 0x4c, 0x00, 0x50, 0x00, 0x49,
+    0x00, 0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x09, 0x2f, 0xb8, 0x00, 0x3e,
+    0x2f, 0xb8, 0x00, 0x47, 0x2f, 0xb8, 0x00, 0x4a, 0x2f, 0xba, 0x00, 0x12,
+    0x00, 0x4a, 0x00, 0x09, 0x11, 0x12, 0x39, 0xba, 0x00, 0x16, 0x00, 0x4a,
+    0x00, 0x09, 0x11, 0x12, 0x39, 0xba, 0x00, 0x21, 0x00, 0x4a, 0x00, 0x09,
+    0x11, 0x12, 0x39, 0xba, 0x00, 0x42, 0x00, 0x4a, 0x00, 0x09, 0x11, 0x12,
+    0x39, 0xba, 0x00, 0x4d, 0x00, 0x4a, 0x00, 0x09, 0x11, 0x12, 0x39, 0x30,
+    0x31, 0x37, 0x2e, 0x01, 0x27, 0x26, 0x37, 0x35, 0x33, 0x35, 0x37, 0x1e,
+    0x01, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x26, 0x27, 0x1e, 0x01, 0x1f, 0x01,
+    0x3e, 0x01, 0x3f, 0x01, 0x1f, 0x01, 0x1e, 0x03, 0x17, 0x3e, 0x03, 0x37,
+    0x1e, 0x01, 0x17, 0x30, 0x17, 0x16, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x0e,
+    0x01, 0x3d, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07,
+    0x27, 0x2e, 0x01, 0x27, 0x0e, 0x03, 0x07, 0x15, 0x23, 0x07, 0x2e, 0x01,
+    0x37, 0x26, 0x17, 0x14, 0x58, 0x11, 0x1f, 0x17, 0x05, 0x01, 0x01, 0x26,
+    0x04, 0x03, 0x02, 0x0f, 0x1a, 0x0b, 0x01, 0x02, 0x01, 0x06, 0x0b, 0x08,
+    0x09, 0x05, 0x0d, 0x09, 0x18, 0x13, 0x0e, 0x09, 0x0e, 0x0c, 0x0d, 0x0a,
+    0x0d, 0x02, 0x04, 0x11, 0x1b, 0x0a, 0x12, 0x09, 0x01, 0x01, 0x06, 0x06,
+    0x07, 0x05, 0x03, 0x01, 0x01, 0x09, 0x04, 0x03, 0x02, 0x0a, 0x0c, 0x02,
+    0x12, 0x06, 0x1c, 0x15, 0x17, 0x14, 0x07, 0x08, 0x06, 0x07, 0x05, 0x04,
+    0x24, 0x05, 0x1b, 0x0e, 0x02, 0x01, 0xce, 0x67, 0xcb, 0x65, 0x07, 0x08,
+    0x02, 0x04, 0x03, 0x0e, 0x1a, 0x0e, 0x48, 0x8c, 0x49, 0x04, 0x0f, 0x07,
+    0x26, 0x4a, 0x25, 0x29, 0x1e, 0x3b, 0x1e, 0x10, 0x02, 0x0d, 0x16, 0x2e,
+    0x2e, 0x2e, 0x15, 0x3f, 0x89, 0x8a, 0x85, 0x3b, 0x01, 0x01, 0x02, 0x02,
+    0x0c, 0x08, 0x0f, 0x20, 0x10, 0x0e, 0x02, 0x0b, 0x02, 0x01, 0x45, 0x89,
+    0x46, 0x2e, 0x59, 0x2d, 0x08, 0x07, 0x03, 0x08, 0x2f, 0x61, 0x2f, 0x1a,
+    0x28, 0x2b, 0x33, 0x25, 0x01, 0x02, 0x33, 0x62, 0xa0, 0x06, 0x01, 0x04,
+    0x00, 0x01, 0x00, 0x10, 0xff, 0xe5, 0x01, 0x20, 0x02, 0x53, 0x00, 0x33,
+    0x00, 0x00, 0x13, 0x32, 0x17, 0x16, 0x3e, 0x01, 0x16, 0x17, 0x1e, 0x01,
+    0x17, 0x0e, 0x03, 0x07, 0x0e, 0x01, 0x07, 0x16, 0x3e, 0x02, 0x37, 0x1e,
+    0x01, 0x07, 0x0e, 0x03, 0x27, 0x06, 0x26, 0x27, 0x3e, 0x01, 0x37, 0x3e,
+    0x03, 0x37, 0x26, 0x0e, 0x02, 0x27, 0x22, 0x27, 0x37, 0x33, 0x1b, 0x02,
+    0x06, 0x1c, 0x3b, 0x3a, 0x39, 0x1a, 0x02, 0x02, 0x01, 0x18, 0x18, 0x0d,
+    0x09, 0x09, 0x1c, 0x32, 0x08, 0x06, 0x30, 0x37, 0x2f, 0x06, 0x13, 0x04,
+    0x11, 0x0e, 0x2d, 0x32, 0x32, 0x12, 0x08, 0x14, 0x05, 0x07, 0x35, 0x1f,
+    0x09, 0x0a, 0x0c, 0x11, 0x10, 0x17, 0x31, 0x32, 0x32, 0x17, 0x03, 0x02,
+    0x07, 0x04, 0x02, 0x51, 0x02, 0x03, 0x05, 0x02, 0x06, 0x0c, 0x09, 0x12,
+    0x09, 0x0f, 0x25, 0x2d, 0x34, 0x1c, 0x56, 0xa9, 0x5a, 0x06, 0x02, 0x06,
+    0x07, 0x01, 0x02, 0x1e, 0x08, 0x01, 0x08, 0x06, 0x01, 0x07, 0x07, 0x07,
+    0x0c, 0x66, 0xbe, 0x61, 0x1b, 0x2f, 0x2a, 0x25, 0x10, 0x04, 0x01, 0x03,
+    0x01, 0x04, 0x01, 0x27, 0x00, 0x01, 0x00, 0x06, 0xff, 0xfe, 0x00, 0xa5,
+    0x02, 0x75, 0x00, 0x19, 0x00, 0x58, 0xba, 0x00, 0x09, 0x00, 0x0e, 0x00,
+    0x03, 0x2b, 0x41, 0x05, 0x00, 0xda, 0x00, 0x0e, 0x00, 0xea, 0x00, 0x0e,
+    0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x19, 0x00,
+    0x0e, 0x00, 0x29, 0x00, 0x0e, 0x00, 0x39, 0x00, 0x0e, 0x00, 0x49, 0x00,
+    0x0e, 0x00, 0x59, 0x00, 0x0e, 0x00, 0x69, 0x00, 0x0e, 0x00, 0x79, 0x00,
+    0x0e, 0x00, 0x89, 0x00, 0x0e, 0x00, 0x99, 0x00, 0x0e, 0x00, 0xa9, 0x00,
+    0x0e, 0x00, 0xb9, 0x00, 0x0e, 0x00, 0xc9, 0x00, 0x0e, 0x00, 0x0d, 0x5d,
+    0xb8, 0x00, 0x09, 0x10, 0xb8, 0x00, 0x1b, 0xdc, 0x30, 0x31, 0x13, 0x1e,
+    0x01, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x0e, 0x01, 0x22, 0x26,
+    0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x3e, 0x01,
+    0x2e, 0x02, 0x11, 0x08, 0x06, 0x08, 0x04, 0x1a, 0x2b, 0x05, 0x03, 0x0c,
+    0x0d, 0x0b, 0x01, 0x05, 0x2a, 0x19, 0x05, 0x06, 0x06, 0x08, 0x14, 0x02,
+    0x03, 0x1f, 0x02, 0x63, 0x14, 0x27, 0x14, 0x12, 0x28, 0x12, 0x6e, 0xd9,
+    0x72, 0x08, 0x09, 0x0a, 0x09, 0x6f, 0xd3, 0x6b, 0x11, 0x23, 0x11, 0x18,
+    0x2c, 0x18, 0x12, 0x04, 0x00, 0x01, 0x00, 0x07, 0xff, 0xef, 0x00, 0xf8,
+    0x02, 0x6d, 0x00, 0x3c, 0x00, 0x55, 0xba, 0x00, 0x2e, 0x00, 0x09, 0x00,
+    0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x2e, 0x00, 0x16, 0x00, 0x2e,
+    0x00, 0x26, 0x00, 0x2e, 0x00, 0x36, 0x00, 0x2e, 0x00, 0x46, 0x00, 0x2e,
+    0x00, 0x56, 0x00, 0x2e, 0x00, 0x66, 0x00, 0x2e, 0x00, 0x76, 0x00, 0x2e,
+    0x00, 0x86, 0x00, 0x2e, 0x00, 0x96, 0x00, 0x2e, 0x00, 0xa6, 0x00, 0x2e,
+    0x00, 0xb6, 0x00, 0x2e, 0x00, 0xc6, 0x00, 0x2e, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x2e, 0x00, 0xe5, 0x00, 0x2e, 0x00, 0x02, 0x5d,
+    0x00, 0xb8, 0x00, 0x20, 0x2f, 0x30, 0x31, 0x17, 0x06, 0x2e, 0x01, 0x36,
+    0x3f, 0x01, 0x26, 0x36, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x0e,
+    0x03, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01,
+    0x3f, 0x01, 0x1e, 0x01, 0x07, 0x0e, 0x01, 0x27, 0x0e, 0x02, 0x14, 0x15,
+    0x1e, 0x01, 0x17, 0x16, 0x06, 0x1f, 0x01, 0x3e, 0x01, 0x33, 0x1e, 0x01,
+    0x14, 0x06, 0x07, 0x22, 0x06, 0x2a, 0x0a, 0x0c, 0x02, 0x08, 0x0a, 0x48,
+    0x0d, 0x04, 0x04, 0x03, 0x0d, 0x04, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05,
+    0x06, 0x06, 0x06, 0x0f, 0x0c, 0x07, 0x03, 0x08, 0x1d, 0x0b, 0x08, 0x0b,
+    0x06, 0x1c, 0x0b, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02,
+    0x11, 0x04, 0x04, 0x04, 0x0c, 0x03, 0x14, 0x25, 0x14, 0x0b, 0x0a, 0x0b,
+    0x0a, 0x2e, 0x5c, 0x10, 0x01, 0x0b, 0x0e, 0x0e, 0x02, 0x06, 0x39, 0x72,
+    0x3a, 0x2d, 0x58, 0x2d, 0x1a, 0x30, 0x19, 0x03, 0x04, 0x04, 0x05, 0x04,
+    0x09, 0x05, 0x06, 0x0f, 0x0a, 0x0e, 0x12, 0x0b, 0x08, 0x16, 0x09, 0x06,
+    0x08, 0x15, 0x0b, 0x04, 0x0e, 0x01, 0x0b, 0x12, 0x11, 0x14, 0x0e, 0x38,
+    0x6e, 0x38, 0x39, 0x70, 0x37, 0x04, 0x02, 0x02, 0x01, 0x0c, 0x0e, 0x0c,
+    0x01, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x19, 0x01, 0x21,
+    0x02, 0x68, 0x00, 0x27, 0x00, 0x19, 0x00, 0xb8, 0x00, 0x1a, 0x2f, 0xba,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x03, 0x2b, 0xba, 0x00, 0x13, 0x00, 0x17,
+    0x00, 0x16, 0x11, 0x12, 0x39, 0x30, 0x31, 0x13, 0x0e, 0x01, 0x2e, 0x01,
+    0x37, 0x3e, 0x02, 0x32, 0x1e, 0x01, 0x17, 0x16, 0x0e, 0x04, 0x07, 0x3e,
+    0x01, 0x33, 0x15, 0x22, 0x06, 0x07, 0x27, 0x3e, 0x03, 0x37, 0x36, 0x2e,
+    0x02, 0x07, 0x0e, 0x01, 0x2b, 0x06, 0x0f, 0x0c, 0x07, 0x03, 0x0c, 0x31,
+    0x3b, 0x3f, 0x33, 0x22, 0x01, 0x01, 0x12, 0x1e, 0x26, 0x27, 0x23, 0x0c,
+    0x2e, 0x5b, 0x30, 0x34, 0x68, 0x34, 0x18, 0x0c, 0x37, 0x3a, 0x30, 0x05,
+    0x03, 0x0e, 0x22, 0x35, 0x24, 0x16, 0x1b, 0x01, 0xfb, 0x09, 0x05, 0x06,
+    0x0f, 0x0a, 0x1d, 0x29, 0x16, 0x19, 0x32, 0x28, 0x2e, 0x4e, 0x46, 0x41,
+    0x42, 0x45, 0x26, 0x05, 0x07, 0x28, 0x07, 0x09, 0x17, 0x37, 0x61, 0x60,
+    0x63, 0x38, 0x24, 0x39, 0x1f, 0x03, 0x10, 0x0a, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xf4, 0xff, 0xfa, 0x01, 0x07, 0x02, 0x69, 0x00, 0x3d,
+    0x00, 0x00, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x16, 0x0e, 0x02, 0x0f, 0x01,
+    0x1e, 0x03, 0x17, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x2e, 0x01,
+    0x27, 0x2e, 0x01, 0x3e, 0x01, 0x17, 0x1e, 0x02, 0x36, 0x37, 0x3e, 0x01,
+    0x2e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x3e, 0x01, 0x37, 0x3e, 0x03,
+    0x27, 0x2e, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0b, 0x06, 0x34,
+    0x3e, 0x39, 0x0b, 0x0e, 0x03, 0x16, 0x26, 0x15, 0x10, 0x1d, 0x33, 0x27,
+    0x18, 0x03, 0x02, 0x02, 0x08, 0x13, 0x13, 0x19, 0x34, 0x35, 0x36, 0x1b,
+    0x0a, 0x08, 0x02, 0x0c, 0x0b, 0x10, 0x33, 0x35, 0x30, 0x0d, 0x1c, 0x02,
+    0x1e, 0x34, 0x19, 0x10, 0x22, 0x13, 0x06, 0x11, 0x20, 0x0e, 0x0b, 0x1f,
+    0x17, 0x07, 0x0d, 0x08, 0x16, 0x19, 0x18, 0x09, 0x09, 0x08, 0x09, 0x02,
+    0x34, 0x0f, 0x1b, 0x0b, 0x09, 0x14, 0x17, 0x40, 0x40, 0x37, 0x0d, 0x0a,
+    0x0d, 0x2b, 0x35, 0x3d, 0x1f, 0x12, 0x29, 0x27, 0x23, 0x0b, 0x0f, 0x05,
+    0x08, 0x0c, 0x03, 0x03, 0x0e, 0x0d, 0x0a, 0x01, 0x02, 0x0c, 0x09, 0x02,
+    0x0c, 0x1a, 0x4e, 0x4f, 0x45, 0x11, 0x0b, 0x07, 0x02, 0x26, 0x05, 0x0a,
+    0x0c, 0x0a, 0x2b, 0x32, 0x31, 0x0f, 0x09, 0x04, 0x06, 0x0b, 0x04, 0x04,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0d, 0xff, 0xe0, 0x01, 0x03,
+    0x02, 0x67, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x90, 0xba, 0x00, 0x15, 0x00,
+    0x2b, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x15, 0x00, 0x16,
+    0x00, 0x15, 0x00, 0x26, 0x00, 0x15, 0x00, 0x36, 0x00, 0x15, 0x00, 0x46,
+    0x00, 0x15, 0x00, 0x56, 0x00, 0x15, 0x00, 0x66, 0x00, 0x15, 0x00, 0x76,
+    0x00, 0x15, 0x00, 0x86, 0x00, 0x15, 0x00, 0x96, 0x00, 0x15, 0x00, 0xa6,
+    0x00, 0x15, 0x00, 0xb6, 0x00, 0x15, 0x00, 0xc6, 0x00, 0x15, 0x00, 0x0d,
+    0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x15, 0x00, 0xe5, 0x00, 0x15, 0x00,
+    0x02, 0x5d, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x00, 0xdc, 0xb8, 0x00,
+    0x06, 0xdc, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x12, 0xd0, 0xb8, 0x00,
+    0x12, 0x2f, 0xb8, 0x00, 0x15, 0x10, 0xb8, 0x00, 0x22, 0xdc, 0xb8, 0x00,
+    0x25, 0xd0, 0xb8, 0x00, 0x25, 0x2f, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
+    0x30, 0xd0, 0xb8, 0x00, 0x30, 0x2f, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00,
+    0x33, 0xd0, 0xb8, 0x00, 0x33, 0x2f, 0x30, 0x31, 0x13, 0x36, 0x16, 0x17,
+    0x1e, 0x01, 0x17, 0x0e, 0x01, 0x07, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x07,
+    0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x14, 0x06, 0x1e, 0x01, 0x17, 0x16,
+    0x06, 0x27, 0x2e, 0x02, 0x36, 0x35, 0x3e, 0x01, 0x37, 0x0e, 0x01, 0x27,
+    0x2e, 0x01, 0x27, 0x26, 0x3e, 0x02, 0x17, 0x3e, 0x01, 0x37, 0x0e, 0x01,
+    0x07, 0x0e, 0x01, 0x07, 0x16, 0x36, 0xa6, 0x08, 0x15, 0x05, 0x04, 0x06,
+    0x01, 0x02, 0x06, 0x03, 0x0b, 0x12, 0x07, 0x13, 0x04, 0x11, 0x0b, 0x16,
+    0x0b, 0x02, 0x04, 0x01, 0x02, 0x01, 0x07, 0x0a, 0x08, 0x16, 0x10, 0x0f,
+    0x0b, 0x03, 0x03, 0x01, 0x04, 0x02, 0x22, 0x44, 0x1e, 0x02, 0x06, 0x03,
+    0x02, 0x26, 0x34, 0x34, 0x05, 0x02, 0x04, 0x02, 0x13, 0x2c, 0x13, 0x08,
+    0x0e, 0x08, 0x0e, 0x3a, 0x02, 0x5d, 0x0a, 0x02, 0x08, 0x02, 0x09, 0x07,
+    0x2e, 0x5a, 0x2e, 0x02, 0x04, 0x01, 0x02, 0x1e, 0x08, 0x02, 0x04, 0x02,
+    0x30, 0x5c, 0x30, 0x0b, 0x31, 0x36, 0x30, 0x09, 0x11, 0x14, 0x0a, 0x0e,
+    0x34, 0x3a, 0x37, 0x11, 0x2d, 0x5a, 0x2d, 0x08, 0x07, 0x0f, 0x04, 0x07,
+    0x04, 0x1c, 0x3d, 0x3d, 0x3b, 0xb6, 0x22, 0x42, 0x21, 0x19, 0x2f, 0x18,
+    0x0c, 0x19, 0x0c, 0x05, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06,
+    0xff, 0xf7, 0x01, 0x09, 0x02, 0x78, 0x00, 0x41, 0x00, 0x00, 0x13, 0x1e,
+    0x01, 0x14, 0x06, 0x07, 0x22, 0x06, 0x07, 0x06, 0x26, 0x07, 0x0e, 0x01,
+    0x1e, 0x01, 0x17, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x16, 0x17, 0x16, 0x0e,
+    0x04, 0x2f, 0x02, 0x3e, 0x02, 0x16, 0x1f, 0x01, 0x16, 0x3e, 0x02, 0x37,
+    0x34, 0x2e, 0x02, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x02, 0x36,
+    0x37, 0x3e, 0x01, 0x32, 0x16, 0x37, 0x3e, 0x01, 0xd2, 0x0b, 0x0a, 0x0b,
+    0x0a, 0x15, 0x2a, 0x16, 0x11, 0x26, 0x11, 0x05, 0x02, 0x05, 0x0a, 0x06,
+    0x07, 0x08, 0x19, 0x09, 0x28, 0x4a, 0x16, 0x0d, 0x04, 0x18, 0x27, 0x2d,
+    0x2e, 0x12, 0x12, 0x06, 0x01, 0x09, 0x0c, 0x0d, 0x04, 0x04, 0x0a, 0x26,
+    0x25, 0x1c, 0x01, 0x1b, 0x26, 0x2a, 0x0f, 0x14, 0x1a, 0x11, 0x0a, 0x03,
+    0x03, 0x09, 0x06, 0x01, 0x09, 0x07, 0x1e, 0x23, 0x23, 0x0d, 0x13, 0x24,
+    0x02, 0x78, 0x01, 0x0c, 0x0e, 0x0c, 0x01, 0x0b, 0x01, 0x01, 0x06, 0x06,
+    0x1d, 0x52, 0x58, 0x56, 0x21, 0x07, 0x07, 0x05, 0x01, 0x02, 0x2d, 0x20,
+    0x13, 0x30, 0x32, 0x2f, 0x22, 0x11, 0x06, 0x11, 0x19, 0x09, 0x0c, 0x03,
+    0x06, 0x09, 0x0f, 0x05, 0x1f, 0x2e, 0x31, 0x0c, 0x12, 0x1e, 0x14, 0x07,
+    0x04, 0x15, 0x09, 0x11, 0x25, 0x1a, 0x16, 0x59, 0x5f, 0x55, 0x13, 0x0f,
+    0x0b, 0x04, 0x01, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfe,
+    0x00, 0x01, 0x01, 0x0e, 0x02, 0x88, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x00,
+    0x13, 0x3e, 0x02, 0x16, 0x17, 0x0e, 0x03, 0x07, 0x0e, 0x01, 0x07, 0x36,
+    0x37, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x07, 0x0e, 0x03, 0x2e, 0x01,
+    0x27, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x03, 0x06, 0x23, 0x1c, 0x01, 0x17,
+    0x1e, 0x03, 0x37, 0x36, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x2e, 0x02, 0x07,
+    0x0e, 0x01, 0x48, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x03, 0x10, 0x13, 0x14,
+    0x06, 0x04, 0x03, 0x01, 0x0a, 0x0a, 0x15, 0x43, 0x3f, 0x31, 0x03, 0x02,
+    0x05, 0x05, 0x10, 0x2e, 0x32, 0x34, 0x2e, 0x25, 0x09, 0x0b, 0x03, 0x11,
+    0x0e, 0x24, 0x15, 0x04, 0x02, 0x01, 0x01, 0x06, 0x0d, 0x18, 0x13, 0x17,
+    0x13, 0x07, 0x18, 0x19, 0x14, 0x03, 0x06, 0x21, 0x33, 0x37, 0x12, 0x08,
+    0x0c, 0x02, 0x71, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x24, 0x44, 0x44, 0x44,
+    0x23, 0x13, 0x26, 0x14, 0x07, 0x04, 0x0b, 0x07, 0x1b, 0x2c, 0x1a, 0x0b,
+    0x16, 0x0a, 0x24, 0x3c, 0x27, 0x0e, 0x14, 0x39, 0x34, 0x42, 0x8d, 0x42,
+    0x37, 0x6d, 0xfe, 0xb2, 0x02, 0x08, 0x10, 0x08, 0x0a, 0x35, 0x37, 0x28,
+    0x03, 0x05, 0x0e, 0x06, 0x16, 0x1b, 0x1d, 0x0e, 0x19, 0x26, 0x18, 0x07,
+    0x06, 0x02, 0x0a, 0x00, 0x00, 0x01, 0xff, 0xf2, 0xff, 0xee, 0x00, 0xa9,
+    0x02, 0x86, 0x00, 0x34, 0x00, 0x6f, 0xba, 0x00, 0x17, 0x00, 0x2c, 0x00,
+    0x03, 0x2b, 0x41, 0x05, 0x00, 0xda, 0x00, 0x2c, 0x00, 0xea, 0x00, 0x2c,
+    0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x2c, 0x00, 0x19, 0x00,
+    0x2c, 0x00, 0x29, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x2c, 0x00, 0x49, 0x00,
+    0x2c, 0x00, 0x59, 0x00, 0x2c, 0x00, 0x69, 0x00, 0x2c, 0x00, 0x79, 0x00,
+    0x2c, 0x00, 0x89, 0x00, 0x2c, 0x00, 0x99, 0x00, 0x2c, 0x00, 0xa9, 0x00,
+    0x2c, 0x00, 0xb9, 0x00, 0x2c, 0x00, 0xc9, 0x00, 0x2c, 0x00, 0x0d, 0x5d,
+    0xb8, 0x00, 0x2c, 0x10, 0xb8, 0x00, 0x2f, 0xd0, 0xb8, 0x00, 0x2f, 0x2f,
+    0xba, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x17, 0x11, 0x12, 0x39, 0x00, 0xb8,
+    0x00, 0x1a, 0x2f, 0xb8, 0x00, 0x1d, 0x2f, 0x30, 0x31, 0x13, 0x06, 0x2e,
+    0x01, 0x36, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x01, 0x17, 0x0e, 0x03, 0x07,
+    0x0e, 0x03, 0x07, 0x0e, 0x01, 0x07, 0x2e, 0x01, 0x27, 0x34, 0x26, 0x35,
+    0x34, 0x37, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x37, 0x36, 0x26, 0x37, 0x3e,
+    0x01, 0x37, 0x0e, 0x01, 0x0a, 0x0a, 0x0c, 0x02, 0x08, 0x0a, 0x12, 0x26,
+    0x27, 0x26, 0x12, 0x04, 0x06, 0x04, 0x05, 0x05, 0x03, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x02, 0x01, 0x02, 0x05, 0x13, 0x0a, 0x13, 0x0a, 0x01, 0x07,
+    0x06, 0x07, 0x04, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x02, 0x03, 0x01,
+    0x04, 0x01, 0x02, 0x02, 0x1c, 0x3a, 0x02, 0x46, 0x01, 0x0b, 0x0e, 0x0e,
+    0x02, 0x02, 0x0a, 0x08, 0x04, 0x04, 0x06, 0x0d, 0x07, 0x15, 0x29, 0x2c,
+    0x31, 0x1e, 0x20, 0x31, 0x2d, 0x2d, 0x1b, 0x3d, 0x82, 0x3c, 0x02, 0x01,
+    0x01, 0x03, 0x05, 0x03, 0x0a, 0x07, 0x18, 0x38, 0x39, 0x38, 0x17, 0x1b,
+    0x2d, 0x2d, 0x31, 0x20, 0x27, 0x4e, 0x26, 0x05, 0x0b, 0x05, 0x02, 0x10,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x01, 0x00, 0x02, 0x63, 0x00, 0x31,
+    0x00, 0x48, 0x00, 0x5c, 0x00, 0x00, 0x13, 0x33, 0x1e, 0x01, 0x17, 0x1e,
+    0x01, 0x17, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x06, 0x07, 0x16, 0x15, 0x1e,
+    0x03, 0x07, 0x0e, 0x03, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x02, 0x36, 0x37,
+    0x3e, 0x01, 0x3f, 0x01, 0x27, 0x2e, 0x02, 0x3e, 0x02, 0x17, 0x1e, 0x01,
+    0x17, 0x03, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x1e, 0x01, 0x17, 0x16, 0x36,
+    0x17, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27,
+    0x03, 0x26, 0x27, 0x22, 0x2f, 0x01, 0x0e, 0x02, 0x1e, 0x02, 0x37, 0x3e,
+    0x02, 0x26, 0x27, 0x2e, 0x01, 0x86, 0x02, 0x0a, 0x12, 0x0a, 0x0a, 0x10,
+    0x08, 0x17, 0x0f, 0x07, 0x1a, 0x12, 0x13, 0x14, 0x01, 0x13, 0x24, 0x1b,
+    0x11, 0x01, 0x01, 0x21, 0x30, 0x38, 0x18, 0x0c, 0x19, 0x07, 0x09, 0x15,
+    0x0c, 0x03, 0x0e, 0x0a, 0x11, 0x11, 0x12, 0x0c, 0x1f, 0x20, 0x08, 0x0d,
+    0x1c, 0x25, 0x14, 0x07, 0x0d, 0x07, 0x06, 0x09, 0x11, 0x08, 0x1a, 0x0f,
+    0x0b, 0x22, 0x18, 0x08, 0x12, 0x09, 0x0b, 0x17, 0x0b, 0x0e, 0x08, 0x04,
+    0x0e, 0x07, 0x08, 0x19, 0x08, 0x17, 0x04, 0x06, 0x03, 0x02, 0x10, 0x12,
+    0x1b, 0x0d, 0x03, 0x15, 0x2a, 0x21, 0x1c, 0x20, 0x06, 0x15, 0x18, 0x08,
+    0x0f, 0x02, 0x50, 0x02, 0x03, 0x03, 0x02, 0x0f, 0x06, 0x11, 0x31, 0x34,
+    0x30, 0x0f, 0x0e, 0x03, 0x03, 0x06, 0x1a, 0x32, 0x34, 0x3a, 0x22, 0x19,
+    0x38, 0x26, 0x08, 0x16, 0x0b, 0x16, 0x0e, 0x15, 0x3a, 0x3e, 0x3b, 0x16,
+    0x10, 0x24, 0x07, 0x06, 0x02, 0x04, 0x2a, 0x39, 0x3e, 0x33, 0x1e, 0x05,
+    0x02, 0x05, 0x03, 0xfe, 0xf9, 0x02, 0x05, 0x05, 0x12, 0x4a, 0x51, 0x47,
+    0x0f, 0x05, 0x01, 0x02, 0x08, 0x10, 0x08, 0x0c, 0x26, 0x2a, 0x28, 0x0d,
+    0x10, 0x21, 0x0c, 0x01, 0x03, 0x01, 0x04, 0x01, 0x06, 0x0a, 0x21, 0x25,
+    0x26, 0x1e, 0x12, 0x02, 0x02, 0x26, 0x30, 0x2f, 0x0a, 0x04, 0x01, 0x00,
+    0x00, 0x01, 0xff, 0xfb, 0x00, 0x06, 0x00, 0xd0, 0x02, 0x60, 0x00, 0x39,
+    0x00, 0x6e, 0xba, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x03, 0x2b, 0x41, 0x05,
+    0x00, 0xda, 0x00, 0x2a, 0x00, 0xea, 0x00, 0x2a, 0x00, 0x02, 0x5d, 0x41,
+    0x1b, 0x00, 0x09, 0x00, 0x2a, 0x00, 0x19, 0x00, 0x2a, 0x00, 0x29, 0x00,
+    0x2a, 0x00, 0x39, 0x00, 0x2a, 0x00, 0x49, 0x00, 0x2a, 0x00, 0x59, 0x00,
+    0x2a, 0x00, 0x69, 0x00, 0x2a, 0x00, 0x79, 0x00, 0x2a, 0x00, 0x89, 0x00,
+    0x2a, 0x00, 0x99, 0x00, 0x2a, 0x00, 0xa9, 0x00, 0x2a, 0x00, 0xb9, 0x00,
+    0x2a, 0x00, 0xc9, 0x00, 0x2a, 0x00, 0x0d, 0x5d, 0xba, 0x00, 0x1b, 0x00,
+    0x2a, 0x00, 0x16, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x2a, 0x10, 0xb8, 0x00,
+    0x2d, 0xd0, 0xb8, 0x00, 0x2d, 0x2f, 0xb8, 0x00, 0x16, 0x10, 0xb8, 0x00,
+    0x3b, 0xdc, 0x30, 0x31, 0x13, 0x16, 0x06, 0x27, 0x2e, 0x01, 0x07, 0x0e,
+    0x02, 0x14, 0x1e, 0x01, 0x37, 0x36, 0x37, 0x17, 0x07, 0x0e, 0x03, 0x07,
+    0x0e, 0x01, 0x17, 0x26, 0x27, 0x1e, 0x01, 0x0e, 0x01, 0x27, 0x2e, 0x02,
+    0x36, 0x35, 0x3e, 0x03, 0x35, 0x3e, 0x01, 0x37, 0x07, 0x06, 0x23, 0x2e,
+    0x03, 0x37, 0x36, 0x37, 0x36, 0x16, 0xc8, 0x08, 0x16, 0x10, 0x06, 0x13,
+    0x08, 0x21, 0x2c, 0x15, 0x14, 0x28, 0x1d, 0x19, 0x11, 0x21, 0x02, 0x02,
+    0x02, 0x03, 0x03, 0x01, 0x02, 0x08, 0x0b, 0x05, 0x04, 0x09, 0x06, 0x04,
+    0x0f, 0x0a, 0x0c, 0x0b, 0x03, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02,
+    0x03, 0x14, 0x1c, 0x1d, 0x18, 0x26, 0x16, 0x01, 0x0e, 0x2c, 0x4f, 0x14,
+    0x22, 0x02, 0x4b, 0x11, 0x14, 0x0a, 0x06, 0x01, 0x01, 0x03, 0x1b, 0x22,
+    0x22, 0x15, 0x03, 0x0e, 0x0c, 0x14, 0x16, 0x0b, 0x0b, 0x2b, 0x35, 0x37,
+    0x17, 0x3a, 0x73, 0x3b, 0x04, 0x02, 0x05, 0x0e, 0x0e, 0x07, 0x03, 0x06,
+    0x26, 0x2c, 0x2a, 0x0b, 0x1c, 0x25, 0x1e, 0x1d, 0x16, 0x21, 0x42, 0x21,
+    0x0a, 0x0b, 0x01, 0x16, 0x23, 0x2c, 0x17, 0x43, 0x07, 0x02, 0x07, 0x00,
+    0x00, 0x02, 0xff, 0xfb, 0xff, 0xdc, 0x01, 0x10, 0x02, 0x52, 0x00, 0x2a,
+    0x00, 0x43, 0x00, 0x00, 0x13, 0x36, 0x1e, 0x01, 0x06, 0x07, 0x0e, 0x01,
+    0x07, 0x1e, 0x01, 0x17, 0x1e, 0x03, 0x17, 0x16, 0x14, 0x0e, 0x01, 0x07,
+    0x0e, 0x01, 0x07, 0x06, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x03, 0x37, 0x3e,
+    0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x17, 0x2e, 0x01, 0x27, 0x22,
+    0x15, 0x0e, 0x02, 0x16, 0x17, 0x1e, 0x03, 0x37, 0x3e, 0x03, 0x27, 0x2e,
+    0x03, 0x81, 0x09, 0x10, 0x08, 0x01, 0x08, 0x06, 0x0d, 0x07, 0x28, 0x29,
+    0x12, 0x0c, 0x0c, 0x08, 0x07, 0x05, 0x02, 0x07, 0x12, 0x10, 0x0e, 0x1b,
+    0x0f, 0x07, 0x05, 0x13, 0x28, 0x0e, 0x23, 0x27, 0x12, 0x03, 0x02, 0x02,
+    0x0a, 0x0d, 0x0a, 0x14, 0x0b, 0x0b, 0x26, 0x05, 0x04, 0x0b, 0x05, 0x01,
+    0x1c, 0x1e, 0x0a, 0x08, 0x0a, 0x04, 0x12, 0x1b, 0x28, 0x1b, 0x1b, 0x1e,
+    0x0c, 0x01, 0x01, 0x03, 0x10, 0x1d, 0x28, 0x02, 0x4c, 0x06, 0x04, 0x0b,
+    0x10, 0x07, 0x05, 0x08, 0x05, 0x20, 0x51, 0x33, 0x21, 0x2d, 0x28, 0x2e,
+    0x23, 0x0d, 0x33, 0x37, 0x30, 0x0a, 0x08, 0x0f, 0x07, 0x04, 0x01, 0x03,
+    0x04, 0x0e, 0x26, 0x54, 0x5b, 0x60, 0x32, 0x1d, 0x39, 0x19, 0x14, 0x27,
+    0x14, 0x13, 0x15, 0x4c, 0x05, 0x06, 0x02, 0x01, 0x23, 0x5b, 0x62, 0x61,
+    0x29, 0x12, 0x34, 0x2e, 0x1e, 0x03, 0x04, 0x25, 0x30, 0x34, 0x13, 0x26,
+    0x5b, 0x5c, 0x53, 0x00, 0x00, 0x02, 0x00, 0x10, 0xff, 0xf6, 0x00, 0x5c,
+    0x01, 0xc1, 0x00, 0x0c, 0x00, 0x17, 0x00, 0x0b, 0x00, 0xb8, 0x00, 0x12,
+    0x2f, 0xb8, 0x00, 0x08, 0x2f, 0x30, 0x31, 0x37, 0x36, 0x16, 0x17, 0x1e,
+    0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x3e, 0x01, 0x13, 0x06, 0x2e, 0x01,
+    0x36, 0x37, 0x17, 0x32, 0x1e, 0x01, 0x06, 0x35, 0x0b, 0x0e, 0x02, 0x08,
+    0x04, 0x08, 0x11, 0x0c, 0x12, 0x10, 0x01, 0x11, 0x1c, 0x15, 0x18, 0x06,
+    0x0e, 0x11, 0x0e, 0x0c, 0x0f, 0x03, 0x0b, 0x46, 0x02, 0x08, 0x08, 0x08,
+    0x16, 0x15, 0x0f, 0x16, 0x1c, 0x1a, 0x01, 0x3a, 0x0a, 0x0e, 0x1c, 0x1e,
+    0x07, 0x07, 0x0f, 0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10,
+    0xff, 0xba, 0x00, 0x5b, 0x01, 0xc1, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x07,
+    0x00, 0xb8, 0x00, 0x05, 0x2f, 0x30, 0x31, 0x13, 0x06, 0x2e, 0x01, 0x36,
+    0x37, 0x17, 0x32, 0x1e, 0x01, 0x06, 0x03, 0x3e, 0x02, 0x16, 0x17, 0x16,
+    0x06, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37, 0x36, 0x34, 0x43, 0x15, 0x18,
+    0x06, 0x0e, 0x11, 0x0e, 0x0c, 0x0f, 0x03, 0x0b, 0x24, 0x01, 0x0b, 0x0e,
+    0x0c, 0x02, 0x02, 0x04, 0x15, 0x07, 0x0d, 0x0b, 0x04, 0x02, 0x11, 0x01,
+    0x7c, 0x0a, 0x0e, 0x1c, 0x1e, 0x07, 0x07, 0x0f, 0x14, 0x15, 0xfe, 0xb2,
+    0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x20, 0x3a, 0x1b, 0x06, 0x01, 0x08, 0x0d,
+    0x09, 0x15, 0x2d, 0x00, 0x00, 0x02, 0x00, 0x20, 0xff, 0xf3, 0x00, 0x6f,
+    0x02, 0x76, 0x00, 0x15, 0x00, 0x21, 0x00, 0x50, 0xba, 0x00, 0x0c, 0x00,
+    0x11, 0x00, 0x03, 0x2b, 0x41, 0x05, 0x00, 0xda, 0x00, 0x11, 0x00, 0xea,
+    0x00, 0x11, 0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00, 0x09, 0x00, 0x11, 0x00,
+    0x19, 0x00, 0x11, 0x00, 0x29, 0x00, 0x11, 0x00, 0x39, 0x00, 0x11, 0x00,
+    0x49, 0x00, 0x11, 0x00, 0x59, 0x00, 0x11, 0x00, 0x69, 0x00, 0x11, 0x00,
+    0x79, 0x00, 0x11, 0x00, 0x89, 0x00, 0x11, 0x00, 0x99, 0x00, 0x11, 0x00,
+    0xa9, 0x00, 0x11, 0x00, 0xb9, 0x00, 0x11, 0x00, 0xc9, 0x00, 0x11, 0x00,
+    0x0d, 0x5d, 0x30, 0x31, 0x13, 0x26, 0x3e, 0x01, 0x16, 0x17, 0x1e, 0x03,
+    0x0e, 0x01, 0x15, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x01, 0x2e, 0x01,
+    0x13, 0x16, 0x06, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x3e, 0x01, 0x32, 0x17,
+    0x23, 0x03, 0x04, 0x0b, 0x0f, 0x07, 0x0f, 0x11, 0x09, 0x01, 0x01, 0x04,
+    0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x05, 0x03, 0x0f, 0x30, 0x08, 0x16,
+    0x10, 0x01, 0x02, 0x01, 0x06, 0x02, 0x0a, 0x10, 0x08, 0x02, 0x59, 0x09,
+    0x0e, 0x06, 0x01, 0x06, 0x19, 0x4f, 0x5e, 0x65, 0x5d, 0x4e, 0x18, 0x09,
+    0x0a, 0x09, 0x08, 0x3a, 0x79, 0x78, 0x77, 0xfd, 0xf7, 0x11, 0x14, 0x0a,
+    0x02, 0x01, 0x01, 0x09, 0x10, 0x09, 0x07, 0x00, 0x00, 0x02, 0x00, 0x02,
+    0x01, 0xb0, 0x00, 0x77, 0x02, 0x6a, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0xae,
+    0xb8, 0x00, 0x20, 0x2f, 0xb8, 0x00, 0x10, 0x2f, 0xb8, 0x00, 0x20, 0x10,
+    0xb8, 0x00, 0x00, 0xd0, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x08, 0xdc,
+    0x41, 0x1b, 0x00, 0x06, 0x00, 0x08, 0x00, 0x16, 0x00, 0x08, 0x00, 0x26,
+    0x00, 0x08, 0x00, 0x36, 0x00, 0x08, 0x00, 0x46, 0x00, 0x08, 0x00, 0x56,
+    0x00, 0x08, 0x00, 0x66, 0x00, 0x08, 0x00, 0x76, 0x00, 0x08, 0x00, 0x86,
+    0x00, 0x08, 0x00, 0x96, 0x00, 0x08, 0x00, 0xa6, 0x00, 0x08, 0x00, 0xb6,
+    0x00, 0x08, 0x00, 0xc6, 0x00, 0x08, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00,
+    0xd5, 0x00, 0x08, 0x00, 0xe5, 0x00, 0x08, 0x00, 0x02, 0x5d, 0x41, 0x05,
+    0x00, 0xda, 0x00, 0x10, 0x00, 0xea, 0x00, 0x10, 0x00, 0x02, 0x5d, 0x41,
+    0x1b, 0x00, 0x09, 0x00, 0x10, 0x00, 0x19, 0x00, 0x10, 0x00, 0x29, 0x00,
+    0x10, 0x00, 0x39, 0x00, 0x10, 0x00, 0x49, 0x00, 0x10, 0x00, 0x59, 0x00,
+    0x10, 0x00, 0x69, 0x00, 0x10, 0x00, 0x79, 0x00, 0x10, 0x00, 0x89, 0x00,
+    0x10, 0x00, 0x99, 0x00, 0x10, 0x00, 0xa9, 0x00, 0x10, 0x00, 0xb9, 0x00,
+    0x10, 0x00, 0xc9, 0x00, 0x10, 0x00, 0x0d, 0x5d, 0xb8, 0x00, 0x10, 0x10,
+    0xb8, 0x00, 0x18, 0xdc, 0x30, 0x31, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x1e,
+    0x01, 0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x37, 0x3e, 0x02,
+    0x16, 0x17, 0x1e, 0x01, 0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01,
+    0x02, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x01, 0x06, 0x01, 0x02, 0x0a, 0x0d,
+    0x0c, 0x03, 0x01, 0x06, 0x44, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x01, 0x06,
+    0x01, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x06, 0x02, 0x53, 0x0a, 0x0c,
+    0x01, 0x0a, 0x0b, 0x24, 0x49, 0x25, 0x09, 0x0a, 0x09, 0x08, 0x25, 0x48,
+    0x21, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x1e, 0x3c, 0x1f, 0x09, 0x0a, 0x09,
+    0x08, 0x1e, 0x3d, 0x00, 0x00, 0x02, 0xff, 0xf5, 0x01, 0x27, 0x00, 0xf8,
+    0x02, 0x6f, 0x00, 0x52, 0x00, 0x5a, 0x01, 0x13, 0xb8, 0x00, 0x5b, 0x2f,
+    0xb8, 0x00, 0x14, 0x2f, 0xb8, 0x00, 0x52, 0xdc, 0xb8, 0x00, 0x06, 0xd0,
+    0xb8, 0x00, 0x06, 0x2f, 0xb8, 0x00, 0x5b, 0x10, 0xb8, 0x00, 0x32, 0xd0,
+    0xb8, 0x00, 0x32, 0x2f, 0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00, 0x23, 0x2f,
+    0xb8, 0x00, 0x32, 0x10, 0xb8, 0x00, 0x26, 0xd0, 0xb8, 0x00, 0x26, 0x2f,
+    0xb8, 0x00, 0x32, 0x10, 0xb8, 0x00, 0x30, 0xd0, 0xb8, 0x00, 0x30, 0x2f,
+    0xb8, 0x00, 0x32, 0x10, 0xb8, 0x00, 0x3a, 0xdc, 0x41, 0x1b, 0x00, 0x06,
+    0x00, 0x3a, 0x00, 0x16, 0x00, 0x3a, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x36,
+    0x00, 0x3a, 0x00, 0x46, 0x00, 0x3a, 0x00, 0x56, 0x00, 0x3a, 0x00, 0x66,
+    0x00, 0x3a, 0x00, 0x76, 0x00, 0x3a, 0x00, 0x86, 0x00, 0x3a, 0x00, 0x96,
+    0x00, 0x3a, 0x00, 0xa6, 0x00, 0x3a, 0x00, 0xb6, 0x00, 0x3a, 0x00, 0xc6,
+    0x00, 0x3a, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x3a, 0x00,
+    0xe5, 0x00, 0x3a, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x37, 0xd0, 0xb8, 0x00,
+    0x37, 0x2f, 0xb8, 0x00, 0x14, 0x10, 0xb8, 0x00, 0x3d, 0xd0, 0xb8, 0x00,
+    0x3d, 0x2f, 0xb8, 0x00, 0x52, 0x10, 0xb8, 0x00, 0x44, 0xd0, 0xb8, 0x00,
+    0x44, 0x2f, 0xb8, 0x00, 0x52, 0x10, 0xb8, 0x00, 0x4f, 0xd0, 0xb8, 0x00,
+    0x4f, 0x2f, 0xb8, 0x00, 0x3a, 0x10, 0xb8, 0x00, 0x53, 0xd0, 0xb8, 0x00,
+    0x53, 0x2f, 0xb8, 0x00, 0x3a, 0x10, 0xb8, 0x00, 0x56, 0xd0, 0xb8, 0x00,
+    0x56, 0x2f, 0xb8, 0x00, 0x14, 0x10, 0xb8, 0x00, 0x57, 0xd0, 0xb8, 0x00,
+    0x57, 0x2f, 0xba, 0x00, 0x58, 0x00, 0x14, 0x00, 0x52, 0x11, 0x12, 0x39,
+    0x00, 0xba, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x05,
+    0x10, 0xb8, 0x00, 0x14, 0xd0, 0xb8, 0x00, 0x05, 0x10, 0xb8, 0x00, 0x1c,
+    0xd0, 0xb8, 0x00, 0x00, 0x10, 0xb8, 0x00, 0x22, 0xd0, 0xb8, 0x00, 0x00,
+    0x10, 0xb8, 0x00, 0x56, 0xd0, 0x30, 0x31, 0x13, 0x1e, 0x01, 0x14, 0x06,
+    0x07, 0x23, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x16, 0x14, 0x0e, 0x01, 0x27,
+    0x2e, 0x01, 0x27, 0x23, 0x17, 0x0e, 0x01, 0x22, 0x26, 0x2f, 0x01, 0x23,
+    0x2e, 0x01, 0x34, 0x36, 0x37, 0x33, 0x34, 0x26, 0x27, 0x06, 0x26, 0x2f,
+    0x01, 0x35, 0x3e, 0x01, 0x17, 0x16, 0x37, 0x26, 0x35, 0x3e, 0x02, 0x16,
+    0x17, 0x14, 0x16, 0x17, 0x3e, 0x01, 0x37, 0x27, 0x3e, 0x02, 0x16, 0x1f,
+    0x01, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07,
+    0x1e, 0x01, 0x15, 0x27, 0x14, 0x16, 0x17, 0x33, 0x35, 0x0e, 0x01, 0xe3,
+    0x0b, 0x0a, 0x0b, 0x0a, 0x37, 0x01, 0x02, 0x05, 0x05, 0x08, 0x09, 0x0f,
+    0x09, 0x12, 0x0b, 0x01, 0x1f, 0x03, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x03,
+    0x30, 0x09, 0x09, 0x09, 0x09, 0x2d, 0x01, 0x01, 0x0e, 0x1b, 0x0d, 0x0b,
+    0x05, 0x13, 0x07, 0x0d, 0x13, 0x03, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x01,
+    0x01, 0x09, 0x11, 0x09, 0x04, 0x01, 0x0b, 0x0e, 0x0c, 0x02, 0x02, 0x10,
+    0x1f, 0x10, 0x0b, 0x0a, 0x0b, 0x0a, 0x0e, 0x1e, 0x0f, 0x01, 0x01, 0x4c,
+    0x01, 0x01, 0x23, 0x09, 0x13, 0x01, 0xbd, 0x01, 0x0c, 0x0e, 0x0c, 0x01,
+    0x08, 0x05, 0x13, 0x14, 0x12, 0x04, 0x07, 0x10, 0x0a, 0x03, 0x05, 0x0e,
+    0x3a, 0x21, 0x52, 0x09, 0x0a, 0x09, 0x08, 0x54, 0x03, 0x0b, 0x0d, 0x0b,
+    0x02, 0x07, 0x0e, 0x08, 0x01, 0x03, 0x05, 0x16, 0x02, 0x0e, 0x04, 0x06,
+    0x03, 0x02, 0x2a, 0x2a, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x14, 0x27, 0x14,
+    0x03, 0x05, 0x02, 0x1e, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x17, 0x03, 0x04,
+    0x01, 0x01, 0x0c, 0x0e, 0x0c, 0x01, 0x01, 0x05, 0x04, 0x0e, 0x1b, 0x0e,
+    0x23, 0x09, 0x12, 0x08, 0x2d, 0x03, 0x05, 0x00, 0x00, 0x03, 0xff, 0xf4,
+    0xff, 0xd8, 0x00, 0xac, 0x02, 0x6a, 0x00, 0x3b, 0x00, 0x42, 0x00, 0x48,
+    0x00, 0x53, 0xba, 0x00, 0x39, 0x00, 0x36, 0x00, 0x03, 0x2b, 0xb8, 0x00,
+    0x39, 0x10, 0xb8, 0x00, 0x06, 0xd0, 0xb8, 0x00, 0x06, 0x2f, 0xba, 0x00,
+    0x20, 0x00, 0x39, 0x00, 0x06, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x39, 0x10,
+    0xb8, 0x00, 0x27, 0xd0, 0xb8, 0x00, 0x27, 0x2f, 0xb8, 0x00, 0x36, 0x10,
+    0xb8, 0x00, 0x34, 0xd0, 0xb8, 0x00, 0x34, 0x2f, 0xba, 0x00, 0x3f, 0x00,
+    0x36, 0x00, 0x39, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x36, 0x10, 0xb8, 0x00,
+    0x40, 0xd0, 0xb8, 0x00, 0x40, 0x2f, 0x00, 0xb8, 0x00, 0x37, 0x2f, 0x30,
+    0x31, 0x13, 0x1e, 0x01, 0x07, 0x06, 0x22, 0x07, 0x1e, 0x01, 0x17, 0x1e,
+    0x03, 0x07, 0x0e, 0x01, 0x07, 0x1e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x06,
+    0x22, 0x07, 0x06, 0x26, 0x37, 0x36, 0x26, 0x27, 0x07, 0x06, 0x2e, 0x01,
+    0x34, 0x3f, 0x01, 0x35, 0x27, 0x2e, 0x03, 0x37, 0x30, 0x3e, 0x02, 0x37,
+    0x33, 0x26, 0x35, 0x37, 0x14, 0x17, 0x3e, 0x01, 0x07, 0x14, 0x16, 0x17,
+    0x27, 0x0e, 0x01, 0x13, 0x2e, 0x01, 0x27, 0x17, 0x36, 0x81, 0x13, 0x04,
+    0x11, 0x0b, 0x14, 0x0b, 0x03, 0x07, 0x05, 0x0f, 0x1b, 0x12, 0x04, 0x08,
+    0x05, 0x13, 0x0b, 0x05, 0x0b, 0x04, 0x04, 0x07, 0x05, 0x01, 0x02, 0x02,
+    0x10, 0x0a, 0x08, 0x02, 0x07, 0x05, 0x0a, 0x08, 0x0e, 0x08, 0x06, 0x1c,
+    0x0f, 0x10, 0x23, 0x19, 0x07, 0x0d, 0x0b, 0x0f, 0x10, 0x05, 0x02, 0x03,
+    0x28, 0x03, 0x0a, 0x13, 0x54, 0x0f, 0x0b, 0x08, 0x05, 0x08, 0x59, 0x02,
+    0x03, 0x05, 0x05, 0x05, 0x02, 0x05, 0x02, 0x1e, 0x08, 0x02, 0x01, 0x27,
+    0x4d, 0x27, 0x13, 0x25, 0x26, 0x25, 0x13, 0x0c, 0x0f, 0x06, 0x26, 0x4e,
+    0x26, 0x05, 0x09, 0x05, 0x01, 0x01, 0x01, 0x18, 0x0a, 0x1e, 0x3d, 0x1f,
+    0x06, 0x03, 0x03, 0x0b, 0x0e, 0x07, 0x0f, 0x06, 0x88, 0x14, 0x32, 0x32,
+    0x2c, 0x0e, 0x09, 0x0b, 0x09, 0x01, 0x36, 0x36, 0x03, 0x35, 0x34, 0x01,
+    0x01, 0x3f, 0x12, 0x23, 0x12, 0x56, 0x02, 0x0a, 0xfe, 0xf8, 0x11, 0x11,
+    0x08, 0x33, 0x05, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x11, 0x01, 0x59,
+    0x02, 0x6b, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x3b, 0x00, 0x48, 0x00, 0x55,
+    0x00, 0x61, 0xba, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x03, 0x2b, 0x41, 0x1b,
+    0x00, 0x06, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x0d, 0x00, 0x26, 0x00, 0x0d,
+    0x00, 0x36, 0x00, 0x0d, 0x00, 0x46, 0x00, 0x0d, 0x00, 0x56, 0x00, 0x0d,
+    0x00, 0x66, 0x00, 0x0d, 0x00, 0x76, 0x00, 0x0d, 0x00, 0x86, 0x00, 0x0d,
+    0x00, 0x96, 0x00, 0x0d, 0x00, 0xa6, 0x00, 0x0d, 0x00, 0xb6, 0x00, 0x0d,
+    0x00, 0xc6, 0x00, 0x0d, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00,
+    0x0d, 0x00, 0xe5, 0x00, 0x0d, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x0d, 0x10,
+    0xb8, 0x00, 0x46, 0xd0, 0xb8, 0x00, 0x46, 0x2f, 0x00, 0xb8, 0x00, 0x1f,
+    0x2f, 0x30, 0x31, 0x13, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07,
+    0x0e, 0x03, 0x07, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x01, 0x37, 0x3e,
+    0x01, 0x37, 0x3e, 0x03, 0x37, 0x17, 0x27, 0x1e, 0x01, 0x07, 0x1e, 0x01,
+    0x17, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x06, 0x26, 0x34, 0x36, 0x13, 0x2e,
+    0x02, 0x36, 0x37, 0x26, 0x36, 0x17, 0x1e, 0x02, 0x06, 0x01, 0x26, 0x27,
+    0x06, 0x16, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x2e, 0x01, 0x13, 0x16, 0x36,
+    0x2e, 0x01, 0x27, 0x0e, 0x01, 0x27, 0x06, 0x1e, 0x02, 0xfa, 0x01, 0x05,
+    0x07, 0x09, 0x06, 0x18, 0x29, 0x16, 0x04, 0x0d, 0x0c, 0x09, 0x01, 0x02,
+    0x0a, 0x0d, 0x0c, 0x03, 0x03, 0x1a, 0x0b, 0x0e, 0x19, 0x0d, 0x06, 0x0e,
+    0x10, 0x12, 0x0a, 0x26, 0xbf, 0x0c, 0x0a, 0x02, 0x08, 0x0d, 0x07, 0x1d,
+    0x08, 0x16, 0x2a, 0x14, 0x1c, 0x1c, 0x1b, 0xf9, 0x1d, 0x23, 0x0c, 0x0b,
+    0x11, 0x02, 0x0d, 0x0d, 0x20, 0x2c, 0x0d, 0x1a, 0xfe, 0xfc, 0x06, 0x06,
+    0x04, 0x04, 0x03, 0x07, 0x11, 0x0e, 0x0a, 0x01, 0x08, 0x15, 0xd7, 0x0c,
+    0x06, 0x06, 0x0f, 0x09, 0x04, 0x0f, 0x08, 0x03, 0x05, 0x0d, 0x10, 0x02,
+    0x46, 0x08, 0x05, 0x11, 0x27, 0x12, 0x4e, 0x9b, 0x4f, 0x0e, 0x24, 0x27,
+    0x28, 0x12, 0x09, 0x0a, 0x09, 0x08, 0x2a, 0x4f, 0x27, 0x30, 0x61, 0x30,
+    0x15, 0x37, 0x3b, 0x36, 0x14, 0x0a, 0x21, 0x02, 0x0f, 0x08, 0x01, 0x01,
+    0x02, 0x08, 0x26, 0x28, 0x21, 0x02, 0x03, 0x2a, 0x37, 0x32, 0xfe, 0x08,
+    0x04, 0x1a, 0x21, 0x20, 0x09, 0x08, 0x0f, 0x02, 0x06, 0x2d, 0x2e, 0x21,
+    0x01, 0xc5, 0x01, 0x06, 0x0c, 0x1e, 0x09, 0x03, 0x04, 0x09, 0x0e, 0x08,
+    0x08, 0x02, 0xfe, 0x6a, 0x02, 0x06, 0x0b, 0x0d, 0x06, 0x07, 0x05, 0x05,
+    0x03, 0x08, 0x08, 0x07, 0x00, 0x03, 0xff, 0xff, 0xff, 0xd4, 0x00, 0xe6,
+    0x01, 0xd9, 0x00, 0x36, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x00, 0x17, 0x1e,
+    0x01, 0x0e, 0x01, 0x27, 0x2e, 0x03, 0x27, 0x06, 0x07, 0x06, 0x2e, 0x02,
+    0x37, 0x3e, 0x01, 0x37, 0x2e, 0x02, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x07,
+    0x0e, 0x01, 0x07, 0x06, 0x07, 0x1e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x36,
+    0x1e, 0x02, 0x07, 0x0e, 0x01, 0x07, 0x1e, 0x01, 0x17, 0x32, 0x15, 0x03,
+    0x16, 0x17, 0x3e, 0x01, 0x37, 0x3e, 0x02, 0x26, 0x27, 0x26, 0x0e, 0x02,
+    0x07, 0x06, 0x14, 0x1e, 0x01, 0x07, 0x06, 0x1e, 0x01, 0x36, 0x37, 0x27,
+    0x0e, 0x01, 0xd9, 0x08, 0x05, 0x05, 0x0e, 0x0a, 0x0a, 0x15, 0x13, 0x11,
+    0x06, 0x1a, 0x1e, 0x0e, 0x19, 0x13, 0x09, 0x02, 0x05, 0x17, 0x0f, 0x12,
+    0x1b, 0x06, 0x15, 0x20, 0x17, 0x37, 0x2d, 0x18, 0x08, 0x0c, 0x31, 0x1e,
+    0x02, 0x02, 0x09, 0x16, 0x0b, 0x0b, 0x13, 0x0b, 0x07, 0x0f, 0x0a, 0x02,
+    0x05, 0x0c, 0x18, 0x0d, 0x0f, 0x1f, 0x0f, 0x01, 0xa7, 0x09, 0x0e, 0x0c,
+    0x18, 0x0a, 0x09, 0x0f, 0x04, 0x08, 0x0e, 0x08, 0x19, 0x1a, 0x15, 0x03,
+    0x05, 0x03, 0x07, 0x01, 0x06, 0x08, 0x14, 0x19, 0x0b, 0x25, 0x06, 0x0b,
+    0x05, 0x05, 0x0f, 0x0c, 0x07, 0x03, 0x05, 0x19, 0x1f, 0x1f, 0x0c, 0x10,
+    0x04, 0x02, 0x09, 0x12, 0x19, 0x0e, 0x1b, 0x2e, 0x16, 0x25, 0x4e, 0x47,
+    0x39, 0x10, 0x0c, 0x02, 0x18, 0x2e, 0x20, 0x32, 0x4d, 0x29, 0x02, 0x04,
+    0x14, 0x25, 0x14, 0x09, 0x13, 0x0b, 0x05, 0x02, 0x09, 0x0e, 0x08, 0x0c,
+    0x17, 0x0b, 0x18, 0x2d, 0x14, 0x01, 0x01, 0x33, 0x1f, 0x20, 0x11, 0x21,
+    0x11, 0x10, 0x20, 0x1f, 0x1d, 0x0f, 0x09, 0x01, 0x0b, 0x11, 0x07, 0x0b,
+    0x1a, 0x1c, 0x1a, 0xbe, 0x12, 0x0f, 0x03, 0x07, 0x06, 0x41, 0x0a, 0x15,
+    0x00, 0x01, 0x00, 0x07, 0x01, 0xe8, 0x00, 0x34, 0x02, 0x79, 0x00, 0x13,
+    0x00, 0x00, 0x13, 0x3e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x14, 0x06, 0x15,
+    0x0e, 0x01, 0x22, 0x26, 0x27, 0x34, 0x3e, 0x01, 0x26, 0x07, 0x01, 0x09,
+    0x0c, 0x0d, 0x04, 0x04, 0x02, 0x02, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01,
+    0x01, 0x02, 0x02, 0x61, 0x09, 0x0c, 0x03, 0x06, 0x09, 0x0b, 0x20, 0x1f,
+    0x1d, 0x08, 0x09, 0x0a, 0x09, 0x08, 0x03, 0x1a, 0x21, 0x21, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xfb, 0xff, 0xd9, 0x00, 0xb5, 0x02, 0x72, 0x00, 0x26,
+    0x00, 0x0f, 0x00, 0xb8, 0x00, 0x00, 0x2f, 0xb8, 0x00, 0x22, 0x2f, 0xb8,
+    0x00, 0x24, 0x2f, 0x30, 0x31, 0x13, 0x1e, 0x01, 0x17, 0x0e, 0x03, 0x07,
+    0x0e, 0x01, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x0e, 0x01,
+    0x27, 0x2e, 0x01, 0x27, 0x2e, 0x02, 0x36, 0x37, 0x3e, 0x03, 0x37, 0x30,
+    0x3f, 0x02, 0x71, 0x05, 0x09, 0x05, 0x16, 0x19, 0x0f, 0x0a, 0x07, 0x06,
+    0x0b, 0x08, 0x23, 0x27, 0x0b, 0x19, 0x0c, 0x09, 0x06, 0x04, 0x0f, 0x0a,
+    0x0f, 0x22, 0x0c, 0x2c, 0x29, 0x0b, 0x0b, 0x09, 0x04, 0x0d, 0x15, 0x1e,
+    0x15, 0x01, 0x03, 0x05, 0x02, 0x72, 0x08, 0x12, 0x09, 0x0e, 0x2a, 0x2f,
+    0x32, 0x16, 0x2c, 0x71, 0x6f, 0x61, 0x1c, 0x08, 0x08, 0x06, 0x05, 0x0e,
+    0x0e, 0x07, 0x03, 0x07, 0x0a, 0x0c, 0x2d, 0x68, 0x71, 0x75, 0x3a, 0x19,
+    0x36, 0x33, 0x2c, 0x10, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0xff, 0xff,
+    0xff, 0x96, 0x00, 0xf1, 0x02, 0x79, 0x00, 0x27, 0x00, 0x07, 0x00, 0xb8,
+    0x00, 0x0a, 0x2f, 0x30, 0x31, 0x13, 0x2e, 0x03, 0x27, 0x06, 0x26, 0x3f,
+    0x02, 0x1e, 0x03, 0x17, 0x1e, 0x02, 0x06, 0x07, 0x0e, 0x03, 0x07, 0x06,
+    0x2e, 0x01, 0x36, 0x37, 0x3e, 0x03, 0x37, 0x3e, 0x01, 0x2e, 0x01, 0x71,
+    0x05, 0x11, 0x17, 0x1a, 0x0d, 0x0b, 0x13, 0x05, 0x03, 0x16, 0x13, 0x22,
+    0x1e, 0x18, 0x08, 0x22, 0x2d, 0x12, 0x0c, 0x17, 0x06, 0x15, 0x1c, 0x24,
+    0x16, 0x0a, 0x0c, 0x02, 0x08, 0x0a, 0x0c, 0x18, 0x16, 0x12, 0x06, 0x15,
+    0x0b, 0x10, 0x29, 0x01, 0xfa, 0x07, 0x19, 0x1b, 0x16, 0x05, 0x05, 0x11,
+    0x10, 0x04, 0x09, 0x03, 0x16, 0x1f, 0x21, 0x0d, 0x35, 0x7c, 0x82, 0x82,
+    0x3c, 0x10, 0x2d, 0x2a, 0x21, 0x03, 0x01, 0x0b, 0x0e, 0x0e, 0x02, 0x01,
+    0x1a, 0x23, 0x27, 0x0e, 0x36, 0x78, 0x78, 0x72, 0x00, 0x01, 0x00, 0x09,
+    0x00, 0x73, 0x01, 0x2a, 0x01, 0xd4, 0x00, 0x59, 0x00, 0x00, 0x13, 0x2e,
+    0x01, 0x3e, 0x01, 0x17, 0x16, 0x17, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37,
+    0x26, 0x36, 0x17, 0x1e, 0x01, 0x07, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x1e,
+    0x01, 0x07, 0x0e, 0x01, 0x07, 0x17, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x16,
+    0x06, 0x27, 0x06, 0x23, 0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x0e, 0x01,
+    0x27, 0x2e, 0x01, 0x27, 0x07, 0x14, 0x16, 0x17, 0x16, 0x0e, 0x01, 0x26,
+    0x27, 0x2e, 0x01, 0x27, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37,
+    0x3e, 0x01, 0x37, 0x06, 0x23, 0x2e, 0x01, 0x34, 0x36, 0x37, 0x32, 0x36,
+    0x37, 0x2e, 0x01, 0x1b, 0x0a, 0x08, 0x02, 0x0c, 0x0b, 0x2c, 0x27, 0x01,
+    0x01, 0x02, 0x02, 0x05, 0x01, 0x08, 0x0d, 0x10, 0x0f, 0x04, 0x03, 0x02,
+    0x06, 0x03, 0x07, 0x10, 0x0c, 0x04, 0x06, 0x0b, 0x14, 0x09, 0x05, 0x31,
+    0x06, 0x17, 0x16, 0x13, 0x02, 0x02, 0x11, 0x0a, 0x04, 0x02, 0x26, 0x04,
+    0x07, 0x05, 0x09, 0x06, 0x04, 0x0f, 0x0a, 0x10, 0x1e, 0x0e, 0x0f, 0x09,
+    0x0d, 0x01, 0x09, 0x0d, 0x0e, 0x04, 0x08, 0x0a, 0x02, 0x03, 0x06, 0x02,
+    0x06, 0x0f, 0x0c, 0x07, 0x03, 0x08, 0x0f, 0x08, 0x23, 0x22, 0x09, 0x09,
+    0x09, 0x09, 0x14, 0x26, 0x14, 0x14, 0x28, 0x01, 0x57, 0x03, 0x0e, 0x0d,
+    0x0a, 0x01, 0x06, 0x12, 0x09, 0x12, 0x09, 0x15, 0x10, 0x05, 0x0a, 0x16,
+    0x01, 0x05, 0x26, 0x15, 0x05, 0x07, 0x05, 0x08, 0x02, 0x08, 0x10, 0x09,
+    0x10, 0x20, 0x11, 0x03, 0x0d, 0x02, 0x09, 0x04, 0x06, 0x0d, 0x0f, 0x0c,
+    0x03, 0x02, 0x0b, 0x02, 0x04, 0x02, 0x05, 0x0e, 0x0e, 0x07, 0x03, 0x07,
+    0x10, 0x08, 0x02, 0x25, 0x48, 0x23, 0x0b, 0x0c, 0x03, 0x08, 0x09, 0x14,
+    0x2b, 0x16, 0x06, 0x0b, 0x06, 0x09, 0x05, 0x06, 0x0f, 0x0a, 0x11, 0x20,
+    0x11, 0x03, 0x03, 0x0b, 0x0d, 0x0b, 0x02, 0x02, 0x02, 0x09, 0x0d, 0x00,
+    0x00, 0x01, 0x00, 0x03, 0x00, 0x4a, 0x01, 0x24, 0x01, 0x7b, 0x00, 0x2d,
+    0x00, 0x00, 0x37, 0x2e, 0x01, 0x3e, 0x01, 0x17, 0x1e, 0x01, 0x37, 0x26,
+    0x36, 0x37, 0x36, 0x16, 0x07, 0x0e, 0x01, 0x17, 0x3e, 0x01, 0x37, 0x36,
+    0x32, 0x17, 0x16, 0x0e, 0x02, 0x27, 0x23, 0x0e, 0x01, 0x07, 0x1e, 0x01,
+    0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x22, 0x26, 0x0f,
+    0x09, 0x03, 0x08, 0x0f, 0x09, 0x0e, 0x26, 0x16, 0x02, 0x03, 0x0a, 0x0c,
+    0x1c, 0x03, 0x08, 0x05, 0x02, 0x1c, 0x33, 0x12, 0x0b, 0x1a, 0x08, 0x04,
+    0x03, 0x09, 0x0d, 0x06, 0x01, 0x10, 0x3c, 0x22, 0x04, 0x0a, 0x02, 0x02,
+    0x0a, 0x0d, 0x0c, 0x03, 0x02, 0x08, 0x04, 0x1e, 0x34, 0xde, 0x06, 0x0f,
+    0x0d, 0x05, 0x05, 0x08, 0x04, 0x01, 0x1d, 0x3c, 0x1f, 0x0e, 0x0d, 0x12,
+    0x19, 0x32, 0x19, 0x03, 0x0a, 0x03, 0x05, 0x0c, 0x08, 0x0e, 0x09, 0x02,
+    0x04, 0x08, 0x0a, 0x02, 0x1d, 0x39, 0x1d, 0x09, 0x0a, 0x09, 0x08, 0x1e,
+    0x39, 0x1d, 0x07, 0x00, 0x00, 0x01, 0x00, 0x1a, 0xff, 0xba, 0x00, 0x56,
+    0x00, 0x4b, 0x00, 0x0f, 0x00, 0x00, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x16,
+    0x06, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x37, 0x36, 0x34, 0x2c, 0x01, 0x0b,
+    0x0e, 0x0c, 0x02, 0x02, 0x04, 0x15, 0x07, 0x0d, 0x0b, 0x04, 0x02, 0x11,
+    0x34, 0x0a, 0x0c, 0x01, 0x0a, 0x0b, 0x20, 0x3a, 0x1b, 0x06, 0x01, 0x08,
+    0x0d, 0x09, 0x15, 0x2d, 0x00, 0x01, 0x00, 0x04, 0x00, 0xb0, 0x01, 0x06,
+    0x00, 0xec, 0x00, 0x14, 0x00, 0x17, 0x00, 0xb8, 0x00, 0x12, 0x2f, 0xba,
+    0x00, 0x0c, 0x00, 0x03, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x0c, 0x10, 0xb8,
+    0x00, 0x0f, 0xd0, 0x30, 0x31, 0x37, 0x0e, 0x01, 0x23, 0x06, 0x27, 0x22,
+    0x26, 0x23, 0x27, 0x3e, 0x01, 0x37, 0x36, 0x16, 0x33, 0x3e, 0x01, 0x37,
+    0x1e, 0x01, 0xf5, 0x33, 0x67, 0x35, 0x09, 0x0c, 0x01, 0x02, 0x01, 0x09,
+    0x04, 0x06, 0x08, 0x0e, 0x1c, 0x0e, 0x29, 0x50, 0x28, 0x13, 0x04, 0xc4,
+    0x06, 0x07, 0x07, 0x04, 0x01, 0x1c, 0x05, 0x07, 0x02, 0x03, 0x03, 0x02,
+    0x06, 0x05, 0x02, 0x1e, 0x00, 0x01, 0x00, 0x15, 0xff, 0xf6, 0x00, 0x5c,
+    0x00, 0x48, 0x00, 0x0c, 0x00, 0x07, 0x00, 0xb8, 0x00, 0x08, 0x2f, 0x30,
+    0x31, 0x37, 0x36, 0x16, 0x17, 0x1e, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26,
+    0x3e, 0x01, 0x35, 0x0b, 0x0e, 0x02, 0x08, 0x04, 0x08, 0x11, 0x0c, 0x12,
+    0x10, 0x01, 0x11, 0x46, 0x02, 0x08, 0x08, 0x08, 0x16, 0x15, 0x0f, 0x16,
+    0x1c, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x92, 0x00, 0x7d,
+    0x01, 0x6f, 0x00, 0x1f, 0x00, 0x07, 0x00, 0xb8, 0x00, 0x15, 0x2f, 0x30,
+    0x31, 0x13, 0x36, 0x1e, 0x02, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x0f,
+    0x01, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x06, 0x07, 0x2e, 0x01,
+    0x27, 0x2e, 0x01, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x4d, 0x07, 0x0f, 0x0a,
+    0x02, 0x05, 0x0d, 0x0f, 0x0c, 0x08, 0x07, 0x08, 0x03, 0x08, 0x07, 0x0a,
+    0x0b, 0x12, 0x0e, 0x11, 0x05, 0x13, 0x12, 0x1d, 0x0e, 0x17, 0x11, 0x01,
+    0x12, 0x0e, 0x0d, 0x11, 0x01, 0x6a, 0x05, 0x02, 0x09, 0x0e, 0x08, 0x0f,
+    0x27, 0x11, 0x0c, 0x08, 0x0b, 0x05, 0x06, 0x04, 0x08, 0x08, 0x0e, 0x02,
+    0x08, 0x1d, 0x02, 0x03, 0x12, 0x0b, 0x10, 0x17, 0x16, 0x1b, 0x14, 0x13,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x91, 0x00, 0xc3,
+    0x01, 0x07, 0x00, 0x11, 0x00, 0x21, 0x00, 0x1b, 0x00, 0xb8, 0x00, 0x17,
+    0x2f, 0xb8, 0x00, 0x1a, 0x2f, 0xb8, 0x00, 0x17, 0x10, 0xb8, 0x00, 0x12,
+    0xdc, 0xb8, 0x00, 0x1f, 0xd0, 0xb8, 0x00, 0x1f, 0x2f, 0x30, 0x31, 0x37,
+    0x06, 0x2e, 0x01, 0x36, 0x37, 0x3e, 0x02, 0x16, 0x17, 0x16, 0x06, 0x27,
+    0x26, 0x0e, 0x02, 0x27, 0x2e, 0x01, 0x34, 0x36, 0x37, 0x32, 0x36, 0x33,
+    0x1e, 0x01, 0x14, 0x06, 0x07, 0x22, 0x06, 0x1a, 0x0a, 0x0c, 0x02, 0x08,
+    0x0a, 0x0f, 0x2a, 0x2b, 0x28, 0x0e, 0x0d, 0x0f, 0x12, 0x07, 0x1b, 0x22,
+    0x28, 0x10, 0x09, 0x09, 0x09, 0x09, 0x25, 0x47, 0x24, 0x0b, 0x0a, 0x0b,
+    0x0a, 0x24, 0x48, 0x92, 0x01, 0x0b, 0x0e, 0x0e, 0x02, 0x01, 0x09, 0x05,
+    0x01, 0x08, 0x0c, 0x1b, 0x05, 0x03, 0x01, 0x05, 0x07, 0x48, 0x03, 0x0b,
+    0x0d, 0x0b, 0x02, 0x03, 0x01, 0x0c, 0x0e, 0x0c, 0x01, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xfd, 0x00, 0x92, 0x00, 0x7a, 0x01, 0x6f, 0x00, 0x1f,
+    0x00, 0x07, 0x00, 0xb8, 0x00, 0x0b, 0x2f, 0x30, 0x31, 0x13, 0x1e, 0x01,
+    0x17, 0x1e, 0x02, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x2e, 0x01, 0x37, 0x3e,
+    0x01, 0x37, 0x3e, 0x01, 0x37, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27,
+    0x26, 0x3e, 0x02, 0x2d, 0x0e, 0x11, 0x0d, 0x0d, 0x13, 0x01, 0x12, 0x16,
+    0x0e, 0x1d, 0x12, 0x13, 0x05, 0x11, 0x0e, 0x12, 0x0b, 0x0a, 0x07, 0x08,
+    0x03, 0x08, 0x07, 0x08, 0x0c, 0x0f, 0x0d, 0x05, 0x02, 0x0a, 0x0e, 0x01,
+    0x6a, 0x11, 0x28, 0x13, 0x14, 0x1b, 0x16, 0x17, 0x10, 0x0b, 0x12, 0x03,
+    0x02, 0x1d, 0x08, 0x02, 0x0e, 0x08, 0x08, 0x04, 0x06, 0x05, 0x0b, 0x08,
+    0x0c, 0x11, 0x27, 0x0f, 0x08, 0x0e, 0x09, 0x02, 0x00, 0x02, 0xff, 0xe8,
+    0x00, 0x13, 0x00, 0xe4, 0x02, 0x63, 0x00, 0x2e, 0x00, 0x3a, 0x00, 0x00,
+    0x11, 0x22, 0x2e, 0x01, 0x36, 0x37, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x01,
+    0x07, 0x0e, 0x03, 0x07, 0x0e, 0x01, 0x07, 0x14, 0x16, 0x17, 0x1e, 0x01,
+    0x17, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x03, 0x37, 0x3e, 0x03, 0x35,
+    0x2e, 0x03, 0x13, 0x06, 0x2e, 0x01, 0x36, 0x37, 0x3e, 0x01, 0x1e, 0x01,
+    0x07, 0x06, 0x09, 0x0c, 0x03, 0x04, 0x08, 0x29, 0x42, 0x36, 0x2b, 0x14,
+    0x08, 0x08, 0x04, 0x06, 0x1e, 0x28, 0x2f, 0x17, 0x05, 0x09, 0x05, 0x02,
+    0x01, 0x05, 0x0a, 0x02, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x01, 0x0b, 0x09,
+    0x01, 0x09, 0x0f, 0x36, 0x34, 0x26, 0x01, 0x21, 0x35, 0x41, 0x27, 0x09,
+    0x0e, 0x07, 0x02, 0x06, 0x04, 0x0d, 0x0c, 0x07, 0x01, 0x03, 0x02, 0x31,
+    0x08, 0x0c, 0x0d, 0x05, 0x0c, 0x09, 0x22, 0x37, 0x21, 0x0e, 0x23, 0x10,
+    0x1e, 0x27, 0x1e, 0x19, 0x0f, 0x04, 0x09, 0x05, 0x05, 0x0c, 0x03, 0x1d,
+    0x38, 0x1d, 0x09, 0x0a, 0x09, 0x08, 0x0c, 0x30, 0x33, 0x2d, 0x09, 0x0f,
+    0x1c, 0x1f, 0x25, 0x17, 0x23, 0x3c, 0x28, 0x0f, 0xfd, 0xdc, 0x04, 0x05,
+    0x0b, 0x0e, 0x06, 0x06, 0x03, 0x05, 0x0d, 0x09, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xfa, 0x00, 0x05, 0x01, 0x80, 0x01, 0x73, 0x00, 0x4f,
+    0x00, 0x00, 0x25, 0x16, 0x0e, 0x01, 0x26, 0x27, 0x2a, 0x01, 0x07, 0x06,
+    0x07, 0x0e, 0x01, 0x17, 0x16, 0x3e, 0x02, 0x37, 0x17, 0x1e, 0x01, 0x3e,
+    0x01, 0x27, 0x2e, 0x02, 0x0e, 0x02, 0x07, 0x06, 0x1e, 0x02, 0x3e, 0x01,
+    0x37, 0x36, 0x1e, 0x01, 0x06, 0x07, 0x0e, 0x02, 0x26, 0x27, 0x2e, 0x03,
+    0x37, 0x3e, 0x03, 0x37, 0x36, 0x1e, 0x02, 0x17, 0x16, 0x0e, 0x01, 0x26,
+    0x27, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x37, 0x3e, 0x02, 0x16, 0x01, 0x0a,
+    0x01, 0x09, 0x0d, 0x0e, 0x04, 0x03, 0x0e, 0x06, 0x15, 0x06, 0x04, 0x01,
+    0x05, 0x06, 0x0d, 0x0b, 0x09, 0x02, 0x25, 0x05, 0x23, 0x21, 0x12, 0x0c,
+    0x11, 0x34, 0x3d, 0x3f, 0x35, 0x28, 0x06, 0x05, 0x1c, 0x35, 0x44, 0x44,
+    0x3d, 0x13, 0x09, 0x10, 0x08, 0x01, 0x08, 0x16, 0x50, 0x57, 0x4e, 0x13,
+    0x11, 0x21, 0x16, 0x06, 0x0a, 0x0e, 0x1c, 0x25, 0x32, 0x24, 0x25, 0x4a,
+    0x3d, 0x28, 0x02, 0x01, 0x22, 0x32, 0x34, 0x11, 0x09, 0x10, 0x16, 0x1f,
+    0x11, 0x03, 0x07, 0x07, 0x24, 0x28, 0x24, 0xe8, 0x0b, 0x0c, 0x03, 0x08,
+    0x09, 0x04, 0x0d, 0x16, 0x0c, 0x1c, 0x0c, 0x0e, 0x07, 0x15, 0x1b, 0x05,
+    0x0b, 0x28, 0x0e, 0x1a, 0x35, 0x1c, 0x29, 0x2d, 0x0d, 0x10, 0x28, 0x3d,
+    0x26, 0x1f, 0x2e, 0x1d, 0x0d, 0x02, 0x11, 0x0f, 0x06, 0x04, 0x0b, 0x10,
+    0x07, 0x12, 0x14, 0x04, 0x0d, 0x10, 0x0e, 0x1d, 0x22, 0x29, 0x1a, 0x26,
+    0x33, 0x27, 0x1e, 0x11, 0x12, 0x18, 0x39, 0x4d, 0x22, 0x1a, 0x31, 0x1b,
+    0x05, 0x1c, 0x0e, 0x0a, 0x0f, 0x14, 0x2b, 0x33, 0x10, 0x10, 0x24, 0x12,
+    0x0a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0xff, 0xfe, 0x00, 0xb1,
+    0x02, 0x75, 0x00, 0x19, 0x00, 0x50, 0xba, 0x00, 0x0c, 0x00, 0x11, 0x00,
+    0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x0c,
+    0x00, 0x26, 0x00, 0x0c, 0x00, 0x36, 0x00, 0x0c, 0x00, 0x46, 0x00, 0x0c,
+    0x00, 0x56, 0x00, 0x0c, 0x00, 0x66, 0x00, 0x0c, 0x00, 0x76, 0x00, 0x0c,
+    0x00, 0x86, 0x00, 0x0c, 0x00, 0x96, 0x00, 0x0c, 0x00, 0xa6, 0x00, 0x0c,
+    0x00, 0xb6, 0x00, 0x0c, 0x00, 0xc6, 0x00, 0x0c, 0x00, 0x0d, 0x5d, 0x41,
+    0x05, 0x00, 0xd5, 0x00, 0x0c, 0x00, 0xe5, 0x00, 0x0c, 0x00, 0x02, 0x5d,
+    0x30, 0x31, 0x13, 0x36, 0x16, 0x17, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07,
+    0x0e, 0x01, 0x07, 0x0e, 0x01, 0x22, 0x26, 0x27, 0x3e, 0x01, 0x37, 0x3e,
+    0x01, 0x37, 0x3e, 0x01, 0x89, 0x06, 0x1f, 0x03, 0x02, 0x14, 0x08, 0x06,
+    0x06, 0x05, 0x19, 0x2a, 0x05, 0x02, 0x0a, 0x0d, 0x0c, 0x03, 0x05, 0x2b,
+    0x1a, 0x04, 0x08, 0x06, 0x08, 0x11, 0x02, 0x63, 0x12, 0x04, 0x12, 0x18,
+    0x2c, 0x18, 0x11, 0x23, 0x11, 0x6b, 0xd3, 0x6f, 0x09, 0x0a, 0x09, 0x08,
+    0x72, 0xd9, 0x6e, 0x12, 0x28, 0x12, 0x14, 0x27, 0x00, 0x01, 0x00, 0x12,
+    0xff, 0xfe, 0x00, 0xb1, 0x02, 0x75, 0x00, 0x19, 0x00, 0x50, 0xba, 0x00,
+    0x0c, 0x00, 0x11, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x0c,
+    0x00, 0x16, 0x00, 0x0c, 0x00, 0x26, 0x00, 0x0c, 0x00, 0x36, 0x00, 0x0c,
+    0x00, 0x46, 0x00, 0x0c, 0x00, 0x56, 0x00, 0x0c, 0x00, 0x66, 0x00, 0x0c,
+    0x00, 0x76, 0x00, 0x0c, 0x00, 0x86, 0x00, 0x0c, 0x00, 0x96, 0x00, 0x0c,
+    0x00, 0xa6, 0x00, 0x0c, 0x00, 0xb6, 0x00, 0x0c, 0x00, 0xc6, 0x00, 0x0c,
+    0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x0c, 0x00, 0xe5, 0x00,
+    0x0c, 0x00, 0x02, 0x5d, 0x30, 0x31, 0x13, 0x36, 0x16, 0x17, 0x0e, 0x01,
+    0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x22, 0x26, 0x27,
+    0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x89, 0x06, 0x1f, 0x03,
+    0x02, 0x14, 0x08, 0x06, 0x06, 0x05, 0x19, 0x2a, 0x05, 0x02, 0x0a, 0x0d,
+    0x0c, 0x03, 0x05, 0x2b, 0x1a, 0x04, 0x08, 0x06, 0x08, 0x11, 0x02, 0x63,
+    0x12, 0x04, 0x12, 0x18, 0x2c, 0x18, 0x11, 0x23, 0x11, 0x6b, 0xd3, 0x6f,
+    0x09, 0x0a, 0x09, 0x08, 0x72, 0xd9, 0x6e, 0x12, 0x28, 0x12, 0x14, 0x27,
+    0x00, 0x01, 0x00, 0x02, 0xff, 0xa4, 0x00, 0x9d, 0x02, 0x71, 0x00, 0x32,
+    0x00, 0x8c, 0xba, 0x00, 0x10, 0x00, 0x2e, 0x00, 0x03, 0x2b, 0x41, 0x1b,
+    0x00, 0x06, 0x00, 0x10, 0x00, 0x16, 0x00, 0x10, 0x00, 0x26, 0x00, 0x10,
+    0x00, 0x36, 0x00, 0x10, 0x00, 0x46, 0x00, 0x10, 0x00, 0x56, 0x00, 0x10,
+    0x00, 0x66, 0x00, 0x10, 0x00, 0x76, 0x00, 0x10, 0x00, 0x86, 0x00, 0x10,
+    0x00, 0x96, 0x00, 0x10, 0x00, 0xa6, 0x00, 0x10, 0x00, 0xb6, 0x00, 0x10,
+    0x00, 0xc6, 0x00, 0x10, 0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00,
+    0x10, 0x00, 0xe5, 0x00, 0x10, 0x00, 0x02, 0x5d, 0xb8, 0x00, 0x10, 0x10,
+    0xb8, 0x00, 0x0a, 0xd0, 0xb8, 0x00, 0x0a, 0x2f, 0xb8, 0x00, 0x10, 0x10,
+    0xb8, 0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f, 0xb8, 0x00, 0x2e, 0x10,
+    0xb8, 0x00, 0x23, 0xd0, 0xb8, 0x00, 0x23, 0x2f, 0xb8, 0x00, 0x2e, 0x10,
+    0xb8, 0x00, 0x28, 0xd0, 0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00, 0x2e, 0x10,
+    0xb8, 0x00, 0x2b, 0xd0, 0xb8, 0x00, 0x2b, 0x2f, 0x30, 0x31, 0x13, 0x1e,
+    0x01, 0x14, 0x06, 0x07, 0x22, 0x2e, 0x01, 0x06, 0x07, 0x06, 0x16, 0x17,
+    0x1e, 0x01, 0x15, 0x16, 0x06, 0x17, 0x32, 0x16, 0x3a, 0x01, 0x33, 0x36,
+    0x16, 0x07, 0x0e, 0x01, 0x2e, 0x01, 0x27, 0x26, 0x36, 0x27, 0x2e, 0x03,
+    0x35, 0x34, 0x26, 0x35, 0x34, 0x26, 0x35, 0x34, 0x3e, 0x01, 0x16, 0x88,
+    0x0b, 0x0a, 0x0b, 0x0a, 0x09, 0x17, 0x19, 0x19, 0x0a, 0x07, 0x06, 0x02,
+    0x01, 0x02, 0x01, 0x05, 0x0a, 0x09, 0x08, 0x05, 0x06, 0x07, 0x0c, 0x1b,
+    0x03, 0x08, 0x23, 0x26, 0x1e, 0x04, 0x04, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x09, 0x1b, 0x35, 0x02, 0x6d, 0x01, 0x0c, 0x0e, 0x0c,
+    0x01, 0x03, 0x01, 0x02, 0x03, 0x57, 0xae, 0x58, 0x29, 0x51, 0x2a, 0x1a,
+    0x3d, 0x1a, 0x01, 0x0d, 0x0f, 0x11, 0x10, 0x0a, 0x09, 0x1a, 0x14, 0x19,
+    0x34, 0x19, 0x2d, 0x3f, 0x38, 0x3b, 0x28, 0x18, 0x30, 0x18, 0x15, 0x2a,
+    0x14, 0x33, 0x31, 0x12, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0xff, 0x92, 0x00, 0x97, 0x02, 0x7d, 0x00, 0x34, 0x00, 0x82, 0xba, 0x00,
+    0x2b, 0x00, 0x0f, 0x00, 0x03, 0x2b, 0xb8, 0x00, 0x0f, 0x10, 0xb8, 0x00,
+    0x0c, 0xd0, 0xb8, 0x00, 0x0c, 0x2f, 0xba, 0x00, 0x14, 0x00, 0x0f, 0x00,
+    0x2b, 0x11, 0x12, 0x39, 0xb8, 0x00, 0x14, 0x2f, 0x41, 0x05, 0x00, 0xda,
+    0x00, 0x14, 0x00, 0xea, 0x00, 0x14, 0x00, 0x02, 0x5d, 0x41, 0x1b, 0x00,
+    0x09, 0x00, 0x14, 0x00, 0x19, 0x00, 0x14, 0x00, 0x29, 0x00, 0x14, 0x00,
+    0x39, 0x00, 0x14, 0x00, 0x49, 0x00, 0x14, 0x00, 0x59, 0x00, 0x14, 0x00,
+    0x69, 0x00, 0x14, 0x00, 0x79, 0x00, 0x14, 0x00, 0x89, 0x00, 0x14, 0x00,
+    0x99, 0x00, 0x14, 0x00, 0xa9, 0x00, 0x14, 0x00, 0xb9, 0x00, 0x14, 0x00,
+    0xc9, 0x00, 0x14, 0x00, 0x0d, 0x5d, 0xb8, 0x00, 0x25, 0xdc, 0xb8, 0x00,
+    0x2b, 0x10, 0xb8, 0x00, 0x28, 0xd0, 0xb8, 0x00, 0x28, 0x2f, 0xb8, 0x00,
+    0x25, 0x10, 0xb8, 0x00, 0x36, 0xdc, 0x30, 0x31, 0x17, 0x36, 0x16, 0x17,
+    0x1e, 0x01, 0x17, 0x32, 0x16, 0x37, 0x3e, 0x01, 0x37, 0x34, 0x26, 0x37,
+    0x3e, 0x03, 0x37, 0x0e, 0x01, 0x2f, 0x01, 0x34, 0x36, 0x35, 0x36, 0x17,
+    0x16, 0x36, 0x33, 0x16, 0x17, 0x36, 0x16, 0x07, 0x0e, 0x01, 0x07, 0x06,
+    0x16, 0x15, 0x23, 0x0e, 0x02, 0x26, 0x2f, 0x01, 0x34, 0x36, 0x1a, 0x09,
+    0x15, 0x05, 0x02, 0x06, 0x02, 0x02, 0x05, 0x02, 0x01, 0x01, 0x02, 0x01,
+    0x03, 0x02, 0x05, 0x05, 0x05, 0x01, 0x16, 0x2c, 0x15, 0x0f, 0x01, 0x11,
+    0x0e, 0x11, 0x25, 0x12, 0x0b, 0x03, 0x10, 0x0f, 0x07, 0x02, 0x0d, 0x03,
+    0x03, 0x01, 0x07, 0x06, 0x17, 0x1a, 0x19, 0x09, 0x03, 0x01, 0x40, 0x0b,
+    0x03, 0x09, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x56, 0xac,
+    0x58, 0x31, 0x4a, 0x43, 0x45, 0x2d, 0x01, 0x03, 0x05, 0x1e, 0x01, 0x01,
+    0x01, 0x12, 0x0e, 0x02, 0x04, 0x02, 0x03, 0x03, 0x14, 0x0c, 0x4e, 0x97,
+    0x4e, 0x5d, 0xb8, 0x5e, 0x0b, 0x0b, 0x01, 0x08, 0x09, 0x18, 0x02, 0x01,
+    0x00, 0x01, 0x00, 0x03, 0x01, 0xe0, 0x00, 0xe9, 0x02, 0x7d, 0x00, 0x24,
+    0x00, 0x07, 0x00, 0xb8, 0x00, 0x15, 0x2f, 0x30, 0x31, 0x13, 0x3e, 0x01,
+    0x17, 0x37, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x07,
+    0x14, 0x06, 0x15, 0x0e, 0x01, 0x07, 0x2e, 0x03, 0x27, 0x0e, 0x01, 0x07,
+    0x2e, 0x01, 0x27, 0x3e, 0x03, 0x42, 0x04, 0x11, 0x07, 0x09, 0x0a, 0x19,
+    0x18, 0x12, 0x05, 0x08, 0x0f, 0x07, 0x08, 0x0a, 0x02, 0x01, 0x05, 0x0b,
+    0x05, 0x0c, 0x1c, 0x1c, 0x1b, 0x0b, 0x0f, 0x21, 0x11, 0x08, 0x12, 0x09,
+    0x03, 0x11, 0x14, 0x12, 0x02, 0x6b, 0x0c, 0x06, 0x04, 0x02, 0x01, 0x13,
+    0x19, 0x19, 0x06, 0x0a, 0x12, 0x0a, 0x02, 0x0d, 0x0b, 0x01, 0x01, 0x02,
+    0x03, 0x06, 0x04, 0x03, 0x1e, 0x26, 0x23, 0x07, 0x1b, 0x34, 0x1a, 0x05,
+    0x07, 0x04, 0x11, 0x1c, 0x1b, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0d,
+    0xff, 0xb6, 0x01, 0x41, 0xff, 0xe9, 0x00, 0x1c, 0x00, 0x23, 0x00, 0xb8,
+    0x00, 0x15, 0x2f, 0xb8, 0x00, 0x17, 0x2f, 0xb8, 0x00, 0x03, 0x2f, 0xb8,
+    0x00, 0x08, 0x2f, 0xb8, 0x00, 0x03, 0x10, 0xb8, 0x00, 0x12, 0xdc, 0xb8,
+    0x00, 0x0d, 0xd0, 0xb8, 0x00, 0x0d, 0x2f, 0x30, 0x31, 0x17, 0x3e, 0x01,
+    0x37, 0x3e, 0x01, 0x3a, 0x01, 0x33, 0x1e, 0x01, 0x14, 0x06, 0x07, 0x2a,
+    0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x2b, 0x01, 0x34, 0x36, 0x3d,
+    0x01, 0x33, 0x11, 0x1c, 0x35, 0x1c, 0x1e, 0x28, 0x23, 0x27, 0x1e, 0x0b,
+    0x0a, 0x0b, 0x0a, 0x1e, 0x28, 0x22, 0x28, 0x1e, 0x1b, 0x35, 0x1b, 0x02,
+    0x04, 0x01, 0x03, 0x22, 0x01, 0x05, 0x02, 0x01, 0x02, 0x01, 0x0c, 0x0e,
+    0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x04, 0x07, 0x04, 0x19,
+    0x00, 0x01, 0xff, 0xfc, 0x01, 0xe9, 0x00, 0x82, 0x02, 0x72, 0x00, 0x11,
+    0x00, 0x07, 0x00, 0xb8, 0x00, 0x0d, 0x2f, 0x30, 0x31, 0x13, 0x26, 0x3e,
+    0x01, 0x32, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x22,
+    0x2e, 0x02, 0x02, 0x06, 0x02, 0x0a, 0x10, 0x08, 0x16, 0x28, 0x15, 0x08,
+    0x07, 0x02, 0x0b, 0x09, 0x07, 0x1f, 0x22, 0x1e, 0x02, 0x50, 0x09, 0x10,
+    0x09, 0x07, 0x17, 0x2e, 0x17, 0x03, 0x0c, 0x0c, 0x0a, 0x01, 0x1d, 0x25,
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf7, 0xff, 0x45, 0x00, 0xab,
+    0x02, 0x6b, 0x00, 0x56, 0x00, 0x07, 0x00, 0xb8, 0x00, 0x00, 0x2f, 0x30,
+    0x31, 0x13, 0x1e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x1e, 0x01,
+    0x17, 0x16, 0x06, 0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x0e,
+    0x02, 0x15, 0x14, 0x1e, 0x02, 0x1f, 0x01, 0x36, 0x33, 0x36, 0x16, 0x17,
+    0x0e, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x34, 0x36, 0x37, 0x3e,
+    0x01, 0x27, 0x34, 0x2f, 0x01, 0x2e, 0x01, 0x27, 0x07, 0x27, 0x37, 0x3e,
+    0x01, 0x37, 0x27, 0x32, 0x36, 0x33, 0x37, 0x33, 0x32, 0x35, 0x3e, 0x01,
+    0x2e, 0x01, 0x27, 0x2e, 0x02, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x88, 0x13,
+    0x04, 0x11, 0x13, 0x1b, 0x10, 0x12, 0x0d, 0x02, 0x09, 0x03, 0x03, 0x01,
+    0x0b, 0x07, 0x0c, 0x06, 0x08, 0x12, 0x05, 0x04, 0x05, 0x0a, 0x09, 0x02,
+    0x06, 0x0b, 0x0a, 0x08, 0x02, 0x07, 0x08, 0x18, 0x03, 0x03, 0x1a, 0x20,
+    0x1e, 0x06, 0x16, 0x04, 0x10, 0x06, 0x02, 0x01, 0x01, 0x01, 0x02, 0x16,
+    0x05, 0x0e, 0x08, 0x07, 0x18, 0x02, 0x03, 0x05, 0x02, 0x01, 0x01, 0x02,
+    0x01, 0x08, 0x01, 0x01, 0x0a, 0x03, 0x05, 0x07, 0x01, 0x01, 0x04, 0x02,
+    0x03, 0x0b, 0x14, 0x11, 0x0c, 0x10, 0x0f, 0x12, 0x02, 0x6b, 0x02, 0x1e,
+    0x08, 0x02, 0x03, 0x0d, 0x0f, 0x4b, 0x57, 0x54, 0x19, 0x19, 0x2d, 0x11,
+    0x05, 0x0d, 0x05, 0x07, 0x10, 0x0b, 0x0b, 0x30, 0x38, 0x33, 0x0d, 0x09,
+    0x1b, 0x1b, 0x17, 0x06, 0x03, 0x01, 0x09, 0x08, 0x0f, 0x14, 0x0b, 0x07,
+    0x13, 0x0c, 0x2e, 0x66, 0x30, 0x0b, 0x13, 0x0b, 0x04, 0x0c, 0x05, 0x03,
+    0x04, 0x17, 0x05, 0x0e, 0x05, 0x02, 0x17, 0x07, 0x02, 0x03, 0x02, 0x01,
+    0x01, 0x06, 0x01, 0x09, 0x20, 0x23, 0x22, 0x0c, 0x0f, 0x2d, 0x34, 0x37,
+    0x31, 0x27, 0x0b, 0x08, 0x08, 0x04, 0x02, 0x00, 0x00, 0x01, 0xff, 0xf7,
+    0xff, 0x45, 0x00, 0xab, 0x02, 0x6b, 0x00, 0x56, 0x00, 0x07, 0x00, 0xb8,
+    0x00, 0x00, 0x2f, 0x30, 0x31, 0x13, 0x1e, 0x03, 0x17, 0x1e, 0x03, 0x0e,
+    0x01, 0x07, 0x0e, 0x02, 0x16, 0x17, 0x14, 0x3b, 0x01, 0x17, 0x32, 0x16,
+    0x33, 0x07, 0x1e, 0x01, 0x1f, 0x01, 0x07, 0x27, 0x0e, 0x01, 0x0f, 0x01,
+    0x06, 0x15, 0x06, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x16, 0x06, 0x07, 0x0e,
+    0x02, 0x26, 0x27, 0x3e, 0x01, 0x17, 0x32, 0x17, 0x37, 0x3e, 0x03, 0x35,
+    0x34, 0x2e, 0x02, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x2e, 0x01,
+    0x37, 0x3e, 0x02, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x36, 0x1a, 0x0f,
+    0x12, 0x0f, 0x10, 0x0c, 0x11, 0x14, 0x0b, 0x03, 0x02, 0x04, 0x01, 0x01,
+    0x07, 0x05, 0x03, 0x0a, 0x01, 0x01, 0x08, 0x01, 0x02, 0x01, 0x01, 0x02,
+    0x05, 0x03, 0x02, 0x18, 0x07, 0x08, 0x0e, 0x05, 0x16, 0x02, 0x01, 0x01,
+    0x01, 0x02, 0x06, 0x10, 0x04, 0x16, 0x06, 0x1e, 0x20, 0x1a, 0x03, 0x03,
+    0x18, 0x08, 0x07, 0x02, 0x08, 0x0a, 0x0b, 0x06, 0x02, 0x09, 0x0a, 0x06,
+    0x05, 0x05, 0x12, 0x08, 0x06, 0x0c, 0x07, 0x0b, 0x01, 0x03, 0x03, 0x09,
+    0x02, 0x0d, 0x12, 0x10, 0x1b, 0x13, 0x11, 0x04, 0x02, 0x6b, 0x02, 0x02,
+    0x04, 0x08, 0x08, 0x0b, 0x27, 0x31, 0x37, 0x34, 0x2d, 0x0f, 0x0c, 0x22,
+    0x23, 0x20, 0x09, 0x01, 0x06, 0x01, 0x01, 0x02, 0x03, 0x02, 0x07, 0x17,
+    0x02, 0x05, 0x0e, 0x05, 0x17, 0x04, 0x03, 0x05, 0x0c, 0x04, 0x0b, 0x13,
+    0x0b, 0x30, 0x66, 0x2e, 0x0c, 0x13, 0x07, 0x0b, 0x14, 0x0f, 0x08, 0x09,
+    0x01, 0x03, 0x06, 0x17, 0x1b, 0x1b, 0x09, 0x0d, 0x33, 0x38, 0x30, 0x0b,
+    0x0b, 0x10, 0x07, 0x05, 0x0d, 0x05, 0x11, 0x2d, 0x19, 0x19, 0x54, 0x57,
+    0x4b, 0x0f, 0x0d, 0x03, 0x02, 0x08, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x17,
+    0xff, 0x67, 0x00, 0x69, 0x02, 0x7a, 0x00, 0x18, 0x00, 0x55, 0xba, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x41, 0x1b, 0x00, 0x06, 0x00, 0x05,
+    0x00, 0x16, 0x00, 0x05, 0x00, 0x26, 0x00, 0x05, 0x00, 0x36, 0x00, 0x05,
+    0x00, 0x46, 0x00, 0x05, 0x00, 0x56, 0x00, 0x05, 0x00, 0x66, 0x00, 0x05,
+    0x00, 0x76, 0x00, 0x05, 0x00, 0x86, 0x00, 0x05, 0x00, 0x96, 0x00, 0x05,
+    0x00, 0xa6, 0x00, 0x05, 0x00, 0xb6, 0x00, 0x05, 0x00, 0xc6, 0x00, 0x05,
+    0x00, 0x0d, 0x5d, 0x41, 0x05, 0x00, 0xd5, 0x00, 0x05, 0x00, 0xe5, 0x00,
+    0x05, 0x00, 0x02, 0x5d, 0x00, 0xb8, 0x00, 0x0d, 0x2f, 0x30, 0x31, 0x13,
+    0x3e, 0x02, 0x16, 0x17, 0x14, 0x16, 0x17, 0x1e, 0x02, 0x06, 0x07, 0x27,
+    0x35, 0x34, 0x37, 0x36, 0x2e, 0x02, 0x27, 0x2e, 0x01, 0x17, 0x01, 0x0b,
+    0x0e, 0x0c, 0x02, 0x05, 0x0c, 0x03, 0x0d, 0x09, 0x02, 0x0b, 0x27, 0x05,
+    0x05, 0x02, 0x07, 0x0a, 0x04, 0x0c, 0x05, 0x02, 0x63, 0x0a, 0x0c, 0x01,
+    0x0a, 0x0b, 0x70, 0xe0, 0x71, 0x1d, 0x55, 0x5b, 0x54, 0x1c, 0x04, 0x05,
+    0x08, 0x07, 0x13, 0x45, 0x52, 0x55, 0x24, 0x70, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x05, 0x00, 0x9a, 0x01, 0x17, 0x01, 0x0c, 0x00, 0x1c,
+    0x00, 0x00, 0x37, 0x2e, 0x02, 0x06, 0x07, 0x16, 0x06, 0x07, 0x23, 0x27,
+    0x34, 0x36, 0x37, 0x3e, 0x01, 0x1e, 0x03, 0x17, 0x3e, 0x01, 0x37, 0x1e,
+    0x01, 0x07, 0x0e, 0x01, 0xcf, 0x19, 0x2c, 0x27, 0x24, 0x10, 0x02, 0x0c,
+    0x0b, 0x03, 0x12, 0x0e, 0x09, 0x14, 0x21, 0x1e, 0x1c, 0x1c, 0x1f, 0x12,
+    0x0b, 0x12, 0x0b, 0x13, 0x04, 0x11, 0x0e, 0x19, 0x9e, 0x06, 0x23, 0x1a,
+    0x01, 0x1f, 0x08, 0x0e, 0x01, 0x11, 0x0f, 0x13, 0x0a, 0x16, 0x0f, 0x05,
+    0x12, 0x17, 0x15, 0x04, 0x04, 0x0a, 0x02, 0x02, 0x1e, 0x08, 0x02, 0x11,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x07, 0x00, 0xd7, 0x00, 0xf5, 0x00, 0x2a,
+    0x00, 0x38, 0x00, 0x3b, 0x00, 0x00, 0x37, 0x0e, 0x01, 0x2e, 0x01, 0x37,
+    0x3e, 0x02, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x02, 0x14, 0x15, 0x07,
+    0x22, 0x07, 0x35, 0x26, 0x31, 0x06, 0x07, 0x06, 0x2e, 0x02, 0x37, 0x3e,
+    0x01, 0x1e, 0x01, 0x17, 0x26, 0x27, 0x2e, 0x02, 0x06, 0x17, 0x36, 0x17,
+    0x26, 0x27, 0x2e, 0x01, 0x0e, 0x01, 0x14, 0x16, 0x37, 0x3e, 0x01, 0x17,
+    0x16, 0x27, 0x29, 0x06, 0x0f, 0x0c, 0x07, 0x03, 0x0d, 0x27, 0x2b, 0x2d,
+    0x13, 0x0a, 0x0b, 0x06, 0x0a, 0x0b, 0x04, 0x26, 0x01, 0x01, 0x02, 0x05,
+    0x07, 0x20, 0x45, 0x2a, 0x01, 0x24, 0x0b, 0x20, 0x22, 0x1f, 0x0b, 0x03,
+    0x0d, 0x07, 0x1e, 0x22, 0x22, 0x62, 0x07, 0x05, 0x05, 0x06, 0x10, 0x20,
+    0x19, 0x0f, 0x14, 0x16, 0x0f, 0x10, 0x4b, 0x02, 0x01, 0xb3, 0x09, 0x05,
+    0x06, 0x0f, 0x0a, 0x14, 0x17, 0x06, 0x09, 0x0b, 0x05, 0x14, 0x0a, 0x0f,
+    0x29, 0x2c, 0x2c, 0x11, 0x09, 0x01, 0x04, 0x04, 0x07, 0x02, 0x0b, 0x04,
+    0x1d, 0x32, 0x22, 0x0a, 0x05, 0x07, 0x0f, 0x0a, 0x22, 0x1c, 0x11, 0x12,
+    0x02, 0x0d, 0x89, 0x02, 0x02, 0x0a, 0x06, 0x12, 0x09, 0x07, 0x11, 0x12,
+    0x0c, 0x01, 0x01, 0x04, 0x0b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3a, 0x00, 0x86, 0x01, 0x5a, 0x01, 0x9c, 0x02, 0x32, 0x02, 0x8e,
+    0x03, 0x02, 0x03, 0x62, 0x03, 0xc2, 0x04, 0x02, 0x04, 0x54, 0x04, 0xde,
+    0x05, 0x3c, 0x05, 0x94, 0x05, 0xe6, 0x06, 0x26, 0x06, 0x7c, 0x06, 0xda,
+    0x07, 0x24, 0x07, 0x68, 0x07, 0xc6, 0x08, 0x2c, 0x08, 0x66, 0x08, 0xbe,
+    0x09, 0x08, 0x09, 0xf6, 0x0a, 0x42, 0x0b, 0x04, 0x0b, 0xca, 0x0c, 0x8c,
+    0x0d, 0x0a, 0x0d, 0xd2, 0x0e, 0x90, 0x0f, 0x02, 0x0f, 0x6c, 0x0f, 0xea,
+    0x10, 0x4c, 0x10, 0xf4, 0x11, 0xd6, 0x12, 0x48, 0x12, 0xfc, 0x13, 0xf8,
+    0x14, 0x92, 0x14, 0xe0, 0x15, 0x26, 0x15, 0xd6, 0x16, 0x7e, 0x16, 0xf6,
+    0x17, 0x94, 0x18, 0x32, 0x18, 0x82, 0x18, 0xdc, 0x18, 0xdc, 0x19, 0x66,
+    0x19, 0xb2, 0x1a, 0x14, 0x1a, 0xbe, 0x1b, 0x24, 0x1b, 0x82, 0x1c, 0x0a,
+    0x1c, 0x9a, 0x1d, 0x2a, 0x1d, 0x92, 0x1d, 0xc4, 0x1d, 0xf8, 0x1e, 0x5a,
+    0x1e, 0xe8, 0x1f, 0xf8, 0x20, 0x92, 0x21, 0x4c, 0x21, 0xce, 0x21, 0xf2,
+    0x22, 0x38, 0x22, 0x7a, 0x23, 0x06, 0x23, 0x50, 0x23, 0x6e, 0x23, 0x9e,
+    0x23, 0xbc, 0x23, 0xf8, 0x24, 0x3e, 0x24, 0x78, 0x24, 0xd4, 0x25, 0x4e,
+    0x25, 0xa4, 0x25, 0xfa, 0x26, 0x8e, 0x27, 0x20, 0x27, 0x60, 0x27, 0x9e,
+    0x27, 0xc4, 0x28, 0x4a, 0x28, 0xce, 0x29, 0x24, 0x29, 0x54, 0x29, 0xb2,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x7e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x24, 0x00, 0x22, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x1b, 0x00, 0x46, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x19, 0x00, 0x61, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x01, 0x00, 0x36, 0x00, 0x7a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x02, 0x00, 0x0e, 0x00, 0xb0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x03, 0x00, 0x48, 0x00, 0xbe, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x04, 0x00, 0x36, 0x01, 0x06, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x06, 0x00, 0x32, 0x01, 0x3c, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62,
+    0x65, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x63, 0x61, 0x73, 0x73, 0x65,
+    0x74, 0x74, 0x65, 0x20, 0x74, 0x61, 0x70, 0x65, 0x73, 0x52, 0x65, 0x67,
+    0x75, 0x6c, 0x61, 0x72, 0x31, 0x2e, 0x30, 0x30, 0x30, 0x3b, 0x70, 0x79,
+    0x72, 0x73, 0x3b, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x69,
+    0x7a, 0x65, 0x64, 0x63, 0x61, 0x73, 0x73, 0x65, 0x74, 0x74, 0x65, 0x74,
+    0x61, 0x70, 0x65, 0x73, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74,
+    0x69, 0x7a, 0x65, 0x64, 0x20, 0x63, 0x61, 0x73, 0x73, 0x65, 0x74, 0x74,
+    0x65, 0x20, 0x74, 0x61, 0x70, 0x65, 0x73, 0x61, 0x6c, 0x70, 0x68, 0x61,
+    0x62, 0x65, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x63, 0x61, 0x73, 0x73, 0x65,
+    0x74, 0x74, 0x65, 0x74, 0x61, 0x70, 0x65, 0x73, 0x00, 0x61, 0x00, 0x6c,
+    0x00, 0x70, 0x00, 0x68, 0x00, 0x61, 0x00, 0x62, 0x00, 0x65, 0x00, 0x74,
+    0x00, 0x69, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x63,
+    0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x65, 0x00, 0x74, 0x00, 0x74,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x74, 0x00, 0x61, 0x00, 0x70, 0x00, 0x65,
+    0x00, 0x73, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6c,
+    0x00, 0x61, 0x00, 0x72, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x3b, 0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x73,
+    0x00, 0x3b, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x70, 0x00, 0x68, 0x00, 0x61,
+    0x00, 0x62, 0x00, 0x65, 0x00, 0x74, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x65,
+    0x00, 0x64, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x65,
+    0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x74, 0x00, 0x61, 0x00, 0x70,
+    0x00, 0x65, 0x00, 0x73, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x70, 0x00, 0x68,
+    0x00, 0x61, 0x00, 0x62, 0x00, 0x65, 0x00, 0x74, 0x00, 0x69, 0x00, 0x7a,
+    0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x63, 0x00, 0x61, 0x00, 0x73,
+    0x00, 0x73, 0x00, 0x65, 0x00, 0x74, 0x00, 0x74, 0x00, 0x65, 0x00, 0x20,
+    0x00, 0x74, 0x00, 0x61, 0x00, 0x70, 0x00, 0x65, 0x00, 0x73, 0x00, 0x61,
+    0x00, 0x6c, 0x00, 0x70, 0x00, 0x68, 0x00, 0x61, 0x00, 0x62, 0x00, 0x65,
+    0x00, 0x74, 0x00, 0x69, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x64, 0x00, 0x63,
+    0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x65, 0x00, 0x74, 0x00, 0x74,
+    0x00, 0x65, 0x00, 0x74, 0x00, 0x61, 0x00, 0x70, 0x00, 0x65, 0x00, 0x73,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xb5, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+} // namespace
+
+namespace Fonts {
+
+const Asset inconsolata{resources_fonts_Inconsolata_Regular_ttf,
+                        sizeof(resources_fonts_Inconsolata_Regular_ttf)};
+const Asset act{resources_fonts_act_ttf, sizeof(resources_fonts_act_ttf)};
+
+} // namespace Fonts
@@ -0,0 +1,27 @@
+#include "fonts.h"
+#include "stable_win32.hpp"
+
+namespace Fonts {
+
+bool load(sf::Font &font, const Asset &asset) {
+    return font.loadFromMemory(asset.data, asset.size);
+}
+
+Prewarm::Prewarm(std::vector<Job> jobs)
+    : thread([jobs = std::move(jobs)] {
+          // sfml gives the thread a context of its own, sharing textures
+          // with the window's
+          for (auto &job : jobs) {
+              for (u32 size : job.sizes) {
+                  for (u32 c = ' '; c <= '~'; ++c)
+                      job.font->getGlyph(c, size, false);
+              }
+          }
+      }) {}
+
+void Prewarm::wait() {
+    if (thread.joinable())
+        thread.join();
+}
+
+} // namespace Fonts
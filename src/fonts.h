@@ -0,0 +1,42 @@
+#pragma once
+#include "stable_win32.hpp"
+
+// The fonts of resources/fonts, compiled in by font_data.cpp so that
+// neither the working directory nor the disk matters at startup.
+namespace Fonts {
+
+struct Asset {
+    const u8 *data;
+    size_t size;
+};
+
+extern const Asset inconsolata;
+extern const Asset act;
+
+// The font reads the asset for as long as it lives, which the embedded
+// data outlives.
+bool load(sf::Font &font, const Asset &asset);
+
+// Rasterises the printable ASCII glyphs of each font at the sizes it is
+// drawn at on a thread of its own, so the atlases are built while the
+// window opens rather than on first draw. The fonts are the thread's until
+// wait returns.
+class Prewarm {
+public:
+    struct Job {
+        sf::Font *font;
+        std::vector<u32> sizes;
+    };
+
+    explicit Prewarm(std::vector<Job> jobs);
+    ~Prewarm() { wait(); }
+    Prewarm(const Prewarm &) = delete;
+    void operator=(const Prewarm &) = delete;
+
+    void wait();
+
+private:
+    std::thread thread;
+};
+
+} // namespace Fonts
@@ -0,0 +1,22 @@
+#include "engine.h"
+#include "stable_win32.hpp"
+
+// What the game code gets from main.cpp, for builds without a window. The
+// headless paths never draw, so the ui does nothing. add_message and the
+// message log come from ui_state.cpp, as in the game.
+
+sf::RenderWindow *window = nullptr;
+
+namespace ui {
+
+void label(int, int, std::string, ...) {}
+
+void labelc(int, int, const sf::Color &, std::string, ...) {}
+
+void text(int, int, const std::string &, u32) {}
+
+bool push_button(int, int, const std::string &, ui::Align) { return false; }
+
+bool toggle_button(int, int, const std::string &, bool *) { return false; }
+
+} // namespace ui
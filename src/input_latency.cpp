@@ -0,0 +1,49 @@
+#include "input_latency.h"
+#include "stable_win32.hpp"
+
+namespace {
+
+float ms_since(InputLatency::Clock::time_point t,
+               InputLatency::Clock::time_point now) {
+    return std::chrono::duration<float, std::milli>(now - t).count();
+}
+
+// of a copy, summary is rare enough
+float percentile(std::vector<float> v, float p) {
+    if (v.empty())
+        return 0.0f;
+    const size_t i = std::min(v.size() - 1, static_cast<size_t>(p * v.size()));
+    std::nth_element(v.begin(), v.begin() + i, v.end());
+    return v[i];
+}
+
+} // namespace
+
+void InputLatency::applied(Clock::time_point polled) {
+    to_tick.push_back(ms_since(polled, Clock::now()));
+    unseen.push_back(polled);
+}
+
+void InputLatency::displayed() {
+    if (unseen.empty())
+        return;
+    const auto now = Clock::now();
+    for (auto polled : unseen) {
+        to_frame.push_back(ms_since(polled, now));
+    }
+    unseen.clear();
+}
+
+std::string InputLatency::summary() const {
+    char line[160];
+    snprintf(line, sizeof(line),
+             "poll to tick p50 %.1f ms  p99 %.1f ms\n"
+             "poll to frame p50 %.1f ms  p99 %.1f ms  max %.1f ms\n"
+             "presses %llu applied, %llu coalesced\n",
+             percentile(to_tick, 0.5f), percentile(to_tick, 0.99f),
+             percentile(to_frame, 0.5f), percentile(to_frame, 0.99f),
+             percentile(to_frame, 1.0f),
+             static_cast<unsigned long long>(to_tick.size()),
+             static_cast<unsigned long long>(coalesced));
+    return line;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "engine.h"
+#include "stable_win32.hpp"
+
+// How long the local player's key presses take to show, from the poll
+// that handed one over: to the tick whose move applied it, and to the
+// frame that drew that move. The time a press waited to be polled, up to
+// a frame, is not in it, see Input::KeyPressed. Presses a move used up
+// without turning on them, see SnakeGame::resolve_turn, are only counted.
+class InputLatency {
+public:
+    using Clock = Input::Clock;
+
+    // A move used the presses [first, last), turning on the last one when
+    // turned. The presses need a time.
+    template <typename It> void used(It first, It last, bool turned) {
+        for (auto it = first; it != last; ++it) {
+            if (turned && std::next(it) == last) {
+                applied(it->time);
+            } else {
+                coalesced++;
+            }
+        }
+    }
+
+    // right after the window displayed a frame
+    void displayed();
+
+    std::string summary() const;
+
+private:
+    void applied(Clock::time_point polled);
+
+    // when the presses applied since the last frame, not on screen yet,
+    // were polled
+    std::vector<Clock::time_point> unseen;
+    // ms, every sample: one per key press is little to keep, and the
+    // percentiles come out exact rather than as a bucket's bound
+    std::vector<float> to_tick;
+    std::vector<float> to_frame;
+    u64 coalesced = 0;
+};
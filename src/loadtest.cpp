@@ -0,0 +1,465 @@
+#include "engine.h"
+#include "network.h"
+#include "snake.h"
+#include "stable_win32.hpp"
+
+#include <fstream>
+
+// Load generator: joins growing numbers of synthetic guests to a host or a
+// dedicated server over loopback and measures, at each step, how long the
+// host takes to apply their key presses. Every step is a fresh game: the
+// bots join, get ready together, play for a while and leave again.
+//
+// Latency is from sending a PlayerInput to receiving the InputAck that
+// covers it, that is until the host moved the snake with that key.
+
+extern std::atomic_bool mute_messages;
+
+namespace {
+
+using Clock = Network::Clock;
+using namespace SnakeNetwork;
+
+constexpr auto HEARTBEAT_INTERVAL = 16ms;
+constexpr auto JOIN_RETRY = 250ms;
+constexpr auto POLL_INTERVAL = 1ms;
+
+struct Options {
+    std::vector<u32> steps = {8, 16, 32, 64, 128, 256, 512};
+    u16 port = Network::PORTN;
+    u32 rooms = 1;
+    bool udp = false;
+    bool compression = false;
+    u32 duration = 10;
+    u32 join_timeout = 10;
+    float input_rate = 5.0f;
+    std::string script;
+    u32 threads = 4;
+    u32 io_threads = 2;
+    std::string csv;
+    // the link simulator, on what the bots send
+    float loss = 0.0f;
+    float latency_ms = 0.0f;
+    float jitter_ms = 0.0f;
+};
+
+void usage(const char *name) {
+    printf("usage: %s [--clients N,N,...] [--port P] [--rooms N] [--udp]\n"
+           "          [--compression]\n"
+           "          [--duration S] [--join-timeout S] [--input-rate HZ]\n"
+           "          [--script KEYS] [--threads N] [--io-threads N]\n"
+           "          [--csv PATH] [--loss P] [--latency MS] [--jitter MS]\n"
+           "KEYS is a sequence of L, R, U and D played in a loop, random "
+           "keys without it. The link options only simulate what the bots "
+           "send,\nSNEK_LINK_LOSS, SNEK_LINK_LATENCY and SNEK_LINK_JITTER do "
+           "the same on the host.\n",
+           name);
+}
+
+bool parse(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--udp") {
+            options.udp = true;
+            continue;
+        } else if (arg == "--compression") {
+            options.compression = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return false;
+        const std::string value = argv[++i];
+        const u32 n = std::strtoul(value.c_str(), nullptr, 10);
+        if (arg == "--clients") {
+            options.steps.clear();
+            std::istringstream iss(value);
+            for (std::string step; std::getline(iss, step, ',');) {
+                options.steps.push_back(
+                    std::strtoul(step.c_str(), nullptr, 10));
+            }
+        } else if (arg == "--port") {
+            options.port = n;
+        } else if (arg == "--rooms") {
+            options.rooms = std::max(1u, n);
+        } else if (arg == "--duration") {
+            options.duration = std::max(1u, n);
+        } else if (arg == "--join-timeout") {
+            options.join_timeout = std::max(1u, n);
+        } else if (arg == "--input-rate") {
+            options.input_rate = std::max(0.1f, std::strtof(value.c_str(), 0));
+        } else if (arg == "--script") {
+            options.script = value;
+        } else if (arg == "--threads") {
+            options.threads = std::max(1u, n);
+        } else if (arg == "--io-threads") {
+            options.io_threads = std::max(1u, n);
+        } else if (arg == "--csv") {
+            options.csv = value;
+        } else if (arg == "--loss") {
+            options.loss =
+                std::clamp(std::strtof(value.c_str(), 0), 0.0f, 1.0f);
+        } else if (arg == "--latency") {
+            options.latency_ms = std::max(0.0f, std::strtof(value.c_str(), 0));
+        } else if (arg == "--jitter") {
+            options.jitter_ms = std::max(0.0f, std::strtof(value.c_str(), 0));
+        } else {
+            return false;
+        }
+    }
+    return !options.steps.empty();
+}
+
+sf::Keyboard::Key script_key(char c) {
+    switch (c) {
+    case 'L':
+        return sf::Keyboard::Left;
+    case 'R':
+        return sf::Keyboard::Right;
+    case 'U':
+        return sf::Keyboard::Up;
+    default:
+        return sf::Keyboard::Down;
+    }
+}
+
+// What the bots of one driver thread measured, merged into the step's.
+struct Stats {
+    std::vector<float> latency_ms;
+    u64 inputs = 0;
+    u64 host_ticks = 0;
+    u64 bytes_received = 0;
+
+    void merge(Stats &other) {
+        latency_ms.insert(latency_ms.end(), other.latency_ms.begin(),
+                          other.latency_ms.end());
+        inputs += other.inputs;
+        host_ticks += other.host_ticks;
+        bytes_received += other.bytes_received;
+        other = {};
+    }
+};
+
+// The shared state of a step, written by main and read by the drivers.
+struct Step {
+    std::atomic<u32> joined = 0;
+    std::atomic<u32> playing = 0;
+    std::atomic<u32> lost = 0;
+    std::atomic_bool ready = false;
+    std::atomic_bool measuring = false;
+    std::atomic_bool stop = false;
+};
+
+// One synthetic guest, the protocol side of GuestLobby without a game.
+struct Bot {
+    Bot(net::io_context &ctx, const Options &options, u32 index)
+        : network(ctx), options(options), rng(index) {
+        network.port = options.port + index % options.rooms;
+        network.blocking = false;
+        if (options.udp) {
+            network.transport = Network::Transport::Udp;
+        }
+        network.simulator.loss = options.loss;
+        network.simulator.latency_ms = options.latency_ms;
+        network.simulator.jitter_ms = options.jitter_ms;
+        network.simulator.rng.seed(index);
+        network.connect();
+        script_pos = index;
+    }
+
+    void poll(Step &step, Stats &stats, Clock::time_point now);
+
+    Network network;
+    const Options &options;
+    std::mt19937 rng;
+
+    Network::ClientID id = 0;
+    bool joined = false;
+    bool ready = false;
+    bool playing = false;
+    bool lost = false;
+    Clock::time_point next_join;
+    Clock::time_point next_heartbeat;
+    Clock::time_point next_input;
+    u32 host_time = 0;
+    u32 last_tick = 0;
+
+    u32 next_seq = 1;
+    std::deque<std::pair<u32, Clock::time_point>> pending;
+    size_t script_pos = 0;
+
+    Network::Buffer send_buffer;
+    Network::Buffer recv_buffer;
+
+private:
+    void send(const Message &msg) { encode(send_buffer, msg); }
+    void receive(Step &step, Stats &stats, Clock::time_point now);
+    void host_tick(u32 tick, Step &step, Stats &stats);
+    sf::Keyboard::Key next_key();
+};
+
+void Bot::poll(Step &step, Stats &stats, Clock::time_point now) {
+    if (lost || !network.connected())
+        return;
+
+    Message msg;
+    if (!joined && now >= next_join) {
+        msg.body = JoinRequest{PROTOCOL_VERSION, options.compression};
+        send(msg);
+        next_join = now + JOIN_RETRY;
+    }
+
+    if (joined && !ready && step.ready) {
+        msg.body = SetReady{true};
+        send(msg);
+        ready = true;
+    }
+
+    if (joined && now >= next_heartbeat) {
+        msg.body = HeartBeat{network.metrics.now_ms(), host_time};
+        host_time = 0;
+        send(msg);
+        next_heartbeat = now + HEARTBEAT_INTERVAL;
+    }
+
+    if (playing && now >= next_input) {
+        const u32 seq = next_seq++;
+        msg.body = PlayerInput{next_key(), true, seq};
+        send(msg);
+        pending.push_back({seq, now});
+        if (step.measuring)
+            stats.inputs++;
+        // spread the presses out so the bots do not press in lockstep
+        std::exponential_distribution<float> gap(options.input_rate);
+        next_input = now + std::chrono::duration_cast<Clock::duration>(
+                               std::chrono::duration<float>(gap(rng)));
+    }
+
+    if (!send_buffer.bytes.empty()) {
+        network.send(send_buffer, 0);
+        send_buffer.reset();
+    }
+
+    receive(step, stats, now);
+}
+
+void Bot::receive(Step &step, Stats &stats, Clock::time_point now) {
+    if (!network.recv(recv_buffer, 0)) {
+        lost = true;
+        step.lost++;
+        return;
+    }
+    if (step.measuring)
+        stats.bytes_received += recv_buffer.bytes.size();
+
+    Message msg;
+    while (decode(recv_buffer, msg)) {
+        if (auto m = std::get_if<JoinResponse>(&msg.body)) {
+            if (!joined) {
+                id = m->id;
+                joined = true;
+                network.set_compression(0, m->compression);
+                step.joined++;
+            }
+        } else if (auto m = std::get_if<HeartBeat>(&msg.body)) {
+            host_time = m->time;
+        } else if (std::holds_alternative<StartGame>(msg.body)) {
+            if (!playing) {
+                playing = true;
+                step.playing++;
+                next_input = now;
+            }
+        } else if (auto m = std::get_if<InputAck>(&msg.body)) {
+            while (!pending.empty() && pending.front().first <= m->seq) {
+                if (step.measuring) {
+                    stats.latency_ms.push_back(
+                        std::chrono::duration<float, std::milli>(
+                            now - pending.front().second)
+                            .count());
+                }
+                pending.pop_front();
+            }
+        } else if (auto m = std::get_if<TickUpdate>(&msg.body)) {
+            host_tick(m->tick, step, stats);
+        } else if (auto m = std::get_if<WorldSnapshot>(&msg.body)) {
+            // acknowledged like a guest would, so the host sends deltas
+            Message ack;
+            ack.body = SnapshotAck{m->tick};
+            send(ack);
+            host_tick(m->tick, step, stats);
+        }
+    }
+}
+
+// Counts the host ticks heard of, tick updates and snapshots overlap.
+void Bot::host_tick(u32 tick, Step &step, Stats &stats) {
+    if (tick <= last_tick)
+        return;
+    last_tick = tick;
+    if (step.measuring)
+        stats.host_ticks++;
+}
+
+sf::Keyboard::Key Bot::next_key() {
+    if (!options.script.empty())
+        return script_key(options.script[script_pos++ % options.script.size()]);
+
+    constexpr sf::Keyboard::Key keys[] = {
+        sf::Keyboard::Left, sf::Keyboard::Right, sf::Keyboard::Up,
+        sf::Keyboard::Down};
+    return keys[std::uniform_int_distribution<int>(0, 3)(rng)];
+}
+
+struct StepResult {
+    u32 clients = 0;
+    u32 joined = 0;
+    u32 playing = 0;
+    u32 lost = 0;
+    float inputs_per_s = 0.0f;
+    float ticks_per_s = 0.0f;
+    float kb_per_s = 0.0f;
+    float p50_ms = 0.0f;
+    float p99_ms = 0.0f;
+    float max_ms = 0.0f;
+    u64 samples = 0;
+};
+
+float percentile(std::vector<float> &v, float p) {
+    if (v.empty())
+        return 0.0f;
+    const size_t i = std::min(v.size() - 1, static_cast<size_t>(p * v.size()));
+    std::nth_element(v.begin(), v.begin() + i, v.end());
+    return v[i];
+}
+
+template <typename Pred>
+void wait_for(Pred pred, u32 timeout_s) {
+    const auto deadline = Clock::now() + std::chrono::seconds(timeout_s);
+    while (!pred() && Clock::now() < deadline) {
+        std::this_thread::sleep_for(10ms);
+    }
+}
+
+StepResult run_step(const Options &options, u32 clients) {
+    Step step;
+    std::vector<Stats> stats(options.threads);
+    std::vector<std::mutex> stats_mutex(options.threads);
+
+    // the bots go before the io_context they use, after its threads stopped
+    net::io_context ctx;
+    auto work = net::make_work_guard(ctx);
+    std::vector<std::thread> io_threads;
+    for (u32 i = 0; i < options.io_threads; ++i) {
+        io_threads.emplace_back([&ctx]() { ctx.run(); });
+    }
+
+    std::vector<std::unique_ptr<Bot>> bots;
+    for (u32 i = 0; i < clients; ++i) {
+        bots.push_back(std::make_unique<Bot>(ctx, options, i));
+    }
+
+    std::vector<std::thread> drivers;
+    for (u32 t = 0; t < options.threads; ++t) {
+        drivers.emplace_back([&, t]() {
+            Stats local;
+            while (!step.stop) {
+                const auto now = Clock::now();
+                for (size_t i = t; i < bots.size(); i += options.threads) {
+                    bots[i]->poll(step, local, now);
+                }
+                {
+                    std::lock_guard guard(stats_mutex[t]);
+                    stats[t].merge(local);
+                }
+                std::this_thread::sleep_for(POLL_INTERVAL);
+            }
+        });
+    }
+
+    StepResult result;
+    result.clients = clients;
+
+    wait_for([&]() { return step.joined + step.lost >= clients; },
+             options.join_timeout);
+    step.ready = true;
+    wait_for([&]() { return step.playing + step.lost >= clients; },
+             options.join_timeout);
+
+    for (u32 t = 0; t < options.threads; ++t) {
+        std::lock_guard guard(stats_mutex[t]);
+        stats[t] = {};
+    }
+    step.measuring = true;
+    std::this_thread::sleep_for(std::chrono::seconds(options.duration));
+    step.measuring = false;
+    step.stop = true;
+    for (auto &driver : drivers) {
+        driver.join();
+    }
+
+    Stats total;
+    for (auto &s : stats) {
+        total.merge(s);
+    }
+
+    ctx.stop();
+    work.reset();
+    for (auto &thread : io_threads) {
+        thread.join();
+    }
+    bots.clear();
+
+    const float seconds = options.duration;
+    result.joined = step.joined;
+    result.playing = step.playing;
+    result.lost = step.lost;
+    result.inputs_per_s = total.inputs / seconds;
+    result.ticks_per_s =
+        result.playing ? total.host_ticks / seconds / result.playing : 0.0f;
+    result.kb_per_s = total.bytes_received / seconds / 1024;
+    result.samples = total.latency_ms.size();
+    result.p50_ms = percentile(total.latency_ms, 0.5f);
+    result.p99_ms = percentile(total.latency_ms, 0.99f);
+    result.max_ms = percentile(total.latency_ms, 1.0f);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    Options options;
+    if (!parse(argc, argv, options)) {
+        usage(argv[0]);
+        return 1;
+    }
+    mute_messages = true;
+
+    std::ofstream csv;
+    if (!options.csv.empty()) {
+        csv.open(options.csv, std::ios::trunc);
+        csv << "clients,joined,playing,lost,inputs_per_s,host_ticks_per_s,"
+               "kb_per_s,samples,p50_ms,p99_ms,max_ms\n";
+    }
+
+    printf("clients  joined  playing  lost  inputs/s  ticks/s     KB/s  "
+           "p50 ms  p99 ms  max ms\n");
+    for (u32 clients : options.steps) {
+        const auto r = run_step(options, clients);
+        printf("%7u  %6u  %7u  %4u  %8.1f  %7.1f  %7.1f  %6.1f  %6.1f  "
+               "%6.1f\n",
+               r.clients, r.joined, r.playing, r.lost, r.inputs_per_s,
+               r.ticks_per_s, r.kb_per_s, r.p50_ms, r.p99_ms, r.max_ms);
+        if (csv) {
+            csv << r.clients << ',' << r.joined << ',' << r.playing << ','
+                << r.lost << ',' << r.inputs_per_s << ',' << r.ticks_per_s
+                << ',' << r.kb_per_s << ',' << r.samples << ',' << r.p50_ms
+                << ',' << r.p99_ms << ',' << r.max_ms << '\n';
+        }
+        // give the host time to notice everyone left and reopen its lobby
+        std::this_thread::sleep_for(2s);
+    }
+
+    return 0;
+}
@@ -1,10 +1,13 @@
+#include "allocs.h"
 #include "engine.h"
+#include "fonts.h"
 #include "network.h"
+#include "pack.h"
+#include "profile.h"
 #include "snake.h"
+#include "ui_state.h"
 #include "stable_win32.hpp"
 
-#include <experimental/coroutine>
-
 #ifdef _WIN32
 #ifdef _DEBUG
 #pragma comment(lib, "sfml-graphics-d.lib")
@@ -21,11 +24,13 @@ sf::RenderWindow *window = nullptr;
 
 namespace {
 
+// before the fonts, whose data it may hold
+Pack::Archive resources;
+
 sf::Font message_font;
 sf::Text message_text;
 
 u32 message_character_size = 14;
-u32 max_message = 10;
 bool console_input_focused = false;
 std::string console_input_text;
 sf::RectangleShape console_input_rectangle;
@@ -35,21 +40,6 @@ bool leftPressed = false;
 bool leftReleased = false;
 float dt = 0.0f;
 
-std::mutex message_mutex;
-
-struct Message {
-    static float SHOW_DELAY;
-    static float FADE_DELAY;
-
-    std::string text;
-    float show_delay = 5.0f;
-    Message(std::string text) : text(std::move(text)), show_delay(SHOW_DELAY) {}
-};
-float Message::SHOW_DELAY = 5.0f;
-float Message::FADE_DELAY = 1.0f;
-
-std::list<Message> messages;
-
 } // namespace
 
 namespace ui {
@@ -57,29 +47,22 @@ namespace ui {
 float PushButton::PRESS_TIMER = 0.2f;
 
 namespace {
-std::unordered_map<std::string, PushButton> push_button_map;
-std::unordered_map<std::string, ToggleButton> toggle_button_map;
 sf::Text label_text;
 } // namespace
 
 bool push_button(int x, int y, const std::string &label, Align h_align) {
-
-    PushButton *button = nullptr;
-    std::string display_name = label;
-
-    const auto pos = label.find("##");
-    if (pos != label.npos) {
-        display_name = label.substr(pos + 2);
-    }
-
-    if (auto it = push_button_map.find(label); it != push_button_map.end()) {
-        button = &it->second;
-        button->x = x;
-        button->y = y;
-    } else {
-        button = &push_button_map.insert({label, {}}).first->second;
-        button->x = x;
-        button->y = y;
+    PROFILE_ZONE("ui::push_button");
+
+    bool made;
+    PushButton *button = &push_button_state(label, made);
+    button->x = x;
+    button->y = y;
+    if (made) {
+        std::string display_name = label;
+        const auto pos = label.find("##");
+        if (pos != label.npos) {
+            display_name = label.substr(pos + 2);
+        }
         button->label.setString(display_name);
         button->label.setFont(message_font);
         button->label.setCharacterSize(30);
@@ -132,17 +115,13 @@ bool push_button(int x, int y, const std::string &label, Align h_align) {
 }
 
 bool toggle_button(int x, int y, const std::string &label, bool *var) {
+    PROFILE_ZONE("ui::toggle_button");
 
-    ToggleButton *button = nullptr;
-    if (auto it = toggle_button_map.find(label);
-        it != toggle_button_map.end()) {
-        button = &it->second;
-        button->x = x;
-        button->y = y;
-    } else {
-        button = &toggle_button_map.insert({label, {}}).first->second;
-        button->x = x;
-        button->y = y;
+    bool made;
+    ToggleButton *button = &toggle_button_state(label, made);
+    button->x = x;
+    button->y = y;
+    if (made) {
         button->label.setString(label);
         button->label.setFont(message_font);
         button->label.setCharacterSize(30);
@@ -186,6 +165,7 @@ bool toggle_button(int x, int y, const std::string &label, bool *var) {
 }
 
 void label(int x, int y, std::string fmt, ...) {
+    PROFILE_ZONE("ui::label");
     static char buffer[255];
     va_list args;
     va_start(args, fmt);
@@ -201,6 +181,7 @@ void label(int x, int y, std::string fmt, ...) {
 }
 
 void labelc(int x, int y, const sf::Color &color, std::string fmt, ...) {
+    PROFILE_ZONE("ui::labelc");
     static char buffer[255];
     va_list args;
     va_start(args, fmt);
@@ -215,6 +196,15 @@ void labelc(int x, int y, const sf::Color &color, std::string fmt, ...) {
     window->draw(label_text);
 }
 
+void text(int x, int y, const std::string &text, u32 size) {
+    PROFILE_ZONE("ui::text");
+    label_text.setFillColor({255, 255, 255, 255});
+    label_text.setCharacterSize(size);
+    label_text.setString(text);
+    label_text.setPosition(x, y);
+    window->draw(label_text);
+}
+
 } // namespace ui
 
 void draw_console_input() {
@@ -227,18 +217,18 @@ void draw_console_input() {
 }
 
 void draw_messages() {
-    std::lock_guard scope_guard(message_mutex);
+    std::lock_guard scope_guard(ui::message_mutex);
     int y = 0;
     message_text.setCharacterSize(message_character_size);
     bool first_message = true;
 
-    for (auto &msg : messages) {
+    for (auto &msg : ui::messages) {
         msg.show_delay -= dt;
 
         if (msg.show_delay > 0.0f) {
             message_text.setFillColor({255, 255, 255, 255});
         } else if (msg.show_delay < 0.0f &&
-                   msg.show_delay > -Message::FADE_DELAY) {
+                   msg.show_delay > -ui::LogMessage::FADE_DELAY) {
             message_text.setFillColor(
                 {255, 255, 255,
                  static_cast<sf::Uint8>(255 + 255 * msg.show_delay)});
@@ -259,92 +249,138 @@ void draw_messages() {
     }
 }
 
-// Entity *entity;
-// Entity *EntityID::operator->() {
-//    if (entity->id.uid == uid) {
-//        return entity;
-//    }
-//    return nullptr;
-//}
+// SNEK_TRACE_FILE overrides where F5 writes the profile.
+void write_trace() {
+    const char *path = std::getenv("SNEK_TRACE_FILE");
+    if (!path)
+        path = "snek-trace.json";
+    if (Profile::write_trace(path)) {
+        add_message("Wrote the last %zu frames to %s", Profile::HISTORY,
+                    path);
+    }
+}
 
-// EntityID::operator bool() { return entity->id.uid == uid; }
+SlotMap<Entity> entities;
 
-#include <utility>
+Entity *EntityID::operator->() const { return entities.get(*this); }
 
-int test() {
-    co_return(42);
-}
+EntityID::operator bool() const { return entities.contains(*this); }
+
+#include <utility>
 
 int main() {
 
     // Set stdout to unbuffered (auto stdout flush)
     setvbuf(stdout, NULL, _IONBF, 0);
+    const auto startup = std::chrono::steady_clock::now();
     SnakeGame snake;
 
+    const char *pack = std::getenv("SNEK_PACK");
+    if (resources.open(pack ? pack : "resources.pak")) {
+        add_message("Using the assets of %s", pack ? pack : "resources.pak");
+    }
+    // a pack may replace the embedded fonts, which stay when its own does
+    // not load. The name is only for the log.
+    auto load_font = [](sf::Font &font, u64 hash, const char *name,
+                        const Fonts::Asset &embedded) {
+        if (auto view = resources.view(hash)) {
+            if (Fonts::load(font, {view.data, view.size}))
+                return;
+            add_message("Could not load %s from the pack", name);
+        }
+        if (!Fonts::load(font, embedded)) {
+            add_message("Could not load the embedded %s", name);
+        }
+    };
+    constexpr auto INCONSOLATA = "fonts/Inconsolata-Regular.ttf";
+    constexpr auto ACT = "fonts/act.ttf";
+    // constants, so the names are hashed at compile time
+    constexpr u64 INCONSOLATA_HASH = Pack::hash(INCONSOLATA);
+    constexpr u64 ACT_HASH = Pack::hash(ACT);
+    load_font(message_font, INCONSOLATA_HASH, INCONSOLATA, Fonts::inconsolata);
+    load_font(snake.hand_font, ACT_HASH, ACT, Fonts::act);
+    // the atlases fill while the window opens
+    Fonts::Prewarm prewarm({{&message_font, {message_character_size, 30}},
+                            {&snake.hand_font, {200}}});
+
     window = new sf::RenderWindow({800, 800}, "Games",
                                   sf::Style::Titlebar | sf::Style::Close);
     window->setFramerateLimit(60);
     // window->setVerticalSyncEnabled(true);
 
-    message_font.loadFromFile("./resources/fonts/Inconsolata-Regular.ttf");
+    prewarm.wait();
     message_text.setFont(message_font);
     ui::label_text.setFont(message_font);
 
     snake.init();
+    bool first_frame = true;
 
     auto tp1 = std::chrono::high_resolution_clock::now();
     auto tp2 = std::chrono::high_resolution_clock::now();
 
-    Input input;
+    Input input(snake.frame_arena);
+    auto game_state = snake.state.index();
 
     while (window->isOpen()) {
         sf::Event ev;
-        input.clear();
 
-        while (window->pollEvent(ev)) {
-            if (ev.type == sf::Event::Closed) {
-                window->close();
-            }
+        {
+            PROFILE_ZONE("window.pollEvent");
+            Allocs::Scope scope(Allocs::Tag::Input);
+            while (window->pollEvent(ev)) {
+                // SFML gives events no time of their own, and only the
+                // thread that made the window may poll them
+                const auto polled = Input::Clock::now();
+                if (ev.type == sf::Event::Closed) {
+                    window->close();
+                }
 
-            else if (ev.type == sf::Event::MouseMoved) {
-                mouseX = ev.mouseMove.x;
-                mouseY = ev.mouseMove.y;
-            }
+                else if (ev.type == sf::Event::MouseMoved) {
+                    mouseX = ev.mouseMove.x;
+                    mouseY = ev.mouseMove.y;
+                }
 
-            else if (ev.type == sf::Event::MouseButtonPressed) {
-                if (ev.mouseButton.button == sf::Mouse::Left) {
-                    leftPressed = true;
+                else if (ev.type == sf::Event::MouseButtonPressed) {
+                    if (ev.mouseButton.button == sf::Mouse::Left) {
+                        leftPressed = true;
+                    }
                 }
-            }
 
-            else if (ev.type == sf::Event::MouseButtonReleased) {
-                if (ev.mouseButton.button == sf::Mouse::Left) {
-                    leftReleased = true;
+                else if (ev.type == sf::Event::MouseButtonReleased) {
+                    if (ev.mouseButton.button == sf::Mouse::Left) {
+                        leftReleased = true;
+                    }
                 }
-            }
 
-            else if (ev.type == sf::Event::TextEntered) {
-                // printf("key = %d\n", ev.text.unicode);
-                auto code = ev.text.unicode;
+                else if (ev.type == sf::Event::TextEntered) {
+                    // printf("key = %d\n", ev.text.unicode);
+                    auto code = ev.text.unicode;
 
-                if (code == 13) {
-                    console_input_focused = !console_input_focused;
-                }
-            } else if (ev.type == sf::Event::LostFocus) {
-                input.push(Input::LostFocus{});
-
-            } else {
-                if (ev.type == sf::Event::KeyPressed) {
-                    if (ev.key.code == sf::Keyboard::Q) {
-                        window->close();
-                    } else {
-                        input.push(Input::KeyPressed{ev.key.code});
+                    if (code == 13) {
+                        console_input_focused = !console_input_focused;
                     }
-                } else if (ev.type == sf::Event::KeyReleased) {
-                    if (ev.key.code == sf::Keyboard::Q) {
-                        //                        window->close();
-                    } else {
-                        input.push(Input::KeyReleased{ev.key.code});
+                } else if (ev.type == sf::Event::LostFocus) {
+                    input.push(Input::LostFocus{});
+
+                } else {
+                    if (ev.type == sf::Event::KeyPressed) {
+                        if (ev.key.code == sf::Keyboard::Q) {
+                            window->close();
+                        } else if (ev.key.code == sf::Keyboard::F4) {
+                            Profile::toggle_overlay();
+                        } else if (ev.key.code == sf::Keyboard::F5) {
+                            write_trace();
+                        } else {
+                            input.push(
+                                Input::KeyPressed{ev.key.code, polled});
+                        }
+                    } else if (ev.type == sf::Event::KeyReleased) {
+                        if (ev.key.code == sf::Keyboard::Q) {
+                            //                        window->close();
+                        } else {
+                            input.push(
+                                Input::KeyReleased{ev.key.code, polled});
+                        }
                     }
                 }
             }
@@ -354,39 +390,47 @@ int main() {
         tp2 = std::chrono::high_resolution_clock::now();
         dt = std::chrono::duration<float>(tp2 - tp1).count();
         tp1 = tp2;
-        snake.update(input, dt);
+        {
+            PROFILE_ZONE("SnakeGame::update");
+            snake.update(input, dt);
+        }
 
-        draw_messages();
+        {
+            Allocs::Scope scope(Allocs::Tag::Render);
+            {
+                PROFILE_ZONE("draw_messages");
+                draw_messages();
 
-        if (console_input_focused)
-            draw_console_input();
+                if (console_input_focused)
+                    draw_console_input();
+            }
+            Profile::draw_overlay(*window);
 
-        window->display();
+            PROFILE_ZONE("window.display");
+            window->display();
+            snake.input_latency.displayed();
+        }
+        if (first_frame) {
+            first_frame = false;
+            const std::chrono::duration<double, std::milli> took =
+                std::chrono::steady_clock::now() - startup;
+            add_message("First frame %.1f ms after startup", took.count());
+        }
 
         leftReleased = false;
         leftPressed = false;
+        input.clear();
+        snake.frame_arena.reset();
+
+        if (snake.state.index() != game_state) {
+            game_state = snake.state.index();
+            Allocs::settle();
+        }
+        Allocs::end_frame();
+        Profile::end_frame();
     }
 
+    printf("%s", Allocs::report().c_str());
+    printf("%s", snake.input_latency.summary().c_str());
     return 0;
 }
-
-void add_message(std::string fmt, ...) {
-    static char buffer[255];
-    std::lock_guard scope_guard(message_mutex);
-    auto t = std::time(nullptr);
-    auto tm = *std::localtime(&t);
-
-    std::ostringstream oss;
-    //    oss << std::put_time(&tm, "%d-%m-%Y %H-%M-%S");
-    oss << std::put_time(&tm, "[%H:%M:%S] ") << fmt;
-
-    va_list args;
-    va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), oss.str().c_str(), args);
-    va_end(args);
-    printf("%s\n", buffer);
-    messages.emplace_front(buffer);
-    if (messages.size() > max_message) {
-        messages.pop_back();
-    }
-}
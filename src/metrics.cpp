@@ -0,0 +1,238 @@
+#include "metrics.h"
+#include "engine.h"
+#include "stable_win32.hpp"
+
+#include <fstream>
+
+void Metrics::Histogram::add(u64 v) {
+    size_t i = 0;
+    while (i < buckets.size() - 1 && v >= (u64(1) << i))
+        ++i;
+    buckets[i]++;
+    count++;
+    sum += v;
+    max = std::max(max, v);
+}
+
+u64 Metrics::Histogram::percentile(float p) const {
+    const u64 rank = static_cast<u64>(p * count);
+    u64 seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen > rank)
+            return std::min(max, u64(1) << i);
+    }
+    return max;
+}
+
+void Metrics::Rtt::add(float ms) {
+    if (samples == 0) {
+        srtt_ms = ms;
+        jitter_ms = ms / 2;
+        min_ms = ms;
+        max_ms = ms;
+    } else {
+        jitter_ms += (std::abs(srtt_ms - ms) - jitter_ms) / 4;
+        srtt_ms += (ms - srtt_ms) / 8;
+        min_ms = std::min(min_ms, ms);
+        max_ms = std::max(max_ms, ms);
+    }
+    last_ms = ms;
+    samples++;
+}
+
+u32 Metrics::now_ms() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               Clock::now() - epoch)
+        .count();
+}
+
+void Metrics::count_sent(u8 type, size_t bytes, u32 copies) {
+    std::lock_guard guard(mutex);
+    auto &c = sent[std::min<size_t>(type, MAX_TYPES - 1)];
+    c.count += copies;
+    c.bytes += bytes * copies;
+}
+
+void Metrics::count_received(u8 type, size_t bytes) {
+    std::lock_guard guard(mutex);
+    auto &c = received[std::min<size_t>(type, MAX_TYPES - 1)];
+    c.count++;
+    c.bytes += bytes;
+}
+
+void Metrics::rtt_sample(ClientID id, float ms) {
+    std::lock_guard guard(mutex);
+    rtt[id].add(ms);
+}
+
+void Metrics::frame_sent(size_t bytes, size_t depth) {
+    std::lock_guard guard(mutex);
+    frame_size.add(bytes);
+    queue_depth.add(depth);
+}
+
+void Metrics::frame_written(Clock::time_point origin) {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+                        Clock::now() - origin)
+                        .count();
+    std::lock_guard guard(mutex);
+    send_latency.add(us);
+}
+
+void Metrics::forget(ClientID id) {
+    std::lock_guard guard(mutex);
+    rtt.erase(id);
+}
+
+std::string Metrics::summary() {
+    std::lock_guard guard(mutex);
+    const float seconds =
+        std::max(std::chrono::duration<float>(Clock::now() - since).count(),
+                 0.001f);
+    u64 tx = 0;
+    u64 rx = 0;
+    for (size_t i = 0; i < MAX_TYPES; ++i) {
+        tx += sent[i].bytes;
+        rx += received[i].bytes;
+    }
+
+    char line[128];
+    std::string out;
+    for (auto &[id, r] : rtt) {
+        snprintf(line, sizeof(line), "rtt %u: %.1f ms (jitter %.1f)\n", id,
+                 r.srtt_ms, r.jitter_ms);
+        out += line;
+    }
+    snprintf(line, sizeof(line), "tx %.1f KB/s  rx %.1f KB/s\n",
+             tx / seconds / 1024, rx / seconds / 1024);
+    out += line;
+    snprintf(line, sizeof(line),
+             "frame p50 %llu B  p99 %llu B  queue p99 %llu\n",
+             static_cast<unsigned long long>(frame_size.percentile(0.5f)),
+             static_cast<unsigned long long>(frame_size.percentile(0.99f)),
+             static_cast<unsigned long long>(queue_depth.percentile(0.99f)));
+    out += line;
+    snprintf(line, sizeof(line), "tick to send p50 %llu us  p99 %llu us\n",
+             static_cast<unsigned long long>(send_latency.percentile(0.5f)),
+             static_cast<unsigned long long>(send_latency.percentile(0.99f)));
+    out += line;
+    return out;
+}
+
+std::string Metrics::report() {
+    std::ostringstream oss;
+    oss << summary();
+
+    std::lock_guard guard(mutex);
+    oss << "\nmessage            sent    bytes      received  bytes\n";
+    char line[128];
+    for (size_t i = 0; i < MAX_TYPES; ++i) {
+        if (sent[i].count == 0 && received[i].count == 0)
+            continue;
+        snprintf(line, sizeof(line), "%-16s %8llu %10llu %8llu %10llu\n",
+                 type_name ? type_name(i) : std::to_string(i).c_str(),
+                 static_cast<unsigned long long>(sent[i].count),
+                 static_cast<unsigned long long>(sent[i].bytes),
+                 static_cast<unsigned long long>(received[i].count),
+                 static_cast<unsigned long long>(received[i].bytes));
+        oss << line;
+    }
+
+    oss << "\nrtt       samples  last ms  srtt ms  jitter   min ms   max ms\n";
+    for (auto &[id, r] : rtt) {
+        snprintf(line, sizeof(line),
+                 "%-8u %8llu %8.1f %8.1f %8.1f %8.1f %8.1f\n", id,
+                 static_cast<unsigned long long>(r.samples), r.last_ms,
+                 r.srtt_ms, r.jitter_ms, r.min_ms, r.max_ms);
+        oss << line;
+    }
+
+    auto histogram = [&oss](const char *name, const Histogram &h) {
+        oss << "\n" << name << ": count " << h.count << "  mean " << h.mean()
+            << "  max " << h.max << "\n";
+        for (size_t i = 0; i < h.buckets.size(); ++i) {
+            if (h.buckets[i] > 0)
+                oss << "  < " << (u64(1) << i) << ": " << h.buckets[i] << "\n";
+        }
+    };
+    histogram("frame size (bytes)", frame_size);
+    histogram("queue depth (frames)", queue_depth);
+    histogram("tick to send (us)", send_latency);
+
+    return oss.str();
+}
+
+void Metrics::reset() {
+    std::lock_guard guard(mutex);
+    sent = {};
+    received = {};
+    frame_size = {};
+    queue_depth = {};
+    send_latency = {};
+    since = Clock::now();
+}
+
+void Metrics::update() {
+    if (dump_path.empty() || Clock::now() < next_dump)
+        return;
+    next_dump = Clock::now() + dump_interval;
+
+    std::ofstream file(dump_path, std::ios::trunc);
+    if (!file) {
+        add_message("Cannot write metrics to %s", dump_path.c_str());
+        dump_path.clear();
+        return;
+    }
+    file << report();
+}
+
+MetricsEndpoint::MetricsEndpoint(net::io_context &ctx, u16 port,
+                                 std::function<std::string()> report)
+    : acceptor(ctx), report(std::move(report)) {
+    try {
+        const net::ip::tcp::endpoint endpoint(net::ip::address_v4::loopback(),
+                                              port);
+        acceptor.open(endpoint.protocol());
+        acceptor.set_option(net::socket_base::reuse_address(true));
+        acceptor.bind(endpoint);
+        acceptor.listen();
+        accept();
+        add_message("Serving metrics on 127.0.0.1:%u", port);
+    } catch (std::exception &e) {
+        add_message("Failed to serve metrics: %s", e.what());
+    }
+}
+
+// The answer waits for the end of the request's headers. Closing with the
+// request still unread would have the client see a reset instead of it.
+void MetricsEndpoint::accept() {
+    acceptor.async_accept([this](std::error_code ec,
+                                 net::ip::tcp::socket socket) {
+        if (ec)
+            return;
+
+        auto client = std::make_shared<Client>(Client{std::move(socket), {}});
+        net::async_read_until(
+            client->socket, net::dynamic_buffer(client->request, MAX_REQUEST),
+            "\r\n\r\n", [this, client](std::error_code ec, size_t) {
+                if (!ec)
+                    respond(client);
+            });
+        accept();
+    });
+}
+
+void MetricsEndpoint::respond(std::shared_ptr<Client> client) {
+    auto body = report();
+    auto text = std::make_shared<std::string>(
+        "HTTP/1.0 200 OK\r\nContent-Type: text/plain\r\n"
+        "Content-Length: " +
+        std::to_string(body.size()) + "\r\n\r\n" + body);
+    net::async_write(client->socket, net::buffer(*text),
+                     [client, text](std::error_code, size_t) {
+                         std::error_code ec;
+                         client->socket.shutdown(
+                             net::socket_base::shutdown_both, ec);
+                     });
+}
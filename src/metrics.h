@@ -0,0 +1,104 @@
+#pragma once
+#include "stable_win32.hpp"
+namespace net = std::experimental::net;
+
+// Counters for one Network: round trip times from the timestamped
+// heartbeats, per message type traffic and a few histograms. Written from
+// the game thread and the io thread, hence the mutex.
+struct Metrics {
+    using Clock = std::chrono::steady_clock;
+    using ClientID = u32;
+
+    static constexpr size_t MAX_TYPES = 32;
+
+    // Power of two buckets, bucket i counts values below 2^i.
+    struct Histogram {
+        std::array<u64, 33> buckets{};
+        u64 count = 0;
+        u64 sum = 0;
+        u64 max = 0;
+
+        void add(u64 v);
+        // upper bound of the bucket holding the p-th fraction of the values
+        u64 percentile(float p) const;
+        float mean() const { return count ? float(sum) / count : 0.0f; }
+    };
+
+    struct Counter {
+        u64 count = 0;
+        u64 bytes = 0;
+    };
+
+    // Smoothed like TCP does it (RFC 6298), jitter is the mean deviation.
+    struct Rtt {
+        u64 samples = 0;
+        float last_ms = 0.0f;
+        float srtt_ms = 0.0f;
+        float jitter_ms = 0.0f;
+        float min_ms = 0.0f;
+        float max_ms = 0.0f;
+
+        void add(float ms);
+    };
+
+    std::mutex mutex;
+
+    std::array<Counter, MAX_TYPES> sent{};
+    std::array<Counter, MAX_TYPES> received{};
+    std::unordered_map<ClientID, Rtt> rtt;
+
+    Histogram frame_size;   // bytes per frame handed to send
+    Histogram queue_depth;  // frames queued behind a new one
+    Histogram send_latency; // us from the end of a tick to the write
+
+    const char *(*type_name)(u8 type) = nullptr;
+
+    Clock::time_point epoch = Clock::now();
+    // rates in summary are over the time since the last reset
+    Clock::time_point since = Clock::now();
+
+    // ms since the Network started, what heartbeats carry
+    u32 now_ms() const;
+
+    void count_sent(u8 type, size_t bytes, u32 copies = 1);
+    void count_received(u8 type, size_t bytes);
+    void rtt_sample(ClientID id, float ms);
+    void frame_sent(size_t bytes, size_t depth);
+    void frame_written(Clock::time_point origin);
+    void forget(ClientID id);
+
+    // a few lines for the in game overlay
+    std::string summary();
+    // everything, as plain text
+    std::string report();
+    void reset();
+
+    // Writes report to path every interval, from update.
+    std::string dump_path;
+    Clock::duration dump_interval = std::chrono::seconds(5);
+    Clock::time_point next_dump = Clock::now();
+    void update();
+};
+
+// Serves a plain text report over HTTP on a loopback port, one request per
+// connection.
+class MetricsEndpoint {
+public:
+    MetricsEndpoint(net::io_context &ctx, u16 port,
+                    std::function<std::string()> report);
+
+private:
+    // a request whose headers do not fit is dropped
+    static constexpr size_t MAX_REQUEST = 8192;
+
+    struct Client {
+        net::ip::tcp::socket socket;
+        std::string request;
+    };
+
+    void accept();
+    void respond(std::shared_ptr<Client> client);
+
+    net::ip::tcp::acceptor acceptor;
+    std::function<std::string()> report;
+};
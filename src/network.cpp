@@ -1,60 +1,107 @@
 #include "network.h"
+#include "allocs.h"
+#include "compress.h"
 #include "engine.h"
+#include "profile.h"
 #include "stable_win32.hpp"
 
-static constexpr auto PORT = "5677";
-static constexpr auto PORTN = 5677;
-static constexpr auto IP = "localhost";
+#include <fstream>
 
-Network::Client::Client(net::io_context &ctx) : socket(ctx), resolver(ctx) {}
+Network::SendQueue::SendQueue(net::io_context &ctx) : release_timer(ctx) {}
+
+Network::Reader::Reader(net::io_context &ctx) : idle_timer(ctx) {}
+
+Network::Client::Client(net::io_context &ctx)
+    : socket(ctx), resolver(ctx), queue(ctx), reader(ctx) {}
 
 Network::ConnectedClient::ConnectedClient(net::io_context &ctx,
                                           net::ip::tcp::socket socket_)
-    : socket(std::move(socket_)) {}
+    : socket(std::move(socket_)), queue(ctx), reader(ctx) {}
 
 Network::Server::Server(net::io_context &ctx) : acceptor(ctx) {}
 
 Network::~Network() {
-    ctx.stop();
-    work.reset();
-    work_thread.join();
+    if (work_thread.joinable()) {
+        ctx.stop();
+        work.reset();
+        work_thread.join();
+    }
 }
 
 void Network::update() {}
 
 Network::Network()
-    : work(net::make_work_guard(ctx)), work_thread([this]() { ctx.run(); }) {
+    : ctx(own_ctx.emplace()), work(net::make_work_guard(ctx)),
+      work_thread([this]() {
+          Allocs::Scope scope(Allocs::Tag::Net);
+          ctx.run();
+      }) {
+    state.emplace<None>();
+}
+
+Network::Network(net::io_context &shared) : ctx(shared) {
     state.emplace<None>();
 }
 
 void Network::connect() {
     add_message("connecting to server");
 
+    if (transport == Transport::Udp) {
+        udp_connect();
+        return;
+    }
+
     state.emplace<Client>(ctx);
-    auto &client = std::get<Client>(state);
+    connect_session();
+}
+
+// Starts on the calling thread and goes on on the io thread once connected.
+coro::Detached Network::connect_session() {
+    auto &pending = std::get<Client>(state);
+    std::error_code ec;
+    auto endpoints = pending.resolver.resolve(IP, std::to_string(port), ec);
+    if (!ec) {
+        std::tie(ec, std::ignore) =
+            co_await coro::async_connect(pending.socket, endpoints);
+        // a later connect replaced this client
+        if (ec == std::errc::operation_canceled)
+            co_return;
+    }
 
-    net::async_connect(client.socket, client.resolver.resolve(IP, PORT),
-                       [&client](auto ec, auto endpoint) {
-                           if (!ec) {
-                               add_message("connected to localhost");
-                               client.connected = true;
-                           } else {
-                               add_message("Failed to connect: %s",
-                                           ec.message().c_str());
-                               client.connected = false;
-                           }
-                       });
+    std::unique_lock lock(mutex);
+    auto client = std::get_if<Client>(&state);
+    if (!client)
+        co_return;
+
+    if (ec) {
+        add_message("Failed to connect: %s", ec.message().c_str());
+        client->connected = false;
+        co_return;
+    }
+
+    add_message("connected to localhost");
+    client->connected = true;
+    if (!blocking) {
+        lock.unlock();
+        read_loop(0);
+        watchdog(0);
+    }
 }
 
 void Network::start_server() {
 
+    if (transport == Transport::Udp) {
+        udp_start_server();
+        return;
+    }
+
     try {
         auto &server = state.emplace<Server>(ctx);
-        server.endpoint = net::ip::tcp::endpoint(net::ip::tcp::v4(), PORTN);
+        server.endpoint = net::ip::tcp::endpoint(net::ip::tcp::v4(), port);
         server.acceptor.open(server.endpoint.protocol());
         server.acceptor.bind(server.endpoint);
         server.acceptor.listen();
-        start_accept();
+        accept_loop();
     } catch (std::exception &e) {
         add_message("Failed to start server: %s", e.what());
         state.emplace<None>();
@@ -64,8 +111,10 @@ void Network::start_server() {
 }
 
 void Network::stop_server() {
+    std::lock_guard guard(mutex);
     try {
-        if (auto server = std::get_if<Server>(&state)) {
+        if (std::holds_alternative<Server>(state) ||
+            std::holds_alternative<UdpServer>(state)) {
             state.emplace<None>();
         }
     } catch (std::exception &e) {
@@ -74,121 +123,577 @@ void Network::stop_server() {
     add_message("Stopped server");
 }
 
-void Network::start_accept() {
-    if (auto server = std::get_if<Server>(&state); server) {
-        server->acceptor.async_accept(
-            [this](std::error_code ec, net::ip::tcp::socket socket) {
-                std::lock_guard guard(mutex);
-                if (auto server = std::get_if<Server>(&state)) {
-                    if (!ec) {
-                        const auto id = server->unique_client_id++;
-                        server->clients.try_emplace(id, ctx, std::move(socket));
-                        new_clients.push(id);
-                        start_accept();
+// Gives every accepted socket its sessions until the acceptor closes.
+coro::Detached Network::accept_loop() {
+    std::unique_lock lock(mutex);
+    for (;;) {
+        auto server = std::get_if<Server>(&state);
+        if (!server)
+            co_return;
+
+        auto [ec, socket] =
+            co_await coro::async_accept(server->acceptor, &lock);
+        server = std::get_if<Server>(&state);
+        if (ec || !server)
+            co_return;
 
-                        add_message("A client has connected to the server!");
-                    } else {
-                    }
-                }
-            });
+        const auto id = server->unique_client_id++;
+        // the socket closes as it goes out of scope
+        if (!new_clients.push(id)) {
+            add_message("Refused client %u: too many pending connections",
+                        id);
+            continue;
+        }
+        server->clients.try_emplace(id, ctx, std::move(socket));
+        add_message("A client has connected to the server!");
+
+        if (!blocking) {
+            lock.unlock();
+            read_loop(id);
+            watchdog(id);
+            lock.lock();
+        }
     }
 }
 
 std::optional<Network::ClientID> Network::get_new_client() {
-    if (new_clients.size() > 0)
-        return new_clients.pop();
-    return {};
+    return new_clients.pop();
 }
 
-void Network::send(Buffer &b, ClientID id) {
+std::pair<net::ip::tcp::socket *, Network::SendQueue *>
+Network::connection(ClientID id) {
+    if (auto server = std::get_if<Server>(&state)) {
+        if (auto it = server->clients.find(id); it != server->clients.end()) {
+            return {&it->second.socket, &it->second.queue};
+        }
+    } else if (auto client = std::get_if<Client>(&state)) {
+        return {&client->socket, &client->queue};
+    }
+    return {nullptr, nullptr};
+}
 
+std::pair<net::ip::tcp::socket *, Network::Reader *>
+Network::reading(ClientID id) {
     if (auto server = std::get_if<Server>(&state)) {
-        auto it = server->clients.find(id);
-        if (it != server->clients.end()) {
-            u32 to_send = b.bytes.size();
-            std::error_code ec;
-            net::write(it->second.socket,
-                       net::const_buffer(&to_send, sizeof(to_send)), ec);
-
-            auto size =
-                net::write(it->second.socket,
-                           net::const_buffer(b.bytes.data(), to_send), ec);
-            bytes_sent += size + sizeof(to_send);
-            //            printf("write %u / %u bytes\n", size, to_send);
+        if (auto it = server->clients.find(id); it != server->clients.end()) {
+            return {&it->second.socket, &it->second.reader};
         }
     } else if (auto client = std::get_if<Client>(&state)) {
-        std::error_code ec;
-        u32 to_send = b.bytes.size();
-        net::write(client->socket, net::const_buffer(&to_send, sizeof(to_send)),
-                   ec);
-        auto size = net::write(client->socket,
-                               net::const_buffer(b.bytes.data(), to_send), ec);
-        bytes_sent += size + sizeof(to_send);
-        // printf("write %u / %u bytes\n", size, to_send);
+        return {&client->socket, &client->reader};
     }
+    return {nullptr, nullptr};
 }
 
+// Reads frames into the inbox, the size prefix first and then the payload,
+// until the socket fails. Whatever the client was looked up to is looked up
+// again after each read, the game thread may have let it go meanwhile.
+coro::Detached Network::read_loop(ClientID id) {
+    std::unique_lock lock(mutex);
+    for (;;) {
+        auto [socket, reader] = reading(id);
+        if (!socket)
+            co_return;
+
+        auto [ec, size] = co_await coro::async_read(
+            *socket,
+            net::buffer(&reader->incoming_size, sizeof(reader->incoming_size)),
+            &lock);
+        std::tie(socket, reader) = reading(id);
+        if (!socket)
+            co_return;
+        if (ec) {
+            read_failed(id, *reader, ec);
+            co_return;
+        }
+        if ((reader->incoming_size & ~COMPRESSED_FRAME) > MAX_FRAME_SIZE) {
+            reader->failed = true;
+            drop_connection(id, "frame too large");
+            co_return;
+        }
+
+        reader->incoming.resize(reader->incoming_size & ~COMPRESSED_FRAME);
+        std::tie(ec, size) = co_await coro::async_read(
+            *socket, net::buffer(reader->incoming), &lock);
+        std::tie(socket, reader) = reading(id);
+        if (!socket)
+            co_return;
+        if (ec) {
+            read_failed(id, *reader, ec);
+            co_return;
+        }
+
+        bytes_received += size + sizeof(u32);
+        reader->last_heard = Clock::now();
+        if (reader->incoming_size & COMPRESSED_FRAME) {
+            // on the io thread, never across a co_await
+            PROFILE_ZONE("Network::decompress");
+            auto &frame = reader->inbox.emplace_back();
+            if (!Compression::decompress(reader->incoming.data(),
+                                         reader->incoming.size(), frame,
+                                         MAX_FRAME_SIZE)) {
+                reader->inbox.pop_back();
+                reader->failed = true;
+                drop_connection(id, "bad compressed frame");
+                co_return;
+            }
+        } else {
+            reader->inbox.push_back(std::move(reader->incoming));
+        }
+    }
+}
+
+// Must be called with mutex held. Ends the reads like the writes end, with
+// the connection dropped and the reason logged, a peer closing included.
+void Network::read_failed(ClientID id, Reader &reader, std::error_code ec) {
+    reader.failed = true;
+    read_errors++;
+    drop_connection(id, ec.message().c_str());
+}
+
+// Drops a connection that went quiet, such as a peer that vanished
+// without closing its socket.
+coro::Detached Network::watchdog(ClientID id) {
+    if (idle_timeout == Clock::duration::zero())
+        co_return;
+
+    std::unique_lock lock(mutex);
+    for (;;) {
+        auto [socket, reader] = reading(id);
+        if (!socket || reader->failed)
+            co_return;
+
+        const auto quiet = Clock::now() - reader->last_heard;
+        if (quiet >= idle_timeout) {
+            drop_connection(id, "timed out");
+            co_return;
+        }
+
+        reader->idle_timer.expires_after(idle_timeout - quiet);
+        if (co_await coro::async_wait(reader->idle_timer, &lock))
+            co_return;
+    }
+}
+
+void Network::send(Buffer &b, ClientID id, Channel channel) {
+    Frame frame;
+    frame.append(std::make_shared<const std::vector<u8>>(b.bytes));
+    send(frame, id, channel);
+}
+
+// Only the segment pointers are queued, the bytes stay shared with every
+// other connection the same segments were sent to.
+void Network::send(const Frame &f, ClientID id, Channel channel) {
+    PROFILE_ZONE("Network::send");
+    if (recording) {
+        record(f);
+    }
+
+    if (transport == Transport::Udp) {
+        udp_send(f, id, channel);
+        return;
+    }
+
+    std::lock_guard guard(mutex);
+    auto [socket, queue] = connection(id);
+    if (!socket || queue->closed)
+        return;
+
+    u32 to_send = f.size;
+    if (queue->frames.size() >= send_limits.max_frames ||
+        queue->queued_bytes + to_send > send_limits.max_bytes) {
+        queue->stats.frames_dropped++;
+        if (send_limits.policy == LagPolicy::Disconnect) {
+            drop_connection(id, "send queue full");
+        }
+        return;
+    }
+
+    auto segments = f.segments;
+    u32 prefix = to_send;
+    if (queue->compress && to_send >= MIN_COMPRESSED_SIZE) {
+        if (auto packed = compress(f)) {
+            queue->stats.raw_bytes += f.size;
+            queue->stats.compressed_bytes += packed->size();
+            to_send = packed->size();
+            prefix = to_send | COMPRESSED_FRAME;
+            segments = {std::move(packed)};
+        }
+    }
+
+    metrics.frame_sent(to_send, queue->frames.size());
+
+    auto &frame = queue->frames.emplace_back();
+    frame.size = prefix;
+    frame.segments = std::move(segments);
+    frame.queued = Clock::now();
+    frame.origin = f.origin == Clock::time_point{} ? frame.queued : f.origin;
+    frame.release = simulator.active() ? release(*queue, frame.queued)
+                                       : frame.queued;
+    queue->queued_bytes += to_send + sizeof(frame.size);
+
+    auto &stats = queue->stats;
+    stats.queue_depth = queue->frames.size();
+    stats.max_queue_depth = std::max(stats.max_queue_depth, stats.queue_depth);
+
+    if (!queue->writing) {
+        queue->writing = true;
+        net::post(ctx, [this, id]() { write_loop(id); });
+    }
+}
+
+// The frame as one compressed segment, null when that is not smaller.
+// Compressed once per frame, however many connections it goes to.
+Network::SharedBytes Network::compress(const Frame &frame) {
+    if (frame.packed)
+        return *frame.packed;
+
+    PROFILE_ZONE("Network::compress");
+    std::vector<u8> raw;
+    raw.reserve(frame.size);
+    for (auto &segment : frame.segments) {
+        raw.insert(raw.end(), segment->begin(), segment->end());
+    }
+
+    std::vector<u8> packed;
+    Compression::compress(raw.data(), raw.size(), packed);
+    frame.packed = nullptr;
+    if (packed.size() < raw.size()) {
+        frame.packed =
+            std::make_shared<const std::vector<u8>>(std::move(packed));
+    }
+    return *frame.packed;
+}
+
+// When the simulated link hands over a frame sent now. TCP loses nothing:
+// a lost segment is resent after the retransmission timeout, which doubles
+// with every retry, and the stream stalls until it gets through.
+Network::Clock::time_point Network::release(SendQueue &queue,
+                                            Clock::time_point now) {
+    auto &sim = simulator;
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    float delay_ms = sim.latency_ms;
+    if (sim.jitter_ms > 0.0f) {
+        delay_ms += sim.jitter_ms * (2.0f * uniform(sim.rng) - 1.0f);
+    }
+    // at least Linux's minimum
+    float rto_ms = std::max(200.0f, 4.0f * sim.latency_ms);
+    while (sim.loss > 0.0f && uniform(sim.rng) < sim.loss) {
+        sim.dropped++;
+        delay_ms += rto_ms;
+        rto_ms *= 2.0f;
+    }
+
+    const auto at =
+        now + std::chrono::duration_cast<Clock::duration>(
+                  std::chrono::duration<float, std::milli>(
+                      std::max(delay_ms, 0.0f)));
+    queue.last_release = std::max(queue.last_release, at);
+    return queue.last_release;
+}
+
+void Network::LinkSimulator::from_env() {
+    if (auto v = std::getenv("SNEK_LINK_LOSS")) {
+        loss = std::clamp(std::strtof(v, nullptr), 0.0f, 1.0f);
+    }
+    if (auto v = std::getenv("SNEK_LINK_LATENCY")) {
+        latency_ms = std::max(std::strtof(v, nullptr), 0.0f);
+    }
+    if (auto v = std::getenv("SNEK_LINK_JITTER")) {
+        jitter_ms = std::max(std::strtof(v, nullptr), 0.0f);
+    }
+}
+
+void Network::record_frames(const std::string &path) {
+    recording = std::make_unique<std::ofstream>(
+        path, std::ios::binary | std::ios::trunc);
+    if (!*recording) {
+        add_message("Cannot record frames to %s", path.c_str());
+        recording.reset();
+    }
+}
+
+// Only ever called from the thread that sends.
+void Network::record(const Frame &frame) {
+    recording->write(reinterpret_cast<const char *>(&frame.size),
+                     sizeof(frame.size));
+    for (auto &segment : frame.segments) {
+        recording->write(reinterpret_cast<const char *>(segment->data()),
+                         segment->size());
+    }
+}
+
+// Hands every queued frame to one gathered write, again and again until
+// the queue runs dry. send starts it on the io thread.
+coro::Detached Network::write_loop(ClientID id) {
+    std::unique_lock lock(mutex);
+    for (;;) {
+        auto [socket, queue] = connection(id);
+        if (!socket)
+            co_return;
+
+        if (queue->closed || queue->frames.empty()) {
+            queue->writing = false;
+            co_return;
+        }
+
+        // frames are released in order, the link simulator holds them back
+        const auto start = Clock::now();
+        if (queue->frames.front().release > start) {
+            queue->release_timer.expires_at(queue->frames.front().release);
+            if (co_await coro::async_wait(queue->release_timer, &lock))
+                co_return;
+            continue;
+        }
+        auto released = std::find_if(
+            queue->frames.begin(), queue->frames.end(),
+            [start](auto &frame) { return frame.release > start; });
+
+        // the batch keeps the segments alive until the write completes
+        std::vector<OutFrame> batch(
+            std::make_move_iterator(queue->frames.begin()),
+            std::make_move_iterator(released));
+        queue->frames.erase(queue->frames.begin(), released);
+        for (auto &frame : batch) {
+            queue->queued_bytes -=
+                (frame.size & ~COMPRESSED_FRAME) + sizeof(frame.size);
+        }
+        queue->stats.queue_depth = queue->frames.size();
+
+        std::vector<net::const_buffer> buffers;
+        for (auto &frame : batch) {
+            buffers.push_back(net::buffer(&frame.size, sizeof(frame.size)));
+            for (auto &segment : frame.segments) {
+                buffers.push_back(net::buffer(*segment));
+            }
+        }
+
+        auto [ec, size] = co_await coro::async_write(*socket, buffers, &lock);
+        std::tie(socket, queue) = connection(id);
+        if (!socket)
+            co_return;
+
+        if (ec) {
+            queue->writing = false;
+            drop_connection(id, ec.message().c_str());
+            co_return;
+        }
+
+        bytes_sent += size;
+
+        const auto now = Clock::now();
+        auto &stats = queue->stats;
+        stats.bytes_sent += size;
+        for (auto &frame : batch) {
+            const float ms =
+                std::chrono::duration<float, std::milli>(now - frame.queued)
+                    .count();
+            stats.frames_sent++;
+            stats.last_latency_ms = ms;
+            stats.avg_latency_ms += (ms - stats.avg_latency_ms) * 0.1f;
+            stats.max_latency_ms = std::max(stats.max_latency_ms, ms);
+            metrics.frame_written(frame.origin);
+        }
+    }
+}
+
+// Must be called with mutex held. Shutting the socket down also wakes up a
+// blocking recv on the game thread, which then reports the client as gone.
+void Network::drop_connection(ClientID id, const char *reason) {
+    auto [socket, queue] = connection(id);
+    if (!socket || queue->closed)
+        return;
+
+    queue->closed = true;
+    queue->frames.clear();
+    queue->queued_bytes = 0;
+
+    std::error_code ec;
+    socket->shutdown(net::socket_base::shutdown_both, ec);
+
+    if (auto client = std::get_if<Client>(&state)) {
+        client->connected = false;
+        add_message("Dropped connection to server: %s", reason);
+    } else {
+        add_message("Dropped client %d: %s", id, reason);
+    }
+}
+
+void Network::disconnect(ClientID id) {
+    std::lock_guard guard(mutex);
+    metrics.forget(id);
+    if (auto server = std::get_if<Server>(&state)) {
+        server->clients.erase(id);
+    } else if (auto server = std::get_if<UdpServer>(&state)) {
+        server->peers.erase(id);
+    }
+}
+
+void Network::serve_metrics(u16 port) {
+    metrics_endpoint = std::make_unique<MetricsEndpoint>(
+        ctx, port, [this]() { return metrics.report(); });
+}
+
+void Network::set_compression(ClientID id, bool on) {
+    std::lock_guard guard(mutex);
+    if (auto [socket, queue] = connection(id); queue) {
+        queue->compress = on;
+    } else if (auto peer = udp_peer(id)) {
+        peer->compress = on;
+    }
+}
+
+std::optional<Network::SendStats> Network::send_stats(ClientID id) {
+    std::lock_guard guard(mutex);
+    if (auto [socket, queue] = connection(id); queue) {
+        return queue->stats;
+    } else if (auto peer = udp_peer(id)) {
+        return peer->stats;
+    }
+    return {};
+}
+
+// Appends the payload of the next frame to b.
+bool Network::read_frame(net::ip::tcp::socket &socket, Buffer &b,
+                         std::error_code &ec) {
+    u32 prefix = 0;
+    net::read(socket, net::buffer(&prefix, sizeof(prefix)), ec);
+    if (ec)
+        return false;
+
+    const u32 to_read = prefix & ~COMPRESSED_FRAME;
+    if (to_read > MAX_FRAME_SIZE) {
+        ec = std::make_error_code(std::errc::message_size);
+        return false;
+    }
+
+    if (!(prefix & COMPRESSED_FRAME)) {
+        auto size = net::read(socket, net::dynamic_buffer(b.bytes),
+                              net::transfer_exactly(to_read), ec);
+        bytes_received += size + sizeof(prefix);
+        return !ec;
+    }
+
+    std::vector<u8> packed(to_read);
+    auto size = net::read(socket, net::buffer(packed), ec);
+    bytes_received += size + sizeof(prefix);
+    if (ec)
+        return false;
+    if (!Compression::decompress(packed.data(), packed.size(), b.bytes,
+                                 MAX_FRAME_SIZE)) {
+        ec = std::make_error_code(std::errc::illegal_byte_sequence);
+        return false;
+    }
+    return true;
+}
+
+// Blocks for one frame, then also takes the frames that already arrived so
+// a peer sending several frames per tick does not build up a backlog. A
+// server that is not blocking only takes what its background reads got.
 bool Network::recv(Buffer &b, ClientID id) {
+    PROFILE_ZONE("Network::recv");
     b.reset();
 
-    if (auto server = std::get_if<Server>(&state)) {
-        if (auto it = server->clients.find(id); it != server->clients.end()) {
-            auto &client = it->second;
-            std::error_code ec;
-            u32 to_read = 0;
-            net::read(client.socket, net::dynamic_buffer(b.bytes),
-                      net::transfer_exactly(sizeof(to_read)));
-            b.read(to_read);
-            // b.reset();
-            auto size = net::read(client.socket, net::dynamic_buffer(b.bytes),
-                                  net::transfer_exactly(to_read));
-
-            bytes_received += size + sizeof(to_read);
-            // printf("read %u bytes\n", size);
-            if (!ec) {
-                return true;
-            } else {
-                add_message("Error when reading from client %d: %s", id,
-                            ec.message().c_str());
-                return false;
+    if (transport == Transport::Udp) {
+        return udp_recv(b, id);
+    }
+
+    if (!blocking) {
+        std::lock_guard guard(mutex);
+        auto [socket, reader] = reading(id);
+        if (!reader || (reader->failed && reader->inbox.empty())) {
+            if (auto client = std::get_if<Client>(&state)) {
+                client->connected = false;
             }
+            return false;
         }
 
+        for (auto &frame : reader->inbox) {
+            b.bytes.insert(b.bytes.end(), frame.begin(), frame.end());
+        }
+        reader->inbox.clear();
+        return true;
+    }
+
+    net::ip::tcp::socket *socket = nullptr;
+    if (auto server = std::get_if<Server>(&state)) {
+        if (auto it = server->clients.find(id); it != server->clients.end()) {
+            socket = &it->second.socket;
+        }
     } else if (auto client = std::get_if<Client>(&state)) {
-        std::error_code ec;
-        u32 to_read = 0;
-        net::read(client->socket, net::dynamic_buffer(b.bytes),
-                  net::transfer_exactly(sizeof(to_read)));
-        b.read(to_read);
-        // b.reset();
-        auto size = net::read(client->socket, net::dynamic_buffer(b.bytes),
-                              net::transfer_exactly(to_read));
-
-        bytes_received += size + sizeof(to_read);
-        if (!ec) {
-            return true;
-        } else {
-            client->connected = false;
-            add_message("Error when reading from server: %s", id,
-                        ec.message().c_str());
-            return false;
+        socket = &client->socket;
+    }
+
+    if (!socket)
+        return false;
+
+    std::error_code ec;
+    if (read_frame(*socket, b, ec)) {
+        while (socket->available(ec) >= sizeof(u32) &&
+               read_frame(*socket, b, ec)) {
         }
     }
+
+    if (!ec) {
+        return true;
+    } else if (auto client = std::get_if<Client>(&state)) {
+        client->connected = false;
+        add_message("Error when reading from server: %s",
+                    ec.message().c_str());
+    } else {
+        add_message("Error when reading from client %d: %s", id,
+                    ec.message().c_str());
+    }
     return false;
 }
 
 bool Network::connected() {
-    if (auto server = std::get_if<Server>(&state)) {
+    if (std::holds_alternative<Server>(state) ||
+        std::holds_alternative<UdpServer>(state)) {
         return true;
     } else if (auto client = std::get_if<Client>(&state)) {
         return client->connected;
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        return client->connected;
     }
     return false;
 }
 
 void Network::print_stats() {
 #ifdef _DEBUG
-    printf("Network: tx = %3u  rx = %3u\n", bytes_sent, bytes_received);
+    printf("Network: tx = %3u  rx = %3u\n", bytes_sent.load(), bytes_received);
+    std::lock_guard guard(mutex);
+    auto print_queue = [](ClientID id, const SendStats &stats) {
+        printf("  %u: queued = %zu (max %zu)  dropped = %llu  resent = %llu  "
+               "latency = %.2f ms (avg %.2f max %.2f)  compressed = %.2f\n",
+               id, stats.queue_depth, stats.max_queue_depth,
+               static_cast<unsigned long long>(stats.frames_dropped),
+               static_cast<unsigned long long>(stats.frames_resent),
+               stats.last_latency_ms, stats.avg_latency_ms,
+               stats.max_latency_ms,
+               stats.raw_bytes
+                   ? float(stats.compressed_bytes) / stats.raw_bytes
+                   : 1.0f);
+    };
+    if (auto server = std::get_if<Server>(&state)) {
+        for (auto &[id, client] : server->clients)
+            print_queue(id, client.queue.stats);
+    } else if (auto client = std::get_if<Client>(&state)) {
+        print_queue(0, client->queue.stats);
+    } else if (auto server = std::get_if<UdpServer>(&state)) {
+        for (auto &[id, peer] : server->peers)
+            print_queue(id, peer.stats);
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        print_queue(0, client->peer.stats);
+    }
+    if (read_errors > 0) {
+        printf("  failed reads: %llu\n",
+               static_cast<unsigned long long>(read_errors));
+    }
+    if (simulator.dropped > 0) {
+        printf("  simulated loss: %llu datagrams\n",
+               static_cast<unsigned long long>(simulator.dropped));
+    }
 #endif
     bytes_sent = 0;
     bytes_received = 0;
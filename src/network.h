@@ -1,64 +1,43 @@
 #pragma once
+#include "circular_buffer.h"
+#include "coro.h"
+#include "metrics.h"
+#include "timing_wheel.h"
 #include "stable_win32.hpp"
 namespace net = std::experimental::net;
 
-template <typename T, int N, bool mutex_acces = false> class CircularBuffer {
-public:
-    void push(const T &t) {
-        if constexpr (mutex_acces) {
-            std::lock_guard guard(mutex);
-            do_push(t);
-        } else {
-            do_push(t);
-        }
-    }
-
-    T pop() {
-        if constexpr (mutex_acces) {
-            std::lock_guard guard(mutex);
-            return do_pop();
-        } else {
-            return do_pop();
-        }
-    }
-
-    size_t size() { return size_; }
-
-private:
-    void do_push(const T &t) {
-        while (size_ >= N)
-            do_pop();
-        data_[push_index_++] = t;
-        if (push_index_ >= N)
-            push_index_ = 0;
-        ++size_;
-    }
-
-    T do_pop() {
-        assert(size_ > 0);
-        T ret = data_[pop_index_++];
-        if (pop_index_ >= N)
-            pop_index_ = 0;
-        --size_;
-        return ret;
-    }
-
-    size_t push_index_ = 0;
-    size_t pop_index_ = 0;
-    std::atomic<size_t> size_ = 0;
-    std::array<T, N> data_;
-    std::mutex mutex;
-};
-
 struct Network {
 
+    static constexpr u16 PORTN = 5677;
+    static constexpr auto IP = "localhost";
+    static constexpr u32 MAX_FRAME_SIZE = 1 << 20;
+    // Set in a frame's size prefix when its payload is compressed. Frames
+    // below MIN_COMPRESSED_SIZE are sent as they are.
+    static constexpr u32 COMPRESSED_FRAME = 1u << 31;
+    static constexpr u32 MIN_COMPRESSED_SIZE = 64;
+
     Network();
+    // Runs its handlers on the caller's io threads instead of its own, the
+    // caller stops shared before the Network goes away.
+    Network(net::io_context &shared);
     ~Network();
 
-    net::io_context ctx;
-    net::executor_work_guard<net::io_context::executor_type> work;
+    // only made by the Network that runs its own io thread
+    std::optional<net::io_context> own_ctx;
+    net::io_context &ctx;
+    std::optional<net::executor_work_guard<net::io_context::executor_type>>
+        work;
     std::thread work_thread;
 
+    u16 port = PORTN;
+    // A server that must not wait on any one client, or a tool driving
+    // many clients from one thread, reads in the background and recv only
+    // hands over the frames that arrived.
+    bool blocking = true;
+    // A connection read in the background is dropped when nothing arrived
+    // on it for this long, zero keeps it forever.
+    std::chrono::steady_clock::duration idle_timeout = 5s;
+
     struct Buffer {
         std::vector<u8> bytes;
         u32 start_index = 0;
@@ -71,29 +50,211 @@ struct Network {
         bool empty() { return start_index >= bytes.size(); }
 
         template <typename T> void write(const T &t) {
+            static_assert(std::is_trivially_copyable_v<T>);
             auto ptr = reinterpret_cast<const uint8_t *>(&t);
             bytes.insert(bytes.end(), ptr, ptr + sizeof(T));
         }
 
         template <typename T> void read(T &t) {
+            static_assert(std::is_trivially_copyable_v<T>);
             if (start_index + sizeof(T) <= bytes.size()) {
                 memcpy(&t, &bytes[start_index], sizeof(T));
                 start_index += sizeof(T);
             }
         }
+
+        void write_u8(u8 v) { bytes.push_back(v); }
+
+        // LEB128: 7 bits per byte, high bit set when more bytes follow
+        void write_varint(u32 v) { write_varint64(v); }
+
+        // The same encoding, for a u32 with flags shifted in below it. A
+        // value that fits in a u32 comes out the same either way.
+        void write_varint64(u64 v) {
+            while (v >= 0x80) {
+                bytes.push_back(static_cast<u8>(v | 0x80));
+                v >>= 7;
+            }
+            bytes.push_back(static_cast<u8>(v));
+        }
+
+        // maps small negative numbers to small varints
+        void write_zigzag(i32 v) {
+            write_varint((static_cast<u32>(v) << 1) ^
+                         static_cast<u32>(v >> 31));
+        }
+
+        bool read_u8(u8 &v) {
+            if (start_index >= bytes.size())
+                return false;
+            v = bytes[start_index++];
+            return true;
+        }
+
+        bool read_varint(u32 &v) {
+            v = 0;
+            for (u32 shift = 0; shift < 35; shift += 7) {
+                u8 b;
+                if (!read_u8(b))
+                    return false;
+                v |= static_cast<u32>(b & 0x7f) << shift;
+                if (!(b & 0x80))
+                    return true;
+            }
+            return false;
+        }
+
+        bool read_varint64(u64 &v) {
+            v = 0;
+            for (u32 shift = 0; shift < 70; shift += 7) {
+                u8 b;
+                if (!read_u8(b))
+                    return false;
+                v |= static_cast<u64>(b & 0x7f) << shift;
+                if (!(b & 0x80))
+                    return true;
+            }
+            return false;
+        }
+
+        bool read_zigzag(i32 &v) {
+            u32 u;
+            if (!read_varint(u))
+                return false;
+            v = static_cast<i32>((u >> 1) ^ (~(u & 1) + 1));
+            return true;
+        }
+    };
+
+    // Immutable once encoded, so one copy can sit in several send queues.
+    using SharedBytes = std::shared_ptr<const std::vector<u8>>;
+
+    static SharedBytes share(Buffer &b) {
+        auto bytes =
+            std::make_shared<const std::vector<u8>>(std::move(b.bytes));
+        b.reset();
+        return bytes;
+    }
+
+    // A frame assembled from segments written back to back, so a message
+    // broadcast to every client is encoded once and shared by their frames.
+    struct Frame {
+        std::vector<SharedBytes> segments;
+        u32 size = 0;
+        // when the tick that produced the frame ended, for the metrics
+        std::chrono::steady_clock::time_point origin{};
+        // the segments as one compressed segment, filled by the first send
+        // that compresses the frame and reused by the rest, null when that
+        // was not smaller
+        mutable std::optional<SharedBytes> packed;
+
+        void reset() {
+            segments.clear();
+            size = 0;
+            origin = {};
+            packed.reset();
+        }
+
+        bool empty() const { return size == 0; }
+
+        void append(SharedBytes bytes) {
+            if (bytes->empty())
+                return;
+            size += bytes->size();
+            segments.push_back(std::move(bytes));
+            packed.reset();
+        }
+
+        // moves the bytes written to b so far into a segment of their own
+        void append(Buffer &b) {
+            if (!b.bytes.empty())
+                append(share(b));
+        }
     };
 
     enum class Status { None, Client, Server };
 
+    enum class Transport { Tcp, Udp };
+
+    // Only meaningful over UDP, TCP delivers everything reliably.
+    enum class Channel { Reliable, Unreliable };
+
     struct None {};
 
     using ClientID = u32;
+    using Clock = std::chrono::steady_clock;
+
+    // A length prefixed frame waiting in a connection's outbound queue.
+    struct OutFrame {
+        u32 size = 0; // the prefix as written, with COMPRESSED_FRAME
+        std::vector<SharedBytes> segments;
+        Clock::time_point queued;
+        Clock::time_point origin;
+        // when the simulated link lets it through, queued without one
+        Clock::time_point release;
+    };
+
+    // What to do with a connection whose queue is full.
+    enum class LagPolicy { Drop, Disconnect };
+
+    // For the TCP send queues. UDP keeps reliable frames until they are
+    // acked, within a window of its own.
+    struct SendLimits {
+        size_t max_frames = 32;
+        size_t max_bytes = 1 << 20;
+        LagPolicy policy = LagPolicy::Disconnect;
+    };
+
+    struct SendStats {
+        u64 frames_sent = 0;
+        u64 frames_dropped = 0;
+        u64 frames_resent = 0;
+        u64 bytes_sent = 0;
+        // sizes of the frames that went out compressed, before and after
+        u64 raw_bytes = 0;
+        u64 compressed_bytes = 0;
+        size_t queue_depth = 0;
+        size_t max_queue_depth = 0;
+        float last_latency_ms = 0.0f;
+        float avg_latency_ms = 0.0f;
+        float max_latency_ms = 0.0f;
+    };
+
+    // Frames are pushed by the game thread and written by the io thread, a
+    // whole batch at a time with a single gathered write. Guarded by mutex.
+    struct SendQueue {
+        std::deque<OutFrame> frames;
+        size_t queued_bytes = 0;
+        bool writing = false;
+        bool closed = false;
+        bool compress = false;
+        SendStats stats;
+        // the writer waits on it for frames the simulated link holds back
+        net::steady_timer release_timer;
+        Clock::time_point last_release;
+
+        SendQueue(net::io_context &ctx);
+    };
+
+    // Frames read in the background when not blocking, guarded by mutex.
+    struct Reader {
+        u32 incoming_size = 0;
+        std::vector<u8> incoming;
+        std::deque<std::vector<u8>> inbox;
+        bool failed = false;
+        Clock::time_point last_heard = Clock::now();
+        net::steady_timer idle_timer;
+
+        Reader(net::io_context &ctx);
+    };
 
     struct Client {
 
         net::ip::tcp::socket socket;
         net::ip::tcp::endpoint endpoint;
         net::ip::tcp::resolver resolver;
+        SendQueue queue;
+        Reader reader;
 
         Client(net::io_context &ctx);
 
@@ -103,6 +264,8 @@ struct Network {
     struct ConnectedClient {
         net::ip::tcp::socket socket;
         net::ip::tcp::endpoint endpoint;
+        SendQueue queue;
+        Reader reader;
 
         ConnectedClient(net::io_context &ctx, net::ip::tcp::socket socket_);
     };
@@ -118,11 +281,111 @@ struct Network {
         Server(net::io_context &ctx);
     };
 
+    // Everything sent goes through this, to try either transport on a bad
+    // link over loopback. Datagrams are dropped or held back for latency
+    // plus or minus jitter. TCP frames are held back the same way, and a
+    // lost one for a retransmission timeout more, with the frames behind
+    // it waiting in order.
+    struct LinkSimulator {
+        float loss = 0.0f;
+        float latency_ms = 0.0f;
+        float jitter_ms = 0.0f;
+        u64 dropped = 0;
+        std::mt19937 rng{std::random_device{}()};
+
+        bool active() const {
+            return loss > 0.0f || latency_ms > 0.0f || jitter_ms > 0.0f;
+        }
+        // SNEK_LINK_LOSS from 0 to 1, SNEK_LINK_LATENCY and
+        // SNEK_LINK_JITTER in ms
+        void from_env();
+    };
+
+    // A datagram's worth of a frame. Frames larger than a datagram should
+    // carry go out in several, each flagged with whether more follow and
+    // whether it continues an earlier one.
+    struct UdpFragment {
+        u8 flags = 0;
+        std::vector<u8> data;
+    };
+
+    struct UdpReliableFrame {
+        u16 id;
+        std::vector<u8> payload;
+        // or'ed into the packet type: compressed, more, continued
+        u8 flags = 0;
+        // first sent and last sent
+        Clock::time_point queued;
+        Clock::time_point sent;
+    };
+
+    // One end of a UDP connection. Reliable frames carry an id and are
+    // resent until the other side's cumulative ack passes them, then
+    // delivered in order. Unreliable frames are latest wins: only the
+    // newest one that arrived since the last recv is delivered. A frame
+    // split in fragments counts as arrived once all of them have.
+    struct UdpPeer {
+        net::ip::udp::endpoint endpoint;
+        ClientID id = 0;
+        u16 next_seq = 0;
+
+        u16 next_reliable_id = 0;
+        std::deque<UdpReliableFrame> unacked;
+
+        u16 expected_reliable_id = 0;
+        std::map<u16, UdpFragment> out_of_order;
+        // the fragments of the reliable frame being delivered so far
+        std::vector<u8> partial;
+        bool ack_pending = false;
+
+        bool has_unreliable = false;
+        u16 last_unreliable_seq = 0;
+        // by sequence number, until their frame is complete or outdated
+        std::map<u16, UdpFragment> unreliable_fragments;
+
+        std::deque<std::vector<u8>> inbox;
+        std::optional<std::vector<u8>> latest;
+
+        Clock::time_point last_heard = Clock::now();
+        bool closed = false;
+        bool compress = false;
+        SendStats stats;
+    };
+
+    struct UdpClient {
+        net::ip::udp::socket socket;
+        net::ip::udp::resolver resolver;
+        net::steady_timer timer;
+        std::vector<u8> datagram;
+        net::ip::udp::endpoint sender;
+        UdpPeer peer;
+        Clock::time_point last_connect;
+        std::atomic_bool connected = false;
+
+        UdpClient(net::io_context &ctx);
+    };
+
+    struct UdpServer {
+        net::ip::udp::socket socket;
+        net::steady_timer timer;
+        std::vector<u8> datagram;
+        net::ip::udp::endpoint sender;
+        std::unordered_map<ClientID, UdpPeer> peers;
+        ClientID unique_client_id = 1;
+
+        UdpServer(net::io_context &ctx);
+    };
+
     std::mutex mutex;
 
-    CircularBuffer<ClientID, 20, true> new_clients;
+    // Pushed by io handlers, which hold mutex, and popped by the game thread.
+    // A client that does not fit is refused rather than lost.
+    CircularBuffer<ClientID, 64> new_clients;
+
+    std::variant<None, Client, Server, UdpClient, UdpServer> state;
 
-    std::variant<None, Client, Server> state;
+    Transport transport = Transport::Tcp;
+    LinkSimulator simulator;
 
     void update();
     void connect();
@@ -130,16 +393,74 @@ struct Network {
     void start_server();
     void stop_server();
 
-    void start_accept();
-
     std::optional<ClientID> get_new_client();
 
-    void send(Buffer &b, ClientID id);
+    void send(Buffer &b, ClientID id, Channel channel = Channel::Reliable);
+    void send(const Frame &frame, ClientID id,
+              Channel channel = Channel::Reliable);
     bool recv(Buffer &b, ClientID id);
 
+    void disconnect(ClientID id);
+    // Whether frames to id go out compressed, once both ends agreed on it.
+    // Compressed frames are always understood.
+    void set_compression(ClientID id, bool on);
+    std::optional<SendStats> send_stats(ClientID id);
+
     bool connected();
     void print_stats();
 
-    u32 bytes_sent = 0;
+    SendLimits send_limits;
+
+    std::atomic<u32> bytes_sent = 0;
     u32 bytes_received = 0;
+    // background reads that failed, each dropped its connection. Guarded
+    // by mutex.
+    u64 read_errors = 0;
+
+    Metrics metrics;
+    std::unique_ptr<MetricsEndpoint> metrics_endpoint;
+    // serves metrics.report on a loopback port
+    void serve_metrics(u16 port);
+
+    // Appends every frame sent, uncompressed and prefixed with its u32
+    // size, to path. For the compression benchmark.
+    void record_frames(const std::string &path);
+
+private:
+    std::pair<net::ip::tcp::socket *, SendQueue *> connection(ClientID id);
+    std::pair<net::ip::tcp::socket *, Reader *> reading(ClientID id);
+    // The TCP sessions, each one a coroutine on the io thread.
+    coro::Detached connect_session();
+    coro::Detached accept_loop();
+    coro::Detached read_loop(ClientID id);
+    coro::Detached write_loop(ClientID id);
+    coro::Detached watchdog(ClientID id);
+    bool read_frame(net::ip::tcp::socket &socket, Buffer &b,
+                    std::error_code &ec);
+    static SharedBytes compress(const Frame &frame);
+    Clock::time_point release(SendQueue &queue, Clock::time_point now);
+    void record(const Frame &frame);
+    std::unique_ptr<std::ofstream> recording;
+    void drop_connection(ClientID id, const char *reason);
+    void read_failed(ClientID id, Reader &reader, std::error_code ec);
+
+    // network_udp.cpp, handlers from a previous socket check the generation
+    u32 udp_generation = 0;
+    // in udp ticks, for what only needs looking at now and then
+    TimingWheel udp_timers;
+    void udp_connect();
+    void udp_start_server();
+    void udp_send(const Frame &frame, ClientID id, Channel channel);
+    bool udp_recv(Buffer &b, ClientID id);
+    UdpPeer *udp_peer(ClientID id);
+    void udp_receive();
+    void udp_on_datagram(const net::ip::udp::endpoint &from, size_t size);
+    void udp_schedule_tick();
+    void udp_tick();
+    void udp_watch(ClientID id, Clock::duration after);
+    void udp_transmit(UdpPeer &peer, u8 type, u16 reliable_id,
+                      const u8 *payload = nullptr, size_t size = 0);
+    void udp_send_to(const net::ip::udp::endpoint &to,
+                     std::shared_ptr<std::vector<u8>> datagram);
+    void udp_close(UdpPeer &peer, const char *reason);
 };
@@ -0,0 +1,640 @@
+#include "compress.h"
+#include "engine.h"
+#include "network.h"
+#include "stable_win32.hpp"
+
+namespace {
+
+// connection id, packet type, sequence number, cumulative reliable ack
+constexpr size_t HEADER_SIZE = 4 + 1 + 2 + 2;
+constexpr size_t MAX_DATAGRAM = 65507;
+// What fits in the smallest MTU IPv6 allows, after the IP and UDP headers
+// and ours. Larger frames go out in fragments of this size rather than as
+// datagrams the IP layer splits, which are lost with any of their pieces
+// or dropped outright on some links.
+constexpr size_t MAX_PAYLOAD = 1200;
+
+constexpr auto TICK_INTERVAL = 20ms;
+constexpr auto RESEND_DELAY = 100ms;
+constexpr auto CONNECT_RETRY = 250ms;
+constexpr auto TIMEOUT = 5s;
+
+// A reliable frame is resent until it is acked, for up to TIMEOUT: longer
+// and the peer is given up on. The window holds well over a TIMEOUT of
+// frames at a frame every 16ms, the receiver keeps as many out of order,
+// and ids are compared within half their range.
+constexpr size_t MAX_UNACKED = 1024;
+constexpr size_t MAX_OUT_OF_ORDER = MAX_UNACKED;
+static_assert(MAX_UNACKED < 1 << 15);
+// the largest frame fits in the window
+static_assert(Network::MAX_FRAME_SIZE / MAX_PAYLOAD < MAX_UNACKED);
+// an unreliable frame in more fragments is not sent, and the receiver
+// forgets fragments beyond that many whose frame never completed
+constexpr size_t MAX_UNRELIABLE_FRAGMENTS = 128;
+
+enum PacketType : u8 { Connect, Accept, Reliable, Unreliable, Ack };
+// or'ed into the type of a packet whose payload is compressed
+constexpr u8 COMPRESSED = 0x80;
+// or'ed into the type of a fragment that more of its frame follow, and of
+// one that continues an earlier fragment
+constexpr u8 MORE = 0x40;
+constexpr u8 CONTINUED = 0x20;
+constexpr u8 FLAGS = COMPRESSED | MORE | CONTINUED;
+
+// true when a comes after b, sequence numbers wrap around
+bool seq_newer(u16 a, u16 b) { return static_cast<i16>(a - b) > 0; }
+
+template <typename T> T get(const u8 *data) {
+    T t;
+    memcpy(&t, data, sizeof(T));
+    return t;
+}
+
+// the payload as it was sent, false when it does not decompress
+bool unpack(const u8 *data, size_t size, bool compressed,
+            std::vector<u8> &out) {
+    out.clear();
+    if (!compressed) {
+        out.assign(data, data + size);
+        return true;
+    }
+    return Compression::decompress(data, size, out, Network::MAX_FRAME_SIZE);
+}
+
+// the fragment flags of bytes [begin, end) of a payload of size bytes
+u8 fragment_flags(size_t begin, size_t end, size_t size) {
+    return (begin > 0 ? CONTINUED : 0) | (end < size ? MORE : 0);
+}
+
+// Keeps a fragment of an unreliable frame by its sequence number. Once the
+// whole frame is in its fragments are joined into frame, last is set to the
+// sequence number of the last one and true is returned.
+bool join_fragments(std::map<u16, Network::UdpFragment> &fragments, u16 seq,
+                    u8 flags, const u8 *data, size_t size,
+                    std::vector<u8> &frame, u16 &last) {
+    if (fragments.size() >= MAX_UNRELIABLE_FRAGMENTS)
+        fragments.clear();
+    auto &fragment = fragments[seq];
+    fragment.flags = flags;
+    fragment.data.assign(data, data + size);
+
+    u16 first = seq;
+    for (auto it = fragments.find(first); it->second.flags & CONTINUED;
+         it = fragments.find(--first)) {
+        if (!fragments.count(static_cast<u16>(first - 1)))
+            return false;
+    }
+    last = seq;
+    for (auto it = fragments.find(last); it->second.flags & MORE;
+         it = fragments.find(++last)) {
+        if (!fragments.count(static_cast<u16>(last + 1)))
+            return false;
+    }
+
+    frame.clear();
+    for (u16 s = first;; ++s) {
+        auto it = fragments.find(s);
+        frame.insert(frame.end(), it->second.data.begin(),
+                     it->second.data.end());
+        fragments.erase(it);
+        if (s == last)
+            break;
+    }
+    return true;
+}
+
+} // namespace
+
+Network::UdpClient::UdpClient(net::io_context &ctx)
+    : socket(ctx), resolver(ctx), timer(ctx), datagram(MAX_DATAGRAM) {}
+
+Network::UdpServer::UdpServer(net::io_context &ctx)
+    : socket(ctx), timer(ctx), datagram(MAX_DATAGRAM) {}
+
+void Network::udp_connect() {
+    std::lock_guard guard(mutex);
+    try {
+        auto &client = state.emplace<UdpClient>(ctx);
+        client.peer.endpoint =
+            client.resolver
+                .resolve(net::ip::udp::v4(), IP, std::to_string(port))
+                .begin()
+                ->endpoint();
+        client.socket.open(client.peer.endpoint.protocol());
+        udp_generation++;
+        udp_timers.clear();
+        udp_receive();
+        udp_schedule_tick();
+    } catch (std::exception &e) {
+        add_message("Failed to connect: %s", e.what());
+        state.emplace<None>();
+    }
+}
+
+void Network::udp_start_server() {
+    std::lock_guard guard(mutex);
+    try {
+        auto &server = state.emplace<UdpServer>(ctx);
+        const net::ip::udp::endpoint endpoint(net::ip::udp::v4(), port);
+        server.socket.open(endpoint.protocol());
+        server.socket.bind(endpoint);
+        udp_generation++;
+        udp_timers.clear();
+        udp_receive();
+        udp_schedule_tick();
+        add_message("Started UDP server");
+    } catch (std::exception &e) {
+        add_message("Failed to start server: %s", e.what());
+        state.emplace<None>();
+    }
+}
+
+Network::UdpPeer *Network::udp_peer(ClientID id) {
+    if (auto server = std::get_if<UdpServer>(&state)) {
+        if (auto it = server->peers.find(id); it != server->peers.end()) {
+            return &it->second;
+        }
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        return &client->peer;
+    }
+    return nullptr;
+}
+
+// Datagrams carry a per peer header, so the segments are joined here, and
+// split again in fragments when they do not fit in one.
+void Network::udp_send(const Frame &f, ClientID id, Channel channel) {
+    std::lock_guard guard(mutex);
+    auto peer = udp_peer(id);
+    if (!peer || peer->closed)
+        return;
+
+    // nothing blocks on a frame arriving, unlike a blocking TCP recv
+    if (f.empty())
+        return;
+
+    auto &stats = peer->stats;
+    if (f.size > MAX_FRAME_SIZE) {
+        // the other end would not take it, and the reliable frames after
+        // it mean nothing without it
+        stats.frames_dropped++;
+        add_message("Frame of %u bytes is too large", f.size);
+        if (channel == Channel::Reliable) {
+            udp_close(*peer, "frame too large");
+        }
+        return;
+    }
+
+    stats.frames_sent++;
+    metrics.frame_sent(f.size, peer->unacked.size());
+    // datagrams are handed to the socket right away
+    if (f.origin != Clock::time_point{})
+        metrics.frame_written(f.origin);
+
+    std::vector<u8> payload;
+    payload.reserve(f.size);
+    for (auto &segment : f.segments) {
+        payload.insert(payload.end(), segment->begin(), segment->end());
+    }
+
+    u8 compressed = 0;
+    if (peer->compress && f.size >= MIN_COMPRESSED_SIZE) {
+        if (auto packed = compress(f)) {
+            stats.raw_bytes += f.size;
+            stats.compressed_bytes += packed->size();
+            payload = *packed;
+            compressed = COMPRESSED;
+        }
+    }
+
+    const size_t size = payload.size();
+    const size_t fragments = (size + MAX_PAYLOAD - 1) / MAX_PAYLOAD;
+
+    if (channel == Channel::Unreliable) {
+        if (fragments > MAX_UNRELIABLE_FRAGMENTS) {
+            stats.frames_dropped++;
+            add_message("Frame of %u bytes is too large to send unreliably",
+                        f.size);
+            return;
+        }
+        for (size_t i = 0; i < size; i += MAX_PAYLOAD) {
+            const size_t end = std::min(size, i + MAX_PAYLOAD);
+            udp_transmit(*peer,
+                         Unreliable | compressed | fragment_flags(i, end, size),
+                         0, payload.data() + i, end - i);
+        }
+        return;
+    }
+
+    const auto now = Clock::now();
+    if (peer->unacked.size() + fragments > MAX_UNACKED ||
+        (!peer->unacked.empty() &&
+         now - peer->unacked.front().queued >= TIMEOUT)) {
+        stats.frames_dropped++;
+        if (send_limits.policy == LagPolicy::Disconnect) {
+            udp_close(*peer, "reliable frames not acknowledged");
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < size; i += MAX_PAYLOAD) {
+        const size_t end = std::min(size, i + MAX_PAYLOAD);
+        auto &frame = peer->unacked.emplace_back();
+        frame.id = peer->next_reliable_id++;
+        if (fragments == 1) {
+            frame.payload = std::move(payload);
+        } else {
+            frame.payload.assign(payload.begin() + i, payload.begin() + end);
+        }
+        frame.flags = compressed | fragment_flags(i, end, size);
+        frame.queued = now;
+        frame.sent = now;
+        udp_transmit(*peer, Reliable | frame.flags, frame.id,
+                     frame.payload.data(), frame.payload.size());
+    }
+
+    stats.queue_depth = peer->unacked.size();
+    stats.max_queue_depth = std::max(stats.max_queue_depth, stats.queue_depth);
+}
+
+// Never blocks: hands over the reliable frames received in order so far,
+// followed by the newest unreliable one.
+bool Network::udp_recv(Buffer &b, ClientID id) {
+    std::lock_guard guard(mutex);
+    auto peer = udp_peer(id);
+    if (!peer || peer->closed)
+        return false;
+
+    for (auto &frame : peer->inbox) {
+        b.bytes.insert(b.bytes.end(), frame.begin(), frame.end());
+    }
+    peer->inbox.clear();
+
+    if (peer->latest) {
+        b.bytes.insert(b.bytes.end(), peer->latest->begin(),
+                       peer->latest->end());
+        peer->latest.reset();
+    }
+
+    bytes_received += b.bytes.size();
+    return true;
+}
+
+// Must be called with mutex held, like everything below.
+void Network::udp_receive() {
+    auto start = [this](auto &s) {
+        s.socket.async_receive_from(
+            net::buffer(s.datagram), s.sender,
+            [this, generation = udp_generation](std::error_code ec,
+                                                size_t size) {
+                if (ec == std::errc::operation_canceled)
+                    return;
+
+                std::lock_guard guard(mutex);
+                if (generation != udp_generation)
+                    return;
+
+                if (!ec) {
+                    if (auto server = std::get_if<UdpServer>(&state)) {
+                        udp_on_datagram(server->sender, size);
+                    } else if (auto client = std::get_if<UdpClient>(&state)) {
+                        udp_on_datagram(client->sender, size);
+                    }
+                }
+                udp_receive();
+            });
+    };
+
+    if (auto server = std::get_if<UdpServer>(&state)) {
+        start(*server);
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        start(*client);
+    }
+}
+
+void Network::udp_on_datagram(const net::ip::udp::endpoint &from,
+                              size_t size) {
+    if (size < HEADER_SIZE)
+        return;
+
+    const u8 *data = nullptr;
+    if (auto server = std::get_if<UdpServer>(&state)) {
+        data = server->datagram.data();
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        data = client->datagram.data();
+    } else {
+        return;
+    }
+
+    const auto connection_id = get<u32>(data);
+    const u8 type = data[4] & ~FLAGS;
+    const u8 flags = data[4] & FLAGS;
+    const auto seq = get<u16>(data + 5);
+    const auto reliable_ack = get<u16>(data + 7);
+
+    UdpPeer *peer = nullptr;
+    if (auto server = std::get_if<UdpServer>(&state)) {
+        if (type == Connect) {
+            // a closed peer stays until the game disconnects it, a client
+            // coming back from the same endpoint is a new one
+            auto it = std::find_if(
+                server->peers.begin(), server->peers.end(), [&from](auto &p) {
+                    return !p.second.closed && p.second.endpoint == from;
+                });
+            if (it == server->peers.end()) {
+                // the client retries until there is room
+                if (!new_clients.push(server->unique_client_id))
+                    return;
+                const auto id = server->unique_client_id++;
+                it = server->peers.try_emplace(id).first;
+                it->second.id = id;
+                it->second.endpoint = from;
+                udp_watch(id, TIMEOUT);
+                add_message("A client has connected to the server!");
+            }
+            // also answers retries whose Accept got lost
+            udp_transmit(it->second, Accept, 0);
+            return;
+        }
+
+        auto it = server->peers.find(connection_id);
+        if (it == server->peers.end() || it->second.endpoint != from)
+            return;
+        peer = &it->second;
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        if (from != client->peer.endpoint)
+            return;
+        peer = &client->peer;
+        // the first packet from the server confirms the connection, even
+        // when its Accept was lost
+        if (!client->connected) {
+            peer->id = connection_id;
+            client->connected = true;
+            udp_watch(peer->id, TIMEOUT);
+            add_message("connected to %s", IP);
+        }
+    }
+
+    if (!peer || peer->closed)
+        return;
+
+    const auto now = Clock::now();
+    peer->last_heard = now;
+
+    auto &stats = peer->stats;
+    while (!peer->unacked.empty() &&
+           seq_newer(reliable_ack, peer->unacked.front().id)) {
+        const float ms = std::chrono::duration<float, std::milli>(
+                             now - peer->unacked.front().sent)
+                             .count();
+        stats.last_latency_ms = ms;
+        stats.avg_latency_ms += (ms - stats.avg_latency_ms) * 0.1f;
+        stats.max_latency_ms = std::max(stats.max_latency_ms, ms);
+        peer->unacked.pop_front();
+    }
+    stats.queue_depth = peer->unacked.size();
+
+    if (type == Reliable) {
+        if (size < HEADER_SIZE + 2)
+            return;
+        const auto id = get<u16>(data + HEADER_SIZE);
+        const auto payload = data + HEADER_SIZE + 2;
+        const auto payload_size = size - HEADER_SIZE - 2;
+
+        // duplicates are acked again in case our ack was lost
+        peer->ack_pending = true;
+
+        // fragments in order are joined until the last of their frame
+        auto deliver = [peer](u8 flags, const u8 *data, size_t size) {
+            auto &partial = peer->partial;
+            if (partial.empty() && !(flags & MORE)) {
+                std::vector<u8> frame;
+                if (!unpack(data, size, flags & COMPRESSED, frame))
+                    return false;
+                peer->inbox.push_back(std::move(frame));
+                return true;
+            }
+            if (partial.size() + size > MAX_FRAME_SIZE)
+                return false;
+            partial.insert(partial.end(), data, data + size);
+            if (flags & MORE)
+                return true;
+            std::vector<u8> frame;
+            const bool ok = unpack(partial.data(), partial.size(),
+                                   flags & COMPRESSED, frame);
+            partial.clear();
+            if (ok)
+                peer->inbox.push_back(std::move(frame));
+            return ok;
+        };
+
+        if (id == peer->expected_reliable_id) {
+            bool ok = deliver(flags, payload, payload_size);
+            peer->expected_reliable_id++;
+            for (auto it = peer->out_of_order.find(peer->expected_reliable_id);
+                 ok && it != peer->out_of_order.end();
+                 it = peer->out_of_order.find(peer->expected_reliable_id)) {
+                auto &fragment = it->second;
+                ok = deliver(fragment.flags, fragment.data.data(),
+                             fragment.data.size());
+                peer->out_of_order.erase(it);
+                peer->expected_reliable_id++;
+            }
+            // what follows cannot be told apart from it
+            if (!ok)
+                udp_close(*peer, "bad frame");
+        } else if (seq_newer(id, peer->expected_reliable_id) &&
+                   peer->out_of_order.size() < MAX_OUT_OF_ORDER) {
+            peer->out_of_order.try_emplace(
+                id, UdpFragment{flags, {payload, payload + payload_size}});
+        }
+    } else if (type == Unreliable) {
+        if (peer->has_unreliable &&
+            !seq_newer(seq, peer->last_unreliable_seq))
+            return;
+
+        const u8 *payload = data + HEADER_SIZE;
+        size_t payload_size = size - HEADER_SIZE;
+        u16 last = seq;
+        std::vector<u8> joined;
+        if (flags & (MORE | CONTINUED)) {
+            auto &fragments = peer->unreliable_fragments;
+            if (!join_fragments(fragments, seq, flags, payload, payload_size,
+                                joined, last))
+                return;
+            // the fragments left belong to older frames
+            for (auto it = fragments.begin(); it != fragments.end();) {
+                it = seq_newer(it->first, last) ? std::next(it)
+                                                : fragments.erase(it);
+            }
+            payload = joined.data();
+            payload_size = joined.size();
+        }
+
+        std::vector<u8> frame;
+        if (!unpack(payload, payload_size, flags & COMPRESSED, frame))
+            return;
+        peer->has_unreliable = true;
+        peer->last_unreliable_seq = last;
+        peer->latest = std::move(frame);
+    }
+}
+
+void Network::udp_schedule_tick() {
+    auto start = [this](net::steady_timer &timer) {
+        timer.expires_after(TICK_INTERVAL);
+        timer.async_wait(
+            [this, generation = udp_generation](std::error_code ec) {
+                if (ec)
+                    return;
+                std::lock_guard guard(mutex);
+                if (generation != udp_generation)
+                    return;
+                udp_tick();
+                udp_schedule_tick();
+            });
+    };
+
+    if (auto server = std::get_if<UdpServer>(&state)) {
+        start(server->timer);
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        start(client->timer);
+    }
+}
+
+// Resends what was not acked in time, acks what we received when nothing
+// else went out to carry the ack, and runs the timers.
+void Network::udp_tick() {
+    const auto now = Clock::now();
+    udp_timers.advance();
+
+    auto service = [this, now](UdpPeer &peer) {
+        if (peer.closed)
+            return;
+
+        for (auto &frame : peer.unacked) {
+            if (now - frame.sent >= RESEND_DELAY) {
+                udp_transmit(peer, Reliable | frame.flags, frame.id,
+                             frame.payload.data(), frame.payload.size());
+                frame.sent = now;
+                peer.stats.frames_resent++;
+            }
+        }
+
+        if (peer.ack_pending) {
+            udp_transmit(peer, Ack, 0);
+        }
+    };
+
+    if (auto server = std::get_if<UdpServer>(&state)) {
+        for (auto &[id, peer] : server->peers) {
+            service(peer);
+        }
+    } else if (auto client = std::get_if<UdpClient>(&state)) {
+        if (client->connected) {
+            service(client->peer);
+        } else if (now - client->last_connect >= CONNECT_RETRY) {
+            client->last_connect = now;
+            udp_transmit(client->peer, Connect, 0);
+        }
+    }
+}
+
+// Drops the peer if it went TIMEOUT without a word by then, or looks again
+// when it could have. Each peer is looked at once a TIMEOUT at most, not
+// every tick.
+void Network::udp_watch(ClientID id, Clock::duration after) {
+    const u64 ticks = (after + TICK_INTERVAL - 1ns) / TICK_INTERVAL;
+    udp_timers.schedule(ticks, [this, id] {
+        auto peer = udp_peer(id);
+        if (!peer || peer->closed)
+            return;
+        const auto quiet = Clock::now() - peer->last_heard;
+        if (quiet > TIMEOUT) {
+            udp_close(*peer, "timed out");
+        } else {
+            udp_watch(id, TIMEOUT - quiet);
+        }
+    });
+}
+
+void Network::udp_transmit(UdpPeer &peer, u8 type, u16 reliable_id,
+                           const u8 *payload, size_t size) {
+    Buffer b;
+    b.bytes.reserve(HEADER_SIZE + 2 + size);
+    b.write(peer.id);
+    b.write(type);
+    b.write(peer.next_seq++);
+    b.write(peer.expected_reliable_id);
+    if ((type & ~FLAGS) == Reliable) {
+        b.write(reliable_id);
+    }
+    b.bytes.insert(b.bytes.end(), payload, payload + size);
+
+    peer.ack_pending = false;
+    peer.stats.bytes_sent += b.bytes.size();
+    bytes_sent += b.bytes.size();
+
+    udp_send_to(peer.endpoint,
+                std::make_shared<std::vector<u8>>(std::move(b.bytes)));
+}
+
+// Datagrams are always sent from the io thread. The link simulator drops
+// them or holds them back for latency plus or minus jitter, which also
+// reorders them.
+void Network::udp_send_to(const net::ip::udp::endpoint &to,
+                          std::shared_ptr<std::vector<u8>> datagram) {
+    auto &sim = simulator;
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    if (sim.loss > 0.0f && uniform(sim.rng) < sim.loss) {
+        sim.dropped++;
+        return;
+    }
+
+    float delay_ms = sim.latency_ms;
+    if (sim.jitter_ms > 0.0f) {
+        delay_ms += sim.jitter_ms * (2.0f * uniform(sim.rng) - 1.0f);
+    }
+
+    auto send = [this, to, datagram, generation = udp_generation]() {
+        std::lock_guard guard(mutex);
+        if (generation != udp_generation)
+            return;
+
+        net::ip::udp::socket *socket = nullptr;
+        if (auto server = std::get_if<UdpServer>(&state)) {
+            socket = &server->socket;
+        } else if (auto client = std::get_if<UdpClient>(&state)) {
+            socket = &client->socket;
+        }
+        if (socket) {
+            socket->async_send_to(net::buffer(*datagram), to,
+                                  [datagram](std::error_code, size_t) {});
+        }
+    };
+
+    if (delay_ms > 0.0f) {
+        auto timer = std::make_shared<net::steady_timer>(ctx);
+        timer->expires_after(
+            std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<float, std::milli>(delay_ms)));
+        timer->async_wait([timer, send](std::error_code) { send(); });
+    } else {
+        net::post(ctx, send);
+    }
+}
+
+void Network::udp_close(UdpPeer &peer, const char *reason) {
+    peer.closed = true;
+    peer.unacked.clear();
+    peer.out_of_order.clear();
+    peer.partial.clear();
+    peer.unreliable_fragments.clear();
+
+    if (auto client = std::get_if<UdpClient>(&state)) {
+        client->connected = false;
+        add_message("Dropped connection to server: %s", reason);
+    } else {
+        add_message("Dropped client %d: %s", peer.id, reason);
+    }
+}
@@ -0,0 +1,164 @@
+#include "pack.h"
+#include "compress.h"
+#include "engine.h"
+#include "stable_win32.hpp"
+
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Pack {
+
+bool Archive::open(const char *path) {
+    close();
+#ifdef _WIN32
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        file = nullptr;
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        close();
+        return false;
+    }
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        close();
+        return false;
+    }
+    base = static_cast<const u8 *>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    mapped_size = static_cast<size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file
+    ::close(fd);
+    if (p == MAP_FAILED)
+        return false;
+    base = static_cast<const u8 *>(p);
+    mapped_size = st.st_size;
+#endif
+    if (!base || !valid()) {
+        add_message("%s is not a valid pack", path);
+        close();
+        return false;
+    }
+    return true;
+}
+
+void Archive::close() {
+    inflated.clear();
+#ifdef _WIN32
+    if (base)
+        UnmapViewOfFile(base);
+    if (mapping)
+        CloseHandle(mapping);
+    if (file)
+        CloseHandle(file);
+    mapping = nullptr;
+    file = nullptr;
+#else
+    if (base)
+        munmap(const_cast<u8 *>(base), mapped_size);
+#endif
+    base = nullptr;
+    mapped_size = 0;
+}
+
+// Everything find and view read has to be inside the mapping.
+bool Archive::valid() const {
+    if (mapped_size < sizeof(Header))
+        return false;
+    auto h = header();
+    if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        h->version != VERSION)
+        return false;
+    if (h->slot_count == 0 || (h->slot_count & (h->slot_count - 1)) != 0)
+        return false;
+    const u64 index_end = sizeof(Header) + u64(h->entry_count) * sizeof(Entry) +
+                          u64(h->slot_count) * sizeof(u32);
+    if (index_end > mapped_size)
+        return false;
+
+    const u64 names_size = mapped_size - index_end;
+    for (u32 i = 0; i < h->entry_count; ++i) {
+        auto &e = entries()[i];
+        if (e.offset % ALIGN != 0 || e.offset > mapped_size ||
+            e.size > mapped_size - e.offset || e.name_offset >= names_size)
+            return false;
+        if (!(e.flags & COMPRESSED) && e.size != e.raw_size)
+            return false;
+    }
+    // probing stops at an empty slot, so there has to be one
+    u32 empty = 0;
+    for (u32 i = 0; i < h->slot_count; ++i) {
+        if (slots()[i] > h->entry_count)
+            return false;
+        empty += slots()[i] == 0;
+    }
+    return empty > 0;
+}
+
+const Entry *Archive::find(u64 hash) const {
+    if (!base)
+        return nullptr;
+    const u32 mask = header()->slot_count - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask) {
+        const u32 index = slots()[slot];
+        if (!index)
+            return nullptr;
+        auto &e = entries()[index - 1];
+        if (e.hash == hash)
+            return &e;
+    }
+}
+
+View Archive::view(u64 hash) {
+    auto e = find(hash);
+    if (!e)
+        return {};
+    if (!(e->flags & COMPRESSED))
+        return {base + e->offset, e->size};
+
+    auto it = inflated.find(hash);
+    if (it == inflated.end()) {
+        std::vector<u8> data;
+        if (!Compression::decompress(base + e->offset, e->size, data,
+                                     e->raw_size) ||
+            data.size() != e->raw_size) {
+            const auto n = name(*e);
+            add_message("Pack entry %.*s is corrupt", int(n.size()),
+                        n.data());
+            return {};
+        }
+        it = inflated.emplace(hash, std::move(data)).first;
+    }
+    return {it->second.data(), it->second.size()};
+}
+
+std::string_view Archive::name(const Entry &entry) const {
+    const char *start = names() + entry.name_offset;
+    const char *end = reinterpret_cast<const char *>(base + mapped_size);
+    return {start, strnlen(start, end - start)};
+}
+
+} // namespace Pack
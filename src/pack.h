@@ -0,0 +1,113 @@
+#pragma once
+#include "stable_win32.hpp"
+
+#include <string_view>
+
+// A read only archive of assets, mapped into memory once. The file is a
+// Header, then header.entry_count Entries, then header.slot_count slots,
+// then the entries' names, then the data of each entry starting at a
+// multiple of ALIGN. The slots are an open addressed table over the
+// entries: the slot of a name is its hash masked by slot_count - 1 and
+// probing goes on linearly, each slot holds its entry's index plus one
+// and 0 when empty. Names are only kept for listing, lookups go by hash
+// and the builder refuses two names with the same one. All little endian.
+namespace Pack {
+
+constexpr char MAGIC[4] = {'S', 'N', 'P', 'K'};
+constexpr u32 VERSION = 1;
+constexpr size_t ALIGN = 64;
+
+// the entry is compress.h's, raw_size is what it decompresses to
+constexpr u32 COMPRESSED = 1 << 0;
+
+struct Header {
+    char magic[4];
+    u32 version;
+    u32 entry_count;
+    u32 slot_count;
+};
+
+struct Entry {
+    u64 hash;
+    u64 offset;
+    u64 size;
+    u64 raw_size;
+    u32 name_offset; // from the start of the names
+    u32 flags;
+};
+
+static_assert(sizeof(Header) == 16 && sizeof(Entry) == 40);
+
+// FNV-1a, so call sites can hash their names at compile time.
+constexpr u64 hash(std::string_view name) {
+    u64 h = 14695981039346656037ull;
+    for (char c : name) {
+        h ^= static_cast<u8>(c);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Twice the entries rounded up to a power of two, at least one empty slot.
+constexpr u32 slot_count(u32 entry_count) {
+    u32 n = 1;
+    while (n < 2 * entry_count + 1)
+        n <<= 1;
+    return n;
+}
+
+struct View {
+    const u8 *data = nullptr;
+    size_t size = 0;
+
+    explicit operator bool() const { return data; }
+};
+
+class Archive {
+public:
+    Archive() = default;
+    ~Archive() { close(); }
+    Archive(const Archive &) = delete;
+    void operator=(const Archive &) = delete;
+
+    // false when the file is missing or not a valid pack
+    bool open(const char *path);
+    void close();
+    bool is_open() const { return base; }
+
+    const Entry *find(u64 hash) const;
+    // Points into the mapping for stored entries. Compressed ones are
+    // decompressed on first use and kept, so views stay valid until close.
+    View view(u64 hash);
+    View view(std::string_view name) { return view(Pack::hash(name)); }
+
+    u32 size() const { return header()->entry_count; }
+    const Entry &entry(u32 i) const { return entries()[i]; }
+    std::string_view name(const Entry &entry) const;
+
+private:
+    const Header *header() const {
+        return reinterpret_cast<const Header *>(base);
+    }
+    const Entry *entries() const {
+        return reinterpret_cast<const Entry *>(base + sizeof(Header));
+    }
+    const u32 *slots() const {
+        return reinterpret_cast<const u32 *>(entries() +
+                                             header()->entry_count);
+    }
+    const char *names() const {
+        return reinterpret_cast<const char *>(slots() + header()->slot_count);
+    }
+    bool valid() const;
+
+    const u8 *base = nullptr;
+    size_t mapped_size = 0;
+#ifdef _WIN32
+    void *file = nullptr;
+    void *mapping = nullptr;
+#endif
+    std::unordered_map<u64, std::vector<u8>> inflated;
+};
+
+} // namespace Pack
@@ -0,0 +1,183 @@
+#include "compress.h"
+#include "pack.h"
+#include "stable_win32.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// Builds a pack out of a directory, every file under it an entry named by
+// its path from there with / as separator:
+//
+//     snek-pack [--compress] resources.pak ../resources
+//
+// --compress keeps an entry compressed when that saves an eighth of it.
+// snek-pack --list resources.pak prints what a pack holds.
+
+namespace {
+
+namespace fs = std::filesystem;
+
+struct Input {
+    std::string name;
+    std::vector<u8> data;
+    std::vector<u8> packed;
+    u32 flags = 0;
+};
+
+bool read_file(const fs::path &path, std::vector<u8> &data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    data.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+    return true;
+}
+
+void pad(std::ofstream &out, size_t to) {
+    static const char zeros[Pack::ALIGN] = {};
+    const size_t at = out.tellp();
+    out.write(zeros, to - at);
+}
+
+int build(const char *out_path, const char *dir, bool compress) {
+    std::vector<Input> inputs;
+    std::error_code ec;
+    for (auto &it : fs::recursive_directory_iterator(dir, ec)) {
+        if (!it.is_regular_file())
+            continue;
+        Input in;
+        in.name = it.path().lexically_relative(dir).generic_string();
+        if (!read_file(it.path(), in.data)) {
+            fprintf(stderr, "cannot read %s\n", it.path().string().c_str());
+            return 1;
+        }
+        if (compress) {
+            Compression::compress(in.data.data(), in.data.size(), in.packed);
+            if (in.packed.size() <= in.data.size() - in.data.size() / 8) {
+                in.flags |= Pack::COMPRESSED;
+            } else {
+                in.packed.clear();
+            }
+        }
+        inputs.push_back(std::move(in));
+    }
+    if (ec) {
+        fprintf(stderr, "cannot list %s: %s\n", dir, ec.message().c_str());
+        return 1;
+    }
+    // the same pack for the same files
+    std::sort(inputs.begin(), inputs.end(),
+              [](auto &a, auto &b) { return a.name < b.name; });
+
+    Pack::Header header;
+    std::memcpy(header.magic, Pack::MAGIC, sizeof(header.magic));
+    header.version = Pack::VERSION;
+    header.entry_count = static_cast<u32>(inputs.size());
+    header.slot_count = Pack::slot_count(header.entry_count);
+
+    std::vector<Pack::Entry> entries(inputs.size());
+    std::vector<u32> slots(header.slot_count, 0);
+    std::string names;
+    for (u32 i = 0; i < inputs.size(); ++i) {
+        auto &e = entries[i];
+        e.hash = Pack::hash(inputs[i].name);
+        e.name_offset = static_cast<u32>(names.size());
+        names += inputs[i].name;
+        names += '\0';
+
+        const u32 mask = header.slot_count - 1;
+        u32 slot = e.hash & mask;
+        while (slots[slot]) {
+            auto &other = entries[slots[slot] - 1];
+            if (other.hash == e.hash) {
+                fprintf(stderr, "%s and %s have the same hash\n",
+                        inputs[i].name.c_str(),
+                        inputs[slots[slot] - 1].name.c_str());
+                return 1;
+            }
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = i + 1;
+    }
+
+    // then the data, each entry aligned
+    size_t offset = sizeof(header) + entries.size() * sizeof(Pack::Entry) +
+                    slots.size() * sizeof(u32) + names.size();
+    for (u32 i = 0; i < inputs.size(); ++i) {
+        auto &in = inputs[i];
+        auto &e = entries[i];
+        offset = (offset + Pack::ALIGN - 1) & ~(Pack::ALIGN - 1);
+        e.offset = offset;
+        e.raw_size = in.data.size();
+        e.size = in.flags & Pack::COMPRESSED ? in.packed.size() : e.raw_size;
+        e.flags = in.flags;
+        offset += e.size;
+    }
+
+    std::ofstream out(out_path, std::ios::binary);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(entries.data()),
+              entries.size() * sizeof(Pack::Entry));
+    out.write(reinterpret_cast<const char *>(slots.data()),
+              slots.size() * sizeof(u32));
+    out.write(names.data(), names.size());
+    for (u32 i = 0; i < inputs.size(); ++i) {
+        auto &in = inputs[i];
+        auto &data = in.flags & Pack::COMPRESSED ? in.packed : in.data;
+        pad(out, entries[i].offset);
+        out.write(reinterpret_cast<const char *>(data.data()), data.size());
+    }
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", out_path);
+        return 1;
+    }
+    fprintf(stderr, "%zu entries, %zu bytes written to %s\n", inputs.size(),
+            offset, out_path);
+    return 0;
+}
+
+int list(const char *path) {
+    Pack::Archive pack;
+    if (!pack.open(path)) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    for (u32 i = 0; i < pack.size(); ++i) {
+        auto &e = pack.entry(i);
+        const auto name = pack.name(e);
+        printf("%10llu %10llu %s %.*s\n",
+               static_cast<unsigned long long>(e.raw_size),
+               static_cast<unsigned long long>(e.size),
+               e.flags & Pack::COMPRESSED ? "z" : "-", int(name.size()),
+               name.data());
+        if (!pack.view(e.hash)) {
+            fprintf(stderr, "%.*s does not read back\n", int(name.size()),
+                    name.data());
+            return 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc == 3 && std::strcmp(argv[1], "--list") == 0)
+        return list(argv[2]);
+
+    bool compress = false;
+    int first = 1;
+    if (argc > 1 && std::strcmp(argv[1], "--compress") == 0) {
+        compress = true;
+        first = 2;
+    }
+    if (argc - first != 2) {
+        fprintf(stderr,
+                "usage: %s [--compress] OUT DIR\n"
+                "       %s --list PACK\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+    return build(argv[first], argv[first + 1], compress);
+}
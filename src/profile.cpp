@@ -0,0 +1,212 @@
+#include "profile.h"
+#include "engine.h"
+#include "stable_win32.hpp"
+
+#ifdef SNEK_PROFILE
+
+#include <fstream>
+
+namespace Profile {
+
+namespace {
+
+constexpr size_t QUEUE = 4096;
+
+// Written by its own thread, drained by the frame loop.
+struct Thread {
+    SpscRing<Zone, QUEUE> finished;
+    u16 index = 0;
+    u16 depth = 0;
+    // zones lost to a full queue, from threads no frame loop drains
+    u64 dropped = 0;
+};
+
+std::mutex threads_mutex;
+std::vector<std::unique_ptr<Thread>> threads;
+thread_local Thread *self = nullptr;
+
+Thread &this_thread() {
+    if (!self) {
+        std::lock_guard guard(threads_mutex);
+        threads.push_back(std::make_unique<Thread>());
+        self = threads.back().get();
+        self->index = static_cast<u16>(threads.size() - 1);
+    }
+    return *self;
+}
+
+// The frame loop's side.
+struct Frame {
+    u64 start = 0;
+    u64 end = 0;
+    std::vector<Zone> zones;
+};
+
+std::array<Frame, HISTORY> frames;
+// frames ended so far, the newest is frames[(count - 1) % HISTORY]
+size_t count = 0;
+u64 frame_start = 0;
+u16 loop_thread = 0;
+bool overlay = false;
+
+const Frame *kept(size_t age) {
+    if (age >= std::min(count, HISTORY))
+        return nullptr;
+    return &frames[(count - 1 - age) % HISTORY];
+}
+
+float ms(u64 ns) { return ns / 1e6f; }
+
+sf::Color zone_color(const char *name) {
+    // the same zone keeps its color from frame to frame
+    const auto h = std::hash<const void *>()(name);
+    return sf::Color(90 + h % 120, 90 + (h >> 8) % 120, 90 + (h >> 16) % 120);
+}
+
+} // namespace
+
+u64 now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+u64 Scope::enter() {
+    this_thread().depth++;
+    return now_ns();
+}
+
+void Scope::leave(const char *name, u64 start) {
+    const u64 end = now_ns();
+    auto &t = *self;
+    t.depth--;
+    if (!t.finished.try_push(Zone{name, start, end, t.depth, t.index}))
+        t.dropped++;
+}
+
+void end_frame() {
+    const u64 now = now_ns();
+    loop_thread = this_thread().index;
+
+    auto &frame = frames[count % HISTORY];
+    frame.start = frame_start ? frame_start : now;
+    frame.end = now;
+    frame.zones.clear();
+    {
+        std::lock_guard guard(threads_mutex);
+        for (auto &t : threads) {
+            Zone batch[64];
+            while (size_t n = t->finished.try_pop(batch, 64)) {
+                frame.zones.insert(frame.zones.end(), batch, batch + n);
+            }
+        }
+    }
+    count++;
+    frame_start = now;
+}
+
+void toggle_overlay() { overlay = !overlay; }
+
+void draw_overlay(sf::RenderTarget &target) {
+    if (!overlay || count == 0)
+        return;
+
+    constexpr float BAR_WIDTH = 3.0f;
+    constexpr float PX_PER_MS = 3.0f;
+    constexpr float MAX_BAR = 150.0f;
+    constexpr float ROW = 18.0f;
+    constexpr u16 ROWS_PER_THREAD = 5;
+    constexpr float BUDGET_MS = 1000.0f / 60.0f;
+
+    static sf::RectangleShape rect;
+    const auto [w, h] = target.getSize();
+
+    // frame times, newest on the right, with a line at 60 fps
+    float total = 0.0f;
+    float worst = 0.0f;
+    size_t shown = std::min(count, HISTORY);
+    const float right = w - 10.0f;
+    const float bottom = h - 10.0f;
+    for (size_t age = 0; age < shown; ++age) {
+        auto f = kept(age);
+        const float t = ms(f->end - f->start);
+        total += t;
+        worst = std::max(worst, t);
+        const float height = std::min(t * PX_PER_MS, MAX_BAR);
+        rect.setSize({BAR_WIDTH - 1.0f, height});
+        rect.setPosition(right - (age + 1) * BAR_WIDTH, bottom - height);
+        rect.setFillColor(t <= BUDGET_MS       ? sf::Color(100, 255, 100, 200)
+                          : t <= 2 * BUDGET_MS ? sf::Color(255, 220, 100, 200)
+                                               : sf::Color(255, 100, 100, 200));
+        target.draw(rect);
+    }
+    rect.setSize({shown * BAR_WIDTH, 1.0f});
+    rect.setPosition(right - shown * BAR_WIDTH, bottom - BUDGET_MS * PX_PER_MS);
+    rect.setFillColor({255, 255, 255, 128});
+    target.draw(rect);
+
+    char line[96];
+    snprintf(line, sizeof(line), "frame %.2f ms  avg %.2f  max %.2f",
+             ms(kept(0)->end - kept(0)->start), total / shown, worst);
+    ui::text(right - shown * BAR_WIDTH,
+             bottom - MAX_BAR - 24.0f, line, 16);
+
+    // the last frame, a band of rows per thread and a row per depth
+    auto f = kept(0);
+    const float left = 10.0f;
+    const float top = 40.0f;
+    const float width = w - 2 * left;
+    const double span = std::max<u64>(f->end - f->start, 1);
+    for (auto &z : f->zones) {
+        const double from = z.start > f->start ? z.start - f->start : 0;
+        const float x = left + from / span * width;
+        const float zw = std::max(1.0, (z.end - z.start) / span * width);
+        const u16 band = z.thread == loop_thread ? 0 : z.thread + 1;
+        const float y =
+            top + (band * ROWS_PER_THREAD + std::min(z.depth, u16(4))) * ROW;
+        rect.setSize({zw, ROW - 2.0f});
+        rect.setPosition(x, y);
+        rect.setFillColor(zone_color(z.name));
+        target.draw(rect);
+        if (zw > 80.0f) {
+            snprintf(line, sizeof(line), "%s %.2f ms", z.name,
+                     ms(z.end - z.start));
+            ui::text(x + 2.0f, y, line, 12);
+        }
+    }
+}
+
+bool write_trace(const char *path) {
+    std::ofstream out(path);
+    if (!out)
+        return false;
+
+    const size_t kept_frames = std::min(count, HISTORY);
+    const u64 base = kept_frames ? kept(kept_frames - 1)->start : 0;
+    auto us = [base](u64 ns) { return (ns - std::min(ns, base)) / 1e3; };
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+        << loop_thread << ",\"args\":{\"name\":\"frame loop\"}}";
+    out << std::fixed << std::setprecision(3);
+    // oldest first, each frame followed by what was filed under it
+    for (size_t age = kept_frames; age-- > 0;) {
+        auto f = kept(age);
+        out << ",\n{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+            << loop_thread << ",\"ts\":" << us(f->start)
+            << ",\"dur\":" << (f->end - f->start) / 1e3 << "}";
+        for (auto &z : f->zones) {
+            // names are literals from the code, nothing to escape
+            out << ",\n{\"name\":\"" << z.name
+                << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << z.thread
+                << ",\"ts\":" << us(z.start)
+                << ",\"dur\":" << (z.end - z.start) / 1e3 << "}";
+        }
+    }
+    out << "\n]}\n";
+    return bool(out);
+}
+
+} // namespace Profile
+
+#endif
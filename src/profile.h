@@ -0,0 +1,70 @@
+#pragma once
+#include "circular_buffer.h"
+#include "stable_win32.hpp"
+
+// A frame profiler, compiled in with SNEK_PROFILE defined. PROFILE_ZONE
+// times the rest of its scope under a literal name. Zones nest, and every
+// thread hands the ones it finished to the frame loop through a queue of
+// its own. end_frame files them under the frame, the last HISTORY frames
+// are kept for the overlay and for write_trace, which writes them as
+// Chrome trace events (chrome://tracing or ui.perfetto.dev). Without the
+// define zones expand to nothing and the rest are empty inlines.
+namespace Profile {
+
+constexpr size_t HISTORY = 120;
+
+#ifdef SNEK_PROFILE
+
+// ns on the steady clock
+u64 now_ns();
+
+struct Zone {
+    const char *name;
+    u64 start;
+    u64 end;
+    u16 depth;
+    // threads are numbered as they first enter a zone
+    u16 thread;
+};
+
+class Scope {
+public:
+    // literals only, the name is kept as a pointer
+    template <size_t N>
+    explicit Scope(const char (&name)[N]) : name(name), start(enter()) {}
+    ~Scope() { leave(name, start); }
+    Scope(const Scope &) = delete;
+    void operator=(const Scope &) = delete;
+
+private:
+    static u64 enter();
+    static void leave(const char *name, u64 start);
+
+    const char *name;
+    u64 start;
+};
+
+#define PROFILE_JOIN2(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN2(a, b)
+#define PROFILE_ZONE(name)                                                  \
+    Profile::Scope PROFILE_JOIN(profile_zone_, __LINE__)(name)
+
+// on the frame loop's thread, once per frame
+void end_frame();
+void toggle_overlay();
+// frame times as bars and the last frame's zones as a flame graph
+void draw_overlay(sf::RenderTarget &target);
+bool write_trace(const char *path);
+
+#else
+
+#define PROFILE_ZONE(name)
+
+inline void end_frame() {}
+inline void toggle_overlay() {}
+inline void draw_overlay(sf::RenderTarget &) {}
+inline bool write_trace(const char *) { return false; }
+
+#endif
+
+} // namespace Profile
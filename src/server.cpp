@@ -0,0 +1,152 @@
+#include "server.h"
+#include "engine.h"
+#include "stable_win32.hpp"
+
+namespace {
+
+// how long an idle worker sleeps before looking for rooms to steal again
+constexpr auto STEAL_INTERVAL = 1ms;
+
+bool later(const Room *a, const Room *b) { return a->next_tick > b->next_tick; }
+
+} // namespace
+
+Room::Room(u32 id, net::io_context &ctx, u16 port, bool use_udp,
+           u32 interest_radius, bool use_compression)
+    : id(id) {
+    game.use_udp = use_udp;
+    game.use_compression = use_compression;
+    lobby = &game.state.emplace<SnakeGame::HostLobby>(game, ctx, port);
+    lobby->interest_radius = interest_radius;
+}
+
+void Room::tick(float dt) {
+    const auto start = Clock::now();
+
+    lobby->begin_frame();
+    if (!lobby->game_running) {
+        lobby->accept_players();
+        const bool ready = std::all_of(
+            lobby->players.begin(), lobby->players.end(),
+            [](auto &p) { return p.second.ready; });
+        if (!lobby->players.empty() && ready) {
+            lobby->start_game();
+        }
+    }
+
+    lobby->receive();
+
+    if (lobby->game_running) {
+        if (lobby->players.empty()) {
+            lobby->end_game();
+        } else {
+            Input input(game.frame_arena);
+            lobby->game_tick(input, dt);
+        }
+    }
+
+    lobby->end_frame();
+    game.frame_arena.reset();
+
+    const auto end = Clock::now();
+    const float ms =
+        std::chrono::duration<float, std::milli>(end - start).count();
+
+    std::lock_guard guard(stats_mutex);
+    stats_.ticks++;
+    if (start - next_tick > std::chrono::duration<float>(dt)) {
+        stats_.late_ticks++;
+    }
+    stats_.players = lobby->players.size();
+    stats_.running = lobby->game_running;
+    stats_.last_ms = ms;
+    stats_.avg_ms += (ms - stats_.avg_ms) * 0.1f;
+    stats_.max_ms = std::max(stats_.max_ms, ms);
+}
+
+Room::Stats Room::stats() {
+    std::lock_guard guard(stats_mutex);
+    auto stats = stats_;
+    stats_.max_ms = 0.0f;
+    return stats;
+}
+
+std::string Room::metrics_report() { return lobby->network.metrics.report(); }
+
+RoomScheduler::RoomScheduler(size_t count, Room::Clock::duration interval)
+    : interval(interval) {
+    for (size_t i = 0; i < count; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < count; ++i) {
+        threads.emplace_back([this, i]() { run(i); });
+    }
+}
+
+RoomScheduler::~RoomScheduler() { stop(); }
+
+void RoomScheduler::add(Room *room) {
+    room->next_tick = Room::Clock::now();
+    push(*workers[next_worker++ % workers.size()], room);
+}
+
+void RoomScheduler::stop() {
+    running = false;
+    for (auto &thread : threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+void RoomScheduler::push(Worker &worker, Room *room) {
+    std::lock_guard guard(worker.mutex);
+    worker.rooms.push_back(room);
+    std::push_heap(worker.rooms.begin(), worker.rooms.end(), later);
+}
+
+Room *RoomScheduler::take_due(Worker &worker, Room::Clock::time_point now) {
+    std::lock_guard guard(worker.mutex);
+    if (worker.rooms.empty() || worker.rooms.front()->next_tick > now)
+        return nullptr;
+    std::pop_heap(worker.rooms.begin(), worker.rooms.end(), later);
+    auto room = worker.rooms.back();
+    worker.rooms.pop_back();
+    return room;
+}
+
+Room::Clock::time_point RoomScheduler::next_due(Worker &worker) {
+    std::lock_guard guard(worker.mutex);
+    if (worker.rooms.empty())
+        return Room::Clock::time_point::max();
+    return worker.rooms.front()->next_tick;
+}
+
+void RoomScheduler::run(size_t index) {
+    auto &own = *workers[index];
+    const float dt = std::chrono::duration<float>(interval).count();
+
+    while (running) {
+        const auto now = Room::Clock::now();
+        auto room = take_due(own, now);
+        for (size_t i = 1; !room && i < workers.size(); ++i) {
+            room = take_due(*workers[(index + i) % workers.size()], now);
+            if (room)
+                steals++;
+        }
+
+        if (!room) {
+            std::this_thread::sleep_until(
+                std::min(next_due(own), now + STEAL_INTERVAL));
+            continue;
+        }
+
+        room->tick(dt);
+
+        // a room that fell behind skips the ticks it missed
+        room->next_tick += interval;
+        if (room->next_tick < now) {
+            room->next_tick = now + interval;
+        }
+        push(own, room);
+    }
+}
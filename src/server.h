@@ -0,0 +1,72 @@
+#pragma once
+#include "network.h"
+#include "snake.h"
+#include "stable_win32.hpp"
+
+// One match on the dedicated server, a hosted lobby without a window or a
+// local player. Only the worker that took the room off a queue touches it.
+struct Room {
+    using Clock = Network::Clock;
+
+    struct Stats {
+        u64 ticks = 0;
+        u64 late_ticks = 0;
+        u32 players = 0;
+        bool running = false;
+        float last_ms = 0.0f;
+        float avg_ms = 0.0f;
+        float max_ms = 0.0f;
+    };
+
+    Room(u32 id, net::io_context &ctx, u16 port, bool use_udp,
+         u32 interest_radius, bool use_compression);
+
+    // Runs one frame, the game starts once every guest is ready and ends
+    // when the last one leaves.
+    void tick(float dt);
+    Stats stats();
+    // the room's network metrics, safe to call from any thread
+    std::string metrics_report();
+
+    const u32 id;
+    Clock::time_point next_tick;
+
+private:
+    SnakeGame game;
+    SnakeGame::HostLobby *lobby = nullptr;
+
+    std::mutex stats_mutex;
+    Stats stats_;
+};
+
+// Ticks rooms at a fixed rate on a fixed pool of workers. Every worker
+// keeps its rooms ordered by next tick and, with nothing of its own due,
+// steals a due room from another worker. The room then stays with the
+// worker that stole it.
+class RoomScheduler {
+public:
+    RoomScheduler(size_t workers, Room::Clock::duration interval);
+    ~RoomScheduler();
+
+    void add(Room *room);
+    void stop();
+
+    std::atomic<u64> steals = 0;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::vector<Room *> rooms;
+    };
+
+    void run(size_t index);
+    void push(Worker &worker, Room *room);
+    Room *take_due(Worker &worker, Room::Clock::time_point now);
+    Room::Clock::time_point next_due(Worker &worker);
+
+    const Room::Clock::duration interval;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic_bool running = true;
+    std::atomic<size_t> next_worker = 0;
+};
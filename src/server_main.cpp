@@ -0,0 +1,187 @@
+#include "engine.h"
+#include "network.h"
+#include "server.h"
+#include "stable_win32.hpp"
+
+#include <csignal>
+#include <fstream>
+
+// Dedicated server: runs many independent rooms, room i listens on
+// port + i. The rooms share one io_context run by a few io threads and
+// are ticked by a pool of workers.
+
+namespace {
+
+std::atomic_bool quit = false;
+
+void on_signal(int) { quit = true; }
+
+struct Options {
+    u32 rooms = 16;
+    u32 workers = std::max(1u, std::thread::hardware_concurrency());
+    u32 io_threads = 2;
+    u16 port = Network::PORTN;
+    u32 tick_rate = 60;
+    u32 report_interval = 5;
+    u32 interest_radius = 0;
+    bool udp = false;
+    bool compression = false;
+    std::string metrics_file;
+    u16 metrics_port = 0;
+};
+
+void usage(const char *name) {
+    printf("usage: %s [--rooms N] [--workers N] [--io-threads N] [--port P]\n"
+           "          [--tick-rate HZ] [--report S] [--interest R] [--udp]\n"
+           "          [--metrics-file PATH] [--metrics-port P]\n"
+           "          [--compression]\n",
+           name);
+}
+
+bool parse(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--udp") {
+            options.udp = true;
+            continue;
+        } else if (arg == "--compression") {
+            options.compression = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return false;
+        if (arg == "--metrics-file") {
+            options.metrics_file = argv[++i];
+            continue;
+        }
+        const u32 value = std::strtoul(argv[++i], nullptr, 10);
+        if (arg == "--rooms") {
+            options.rooms = value;
+        } else if (arg == "--workers") {
+            options.workers = std::max(1u, value);
+        } else if (arg == "--io-threads") {
+            options.io_threads = std::max(1u, value);
+        } else if (arg == "--port") {
+            options.port = value;
+        } else if (arg == "--tick-rate") {
+            options.tick_rate = std::max(1u, value);
+        } else if (arg == "--report") {
+            options.report_interval = std::max(1u, value);
+        } else if (arg == "--interest") {
+            options.interest_radius = value;
+        } else if (arg == "--metrics-port") {
+            options.metrics_port = value;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void report(std::vector<std::unique_ptr<Room>> &rooms,
+            RoomScheduler &scheduler, float budget_ms) {
+    u32 players = 0;
+    u32 running = 0;
+    float worst = 0.0f;
+    printf("room  players  state    ticks  late  last ms   avg ms   max ms\n");
+    for (auto &room : rooms) {
+        const auto stats = room->stats();
+        players += stats.players;
+        running += stats.running;
+        worst = std::max(worst, stats.max_ms);
+        if (stats.players == 0)
+            continue;
+        printf("%4u  %7u  %-7s  %5llu  %4llu  %7.3f  %7.3f  %7.3f\n", room->id,
+               stats.players, stats.running ? "playing" : "lobby",
+               static_cast<unsigned long long>(stats.ticks),
+               static_cast<unsigned long long>(stats.late_ticks),
+               stats.last_ms, stats.avg_ms, stats.max_ms);
+    }
+    printf("%zu rooms, %u playing, %u players, worst tick %.3f ms of %.3f ms, "
+           "%llu steals\n",
+           rooms.size(), running, players, worst, budget_ms,
+           static_cast<unsigned long long>(scheduler.steals.load()));
+}
+
+std::string metrics_report(std::vector<std::unique_ptr<Room>> &rooms) {
+    std::string out;
+    for (auto &room : rooms) {
+        out += "== room " + std::to_string(room->id) + "\n";
+        out += room->metrics_report() + "\n";
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    Options options;
+    if (!parse(argc, argv, options)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+
+    net::io_context ctx;
+    auto work = net::make_work_guard(ctx);
+    std::vector<std::thread> io_threads;
+    for (u32 i = 0; i < options.io_threads; ++i) {
+        io_threads.emplace_back([&ctx]() { ctx.run(); });
+    }
+
+    std::vector<std::unique_ptr<Room>> rooms;
+    for (u32 i = 0; i < options.rooms; ++i) {
+        rooms.push_back(std::make_unique<Room>(
+            i, ctx, static_cast<u16>(options.port + i), options.udp,
+            options.interest_radius, options.compression));
+    }
+
+    const auto interval = std::chrono::duration_cast<Room::Clock::duration>(
+        std::chrono::duration<double>(1.0 / options.tick_rate));
+    RoomScheduler scheduler(options.workers, interval);
+    for (auto &room : rooms) {
+        scheduler.add(room.get());
+    }
+
+    add_message("Serving %u rooms on ports %u-%u with %u workers",
+                options.rooms, options.port, options.port + options.rooms - 1,
+                options.workers);
+
+    std::unique_ptr<MetricsEndpoint> metrics_endpoint;
+    if (options.metrics_port != 0) {
+        metrics_endpoint = std::make_unique<MetricsEndpoint>(
+            ctx, options.metrics_port,
+            [&rooms]() { return metrics_report(rooms); });
+    }
+
+    const float budget_ms = 1000.0f / options.tick_rate;
+    auto next_report = Room::Clock::now();
+    while (!quit) {
+        std::this_thread::sleep_for(100ms);
+        if (Room::Clock::now() >= next_report) {
+            report(rooms, scheduler, budget_ms);
+            if (!options.metrics_file.empty()) {
+                std::ofstream(options.metrics_file, std::ios::trunc)
+                    << metrics_report(rooms);
+            }
+            next_report += std::chrono::seconds(options.report_interval);
+        }
+    }
+
+    add_message("Shutting down");
+    scheduler.stop();
+    ctx.stop();
+    work.reset();
+    for (auto &thread : io_threads) {
+        thread.join();
+    }
+    metrics_endpoint.reset();
+    rooms.clear();
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "stable_win32.hpp"
+
+struct Entity;
+
+// A handle into a SlotMap: the slot and the generation it was handed out
+// for. A slot is reused after an erase under a new generation, so an id
+// kept past the erase goes stale instead of pointing at someone else.
+struct EntityID {
+    using Index = u32;
+    using UID = u32;
+
+    Index index = 0;
+    // the generation, odd while the slot is in use so 0 is never valid
+    UID uid = 0;
+
+    bool operator==(const EntityID &other) const {
+        return index == other.index && uid == other.uid;
+    }
+    bool operator!=(const EntityID &other) const { return !(*this == other); }
+
+    // Into the game's entities, null once the entity is gone.
+    Entity *operator->() const;
+    explicit operator bool() const;
+};
+
+// Values stored back to back, found in O(1) through the slot of their id.
+// Erasing moves the last value into the hole, so like a vector, emplace and
+// erase invalidate pointers while ids stay valid until their own erase.
+template <typename T> class SlotMap {
+public:
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    template <typename... Args> EntityID emplace(Args &&...args) {
+        EntityID::Index index;
+        if (free_head != NONE) {
+            index = free_head;
+            free_head = slots[index].dense;
+        } else {
+            index = static_cast<EntityID::Index>(slots.size());
+            slots.push_back({});
+        }
+        values.emplace_back(std::forward<Args>(args)...);
+        owners.push_back(index);
+
+        auto &slot = slots[index];
+        slot.dense = static_cast<u32>(values.size() - 1);
+        slot.generation++;
+        return {index, slot.generation};
+    }
+
+    T *get(EntityID id) {
+        return const_cast<T *>(static_cast<const SlotMap &>(*this).get(id));
+    }
+
+    const T *get(EntityID id) const {
+        if (!live(id))
+            return nullptr;
+        return &values[slots[id.index].dense];
+    }
+
+    bool contains(EntityID id) const { return live(id); }
+
+    bool erase(EntityID id) {
+        if (!live(id))
+            return false;
+        remove(slots[id.index].dense);
+        return true;
+    }
+
+    // Returns the value that took its place, or end.
+    iterator erase(iterator it) {
+        const auto dense = static_cast<u32>(it - values.data());
+        remove(dense);
+        return values.data() + dense;
+    }
+
+    void clear() {
+        while (!values.empty()) {
+            remove(static_cast<u32>(values.size() - 1));
+        }
+    }
+
+    // the id of the value at position i of the iteration
+    EntityID id_at(size_t i) const {
+        const auto index = owners[i];
+        return {index, slots[index].generation};
+    }
+
+    size_t size() const { return values.size(); }
+    bool empty() const { return values.empty(); }
+    void reserve(size_t n) {
+        values.reserve(n);
+        owners.reserve(n);
+    }
+
+    iterator begin() { return values.data(); }
+    iterator end() { return values.data() + values.size(); }
+    const_iterator begin() const { return values.data(); }
+    const_iterator end() const { return values.data() + values.size(); }
+
+private:
+    static constexpr u32 NONE = ~0u;
+
+    struct Slot {
+        // the value's position, or the next free slot while free
+        u32 dense = NONE;
+        EntityID::UID generation = 0;
+    };
+
+    bool live(EntityID id) const {
+        return (id.uid & 1) && id.index < slots.size() &&
+               slots[id.index].generation == id.uid;
+    }
+
+    void remove(u32 dense) {
+        const auto index = owners[dense];
+        const auto last = static_cast<u32>(values.size() - 1);
+        if (dense != last) {
+            values[dense] = std::move(values[last]);
+            owners[dense] = owners[last];
+            slots[owners[dense]].dense = dense;
+        }
+        values.pop_back();
+        owners.pop_back();
+
+        auto &slot = slots[index];
+        slot.generation++;
+        slot.dense = free_head;
+        free_head = index;
+    }
+
+    std::vector<Slot> slots;
+    std::vector<T> values;
+    // the slot of each value
+    std::vector<EntityID::Index> owners;
+    u32 free_head = NONE;
+};
@@ -1,25 +1,52 @@
 #include "snake.h"
+#include "allocs.h"
 #include "engine.h"
+#include "profile.h"
 #include "stable_win32.hpp"
 
-SnakeGame::Food::Food(int x, int y) : p(x, y) {}
-void SnakeGame::Cell::reset() { food = nullptr; }
+namespace {
 
-SnakeGame::Direction SnakeGame::SinglePlayer::set_dir(Player &player,
-                                                      Direction d) {
-    if (player.dir == Direction::Down && d == Direction::Up)
-        return player.dir;
+// SNEK_RECORD_FRAMES names the files every frame sent is recorded to. Each
+// lobby, server rooms included, adds its role and port to the name, so
+// none truncates the recording of another.
+void record_frames(Network &network, const char *role) {
+    if (auto path = std::getenv("SNEK_RECORD_FRAMES")) {
+        network.record_frames(std::string(path) + "." + role + "." +
+                              std::to_string(network.port));
+    }
+}
 
-    if (player.dir == Direction::Left && d == Direction::Right)
-        return player.dir;
+// SNEK_METRICS_FILE names a file the metrics report is written to every few
+// seconds, SNEK_METRICS_PORT a loopback port it is served on.
+void watch_metrics(Network &network) {
+    network.metrics.type_name = SnakeNetwork::message_name;
+    if (auto path = std::getenv("SNEK_METRICS_FILE")) {
+        network.metrics.dump_path = path;
+    }
+    if (auto port = std::getenv("SNEK_METRICS_PORT")) {
+        network.serve_metrics(std::strtoul(port, nullptr, 10));
+    }
+}
 
-    if (player.dir == Direction::Right && d == Direction::Left)
-        return player.dir;
+} // namespace
 
-    if (player.dir == Direction::Up && d == Direction::Down)
-        return player.dir;
+SnakeGame::Food::Food(int x, int y) : p(x, y) {}
+void SnakeGame::Cell::reset() { food = nullptr; }
 
-    return d;
+std::optional<SnakeGame::Direction>
+SnakeGame::key_direction(sf::Keyboard::Key key) {
+    switch (key) {
+    case sf::Keyboard::Left:
+        return Direction::Left;
+    case sf::Keyboard::Right:
+        return Direction::Right;
+    case sf::Keyboard::Down:
+        return Direction::Down;
+    case sf::Keyboard::Up:
+        return Direction::Up;
+    default:
+        return std::nullopt;
+    }
 }
 
 void SnakeGame::SinglePlayer::recompute_spawn_points() {
@@ -35,23 +62,23 @@ void SnakeGame::SinglePlayer::recompute_spawn_points() {
 
 void SnakeGame::SinglePlayer::spawn(Player &player) {
 
-    player.body.resize(player.initialSize);
-    player.body[0] = {static_cast<int>(player.spawnX),
-                      static_cast<int>(player.spawnY)};
+    player.body().resize(player.initialSize);
+    player.body()[0] = {static_cast<int>(player.spawnX),
+                        static_cast<int>(player.spawnY)};
 
-    for (size_t i = 1; i < player.body.size(); ++i) {
-        player.body[i].x = player.body[i - 1].x;
-        player.body[i].y = player.body[i - 1].y + 1;
+    for (size_t i = 1; i < player.body().size(); ++i) {
+        player.body()[i].x = player.body()[i - 1].x;
+        player.body()[i].y = player.body()[i - 1].y + 1;
     }
 
-    player.dir = player.spawn_dir;
-    player.dead = false;
+    player.dir() = player.spawn_dir;
+    player.dead() = false;
 }
 
 // leave food behind where the body was
 void SnakeGame::SinglePlayer::decompose(Player &player) {
-    for (size_t i = 1; i < player.body.size(); ++i) {
-        add_food(player.body[i].x, player.body[i].y);
+    for (size_t i = 1; i < player.body().size(); ++i) {
+        add_food(player.body()[i].x, player.body()[i].y);
     }
 
     player.input_buffer.clear();
@@ -87,22 +114,33 @@ void SnakeGame::SinglePlayer::reset_map() {
 }
 
 bool SnakeGame::on_player(const Player &p1, const Player &p2) {
-    return on_player(p1, p2, p1.body[0].x, p1.body[0].y);
+    return on_player(p1, p2, p1.body()[0].x, p1.body()[0].y);
 }
 
 bool SnakeGame::on_player(const Player &p1, const Player &p2, int x, int y) {
 
     const size_t i0 = p1.id == p2.id ? 1 : 0;
-    for (size_t i = i0; i < p2.body.size(); ++i) {
-        if (p2.body[i].x == x && p2.body[i].y == y) {
+    for (size_t i = i0; i < p2.body().size(); ++i) {
+        if (p2.body()[i].x == x && p2.body()[i].y == y) {
             return true;
         }
     }
     return false;
 }
 
+std::vector<Network::ClientID>
+SnakeGame::player_slots(const PlayerList &players) {
+    std::vector<Network::ClientID> ids;
+    ids.reserve(players.size());
+    for (auto &[id, player] : players) {
+        ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
 void SnakeGame::init() {
-    hand_font.loadFromFile("resources/fonts/act.ttf");
+    // hand_font is loaded by main, with the other fonts
     pause_text.setFont(hand_font);
     pause_text.setCharacterSize(200);
     pause_text.setString("Paused");
@@ -129,6 +167,12 @@ void SnakeGame::init() {
 }
 
 void SnakeGame::update(Input &input, float dt) {
+    for (auto &ev : input.events) {
+        if (auto e = std::get_if<Input::KeyPressed>(&ev);
+            e && e->key == sf::Keyboard::F3) {
+            show_metrics = !show_metrics;
+        }
+    }
 
     if (auto s = std::get_if<MainMenu>(&state)) {
         main_menu(*s, input, dt);
@@ -150,114 +194,49 @@ sf::Color SnakeGame::get_random_color() {
 }
 
 void SnakeGame::host_lobby(HostLobby &s, Input &input, float dt) {
+    using Allocs::Tag;
     s.network.print_stats();
-
-    for (auto &[id, player] : s.players) {
-        player.send_buffer.reset();
-    }
+    s.begin_frame();
 
     if (!s.game_running) {
-        ui::label(5, 0, "Hosting Game");
-        if (ui::push_button(250, 0, "HostLobby##Start")) {
-            using namespace SnakeNetwork;
-            s.recompute_spawn_points();
-            for (auto &[id, player] : s.players) {
-                Message msg;
-                msg.body = SetPlayerInfo{id,
-                                         player.ready,
-                                         player.spawnX,
-                                         player.spawnY,
-                                         player.spawn_dir,
-                                         player.color};
-                s.send_all(msg);
+        {
+            Allocs::Scope scope(Tag::Ui);
+            ui::label(5, 0, "Hosting Game");
+            if (ui::push_button(250, 0, "HostLobby##Start")) {
+                s.start_game();
+            } else if (ui::push_button(400, 0, "HostLobby##Quit")) {
+                state.emplace<MainMenu>();
+                return;
             }
-
-            for (auto &[id, player] : s.players) {
-                s.spawn(player);
-            }
-
-            Message msg;
-            msg.body = StartGame{};
-            s.send_all(msg);
-            s.game_running = true;
-
-        } else if (ui::push_button(400, 0, "HostLobby##Quit")) {
-            state.emplace<MainMenu>();
         }
 
-        while (auto id = s.network.get_new_client()) {
-            printf("Got new player: %d\n", *id);
-            s.add_player(*id);
-        }
+        Allocs::Scope scope(Tag::Net);
+        s.accept_players();
     }
 
-    for (auto it = s.players.begin(); it != s.players.end();) {
-        const auto id = it->first;
-        auto &player = it->second;
-        using namespace SnakeNetwork;
-        if (id != s.local_id) {
-            if (s.network.recv(recv_buffer, id)) {
-                Message msg;
-                while (!recv_buffer.empty()) {
-                    recv_buffer.read(msg);
-                    if (std::get_if<HeartBeat>(&msg.body)) {
-                        msg.body.emplace<HeartBeat>();
-                        player.send_buffer.write(msg);
-                    } else if (std::get_if<JoinRequest>(&msg.body)) {
-                        msg.body.emplace<JoinResponse>(id);
-                        player.send_buffer.write(msg);
-                        for (auto &[tid, tplayer] : s.players) {
-                            msg.body = NewPlayer{tid, tplayer.ready};
-                            player.send_buffer.write(msg);
-                            printf("Sharing player %u with %u\n", tid, id);
-                        }
-
-                        for (auto &[tid, tplayer] : s.players) {
-                            if (tid != id && tid != s.local_id) {
-                                msg.body = NewPlayer{id, player.ready};
-                                tplayer.send_buffer.write(msg);
-                                printf("Sharing player %u with %u\n", id, tid);
-                            }
-                        }
-
-                    } else if (auto m = std::get_if<SetReady>(&msg.body)) {
-                        player.ready = m->ready;
-                        msg.body = ServerSetReady{player.ready, id};
-                        for (auto &[tid, tplayer] : s.players) {
-                            tplayer.send_buffer.write(msg);
-                        }
-                    } else if (auto m = std::get_if<PlayerInput>(&msg.body)) {
-                        if (m->down) {
-                            player.input_buffer.push_back(m->key);
-                        }
-                    }
-                }
-
-                ++it;
-            } else {
-                auto erase_id = it->first;
-                it = s.players.erase(it);
-                Message msg;
-                msg.body = PlayerLeft{erase_id};
-                for (auto &[tid, tplayer] : s.players) {
-                    tplayer.send_buffer.write(msg);
-                }
-            }
-
-        } else {
-            ++it;
-        }
+    {
+        Allocs::Scope scope(Tag::Net);
+        s.receive();
     }
 
     if (s.game_running) {
-        s.game_tick(input, dt);
+        {
+            Allocs::Scope scope(Tag::Tick);
+            s.game_tick(input, dt);
+        }
+        Allocs::Scope scope(Tag::Render);
+        s.draw();
     }
 
-    for (auto &[id, player] : s.players) {
-        if (id == s.local_id)
-            continue;
+    {
+        Allocs::Scope scope(Tag::Net);
+        s.end_frame();
+        s.network.metrics.update();
+    }
 
-        s.network.send(player.send_buffer, id);
+    Allocs::Scope scope(Tag::Ui);
+    if (show_metrics) {
+        ui::text(5, 80, s.network.metrics.summary(), 16);
     }
 
     int y = 50;
@@ -275,6 +254,7 @@ void SnakeGame::host_lobby(HostLobby &s, Input &input, float dt) {
 }
 
 void SnakeGame::guest_lobby(GuestLobby &s, Input &input, float dt) {
+    using Allocs::Tag;
 
     s.network.print_stats();
 
@@ -283,11 +263,12 @@ void SnakeGame::guest_lobby(GuestLobby &s, Input &input, float dt) {
     s.send_buffer.reset();
 
     if (!s.game_running) {
+        Allocs::Scope scope(Tag::Ui);
         ui::label(5, 0, "Lobby");
 
         if (bool ready; ui::toggle_button(250, 0, "Ready", &ready)) {
             msg.body = SetReady{ready};
-            s.send_buffer.write(msg);
+            s.send(msg);
             //        printf("Sending %s\n", ready ? "Ready" : "Not Ready");
         }
         if (ui::push_button(400, 0, "GuestLobby##Quit")) {
@@ -296,59 +277,38 @@ void SnakeGame::guest_lobby(GuestLobby &s, Input &input, float dt) {
     }
 
     if (s.network.connected()) {
+        Allocs::Scope scope(Tag::Net);
 
         if (s.local_id == 0) {
-            msg.body.emplace<JoinRequest>();
-            s.send_buffer.write(msg);
+            msg.body = JoinRequest{PROTOCOL_VERSION, use_compression};
+            s.send(msg);
             printf("Sending JoinRequest\n");
         } else {
-            msg.body.emplace<HeartBeat>();
-            s.send_buffer.write(msg);
+            msg.body = HeartBeat{s.network.metrics.now_ms(), s.host_time};
+            s.host_time = 0;
+            s.send(msg);
         }
 
         if (s.game_running) {
+            Allocs::Scope scope(Tag::Tick);
             s.game_tick(input, dt);
+            s.draw();
         }
 
         s.network.send(s.send_buffer, 0);
 
-        if (s.network.recv(recv_buffer, 0)) {
-            while (!recv_buffer.empty()) {
-                recv_buffer.read(msg);
-                if (auto m = std::get_if<JoinResponse>(&msg.body)) {
-                    printf("Received JoinResponse\n");
-                    s.add_player(m->id);
-                    s.local_id = m->id;
-                } else if (auto m = std::get_if<NewPlayer>(&msg.body)) {
-                    printf("Received NewPlayer\n");
-                    auto p = s.add_player(m->id);
-                    p->ready = m->ready;
-                } else if (auto m = std::get_if<ServerSetReady>(&msg.body)) {
-                    printf("Received ServerSetReady (v=%d id=%d)\n", m->ready,
-                           m->id);
-                    auto &p = s.players.at(m->id);
-                    p.ready = m->ready;
-                } else if (auto m = std::get_if<PlayerLeft>(&msg.body)) {
-                    s.players.erase(m->id);
-                } else if (auto m = std::get_if<SetPlayerInfo>(&msg.body)) {
-                    auto &p = s.players.at(m->id);
-                    p.spawnX = m->spawnX;
-                    p.spawnY = m->spawnY;
-                    p.spawn_dir = m->spawn_dir;
-                    p.color = m->color;
-                    p.ready = m->ready;
-                } else if (auto m = std::get_if<StartGame>(&msg.body)) {
-                    s.game_running = true;
-                } else {
-                    s.msgs.push_back(msg);
-                }
-            }
-
-        } else {
+        if (!s.receive()) {
             state.emplace<MainMenu>();
+            return;
         }
     }
 
+    s.network.metrics.update();
+    Allocs::Scope scope(Tag::Ui);
+    if (show_metrics) {
+        ui::text(5, 80, s.network.metrics.summary(), 16);
+    }
+
     if (!s.game_running) {
 
         int y = 50;
@@ -365,8 +325,12 @@ void SnakeGame::guest_lobby(GuestLobby &s, Input &input, float dt) {
 
 //
 void SnakeGame::main_menu(MainMenu &s, Input &input, float dt) {
+    PROFILE_ZONE("SnakeGame::main_menu");
+    Allocs::Scope scope(Allocs::Tag::Ui);
     auto [w, h] = window->getView().getSize();
     const int N = 4;
+    ui::toggle_button(5, 0, "UDP", &use_udp);
+    ui::toggle_button(100, 0, "Compress", &use_compression);
     if (ui::push_button(w / 2, 1 * h / (N + 1), "MainMenu##Single Player",
                         ui::Align::Center)) {
         state.emplace<SinglePlayer>(*this);
@@ -395,7 +359,15 @@ SnakeGame::SinglePlayer::SinglePlayer(SnakeGame &game) : game(game) {
 }
 
 void SnakeGame::single_player(SinglePlayer &s, Input &input, float dt) {
-    s.game_tick(input, dt);
+    {
+        // draws as it goes
+        Allocs::Scope scope(Allocs::Tag::Tick);
+        s.game_tick(input, dt);
+    }
+    Allocs::Scope scope(Allocs::Tag::Ui);
+    if (show_metrics) {
+        ui::text(5, 80, input_latency.summary(), 16);
+    }
 }
 
 SnakeGame::Player *SnakeGame::SinglePlayer::add_player() {
@@ -409,20 +381,21 @@ SnakeGame::Player *SnakeGame::SinglePlayer::add_player() {
 }
 
 void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
+    PROFILE_ZONE("SinglePlayer::game_tick");
     for (auto &ev : input.events) {
         auto &player = players.at(local_id);
         if (auto e = std::get_if<Input::KeyPressed>(&ev)) {
             if (e->key == sf::Keyboard::Space) {
-                player.boost = true;
+                player.boost() = true;
             } else if (e->key == sf::Keyboard::P) {
                 paused = !paused;
             } else {
-                player.input_buffer.push_back(e->key);
+                player.input_buffer.push_back({e->key, e->time});
                 paused = false;
             }
         } else if (auto e = std::get_if<Input::KeyReleased>(&ev)) {
             if (e->key == sf::Keyboard::Space) {
-                player.boost = false;
+                player.boost() = false;
             } else {
             }
         } else if (auto e = std::get_if<Input::LostFocus>(&ev)) {
@@ -431,42 +404,32 @@ void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
     }
 
     for (auto &[id, player] : players) {
-        int div = player.boost ? 0 : 1;
-        if (!paused && player.moveCounter++ >= player.moveDelay * div) {
-            if (!player.input_buffer.empty()) {
-                auto k = player.input_buffer.front();
-                player.input_buffer.pop_front();
-                if (k == sf::Keyboard::Left) {
-                    player.dir = set_dir(player, Direction::Left);
-                }
-
-                else if (k == sf::Keyboard::Right) {
-                    player.dir = set_dir(player, Direction::Right);
-                }
-
-                else if (k == sf::Keyboard::Down) {
-                    player.dir = set_dir(player, Direction::Down);
-                }
-
-                else if (k == sf::Keyboard::Up) {
-                    player.dir = set_dir(player, Direction::Up);
-                }
+        int div = player.boost() ? 0 : 1;
+        if (!paused && player.moveCounter()++ >= player.moveDelay() * div) {
+            auto &keys = player.input_buffer;
+            if (!keys.empty()) {
+                const auto from = player.dir();
+                const auto used =
+                    resolve_turn(player.dir(), keys.begin(), keys.end());
+                game.input_latency.used(keys.begin(), used,
+                                        player.dir() != from);
+                keys.erase(keys.begin(), used);
             }
 
-            for (int i = player.body.size() - 1; i > 0; --i) {
-                player.body[i].x = player.body[i - 1].x;
-                player.body[i].y = player.body[i - 1].y;
+            for (int i = player.body().size() - 1; i > 0; --i) {
+                player.body()[i].x = player.body()[i - 1].x;
+                player.body()[i].y = player.body()[i - 1].y;
             }
 
             if (player.use_ai) {
                 //                player.dir =
                 //                next_left[static_cast<int>(player.dir)];
-                Direction test_dir = player.dir;
+                Direction test_dir = player.dir();
                 int n = 0;
                 bool found = false;
                 do {
-                    int ty = player.body[0].y;
-                    int tx = player.body[0].x;
+                    int ty = player.body()[0].y;
+                    int tx = player.body()[0].x;
 
                     switch (test_dir) {
                     case Direction::Down:
@@ -498,36 +461,36 @@ void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
                         found = true;
                     }
                 } while (!found && ++n < 4);
-                player.dir = test_dir;
+                player.dir() = test_dir;
             }
 
-            switch (player.dir) {
+            switch (player.dir()) {
             case Direction::Down:
-                player.body[0].y++;
+                player.body()[0].y++;
                 break;
             case Direction::Up:
-                player.body[0].y--;
+                player.body()[0].y--;
                 break;
             case Direction::Left:
-                player.body[0].x--;
+                player.body()[0].x--;
                 break;
             case Direction::Right:
-                player.body[0].x++;
+                player.body()[0].x++;
                 break;
             }
-            player.moveCounter = 0;
+            player.moveCounter() = 0;
 
             game.foodRegrowCount++;
         }
     }
 
     for (auto &[id, player] : players) {
-        if (player.body[0].x < 0 || player.body[0].x >= game.gridCols ||
-            player.body[0].y < 0 || player.body[0].y >= game.gridRows) {
+        if (player.body()[0].x < 0 || player.body()[0].x >= game.gridCols ||
+            player.body()[0].y < 0 || player.body()[0].y >= game.gridRows) {
             add_message("You died! Do no try to go out of the playing field.\n"
                         "Final score: %d",
-                        player.body.size() - 3);
-            player.dead = true;
+                        player.body().size() - 3);
+            player.dead() = true;
         }
 
         for (auto f : game.food) {
@@ -537,11 +500,11 @@ void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
         }
 
         int n = 0;
-        for (auto [x, y] : player.body) {
+        for (auto [x, y] : player.body()) {
 
             game.body_shape.setPosition(x * game.gridSize, y * game.gridSize);
             auto color = player.color;
-            color.a = 255 - n * 64 / player.body.size();
+            color.a = 255 - n * 64 / player.body().size();
             game.body_shape.setFillColor(color);
             if (id == local_id) {
                 game.body_shape.setOutlineColor({255, 255, 255, 255});
@@ -556,10 +519,10 @@ void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
 
         for (auto it = game.food.begin(); it != game.food.end();) {
             auto f = *it;
-            if (player.body[0] == f->p) {
+            if (player.body()[0] == f->p) {
                 for (int i = 0; i < game.foodGrowth; ++i) {
-                    if (player.body.size() < 50) {
-                        player.body.push_back(player.body.back());
+                    if (player.body().size() < 50) {
+                        player.body().push_back(player.body().back());
                     }
                 }
                 game.world_map((*it)->p.x, (*it)->p.y).food = nullptr;
@@ -585,13 +548,13 @@ void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
         if (collision) {
             add_message("You died! Do no eat snakes.\n"
                         "Final score: %d",
-                        player.body.size() - 3);
-            player.dead = true;
+                        player.body().size() - 3);
+            player.dead() = true;
         }
     }
 
     for (auto &[id, player] : players) {
-        if (player.dead) {
+        if (player.dead()) {
             decompose(player);
             spawn(player);
         }
@@ -603,6 +566,8 @@ void SnakeGame::SinglePlayer::game_tick(Input &input, float dt) {
 }
 
 SnakeGame::Player *SnakeGame::HostLobby::add_player(Network::ClientID id) {
+    // a guest joining mid frame only gets what is broadcast after it
+    share_broadcast();
     auto &player = players.emplace(id, Player{}).first->second;
     player.spawn_dir = Direction::Up;
     player.color = game.get_random_color();
@@ -612,9 +577,30 @@ SnakeGame::Player *SnakeGame::HostLobby::add_player(Network::ClientID id) {
 }
 
 SnakeGame::HostLobby::HostLobby(SnakeGame &game) : game(game) {
+    record_frames(network, "host");
+    watch_metrics(network);
+    network.simulator.from_env();
     auto player = add_player(local_id);
     player->ready = true;
     game.world_map.resize(game.gridCols, game.gridRows);
+    if (game.use_udp) {
+        network.transport = Network::Transport::Udp;
+    }
+    network.start_server();
+}
+
+SnakeGame::HostLobby::HostLobby(SnakeGame &game, net::io_context &ctx,
+                                u16 port)
+    : network(ctx), game(game) {
+    game.world_map.resize(game.gridCols, game.gridRows);
+    network.port = port;
+    network.blocking = false;
+    record_frames(network, "host");
+    network.metrics.type_name = SnakeNetwork::message_name;
+    network.simulator.from_env();
+    if (game.use_udp) {
+        network.transport = Network::Transport::Udp;
+    }
     network.start_server();
 }
 
@@ -630,37 +616,237 @@ void SnakeGame::HostLobby::recompute_spawn_points() {
 }
 
 void SnakeGame::HostLobby::spawn(SnakeGame::Player &player) {
-    player.body.resize(player.initialSize);
-    player.body[0] = {static_cast<int>(player.spawnX),
-                      static_cast<int>(player.spawnY)};
+    player.body().resize(player.initialSize);
+    player.body()[0] = {static_cast<int>(player.spawnX),
+                        static_cast<int>(player.spawnY)};
+
+    for (size_t i = 1; i < player.body().size(); ++i) {
+        player.body()[i].x = player.body()[i - 1].x;
+        player.body()[i].y = player.body()[i - 1].y + 1;
+    }
+
+    player.dir() = player.spawn_dir;
+    player.dead() = false;
+
+    tick_changes.spawned.push_back(slot(player.id));
+}
+
+void SnakeGame::HostLobby::decompose(Player &player) {
+    for (size_t i = 1; i < player.body().size(); ++i) {
+        add_food(player.body()[i].x, player.body()[i].y);
+    }
 
-    for (size_t i = 1; i < player.body.size(); ++i) {
-        player.body[i].x = player.body[i - 1].x;
-        player.body[i].y = player.body[i - 1].y + 1;
+    player.input_buffer.clear();
+}
+
+void SnakeGame::HostLobby::begin_frame() {
+    broadcast.reset();
+    for (auto &[id, player] : players) {
+        player.send_buffer.reset();
+        player.frame.reset();
+        player.state_frame.reset();
     }
+}
 
-    player.dir = player.spawn_dir;
-    player.dead = false;
+void SnakeGame::HostLobby::accept_players() {
+    while (auto id = network.get_new_client()) {
+        printf("Got new player: %d\n", *id);
+        add_player(*id);
+    }
+}
 
+void SnakeGame::HostLobby::start_game() {
     using namespace SnakeNetwork;
+    recompute_spawn_points();
+    for (auto &[id, player] : players) {
+        Message msg;
+        msg.body = SetPlayerInfo{id,
+                                 player.ready,
+                                 player.spawnX,
+                                 player.spawnY,
+                                 player.spawn_dir,
+                                 player.color};
+        send_all(msg);
+    }
+
+    begin_tick();
+    for (auto &[id, player] : players) {
+        spawn(player);
+    }
+    end_tick();
+    schedule_food();
+
     Message msg;
-    msg.body = SpawnPlayer{player.id};
+    msg.body = StartGame{};
     send_all(msg);
+    game_running = true;
+    Allocs::settle();
 }
 
-void SnakeGame::HostLobby::decompose(Player &player) {
-    for (size_t i = 1; i < player.body.size(); ++i) {
-        add_food(player.body[i].x, player.body[i].y);
+// Back to waiting in the lobby, with the map cleared for the next game.
+void SnakeGame::HostLobby::end_game() {
+    for (auto f : game.food) {
+        remove_food(f);
+    }
+    game.food.clear();
+    tick_changes = {};
+    snapshots.clear();
+    for (auto &[id, player] : players) {
+        player.acked_snapshot = 0;
+        player.interest_snapshots.clear();
     }
+    timers.clear();
+    tick = 0;
+    game_running = false;
+}
 
-    player.input_buffer.clear();
+void SnakeGame::HostLobby::receive() {
+    PROFILE_ZONE("HostLobby::receive");
+    auto &recv_buffer = game.recv_buffer;
+    for (auto it = players.begin(); it != players.end();) {
+        const auto id = it->first;
+        auto &player = it->second;
+        using namespace SnakeNetwork;
+        if (id != local_id) {
+            if (network.recv(recv_buffer, id)) {
+                Message msg;
+                u32 start = recv_buffer.start_index;
+                while (decode(recv_buffer, msg)) {
+                    auto &metrics = network.metrics;
+                    metrics.count_received(msg.body.index(),
+                                           recv_buffer.start_index - start);
+                    start = recv_buffer.start_index;
+                    if (auto m = std::get_if<HeartBeat>(&msg.body)) {
+                        const u32 now = metrics.now_ms();
+                        if (m->echo != 0) {
+                            metrics.rtt_sample(id, now - m->echo);
+                        }
+                        msg.body = HeartBeat{now, m->time};
+                        send_to(player, msg);
+                    } else if (auto m = std::get_if<JoinRequest>(&msg.body)) {
+                        if (m->version != PROTOCOL_VERSION) {
+                            add_message("Player %u uses protocol version %u, "
+                                        "expected %u",
+                                        id, m->version, PROTOCOL_VERSION);
+                            network.disconnect(id);
+                            break;
+                        }
+                        const bool compress =
+                            m->compression && game.use_compression;
+                        network.set_compression(id, compress);
+                        msg.body.emplace<JoinResponse>(id, compress);
+                        send_to(player, msg);
+                        for (auto &[tid, tplayer] : players) {
+                            msg.body = NewPlayer{tid, tplayer.ready};
+                            send_to(player, msg);
+                            printf("Sharing player %u with %u\n", tid, id);
+                        }
+
+                        for (auto &[tid, tplayer] : players) {
+                            if (tid != id && tid != local_id) {
+                                msg.body = NewPlayer{id, player.ready};
+                                send_to(tplayer, msg);
+                                printf("Sharing player %u with %u\n", id, tid);
+                            }
+                        }
+
+                    } else if (auto m = std::get_if<SetReady>(&msg.body)) {
+                        player.ready = m->ready;
+                        msg.body = ServerSetReady{player.ready, id};
+                        send_all(msg);
+                    } else if (auto m = std::get_if<PlayerInput>(&msg.body)) {
+                        if (m->down) {
+                            player.input_buffer.push_back({m->key, {}});
+                            player.input_seq = m->seq;
+                        }
+                    } else if (auto m = std::get_if<SnapshotAck>(&msg.body)) {
+                        player.acked_snapshot =
+                            std::max(player.acked_snapshot, m->tick);
+                    }
+                }
+
+                ++it;
+            } else {
+                auto erase_id = it->first;
+                it = players.erase(it);
+                network.disconnect(erase_id);
+                Message msg;
+                msg.body = PlayerLeft{erase_id};
+                send_all(msg);
+            }
+
+        } else {
+            ++it;
+        }
+    }
+}
+
+void SnakeGame::HostLobby::end_frame() {
+    PROFILE_ZONE("HostLobby::end_frame");
+    share_broadcast();
+    const auto now = Network::Clock::now();
+
+    // Guests whose frames hold the same segments are sent the first such
+    // frame, which the network then compresses once for all of them.
+    using Segments = std::vector<Network::SharedBytes>;
+    auto less = [](const Segments *a, const Segments *b) { return *a < *b; };
+    using Sent = std::map<
+        const Segments *, const Network::Frame *, decltype(less),
+        ArenaAllocator<std::pair<const Segments *const,
+                                 const Network::Frame *>>>;
+    Sent sent(less, game.frame_arena);
+    auto first_sent = [&](const Network::Frame &frame) -> auto & {
+        if (!game.use_compression)
+            return frame;
+        return *sent.emplace(&frame.segments, &frame).first->second;
+    };
+
+    for (auto &[id, player] : players) {
+        if (id == local_id)
+            continue;
+
+        player.frame.append(player.send_buffer);
+        player.frame.origin = now;
+        player.state_frame.origin = now;
+        network.send(first_sent(player.frame), id);
+        if (!player.state_frame.empty()) {
+            network.send(first_sent(player.state_frame), id,
+                         Network::Channel::Unreliable);
+        }
+    }
+}
+
+u32 SnakeGame::HostLobby::guest_count() const {
+    return players.size() - players.count(local_id);
 }
 
 void SnakeGame::HostLobby::send_all(SnakeNetwork::Message &msg) {
+    const auto size = broadcast.bytes.size();
+    SnakeNetwork::encode(broadcast, msg);
+    network.metrics.count_sent(msg.body.index(),
+                               broadcast.bytes.size() - size, guest_count());
+}
+
+// Anything broadcast so far has to go out before the private message.
+void SnakeGame::HostLobby::send_to(Player &player, SnakeNetwork::Message &msg) {
+    share_broadcast();
+    const auto size = player.send_buffer.bytes.size();
+    SnakeNetwork::encode(player.send_buffer, msg);
+    network.metrics.count_sent(msg.body.index(),
+                               player.send_buffer.bytes.size() - size);
+}
+
+// Seals the pending broadcast into one segment, placed in every guest's
+// frame after what that guest was sent privately up to now.
+void SnakeGame::HostLobby::share_broadcast() {
+    if (broadcast.bytes.empty())
+        return;
+    auto shared = Network::share(broadcast);
     for (auto &[id, player] : players) {
         if (id == local_id)
             continue;
-        player.send_buffer.write(msg);
+        player.frame.append(player.send_buffer);
+        player.frame.append(shared);
     }
 }
 
@@ -669,28 +855,100 @@ void SnakeGame::HostLobby::add_food(int x, int y) {
         auto f = new Food{x, y};
         game.world_map(x, y).food = f;
         game.food.push_back(f);
-        using namespace SnakeNetwork;
-        Message msg;
-        msg.body = SpawnFood{x, y};
+        tick_changes.food_added.push_back({x, y});
+    }
+}
+
+// A cell whose food was added earlier in the same tick simply drops out of
+// the update, anything else is sent as a removal.
+void SnakeGame::HostLobby::remove_food(Food *f) {
+    auto &added = tick_changes.food_added;
+    if (auto it = std::find(added.begin(), added.end(), f->p);
+        it != added.end()) {
+        added.erase(it);
+    } else {
+        tick_changes.food_removed.push_back(f->p);
+    }
+    game.world_map(f->p.x, f->p.y).food = nullptr;
+    delete f;
+}
+
+u32 SnakeGame::HostLobby::slot(Network::ClientID id) {
+    return std::lower_bound(slot_ids.begin(), slot_ids.end(), id) -
+           slot_ids.begin();
+}
+
+void SnakeGame::HostLobby::begin_tick() {
+    slot_ids = player_slots(players);
+    tick++;
+}
+
+void SnakeGame::HostLobby::end_tick() {
+    auto &c = tick_changes;
+    std::sort(c.moves.begin(), c.moves.end(),
+              [](auto &a, auto &b) { return a.slot < b.slot; });
+    for (auto slots : {&c.grown, &c.spawned}) {
+        std::sort(slots->begin(), slots->end());
+        slots->erase(std::unique(slots->begin(), slots->end()), slots->end());
+    }
+
+    using namespace SnakeNetwork;
+    Message msg;
+    if (interest_radius == 0) {
+        msg.body = TickUpdate{tick, static_cast<u32>(slot_ids.size()),
+                              std::move(tick_changes)};
         send_all(msg);
     }
+    tick_changes = {};
+
+    // key presses still buffered are the newest ones received, everything
+    // before them was applied or dropped on death
+    for (auto &[id, player] : players) {
+        if (id == local_id)
+            continue;
+        const u32 applied =
+            player.input_seq - static_cast<u32>(player.input_buffer.size());
+        if (applied != player.acked_input ||
+            player.moves != player.acked_moves) {
+            player.acked_input = applied;
+            player.acked_moves = player.moves;
+            msg.body = InputAck{applied, player.moves};
+            send_to(player, msg);
+        }
+    }
+}
+
+// Food grows back every foodRegrow + 1 ticks of a player, as when every
+// player counted towards it each tick, so a crowded map gets it sooner.
+void SnakeGame::HostLobby::schedule_food() {
+    const u64 n = std::max<u64>(players.size(), 1);
+    timers.schedule((game.foodRegrow + n) / n, [this] {
+        if (game.food.size() < 10) {
+            add_food(rand() % game.gridCols, rand() % game.gridRows);
+        }
+        schedule_food();
+    });
 }
 
 void SnakeGame::HostLobby::grow_player(SnakeGame::Player &player) {
     for (int i = 0; i < game.foodGrowth; ++i) {
-        if (player.body.size() < 50) {
-            player.body.push_back(player.body.back());
+        if (player.body().size() < 50) {
+            player.body().push_back(player.body().back());
         }
     }
 
-    using namespace SnakeNetwork;
-    Message msg;
-    msg.body = PlayerGrow{player.id};
-    send_all(msg);
+    tick_changes.grown.push_back(slot(player.id));
 }
 
 SnakeGame::GuestLobby::GuestLobby(SnakeGame &game) : game(game) {
+    record_frames(network, "guest");
+    watch_metrics(network);
+    network.simulator.from_env();
+    jitter.from_env();
     game.world_map.resize(game.gridCols, game.gridRows);
+    if (game.use_udp) {
+        network.transport = Network::Transport::Udp;
+    }
 
     network.connect();
 }
@@ -709,92 +967,138 @@ SnakeGame::Player *SnakeGame::GuestLobby::add_player(Network::ClientID id) {
 }
 
 void SnakeGame::GuestLobby::spawn(SnakeGame::Player &player) {
-    player.body.resize(player.initialSize);
-    player.body[0] = {static_cast<int>(player.spawnX),
-                      static_cast<int>(player.spawnY)};
+    player.body().resize(player.initialSize);
+    player.body()[0] = {static_cast<int>(player.spawnX),
+                        static_cast<int>(player.spawnY)};
 
-    for (size_t i = 1; i < player.body.size(); ++i) {
-        player.body[i].x = player.body[i - 1].x;
-        player.body[i].y = player.body[i - 1].y + 1;
+    for (size_t i = 1; i < player.body().size(); ++i) {
+        player.body()[i].x = player.body()[i - 1].x;
+        player.body()[i].y = player.body()[i - 1].y + 1;
     }
 
-    player.dir = player.spawn_dir;
-    player.dead = false;
+    player.dir() = player.spawn_dir;
+    player.dead() = false;
+    player.prev_body.clear();
 }
 
 void SnakeGame::HostLobby::game_tick(Input &input, float dt) {
-    using namespace SnakeNetwork;
-    Message msg;
+    PROFILE_ZONE("HostLobby::game_tick");
+    begin_tick();
 
     for (auto &ev : input.events) {
         auto &player = players.at(local_id);
         if (auto e = std::get_if<Input::KeyPressed>(&ev)) {
-            player.input_buffer.push_back(e->key);
+            player.input_buffer.push_back({e->key, e->time});
         } else if (auto e = std::get_if<Input::KeyReleased>(&ev)) {
         }
     }
 
-    for (auto &[id, player] : players) {
-        int div = player.boost ? 0 : 1;
-        if (player.moveCounter++ >= player.moveDelay * div) {
-            if (!player.input_buffer.empty()) {
-                auto k = player.input_buffer.front();
-                player.input_buffer.pop_front();
-                if (k == sf::Keyboard::Left) {
-                    player.dir = set_dir(player, Direction::Left);
-                }
+    // The loops go over the hot arrays by position and only look at the
+    // rest of a player when something happens to it.
+    for (size_t i = 0; i < players.size(); ++i) {
+        auto &m = players.motion(i);
+        const int div = m.boost ? 0 : 1;
+        if (m.moveCounter++ < m.moveDelay * div)
+            continue;
 
-                else if (k == sf::Keyboard::Right) {
-                    player.dir = set_dir(player, Direction::Right);
-                }
+        auto &[id, player] = players[i];
+        auto &keys = player.input_buffer;
+        if (!keys.empty()) {
+            const auto from = m.dir;
+            const auto used = resolve_turn(m.dir, keys.begin(), keys.end());
+            if (id == local_id) {
+                game.input_latency.used(keys.begin(), used, m.dir != from);
+            }
+            keys.erase(keys.begin(), used);
+        }
 
-                else if (k == sf::Keyboard::Down) {
-                    player.dir = set_dir(player, Direction::Down);
-                }
+        auto &body = players.body(i);
+        for (size_t k = body.size() - 1; k > 0; --k) {
+            body[k] = body[k - 1];
+        }
 
-                else if (k == sf::Keyboard::Up) {
-                    player.dir = set_dir(player, Direction::Up);
-                }
-            }
+        switch (m.dir) {
+        case Direction::Down:
+            body[0].y++;
+            break;
+        case Direction::Up:
+            body[0].y--;
+            break;
+        case Direction::Left:
+            body[0].x--;
+            break;
+        case Direction::Right:
+            body[0].x++;
+            break;
+        }
+        tick_changes.moves.push_back({slot(id), m.dir});
+        player.moves++;
+        m.moveCounter = 0;
+    }
 
-            for (int i = player.body.size() - 1; i > 0; --i) {
-                player.body[i].x = player.body[i - 1].x;
-                player.body[i].y = player.body[i - 1].y;
+    for (size_t i = 0; i < players.size(); ++i) {
+        // a copy, growing moves the body
+        const auto head = players.body(i)[0];
+        auto &m = players.motion(i);
+        if (head.x < 0 || head.x >= static_cast<int>(game.gridCols) ||
+            head.y < 0 || head.y >= static_cast<int>(game.gridRows)) {
+            m.dead = true;
+        }
+
+        for (auto it = game.food.begin(); it != game.food.end();) {
+            auto f = *it;
+            if (head == f->p) {
+                grow_player(players[i].second);
+                it = game.food.erase(it);
+                remove_food(f);
+            } else {
+                ++it;
             }
+        }
 
-            switch (player.dir) {
-            case Direction::Down:
-                player.body[0].y++;
-                break;
-            case Direction::Up:
-                player.body[0].y--;
-                break;
-            case Direction::Left:
-                player.body[0].x--;
-                break;
-            case Direction::Right:
-                player.body[0].x++;
+        // into any body, its own past the head
+        for (size_t j = 0; j < players.size(); ++j) {
+            auto &body = players.body(j);
+            if (std::find(body.begin() + (i == j), body.end(), head) !=
+                body.end()) {
+                m.dead = true;
                 break;
             }
-            msg.body = MovePlayer{player.id, player.dir};
-            send_all(msg);
-            player.moveCounter = 0;
         }
     }
 
-    for (auto &[id, player] : players) {
-        if (player.body[0].x < 0 || player.body[0].x >= game.gridCols ||
-            player.body[0].y < 0 || player.body[0].y >= game.gridRows) {
-            player.dead = true;
+    // after the moves, food a timer adds cannot be eaten in the same tick,
+    // which guests would apply in the wrong order
+    timers.advance();
+
+    for (size_t i = 0; i < players.size(); ++i) {
+        if (players.motion(i).dead) {
+            decompose(players[i].second);
+            spawn(players[i].second);
         }
-		
+    }
+
+    end_tick();
+
+    if (interest_radius > 0 || tick % SNAPSHOT_INTERVAL == 0) {
+        send_snapshots();
+    }
+
+    //    if (s.paused) {
+    //        window->draw(pause_text);
+    //    }
+}
 
+// Kept out of game_tick so a dedicated server can run the game headless.
+void SnakeGame::HostLobby::draw() {
+    PROFILE_ZONE("HostLobby::draw");
+    for (auto &[id, player] : players) {
         int n = 0;
-        for (auto [x, y] : player.body) {
+        for (auto [x, y] : player.body()) {
 
             game.body_shape.setPosition(x * game.gridSize, y * game.gridSize);
             auto color = player.color;
-            color.a = 255 - n * 64 / player.body.size();
+            color.a = 255 - n * 64 / player.body().size();
             game.body_shape.setFillColor(color);
             if (id == local_id) {
                 game.body_shape.setOutlineColor({255, 255, 255, 255});
@@ -806,37 +1110,6 @@ void SnakeGame::HostLobby::game_tick(Input &input, float dt) {
             window->draw(game.body_shape);
             n++;
         }
-
-        for (auto it = game.food.begin(); it != game.food.end();) {
-            auto f = *it;
-            if (player.body[0] == f->p) {
-                grow_player(player);
-                msg.body = DestroyFood{f->p.x, f->p.y};
-                send_all(msg);
-                game.world_map((*it)->p.x, (*it)->p.y).food = nullptr;
-                it = game.food.erase(it);
-                delete f;
-            } else {
-                ++it;
-            }
-        }
-
-        if (game.foodRegrowCount++ >= game.foodRegrow &&
-            game.food.size() < 10) {
-            add_food(rand() % game.gridCols, rand() % game.gridRows);
-            game.foodRegrowCount = 0;
-        }
-
-        bool collision = false;
-        for (auto &[id_test, player_test] : players) {
-            if (game.on_player(player, player_test)) {
-                collision = true;
-                break;
-            }
-        }
-        if (collision) {
-            player.dead = true;
-        }
     }
 
 	ui::label(5, 5, "food: %3d", game.food.size());
@@ -845,80 +1118,249 @@ void SnakeGame::HostLobby::game_tick(Input &input, float dt) {
 			f->p.y * game.gridSize);
 		window->draw(game.food_shape);
 	}
+}
+
+SnakeGame::WorldState SnakeGame::HostLobby::world_state() {
+    WorldState state;
+    state.tick = tick;
+    for (auto id : slot_ids) {
+        auto &p = players.at(id);
+        state.players.push_back({id, p.dir(), p.body()});
+    }
+    for (auto f : game.food) {
+        state.food.push_back(f->p);
+    }
+    std::sort(state.food.begin(), state.food.end(), cell_less);
+    return state;
+}
+
+// Each guest gets the world encoded against the last snapshot it
+// acknowledged, guests sharing an ack share the encoded bytes.
+void SnakeGame::HostLobby::send_snapshots() {
+    PROFILE_ZONE("HostLobby::send_snapshots");
+    auto state = world_state();
+    if (interest_radius > 0) {
+        send_interest_snapshots(state);
+        return;
+    }
 
+    using Encoded = std::unordered_map<
+        u32, Network::SharedBytes, std::hash<u32>, std::equal_to<u32>,
+        ArenaAllocator<std::pair<const u32, Network::SharedBytes>>>;
+    Encoded encoded(players.size(), game.frame_arena);
     for (auto &[id, player] : players) {
-        if (player.dead) {
-            decompose(player);
-            spawn(player);
+        if (id == local_id)
+            continue;
+
+        const auto base_tick = player.acked_snapshot;
+        auto it = encoded.find(base_tick);
+        if (it == encoded.end()) {
+            auto base = std::find_if(
+                snapshots.begin(), snapshots.end(),
+                [base_tick](auto &s) { return s.tick == base_tick; });
+
+            SnakeNetwork::Message msg;
+            msg.body = SnakeNetwork::make_snapshot(
+                base == snapshots.end() ? nullptr : &*base, state);
+            Network::Buffer b;
+            SnakeNetwork::encode(b, msg);
+            it = encoded.emplace(base_tick, Network::share(b)).first;
         }
+        network.metrics.count_sent(
+            SnakeNetwork::tag_of<SnakeNetwork::WorldSnapshot>(),
+            it->second->size());
+        player.state_frame.append(it->second);
     }
 
-    //    if (s.paused) {
-    //        window->draw(pause_text);
-    //    }
+    snapshots.push_back(std::move(state));
+    if (snapshots.size() > SNAPSHOT_HISTORY) {
+        snapshots.pop_front();
+    }
 }
 
-SnakeGame::Direction SnakeGame::HostLobby::set_dir(SnakeGame::Player &player,
-                                                   SnakeGame::Direction d) {
-    if (player.dir == Direction::Down && d == Direction::Up)
-        return player.dir;
+// Each guest's view is encoded against the last view it acknowledged, so
+// snakes entering it go out in full and the ones leaving it as removes.
+void SnakeGame::HostLobby::send_interest_snapshots(const WorldState &world) {
+    const int radius = interest_radius;
+    interest.reset(game.gridCols, game.gridRows, radius);
+    for (auto &p : world.players) {
+        if (!p.body.empty())
+            interest.add_head(p.id, p.body[0]);
+    }
+    for (auto &f : world.food) {
+        interest.add_food(f);
+    }
 
-    if (player.dir == Direction::Left && d == Direction::Right)
-        return player.dir;
+    std::vector<Network::ClientID> ids;
+    for (auto &[id, player] : players) {
+        if (id == local_id || player.body().empty())
+            continue;
 
-    if (player.dir == Direction::Right && d == Direction::Left)
-        return player.dir;
+        WorldState view;
+        view.tick = world.tick;
+        ids.clear();
+        interest.query(player.body()[0], radius, ids, view.food);
+        std::sort(ids.begin(), ids.end());
+        std::sort(view.food.begin(), view.food.end(), cell_less);
+        for (auto &p : world.players) {
+            if (std::binary_search(ids.begin(), ids.end(), p.id))
+                view.players.push_back(p);
+        }
 
-    if (player.dir == Direction::Up && d == Direction::Down)
-        return player.dir;
+        auto &history = player.interest_snapshots;
+        const auto base_tick = player.acked_snapshot;
+        auto base = std::find_if(
+            history.begin(), history.end(),
+            [base_tick](auto &s) { return s.tick == base_tick; });
+
+        SnakeNetwork::Message msg;
+        msg.body = SnakeNetwork::make_snapshot(
+            base == history.end() ? nullptr : &*base, view);
+        Network::Buffer b;
+        SnakeNetwork::encode(b, msg);
+        network.metrics.count_sent(msg.body.index(), b.bytes.size());
+        player.state_frame.append(Network::share(b));
+
+        history.push_back(std::move(view));
+        if (history.size() > SNAPSHOT_HISTORY) {
+            history.pop_front();
+        }
+    }
+}
 
-    return d;
+void SnakeGame::InterestGrid::reset(int map_cols, int map_rows, int cell) {
+    cell_size = std::max(cell, 1);
+    cols = (map_cols + cell_size - 1) / cell_size;
+    rows = (map_rows + cell_size - 1) / cell_size;
+    heads.resize(cols * rows);
+    food.resize(cols * rows);
+    for (auto &bucket : heads)
+        bucket.clear();
+    for (auto &bucket : food)
+        bucket.clear();
+}
+
+int SnakeGame::InterestGrid::bucket(const sf::Vector2i &p) const {
+    const int x = std::clamp(p.x / cell_size, 0, cols - 1);
+    const int y = std::clamp(p.y / cell_size, 0, rows - 1);
+    return x + y * cols;
+}
+
+void SnakeGame::InterestGrid::add_head(Network::ClientID id,
+                                       const sf::Vector2i &p) {
+    heads[bucket(p)].push_back({id, p});
+}
+
+void SnakeGame::InterestGrid::add_food(const sf::Vector2i &p) {
+    food[bucket(p)].push_back(p);
+}
+
+// Only the buckets overlapping the square of side 2 * radius around p are
+// looked at, what is in them is then tested against the square itself.
+void SnakeGame::InterestGrid::query(const sf::Vector2i &p, int radius,
+                                    std::vector<Network::ClientID> &ids,
+                                    std::vector<sf::Vector2i> &cells) const {
+    const int bx = std::clamp(p.x / cell_size, 0, cols - 1);
+    const int by = std::clamp(p.y / cell_size, 0, rows - 1);
+    const int span = (radius + cell_size - 1) / cell_size;
+    for (int y = std::max(by - span, 0); y <= std::min(by + span, rows - 1);
+         ++y) {
+        for (int x = std::max(bx - span, 0);
+             x <= std::min(bx + span, cols - 1); ++x) {
+            const int i = x + y * cols;
+            auto near = [&p, radius](const sf::Vector2i &q) {
+                return std::abs(q.x - p.x) <= radius &&
+                       std::abs(q.y - p.y) <= radius;
+            };
+            for (auto &[id, head] : heads[i]) {
+                if (near(head))
+                    ids.push_back(id);
+            }
+            for (auto &f : food[i]) {
+                if (near(f))
+                    cells.push_back(f);
+            }
+        }
+    }
+}
+
+// Hands the host's messages over to game_tick, except for the lobby's.
+bool SnakeGame::GuestLobby::receive() {
+    PROFILE_ZONE("GuestLobby::receive");
+    using namespace SnakeNetwork;
+    auto &recv_buffer = game.recv_buffer;
+    if (!network.recv(recv_buffer, 0))
+        return false;
+
+    Message msg;
+    u32 start = recv_buffer.start_index;
+    while (decode(recv_buffer, msg)) {
+        network.metrics.count_received(msg.body.index(),
+                                       recv_buffer.start_index - start);
+        start = recv_buffer.start_index;
+        if (auto m = std::get_if<HeartBeat>(&msg.body)) {
+            if (m->echo != 0) {
+                network.metrics.rtt_sample(0,
+                                           network.metrics.now_ms() - m->echo);
+            }
+            host_time = m->time;
+        } else if (auto m = std::get_if<JoinResponse>(&msg.body)) {
+            printf("Received JoinResponse\n");
+            add_player(m->id);
+            local_id = m->id;
+            network.set_compression(0, m->compression);
+        } else if (auto m = std::get_if<NewPlayer>(&msg.body)) {
+            printf("Received NewPlayer\n");
+            auto p = add_player(m->id);
+            p->ready = m->ready;
+        } else if (auto m = std::get_if<ServerSetReady>(&msg.body)) {
+            printf("Received ServerSetReady (v=%d id=%d)\n", m->ready, m->id);
+            auto &p = players.at(m->id);
+            p.ready = m->ready;
+        } else if (auto m = std::get_if<PlayerLeft>(&msg.body);
+                   m && !game_running) {
+            players.erase(m->id);
+        } else if (auto m = std::get_if<SetPlayerInfo>(&msg.body)) {
+            auto &p = players.at(m->id);
+            p.spawnX = m->spawnX;
+            p.spawnY = m->spawnY;
+            p.spawn_dir = m->spawn_dir;
+            p.color = m->color;
+            p.ready = m->ready;
+        } else if (std::holds_alternative<StartGame>(msg.body)) {
+            game_running = true;
+            Allocs::settle();
+        } else {
+            msgs.push_back(std::move(msg));
+        }
+    }
+    return true;
 }
 
 void SnakeGame::GuestLobby::game_tick(Input &input, float dt) {
+    PROFILE_ZONE("GuestLobby::game_tick");
     using namespace SnakeNetwork;
     Message msg;
     for (auto &ev : input.events) {
-        auto &player = players.at(local_id);
         if (auto e = std::get_if<Input::KeyPressed>(&ev)) {
-            msg.body = PlayerInput{e->key, true};
-            send_buffer.write(msg);
+            const u32 seq = prediction.next_seq++;
+            prediction.pending.push_back({e->key, e->time, seq});
+            msg.body = PlayerInput{e->key, true, seq};
+            send(msg);
         } else if (auto e = std::get_if<Input::KeyReleased>(&ev)) {
             msg.body = PlayerInput{e->key, false};
-            send_buffer.write(msg);
+            send(msg);
         }
     }
 
-    if (send_buffer.empty()) {
-        msg.body.emplace<HeartBeat>();
-        send_buffer.write(msg);
-    }
-
-    while (!msgs.empty()) {
-        Message msg(msgs.front());
-        msgs.pop_front();
-        if (auto m = std::get_if<MovePlayer>(&msg.body)) {
-            auto &player = players.at(m->id);
-            player.dir = m->dir;
-            for (int i = player.body.size() - 1; i > 0; --i) {
-                player.body[i].x = player.body[i - 1].x;
-                player.body[i].y = player.body[i - 1].y;
-            }
-
-            switch (player.dir) {
-            case Direction::Down:
-                player.body[0].y++;
-                break;
-            case Direction::Up:
-                player.body[0].y--;
-                break;
-            case Direction::Left:
-                player.body[0].x--;
-                break;
-            case Direction::Right:
-                player.body[0].x++;
-                break;
-            }
+    for (auto &msg : msgs) {
+        if (std::holds_alternative<TickUpdate>(msg.body) ||
+            std::holds_alternative<WorldSnapshot>(msg.body) ||
+            std::holds_alternative<InputAck>(msg.body) ||
+            std::holds_alternative<PlayerLeft>(msg.body)) {
+            queue_host_state(msg);
+        } else if (auto m = std::get_if<MovePlayer>(&msg.body)) {
+            move_player(players.at(m->id), m->dir);
         } else if (auto m = std::get_if<SpawnPlayer>(&msg.body)) {
             // printf("Received SpawnPlayer %u\n", m->id);
             auto &p = players.at(m->id);
@@ -934,6 +1376,23 @@ void SnakeGame::GuestLobby::game_tick(Input &input, float dt) {
             grow_player(p);
         }
     }
+    msgs.clear();
+
+    if (playout(dt)) {
+        reconcile();
+    }
+
+    // the local snake moves on our own clock, as far as MAX_PREDICTED_MOVES
+    // ahead of the host
+    if (auto it = players.find(local_id);
+        it != players.end() && !prediction.body.empty()) {
+        auto &p = prediction;
+        if (p.moveCounter++ >= it->second.moveDelay() &&
+            p.moves - acked_moves < MAX_PREDICTED_MOVES) {
+            predict_move(p);
+            p.moveCounter = 0;
+        }
+    }
 
     //    for (auto &[id, player] : s.players) {
     //        int div = player.boost ? 0 : 1;
@@ -1026,8 +1485,16 @@ void SnakeGame::GuestLobby::game_tick(Input &input, float dt) {
     //            s.foodRegrowCount++;
     //        }
     //    }
+}
 
+// Kept out of game_tick, so tools can play the guest side without a window.
+void SnakeGame::GuestLobby::draw() {
+    PROFILE_ZONE("GuestLobby::draw");
 	ui::label(5, 5, "food: %3d", game.food.size());
+    ui::label(5, 40, "delay %3.0f ms  jitter %4.1f ms  under %llu  late %llu",
+              jitter.delay_ms, jitter.jitter_ms,
+              static_cast<unsigned long long>(jitter.underruns),
+              static_cast<unsigned long long>(jitter.late));
     for (auto f : game.food) {
         game.food_shape.setPosition(f->p.x * game.gridSize,
                                     f->p.y * game.gridSize);
@@ -1035,12 +1502,29 @@ void SnakeGame::GuestLobby::game_tick(Input &input, float dt) {
     }
 
     for (auto &[id, player] : players) {
-        int n = 0;
-        for (auto [x, y] : player.body) {
+        const bool predicted = id == local_id && !prediction.body.empty();
+        auto &body = predicted ? prediction.body : player.body();
+
+        // remote snakes slide from their previous cells over one move
+        float alpha = 1.0f;
+        if (!predicted && !player.prev_body.empty()) {
+            alpha = static_cast<float>(jitter.clock - player.moved_tick + 1) /
+                    (player.moveDelay() + 1);
+            alpha = std::clamp(alpha, 0.0f, 1.0f);
+        }
 
-            game.body_shape.setPosition(x * game.gridSize, y * game.gridSize);
+        size_t n = 0;
+        for (auto [x, y] : body) {
+            float fx = x;
+            float fy = y;
+            if (alpha < 1.0f && n < player.prev_body.size()) {
+                fx += (player.prev_body[n].x - x) * (1.0f - alpha);
+                fy += (player.prev_body[n].y - y) * (1.0f - alpha);
+            }
+
+            game.body_shape.setPosition(fx * game.gridSize, fy * game.gridSize);
             auto color = player.color;
-            color.a = 255 - n * 64 / player.body.size();
+            color.a = 255 - n * 64 / body.size();
             game.body_shape.setFillColor(color);
             if (id == local_id) {
                 game.body_shape.setOutlineColor({255, 255, 255, 255});
@@ -1101,6 +1585,329 @@ void SnakeGame::GuestLobby::game_tick(Input &input, float dt) {
     //    }
 }
 
+void SnakeGame::GuestLobby::move_player(Player &player, Direction dir) {
+    player.prev_body = player.body();
+    player.moved_tick = tick;
+    player.dir() = dir;
+    advance(player.body(), dir);
+}
+
+void SnakeGame::GuestLobby::advance(std::vector<sf::Vector2i> &body,
+                                    Direction dir) {
+    if (body.empty())
+        return;
+
+    for (int i = body.size() - 1; i > 0; --i) {
+        body[i].x = body[i - 1].x;
+        body[i].y = body[i - 1].y;
+    }
+
+    switch (dir) {
+    case Direction::Down:
+        body[0].y++;
+        break;
+    case Direction::Up:
+        body[0].y--;
+        break;
+    case Direction::Left:
+        body[0].x--;
+        break;
+    case Direction::Right:
+        body[0].x++;
+        break;
+    }
+}
+
+// One move the way the host makes it: the next key press not used yet
+// turns the snake, then it advances.
+// Uses the presses as the host will, so it predicts the same turns.
+void SnakeGame::GuestLobby::predict_move(Prediction &p) {
+    const auto first = p.pending.begin() + p.applied;
+    const auto from = p.dir;
+    const auto used = resolve_turn(p.dir, first, p.pending.end());
+    // replays after a reconcile use presses that were measured already
+    const auto fresh = std::find_if(first, used, [&p](auto &k) {
+        return k.seq > p.measured_seq;
+    });
+    game.input_latency.used(fresh, used, p.dir != from);
+    if (fresh != used) {
+        p.measured_seq = std::prev(used)->seq;
+    }
+    p.applied = used - p.pending.begin();
+
+    advance(p.body, p.dir);
+    p.moves++;
+}
+
+// Rewinds the local snake to the host's state and replays the moves we
+// predicted past it, using the key presses the host has not applied yet.
+void SnakeGame::GuestLobby::reconcile() {
+    auto it = players.find(local_id);
+    if (it == players.end() || it->second.body().empty())
+        return;
+
+    auto &p = prediction;
+    while (!p.pending.empty() && p.pending.front().seq <= acked_input) {
+        p.pending.pop_front();
+    }
+
+    const u32 lead =
+        p.moves > acked_moves
+            ? std::min(p.moves - acked_moves, MAX_PREDICTED_MOVES)
+            : 0;
+
+    p.body = it->second.body();
+    p.dir = it->second.dir();
+    p.moves = acked_moves;
+    p.applied = 0;
+    for (u32 i = 0; i < lead; ++i) {
+        predict_move(p);
+    }
+}
+
+// Same order as HostLobby::game_tick: moves, growth, food, respawns.
+void SnakeGame::GuestLobby::apply_tick(const SnakeNetwork::TickUpdate &update) {
+    // queued before a snapshot that came later but is for a later tick
+    if (update.tick <= snapshot_tick)
+        return;
+    const auto slots = player_slots(players);
+    if (slots.size() != update.slot_count) {
+        rejected_ticks++;
+        add_message("Tick %u is for %u players, we have %u", update.tick,
+                    update.slot_count, static_cast<u32>(slots.size()));
+        return;
+    }
+    tick = update.tick;
+
+    auto &c = update.changes;
+    for (auto &move : c.moves) {
+        move_player(players.at(slots[move.slot]), move.dir);
+    }
+    for (auto slot : c.grown) {
+        grow_player(players.at(slots[slot]));
+    }
+    for (auto &p : c.food_removed) {
+        remove_food(p.x, p.y);
+    }
+    for (auto &p : c.food_added) {
+        add_food(p.x, p.y);
+    }
+    for (auto slot : c.spawned) {
+        spawn(players.at(slots[slot]));
+    }
+}
+
+// Replaces whatever the tick updates built up with the host's state, so a
+// missed or misapplied update only lasts until the next snapshot.
+void SnakeGame::GuestLobby::apply_snapshot(
+    const SnakeNetwork::WorldSnapshot &snapshot) {
+    if (snapshot.tick <= snapshot_tick)
+        return;
+    const WorldState *base = nullptr;
+    if (snapshot.base_tick != 0) {
+        auto it = std::find_if(
+            snapshots.begin(), snapshots.end(),
+            [&snapshot](auto &s) { return s.tick == snapshot.base_tick; });
+        if (it == snapshots.end()) {
+            add_message("Snapshot %u: missing base %u", snapshot.tick,
+                        snapshot.base_tick);
+            return;
+        }
+        base = &*it;
+    }
+
+    WorldState state;
+    if (!SnakeNetwork::apply_snapshot(base, snapshot, state)) {
+        add_message("Snapshot %u does not apply to %u", snapshot.tick,
+                    snapshot.base_tick);
+        return;
+    }
+
+    // a snake the snapshot leaves out is outside our interest radius
+    for (auto &[id, player] : players) {
+        auto p = std::lower_bound(
+            state.players.begin(), state.players.end(), id,
+            [](auto &s, Network::ClientID id) { return s.id < id; });
+        if (p == state.players.end() || p->id != id) {
+            player.body().clear();
+            player.prev_body.clear();
+            continue;
+        }
+
+        player.dir() = p->dir;
+        if (player.body() != p->body) {
+            // a one cell step slides like a move, anything else snaps
+            const bool step =
+                !player.body().empty() && !p->body.empty() &&
+                std::abs(player.body()[0].x - p->body[0].x) +
+                        std::abs(player.body()[0].y - p->body[0].y) <=
+                    1;
+            if (step) {
+                player.prev_body = std::move(player.body());
+                player.moved_tick = state.tick;
+            } else {
+                player.prev_body.clear();
+            }
+            player.body() = p->body;
+        }
+    }
+
+    std::vector<sf::Vector2i> stale;
+    for (auto f : game.food) {
+        if (!std::binary_search(state.food.begin(), state.food.end(), f->p,
+                                cell_less)) {
+            stale.push_back(f->p);
+        }
+    }
+    for (auto &p : stale) {
+        remove_food(p.x, p.y);
+    }
+    for (auto &p : state.food) {
+        add_food(p.x, p.y);
+    }
+
+    tick = state.tick;
+    snapshot_tick = state.tick;
+    snapshots.push_back(std::move(state));
+    if (snapshots.size() > SNAPSHOT_HISTORY) {
+        snapshots.pop_front();
+    }
+
+    SnakeNetwork::Message msg;
+    msg.body = SnakeNetwork::SnapshotAck{tick};
+    send(msg);
+}
+
+void SnakeGame::GuestLobby::send(SnakeNetwork::Message &msg) {
+    const auto size = send_buffer.bytes.size();
+    SnakeNetwork::encode(send_buffer, msg);
+    network.metrics.count_sent(msg.body.index(),
+                               send_buffer.bytes.size() - size);
+}
+
+// Host state is played in tick order. An InputAck has no tick of its own,
+// it belongs to the tick update it followed. A PlayerLeft comes before the
+// next one, the ticks still buffered were made with the player in them.
+// What a snapshot already applied covers is dropped, tick updates that a
+// snapshot overtook would otherwise be played on top of it.
+void SnakeGame::GuestLobby::queue_host_state(SnakeNetwork::Message &msg) {
+    using namespace SnakeNetwork;
+    u32 key = jitter.latest_tick;
+    if (auto m = std::get_if<TickUpdate>(&msg.body)) {
+        if (m->tick <= snapshot_tick)
+            return;
+        key = m->tick;
+        jitter.arrived(m->tick);
+    } else if (auto m = std::get_if<WorldSnapshot>(&msg.body)) {
+        if (m->tick <= snapshot_tick)
+            return;
+        key = m->tick;
+        // with interest management snapshots are all there is
+        if (m->tick > jitter.latest_tick)
+            jitter.arrived(m->tick);
+    } else if (std::holds_alternative<PlayerLeft>(msg.body)) {
+        key = jitter.latest_tick + 1;
+    }
+    jitter.pending[key].push_back(std::move(msg));
+}
+
+// Applies everything up to the playout clock, returns true if the host
+// state changed.
+bool SnakeGame::GuestLobby::playout(float dt) {
+    using namespace SnakeNetwork;
+    jitter.advance(dt);
+
+    bool played = false;
+    while (!jitter.pending.empty() &&
+           jitter.pending.begin()->first <= jitter.clock) {
+        for (auto &msg : jitter.pending.begin()->second) {
+            if (auto m = std::get_if<TickUpdate>(&msg.body)) {
+                apply_tick(*m);
+            } else if (auto m = std::get_if<WorldSnapshot>(&msg.body)) {
+                apply_snapshot(*m);
+            } else if (auto m = std::get_if<InputAck>(&msg.body)) {
+                acked_input = m->seq;
+                acked_moves = m->moves;
+            } else if (auto m = std::get_if<PlayerLeft>(&msg.body)) {
+                players.erase(m->id);
+            }
+        }
+        jitter.pending.erase(jitter.pending.begin());
+        played = true;
+    }
+    return played;
+}
+
+// Interarrival jitter as in RFC 3550, measured against the host tick
+// interval which is itself estimated from the arrivals.
+void SnakeGame::GuestLobby::JitterBuffer::arrived(u32 tick) {
+    const auto now = Network::Clock::now();
+    if (!has_arrival) {
+        epoch = now;
+    }
+    const float ms =
+        std::chrono::duration<float, std::milli>(now - epoch).count();
+
+    if (has_arrival && tick > last_arrival_tick) {
+        const float elapsed = ms - last_arrival_ms;
+        const u32 ticks = tick - last_arrival_tick;
+        const float d = elapsed - ticks * interval_ms;
+        jitter_ms += (std::abs(d) - jitter_ms) / 16.0f;
+        interval_ms += (elapsed / ticks - interval_ms) * 0.05f;
+    }
+
+    if (started && tick < clock) {
+        late++;
+    }
+
+    last_arrival_ms = ms;
+    last_arrival_tick = tick;
+    has_arrival = true;
+    latest_tick = std::max(latest_tick, tick);
+}
+
+// Runs the clock at the host's pace and eases it towards delay behind the
+// newest tick, so a changing delay never makes it jump.
+void SnakeGame::GuestLobby::JitterBuffer::advance(float dt) {
+    if (!has_arrival)
+        return;
+
+    delay_ms =
+        std::clamp(jitter_ms * jitter_factor, min_delay_ms, max_delay_ms);
+    const double target = latest_tick - delay_ms / interval_ms;
+
+    if (!started) {
+        clock = target;
+        started = true;
+    }
+
+    clock += dt * 1000.0 / interval_ms;
+    clock += (target - clock) * 0.1;
+
+    if (clock > latest_tick) {
+        if (!starved) {
+            underruns++;
+        }
+        starved = true;
+        clock = latest_tick;
+    } else {
+        starved = false;
+    }
+}
+
+void SnakeGame::GuestLobby::JitterBuffer::from_env() {
+    if (auto v = std::getenv("SNEK_PLAYOUT_MIN_DELAY")) {
+        min_delay_ms = std::max(std::strtof(v, nullptr), 0.0f);
+    }
+    if (auto v = std::getenv("SNEK_PLAYOUT_MAX_DELAY")) {
+        max_delay_ms = std::max(std::strtof(v, nullptr), 0.0f);
+    }
+    if (auto v = std::getenv("SNEK_PLAYOUT_JITTER_FACTOR")) {
+        jitter_factor = std::max(std::strtof(v, nullptr), 0.0f);
+    }
+    max_delay_ms = std::max(max_delay_ms, min_delay_ms);
+}
+
 void SnakeGame::GuestLobby::add_food(int x, int y) {
     if (game.world_map(x, y).food == nullptr) {
         auto f = new Food{x, y};
@@ -1123,8 +1930,8 @@ void SnakeGame::GuestLobby::remove_food(int x, int y) {
 
 void SnakeGame::GuestLobby::grow_player(SnakeGame::Player &player) {
     for (int i = 0; i < game.foodGrowth; ++i) {
-        if (player.body.size() < 50) {
-            player.body.push_back(player.body.back());
+        if (player.body().size() < 50) {
+            player.body().push_back(player.body().back());
         }
     }
 }
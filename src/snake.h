@@ -1,10 +1,15 @@
 #pragma once
 #include "engine.h"
+#include "input_latency.h"
 #include "network.h"
+#include "timing_wheel.h"
 #include "stable_win32.hpp"
 
 namespace SnakeNetwork {
 struct Message;
+struct TickUpdate;
+struct WorldSnapshot;
+struct InputAck;
 }
 
 struct SnakeGame {
@@ -32,17 +37,82 @@ struct SnakeGame {
     static constexpr Direction next_left[4] = {
         Direction::Left, Direction::Up, Direction::Right, Direction::Down};
 
-    struct Player {
-        sf::Color color;
-        std::vector<sf::Vector2i> body;
+    // A key press waiting for a move. time is when the window handed it
+    // over, none for a guest's on the host, seq numbers a guest's own.
+    struct KeyPress {
+        sf::Keyboard::Key key;
+        Input::Clock::time_point time;
+        u32 seq = 0;
+    };
+
+    static std::optional<Direction> key_direction(sf::Keyboard::Key key);
+
+    // What a move makes of the presses [first, last) waiting for it: it
+    // turns dir on the first one that turns the snake and uses up those
+    // before it, which would not (other keys, the way it already goes and
+    // the opposite way). One turn a move, so a burst of turns still plays
+    // out move by move. Returns past the presses used.
+    template <typename It>
+    static It resolve_turn(Direction &dir, It first, It last) {
+        const auto back =
+            static_cast<Direction>((static_cast<int>(dir) + 2) % 4);
+        while (first != last) {
+            const auto d = key_direction(first++->key);
+            if (d && *d != dir && *d != back) {
+                dir = *d;
+                break;
+            }
+        }
+        return first;
+    }
+
+    struct SnakeState {
+        Network::ClientID id;
         Direction dir;
-        std::list<sf::Keyboard::Key> input_buffer;
-        bool use_ai = false;
+        std::vector<sf::Vector2i> body;
+    };
+
+    // What the host snapshots every SNAPSHOT_INTERVAL ticks, or every tick
+    // with interest management. Players sorted by id and food by cell.
+    struct WorldState {
+        u32 tick = 0;
+        std::vector<SnakeState> players;
+        std::vector<sf::Vector2i> food;
+    };
+
+    class PlayerList;
+
+    // What every tick reads and writes for every player, kept by the
+    // PlayerList in arrays of its own.
+    struct Motion {
+        Direction dir = Direction::Up;
         bool boost = false;
         bool dead = false;
-
         int moveDelay = 2;
         int moveCounter = 0;
+    };
+
+    // The rest of a player, touched when something happens to it. The hot
+    // state is reached through the list it lives in.
+    struct Player {
+        PlayerList *list = nullptr;
+        // position in the list's arrays
+        u32 index = 0;
+
+        Direction &dir();
+        Direction dir() const;
+        bool &boost();
+        bool boost() const;
+        bool &dead();
+        bool dead() const;
+        int &moveDelay();
+        int &moveCounter();
+        std::vector<sf::Vector2i> &body();
+        const std::vector<sf::Vector2i> &body() const;
+
+        sf::Color color;
+        std::deque<KeyPress> input_buffer;
+        bool use_ai = false;
 
         u32 spawnX;
         u32 spawnY;
@@ -50,22 +120,256 @@ struct SnakeGame {
 
         Network::ClientID id;
         std::vector<Network::ClientID> known_ids;
+        u32 acked_snapshot = 0;
+
+        // host side: the last key press received, moves made and what the
+        // guest was last told about both
+        u32 input_seq = 0;
+        u32 moves = 0;
+        u32 acked_input = 0;
+        u32 acked_moves = 0;
+
+        // host side with interest management: what this guest was sent
+        std::deque<WorldState> interest_snapshots;
+
+        // guest side: the body before the last move and the tick of that
+        // move, remote snakes are drawn in between
+        std::vector<sf::Vector2i> prev_body;
+        u32 moved_tick = 0;
 
         bool ready = false;
 
         u32 initialSize = 3;
 
         Network::Buffer send_buffer;
-
-        // Player(const Player &) = delete;
+        // what the host sends this frame, send_buffer interleaved with
+        // the shared broadcasts
+        Network::Frame frame;
+        // snapshots, sent on the unreliable channel
+        Network::Frame state_frame;
+
+        // moved when PlayerList fills a hole, never copied
+        Player() = default;
+        Player(Player &&) = default;
+        Player &operator=(Player &&) = default;
         void operator=(const Player &) = delete;
     };
 
     struct MainMenu {};
 
-    using PlayerList = std::unordered_map<Network::ClientID, Player>;
+    // Players by id, with the interface of the map they used to live in.
+    // They are stored back to back in a SlotMap and found through a hash
+    // table of handles. Ids do not index a table directly: a guest reads
+    // them off the wire, and a server hands out a new one per connection
+    // for as long as it runs. The hot state sits in arrays parallel to the
+    // SlotMap's, which loops over every player can go through by position.
+    // Iteration follows storage, and emplace and erase invalidate
+    // references.
+    class PlayerList {
+    public:
+        using value_type = std::pair<Network::ClientID, Player>;
+        using iterator = value_type *;
+        using const_iterator = const value_type *;
+
+        PlayerList() = default;
+        // players point back at their list
+        PlayerList(const PlayerList &) = delete;
+        void operator=(const PlayerList &) = delete;
+
+        iterator begin() { return players.begin(); }
+        iterator end() { return players.end(); }
+        const_iterator begin() const { return players.begin(); }
+        const_iterator end() const { return players.end(); }
+        size_t size() const { return players.size(); }
+        bool empty() const { return players.empty(); }
+
+        iterator find(Network::ClientID id) {
+            auto p = by_id.empty() ? nullptr
+                                   : players.get(by_id[slot_of(id)].handle);
+            return p ? p : end();
+        }
+        const_iterator find(Network::ClientID id) const {
+            auto p = by_id.empty() ? nullptr
+                                   : players.get(by_id[slot_of(id)].handle);
+            return p ? p : end();
+        }
+        size_t count(Network::ClientID id) const { return find(id) != end(); }
+
+        Player &at(Network::ClientID id) {
+            auto it = find(id);
+            if (it == end())
+                throw std::out_of_range("no such player");
+            return it->second;
+        }
+
+        std::pair<iterator, bool> emplace(Network::ClientID id,
+                                          Player player) {
+            if (auto it = find(id); it != end())
+                return {it, false};
+            if (2 * (players.size() + 1) > by_id.size())
+                rehash(std::max<size_t>(16, 2 * by_id.size()));
+            const auto handle = players.emplace(id, std::move(player));
+            by_id[slot_of(id)] = {id, handle};
+            motions.emplace_back();
+            bodies.emplace_back();
+
+            auto it = players.get(handle);
+            it->second.list = this;
+            it->second.index = static_cast<u32>(players.size() - 1);
+            return {it, true};
+        }
+
+        size_t erase(Network::ClientID id) {
+            auto it = find(id);
+            if (it == end())
+                return 0;
+            erase(it);
+            return 1;
+        }
+
+        // Returns the player moved into its place, or end.
+        iterator erase(iterator it) {
+            const auto i = it->second.index;
+            unmap(it->first);
+
+            it = players.erase(it);
+            motions[i] = motions.back();
+            motions.pop_back();
+            bodies[i] = std::move(bodies.back());
+            bodies.pop_back();
+            if (it != end())
+                it->second.index = i;
+            return it;
+        }
+
+        void clear() {
+            players.clear();
+            by_id.assign(by_id.size(), {});
+            motions.clear();
+            bodies.clear();
+        }
+
+        // The hot state of the player at position i of the iteration.
+        Motion &motion(size_t i) { return motions[i]; }
+        std::vector<sf::Vector2i> &body(size_t i) { return bodies[i]; }
+        const std::vector<sf::Vector2i> &body(size_t i) const {
+            return bodies[i];
+        }
+        // and the player itself
+        value_type &operator[](size_t i) { return begin()[i]; }
+
+    private:
+        friend struct Player;
+
+        // Open addressing with linear probing, at most half full. A slot
+        // is empty while its handle is null.
+        struct IdSlot {
+            Network::ClientID id = 0;
+            EntityID handle;
+        };
+
+        // ids are mostly handed out in order, their low bits spread well
+        size_t home(Network::ClientID id) const {
+            return id & (by_id.size() - 1);
+        }
+        size_t next(size_t slot) const {
+            return (slot + 1) & (by_id.size() - 1);
+        }
+
+        // where id is, or the empty slot it would go in
+        size_t slot_of(Network::ClientID id) const {
+            auto slot = home(id);
+            while (by_id[slot].handle.uid && by_id[slot].id != id)
+                slot = next(slot);
+            return slot;
+        }
+
+        void rehash(size_t size) {
+            auto old = std::move(by_id);
+            by_id.assign(size, {});
+            for (auto &s : old) {
+                if (s.handle.uid)
+                    by_id[slot_of(s.id)] = s;
+            }
+        }
+
+        // Empties the slot of id and moves back the ones probed past it,
+        // which leaves no holes that would stop a probe early.
+        void unmap(Network::ClientID id) {
+            auto hole = slot_of(id);
+            by_id[hole] = {};
+            const auto mask = by_id.size() - 1;
+            for (auto s = next(hole); by_id[s].handle.uid; s = next(s)) {
+                const auto from_home = (s - home(by_id[s].id)) & mask;
+                if (from_home >= ((s - hole) & mask)) {
+                    by_id[hole] = by_id[s];
+                    by_id[s] = {};
+                    hole = s;
+                }
+            }
+        }
+
+        SlotMap<value_type> players;
+        std::vector<IdSlot> by_id;
+        std::vector<Motion> motions;
+        std::vector<std::vector<sf::Vector2i>> bodies;
+    };
+
     using WorldMap = Array2D<Cell>;
 
+    // Everything that changed during one tick. Players are referred to by
+    // slot, their rank in the player list sorted by id. Food removals are
+    // applied before additions.
+    struct TickChanges {
+        struct Move {
+            u32 slot;
+            Direction dir;
+        };
+
+        std::vector<Move> moves;
+        std::vector<u32> grown;
+        std::vector<u32> spawned;
+        std::vector<sf::Vector2i> food_removed;
+        std::vector<sf::Vector2i> food_added;
+
+        bool empty() const {
+            return moves.empty() && grown.empty() && spawned.empty() &&
+                   food_removed.empty() && food_added.empty();
+        }
+    };
+
+    static std::vector<Network::ClientID>
+    player_slots(const PlayerList &players);
+
+    static bool cell_less(const sf::Vector2i &a, const sf::Vector2i &b) {
+        return a.y != b.y ? a.y < b.y : a.x < b.x;
+    }
+
+    static constexpr u32 SNAPSHOT_INTERVAL = 20;
+    static constexpr size_t SNAPSHOT_HISTORY = 32;
+
+    // Buckets heads and food by the cell of a coarse grid, finding what is
+    // near a point then only looks at the buckets around it.
+    struct InterestGrid {
+        int cell_size = 1;
+        int cols = 0;
+        int rows = 0;
+        std::vector<std::vector<std::pair<Network::ClientID, sf::Vector2i>>>
+            heads;
+        std::vector<std::vector<sf::Vector2i>> food;
+
+        void reset(int map_cols, int map_rows, int cell);
+        void add_head(Network::ClientID id, const sf::Vector2i &p);
+        void add_food(const sf::Vector2i &p);
+        // appends everything within radius of p, in both axes
+        void query(const sf::Vector2i &p, int radius,
+                   std::vector<Network::ClientID> &ids,
+                   std::vector<sf::Vector2i> &cells) const;
+
+    private:
+        int bucket(const sf::Vector2i &p) const;
+    };
+
     std::vector<Food *> food;
     int foodRegrow = 20;
     int foodRegrowCount = 0;
@@ -92,30 +396,65 @@ struct SnakeGame {
         bool paused = false;
         SnakeGame &game;
 
-        Direction set_dir(Player &player, Direction d);
         void game_tick(Input &input, float dt);
     };
 
     struct HostLobby {
         HostLobby(SnakeGame &game);
+        // A room of a dedicated server, without a local player.
+        HostLobby(SnakeGame &game, net::io_context &ctx, u16 port);
         Network network;
         SnakeGame &game;
 
         Player *add_player(Network::ClientID id);
-        std::unordered_map<Network::ClientID, Player> players;
+        PlayerList players;
 
         const Network::ClientID local_id = 0;
         Network::ClientID unique_player_id = 1;
 
+        u32 tick = 0;
+        std::vector<Network::ClientID> slot_ids;
+        TickChanges tick_changes;
+        std::deque<WorldState> snapshots;
+        // encoded once, shared by the frames of every guest
+        Network::Buffer broadcast;
+
+        // With a radius, guests only get what is around their own head:
+        // a snapshot of that every tick instead of the tick updates.
+        u32 interest_radius = 0;
+        InterestGrid interest;
+
+        // in game ticks, run after the moves of each tick
+        TimingWheel timers;
+
         void recompute_spawn_points();
         void spawn(Player &player);
         void decompose(Player &player);
+        u32 guest_count() const;
         void send_all(SnakeNetwork::Message &msg);
+        void send_to(Player &player, SnakeNetwork::Message &msg);
+        void share_broadcast();
         void add_food(int x, int y);
+        void remove_food(Food *f);
         void grow_player(Player &player);
-
+        void schedule_food();
+        u32 slot(Network::ClientID id);
+
+        // one frame: begin_frame, receive, game_tick, end_frame
+        void begin_frame();
+        void accept_players();
+        void receive();
+        void end_frame();
+        void start_game();
+        void end_game();
+
+        void begin_tick();
+        void end_tick();
+        WorldState world_state();
+        void send_snapshots();
+        void send_interest_snapshots(const WorldState &world);
         void game_tick(Input &input, float dt);
-        Direction set_dir(Player &player, Direction d);
+        void draw();
 
         bool game_running = false;
     };
@@ -126,20 +465,105 @@ struct SnakeGame {
         SnakeGame &game;
 
         Player *add_player(Network::ClientID id);
-        std::unordered_map<Network::ClientID, Player> players;
-        std::list<SnakeNetwork::Message> msgs;
+        PlayerList players;
+        // for game_tick, which may only come frames later
+        std::vector<SnakeNetwork::Message> msgs;
 
         Network::ClientID local_id = 0;
         bool game_running = false;
         Network::Buffer send_buffer;
-
+        // the host's last heartbeat stamp, echoed by the next heartbeat
+        u32 host_time = 0;
+        u32 tick = 0;
+        std::deque<WorldState> snapshots;
+        // The tick of the last snapshot applied. Snapshots go unreliable and
+        // can overtake the tick updates before them, which it already holds.
+        u32 snapshot_tick = 0;
+        // tick updates that did not fit the players we have
+        u64 rejected_ticks = 0;
+
+        // The local snake, simulated ahead of the host from our own key
+        // presses. Whenever the host's state changes it is rebuilt from
+        // that state by replaying the moves the host has not made yet.
+        struct Prediction {
+            std::vector<sf::Vector2i> body;
+            Direction dir = Direction::Up;
+            int moveCounter = 0;
+            u32 moves = 0;
+            u32 next_seq = 1;
+            // key presses the host has not applied, the first applied of
+            // them were already used by the predicted moves
+            std::deque<KeyPress> pending;
+            size_t applied = 0;
+            // the last press whose latency was taken, replays skip it
+            u32 measured_seq = 0;
+        };
+        static constexpr u32 MAX_PREDICTED_MOVES = 8;
+
+        Prediction prediction;
+        u32 acked_input = 0;
+        u32 acked_moves = 0;
+
+        // Host state waits here and is played at the host's pace, delay
+        // behind the newest tick received. The delay follows the measured
+        // jitter times jitter_factor, within [min_delay_ms, max_delay_ms].
+        struct JitterBuffer {
+            float min_delay_ms = 20.0f;
+            float max_delay_ms = 250.0f;
+            float jitter_factor = 3.0f;
+
+            std::map<u32, std::list<SnakeNetwork::Message>> pending;
+            u32 latest_tick = 0;
+            // the host tick being played, fractional between two ticks
+            double clock = 0.0;
+            bool started = false;
+            bool starved = false;
+
+            float delay_ms = 0.0f;
+            float interval_ms = 1000.0f / 60.0f;
+            float jitter_ms = 0.0f;
+            Network::Clock::time_point epoch;
+            float last_arrival_ms = 0.0f;
+            u32 last_arrival_tick = 0;
+            bool has_arrival = false;
+
+            // the clock caught up with the newest tick / a tick arrived
+            // after its playout time
+            u64 underruns = 0;
+            u64 late = 0;
+
+            void arrived(u32 tick);
+            void advance(float dt);
+            // SNEK_PLAYOUT_MIN_DELAY and SNEK_PLAYOUT_MAX_DELAY in ms,
+            // SNEK_PLAYOUT_JITTER_FACTOR
+            void from_env();
+        };
+
+        JitterBuffer jitter;
+
+        void send(SnakeNetwork::Message &msg);
         void spawn(Player &player);
+        void move_player(Player &player, Direction dir);
+        static void advance(std::vector<sf::Vector2i> &body, Direction dir);
+        void predict_move(Prediction &p);
+        void reconcile();
+        void queue_host_state(SnakeNetwork::Message &msg);
+        bool playout(float dt);
+        void apply_tick(const SnakeNetwork::TickUpdate &update);
+        void apply_snapshot(const SnakeNetwork::WorldSnapshot &snapshot);
+        // false once the connection to the host is gone
+        bool receive();
         void game_tick(Input &input, float dt);
+        void draw();
         void add_food(int x, int y);
         void remove_food(int x, int y);
         void grow_player(Player &player);
     };
 
+    // Scratch for one frame, reset by whoever runs the frames. Declared
+    // before state so it outlives the lobbies.
+    Arena frame_arena;
+
     using GameState =
         std::variant<MainMenu, SinglePlayer, HostLobby, GuestLobby>;
     GameState state;
@@ -147,6 +571,15 @@ struct SnakeGame {
     u32 gridRows = 30;
     u32 gridCols = 30;
 
+    bool use_udp = false;
+    // offered to the host when joining, or accepted from guests. Off by
+    // default: it costs the host CPU on every frame it sends
+    bool use_compression = false;
+    // F3 toggles the overlay of the latency from polling a key press to
+    // showing it, and of the network metrics in the lobbies
+    bool show_metrics = false;
+    InputLatency input_latency;
+
     Network::Buffer recv_buffer;
 
     bool on_player(const Player &p1, const Player &p2);
@@ -164,15 +597,58 @@ struct SnakeGame {
     void single_player(SinglePlayer &s, Input &input, float);
 };
 
+inline SnakeGame::Direction &SnakeGame::Player::dir() {
+    return list->motions[index].dir;
+}
+inline SnakeGame::Direction SnakeGame::Player::dir() const {
+    return list->motions[index].dir;
+}
+inline bool &SnakeGame::Player::boost() { return list->motions[index].boost; }
+inline bool SnakeGame::Player::boost() const {
+    return list->motions[index].boost;
+}
+inline bool &SnakeGame::Player::dead() { return list->motions[index].dead; }
+inline bool SnakeGame::Player::dead() const {
+    return list->motions[index].dead;
+}
+inline int &SnakeGame::Player::moveDelay() {
+    return list->motions[index].moveDelay;
+}
+inline int &SnakeGame::Player::moveCounter() {
+    return list->motions[index].moveCounter;
+}
+inline std::vector<sf::Vector2i> &SnakeGame::Player::body() {
+    return list->bodies[index];
+}
+inline const std::vector<sf::Vector2i> &SnakeGame::Player::body() const {
+    return list->bodies[index];
+}
+
 namespace SnakeNetwork {
 
-struct HeartBeat {};
+// Bump whenever the encoding of a message changes.
+static constexpr u8 PROTOCOL_VERSION = 6;
 
-struct JoinRequest {};
+// Both ends stamp their heartbeats with their own clock in ms and echo the
+// last stamp they got from the other end, 0 for none. The difference
+// between now and the echo is a round trip.
+struct HeartBeat {
+    u32 time = 0;
+    u32 echo = 0;
+};
+
+// compression: the guest can take compressed frames, and the host answers
+// whether both ends will send them.
+struct JoinRequest {
+    u8 version = PROTOCOL_VERSION;
+    bool compression = false;
+};
 
 struct JoinResponse {
-    JoinResponse(Network::ClientID id) : id(id) {}
+    JoinResponse(Network::ClientID id, bool compression = false)
+        : id(id), compression(compression) {}
     const Network::ClientID id;
+    const bool compression;
 };
 
 struct SetReady {
@@ -227,17 +703,99 @@ struct PlayerGrow {
     Network::ClientID id;
 };
 
+// Key presses are numbered from 1 so the host can tell the guest which
+// ones it has applied, releases carry 0.
 struct PlayerInput {
     sf::Keyboard::Key key;
     bool down;
+    u32 seq = 0;
+};
+
+// Replaces the per event MovePlayer, PlayerGrow, SpawnFood, DestroyFood and
+// SpawnPlayer messages while the game is running.
+struct TickUpdate {
+    u32 tick = 0;
+    u32 slot_count = 0;
+    SnakeGame::TickChanges changes;
+};
+
+// A snake's new body is head, then the first reuse cells of its body in the
+// base snapshot, then tail. A full delta carries the whole body in head.
+struct SnakeDelta {
+    Network::ClientID id;
+    SnakeGame::Direction dir;
+    bool full = false;
+    std::vector<sf::Vector2i> head;
+    u32 reuse = 0;
+    std::vector<sf::Vector2i> tail;
+};
+
+// World state encoded against the snapshot at base_tick, the latest one the
+// guest acknowledged. A base_tick of 0 means a full snapshot.
+struct WorldSnapshot {
+    u32 tick = 0;
+    u32 base_tick = 0;
+    std::vector<SnakeDelta> players;
+    std::vector<Network::ClientID> players_removed;
+    std::vector<sf::Vector2i> food_removed;
+    std::vector<sf::Vector2i> food_added;
+};
+
+struct SnapshotAck {
+    u32 tick;
+};
+
+// Sent to a guest after the tick update: the host has made moves moves with
+// the guest's snake and applied its key presses up to seq.
+struct InputAck {
+    u32 seq = 0;
+    u32 moves = 0;
 };
 
 struct Message {
 
+    // The variant index is the tag on the wire: only append new types.
     std::variant<HeartBeat, JoinRequest, JoinResponse, SetReady, ServerSetReady,
                  NewPlayer, PlayerLeft, SetPlayerInfo, StartGame, PlayerInput,
-                 SpawnPlayer, MovePlayer, SpawnFood, DestroyFood, PlayerGrow>
+                 SpawnPlayer, MovePlayer, SpawnFood, DestroyFood, PlayerGrow,
+                 TickUpdate, WorldSnapshot, SnapshotAck, InputAck>
         body;
 };
 
+template <typename T, typename... Ts>
+constexpr u8 index_of(const std::variant<Ts...> *) {
+    constexpr bool same[] = {std::is_same_v<T, Ts>...};
+    for (u8 i = 0; i < sizeof...(Ts); ++i) {
+        if (same[i])
+            return i;
+    }
+    return 0xff;
+}
+
+// The wire tag of message type T.
+template <typename T> constexpr u8 tag_of() {
+    return index_of<T>(static_cast<const decltype(Message::body) *>(nullptr));
+}
+
+// For the metrics, "?" for an unknown tag.
+const char *message_name(u8 tag);
+
+// Only players and food that differ from base end up in the snapshot, base
+// is null for a full snapshot.
+WorldSnapshot make_snapshot(const SnakeGame::WorldState *base,
+                            const SnakeGame::WorldState &state);
+
+// Rebuilds the full state from the base the snapshot was made against,
+// returns false when the snapshot does not fit base.
+bool apply_snapshot(const SnakeGame::WorldState *base,
+                    const WorldSnapshot &snapshot,
+                    SnakeGame::WorldState &state);
+
+// Encodes msg as a one byte tag followed by its varint packed fields.
+void encode(Network::Buffer &b, const Message &msg);
+
+// Decodes the next message, returns false when the buffer is exhausted or
+// holds a malformed message.
+bool decode(Network::Buffer &b, Message &msg);
+
 }; // namespace SnakeNetwork
@@ -0,0 +1,666 @@
+#include "engine.h"
+#include "snake.h"
+#include "stable_win32.hpp"
+
+namespace SnakeNetwork {
+
+namespace {
+
+// indexed by wire tag
+constexpr const char *MESSAGE_NAMES[] = {
+    "HeartBeat",
+    "JoinRequest",
+    "JoinResponse",
+    "SetReady",
+    "ServerSetReady",
+    "NewPlayer",
+    "PlayerLeft",
+    "SetPlayerInfo",
+    "StartGame",
+    "PlayerInput",
+    "SpawnPlayer",
+    "MovePlayer",
+    "SpawnFood",
+    "DestroyFood",
+    "PlayerGrow",
+    "TickUpdate",
+    "WorldSnapshot",
+    "SnapshotAck",
+    "InputAck",
+};
+static_assert(std::size(MESSAGE_NAMES) ==
+              std::variant_size_v<decltype(Message::body)>);
+
+void write_color(Network::Buffer &b, const sf::Color &color) {
+    b.write_u8(color.r);
+    b.write_u8(color.g);
+    b.write_u8(color.b);
+}
+
+bool read_color(Network::Buffer &b, sf::Color &color) {
+    return b.read_u8(color.r) && b.read_u8(color.g) && b.read_u8(color.b);
+}
+
+// An id with flags in the bits below it, in a varint wide enough to keep
+// every bit of the id.
+void write_id(Network::Buffer &b, Network::ClientID id, u32 flags,
+              u32 flag_bits) {
+    b.write_varint64(static_cast<u64>(id) << flag_bits | flags);
+}
+
+bool read_id(Network::Buffer &b, Network::ClientID &id, u32 &flags,
+             u32 flag_bits) {
+    u64 v;
+    if (!b.read_varint64(v) || v >> flag_bits > UINT32_MAX)
+        return false;
+    id = static_cast<Network::ClientID>(v >> flag_bits);
+    flags = static_cast<u32>(v & ((1u << flag_bits) - 1));
+    return true;
+}
+
+// one bit per slot, slots must be ascending and below slot_count
+template <typename T, typename F>
+void write_mask(Network::Buffer &b, const std::vector<T> &items, u32 slot_count,
+                F slot_of) {
+    const size_t start = b.bytes.size();
+    b.bytes.resize(start + (slot_count + 7) / 8, 0);
+    for (auto &item : items) {
+        const u32 slot = slot_of(item);
+        b.bytes[start + slot / 8] |= 1 << (slot % 8);
+    }
+}
+
+bool read_mask(Network::Buffer &b, u32 slot_count, std::vector<u32> &slots) {
+    for (u32 i = 0; i < slot_count; i += 8) {
+        u8 bits;
+        if (!b.read_u8(bits))
+            return false;
+        for (u32 j = 0; j < 8; ++j) {
+            if (bits & (1 << j))
+                slots.push_back(i + j);
+        }
+    }
+    return slots.empty() || slots.back() < slot_count;
+}
+
+void write_cells(Network::Buffer &b, const std::vector<sf::Vector2i> &cells) {
+    b.write_varint(cells.size());
+    for (auto &p : cells) {
+        b.write_zigzag(p.x);
+        b.write_zigzag(p.y);
+    }
+}
+
+bool read_cells(Network::Buffer &b, std::vector<sf::Vector2i> &cells) {
+    u32 n;
+    if (!b.read_varint(n))
+        return false;
+    for (u32 i = 0; i < n; ++i) {
+        sf::Vector2i p;
+        if (!b.read_zigzag(p.x) || !b.read_zigzag(p.y))
+            return false;
+        cells.push_back(p);
+    }
+    return true;
+}
+
+enum TickFlags : u8 {
+    TickMoves = 1 << 0,
+    TickGrown = 1 << 1,
+    TickSpawned = 1 << 2,
+    TickFoodRemoved = 1 << 3,
+    TickFoodAdded = 1 << 4,
+};
+
+// tick, slot count and a flag byte saying which of the sections follow:
+// moved mask then 2 bit directions packed four to a byte, grown mask,
+// spawned mask, removed food cells, added food cells
+void write_tick(Network::Buffer &b, const TickUpdate &m) {
+    auto &c = m.changes;
+    auto identity = [](u32 slot) { return slot; };
+
+    b.write_varint(m.tick);
+    b.write_varint(m.slot_count);
+    b.write_u8((c.moves.empty() ? 0 : TickMoves) |
+               (c.grown.empty() ? 0 : TickGrown) |
+               (c.spawned.empty() ? 0 : TickSpawned) |
+               (c.food_removed.empty() ? 0 : TickFoodRemoved) |
+               (c.food_added.empty() ? 0 : TickFoodAdded));
+
+    if (!c.moves.empty()) {
+        write_mask(b, c.moves, m.slot_count,
+                   [](const SnakeGame::TickChanges::Move &move) {
+                       return move.slot;
+                   });
+        const size_t start = b.bytes.size();
+        b.bytes.resize(start + (c.moves.size() + 3) / 4, 0);
+        for (size_t i = 0; i < c.moves.size(); ++i) {
+            b.bytes[start + i / 4] |= static_cast<u8>(c.moves[i].dir)
+                                      << (i % 4 * 2);
+        }
+    }
+    if (!c.grown.empty())
+        write_mask(b, c.grown, m.slot_count, identity);
+    if (!c.spawned.empty())
+        write_mask(b, c.spawned, m.slot_count, identity);
+    if (!c.food_removed.empty())
+        write_cells(b, c.food_removed);
+    if (!c.food_added.empty())
+        write_cells(b, c.food_added);
+}
+
+bool read_tick(Network::Buffer &b, TickUpdate &m) {
+    auto &c = m.changes;
+    u8 flags;
+    if (!b.read_varint(m.tick) || !b.read_varint(m.slot_count) ||
+        !b.read_u8(flags))
+        return false;
+
+    if (flags & TickMoves) {
+        std::vector<u32> slots;
+        if (!read_mask(b, m.slot_count, slots))
+            return false;
+        u8 bits = 0;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            if (i % 4 == 0 && !b.read_u8(bits))
+                return false;
+            c.moves.push_back(
+                {slots[i],
+                 static_cast<SnakeGame::Direction>(bits >> (i % 4 * 2) & 3)});
+        }
+    }
+    if ((flags & TickGrown) && !read_mask(b, m.slot_count, c.grown))
+        return false;
+    if ((flags & TickSpawned) && !read_mask(b, m.slot_count, c.spawned))
+        return false;
+    if ((flags & TickFoodRemoved) && !read_cells(b, c.food_removed))
+        return false;
+    if ((flags & TickFoodAdded) && !read_cells(b, c.food_added))
+        return false;
+    return true;
+}
+
+// A path is a run of cells where each one is the same as or next to the
+// previous one, which holds for snake bodies. The first cell is sent as is
+// and the others as 4 bit steps, two to a byte. Anything else is sent raw.
+u8 step_code(const sf::Vector2i &from, const sf::Vector2i &to) {
+    const auto d = sf::Vector2i(to.x - from.x, to.y - from.y);
+    if (d == sf::Vector2i(0, 0))
+        return 0;
+    if (d == sf::Vector2i(0, -1))
+        return 1;
+    if (d == sf::Vector2i(1, 0))
+        return 2;
+    if (d == sf::Vector2i(0, 1))
+        return 3;
+    if (d == sf::Vector2i(-1, 0))
+        return 4;
+    return 0xff;
+}
+
+sf::Vector2i step_offset(u8 code) {
+    constexpr int dx[] = {0, 0, 1, 0, -1};
+    constexpr int dy[] = {0, -1, 0, 1, 0};
+    return {dx[code], dy[code]};
+}
+
+void write_path(Network::Buffer &b, const std::vector<sf::Vector2i> &cells) {
+    bool raw = false;
+    for (size_t i = 1; i < cells.size() && !raw; ++i) {
+        raw = step_code(cells[i - 1], cells[i]) == 0xff;
+    }
+
+    b.write_varint(static_cast<u32>(cells.size()) << 1 | raw);
+    if (cells.empty())
+        return;
+
+    if (raw) {
+        for (auto &p : cells) {
+            b.write_zigzag(p.x);
+            b.write_zigzag(p.y);
+        }
+        return;
+    }
+
+    b.write_zigzag(cells[0].x);
+    b.write_zigzag(cells[0].y);
+    const size_t start = b.bytes.size();
+    b.bytes.resize(start + cells.size() / 2, 0);
+    for (size_t i = 1; i < cells.size(); ++i) {
+        b.bytes[start + (i - 1) / 2] |= step_code(cells[i - 1], cells[i])
+                                        << ((i - 1) % 2 * 4);
+    }
+}
+
+bool read_path(Network::Buffer &b, std::vector<sf::Vector2i> &cells) {
+    u32 v;
+    if (!b.read_varint(v))
+        return false;
+    const u32 n = v >> 1;
+    if (n == 0)
+        return true;
+
+    if (v & 1) {
+        for (u32 i = 0; i < n; ++i) {
+            sf::Vector2i p;
+            if (!b.read_zigzag(p.x) || !b.read_zigzag(p.y))
+                return false;
+            cells.push_back(p);
+        }
+        return true;
+    }
+
+    sf::Vector2i p;
+    if (!b.read_zigzag(p.x) || !b.read_zigzag(p.y))
+        return false;
+    cells.push_back(p);
+    u8 bits = 0;
+    for (u32 i = 1; i < n; ++i) {
+        if ((i - 1) % 2 == 0 && !b.read_u8(bits))
+            return false;
+        const u8 code = bits >> ((i - 1) % 2 * 4) & 0xf;
+        if (code > 4)
+            return false;
+        const auto d = step_offset(code);
+        p = {p.x + d.x, p.y + d.y};
+        cells.push_back(p);
+    }
+    return true;
+}
+
+void write_snapshot(Network::Buffer &b, const WorldSnapshot &m) {
+    b.write_varint(m.tick);
+    b.write_varint(m.base_tick);
+    b.write_varint(m.players.size());
+    for (auto &p : m.players) {
+        b.write_varint(p.id);
+        b.write_u8(static_cast<u8>(p.dir) | p.full << 2);
+        write_path(b, p.head);
+        if (!p.full) {
+            b.write_varint(p.reuse);
+            write_path(b, p.tail);
+        }
+    }
+    b.write_varint(m.players_removed.size());
+    for (auto id : m.players_removed) {
+        b.write_varint(id);
+    }
+    write_cells(b, m.food_removed);
+    write_cells(b, m.food_added);
+}
+
+bool read_snapshot(Network::Buffer &b, WorldSnapshot &m) {
+    u32 n;
+    if (!b.read_varint(m.tick) || !b.read_varint(m.base_tick) ||
+        !b.read_varint(n))
+        return false;
+    for (u32 i = 0; i < n; ++i) {
+        auto &p = m.players.emplace_back();
+        u8 flags;
+        if (!b.read_varint(p.id) || !b.read_u8(flags) ||
+            !read_path(b, p.head))
+            return false;
+        p.dir = static_cast<SnakeGame::Direction>(flags & 3);
+        p.full = flags & 4;
+        if (!p.full && (!b.read_varint(p.reuse) || !read_path(b, p.tail)))
+            return false;
+    }
+    if (!b.read_varint(n))
+        return false;
+    for (u32 i = 0; i < n; ++i) {
+        if (!b.read_varint(m.players_removed.emplace_back()))
+            return false;
+    }
+    return read_cells(b, m.food_removed) && read_cells(b, m.food_added);
+}
+
+// Finds where the base body reappears in the new one, which is where the
+// snake was before the moves made since the base.
+SnakeDelta diff_snake(const SnakeGame::SnakeState &from,
+                      const SnakeGame::SnakeState &to) {
+    SnakeDelta d;
+    d.id = to.id;
+    d.dir = to.dir;
+    const auto &old_body = from.body;
+    const auto &new_body = to.body;
+
+    for (size_t k = 0; k < new_body.size() && !old_body.empty(); ++k) {
+        if (new_body[k] != old_body[0])
+            continue;
+        size_t reuse = 0;
+        while (k + reuse < new_body.size() && reuse < old_body.size() &&
+               new_body[k + reuse] == old_body[reuse]) {
+            ++reuse;
+        }
+        d.head.assign(new_body.begin(), new_body.begin() + k);
+        d.reuse = reuse;
+        d.tail.assign(new_body.begin() + k + reuse, new_body.end());
+        return d;
+    }
+
+    d.full = true;
+    d.head = new_body;
+    return d;
+}
+
+} // namespace
+
+WorldSnapshot make_snapshot(const SnakeGame::WorldState *base,
+                            const SnakeGame::WorldState &state) {
+    WorldSnapshot snapshot;
+    snapshot.tick = state.tick;
+
+    if (!base) {
+        for (auto &p : state.players) {
+            snapshot.players.push_back({p.id, p.dir, true, p.body, 0, {}});
+        }
+        snapshot.food_added = state.food;
+        return snapshot;
+    }
+
+    snapshot.base_tick = base->tick;
+
+    // both player lists are sorted by id
+    auto old_it = base->players.begin();
+    for (auto &p : state.players) {
+        while (old_it != base->players.end() && old_it->id < p.id) {
+            snapshot.players_removed.push_back(old_it->id);
+            ++old_it;
+        }
+        if (old_it != base->players.end() && old_it->id == p.id) {
+            if (old_it->dir != p.dir || old_it->body != p.body) {
+                snapshot.players.push_back(diff_snake(*old_it, p));
+            }
+            ++old_it;
+        } else {
+            snapshot.players.push_back({p.id, p.dir, true, p.body, 0, {}});
+        }
+    }
+    for (; old_it != base->players.end(); ++old_it) {
+        snapshot.players_removed.push_back(old_it->id);
+    }
+
+    std::set_difference(base->food.begin(), base->food.end(),
+                        state.food.begin(), state.food.end(),
+                        std::back_inserter(snapshot.food_removed),
+                        SnakeGame::cell_less);
+    std::set_difference(state.food.begin(), state.food.end(),
+                        base->food.begin(), base->food.end(),
+                        std::back_inserter(snapshot.food_added),
+                        SnakeGame::cell_less);
+    return snapshot;
+}
+
+bool apply_snapshot(const SnakeGame::WorldState *base,
+                    const WorldSnapshot &snapshot,
+                    SnakeGame::WorldState &state) {
+    static const SnakeGame::WorldState empty;
+    if (!base)
+        base = &empty;
+    if (base->tick != snapshot.base_tick)
+        return false;
+
+    state.tick = snapshot.tick;
+    state.players.clear();
+
+    auto removed = [&snapshot](Network::ClientID id) {
+        auto &r = snapshot.players_removed;
+        return std::find(r.begin(), r.end(), id) != r.end();
+    };
+    auto find_base = [base](Network::ClientID id) {
+        auto it = std::lower_bound(
+            base->players.begin(), base->players.end(), id,
+            [](const SnakeGame::SnakeState &p, Network::ClientID id) {
+                return p.id < id;
+            });
+        return it != base->players.end() && it->id == id ? &*it : nullptr;
+    };
+
+    for (auto &p : base->players) {
+        if (!removed(p.id))
+            state.players.push_back(p);
+    }
+
+    for (auto &d : snapshot.players) {
+        SnakeGame::SnakeState p{d.id, d.dir, d.head};
+        if (!d.full) {
+            auto old = find_base(d.id);
+            if (!old || d.reuse > old->body.size())
+                return false;
+            p.body.insert(p.body.end(), old->body.begin(),
+                          old->body.begin() + d.reuse);
+            p.body.insert(p.body.end(), d.tail.begin(), d.tail.end());
+        }
+
+        auto it = std::lower_bound(
+            state.players.begin(), state.players.end(), d.id,
+            [](const SnakeGame::SnakeState &p, Network::ClientID id) {
+                return p.id < id;
+            });
+        if (it != state.players.end() && it->id == d.id) {
+            *it = std::move(p);
+        } else {
+            state.players.insert(it, std::move(p));
+        }
+    }
+
+    state.food.clear();
+    std::set_difference(base->food.begin(), base->food.end(),
+                        snapshot.food_removed.begin(),
+                        snapshot.food_removed.end(),
+                        std::back_inserter(state.food), SnakeGame::cell_less);
+    const auto kept = state.food.size();
+    state.food.insert(state.food.end(), snapshot.food_added.begin(),
+                      snapshot.food_added.end());
+    std::inplace_merge(state.food.begin(), state.food.begin() + kept,
+                       state.food.end(), SnakeGame::cell_less);
+    return true;
+}
+
+const char *message_name(u8 tag) {
+    return tag < std::size(MESSAGE_NAMES) ? MESSAGE_NAMES[tag] : "?";
+}
+
+void encode(Network::Buffer &b, const Message &msg) {
+    b.write_u8(static_cast<u8>(msg.body.index()));
+
+    std::visit(
+        [&b](const auto &m) {
+            using T = std::decay_t<decltype(m)>;
+            if constexpr (std::is_same_v<T, HeartBeat>) {
+                b.write_varint(m.time);
+                b.write_varint(m.echo);
+            } else if constexpr (std::is_same_v<T, JoinRequest>) {
+                b.write_u8(m.version);
+                b.write_u8(m.compression);
+            } else if constexpr (std::is_same_v<T, JoinResponse>) {
+                write_id(b, m.id, m.compression, 1);
+            } else if constexpr (std::is_same_v<T, PlayerLeft> ||
+                                 std::is_same_v<T, SpawnPlayer> ||
+                                 std::is_same_v<T, PlayerGrow>) {
+                b.write_varint(m.id);
+            } else if constexpr (std::is_same_v<T, SetReady>) {
+                b.write_u8(m.ready);
+            } else if constexpr (std::is_same_v<T, ServerSetReady> ||
+                                 std::is_same_v<T, NewPlayer>) {
+                write_id(b, m.id, m.ready, 1);
+            } else if constexpr (std::is_same_v<T, SetPlayerInfo>) {
+                // ready in bit 0, spawn direction in bits 1-2, bit 3 set
+                // when the colour is not opaque and carries an alpha byte
+                const bool alpha = m.color.a != 255;
+                b.write_varint(m.id);
+                b.write_u8(m.ready | static_cast<u8>(m.spawn_dir) << 1 |
+                           alpha << 3);
+                b.write_varint(m.spawnX);
+                b.write_varint(m.spawnY);
+                write_color(b, m.color);
+                if (alpha)
+                    b.write_u8(m.color.a);
+            } else if constexpr (std::is_same_v<T, PlayerInput>) {
+                b.write_varint(
+                    (static_cast<u32>(m.key) + 1) << 1 | m.down);
+                b.write_varint(m.seq);
+            } else if constexpr (std::is_same_v<T, MovePlayer>) {
+                write_id(b, m.id, static_cast<u32>(m.dir), 2);
+            } else if constexpr (std::is_same_v<T, SpawnFood> ||
+                                 std::is_same_v<T, DestroyFood>) {
+                b.write_zigzag(m.x);
+                b.write_zigzag(m.y);
+            } else if constexpr (std::is_same_v<T, TickUpdate>) {
+                write_tick(b, m);
+            } else if constexpr (std::is_same_v<T, WorldSnapshot>) {
+                write_snapshot(b, m);
+            } else if constexpr (std::is_same_v<T, SnapshotAck>) {
+                b.write_varint(m.tick);
+            } else if constexpr (std::is_same_v<T, InputAck>) {
+                b.write_varint(m.seq);
+                b.write_varint(m.moves);
+            }
+        },
+        msg.body);
+}
+
+bool decode(Network::Buffer &b, Message &msg) {
+    u8 tag;
+    if (!b.read_u8(tag))
+        return false;
+
+    u32 v = 0;
+    Network::ClientID id = 0;
+    switch (tag) {
+    case tag_of<HeartBeat>(): {
+        auto &m = msg.body.emplace<HeartBeat>();
+        return b.read_varint(m.time) && b.read_varint(m.echo);
+    }
+
+    case tag_of<JoinRequest>(): {
+        // The version always comes first and what follows depends on it,
+        // so a request from an older guest still decodes and gets refused
+        // by the version check instead of dropped as malformed.
+        auto &m = msg.body.emplace<JoinRequest>();
+        if (!b.read_u8(m.version))
+            return false;
+        u8 compression = 0;
+        if (m.version >= 6 && !b.read_u8(compression))
+            return false;
+        m.compression = compression;
+        return true;
+    }
+
+    case tag_of<JoinResponse>():
+        if (!read_id(b, id, v, 1))
+            return false;
+        msg.body.emplace<JoinResponse>(id, v != 0);
+        return true;
+
+    case tag_of<SetReady>(): {
+        u8 ready;
+        if (!b.read_u8(ready))
+            return false;
+        msg.body = SetReady{ready != 0};
+        return true;
+    }
+
+    case tag_of<ServerSetReady>():
+        if (!read_id(b, id, v, 1))
+            return false;
+        msg.body = ServerSetReady{v != 0, id};
+        return true;
+
+    case tag_of<NewPlayer>():
+        if (!read_id(b, id, v, 1))
+            return false;
+        msg.body = NewPlayer{id, v != 0};
+        return true;
+
+    case tag_of<PlayerLeft>():
+        if (!b.read_varint(v))
+            return false;
+        msg.body = PlayerLeft{v};
+        return true;
+
+    case tag_of<SetPlayerInfo>(): {
+        SetPlayerInfo m;
+        u8 flags;
+        if (!b.read_varint(m.id) || !b.read_u8(flags) ||
+            !b.read_varint(m.spawnX) || !b.read_varint(m.spawnY) ||
+            !read_color(b, m.color))
+            return false;
+        m.ready = flags & 1;
+        m.spawn_dir = static_cast<SnakeGame::Direction>(flags >> 1 & 3);
+        m.color.a = 255;
+        if ((flags & 8) && !b.read_u8(m.color.a))
+            return false;
+        msg.body = m;
+        return true;
+    }
+
+    case tag_of<StartGame>():
+        msg.body.emplace<StartGame>();
+        return true;
+
+    case tag_of<PlayerInput>(): {
+        u32 seq;
+        if (!b.read_varint(v) || !b.read_varint(seq))
+            return false;
+        msg.body = PlayerInput{
+            static_cast<sf::Keyboard::Key>(static_cast<i32>(v >> 1) - 1),
+            (v & 1) != 0, seq};
+        return true;
+    }
+
+    case tag_of<SpawnPlayer>():
+        if (!b.read_varint(v))
+            return false;
+        msg.body = SpawnPlayer{v};
+        return true;
+
+    case tag_of<MovePlayer>():
+        if (!read_id(b, id, v, 2))
+            return false;
+        msg.body = MovePlayer{id, static_cast<SnakeGame::Direction>(v)};
+        return true;
+
+    case tag_of<SpawnFood>(): {
+        SpawnFood m;
+        if (!b.read_zigzag(m.x) || !b.read_zigzag(m.y))
+            return false;
+        msg.body = m;
+        return true;
+    }
+
+    case tag_of<DestroyFood>(): {
+        DestroyFood m;
+        if (!b.read_zigzag(m.x) || !b.read_zigzag(m.y))
+            return false;
+        msg.body = m;
+        return true;
+    }
+
+    case tag_of<PlayerGrow>():
+        if (!b.read_varint(v))
+            return false;
+        msg.body = PlayerGrow{v};
+        return true;
+
+    case tag_of<TickUpdate>():
+        return read_tick(b, msg.body.emplace<TickUpdate>());
+
+    case tag_of<WorldSnapshot>():
+        return read_snapshot(b, msg.body.emplace<WorldSnapshot>());
+
+    case tag_of<SnapshotAck>(): {
+        auto &m = msg.body.emplace<SnapshotAck>();
+        return b.read_varint(m.tick);
+    }
+
+    case tag_of<InputAck>(): {
+        auto &m = msg.body.emplace<InputAck>();
+        return b.read_varint(m.seq) && b.read_varint(m.moves);
+    }
+    }
+
+    return false;
+}
+
+} // namespace SnakeNetwork
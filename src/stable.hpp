@@ -1,6 +1,8 @@
 // STD
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #ifdef _WIN32
 #pragma warning(push, 0)
@@ -13,11 +15,17 @@
 #include <condition_variable>
 #include <cstdarg>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <random>
+#include <sstream>
 #include <thread>
 #include <unordered_map>
 #include <variant>
@@ -27,9 +35,11 @@ using std::cout;
 using std::endl;
 using namespace std::chrono_literals;
 
+using u16 = uint16_t;
 using u32 = uint32_t;
 using u64 = uint64_t;
 
+using i16 = int16_t;
 using i32 = int32_t;
 using i64 = int64_t;
 
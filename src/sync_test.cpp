@@ -0,0 +1,280 @@
+#include "network.h"
+#include "snake.h"
+#include "stable_win32.hpp"
+
+// Plays a dedicated host room and a guest against each other in one
+// process, over loopback with the link simulator on both ends, and checks
+// the world the guest shows against the host's at the same tick, every
+// frame. The guest presses random keys so the snakes turn, eat and die. A
+// second guest plays along and leaves a third of the way in, while ticks
+// made with its snake are still on their way to the first.
+// Exits with 1 when the guest was out of sync at any tick it showed or had
+// to throw a tick update away.
+
+extern std::atomic_bool mute_messages;
+
+namespace {
+
+using Clock = Network::Clock;
+using namespace SnakeNetwork;
+
+constexpr auto FRAME = std::chrono::microseconds(1'000'000 / 60);
+
+struct Options {
+    bool udp = true;
+    float loss = 0.2f;
+    float latency_ms = 20.0f;
+    float jitter_ms = 10.0f;
+    u32 seconds = 20;
+    u32 seed = 1;
+};
+
+void usage(const char *name) {
+    printf("usage: %s [--tcp] [--loss P] [--latency MS] [--jitter MS]\n"
+           "          [--seconds S] [--seed N]\n",
+           name);
+}
+
+bool parse(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--tcp") {
+            options.udp = false;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+            return false;
+        const char *value = argv[++i];
+        if (arg == "--loss") {
+            options.loss = std::clamp(std::strtof(value, nullptr), 0.0f, 1.0f);
+        } else if (arg == "--latency") {
+            options.latency_ms = std::strtof(value, nullptr);
+        } else if (arg == "--jitter") {
+            options.jitter_ms = std::strtof(value, nullptr);
+        } else if (arg == "--seconds") {
+            options.seconds = std::max(1ul, std::strtoul(value, nullptr, 10));
+        } else if (arg == "--seed") {
+            options.seed = std::strtoul(value, nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void simulate(Network &network, const Options &options, u32 seed) {
+    network.simulator.loss = options.loss;
+    network.simulator.latency_ms = options.latency_ms;
+    network.simulator.jitter_ms = options.jitter_ms;
+    network.simulator.rng.seed(seed);
+}
+
+// Joins, readies and keeps the connection alive.
+void say_hello(SnakeGame::GuestLobby &guest, bool &ready) {
+    Message msg;
+    if (!guest.network.connected())
+        return;
+    if (guest.local_id == 0) {
+        msg.body = JoinRequest{PROTOCOL_VERSION, false};
+        guest.send(msg);
+        return;
+    }
+    if (!ready) {
+        msg.body = SetReady{true};
+        guest.send(msg);
+        ready = true;
+    }
+    msg.body = HeartBeat{guest.network.metrics.now_ms(), guest.host_time};
+    guest.host_time = 0;
+    guest.send(msg);
+}
+
+// Prints what differs, returns false when anything does.
+bool same(SnakeGame::GuestLobby &guest, const SnakeGame::WorldState &host) {
+    bool ok = true;
+    for (auto &[id, player] : guest.players) {
+        auto p = std::find_if(host.players.begin(), host.players.end(),
+                              [id = id](auto &s) { return s.id == id; });
+        const auto &body = player.body();
+        if (p == host.players.end()) {
+            if (!body.empty()) {
+                printf("tick %u: player %u only on the guest\n", host.tick,
+                       id);
+                ok = false;
+            }
+        } else if (body != p->body ||
+                   (!body.empty() && player.dir() != p->dir)) {
+            printf("tick %u: player %u differs, head %d,%d on the guest and "
+                   "%d,%d on the host\n",
+                   host.tick, id, body.empty() ? -1 : body[0].x,
+                   body.empty() ? -1 : body[0].y,
+                   p->body.empty() ? -1 : p->body[0].x,
+                   p->body.empty() ? -1 : p->body[0].y);
+            ok = false;
+        }
+    }
+    for (auto &p : host.players) {
+        if (!guest.players.count(p.id)) {
+            printf("tick %u: player %u missing on the guest\n", host.tick,
+                   p.id);
+            ok = false;
+        }
+    }
+
+    std::vector<sf::Vector2i> food;
+    for (auto f : guest.game.food) {
+        food.push_back(f->p);
+    }
+    std::sort(food.begin(), food.end(), SnakeGame::cell_less);
+    if (food != host.food) {
+        printf("tick %u: %zu food on the guest, %zu on the host\n", host.tick,
+               food.size(), host.food.size());
+        ok = false;
+    }
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    Options options;
+    if (!parse(argc, argv, options)) {
+        usage(argv[0]);
+        return 1;
+    }
+    mute_messages = true;
+
+    net::io_context ctx;
+    auto work = net::make_work_guard(ctx);
+    std::thread io_thread([&ctx]() { ctx.run(); });
+
+    SnakeGame host_game;
+    host_game.use_udp = options.udp;
+    host_game.use_compression = false;
+    auto &host = host_game.state.emplace<SnakeGame::HostLobby>(
+        host_game, ctx, Network::PORTN);
+    simulate(host.network, options, options.seed);
+
+    SnakeGame guest_game;
+    guest_game.use_udp = options.udp;
+    guest_game.use_compression = false;
+    auto &guest = guest_game.state.emplace<SnakeGame::GuestLobby>(guest_game);
+    simulate(guest.network, options, options.seed + 1);
+
+    SnakeGame leaver_game;
+    leaver_game.use_udp = options.udp;
+    leaver_game.use_compression = false;
+    auto *leaver =
+        &leaver_game.state.emplace<SnakeGame::GuestLobby>(leaver_game);
+    simulate(leaver->network, options, options.seed + 2);
+    bool leaver_ready = false;
+
+    // what the host had at the end of each tick, until the guest got there
+    std::map<u32, SnakeGame::WorldState> host_states;
+    std::mt19937 rng(options.seed);
+    bool ready = false;
+    u32 checked = 0;
+    u32 failed = 0;
+    u32 last_tick = 0;
+
+    const auto end = Clock::now() + std::chrono::seconds(options.seconds);
+    const auto leave = Clock::now() + std::chrono::seconds(options.seconds) / 3;
+    auto next_frame = Clock::now();
+    const float dt = std::chrono::duration<float>(FRAME).count();
+    while (Clock::now() < end) {
+        host.begin_frame();
+        if (!host.game_running) {
+            host.accept_players();
+            if (host.players.size() == 2 &&
+                std::all_of(host.players.begin(), host.players.end(),
+                            [](auto &p) { return p.second.ready; })) {
+                host.start_game();
+                host_states.emplace(host.tick, host.world_state());
+            }
+        }
+        host.receive();
+        if (host.game_running) {
+            Input input(host_game.frame_arena);
+            host.game_tick(input, dt);
+            host_states.emplace(host.tick, host.world_state());
+        }
+        host.end_frame();
+        host_game.frame_arena.reset();
+
+        if (leaver && Clock::now() >= leave) {
+            leaver_game.state.emplace<SnakeGame::MainMenu>();
+            leaver = nullptr;
+        }
+        if (leaver) {
+            leaver->send_buffer.reset();
+            say_hello(*leaver, leaver_ready);
+            if (leaver->game_running) {
+                Input input(leaver_game.frame_arena);
+                leaver->game_tick(input, dt);
+            }
+            if (!leaver->send_buffer.bytes.empty()) {
+                leaver->network.send(leaver->send_buffer, 0);
+            }
+            if (leaver->network.connected()) {
+                leaver->receive();
+            }
+            leaver_game.frame_arena.reset();
+        }
+
+        guest.send_buffer.reset();
+        say_hello(guest, ready);
+        if (guest.game_running) {
+            Input input(guest_game.frame_arena);
+            if (rng() % 20 == 0) {
+                constexpr sf::Keyboard::Key keys[] = {
+                    sf::Keyboard::Left, sf::Keyboard::Right,
+                    sf::Keyboard::Up, sf::Keyboard::Down};
+                input.push(Input::KeyPressed{keys[rng() % 4], Clock::now()});
+            }
+            guest.game_tick(input, dt);
+
+            if (guest.tick != last_tick) {
+                last_tick = guest.tick;
+                auto it = host_states.lower_bound(guest.tick);
+                host_states.erase(host_states.begin(), it);
+                if (it != host_states.end() && it->first == guest.tick) {
+                    checked++;
+                    if (!same(guest, it->second))
+                        failed++;
+                }
+            }
+        }
+        if (!guest.send_buffer.bytes.empty()) {
+            guest.network.send(guest.send_buffer, 0);
+        }
+        if (guest.network.connected() && !guest.receive()) {
+            printf("guest lost the connection\n");
+            failed++;
+            break;
+        }
+        guest_game.frame_arena.reset();
+
+        next_frame += FRAME;
+        std::this_thread::sleep_until(next_frame);
+    }
+
+    const auto stats = host.network.send_stats(guest.local_id);
+    printf("%s, loss %.0f%%, latency %.0f +- %.0f ms: %u ticks checked, "
+           "%u out of sync, %llu tick updates rejected, %s, "
+           "%llu simulated losses, %llu frames resent\n",
+           options.udp ? "udp" : "tcp", options.loss * 100,
+           options.latency_ms, options.jitter_ms, checked, failed,
+           static_cast<unsigned long long>(guest.rejected_ticks),
+           host.players.size() == 1 ? "one left" : "nobody left",
+           static_cast<unsigned long long>(host.network.simulator.dropped +
+                                           guest.network.simulator.dropped),
+           static_cast<unsigned long long>(stats ? stats->frames_resent : 0));
+
+    ctx.stop();
+    work.reset();
+    io_thread.join();
+    return failed == 0 && guest.rejected_ticks == 0 && checked > 0 ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+#pragma once
+#include "stable_win32.hpp"
+
+// A handle to a scheduled timer, stale once it fired or was cancelled.
+struct TimerID {
+    u32 index = 0;
+    // odd while the timer is pending, so 0 is never valid
+    u32 generation = 0;
+};
+
+// Timers counted in ticks of whoever drives it, fired from advance. There
+// are LEVELS wheels of SLOTS slots: the first holds what is due within
+// SLOTS ticks, one slot a tick, and each next one SLOTS times further out
+// with a slot as wide as the whole wheel below it. When the first wheel
+// comes round, the current slot of the second is handed down into it, and
+// so on up. Scheduling and cancelling are O(1), a tick costs the timers it
+// fires plus what moves down a level.
+//
+// Callbacks run from advance and may schedule and cancel timers, the ones
+// they schedule fire on a later tick at the earliest.
+class TimingWheel {
+public:
+    using Callback = std::function<void()>;
+
+    static constexpr u32 BITS = 6;
+    static constexpr u32 SLOTS = 1 << BITS;
+    static constexpr u32 LEVELS = 4;
+    // longer delays are cut down to this
+    static constexpr u64 MAX_DELAY = (u64(1) << (BITS * LEVELS)) - 1;
+
+    TimingWheel() { heads.fill(NONE); }
+    TimingWheel(const TimingWheel &) = delete;
+    void operator=(const TimingWheel &) = delete;
+
+    // Fires on the advance delay ticks from now, a delay of 0 on the next.
+    TimerID schedule(u64 delay, Callback callback) {
+        delay = std::clamp<u64>(delay, 1, MAX_DELAY);
+        u32 index;
+        if (free_head != NONE) {
+            index = free_head;
+            free_head = nodes[index].next;
+        } else {
+            index = static_cast<u32>(nodes.size());
+            nodes.emplace_back();
+        }
+        auto &node = nodes[index];
+        node.expiry = ticks + delay;
+        node.callback = std::move(callback);
+        node.generation++;
+        place(index);
+        pending_count++;
+        return {index, node.generation};
+    }
+
+    // false when the timer already fired or was cancelled
+    bool cancel(TimerID id) {
+        if (!pending(id))
+            return false;
+        unlink(id.index);
+        release(id.index);
+        return true;
+    }
+
+    bool pending(TimerID id) const {
+        return (id.generation & 1) && id.index < nodes.size() &&
+               nodes[id.index].generation == id.generation;
+    }
+
+    // Moves on by n ticks, firing each tick's timers in turn.
+    void advance(u64 n = 1) {
+        for (u64 i = 0; i < n; ++i) {
+            step();
+        }
+    }
+
+    // Drops every pending timer without firing it.
+    void clear() {
+        for (u32 bucket = 0; bucket < heads.size(); ++bucket) {
+            while (heads[bucket] != NONE) {
+                const u32 index = heads[bucket];
+                unlink(index);
+                release(index);
+            }
+        }
+    }
+
+    // ticks advanced so far
+    u64 now() const { return ticks; }
+    size_t size() const { return pending_count; }
+
+private:
+    static constexpr u32 NONE = ~0u;
+    static constexpr u32 MASK = SLOTS - 1;
+    // the bucket of the timers a tick is firing
+    static constexpr u32 FIRING = LEVELS * SLOTS;
+
+    struct Node {
+        u64 expiry = 0;
+        Callback callback;
+        // neighbours in the slot's list, the next free node while free
+        u32 prev = NONE;
+        u32 next = NONE;
+        u32 bucket = NONE;
+        u32 generation = 0;
+    };
+
+    // Same as the wheel turning: the level follows how far out the expiry
+    // is from the tick about to be processed, the slot from the expiry.
+    void place(u32 index) {
+        auto &node = nodes[index];
+        const u64 due = node.expiry - (ticks + 1);
+        u32 level = 0;
+        while (level + 1 < LEVELS && due >= (u64(1) << (BITS * (level + 1))))
+            level++;
+        const u32 slot = (node.expiry >> (BITS * level)) & MASK;
+        link(index, level * SLOTS + slot);
+    }
+
+    void link(u32 index, u32 bucket) {
+        auto &node = nodes[index];
+        node.bucket = bucket;
+        node.prev = NONE;
+        node.next = heads[bucket];
+        if (node.next != NONE)
+            nodes[node.next].prev = index;
+        heads[bucket] = index;
+    }
+
+    void unlink(u32 index) {
+        auto &node = nodes[index];
+        if (node.prev != NONE) {
+            nodes[node.prev].next = node.next;
+        } else {
+            heads[node.bucket] = node.next;
+        }
+        if (node.next != NONE)
+            nodes[node.next].prev = node.prev;
+        node.prev = node.next = NONE;
+        node.bucket = NONE;
+    }
+
+    void release(u32 index) {
+        auto &node = nodes[index];
+        node.callback = nullptr;
+        node.generation++;
+        node.next = free_head;
+        free_head = index;
+        pending_count--;
+    }
+
+    // Hands a slot of level down to the levels below, returns the slot.
+    u32 cascade(u32 level) {
+        const u32 slot = ((ticks + 1) >> (BITS * level)) & MASK;
+        const u32 bucket = level * SLOTS + slot;
+        while (heads[bucket] != NONE) {
+            const u32 index = heads[bucket];
+            unlink(index);
+            place(index);
+        }
+        return slot;
+    }
+
+    void step() {
+        const u32 slot = (ticks + 1) & MASK;
+        if (slot == 0) {
+            for (u32 level = 1; level < LEVELS && cascade(level) == 0;
+                 ++level) {
+            }
+        }
+        ticks++;
+
+        // Off the wheel first: a timer scheduled a whole turn out lands in
+        // the slot being fired.
+        while (heads[slot] != NONE) {
+            const u32 index = heads[slot];
+            unlink(index);
+            link(index, FIRING);
+        }
+        // one at a time, a callback may cancel the others
+        while (heads[FIRING] != NONE) {
+            const u32 index = heads[FIRING];
+            unlink(index);
+            auto callback = std::move(nodes[index].callback);
+            release(index);
+            callback();
+        }
+    }
+
+    std::vector<Node> nodes;
+    std::array<u32, LEVELS * SLOTS + 1> heads;
+    u32 free_head = NONE;
+    u64 ticks = 0;
+    size_t pending_count = 0;
+};
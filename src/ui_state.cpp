@@ -0,0 +1,54 @@
+#include "ui_state.h"
+#include "stable_win32.hpp"
+
+std::atomic_bool mute_messages = false;
+
+namespace ui {
+
+float LogMessage::SHOW_DELAY = 5.0f;
+float LogMessage::FADE_DELAY = 1.0f;
+
+std::list<LogMessage> messages;
+u32 max_messages = 10;
+std::mutex message_mutex;
+
+namespace {
+std::unordered_map<std::string, PushButton> push_button_map;
+std::unordered_map<std::string, ToggleButton> toggle_button_map;
+} // namespace
+
+PushButton &push_button_state(const std::string &label, bool &made) {
+    auto [it, inserted] = push_button_map.try_emplace(label);
+    made = inserted;
+    return it->second;
+}
+
+ToggleButton &toggle_button_state(const std::string &label, bool &made) {
+    auto [it, inserted] = toggle_button_map.try_emplace(label);
+    made = inserted;
+    return it->second;
+}
+
+} // namespace ui
+
+void add_message(std::string fmt, ...) {
+    if (mute_messages)
+        return;
+    static char buffer[255];
+    std::lock_guard scope_guard(ui::message_mutex);
+    auto t = std::time(nullptr);
+    auto tm = *std::localtime(&t);
+
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "[%H:%M:%S] ") << fmt;
+
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), oss.str().c_str(), args);
+    va_end(args);
+    printf("%s\n", buffer);
+    ui::messages.emplace_front(buffer);
+    if (ui::messages.size() > ui::max_messages) {
+        ui::messages.pop_back();
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "engine.h"
+#include "stable_win32.hpp"
+
+// What the ui keeps from frame to frame, apart from drawing it: the message
+// log add_message writes to and the buttons by label. The game draws them
+// in main.cpp, the tools and benchmarks link the same code without a
+// window.
+
+// set by tools whose hundreds of connections would flood the output
+extern std::atomic_bool mute_messages;
+
+namespace ui {
+
+struct LogMessage {
+    static float SHOW_DELAY;
+    static float FADE_DELAY;
+
+    std::string text;
+    float show_delay = 5.0f;
+    LogMessage(std::string text)
+        : text(std::move(text)), show_delay(SHOW_DELAY) {}
+};
+
+// newest first, at most max_messages, only touched under message_mutex
+extern std::list<LogMessage> messages;
+extern u32 max_messages;
+extern std::mutex message_mutex;
+
+// The button drawn with label, made the first time it is asked for. made
+// is set then, for the caller to set its text up.
+PushButton &push_button_state(const std::string &label, bool &made);
+ToggleButton &toggle_button_state(const std::string &label, bool &made);
+
+} // namespace ui